@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef BENCHMARK_COMMON_HPP
+#define BENCHMARK_COMMON_HPP
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#endif
+
+/*
+  Shared helpers for the RAJA microbenchmarks. Memory comes back
+  host-accessible regardless of how RAJA was configured (unified memory
+  when a device back-end is enabled), so one benchmark body can be timed
+  against every enabled execution policy. The problem sizes below are
+  applied to each benchmark so runs of different releases can be compared
+  point for point.
+*/
+
+// Small / medium / large iteration counts registered for every benchmark.
+#define RAJA_BENCHMARK_SIZES Arg(1 << 12)->Arg(1 << 18)->Arg(1 << 24)
+
+namespace raja_benchmark
+{
+
+template <typename T>
+T* allocate(RAJA::Index_type size)
+{
+  T* ptr;
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk(
+      cudaMallocManaged((void**)&ptr, sizeof(T) * size, cudaMemAttachGlobal));
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk(hipMallocManaged((void**)&ptr, sizeof(T) * size));
+#else
+  ptr = new T[size];
+#endif
+  return ptr;
+}
+
+template <typename T>
+void deallocate(T*& ptr)
+{
+  if (ptr) {
+#if defined(RAJA_ENABLE_CUDA)
+    cudaErrchk(cudaFree(ptr));
+#elif defined(RAJA_ENABLE_HIP)
+    hipErrchk(hipFree(ptr));
+#else
+    delete[] ptr;
+#endif
+    ptr = nullptr;
+  }
+}
+
+//
+// Minimal allocator over the helpers above, for containers that must be
+// usable from both host and device (e.g. WorkGroup storage).
+//
+template <typename T>
+struct BenchAllocator {
+  using value_type = T;
+
+  BenchAllocator() = default;
+
+  template <typename U>
+  BenchAllocator(BenchAllocator<U> const&) noexcept
+  {
+  }
+
+  T* allocate(size_t num)
+  {
+    return raja_benchmark::allocate<T>(RAJA::Index_type(num));
+  }
+
+  void deallocate(T* ptr, size_t) { raja_benchmark::deallocate(ptr); }
+};
+
+template <typename T, typename U>
+inline bool operator==(BenchAllocator<T> const&, BenchAllocator<U> const&)
+{
+  return true;
+}
+
+template <typename T, typename U>
+inline bool operator!=(BenchAllocator<T> const& lhs,
+                       BenchAllocator<U> const& rhs)
+{
+  return !(lhs == rhs);
+}
+
+}  // namespace raja_benchmark
+
+#endif  // BENCHMARK_COMMON_HPP
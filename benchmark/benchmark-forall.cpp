@@ -0,0 +1,67 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA::forall microbenchmark: daxpy at several sizes over every enabled
+// back-end, for release-to-release performance comparison.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark-common.hpp"
+
+template <typename ExecPolicy>
+static void BM_forall_daxpy(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+
+  double* a = raja_benchmark::allocate<double>(N);
+  double* b = raja_benchmark::allocate<double>(N);
+
+  for (RAJA::Index_type i = 0; i < N; i++) {
+    a[i] = 1.0;
+    b[i] = 2.0;
+  }
+  double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N),
+                             [=] RAJA_HOST_DEVICE(RAJA::Index_type i) {
+                               a[i] += b[i] * c;
+                             });
+  }
+
+  raja_benchmark::deallocate(a);
+  raja_benchmark::deallocate(b);
+}
+
+BENCHMARK_TEMPLATE(BM_forall_daxpy, RAJA::seq_exec)->RAJA_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_forall_daxpy, RAJA::loop_exec)->RAJA_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_forall_daxpy, RAJA::simd_exec)->RAJA_BENCHMARK_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(BM_forall_daxpy, RAJA::omp_parallel_for_exec)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(BM_forall_daxpy, RAJA::tbb_for_exec)->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+BENCHMARK_TEMPLATE(BM_forall_daxpy, RAJA::cuda_exec<256>)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+BENCHMARK_TEMPLATE(BM_forall_daxpy, RAJA::hip_exec<256>)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+BENCHMARK_MAIN();
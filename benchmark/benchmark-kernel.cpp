@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA::kernel microbenchmark: dense matrix-vector product through a
+// two-level loop nest, over the kernel policies of every enabled
+// back-end. The benchmark size argument is the total element count; the
+// matrix is kept square.
+//
+
+#include <cmath>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark-common.hpp"
+
+template <typename KernelPolicy>
+static void BM_kernel_matvec(benchmark::State& state)
+{
+  const RAJA::Index_type N =
+      RAJA::Index_type(std::sqrt(double(state.range(0))));
+
+  double* A = raja_benchmark::allocate<double>(N * N);
+  double* x = raja_benchmark::allocate<double>(N);
+  double* y = raja_benchmark::allocate<double>(N);
+
+  for (RAJA::Index_type i = 0; i < N; i++) {
+    x[i] = 1.0;
+    y[i] = 0.0;
+    for (RAJA::Index_type j = 0; j < N; j++) {
+      A[i * N + j] = double(i + j);
+    }
+  }
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<KernelPolicy>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, N)),
+        [=] RAJA_HOST_DEVICE(RAJA::Index_type i, RAJA::Index_type j) {
+          RAJA::atomicAdd<RAJA::auto_atomic>(&y[i], A[i * N + j] * x[j]);
+        });
+  }
+
+  raja_benchmark::deallocate(A);
+  raja_benchmark::deallocate(x);
+  raja_benchmark::deallocate(y);
+}
+
+using SeqKernelPol =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::seq_exec,
+        RAJA::statement::For<1, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+BENCHMARK_TEMPLATE(BM_kernel_matvec, SeqKernelPol)->RAJA_BENCHMARK_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+using OmpKernelPol =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+        RAJA::statement::For<1, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+BENCHMARK_TEMPLATE(BM_kernel_matvec, OmpKernelPol)->RAJA_BENCHMARK_SIZES;
+
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+
+using CudaKernelPol =
+    RAJA::KernelPolicy<
+      RAJA::statement::CudaKernel<
+        RAJA::statement::For<0, RAJA::cuda_block_x_loop,
+          RAJA::statement::For<1, RAJA::cuda_thread_x_loop,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >;
+
+BENCHMARK_TEMPLATE(BM_kernel_matvec, CudaKernelPol)->RAJA_BENCHMARK_SIZES;
+
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+
+using HipKernelPol =
+    RAJA::KernelPolicy<
+      RAJA::statement::HipKernel<
+        RAJA::statement::For<0, RAJA::hip_block_x_loop,
+          RAJA::statement::For<1, RAJA::hip_thread_x_loop,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >;
+
+BENCHMARK_TEMPLATE(BM_kernel_matvec, HipKernelPol)->RAJA_BENCHMARK_SIZES;
+
+#endif
+
+BENCHMARK_MAIN();
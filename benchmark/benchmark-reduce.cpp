@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA::ReduceSum microbenchmark at several sizes over every enabled
+// back-end, pairing each reduce policy with its matching forall policy.
+// The reducer is constructed inside the timed loop so its setup and
+// combine costs are part of the measurement, as they are in application
+// loops.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark-common.hpp"
+
+template <typename ExecPolicy, typename ReducePolicy>
+static void BM_reduce_sum(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+
+  double* a = raja_benchmark::allocate<double>(N);
+
+  for (RAJA::Index_type i = 0; i < N; i++) {
+    a[i] = 1.0;
+  }
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N),
+                             [=] RAJA_HOST_DEVICE(RAJA::Index_type i) {
+                               sum += a[i];
+                             });
+
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  raja_benchmark::deallocate(a);
+}
+
+BENCHMARK_TEMPLATE(BM_reduce_sum, RAJA::seq_exec, RAJA::seq_reduce)
+    ->RAJA_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_reduce_sum, RAJA::loop_exec, RAJA::loop_reduce)
+    ->RAJA_BENCHMARK_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(BM_reduce_sum,
+                   RAJA::omp_parallel_for_exec,
+                   RAJA::omp_reduce)
+    ->RAJA_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_reduce_sum,
+                   RAJA::omp_parallel_for_exec,
+                   RAJA::omp_reduce_ordered)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(BM_reduce_sum, RAJA::tbb_for_exec, RAJA::tbb_reduce)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+BENCHMARK_TEMPLATE(BM_reduce_sum, RAJA::cuda_exec<256>, RAJA::cuda_reduce)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+BENCHMARK_TEMPLATE(BM_reduce_sum, RAJA::hip_exec<256>, RAJA::hip_reduce)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA::inclusive_scan microbenchmark at several sizes over every
+// enabled back-end. The out-of-place form is used so the input does not
+// have to be regenerated between timed iterations.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark-common.hpp"
+
+template <typename ExecPolicy>
+static void BM_scan_inclusive(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+
+  int* in = raja_benchmark::allocate<int>(N);
+  int* out = raja_benchmark::allocate<int>(N);
+
+  for (RAJA::Index_type i = 0; i < N; i++) {
+    in[i] = 1;
+  }
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<ExecPolicy>(in, in + N, out);
+  }
+
+  raja_benchmark::deallocate(in);
+  raja_benchmark::deallocate(out);
+}
+
+BENCHMARK_TEMPLATE(BM_scan_inclusive, RAJA::seq_exec)->RAJA_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_scan_inclusive, RAJA::loop_exec)->RAJA_BENCHMARK_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(BM_scan_inclusive, RAJA::omp_parallel_for_exec)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(BM_scan_inclusive, RAJA::tbb_for_exec)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+BENCHMARK_TEMPLATE(BM_scan_inclusive, RAJA::cuda_exec<256>)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+BENCHMARK_TEMPLATE(BM_scan_inclusive, RAJA::hip_exec<256>)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+BENCHMARK_MAIN();
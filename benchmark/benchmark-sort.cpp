@@ -0,0 +1,65 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA::sort microbenchmark at several sizes over every enabled
+// back-end. The input is re-randomized outside the timed section before
+// each iteration so every sort sees unsorted data.
+//
+
+#include <random>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark-common.hpp"
+
+template <typename ExecPolicy>
+static void BM_sort(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+
+  int* data = raja_benchmark::allocate<int>(N);
+
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> dist;
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    for (RAJA::Index_type i = 0; i < N; i++) {
+      data[i] = dist(rng);
+    }
+    state.ResumeTiming();
+
+    RAJA::sort<ExecPolicy>(data, data + N);
+  }
+
+  raja_benchmark::deallocate(data);
+}
+
+BENCHMARK_TEMPLATE(BM_sort, RAJA::seq_exec)->RAJA_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_sort, RAJA::loop_exec)->RAJA_BENCHMARK_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(BM_sort, RAJA::omp_parallel_for_exec)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(BM_sort, RAJA::tbb_for_exec)->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+BENCHMARK_TEMPLATE(BM_sort, RAJA::cuda_exec<256>)->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+BENCHMARK_TEMPLATE(BM_sort, RAJA::hip_exec<256>)->RAJA_BENCHMARK_SIZES;
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA WorkGroup microbenchmark: many small daxpy loops enqueued into
+// one pool and run as a group, over every enabled back-end. The
+// benchmark size argument is the total iteration count, split across a
+// fixed number of enqueued loops; enqueue, instantiate, and run are all
+// inside the timed section since applications pay all three each cycle.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark-common.hpp"
+
+static const RAJA::Index_type num_loops = 64;
+
+template <typename ExecPolicy, typename OrderPolicy>
+static void BM_workgroup_daxpy(benchmark::State& state)
+{
+  using WorkGroupPol = RAJA::WorkGroupPolicy<
+      ExecPolicy,
+      OrderPolicy,
+      RAJA::constant_stride_array_of_objects>;
+  using Allocator = raja_benchmark::BenchAllocator<char>;
+
+  using WorkPool_type = RAJA::
+      WorkPool<WorkGroupPol, RAJA::Index_type, RAJA::xargs<>, Allocator>;
+  using WorkGroup_type = RAJA::
+      WorkGroup<WorkGroupPol, RAJA::Index_type, RAJA::xargs<>, Allocator>;
+  using WorkSite_type = RAJA::
+      WorkSite<WorkGroupPol, RAJA::Index_type, RAJA::xargs<>, Allocator>;
+
+  const RAJA::Index_type N = state.range(0);
+  const RAJA::Index_type len = N / num_loops;
+
+  double* a = raja_benchmark::allocate<double>(N);
+  double* b = raja_benchmark::allocate<double>(N);
+
+  for (RAJA::Index_type i = 0; i < N; i++) {
+    a[i] = 1.0;
+    b[i] = 2.0;
+  }
+  double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    WorkPool_type pool(Allocator{});
+
+    for (RAJA::Index_type l = 0; l < num_loops; ++l) {
+      pool.enqueue(RAJA::TypedRangeSegment<RAJA::Index_type>(l * len,
+                                                             (l + 1) * len),
+                   [=] RAJA_HOST_DEVICE(RAJA::Index_type i) {
+                     a[i] += b[i] * c;
+                   });
+    }
+
+    WorkGroup_type group = pool.instantiate();
+    WorkSite_type site = group.run();
+  }
+
+  raja_benchmark::deallocate(a);
+  raja_benchmark::deallocate(b);
+}
+
+BENCHMARK_TEMPLATE(BM_workgroup_daxpy, RAJA::seq_work, RAJA::ordered)
+    ->RAJA_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_workgroup_daxpy, RAJA::loop_work, RAJA::ordered)
+    ->RAJA_BENCHMARK_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(BM_workgroup_daxpy, RAJA::omp_work, RAJA::ordered)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(BM_workgroup_daxpy, RAJA::tbb_work, RAJA::ordered)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+BENCHMARK_TEMPLATE(BM_workgroup_daxpy,
+                   RAJA::cuda_work<256>,
+                   RAJA::ordered)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+BENCHMARK_TEMPLATE(BM_workgroup_daxpy, RAJA::hip_work<256>, RAJA::ordered)
+    ->RAJA_BENCHMARK_SIZES;
+#endif
+
+BENCHMARK_MAIN();
@@ -15,6 +15,20 @@ if (ENABLE_OPENMP)
   endif()
 endif()
 
+if (RAJA_ENABLE_ROOFLINE_PLUGIN)
+  find_package(PAPI)
+  if(PAPI_FOUND)
+    blt_register_library(
+      NAME papi
+      INCLUDES ${PAPI_INCLUDE_DIRS}
+      LIBRARIES ${PAPI_LIBRARIES})
+    message(STATUS "PAPI Enabled")
+  else()
+    message(WARNING "PAPI NOT FOUND, roofline plugin disabled")
+    set(RAJA_ENABLE_ROOFLINE_PLUGIN Off)
+  endif()
+endif ()
+
 if (ENABLE_TBB)
   find_package(TBB)
   if(TBB_FOUND)
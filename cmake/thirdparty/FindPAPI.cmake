@@ -0,0 +1,31 @@
+###############################################################################
+# Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+# and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (BSD-3-Clause)
+###############################################################################
+
+# - Find PAPI
+# Find the Performance API (PAPI) includes and library.
+#
+#  PAPI_INCLUDE_DIRS - where to find papi.h
+#  PAPI_LIBRARIES    - the papi library
+#  PAPI_FOUND        - True if PAPI was found
+
+find_path(PAPI_INCLUDE_DIRS
+  NAMES papi.h
+  HINTS ${PAPI_DIR}
+  PATH_SUFFIXES include)
+
+find_library(PAPI_LIBRARIES
+  NAMES papi
+  HINTS ${PAPI_DIR}
+  PATH_SUFFIXES lib lib64)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(PAPI
+  DEFAULT_MSG
+  PAPI_LIBRARIES
+  PAPI_INCLUDE_DIRS)
+
+mark_as_advanced(PAPI_INCLUDE_DIRS PAPI_LIBRARIES)
@@ -28,6 +28,7 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/util/Allocators.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/basic_mempool.hpp"
 #include "RAJA/util/camp_aliases.hpp"
@@ -44,6 +45,7 @@
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/kernel.hpp"
 #include "RAJA/pattern/teams.hpp"
+#include "RAJA/pattern/graph.hpp"
 
 
 //
@@ -65,6 +67,10 @@
 #include "RAJA/policy/tbb.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/threads.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda.hpp"
 #endif
@@ -73,6 +79,10 @@
 #include "RAJA/policy/hip.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+#include "RAJA/policy/sycl.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
 #include "RAJA/policy/openmp.hpp"
 
@@ -82,6 +92,9 @@
 #endif
 
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/RangeSegment3D.hpp"
+#include "RAJA/index/SegmentAlgebra.hpp"
+#include "RAJA/index/SpatialIndexSet.hpp"
 
 //
 // Strongly typed index class
@@ -94,26 +107,80 @@
 // in the files included below.
 //
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/fuse.hpp"
 #include "RAJA/pattern/region.hpp"
 
 #include "RAJA/policy/MultiPolicy.hpp"
+#include "RAJA/policy/PolicyHandle.hpp"
+
+#include "RAJA/index/StaticIndexSet.hpp"
 
 
 //
 // Multidimensional layouts and views
 //
+#include "RAJA/util/AoSoALayout.hpp"
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
 #include "RAJA/util/PermutedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
+#include "RAJA/util/TiledLayout.hpp"
 #include "RAJA/util/View.hpp"
 
+#include "RAJA/util/BlockSparseView.hpp"
+
+//
+// Memory-mapped read-only views for large lookup tables
+//
+#include "RAJA/util/MappedView.hpp"
+
+//
+// Opt-in expression templates for fusing elementwise View updates
+//
+#include "RAJA/util/ViewExpression.hpp"
+
+//
+// Cache-bypass stores for write-only data
+//
+#include "RAJA/util/StreamingStore.hpp"
+
+//
+// Per-kernel fast-math annotation and approximate math functions
+//
+#include "RAJA/util/fastmath.hpp"
+
+//
+// Packed value+location keys for vectorizable loc reductions
+//
+#include "RAJA/util/PackedLoc.hpp"
+
+
+//
+// Fault-recovery wrappers around forall
+//
+#include "RAJA/util/Resilience.hpp"
+
+
+//
+// Struct-of-arrays container with AoS-style access
+//
+#include "RAJA/util/SoAPtr.hpp"
+
+//
+// Resource-aware vector with asynchronous storage operations
+//
+#include "RAJA/internal/ResourceVec.hpp"
 
 //
 // View for sequences of objects
 //
 #include "RAJA/util/Span.hpp"
 
+//
+// Span over unified memory with prefetch hints
+//
+#include "RAJA/util/ManagedSpan.hpp"
+
 //
 // zip iterator to iterator over sequences simultaneously
 //
@@ -139,15 +206,31 @@
 //
 #include "RAJA/util/sort.hpp"
 
+//
+// Self-tuning kernel variant harness
+//
+#include "RAJA/util/Autotuner.hpp"
+
+//
+// Host cache-topology probe
+//
+#include "RAJA/util/HwTopology.hpp"
+
 //
 // WorkPool, WorkGroup, WorkSite objects
 //
 #include "RAJA/policy/WorkGroup.hpp"
 #include "RAJA/pattern/WorkGroup.hpp"
 
+//
+// Halo-exchange communication plan built on workgroups
+//
+#include "RAJA/pattern/halo_exchange.hpp"
+
 //
 // Reduction objects
 //
+#include "RAJA/pattern/multi_reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 
@@ -172,10 +255,26 @@
 #include "RAJA/index/IndexSetUtils.hpp"
 #include "RAJA/index/IndexSetBuilders.hpp"
 
+#include "RAJA/pattern/find.hpp"
+
 #include "RAJA/pattern/scan.hpp"
 
+#include "RAJA/pattern/compact.hpp"
+
+#include "RAJA/pattern/permute.hpp"
+
+#include "RAJA/pattern/fill.hpp"
+
 #include "RAJA/util/PluginLinker.hpp"
 
 #include "RAJA/pattern/sort.hpp"
 
+#include "RAJA/pattern/segmented_reduce.hpp"
+
+#include "RAJA/pattern/reduce_then_transform.hpp"
+
+#include "RAJA/pattern/masked_forall.hpp"
+
+#include "RAJA/pattern/batched_gemm.hpp"
+
 #endif  // closing endif for header file include guard
@@ -20,6 +20,11 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
@@ -37,6 +42,15 @@ namespace RAJA
 enum PushEnd { PUSH_FRONT, PUSH_BACK };
 enum PushCopy { PUSH_COPY, PUSH_NOCOPY };
 
+///
+/// Built-in segment orderings for TypedIndexSet::reorder().
+///
+/// ORDER_BY_TYPE groups segments of the same type contiguously, in
+/// declaration order of the set's segment types, so type-batched
+/// iteration (see segmentCallTypeRuns()) resolves each type once.
+///
+enum SegmentOrder { ORDER_DESCENDING_SIZE, ORDER_ASCENDING_SIZE, ORDER_BY_TYPE };
+
 template <typename... TALL>
 class TypedIndexSet;
 
@@ -60,10 +74,35 @@ struct ExecPolicy
   using seg_exec = SEG_EXEC_POLICY_T;
 };
 
+///
+/// Class representing index set execution policy with per-segment
+/// execution policy selection.
+///
+/// The first template parameter describes the policy for iterating
+/// over segments. The remaining parameters are candidate policies for
+/// executing a segment: each segment runs with the policy at the
+/// position given by its exec tag (see setSegmentExecTag()), assigned
+/// when the set is built. This lets one set mix, say, many tiny
+/// boundary segments tagged into a sequential bucket with large
+/// interior segments tagged for a device policy, without splitting the
+/// set by hand. Untagged segments run with the first execution policy;
+/// tags past the end of the list run with the last.
+///
+template <typename SEG_ITER_POLICY_T,
+          typename SEG_EXEC_POLICY0_T,
+          typename... SEG_EXEC_POLICY_REST>
+struct TaggedExecPolicy
+    : public RAJA::make_policy_pattern_t<SEG_EXEC_POLICY0_T::policy,
+                                         RAJA::Pattern::forall> {
+  using seg_it = SEG_ITER_POLICY_T;
+  using seg_exec = SEG_EXEC_POLICY0_T;
+};
+
 }  // end namespace indexset
 }  // end namespace policy
 
 using policy::indexset::ExecPolicy;
+using policy::indexset::TaggedExecPolicy;
 
 
 /*!
@@ -353,6 +392,60 @@ public:
     body(*data[offset], std::forward<ARGS>(args)...);
   }
 
+  ///
+  /// Calls the operator "body" with each segment in [begin_seg, end_seg),
+  /// resolving the segment type once for the whole interval.
+  ///
+  /// All segments in the interval must have the same type; use
+  /// segmentCallTypeRuns() to iterate a whole set in type runs.
+  ///
+  RAJA_SUPPRESS_HD_WARN
+  template <typename BODY, typename... ARGS>
+  RAJA_HOST_DEVICE void segmentCallRun(size_t begin_seg,
+                                       size_t end_seg,
+                                       BODY &&body,
+                                       ARGS &&... args) const
+  {
+    if (getSegmentTypes()[begin_seg] != T0_TypeId) {
+      PARENT::segmentCallRun(begin_seg,
+                             end_seg,
+                             std::forward<BODY>(body),
+                             std::forward<ARGS>(args)...);
+      return;
+    }
+    for (size_t i = begin_seg; i < end_seg; ++i) {
+      Index_type offset = getSegmentOffsets()[i];
+      body(*data[offset], args...);
+    }
+  }
+
+  ///
+  /// Calls the operator "body" with every segment in the index set,
+  /// resolving the segment type once per run of consecutively stored
+  /// same-type segments rather than once per segment.
+  ///
+  /// After reorder(ORDER_BY_TYPE) the set holds at most one run per
+  /// segment type, so sets with many tiny segments pay for type
+  /// dispatch a handful of times instead of per segment. Segments are
+  /// visited in storage order; "args..." are passed-thru to the body
+  /// as arguments AFTER the segment.
+  ///
+  template <typename BODY, typename... ARGS>
+  RAJA_INLINE void segmentCallTypeRuns(BODY &&body, ARGS &&... args) const
+  {
+    size_t num_seg = getNumSegments();
+    const RAJA::RAJAVec<Index_type> &types = getSegmentTypes();
+    size_t begin = 0;
+    while (begin < num_seg) {
+      size_t end = begin + 1;
+      while (end < num_seg && types[end] == types[begin]) {
+        ++end;
+      }
+      segmentCallRun(begin, end, body, args...);
+      begin = end;
+    }
+  }
+
 protected:
   //! Internal logic to add a new segment -- catch invalid type insertion
   template <typename Tnew>
@@ -372,6 +465,9 @@ protected:
     data.push_back(val);
     owner.push_back(pcopy == PUSH_COPY);
 
+    // Any modification invalidates a cached reorder() result
+    setSegmentOrderCache(-1);
+
     // Determine if we push at the front or back of the segment list
     if (pend == PUSH_BACK) {
       // Store the segment type
@@ -384,6 +480,9 @@ protected:
       size_t icount = val->size();
       getSegmentIcounts().push_back(getTotalLength());
       increaseTotalLength(icount);
+
+      // Store the default segment execution tag
+      getSegmentExecTags().push_back(0);
     } else {
       // Store the segment type
       getSegmentTypes().push_front(T0_TypeId);
@@ -398,6 +497,9 @@ protected:
         getSegmentIcounts()[i] += icount;
       }
       increaseTotalLength(icount);
+
+      // Store the default segment execution tag
+      getSegmentExecTags().push_front(0);
     }
   }
 
@@ -413,6 +515,18 @@ protected:
     return PARENT::increaseTotalLength(n);
   }
 
+  //! Returns the cached segment ordering (-1 if none is in effect)
+  RAJA_INLINE Index_type getSegmentOrderCache() const
+  {
+    return PARENT::getSegmentOrderCache();
+  }
+
+  //! Record the segment ordering in effect (-1 invalidates the cache)
+  RAJA_INLINE void setSegmentOrderCache(Index_type order)
+  {
+    PARENT::setSegmentOrderCache(order);
+  }
+
 public:
   using iterator = Iterators::numeric_iterator<Index_type>;
 
@@ -488,6 +602,106 @@ public:
     return retVal;
   }
 
+  ///
+  /// Reorder segments so higher-cost segments are executed first.
+  ///
+  /// Segment order determines scheduling when segments become parallel
+  /// launches; running the largest segments first avoids a long tail of
+  /// stragglers behind a large segment scheduled late. Only the iteration
+  /// order over segments changes; the segment objects themselves are not
+  /// moved and segment ids are renumbered to match the new order.
+  ///
+  /// The result of a size-based reorder is cached and recomputed only
+  /// after the index set is modified.
+  ///
+  void reorder(SegmentOrder order = ORDER_DESCENDING_SIZE)
+  {
+    if (getSegmentOrderCache() == static_cast<Index_type>(order)) {
+      return;
+    }
+    if (order == ORDER_BY_TYPE) {
+      // Group same-type segments contiguously, in declaration order of
+      // the set's segment types; ties preserve the current relative
+      // order, so segments stay sorted within their type run
+      const RAJA::RAJAVec<Index_type> &types = getSegmentTypes();
+      reorder([&](size_t i, size_t) { return static_cast<double>(types[i]); });
+    } else {
+      bool descending = (order == ORDER_DESCENDING_SIZE);
+      reorder([=](size_t, size_t seg_size) {
+        return descending ? static_cast<double>(seg_size)
+                          : -static_cast<double>(seg_size);
+      });
+    }
+    setSegmentOrderCache(static_cast<Index_type>(order));
+  }
+
+  ///
+  /// Reorder segments by a user-provided cost model.
+  ///
+  /// The callback is invoked as cost(segment_index, segment_length) and
+  /// must return a value convertible to double. Segments are run in
+  /// descending cost order; ties preserve the current relative order.
+  ///
+  template <typename CostModel>
+  void reorder(CostModel cost)
+  {
+    size_t num_seg = getNumSegments();
+    if (num_seg < 2) {
+      return;
+    }
+
+    RAJA::RAJAVec<Index_type> &types = getSegmentTypes();
+    RAJA::RAJAVec<Index_type> &offsets = getSegmentOffsets();
+    RAJA::RAJAVec<Index_type> &icounts = getSegmentIcounts();
+    RAJA::RAJAVec<Index_type> &exec_tags = getSegmentExecTags();
+
+    // Segment lengths recovered from the cumulative icounts
+    std::vector<size_t> seg_size(num_seg);
+    for (size_t i = 0; i < num_seg; ++i) {
+      Index_type next =
+          (i + 1 < num_seg) ? icounts[i + 1] : getTotalLength();
+      seg_size[i] = static_cast<size_t>(next - icounts[i]);
+    }
+
+    std::vector<double> seg_cost(num_seg);
+    for (size_t i = 0; i < num_seg; ++i) {
+      seg_cost[i] = cost(i, seg_size[i]);
+    }
+
+    std::vector<size_t> perm(num_seg);
+    for (size_t i = 0; i < num_seg; ++i) {
+      perm[i] = i;
+    }
+    std::stable_sort(perm.begin(), perm.end(), [&](size_t a, size_t b) {
+      return seg_cost[a] > seg_cost[b];
+    });
+
+    RAJA::RAJAVec<Index_type> new_types(num_seg);
+    RAJA::RAJAVec<Index_type> new_offsets(num_seg);
+    RAJA::RAJAVec<Index_type> new_icounts(num_seg);
+    RAJA::RAJAVec<Index_type> new_exec_tags(num_seg);
+    new_types.resize(num_seg);
+    new_offsets.resize(num_seg);
+    new_icounts.resize(num_seg);
+    new_exec_tags.resize(num_seg);
+    Index_type icount = 0;
+    for (size_t i = 0; i < num_seg; ++i) {
+      new_types[i] = types[perm[i]];
+      new_offsets[i] = offsets[perm[i]];
+      new_icounts[i] = icount;
+      new_exec_tags[i] = exec_tags[perm[i]];
+      icount += static_cast<Index_type>(seg_size[perm[i]]);
+    }
+    using std::swap;
+    swap(types, new_types);
+    swap(offsets, new_offsets);
+    swap(icounts, new_icounts);
+    swap(exec_tags, new_exec_tags);
+
+    // A custom cost model has no cache key; recompute on the next reorder
+    setSegmentOrderCache(-1);
+  }
+
   //! Set [begin, end) interval of segments identified by interval_id
   void setSegmentInterval(size_t interval_id, int begin, int end)
   {
@@ -544,6 +758,18 @@ protected:
     return PARENT::getSegmentIcounts();
   }
 
+  //! Returns the mapping of  segment_index -> segment_exec_tag
+  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentExecTags()
+  {
+    return PARENT::getSegmentExecTags();
+  }
+
+  //! Returns the mapping of  segment_index -> segment_exec_tag
+  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentExecTags() const
+  {
+    return PARENT::getSegmentExecTags();
+  }
+
 public:
   ///
   /// Equality operator returns true if all segments are equal; else false.
@@ -595,7 +821,7 @@ public:
   using value_type = RAJA::Index_type;
 
   //! create empty TypedIndexSet
-  RAJA_INLINE TypedIndexSet() : m_len(0) {}
+  RAJA_INLINE TypedIndexSet() : m_len(0), m_order_cache(-1) {}
 
   //! dtor cleans up segements that we own (none)
   RAJA_INLINE
@@ -608,7 +834,10 @@ public:
     segment_types = c.segment_types;
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
+    segment_exec_tags = c.segment_exec_tags;
+    m_chunk_hints = c.m_chunk_hints;
     m_len = c.m_len;
+    m_order_cache = c.m_order_cache;
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -618,7 +847,10 @@ public:
     swap(segment_types, other.segment_types);
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
+    swap(segment_exec_tags, other.segment_exec_tags);
+    swap(m_chunk_hints, other.m_chunk_hints);
     swap(m_len, other.m_len);
+    swap(m_order_cache, other.m_order_cache);
   }
 
 protected:
@@ -640,6 +872,11 @@ protected:
   {
   }
 
+  template <typename BODY, typename... ARGS>
+  RAJA_INLINE void segmentCallRun(size_t, size_t, BODY, ARGS...) const
+  {
+  }
+
   RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentTypes()
   {
     return segment_types;
@@ -670,12 +907,31 @@ protected:
     return segment_icounts;
   }
 
+  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentExecTags()
+  {
+    return segment_exec_tags;
+  }
+
+  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentExecTags() const
+  {
+    return segment_exec_tags;
+  }
+
   RAJA_INLINE Index_type &getTotalLength() { return m_len; }
 
   RAJA_INLINE void setTotalLength(int n) { m_len = n; }
 
   RAJA_INLINE void increaseTotalLength(int n) { m_len += n; }
 
+  //! Returns the cached segment ordering (-1 if none is in effect)
+  RAJA_INLINE Index_type getSegmentOrderCache() const { return m_order_cache; }
+
+  //! Record the segment ordering in effect (-1 invalidates the cache)
+  RAJA_INLINE void setSegmentOrderCache(Index_type order)
+  {
+    m_order_cache = order;
+  }
+
   template <typename P0, typename... PREST>
   RAJA_INLINE bool compareSegmentById(size_t,
                                       const TypedIndexSet<P0, PREST...> &) const
@@ -732,6 +988,62 @@ public:
     return segment_icounts[segid];
   }
 
+  ///
+  /// Set the execution tag of the segment with the given id.
+  ///
+  /// The tag selects which policy of a TaggedExecPolicy runs the
+  /// segment, by position in the policy list. Tags default to 0 and are
+  /// not carried into slices created with createSlice().
+  ///
+  RAJA_INLINE void setSegmentExecTag(int segid, Index_type tag)
+  {
+    segment_exec_tags[segid] = tag;
+  }
+
+  //! Return the execution tag of the segment with the given id.
+  RAJA_INLINE Index_type getSegmentExecTag(int segid) const
+  {
+    return segment_exec_tags[segid];
+  }
+
+  ///
+  /// Record the preferred chunk length for the named kernel family.
+  ///
+  /// Chunk hints are per-index-set metadata consumed by the re-chunking
+  /// view (see forEachSegmentChunk() in IndexSetUtils.hpp), which
+  /// iterates the stored segments at the recorded granularity without
+  /// rebuilding the set. A calibration pass (see calibrateChunkHint())
+  /// measures a few candidate lengths and records the fastest here.
+  /// Hints are copied with the set but are not carried into slices
+  /// created with createSlice().
+  ///
+  RAJA_INLINE void setChunkHint(const std::string &family,
+                                Index_type chunk_len)
+  {
+    for (auto &hint : m_chunk_hints) {
+      if (hint.first == family) {
+        hint.second = chunk_len;
+        return;
+      }
+    }
+    m_chunk_hints.push_back(std::make_pair(family, chunk_len));
+  }
+
+  ///
+  /// Return the recorded chunk length for the named kernel family, or
+  /// fallback_len when the family has no recorded hint.
+  ///
+  RAJA_INLINE Index_type getChunkHint(const std::string &family,
+                                      Index_type fallback_len = 0) const
+  {
+    for (auto const &hint : m_chunk_hints) {
+      if (hint.first == family) {
+        return hint.second;
+      }
+    }
+    return fallback_len;
+  }
+
   //! Get an iterator to the end.
   iterator end() const { return iterator(getNumSegments()); }
 
@@ -752,8 +1064,17 @@ private:
   //! the icount of each segment
   RAJA::RAJAVec<Index_type> segment_icounts;
 
+  //! the execution tag of each segment (see TaggedExecPolicy)
+  RAJA::RAJAVec<Index_type> segment_exec_tags;
+
+  //! calibrated chunk lengths keyed by kernel family name
+  std::vector<std::pair<std::string, Index_type>> m_chunk_hints;
+
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! Cached segment ordering applied by reorder(); -1 when invalid
+  Index_type m_order_cache;
 };
 
 
@@ -767,7 +1088,11 @@ struct is_index_set
 
 template <typename T>
 struct is_indexset_policy
-    : ::RAJA::type_traits::SpecializationOf<RAJA::ExecPolicy, typename std::decay<T>::type> {
+    : concepts::any_of<
+          ::RAJA::type_traits::SpecializationOf<RAJA::ExecPolicy,
+                                                typename std::decay<T>::type>,
+          ::RAJA::type_traits::SpecializationOf<RAJA::TaggedExecPolicy,
+                                                typename std::decay<T>::type>> {
 };
 }  // namespace type_traits
 
@@ -24,10 +24,14 @@
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/util/BitMask.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "camp/resource.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace RAJA
 {
 
@@ -61,6 +65,189 @@ void buildIndexSetAligned(
     RAJA::Index_type range_min_length,
     RAJA::Index_type range_align);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Incremental variant of buildIndexSetAligned for index arrays
+ *        organized as a collection of contiguous "boxes" (e.g., AMR patches).
+ *
+ *        The builder keeps the segments generated for each box and, on
+ *        rebuild, re-scans only the boxes named in a dirty-box list; clean
+ *        boxes reuse their previously generated segments. The emitted index
+ *        set always covers all boxes in box order.
+ *
+ *        Boxes are offset/length slices of the index array passed to the
+ *        rebuild methods. If the box decomposition itself changes, call
+ *        setBoxes() again; this marks every box for regeneration.
+ *
+ ******************************************************************************
+ */
+class AlignedIndexSetBuilder
+{
+public:
+  /*!
+   *  \param work_res camp resource object that identifies the memory space
+   *         in which list segment index data will live (passed to list
+   *         segment ctor).
+   *  \param range_min_length min length of any range segment in index set
+   *  \param range_align "alignment" value for range segments in index set.
+   */
+  AlignedIndexSetBuilder(camp::resources::Resource work_res,
+                         RAJA::Index_type range_min_length,
+                         RAJA::Index_type range_align);
+
+  ///
+  /// Define boxes as offset/length slices of the index array. All boxes
+  /// are marked for regeneration on the next rebuild.
+  ///
+  void setBoxes(const RAJA::Index_type* box_offsets,
+                const RAJA::Index_type* box_lengths,
+                RAJA::Index_type num_boxes);
+
+  ///
+  /// Regenerate segments for every box and emit the full index set.
+  /// Method assumes index set is empty (no segments).
+  ///
+  void rebuild(RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+               const RAJA::Index_type* indices_in);
+
+  ///
+  /// Regenerate segments only for the boxes whose ids appear in the
+  /// dirty-box list and emit the full index set. Method assumes index set
+  /// is empty (no segments).
+  ///
+  void rebuild(RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+               const RAJA::Index_type* indices_in,
+               const RAJA::Index_type* dirty_boxes,
+               RAJA::Index_type num_dirty);
+
+private:
+  void rebuildBox(RAJA::Index_type box, const RAJA::Index_type* indices_in);
+  void emit(RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset);
+
+  camp::resources::Resource m_work_res;
+  RAJA::Index_type m_range_min_length;
+  RAJA::Index_type m_range_align;
+  std::vector<RAJA::Index_type> m_box_offsets;
+  std::vector<RAJA::Index_type> m_box_lengths;
+  std::vector<RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>>
+      m_parts;
+};
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Builds and caches an index set of range segments covering the
+ *        runs of set bits in an activity mask over a dense range.
+ *
+ *        Loops that iterate a dense bounding box and test a per-cell
+ *        active flag (e.g., AMR level loops) spend their inactive
+ *        iterations on nothing. This builder converts the activity bits
+ *        into contiguous range segments, one per run of set bits, so a
+ *        forall over the emitted index set touches only active cells
+ *        with range-segment efficiency.
+ *
+ *        The index set is cached: update() compares the mask words
+ *        against the words seen on the previous call and returns the
+ *        cached index set untouched when nothing changed. When words
+ *        did change, only the tiles of the mask containing changed
+ *        words are rescanned; runs are extracted with count-trailing-
+ *        zeros jumps between runs rather than a per-bit scan.
+ *
+ ******************************************************************************
+ */
+class ActivityMaskIndexSetBuilder
+{
+public:
+  /*!
+   *  \param begin first index of the dense range the mask covers
+   *  \param end one past the last index; bit i of the mask governs
+   *         index begin + i
+   */
+  ActivityMaskIndexSetBuilder(RAJA::Index_type begin, RAJA::Index_type end);
+
+  ///
+  /// Return the index set covering the runs of set bits in mask, whose
+  /// words must cover the range given at construction. Rescans only the
+  /// portions of the mask that changed since the previous call; if
+  /// nothing changed the cached index set is returned as-is.
+  ///
+  const RAJA::TypedIndexSet<RAJA::RangeSegment>& update(
+      const RAJA::BitSetView& mask);
+
+  ///
+  /// The most recently emitted index set, without examining the mask.
+  ///
+  const RAJA::TypedIndexSet<RAJA::RangeSegment>& indexSet() const
+  {
+    return m_iset;
+  }
+
+  ///
+  /// Number of active cells covered by the most recently emitted
+  /// index set.
+  ///
+  RAJA::Index_type numActive() const { return m_num_active; }
+
+private:
+  //! runs are cached per tile of this many mask words, bounding the
+  //  rescan granularity when a few words change
+  static const RAJA::Index_type s_words_per_tile = 16;
+
+  void rebuildTile(size_t tile, const RAJA::BitSetView& mask);
+  void emit();
+
+  RAJA::Index_type m_begin;
+  RAJA::Index_type m_len;
+  //! mask words as of the previous update, for change detection
+  std::vector<RAJA::BitSetWord> m_words;
+  //! per-tile run lists as [begin, end) index pairs; runs are not
+  //  merged across tile boundaries until emit
+  std::vector<std::vector<std::pair<RAJA::Index_type, RAJA::Index_type>>>
+      m_tile_runs;
+  RAJA::TypedIndexSet<RAJA::RangeSegment> m_iset;
+  RAJA::Index_type m_num_active = 0;
+  bool m_built = false;
+};
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set of contiguous range segments with
+ *        approximately equal summed cost from an array of per-iteration
+ *        cost weights.
+ *
+ *        Launch sizing assigns equal iteration counts to each block or
+ *        thread, which leaves a load-imbalance tail when per-iteration
+ *        cost varies widely (e.g., surface vs. volume zones). This builder
+ *        cuts [0, length) at cost prefix-sum boundaries instead, so each
+ *        emitted segment carries roughly total_cost / num_chunks work.
+ *        Pass the chunk count the execution will use, e.g. the grid size
+ *        an occupancy calculator chooses for a kernel launch, or the
+ *        thread count of an OpenMP region.
+ *
+ *        An iteration whose cost exceeds the per-chunk target absorbs the
+ *        quota of several chunks; fewer than num_chunks segments are
+ *        emitted in that case rather than empty ones. If all costs are
+ *        zero the builder falls back to an equal-count partition.
+ *
+ *  \param iset reference to index set generated with range segments.
+ *         Method assumes index set is empty (no segments).
+ *  \param costs pointer to start of input array of non-negative cost
+ *         weights, one per iteration.
+ *  \param length size of input cost array (iteration-space length).
+ *  \param num_chunks number of equal-cost pieces to cut the iteration
+ *         space into; values less than one are treated as one.
+ *
+ ******************************************************************************
+ */
+void buildCostBalancedIndexSet(
+    RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
+    const double* costs,
+    RAJA::Index_type length,
+    RAJA::Index_type num_chunks);
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
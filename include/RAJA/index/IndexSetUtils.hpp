@@ -21,10 +21,19 @@
 
 #include "RAJA/config.hpp"
 
+#include <string>
+#include <vector>
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
 #include "RAJA/pattern/forall.hpp"
 
 #include "RAJA/policy/sequential.hpp"
 
+#include "RAJA/util/Timer.hpp"
+
 namespace RAJA
 {
 
@@ -109,6 +118,161 @@ RAJA_INLINE void getIndicesConditional(CONTAINER_T& con,
   con = tcon;
 }
 
+namespace detail
+{
+
+/*!
+ * Functor applied per segment by forEachSegmentChunk(); slices the
+ * segment into sub-segments of at most chunk_len indices and invokes
+ * the body once per sub-segment.
+ */
+template <typename BODY>
+struct ChunkSegmentCall {
+  BODY& body;
+  Index_type chunk_len;
+
+  //! range segments re-slice in place; slice() clamps the final chunk
+  template <typename StorageT, typename DiffT>
+  void operator()(TypedRangeSegment<StorageT, DiffT> const& seg) const
+  {
+    DiffT len = seg.size();
+    for (DiffT b = 0; b < len; b += static_cast<DiffT>(chunk_len)) {
+      body(seg.slice(static_cast<StorageT>(b), static_cast<DiffT>(chunk_len)));
+    }
+  }
+
+  //! list segments yield unowned views over the stored indices
+  template <typename T>
+  void operator()(TypedListSegment<T> const& seg) const
+  {
+    camp::resources::Resource host_res{camp::resources::Host()};
+    Index_type len = static_cast<Index_type>(seg.size());
+    for (Index_type b = 0; b < len; b += chunk_len) {
+      Index_type l =
+          RAJA::operators::minimum<Index_type>{}(chunk_len, len - b);
+      body(TypedListSegment<T>(seg.begin() + b, l, host_res, Unowned));
+    }
+  }
+
+  //! segments without a natural sub-range run whole
+  template <typename SEG_T>
+  void operator()(SEG_T const& seg) const
+  {
+    body(seg);
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Re-chunking view over an index set: calls body once per chunk
+ *         of at most chunk_len indices, iterating the stored segments
+ *         at that granularity without rebuilding the set.
+ *
+ *         Range segments are re-sliced in place and list segments yield
+ *         unowned views over the stored indices, so iterating at a new
+ *         granularity costs no allocation or index copying. A
+ *         non-positive chunk_len runs each segment whole.
+ *
+ ******************************************************************************
+ */
+template <typename BODY, typename... SEG_TYPES>
+RAJA_INLINE void forEachSegmentChunk(const TypedIndexSet<SEG_TYPES...>& iset,
+                                     Index_type chunk_len,
+                                     BODY&& body)
+{
+  size_t num_seg = iset.getNumSegments();
+  if (chunk_len <= 0) {
+    for (size_t i = 0; i < num_seg; ++i) {
+      iset.segmentCall(i, body);
+    }
+    return;
+  }
+  detail::ChunkSegmentCall<camp::decay<BODY>> chunker{body, chunk_len};
+  for (size_t i = 0; i < num_seg; ++i) {
+    iset.segmentCall(i, chunker);
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Re-chunking view at the calibrated granularity recorded for
+ *         the named kernel family (see TypedIndexSet::setChunkHint()).
+ *         Families without a recorded hint run each segment whole.
+ *
+ ******************************************************************************
+ */
+template <typename BODY, typename... SEG_TYPES>
+RAJA_INLINE void forEachSegmentChunk(const TypedIndexSet<SEG_TYPES...>& iset,
+                                     const std::string& family,
+                                     BODY&& body)
+{
+  forEachSegmentChunk(iset, iset.getChunkHint(family),
+                      std::forward<BODY>(body));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Calibrate the preferred chunk length for a kernel family.
+ *
+ *         Runs the body over the index set through forEachSegmentChunk()
+ *         once per candidate length, timing each pass, and records the
+ *         fastest candidate in the set's chunk-hint metadata under the
+ *         family name; returns the winning length. The body executes
+ *         once per candidate, so it must tolerate re-execution.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   std::vector<RAJA::Index_type> lens{256, 1024, 4096, 16384};
+
+   RAJA::calibrateChunkHint(iset, "stress_kernel", lens,
+                            [&](const auto& chunk) {
+     RAJA::forall<exec_policy>(chunk, stress_body);
+   });
+
+   // later launches iterate at the calibrated granularity
+   RAJA::forEachSegmentChunk(iset, "stress_kernel",
+                             [&](const auto& chunk) {
+     RAJA::forall<exec_policy>(chunk, stress_body);
+   });
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename BODY, typename... SEG_TYPES>
+RAJA_INLINE Index_type calibrateChunkHint(
+    TypedIndexSet<SEG_TYPES...>& iset,
+    const std::string& family,
+    const std::vector<Index_type>& candidate_lens,
+    BODY&& body)
+{
+  Index_type best_len = 0;
+  double best_time = 0.0;
+  bool first = true;
+  for (Index_type chunk_len : candidate_lens) {
+    Timer timer;
+    timer.start();
+    forEachSegmentChunk(iset, chunk_len, body);
+    timer.stop();
+    if (first || timer.elapsed() < best_time) {
+      best_len = chunk_len;
+      best_time = timer.elapsed();
+      first = false;
+    }
+  }
+  if (!first) {
+    iset.setChunkHint(family, best_len);
+  }
+  return best_len;
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -26,6 +26,7 @@
 
 #include "camp/resource.hpp"
 
+#include "RAJA/util/Allocators.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/Span.hpp"
@@ -90,6 +91,11 @@ class TypedListSegment
 
   //! specialization for deallocation of GPU_memory
   void deallocate(GPU_memory) {
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::managed)) {
+      RAJA::util::callback_deallocate(RAJA::util::AllocatorSpace::managed,
+                                      m_data);
+      return;
+    }
 #if defined(RAJA_ENABLE_CUDA)
     cudaErrchk(cudaFree(m_data));
 #elif defined(RAJA_ENABLE_HIP)
@@ -100,6 +106,11 @@ class TypedListSegment
   //! specialization for allocation of GPU_memory
   void allocate(GPU_memory)
   {
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::managed)) {
+      m_data = static_cast<T*>(RAJA::util::callback_allocate(
+          RAJA::util::AllocatorSpace::managed, m_size * sizeof(value_type)));
+      return;
+    }
 #if defined(RAJA_ENABLE_CUDA)
     cudaErrchk(cudaMallocManaged((void**)&m_data,
                                  m_size * sizeof(value_type),
@@ -112,10 +123,28 @@ class TypedListSegment
   }
 
   //! specialization for deallocation of CPU_memory
-  void deallocate(CPU_memory) { delete[] m_data; }
+  void deallocate(CPU_memory)
+  {
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::host)) {
+      RAJA::util::callback_deallocate(RAJA::util::AllocatorSpace::host,
+                                      m_data);
+      return;
+    }
+    delete[] m_data;
+  }
 
   //! specialization for allocation of CPU_memory
-  void allocate(CPU_memory) { m_data = new T[m_size]; }
+  //  index types are trivially constructible, so raw memory from a
+  //  registered host allocator can stand in for new[]
+  void allocate(CPU_memory)
+  {
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::host)) {
+      m_data = static_cast<T*>(RAJA::util::callback_allocate(
+          RAJA::util::AllocatorSpace::host, m_size * sizeof(value_type)));
+      return;
+    }
+    m_data = new T[m_size];
+  }
 
 #if defined(RAJA_CUDA_ACTIVE)
   //! copy data from container using BlockCopy
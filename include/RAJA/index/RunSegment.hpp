@@ -0,0 +1,193 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing definition of RAJA run-length-encoded
+ *          segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_RunSegment_HPP
+#define RAJA_RunSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/ListSegment.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing an arbitrary collection of indices stored as
+ *         runs of contiguous values.
+ *
+ *         Index arrays produced by mesh partitioners are typically mostly
+ *         contiguous; storing every index explicitly, as TypedListSegment
+ *         does, spends index-array bandwidth in every gather loop. A run
+ *         segment compresses consecutive indices into (begin, length)
+ *         runs, preserving the original iteration order exactly: isolated
+ *         indices become runs of length one. Traversal walks each run as a
+ *         contiguous range, so loop bodies see unit-stride accesses the
+ *         compiler can vectorize.
+ *
+ *         Run storage reuses TypedListSegment, so run data is managed the
+ *         same way as list segment index data (including device-accessible
+ *         memory when a GPU back-end is enabled).
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class TypedRunSegment
+{
+public:
+  //! value type for indices
+  using value_type = T;
+
+  //! expose underlying index type
+  using IndexType = RAJA::Index_type;
+
+  //! one run of contiguous indices: [begin, begin + length)
+  struct Run {
+    value_type begin;
+    value_type length;
+  };
+
+  //! prevent compiler from providing a default constructor
+  TypedRunSegment() = delete;
+
+  ///
+  /// \brief Construct run segment by run-length encoding the given index
+  ///        array, using the given camp resource to allocate run data.
+  ///
+  /// The encoding preserves iteration order: traversing the runs in order
+  /// visits exactly the indices of the array in their original order.
+  ///
+  TypedRunSegment(const value_type* values,
+                  Index_type length,
+                  camp::resources::Resource& resource)
+      : m_runs(encode(values, length), resource), m_size(length)
+  {
+  }
+
+  ///
+  /// \brief Construct run segment by run-length encoding the given index
+  ///        array.
+  ///
+  RAJA_DEPRECATE("In next RAJA release, TypedRunSegment ctor will require a camp Resource object")
+  TypedRunSegment(const value_type* values, Index_type length)
+      : m_runs(encode(values, length)), m_size(length)
+  {
+  }
+
+  //! Copy-constructor for run segment.
+  TypedRunSegment(const TypedRunSegment& other) = default;
+
+  //! Copy-assignment for run segment.
+  TypedRunSegment& operator=(const TypedRunSegment& other) = default;
+
+  //! Destroy segment including its contents
+  ~TypedRunSegment() = default;
+
+  ///
+  /// Get length of run segment, i.e., number of indices (not runs).
+  ///
+  Index_type getLength() const { return m_size; }
+
+  ///
+  /// Get number of runs in the segment.
+  ///
+  Index_type getNumRuns() const { return m_runs.size(); }
+
+  ///
+  /// Access the underlying list segment of runs.
+  ///
+  const TypedListSegment<Run>& getRuns() const { return m_runs; }
+
+  ///
+  /// Equality operator returns true if segments encode the same indices.
+  ///
+  bool operator==(const TypedRunSegment& other) const
+  {
+    if (m_size != other.m_size) return false;
+    if (m_runs.size() != other.m_runs.size()) return false;
+    for (Index_type i = 0; i < m_runs.size(); ++i) {
+      if (m_runs.begin()[i].begin != other.m_runs.begin()[i].begin ||
+          m_runs.begin()[i].length != other.m_runs.begin()[i].length) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  ///
+  /// Inequality operator returns true if any segment index is not the same.
+  ///
+  bool operator!=(const TypedRunSegment& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  //
+  // Run-length encode an index array, preserving iteration order.
+  //
+  static std::vector<Run> encode(const value_type* values, Index_type length)
+  {
+    std::vector<Run> runs;
+    Index_type i = 0;
+    while (i < length) {
+      Index_type run_start = i;
+      while (i + 1 < length && values[i + 1] == values[i] + 1) {
+        ++i;
+      }
+      ++i;
+      runs.push_back(Run{values[run_start],
+                         static_cast<value_type>(i - run_start)});
+    }
+    return runs;
+  }
+
+  //! runs of contiguous indices, in original iteration order
+  TypedListSegment<Run> m_runs;
+
+  //! total number of indices encoded
+  Index_type m_size;
+};
+
+//! Alias for run segment with default index type
+using RunSegment = TypedRunSegment<Index_type>;
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_run_segment : std::false_type {
+};
+
+template <typename T>
+struct is_run_segment<TypedRunSegment<T>> : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,432 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing lazy set-algebra combinators over
+ *          RAJA segment types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SegmentAlgebra_HPP
+#define RAJA_SegmentAlgebra_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Segment holding the concatenation of two disjoint, ascending
+ *         index ranges.
+ *
+ *         This is the result type of the range-only segment_union and
+ *         segment_difference combinators: both produce at most two
+ *         disjoint ranges, and representing them directly keeps the
+ *         combinators O(1) in time and memory -- no index list is ever
+ *         materialized. The iterator is random access so forall can
+ *         traverse the segment with any back-end, exactly like a
+ *         TypedRangeSegment.
+ *
+ ******************************************************************************
+ */
+template <typename StorageT,
+          typename DiffT = make_signed_t<strip_index_type_t<StorageT>>>
+struct TypedSplitRangeSegment {
+
+  using StripStorageT = strip_index_type_t<StorageT>;
+
+  //! iterator over the concatenated ranges, mapping a logical position
+  //  to the first or second range
+  class iterator
+  {
+  public:
+    using value_type = StorageT;
+    using difference_type = DiffT;
+    using pointer = value_type*;
+    using reference = value_type&;
+    using iterator_category = std::random_access_iterator_tag;
+
+    RAJA_HOST_DEVICE constexpr iterator(StripStorageT first_begin,
+                                        DiffT first_size,
+                                        StripStorageT second_begin,
+                                        DiffT pos)
+        : m_first_begin(first_begin),
+          m_first_size(first_size),
+          m_second_begin(second_begin),
+          m_pos(pos)
+    {
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE value_type operator*() const
+    {
+      return (m_pos < m_first_size)
+                 ? value_type(m_first_begin + m_pos)
+                 : value_type(m_second_begin + (m_pos - m_first_size));
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE value_type operator[](DiffT n) const
+    {
+      return *(*this + n);
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator& operator+=(DiffT n)
+    {
+      m_pos += n;
+      return *this;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator& operator-=(DiffT n)
+    {
+      m_pos -= n;
+      return *this;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator operator+(DiffT n) const
+    {
+      iterator tmp(*this);
+      tmp.m_pos += n;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator operator-(DiffT n) const
+    {
+      iterator tmp(*this);
+      tmp.m_pos -= n;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE DiffT operator-(iterator const& o) const
+    {
+      return m_pos - o.m_pos;
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator==(iterator const& o) const
+    {
+      return m_pos == o.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator!=(iterator const& o) const
+    {
+      return m_pos != o.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator<(iterator const& o) const
+    {
+      return m_pos < o.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator<=(iterator const& o) const
+    {
+      return m_pos <= o.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator>(iterator const& o) const
+    {
+      return m_pos > o.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator>=(iterator const& o) const
+    {
+      return m_pos >= o.m_pos;
+    }
+
+  private:
+    StripStorageT m_first_begin;
+    DiffT m_first_size;
+    StripStorageT m_second_begin;
+    DiffT m_pos;
+  };
+
+  using value_type = StorageT;
+  using IndexType = DiffT;
+
+  //! construct from the bounds of two disjoint half-open ranges;
+  //  either or both may be empty
+  RAJA_HOST_DEVICE constexpr TypedSplitRangeSegment(StripStorageT first_begin,
+                                                    StripStorageT first_end,
+                                                    StripStorageT second_begin,
+                                                    StripStorageT second_end)
+      : m_first_begin(first_begin),
+        m_first_size(first_end > first_begin ? DiffT(first_end - first_begin)
+                                             : DiffT(0)),
+        m_second_begin(second_begin),
+        m_second_size(second_end > second_begin
+                          ? DiffT(second_end - second_begin)
+                          : DiffT(0))
+  {
+  }
+
+  //! obtain an iterator to the beginning of the concatenation
+  RAJA_HOST_DEVICE RAJA_INLINE iterator begin() const
+  {
+    return iterator(m_first_begin, m_first_size, m_second_begin, DiffT(0));
+  }
+
+  //! obtain an iterator past the end of the concatenation
+  RAJA_HOST_DEVICE RAJA_INLINE iterator end() const
+  {
+    return iterator(m_first_begin,
+                    m_first_size,
+                    m_second_begin,
+                    m_first_size + m_second_size);
+  }
+
+  //! obtain the total number of indices in both ranges
+  RAJA_HOST_DEVICE RAJA_INLINE DiffT size() const
+  {
+    return m_first_size + m_second_size;
+  }
+
+private:
+  StripStorageT m_first_begin;
+  DiffT m_first_size;
+  StripStorageT m_second_begin;
+  DiffT m_second_size;
+};
+
+
+//! set operations applied by TypedLazySetSegment
+enum struct SegmentSetOp : int {
+  set_union,
+  set_difference,
+  set_intersection
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Segment applying a set operation to two operand segments,
+ *         materializing the result as a TypedListSegment on first
+ *         traversal and caching it.
+ *
+ *         This is the result type of the set-algebra combinators when
+ *         at least one operand is not a plain range. Operand values
+ *         are gathered, sorted and deduplicated when the result is
+ *         first needed, so constructing the combinator costs nothing;
+ *         repeat traversals reuse the cached list, and copies taken
+ *         after materialization share it. Resulting indices are always
+ *         in ascending order.
+ *
+ ******************************************************************************
+ */
+template <typename SEG_A, typename SEG_B>
+class TypedLazySetSegment
+{
+public:
+  using value_type = typename SEG_A::value_type;
+  static_assert(
+      std::is_same<value_type, typename SEG_B::value_type>::value,
+      "TypedLazySetSegment operands must have the same value_type");
+
+  using list_segment = TypedListSegment<value_type>;
+  using iterator = typename list_segment::iterator;
+  using IndexType = Index_type;
+
+  TypedLazySetSegment(SegmentSetOp op, SEG_A seg_a, SEG_B seg_b)
+      : m_op(op), m_seg_a(std::move(seg_a)), m_seg_b(std::move(seg_b))
+  {
+  }
+
+  //! obtain an iterator to the beginning of the materialized result
+  iterator begin() const { return list().begin(); }
+
+  //! obtain an iterator past the end of the materialized result
+  iterator end() const { return list().end(); }
+
+  //! obtain the number of indices in the result
+  Index_type size() const { return list().size(); }
+
+private:
+  //! build the list segment on first use; copies share the cache
+  list_segment& list() const
+  {
+    if (!m_list) {
+      std::vector<value_type> values_a(m_seg_a.begin(), m_seg_a.end());
+      std::vector<value_type> values_b(m_seg_b.begin(), m_seg_b.end());
+
+      std::sort(values_a.begin(), values_a.end());
+      values_a.erase(std::unique(values_a.begin(), values_a.end()),
+                     values_a.end());
+      std::sort(values_b.begin(), values_b.end());
+      values_b.erase(std::unique(values_b.begin(), values_b.end()),
+                     values_b.end());
+
+      std::vector<value_type> result;
+      switch (m_op) {
+        case SegmentSetOp::set_union:
+          std::set_union(values_a.begin(), values_a.end(),
+                         values_b.begin(), values_b.end(),
+                         std::back_inserter(result));
+          break;
+        case SegmentSetOp::set_difference:
+          std::set_difference(values_a.begin(), values_a.end(),
+                              values_b.begin(), values_b.end(),
+                              std::back_inserter(result));
+          break;
+        case SegmentSetOp::set_intersection:
+          std::set_intersection(values_a.begin(), values_a.end(),
+                                values_b.begin(), values_b.end(),
+                                std::back_inserter(result));
+          break;
+      }
+
+      m_list = std::make_shared<list_segment>(result);
+    }
+    return *m_list;
+  }
+
+  SegmentSetOp m_op;
+  SEG_A m_seg_a;
+  SEG_B m_seg_b;
+  mutable std::shared_ptr<list_segment> m_list;
+};
+
+
+///
+/// Set-algebra combinators. The range-only overloads are fully lazy:
+/// they compute new range bounds in O(1) and never materialize an
+/// index list. The generic overloads return a TypedLazySetSegment that
+/// materializes once on first traversal.
+///
+
+//! intersection of two ranges: the (possibly empty) overlapping range
+template <typename StorageT, typename DiffT>
+RAJA_HOST_DEVICE RAJA_INLINE TypedRangeSegment<StorageT, DiffT>
+segment_intersection(TypedRangeSegment<StorageT, DiffT> const& seg_a,
+                     TypedRangeSegment<StorageT, DiffT> const& seg_b)
+{
+  auto a_begin = stripIndexType(*seg_a.begin());
+  auto a_end = a_begin + seg_a.size();
+  auto b_begin = stripIndexType(*seg_b.begin());
+  auto b_end = b_begin + seg_b.size();
+
+  auto begin = (a_begin > b_begin) ? a_begin : b_begin;
+  auto end = (a_end < b_end) ? a_end : b_end;
+  return TypedRangeSegment<StorageT, DiffT>(begin, (end > begin) ? end : begin);
+}
+
+//! difference of two ranges: the parts of seg_a below and above seg_b
+template <typename StorageT, typename DiffT>
+RAJA_HOST_DEVICE RAJA_INLINE TypedSplitRangeSegment<StorageT, DiffT>
+segment_difference(TypedRangeSegment<StorageT, DiffT> const& seg_a,
+                   TypedRangeSegment<StorageT, DiffT> const& seg_b)
+{
+  auto a_begin = stripIndexType(*seg_a.begin());
+  auto a_end = a_begin + seg_a.size();
+  auto b_begin = stripIndexType(*seg_b.begin());
+  auto b_end = b_begin + seg_b.size();
+
+  auto below_end = (b_begin < a_end) ? b_begin : a_end;
+  auto above_begin = (b_end > a_begin) ? b_end : a_begin;
+  return TypedSplitRangeSegment<StorageT, DiffT>(a_begin,
+                                                 below_end,
+                                                 above_begin,
+                                                 a_end);
+}
+
+//! union of two ranges: seg_a followed by the parts of seg_b outside
+//  it, so overlapping or adjacent operands collapse to one range
+template <typename StorageT, typename DiffT>
+RAJA_HOST_DEVICE RAJA_INLINE TypedSplitRangeSegment<StorageT, DiffT>
+segment_union(TypedRangeSegment<StorageT, DiffT> const& seg_a,
+              TypedRangeSegment<StorageT, DiffT> const& seg_b)
+{
+  auto a_begin = stripIndexType(*seg_a.begin());
+  auto a_end = a_begin + seg_a.size();
+  auto b_begin = stripIndexType(*seg_b.begin());
+  auto b_end = b_begin + seg_b.size();
+
+  if (seg_a.size() == 0) {
+    return TypedSplitRangeSegment<StorageT, DiffT>(b_begin, b_end,
+                                                   b_end, b_end);
+  }
+
+  if (b_begin <= a_end && b_end >= a_begin) {
+    // overlapping or adjacent: one merged range
+    auto begin = (a_begin < b_begin) ? a_begin : b_begin;
+    auto end = (a_end > b_end) ? a_end : b_end;
+    return TypedSplitRangeSegment<StorageT, DiffT>(begin, end, end, end);
+  }
+
+  // disjoint: emit in ascending order
+  if (a_begin < b_begin) {
+    return TypedSplitRangeSegment<StorageT, DiffT>(a_begin, a_end,
+                                                   b_begin, b_end);
+  }
+  return TypedSplitRangeSegment<StorageT, DiffT>(b_begin, b_end,
+                                                 a_begin, a_end);
+}
+
+//! intersection of arbitrary segments; materializes once when first
+//  traversed
+template <typename SEG_A, typename SEG_B>
+RAJA_INLINE TypedLazySetSegment<SEG_A, SEG_B> segment_intersection(
+    SEG_A const& seg_a,
+    SEG_B const& seg_b)
+{
+  return TypedLazySetSegment<SEG_A, SEG_B>(SegmentSetOp::set_intersection,
+                                           seg_a, seg_b);
+}
+
+//! difference of arbitrary segments; materializes once when first
+//  traversed
+template <typename SEG_A, typename SEG_B>
+RAJA_INLINE TypedLazySetSegment<SEG_A, SEG_B> segment_difference(
+    SEG_A const& seg_a,
+    SEG_B const& seg_b)
+{
+  return TypedLazySetSegment<SEG_A, SEG_B>(SegmentSetOp::set_difference,
+                                           seg_a, seg_b);
+}
+
+//! union of arbitrary segments; materializes once when first traversed
+template <typename SEG_A, typename SEG_B>
+RAJA_INLINE TypedLazySetSegment<SEG_A, SEG_B> segment_union(
+    SEG_A const& seg_a,
+    SEG_B const& seg_b)
+{
+  return TypedLazySetSegment<SEG_A, SEG_B>(SegmentSetOp::set_union,
+                                           seg_a, seg_b);
+}
+
+//! alias for SplitRangeSegment with Index_type indices
+using SplitRangeSegment = TypedSplitRangeSegment<Index_type>;
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,241 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining a spatially keyed index set class whose
+ *          segments can be traversed in space-filling-curve order.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SpatialIndexSet_HPP
+#define RAJA_SpatialIndexSet_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "RAJA/index/IndexSet.hpp"
+
+namespace RAJA
+{
+
+//! Traversal orders for TypedSpatialIndexSet
+enum struct SpatialOrder : int {
+  insertion,  //!< segment insertion order, as a flat TypedIndexSet
+  morton,     //!< Morton (Z-order) curve over the segment keys
+  hilbert     //!< Hilbert curve over the segment keys
+};
+
+namespace detail
+{
+
+//! spread the low 21 bits of v so consecutive bits land 3 apart
+RAJA_INLINE uint64_t spread_bits_3(uint64_t v)
+{
+  v &= 0x1fffffull;
+  v = (v | v << 32) & 0x001f00000000ffffull;
+  v = (v | v << 16) & 0x001f0000ff0000ffull;
+  v = (v | v << 8) & 0x100f00f00f00f00full;
+  v = (v | v << 4) & 0x10c30c30c30c30c3ull;
+  v = (v | v << 2) & 0x1249249249249249ull;
+  return v;
+}
+
+//! Morton code of a 3d cell on a 2^21 grid per axis
+RAJA_INLINE uint64_t morton_code_3d(unsigned x, unsigned y, unsigned z)
+{
+  return spread_bits_3(x) | (spread_bits_3(y) << 1) | (spread_bits_3(z) << 2);
+}
+
+//! Hilbert code of a 3d cell on a 2^21 grid per axis, via Skilling's
+//  transpose algorithm: the coordinates are transformed in place to the
+//  Hilbert "transpose" representation, whose interleaved bits are the
+//  position along the curve.
+RAJA_INLINE uint64_t hilbert_code_3d(unsigned x, unsigned y, unsigned z)
+{
+  constexpr int bits = 21;
+  unsigned X[3] = {x & 0x1fffffu, y & 0x1fffffu, z & 0x1fffffu};
+  unsigned M = 1u << (bits - 1), P, Q, t;
+
+  // inverse undo excess work
+  for (Q = M; Q > 1; Q >>= 1) {
+    P = Q - 1;
+    for (int i = 0; i < 3; ++i) {
+      if (X[i] & Q) {
+        X[0] ^= P;
+      } else {
+        t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < 3; ++i) {
+    X[i] ^= X[i - 1];
+  }
+  t = 0;
+  for (Q = M; Q > 1; Q >>= 1) {
+    if (X[2] & Q) {
+      t ^= Q - 1;
+    }
+  }
+  for (int i = 0; i < 3; ++i) {
+    X[i] ^= t;
+  }
+
+  // interleave the transpose bits into the curve position
+  uint64_t code = 0;
+  for (int b = bits - 1; b >= 0; --b) {
+    for (int i = 0; i < 3; ++i) {
+      code = (code << 1) | ((X[i] >> b) & 1u);
+    }
+  }
+  return code;
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing an index set whose segments carry spatial
+ *         keys and can be traversed in space-filling-curve order.
+ *
+ *         Each segment is pushed with the integer coordinates of the
+ *         spatial block it indexes (e.g. the octree cell an AMR block
+ *         or mesh partition occupies). getTraversal() returns a
+ *         TypedIndexSet holding the same segments permuted into the
+ *         selected SpatialOrder; both curves visit children of an
+ *         octree cell contiguously, so neighbor-access loops see the
+ *         hierarchy's locality without any change to loop bodies. The
+ *         ordered set is computed once and cached, and only rebuilt
+ *         after segments are added or the order is changed.
+ *
+ *         The cached traversal references segments owned by this set,
+ *         so the set must outlive foralls over its traversal. Copying
+ *         is disabled for the same reason.
+ *
+ ******************************************************************************
+ */
+template <typename... SegTypes>
+class TypedSpatialIndexSet
+{
+public:
+  using IndexSetType = TypedIndexSet<SegTypes...>;
+
+  //! integer coordinates of a segment's block on the spatial grid,
+  //  at most 21 bits per axis; unused axes stay zero
+  struct SpatialKey {
+    unsigned x = 0;
+    unsigned y = 0;
+    unsigned z = 0;
+  };
+
+  TypedSpatialIndexSet() = default;
+
+  //! prohibit copies; the cached traversal aliases owned segments
+  TypedSpatialIndexSet(TypedSpatialIndexSet const&) = delete;
+  TypedSpatialIndexSet& operator=(TypedSpatialIndexSet const&) = delete;
+
+  //! Add copy of segment with its spatial key.
+  template <typename SegType>
+  RAJA_INLINE void push_back(SegType const& seg, SpatialKey key)
+  {
+    m_segments.push_back(seg);
+    m_keys.push_back(key);
+    m_cache_valid = false;
+  }
+
+  //! Select the traversal order returned by getTraversal().
+  RAJA_INLINE void setTraversalOrder(SpatialOrder order)
+  {
+    if (order != m_order) {
+      m_order = order;
+      m_cache_valid = false;
+    }
+  }
+
+  RAJA_INLINE SpatialOrder getTraversalOrder() const { return m_order; }
+
+  RAJA_INLINE size_t getNumSegments() const
+  {
+    return m_segments.getNumSegments();
+  }
+
+  //! Index set holding the segments in the selected traversal order;
+  //  computed on first use and cached until the set changes.
+  RAJA_INLINE IndexSetType const& getTraversal() const
+  {
+    if (!m_cache_valid) {
+      buildTraversal();
+      m_cache_valid = true;
+    }
+    return m_traversal;
+  }
+
+private:
+  RAJA_INLINE uint64_t keyCode(SpatialKey key) const
+  {
+    switch (m_order) {
+      case SpatialOrder::morton:
+        return detail::morton_code_3d(key.x, key.y, key.z);
+      case SpatialOrder::hilbert:
+        return detail::hilbert_code_3d(key.x, key.y, key.z);
+      default:
+        return 0;
+    }
+  }
+
+  void buildTraversal() const
+  {
+    size_t num = m_segments.getNumSegments();
+
+    std::vector<size_t> perm(num);
+    for (size_t i = 0; i < num; ++i) {
+      perm[i] = i;
+    }
+
+    if (m_order != SpatialOrder::insertion) {
+      std::vector<uint64_t> codes(num);
+      for (size_t i = 0; i < num; ++i) {
+        codes[i] = keyCode(m_keys[i]);
+      }
+      std::stable_sort(perm.begin(), perm.end(), [&](size_t a, size_t b) {
+        return codes[a] < codes[b];
+      });
+    }
+
+    m_traversal = IndexSetType();
+    for (size_t i = 0; i < num; ++i) {
+      m_segments.segment_push_into(perm[i], m_traversal, PUSH_BACK,
+                                   PUSH_NOCOPY);
+    }
+  }
+
+  //! segments in insertion order; owns the segment copies
+  mutable IndexSetType m_segments;
+  std::vector<SpatialKey> m_keys;
+
+  SpatialOrder m_order = SpatialOrder::morton;
+
+  //! cached reorder of m_segments in the selected traversal order
+  mutable IndexSetType m_traversal;
+  mutable bool m_cache_valid = false;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
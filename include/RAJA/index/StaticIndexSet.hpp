@@ -0,0 +1,276 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining a fixed-capacity index set with inline
+ *          segment storage and compile-time-unrolled iteration.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_StaticIndexSet_HPP
+#define RAJA_StaticIndexSet_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/internal/get_platform.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/camp_aliases.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/plugins.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/// Apply a functor to a type-erased segment slot with its true type
+/// restored, by matching the slot's type tag against the candidate pack.
+/// The recursion depth is the number of segment types, typically one or
+/// two, so the chain folds to a couple of compares.
+template <typename... SegTypes>
+struct static_segment_visitor;
+
+template <>
+struct static_segment_visitor<> {
+  template <typename Func>
+  static void visit(int, void const*, Func&&)
+  {
+  }
+};
+
+template <typename T0, typename... TRest>
+struct static_segment_visitor<T0, TRest...> {
+  static constexpr int type_id = static_cast<int>(sizeof...(TRest));
+
+  template <typename Func>
+  static void visit(int tag, void const* storage, Func&& func)
+  {
+    if (tag == type_id) {
+      func(*static_cast<T0 const*>(storage));
+    } else {
+      static_segment_visitor<TRest...>::visit(tag,
+                                              storage,
+                                              std::forward<Func>(func));
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Fixed-capacity index set holding at most N segments inline.
+ *
+ * TypedIndexSet heap-allocates each pushed segment and walks its
+ * segments through runtime-sized vectors; that fixed overhead dominates
+ * when a set holds a handful of segments of a few hundred elements
+ * each, as in the 27-segment one-per-neighbor-direction sets common in
+ * halo and stencil code. StaticIndexSet stores its segments inline (no
+ * allocation, one cache footprint) and forall over it unrolls the
+ * segment walk at compile time, so the whole dispatch inlines into the
+ * call site.
+ *
+ * Segments are copied in by push_back; there is no non-owning push, as
+ * the point of the container is that the segments live inside it.
+ * Exceeding the capacity aborts, matching the index set usage errors
+ * elsewhere.
+ *
+ * \tparam N segment capacity
+ * \tparam SegTypes segment types the set may hold
+ *
+ ******************************************************************************
+ */
+template <size_t N, typename... SegTypes>
+class StaticIndexSet
+{
+  static_assert(N > 0, "StaticIndexSet requires nonzero capacity");
+  static_assert(sizeof...(SegTypes) > 0,
+                "StaticIndexSet requires at least one segment type");
+
+  using storage_type =
+      typename std::aligned_union<0, SegTypes...>::type;
+  using visitor = detail::static_segment_visitor<SegTypes...>;
+
+public:
+  StaticIndexSet() = default;
+
+  StaticIndexSet(StaticIndexSet const& other)
+  {
+    for (size_t slot = 0; slot < other.m_size; ++slot) {
+      other.segmentCall(slot, [&](auto const& seg) { this->push_back(seg); });
+    }
+  }
+
+  StaticIndexSet& operator=(StaticIndexSet const& other)
+  {
+    if (this != &other) {
+      clear();
+      for (size_t slot = 0; slot < other.m_size; ++slot) {
+        other.segmentCall(slot, [&](auto const& seg) { this->push_back(seg); });
+      }
+    }
+    return *this;
+  }
+
+  ~StaticIndexSet() { clear(); }
+
+  //! Append a copy of a segment; aborts if the capacity is exhausted.
+  template <typename Tseg>
+  RAJA_INLINE void push_back(Tseg const& segment)
+  {
+    constexpr int tag = type_id_of<Tseg>();
+    static_assert(tag >= 0,
+                  "segment type is not among this StaticIndexSet's types");
+    if (m_size >= N) {
+      RAJA_ABORT_OR_THROW("StaticIndexSet capacity exceeded\n");
+    }
+    new (&m_storage[m_size]) Tseg(segment);
+    m_types[m_size] = tag;
+    ++m_size;
+  }
+
+  //! Number of segments currently held.
+  RAJA_INLINE constexpr size_t getNumSegments() const { return m_size; }
+
+  //! Sum of the lengths of all held segments.
+  RAJA_INLINE Index_type getLength() const
+  {
+    Index_type total = 0;
+    for (size_t slot = 0; slot < m_size; ++slot) {
+      segmentCall(slot, [&](auto const& seg) {
+        total += static_cast<Index_type>(seg.size());
+      });
+    }
+    return total;
+  }
+
+  //! Destroy all held segments, leaving the set empty.
+  RAJA_INLINE void clear()
+  {
+    for (size_t slot = 0; slot < m_size; ++slot) {
+      segmentCall(slot, [&](auto const& seg) { destroy(seg); });
+    }
+    m_size = 0;
+  }
+
+  //! Apply body to the segment in the given slot, with its true type.
+  template <typename Body>
+  RAJA_INLINE void segmentCall(size_t slot, Body&& body) const
+  {
+    visitor::visit(m_types[slot],
+                   &m_storage[slot],
+                   std::forward<Body>(body));
+  }
+
+  /// Apply body to every held segment with the slot walk unrolled at
+  /// compile time; the per-slot occupancy tests fold away when the set
+  /// is full.
+  template <typename Body>
+  RAJA_INLINE void forEachSegment(Body&& body) const
+  {
+    forEachSegment(std::forward<Body>(body), camp::make_idx_seq_t<N>{});
+  }
+
+private:
+  //! Compile-time tag of a segment type within the pack (position from
+  //  the end, matching TypedIndexSet's type id convention).
+  template <typename Tseg>
+  static constexpr int type_id_of()
+  {
+    return type_id_of_impl<Tseg, SegTypes...>();
+  }
+
+  template <typename Tseg>
+  static constexpr int type_id_of_impl()
+  {
+    return -1;
+  }
+
+  template <typename Tseg, typename T0, typename... TRest>
+  static constexpr int type_id_of_impl()
+  {
+    return std::is_same<Tseg, T0>::value
+               ? static_cast<int>(sizeof...(TRest))
+               : type_id_of_impl<Tseg, TRest...>();
+  }
+
+  template <typename Tseg>
+  RAJA_INLINE void destroy(Tseg const& seg)
+  {
+    seg.~Tseg();
+  }
+
+  template <typename Body, camp::idx_t... Slots>
+  RAJA_INLINE void forEachSegment(Body&& body, camp::idx_seq<Slots...>) const
+  {
+    using expander = int[];
+    (void)expander{0,
+                   (static_cast<size_t>(Slots) < m_size
+                        ? (segmentCall(static_cast<size_t>(Slots), body), 0)
+                        : 0)...};
+  }
+
+  storage_type m_storage[N];
+  int m_types[N] = {};
+  size_t m_size = 0;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Execute a StaticIndexSet: segments run back to back with the
+ *         given execution policy, with the segment walk unrolled.
+ *
+ * Plugins are invoked once for the whole set, and each segment is
+ * dispatched directly to the policy's forall_impl (as the TypedIndexSet
+ * traversal does), so per-segment cost is the loop itself rather than
+ * the generic forall entry path.
+ *
+ ******************************************************************************
+ */
+template <typename SegmentExecPolicy,
+          size_t N,
+          typename... SegTypes,
+          typename LoopBody>
+RAJA_INLINE void forall(StaticIndexSet<N, SegTypes...> const& iset,
+                        LoopBody&& loop_body)
+{
+  util::PluginContext context{util::make_context<SegmentExecPolicy>()};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  auto r = resources::get_resource<SegmentExecPolicy>::type::get_default();
+
+  iset.forEachSegment([&](auto const& segment) {
+    detail::CallForall{}(segment, SegmentExecPolicy(), body, r);
+  });
+
+  util::callPostLaunchPlugins(context);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -25,6 +25,7 @@
 #include <cstdlib>
 #include <iosfwd>
 #include <thread>
+#include <vector>
 
 #include "RAJA/util/types.hpp"
 
@@ -78,13 +79,13 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency. Returns true if this was the last
+  /// unsatisfied dependency; exactly one caller sees true per reset, so
+  /// the task can be handed to a ready queue without a lock.
   ///
-  void satisfyOne()
+  bool satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
-    }
+    return (m_semaphore_value.fetch_sub(1, std::memory_order_acq_rel) == 1);
   }
 
   ///
@@ -124,6 +125,74 @@ private:
   std::atomic<int> m_semaphore_value;
 };
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class holding one DepGraphNode per task (index set segment) to
+ *         describe the dependences of a task graph traversal.
+ *
+ *         A graph is built once -- size it with the number of segments
+ *         and record each edge with addDependency -- and may be reused
+ *         across traversals; the executor reloads every semaphore from
+ *         its reload value before each traversal.
+ *
+ ******************************************************************************
+ */
+class DepGraph
+{
+public:
+  ///
+  /// Default ctor creates an empty graph.
+  ///
+  DepGraph() = default;
+
+  ///
+  /// Construct a graph with given number of tasks and no dependences.
+  ///
+  explicit DepGraph(int num_tasks) : m_nodes(num_tasks) {}
+
+  ///
+  /// Resize graph to hold given number of tasks.
+  ///
+  void resize(int num_tasks) { m_nodes.resize(num_tasks); }
+
+  ///
+  /// Get number of tasks in graph.
+  ///
+  int numTasks() const { return static_cast<int>(m_nodes.size()); }
+
+  ///
+  /// Get node for task with given number.
+  ///
+  DepGraphNode& node(int task_num) { return m_nodes[task_num]; }
+
+  ///
+  /// Record that the task 'from' must complete before the task 'to' may
+  /// begin. Each task supports at most DepGraphNode::_MaxDepTasks_
+  /// outgoing edges.
+  ///
+  void addDependency(int from, int to)
+  {
+    DepGraphNode& from_node = m_nodes[from];
+    from_node.depTaskNum(from_node.numDepTasks()++) = to;
+    ++m_nodes[to].semaphoreReloadValue();
+  }
+
+  ///
+  /// Load every semaphore with its reload value; called by the executor
+  /// before each traversal of the graph.
+  ///
+  void reset()
+  {
+    for (DepGraphNode& node : m_nodes) {
+      node.reset();
+    }
+  }
+
+private:
+  std::vector<DepGraphNode> m_nodes;
+};
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -26,6 +26,7 @@
 #include <utility>
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/util/Allocators.hpp"
 
 namespace RAJA
 {
@@ -48,7 +49,7 @@ namespace RAJA
  *
  ******************************************************************************
  */
-template <typename T, typename Allocator = std::allocator<T> >
+template <typename T, typename Allocator = RAJA::util::hooked_allocator<T> >
 class RAJAVec
 {
   using allocator_traits_type = std::allocator_traits<Allocator>;
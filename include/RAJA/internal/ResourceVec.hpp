@@ -0,0 +1,330 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for a resource-aware vector template class
+ *          whose storage operations run on a camp resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ResourceVec_HPP
+#define RAJA_ResourceVec_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/Allocators.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Vector whose storage operations run on a camp resource, so
+ *         building large containers overlaps with kernels in flight.
+ *
+ *         Unlike RAJAVec, growth does not stall the driving thread:
+ *         the copy into the new allocation is issued on the resource
+ *         (asynchronously for GPU resources) and the old buffer is
+ *         retired rather than freed, reclaimed once wait() or the
+ *         destructor synchronizes the resource. append() bulk-copies
+ *         through the resource the same way, and event() returns an
+ *         event marking all storage operations issued so far for use
+ *         with resource-aware kernel launches.
+ *
+ *         Storage is allocated through the resource (host memory for
+ *         Host, device-accessible memory for GPU resources), or, when
+ *         an AllocatorSpace is given and an allocator is registered
+ *         for it through RAJA::util::set_allocator, through that
+ *         allocator - pass AllocatorSpace::pinned to build in
+ *         device-accessible pinned memory. Register the allocator
+ *         before constructing the vector; without one the resource's
+ *         storage is used.
+ *
+ *         Element access through operator[] and push_back touches
+ *         storage from the host and requires host-accessible storage.
+ *         Restricted to trivially copyable types, which is sufficient
+ *         for the index and offset containers this class is for.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Resource = resources::Host>
+class ResourceVec
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "ResourceVec requires a trivially copyable element type");
+
+public:
+  using value_type = T;
+  using resource_type = Resource;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = value_type*;
+  using const_iterator = const value_type*;
+
+  ///
+  /// Construct empty vector with given capacity, allocating through
+  /// the resource.
+  ///
+  explicit ResourceVec(Resource res = Resource::get_default(),
+                       size_type init_cap = 0)
+      : m_res(res),
+        m_space(util::AllocatorSpace::num_spaces),
+        m_data(nullptr),
+        m_capacity(0),
+        m_size(0)
+  {
+    reserve(init_cap);
+  }
+
+  ///
+  /// Construct empty vector allocating through the allocator
+  /// registered for the given space, falling back to the resource if
+  /// none is registered.
+  ///
+  ResourceVec(Resource res, util::AllocatorSpace space, size_type init_cap = 0)
+      : m_res(res),
+        m_space(util::has_allocator(space) ? space
+                                           : util::AllocatorSpace::num_spaces),
+        m_data(nullptr),
+        m_capacity(0),
+        m_size(0)
+  {
+    reserve(init_cap);
+  }
+
+  ResourceVec(const ResourceVec&) = delete;
+  ResourceVec& operator=(const ResourceVec&) = delete;
+
+  ///
+  /// Move ctor for vector.
+  ///
+  ResourceVec(ResourceVec&& other)
+      : m_res(other.m_res),
+        m_space(other.m_space),
+        m_data(other.m_data),
+        m_capacity(other.m_capacity),
+        m_size(other.m_size),
+        m_retired(std::move(other.m_retired))
+  {
+    other.m_data = nullptr;
+    other.m_capacity = 0;
+    other.m_size = 0;
+    other.m_retired.clear();
+  }
+
+  ///
+  /// Destroy vector and its data, synchronizing the resource so no
+  /// storage operation is still using a buffer being freed.
+  ///
+  ~ResourceVec()
+  {
+    wait();
+    if (m_data) {
+      deallocate(m_data);
+    }
+  }
+
+  ///
+  /// Get a pointer to the beginning of the contiguous vector
+  ///
+        pointer data()       { return m_data; }
+  ///
+  const_pointer data() const { return m_data; }
+
+  ///
+  /// Get an iterator to the end.
+  ///
+        iterator  end()       { return m_data + m_size; }
+  ///
+  const_iterator  end() const { return m_data + m_size; }
+
+  ///
+  /// Get an iterator to the beginning.
+  ///
+        iterator  begin()       { return m_data; }
+  ///
+  const_iterator  begin() const { return m_data; }
+
+  ///
+  /// Return true if vector has size zero; false otherwise.
+  ///
+  bool empty() const { return (m_size == 0); }
+
+  ///
+  /// Return current size of vector.
+  ///
+  size_type size() const { return m_size; }
+
+  ///
+  /// Return current capacity of vector.
+  ///
+  size_type capacity() const { return m_capacity; }
+
+  ///
+  /// Get the resource storage operations run on.
+  ///
+  resource_type& resource() { return m_res; }
+
+  ///
+  /// Get an event marking all storage operations issued so far; hand
+  /// it to resource-aware launches that consume the vector's data.
+  ///
+  resources::Event event() { return m_res.get_event(); }
+
+  ///
+  /// Block until all storage operations complete and reclaim retired
+  /// buffers from earlier growth.
+  ///
+  void wait()
+  {
+    m_res.wait();
+    for (pointer retired : m_retired) {
+      deallocate(retired);
+    }
+    m_retired.clear();
+  }
+
+  ///
+  /// Grow the capacity of the vector.
+  ///
+  void reserve(size_type target_capacity) { grow_cap(target_capacity); }
+
+  ///
+  /// Empty vector of all data; storage and retired buffers are kept.
+  ///
+  void clear() { m_size = 0; }
+
+  ///
+  /// Change the size of the vector. New items are uninitialized.
+  ///
+  void resize(size_type new_size)
+  {
+    reserve(new_size);
+    m_size = new_size;
+  }
+
+  ///
+  /// Bracket operator accessor.
+  ///
+        reference operator[](size_type i)       { return m_data[i]; }
+  ///
+  const_reference operator[](size_type i) const { return m_data[i]; }
+
+  ///
+  /// Add item to back end of vector.
+  ///
+  void push_back(const_reference item)
+  {
+    reserve(m_size + 1);
+    m_data[m_size] = item;
+    m_size++;
+  }
+
+  ///
+  /// Append n items from src through the resource. The copy is
+  /// asynchronous for GPU resources; synchronize through event() or
+  /// wait() before reusing src.
+  ///
+  void append(const_pointer src, size_type n)
+  {
+    if (n == 0) {
+      return;
+    }
+    reserve(m_size + n);
+    m_res.memcpy(m_data + m_size, src, n * sizeof(T));
+    m_size += n;
+  }
+
+private:
+  resource_type m_res;
+  util::AllocatorSpace m_space;
+  pointer m_data;
+  size_type m_capacity;
+  size_type m_size;
+
+  //
+  // Buffers replaced by growth while a copy out of them may still be
+  // in flight; freed once the resource synchronizes.
+  //
+  std::vector<pointer> m_retired;
+
+  static constexpr const size_type s_init_cap = 8;
+  static constexpr const double s_grow_fac = 1.5;
+
+  pointer allocate(size_type n)
+  {
+    if (m_space != util::AllocatorSpace::num_spaces) {
+      return static_cast<pointer>(
+          util::callback_allocate(m_space, n * sizeof(T)));
+    }
+    return m_res.template allocate<T>(n);
+  }
+
+  void deallocate(pointer ptr)
+  {
+    if (m_space != util::AllocatorSpace::num_spaces) {
+      util::callback_deallocate(m_space, ptr);
+    } else {
+      m_res.deallocate(ptr);
+    }
+  }
+
+  //
+  // Get the next value for capacity given a target and minimum.
+  //
+  size_type get_next_cap(size_type target_size)
+  {
+    size_type next_cap = s_init_cap;
+    if (m_capacity != 0) {
+      next_cap = static_cast<size_type>(m_capacity * s_grow_fac);
+    }
+    return std::max(target_size, next_cap);
+  }
+
+  //
+  // Increase capacity to at least target_size. The copy into the new
+  // buffer runs on the resource and the old buffer is retired, so
+  // growth does not block the driving thread.
+  //
+  void grow_cap(size_type target_size)
+  {
+    if (m_capacity >= target_size) {
+      return;
+    }
+
+    size_type next_cap = get_next_cap(target_size);
+    pointer tdata = allocate(next_cap);
+
+    if (m_data) {
+      if (m_size > 0) {
+        m_res.memcpy(tdata, m_data, m_size * sizeof(T));
+      }
+      m_retired.push_back(m_data);
+    }
+
+    m_data = tdata;
+    m_capacity = next_cap;
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -118,7 +118,7 @@ struct get_platform<RAJA::internal::StatementList<>> {
 
 // Top level MultiPolicy shouldn't select a platform
 // Once a specific policy is selected, that policy will select the correct
-// platform... see policy_invoker in MultiPolicy.hpp
+// platform... see policy_dispatcher in MultiPolicy.hpp
 template <typename SELECTOR, typename... POLICIES>
 struct get_platform<RAJA::policy::multi::MultiPolicy<SELECTOR, POLICIES...>> {
   static constexpr Platform value = Platform::undefined;
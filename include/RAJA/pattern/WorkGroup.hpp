@@ -24,6 +24,7 @@
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
 
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/internal/RAJAVec.hpp"
 #include "RAJA/util/plugins.hpp"
 
 namespace RAJA
@@ -239,6 +240,15 @@ struct WorkPool<WorkGroupPolicy<EXEC_POLICY_T,
     m_storage.reserve(num_loops, storage_bytes);
   }
 
+  //! set the ordering color attached to subsequently enqueued loops;
+  //  loops sharing a color run in enqueue order relative to each
+  //  other, loops of different colors may run concurrently. Only
+  //  available with the colored order policy.
+  void set_color(int color)
+  {
+    m_runner.set_color(color);
+  }
+
   template < typename segment_T, typename loop_T >
   inline void enqueue(segment_T&& seg, loop_T&& loop_body)
   {
@@ -454,6 +464,9 @@ WorkGroup<
   util::PluginContext context{util::make_context<EXEC_POLICY_T>()};
   util::callPreLaunchPlugins(context);
 
+  // the whole group is one notification for batched plugins
+  util::LaunchBatchScope batch(context, m_storage.size());
+
   // move any per run storage into worksite
   worksite_type site(m_runner.run(m_storage, std::forward<Args>(args)...));
 
@@ -462,6 +475,294 @@ WorkGroup<
   return site;
 }
 
+
+namespace expt
+{
+
+//
+// Forward declaration for the homogeneous workgroup template.
+//
+
+template <typename EXEC_POLICY_T,
+          typename INDEX_T,
+          typename EXTRA_ARGS_T,
+          typename SEGMENT_T,
+          typename LOOP_T>
+struct HomogeneousWorkGroup;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Experimental homogeneous WorkPool for a single declared loop type.
+ *
+ * The general WorkPool type-erases every enqueued loop behind a Vtable so
+ * loops of different types can share one storage. When every enqueued loop
+ * has the same segment and body type that indirection costs an indirect
+ * call per loop and blocks inlining. A HomogeneousWorkPool declares the
+ * single segment and body type up front, stores the loops in a typed
+ * array, and dispatches statically, so the compiler sees the body at every
+ * call site. Enqueueing a loop of any other type is a compile error.
+ *
+ * EXEC_POLICY_T is the forall execution policy each stored loop runs with
+ * (not a workgroup policy); loops run on the host in enqueue order, as
+ * with the ordered workgroup modes. Use make_homogeneous_workpool to
+ * deduce the segment and body types from samples.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   auto pack = [=] (Index_type i) { buffer[k[i]] = var[i]; };
+
+   auto pool = RAJA::expt::make_homogeneous_workpool<
+       exec_policy, Index_type, RAJA::xargs<>>(segments[0], pack);
+
+   for (int s = 0; s < num_segments; ++s) {
+     pool.enqueue(segments[s], pack);
+   }
+
+   auto group = pool.instantiate();
+   group.run();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename EXEC_POLICY_T,
+          typename INDEX_T,
+          typename EXTRA_ARGS_T,
+          typename SEGMENT_T,
+          typename LOOP_T>
+struct HomogeneousWorkPool {
+  static_assert(detail::is_xargs<EXTRA_ARGS_T>::value,
+      "HomogeneousWorkPool: EXTRA_ARGS_T must be a RAJA::xargs<...> type");
+};
+
+template <typename EXEC_POLICY_T,
+          typename INDEX_T,
+          typename ... Args,
+          typename SEGMENT_T,
+          typename LOOP_T>
+struct HomogeneousWorkPool<EXEC_POLICY_T,
+                           INDEX_T,
+                           xargs<Args...>,
+                           SEGMENT_T,
+                           LOOP_T>
+{
+  using exec_policy = EXEC_POLICY_T;
+  using index_type = INDEX_T;
+  using xarg_type = xargs<Args...>;
+  using segment_type = SEGMENT_T;
+  using loop_type = LOOP_T;
+
+  using workgroup_type = HomogeneousWorkGroup<
+      exec_policy, index_type, xarg_type, segment_type, loop_type>;
+
+  HomogeneousWorkPool() = default;
+
+  HomogeneousWorkPool(HomogeneousWorkPool const&) = delete;
+  HomogeneousWorkPool& operator=(HomogeneousWorkPool const&) = delete;
+
+  HomogeneousWorkPool(HomogeneousWorkPool&&) = default;
+  HomogeneousWorkPool& operator=(HomogeneousWorkPool&&) = default;
+
+  size_t num_loops() const
+  {
+    return m_holders.size();
+  }
+
+  void reserve(size_t num_loops)
+  {
+    m_holders.reserve(num_loops);
+  }
+
+  template < typename segment_in, typename loop_in >
+  inline void enqueue(segment_in&& seg, loop_in&& loop_body)
+  {
+    static_assert(std::is_same<camp::decay<loop_in>, loop_type>::value,
+        "HomogeneousWorkPool: enqueued loop body must have the declared type");
+    static_assert(std::is_same<camp::decay<segment_in>, segment_type>::value,
+        "HomogeneousWorkPool: enqueued segment must have the declared type");
+
+    if (m_holders.empty()) {
+      // perform auto-reserve on reuse
+      reserve(m_max_num_loops);
+    }
+
+    util::PluginContext context{util::make_context<exec_policy>()};
+    util::callPreCapturePlugins(context);
+
+    using RAJA::util::trigger_updates_before;
+    auto body = trigger_updates_before(loop_body);
+
+    m_holders.emplace_back(std::forward<segment_in>(seg), std::move(body));
+
+    util::callPostCapturePlugins(context);
+  }
+
+  inline workgroup_type instantiate();
+
+  void clear()
+  {
+    m_holders.clear();
+  }
+
+  ~HomogeneousWorkPool()
+  {
+    clear();
+  }
+
+private:
+  using holder_type = RAJA::detail::HoldForall<
+      exec_policy, segment_type, loop_type, index_type, Args...>;
+
+  friend workgroup_type;
+
+  RAJA::RAJAVec<holder_type> m_holders;
+  size_t m_max_num_loops = 0;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Homogeneous WorkGroup owning loops from an instantiated
+ *         HomogeneousWorkPool.
+ *
+ * Running the group calls each stored loop directly through its concrete
+ * type, in enqueue order; there is no per-run storage so run returns
+ * nothing. The group can be run multiple times and must not be destroyed
+ * before loops launched asynchronously have finished running.
+ *
+ ******************************************************************************
+ */
+template <typename EXEC_POLICY_T,
+          typename INDEX_T,
+          typename ... Args,
+          typename SEGMENT_T,
+          typename LOOP_T>
+struct HomogeneousWorkGroup<EXEC_POLICY_T,
+                            INDEX_T,
+                            xargs<Args...>,
+                            SEGMENT_T,
+                            LOOP_T>
+{
+  using exec_policy = EXEC_POLICY_T;
+  using index_type = INDEX_T;
+  using xarg_type = xargs<Args...>;
+  using segment_type = SEGMENT_T;
+  using loop_type = LOOP_T;
+
+  using workpool_type = HomogeneousWorkPool<
+      exec_policy, index_type, xarg_type, segment_type, loop_type>;
+
+  HomogeneousWorkGroup(HomogeneousWorkGroup const&) = delete;
+  HomogeneousWorkGroup& operator=(HomogeneousWorkGroup const&) = delete;
+
+  HomogeneousWorkGroup(HomogeneousWorkGroup&&) = default;
+  HomogeneousWorkGroup& operator=(HomogeneousWorkGroup&&) = default;
+
+  size_t num_loops() const
+  {
+    return m_holders.size();
+  }
+
+  inline void run(Args... args)
+  {
+    util::PluginContext context{util::make_context<exec_policy>()};
+    util::callPreLaunchPlugins(context);
+
+    // the whole group is one notification for batched plugins
+    util::LaunchBatchScope batch(context, m_holders.size());
+
+    auto end = m_holders.end();
+    for (auto iter = m_holders.begin(); iter != end; ++iter) {
+      (*iter)(args...);
+    }
+
+    util::callPostLaunchPlugins(context);
+  }
+
+  void clear()
+  {
+    // storage is about to be destroyed
+    // TODO: synchronize
+    m_holders.clear();
+  }
+
+  ~HomogeneousWorkGroup()
+  {
+    clear();
+  }
+
+private:
+  using holder_type = typename workpool_type::holder_type;
+
+  friend workpool_type;
+
+  RAJA::RAJAVec<holder_type> m_holders;
+
+  explicit HomogeneousWorkGroup(RAJA::RAJAVec<holder_type>&& holders)
+    : m_holders(std::move(holders))
+  { }
+};
+
+
+template <typename EXEC_POLICY_T,
+          typename INDEX_T,
+          typename ... Args,
+          typename SEGMENT_T,
+          typename LOOP_T>
+inline
+typename HomogeneousWorkPool<EXEC_POLICY_T,
+                             INDEX_T,
+                             xargs<Args...>,
+                             SEGMENT_T,
+                             LOOP_T>::workgroup_type
+HomogeneousWorkPool<EXEC_POLICY_T,
+                    INDEX_T,
+                    xargs<Args...>,
+                    SEGMENT_T,
+                    LOOP_T>::instantiate()
+{
+  // update max size to auto-reserve on reuse
+  m_max_num_loops = std::max(m_holders.size(), m_max_num_loops);
+
+  // move holders into workgroup
+  return workgroup_type{std::move(m_holders)};
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Construct a HomogeneousWorkPool, deducing the segment and loop
+ *         body types from sample objects. The samples are used only for
+ *         deduction (lambda types cannot be spelled out); nothing is
+ *         enqueued.
+ *
+ ******************************************************************************
+ */
+template <typename EXEC_POLICY_T,
+          typename INDEX_T,
+          typename EXTRA_ARGS_T,
+          typename SEGMENT_T,
+          typename LOOP_T>
+RAJA_INLINE
+HomogeneousWorkPool<EXEC_POLICY_T,
+                    INDEX_T,
+                    EXTRA_ARGS_T,
+                    camp::decay<SEGMENT_T>,
+                    camp::decay<LOOP_T>>
+make_homogeneous_workpool(SEGMENT_T const&, LOOP_T const&)
+{
+  return HomogeneousWorkPool<EXEC_POLICY_T,
+                             INDEX_T,
+                             EXTRA_ARGS_T,
+                             camp::decay<SEGMENT_T>,
+                             camp::decay<LOOP_T>>{};
+}
+
+}  // namespace expt
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
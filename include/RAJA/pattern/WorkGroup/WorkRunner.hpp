@@ -22,6 +22,7 @@
 
 #include <utility>
 #include <type_traits>
+#include <vector>
 
 #include "RAJA/policy/loop/policy.hpp"
 
@@ -289,6 +290,133 @@ struct WorkRunnerForallReverse
   }
 };
 
+/*!
+ * Runs work in a storage container with colored (windowed) ordering:
+ * loops sharing an enqueue-time color run in their enqueue order
+ * relative to each other, while loops of different colors carry no
+ * ordering constraint and may run concurrently. The full ordered mode
+ * serializes every loop against every other; when only the loops
+ * writing the same buffer conflict, tagging each buffer's loops with
+ * one color keeps the required order at color granularity and frees
+ * the rest.
+ *
+ * Colors are set on the pool with set_color() and attach to every
+ * loop enqueued until the next set_color(); loops enqueued before any
+ * set_color() carry color 0. This base runs the color groups one
+ * after another -- a valid schedule of the contract -- and backends
+ * with real concurrency specialize run() to spread the groups over
+ * threads.
+ */
+template <typename FORALL_EXEC_POLICY,
+          typename EXEC_POLICY_T,
+          typename ORDER_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunnerForallColored
+    : WorkRunnerForallOrdered_base<
+      FORALL_EXEC_POLICY,
+      EXEC_POLICY_T,
+      ORDER_POLICY_T,
+      ALLOCATOR_T,
+      INDEX_T,
+      Args...>
+{
+  using base = WorkRunnerForallOrdered_base<
+      FORALL_EXEC_POLICY,
+      EXEC_POLICY_T,
+      ORDER_POLICY_T,
+      ALLOCATOR_T,
+      INDEX_T,
+      Args...>;
+
+  WorkRunnerForallColored() = default;
+
+  WorkRunnerForallColored(WorkRunnerForallColored const&) = delete;
+  WorkRunnerForallColored& operator=(WorkRunnerForallColored const&) = delete;
+
+  WorkRunnerForallColored(WorkRunnerForallColored &&) = default;
+  WorkRunnerForallColored& operator=(WorkRunnerForallColored &&) = default;
+
+  //! set the color attached to subsequently enqueued loops
+  void set_color(int color)
+  {
+    m_current_color = color;
+  }
+
+  // record the enqueueing color alongside the loop's storage slot
+  template < typename WorkContainer, typename segment_T, typename loop_T >
+  inline void enqueue(WorkContainer& storage, segment_T&& seg, loop_T&& loop)
+  {
+    m_colors.push_back(m_current_color);
+    base::enqueue(storage,
+                  std::forward<segment_T>(seg), std::forward<loop_T>(loop));
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_colors.clear();
+    m_current_color = 0;
+    base::clear();
+  }
+
+  // run the color groups one after another, each group's loops in
+  // enqueue order
+  template < typename WorkContainer >
+  typename base::per_run_storage run(WorkContainer const& storage,
+                                     Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    typename base::per_run_storage run_storage{};
+
+    auto groups = make_color_groups<value_type>(storage);
+
+    for (size_t g = 0; g < groups.size(); ++g) {
+      for (const value_type* loop_ptr : groups[g]) {
+        value_type::call(loop_ptr, args...);
+      }
+    }
+
+    return run_storage;
+  }
+
+protected:
+  //! partition the stored loops by color, preserving enqueue order
+  //  within each group; groups are ordered by first appearance
+  template < typename value_type, typename WorkContainer >
+  std::vector<std::vector<const value_type*>> make_color_groups(
+      WorkContainer const& storage) const
+  {
+    std::vector<int> group_colors;
+    std::vector<std::vector<const value_type*>> groups;
+
+    size_t i = 0;
+    auto end = storage.end();
+    for (auto iter = storage.begin(); iter != end; ++iter, ++i) {
+      int color = (i < m_colors.size()) ? m_colors[i] : 0;
+
+      size_t g = 0;
+      for (; g < group_colors.size(); ++g) {
+        if (group_colors[g] == color) {
+          break;
+        }
+      }
+      if (g == group_colors.size()) {
+        group_colors.push_back(color);
+        groups.emplace_back();
+      }
+      groups[g].push_back(&*iter);
+    }
+
+    return groups;
+  }
+
+  std::vector<int> m_colors;
+  int m_current_color = 0;
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -1041,6 +1041,307 @@ private:
   }
 };
 
+template < typename ALLOCATOR_T, typename Vtable_T >
+class WorkStorage<RAJA::chunked_array_of_objects, ALLOCATOR_T, Vtable_T>
+{
+  using allocator_traits_type = std::allocator_traits<ALLOCATOR_T>;
+  using propagate_on_container_copy_assignment =
+      typename allocator_traits_type::propagate_on_container_copy_assignment;
+  using propagate_on_container_move_assignment =
+      typename allocator_traits_type::propagate_on_container_move_assignment;
+  using propagate_on_container_swap            =
+      typename allocator_traits_type::propagate_on_container_swap;
+  static_assert(std::is_same<typename allocator_traits_type::value_type, char>::value,
+      "WorkStorage expects an allocator for 'char's.");
+public:
+  using storage_policy = RAJA::chunked_array_of_objects;
+  using vtable_type = Vtable_T;
+
+  template < typename holder >
+  using true_value_type = WorkStruct<sizeof(holder), vtable_type>;
+
+  using value_type = GenericWorkStruct<vtable_type>;
+  using allocator_type = ALLOCATOR_T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+private:
+  // struct used in storage vector to retain pointer and allocation size
+  struct pointer_and_size
+  {
+    pointer ptr;
+    size_type size;
+  };
+
+  // description of one chunk of loop storage, loops are packed into the
+  // chunk back to back and chunks are never reallocated so loops never
+  // move once constructed
+  struct chunk_description
+  {
+    char* begin;
+    size_type capacity;
+    size_type used;
+  };
+
+public:
+
+  // iterator base class for accessing stored WorkStructs outside of the container
+  struct const_iterator_base
+  {
+    using value_type = const typename WorkStorage::value_type;
+    using pointer = typename WorkStorage::const_pointer;
+    using reference = typename WorkStorage::const_reference;
+    using difference_type = typename WorkStorage::difference_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    const_iterator_base(const pointer_and_size* ptrptr)
+      : m_ptrptr(ptrptr)
+    { }
+
+    RAJA_HOST_DEVICE reference operator*() const
+    {
+      return *(m_ptrptr->ptr);
+    }
+
+    RAJA_HOST_DEVICE const_iterator_base& operator+=(difference_type n)
+    {
+      m_ptrptr += n;
+      return *this;
+    }
+
+    RAJA_HOST_DEVICE friend inline difference_type operator-(
+        const_iterator_base const& lhs_iter, const_iterator_base const& rhs_iter)
+    {
+      return lhs_iter.m_ptrptr - rhs_iter.m_ptrptr;
+    }
+
+    RAJA_HOST_DEVICE friend inline bool operator==(
+        const_iterator_base const& lhs_iter, const_iterator_base const& rhs_iter)
+    {
+      return lhs_iter.m_ptrptr == rhs_iter.m_ptrptr;
+    }
+
+    RAJA_HOST_DEVICE friend inline bool operator<(
+        const_iterator_base const& lhs_iter, const_iterator_base const& rhs_iter)
+    {
+      return lhs_iter.m_ptrptr < rhs_iter.m_ptrptr;
+    }
+
+  private:
+    const pointer_and_size* m_ptrptr;
+  };
+
+  using const_iterator = random_access_iterator<const_iterator_base>;
+
+
+  explicit WorkStorage(allocator_type const& aloc)
+    : m_vec(0, aloc)
+    , m_chunks(0, aloc)
+    , m_aloc(aloc)
+  { }
+
+  WorkStorage(WorkStorage const&) = delete;
+  WorkStorage& operator=(WorkStorage const&) = delete;
+
+  WorkStorage(WorkStorage&& rhs)
+    : m_vec(std::move(rhs.m_vec))
+    , m_chunks(std::move(rhs.m_chunks))
+    , m_aloc(std::move(rhs.m_aloc))
+  { }
+
+  WorkStorage& operator=(WorkStorage&& rhs)
+  {
+    if (this != &rhs) {
+      move_assign_private(std::move(rhs), propagate_on_container_move_assignment{});
+    }
+    return *this;
+  }
+
+  // reserve space for num_loops pointers and ensure the current chunk can
+  // hold loop_storage_size bytes so that emplacing that many bytes of loops
+  // performs no further allocation
+  void reserve(size_type num_loops, size_type loop_storage_size)
+  {
+    m_vec.reserve(num_loops);
+    if (loop_storage_size > chunk_unused()) {
+      add_chunk(loop_storage_size);
+    }
+  }
+
+  // number of loops stored
+  size_type size() const
+  {
+    return m_vec.size();
+  }
+
+  const_iterator begin() const
+  {
+    return const_iterator(m_vec.begin());
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator(m_vec.end());
+  }
+
+  // number of bytes used for storage of loops
+  size_type storage_size() const
+  {
+    size_type storage_size_nbytes = 0;
+    for (size_t i = 0; i < m_vec.size(); ++i) {
+      storage_size_nbytes += m_vec[i].size;
+    }
+    return storage_size_nbytes;
+  }
+
+  template < typename holder, typename ... holder_ctor_args >
+  void emplace(const vtable_type* vtable, holder_ctor_args&&... ctor_args)
+  {
+    m_vec.emplace_back(create_value<holder>(
+        vtable, std::forward<holder_ctor_args>(ctor_args)...));
+  }
+
+  // destroy all stored loops, deallocates all storage
+  void clear()
+  {
+    while (!m_vec.empty()) {
+      destroy_value(m_vec.back());
+      m_vec.pop_back();
+    }
+    m_vec.shrink_to_fit();
+    deallocate_chunks();
+  }
+
+  ~WorkStorage()
+  {
+    clear();
+  }
+
+private:
+  RAJAVec<pointer_and_size, typename allocator_traits_type::template rebind_alloc<pointer_and_size>> m_vec;
+  RAJAVec<chunk_description, typename allocator_traits_type::template rebind_alloc<chunk_description>> m_chunks;
+  allocator_type m_aloc;
+
+  // minimum chunk allocation, amortizes allocation cost when reserve was
+  // not called with an accurate storage size
+  static constexpr size_type default_chunk_size = 4096;
+
+  // move assignment if allocator propagates on move assignment
+  void move_assign_private(WorkStorage&& rhs, std::true_type)
+  {
+    clear();
+    m_vec = std::move(rhs.m_vec);
+    m_chunks = std::move(rhs.m_chunks);
+    m_aloc = std::move(rhs.m_aloc);
+  }
+
+  // move assignment if allocator does not propagate on move assignment
+  void move_assign_private(WorkStorage&& rhs, std::false_type)
+  {
+    clear();
+    if (m_aloc == rhs.m_aloc) {
+      // take storage if allocators compare equal
+      m_vec = std::move(rhs.m_vec);
+      m_chunks = std::move(rhs.m_chunks);
+    } else {
+      // allocate new storage if allocators do not compare equal
+      reserve(rhs.size(), rhs.storage_size());
+      for (size_type i = 0; i < rhs.m_vec.size(); ++i) {
+        m_vec.emplace_back(move_destroy_value(rhs.m_vec[i]));
+      }
+      rhs.m_vec.clear();
+      rhs.clear();
+    }
+  }
+
+  // number of unused bytes at the end of the current chunk
+  size_type chunk_unused() const
+  {
+    return m_chunks.empty() ? 0 :
+        m_chunks.back().capacity - m_chunks.back().used;
+  }
+
+  // allocate a new chunk large enough to hold at least min_size bytes
+  void add_chunk(size_type min_size)
+  {
+    size_type chunk_capacity = std::max(min_size, default_chunk_size);
+    char* chunk_begin = allocator_traits_type::allocate(m_aloc, chunk_capacity);
+    m_chunks.emplace_back(chunk_description{chunk_begin, chunk_capacity, 0});
+  }
+
+  // get storage for a loop of value_size bytes from the current chunk,
+  // allocating a new chunk if it does not fit, loops already in storage
+  // are never moved
+  char* allocate_value_storage(size_type value_size)
+  {
+    if (value_size > chunk_unused()) {
+      add_chunk(value_size);
+    }
+    chunk_description& chunk = m_chunks.back();
+    char* value_storage = chunk.begin + chunk.used;
+    chunk.used += value_size;
+    return value_storage;
+  }
+
+  // round up value sizes so consecutive loops in a chunk stay aligned
+  static size_type aligned_value_size(size_type value_size)
+  {
+    constexpr size_type value_align = alignof(value_type);
+    return RAJA_DIVIDE_CEILING_INT(value_size, value_align) * value_align;
+  }
+
+  // allocate and construct value in storage
+  template < typename holder, typename ... holder_ctor_args >
+  pointer_and_size create_value(const vtable_type* vtable,
+                                holder_ctor_args&&... ctor_args)
+  {
+    const size_type value_size =
+        aligned_value_size(sizeof(true_value_type<holder>));
+
+    pointer value_ptr =
+        reinterpret_cast<pointer>(allocate_value_storage(value_size));
+
+    value_type::template construct<holder>(
+        value_ptr, vtable, std::forward<holder_ctor_args>(ctor_args)...);
+
+    return pointer_and_size{value_ptr, value_size};
+  }
+
+  // allocate storage and move construct object as copy of other value and
+  // destroy other value, the other value's chunk storage is deallocated
+  // later in bulk
+  pointer_and_size move_destroy_value(pointer_and_size other_value_and_size)
+  {
+    pointer value_ptr = reinterpret_cast<pointer>(
+        allocate_value_storage(other_value_and_size.size));
+
+    value_type::move_destroy(value_ptr, other_value_and_size.ptr);
+
+    return pointer_and_size{value_ptr, other_value_and_size.size};
+  }
+
+  // destroy value (chunk storage is deallocated in bulk in clear)
+  void destroy_value(pointer_and_size value_and_size_ptr)
+  {
+    value_type::destroy(value_and_size_ptr.ptr);
+  }
+
+  // deallocate all chunks of loop storage
+  void deallocate_chunks()
+  {
+    while (!m_chunks.empty()) {
+      chunk_description& chunk = m_chunks.back();
+      allocator_traits_type::deallocate(m_aloc, chunk.begin, chunk.capacity);
+      m_chunks.pop_back();
+    }
+    m_chunks.shrink_to_fit();
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
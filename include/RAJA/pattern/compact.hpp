@@ -0,0 +1,153 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_HPP
+#define RAJA_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  stream compaction (copy_if) execution pattern
+*
+* Copies the elements of [begin, end) satisfying pred to out, preserving
+* their relative order, in a single pass over the input. This replaces the
+* flags-array + scan + scatter idiom; the GPU back-ends implement it with
+* a single device-wide select so the input is streamed once.
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] pred unary predicate selecting elements to keep
+*
+* \return the number of elements written to out
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
+* \note{Returns a host-side count, so asynchronous policies still
+*synchronize before returning}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Predicate>
+concepts::enable_if_t<Index_type,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+copy_if(const ExecPolicy &p,
+        Iter begin,
+        Iter end,
+        IterOut out,
+        Predicate pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::compact::copy_if(p, begin, end, out, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition execution pattern
+*
+* Copies all elements of [begin, end) to out, with elements satisfying
+* pred placed before elements that do not. Selected elements keep their
+* relative order; rejected elements are stored in reverse order at the
+* end of the output range, matching the device-wide partition primitives
+* the GPU back-ends use.
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range; must have room for dist(begin, end) elements
+* \param[in] pred unary predicate selecting elements placed first
+*
+* \return the number of elements satisfying pred
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
+* \note{Returns a host-side count, so asynchronous policies still
+*synchronize before returning}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Predicate>
+concepts::enable_if_t<Index_type,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+partition(const ExecPolicy &p,
+          Iter begin,
+          Iter end,
+          IterOut out,
+          Predicate pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::compact::partition(p, begin, end, out, pred);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if_t<Index_type,
+                      type_traits::is_execution_policy<ExecPolicy>>
+copy_if(Args &&... args)
+{
+  return copy_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if_t<Index_type,
+                      type_traits::is_execution_policy<ExecPolicy>>
+partition(Args &&... args)
+{
+  return partition(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
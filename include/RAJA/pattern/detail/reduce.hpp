@@ -21,6 +21,8 @@
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "camp/camp.hpp"
+
 #define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)               \
   template <typename T>                                       \
   class Reduce##OP<POL, T>                                    \
@@ -41,6 +43,28 @@
     using Base::Base;                                                    \
   };
 
+#define RAJA_DECLARE_COMPOSITE_REDUCER(POL, COMBINER)                       \
+  template <typename T, template <typename> class... ReduceOps>             \
+  class ReduceComposite<POL, T, ReduceOps...>                               \
+      : public reduce::detail::BaseReduceComposite<T, COMBINER,             \
+                                                   ReduceOps...>            \
+  {                                                                         \
+  public:                                                                   \
+    using Base =                                                            \
+        reduce::detail::BaseReduceComposite<T, COMBINER, ReduceOps...>;     \
+    using Base::Base;                                                       \
+  };
+
+#define RAJA_DECLARE_GENERIC_REDUCER(POL, COMBINER)                     \
+  template <typename ReduceOp>                                          \
+  class Reduce<POL, ReduceOp>                                           \
+      : public reduce::detail::BaseReduceGeneric<ReduceOp, COMBINER>    \
+  {                                                                     \
+  public:                                                               \
+    using Base = reduce::detail::BaseReduceGeneric<ReduceOp, COMBINER>; \
+    using Base::Base;                                                   \
+  };
+
 #define RAJA_DECLARE_ALL_REDUCERS(POL, COMBINER)       \
   RAJA_DECLARE_REDUCER(Sum, POL, COMBINER)             \
   RAJA_DECLARE_REDUCER(Min, POL, COMBINER)             \
@@ -48,7 +72,9 @@
   RAJA_DECLARE_INDEX_REDUCER(MinLoc, POL, COMBINER)    \
   RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)    \
   RAJA_DECLARE_REDUCER(BitOr, POL, COMBINER)           \
-  RAJA_DECLARE_REDUCER(BitAnd, POL, COMBINER)
+  RAJA_DECLARE_REDUCER(BitAnd, POL, COMBINER)          \
+  RAJA_DECLARE_COMPOSITE_REDUCER(POL, COMBINER)        \
+  RAJA_DECLARE_GENERIC_REDUCER(POL, COMBINER)
 
 namespace RAJA
 {
@@ -66,6 +92,7 @@ namespace detail
 template <typename T, template <typename...> class Op>
 struct op_adapter : private Op<T, T, T> {
   using operator_type = Op<T, T, T>;
+  using value_type = T;
   RAJA_HOST_DEVICE static constexpr T identity()
   {
     return operator_type::identity();
@@ -98,6 +125,31 @@ template <typename T>
 struct and_bit : detail::op_adapter<T, RAJA::operators::bit_and> {
 };
 
+/*!
+ * Compensated (Kahan/Neumaier) summation; accumulates in a kahan_tally
+ * so the correction term rides along with the running sum through every
+ * combine, including the per-policy worker merges.
+ */
+template <typename T>
+struct kahan_sum
+    : detail::op_adapter<RAJA::operators::kahan_tally<T>,
+                         RAJA::operators::kahan_plus> {
+};
+
+/*!
+ * Fold operation for composite reducer values; each component of the
+ * value is combined with its own reduction operation.
+ */
+template <typename V>
+struct composite {
+  RAJA_HOST_DEVICE static constexpr V identity() { return V(); }
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(V &val, const V v) const
+  {
+    val.combine(v);
+  }
+};
+
 
 #if defined(RAJA_RAJA_ENABLE_TARGET_OPENMP)
 #pragma omp end declare target
@@ -157,6 +209,67 @@ public:
   }
 };
 
+/*!
+ * Value type for composite reductions, combining one component per
+ * reduction operation with all components folded from the same operand.
+ * Default construction yields the per-operation identities; construction
+ * from a single value broadcasts that operand to every component.
+ */
+template <typename T, typename... Reduces>
+class CompositeValue
+{
+  static_assert(sizeof...(Reduces) > 0,
+                "CompositeValue requires at least one reduce operation");
+
+public:
+  static constexpr size_t num_ops = sizeof...(Reduces);
+  T vals[num_ops];
+
+  RAJA_HOST_DEVICE constexpr CompositeValue() : vals{Reduces::identity()...} {}
+
+  RAJA_HOST_DEVICE constexpr CompositeValue(T const &val_)
+      : vals{broadcast<Reduces>(val_)...}
+  {
+  }
+
+  //! fold each component of other into the matching component
+  RAJA_HOST_DEVICE RAJA_INLINE void combine(CompositeValue const &other)
+  {
+    combine_ops(other, camp::make_idx_seq_t<num_ops>{});
+  }
+
+  //! access one component of the combined value
+  RAJA_HOST_DEVICE T get(size_t i) const { return vals[i]; }
+
+  RAJA_HOST_DEVICE bool operator==(CompositeValue const &rhs) const
+  {
+    for (size_t i = 0; i < num_ops; ++i) {
+      if (vals[i] != rhs.vals[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+  RAJA_HOST_DEVICE bool operator!=(CompositeValue const &rhs) const
+  {
+    return !(*this == rhs);
+  }
+
+private:
+  template <typename>
+  RAJA_HOST_DEVICE static constexpr T broadcast(T const &val_)
+  {
+    return val_;
+  }
+
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE RAJA_INLINE void combine_ops(CompositeValue const &other,
+                                                camp::idx_seq<Is...>)
+  {
+    camp::sink((Reduces{}(vals[Is], other.vals[Is]), 0)...);
+  }
+};
+
 }  // namespace detail
 
 }  // namespace reduce
@@ -208,6 +321,17 @@ public:
     c.reset(val, identity_);
   }
 
+  //! open an accumulation window spanning several kernel launches
+  //  CPU combiners fold contributions through the parent chain as worker
+  //  copies are destroyed, so a window changes nothing here; the methods
+  //  exist so code written against offload reducers, where begin_batch()
+  //  lets the window's launches share one tally allocation and one
+  //  finalization, ports without #ifdefs
+  void begin_batch() {}
+
+  //! close an accumulation window opened with begin_batch()
+  void end_batch() {}
+
   //! prohibit compiler-generated copy assignment
   BaseReduce &operator=(const BaseReduce &) = delete;
 
@@ -238,6 +362,59 @@ public:
   T get() const { return c.get(); }
 };
 
+/*!
+ * Rebinds a concrete reduction operator to the template-template shape
+ * BaseReduce expects, so one operator object type serves for its own
+ * accumulation type.
+ */
+template <typename Op>
+struct fixed_op {
+  template <typename>
+  using apply = Op;
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Generic reducer class template; reduces with a user-supplied
+ *         operator object instead of one of the built-in operations.
+ *
+ *         The operator provides the accumulation type, the identity,
+ *         and the combine:
+ *
+ *           struct Op {
+ *             using value_type = ...;                  // accumulation type
+ *             static constexpr value_type identity();  // combine-neutral
+ *             void operator()(value_type &acc, value_type const &v) const;
+ *           };
+ *
+ *         which is the concept the operator objects in RAJA::reduce
+ *         (sum, min, kahan_sum, ...) already model.
+ *
+ **************************************************************************
+ */
+template <typename ReduceOp, template <typename, typename> class Combiner>
+class BaseReduceGeneric
+    : public BaseReduce<typename ReduceOp::value_type,
+                        fixed_op<ReduceOp>::template apply,
+                        Combiner>
+{
+public:
+  using Base = BaseReduce<typename ReduceOp::value_type,
+                          fixed_op<ReduceOp>::template apply,
+                          Combiner>;
+  using value_type = typename Base::value_type;
+  using Base::Base;
+
+  //! reducer function; folds the operand into the running value
+  RAJA_HOST_DEVICE
+  const BaseReduceGeneric &combine(value_type const &rhs) const
+  {
+    Base::combine(rhs);
+    return *this;
+  }
+};
+
 template <typename T, typename Reduce, typename Derived>
 class BaseCombinable
 {
@@ -522,6 +699,46 @@ public:
   operator T() const { return Base::get(); }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  Composite reducer class template; applies several reduction
+ *         operations to the same operand stream in a single pass, with
+ *         all components kept in one tally value.
+ *
+ **************************************************************************
+ */
+template <typename T,
+          template <typename, typename> class Combiner,
+          template <typename> class... ReduceOps>
+class BaseReduceComposite
+    : public BaseReduce<CompositeValue<T, ReduceOps<T>...>,
+                        RAJA::reduce::composite,
+                        Combiner>
+{
+public:
+  using Base = BaseReduce<CompositeValue<T, ReduceOps<T>...>,
+                          RAJA::reduce::composite,
+                          Combiner>;
+  using value_type = typename Base::value_type;
+  using Base::Base;
+
+  constexpr BaseReduceComposite(T init_val) : Base(value_type(init_val)) {}
+
+  //! reducer function; folds the operand into every component
+  RAJA_HOST_DEVICE
+  const BaseReduceComposite &combine(T rhs) const
+  {
+    Base::combine(value_type(rhs));
+    return *this;
+  }
+
+  void reset(T init_val) { Base::reset(value_type(init_val)); }
+
+  //! Get one component of the calculated reduced value
+  T get(size_t i) const { return Base::get().get(i); }
+};
+
 }  // namespace detail
 
 }  // namespace reduce
@@ -0,0 +1,365 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing bulk View fill and copy primitives that
+ *          lower to native memset/memcpy when layouts allow.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_fill_HPP
+#define RAJA_fill_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstring>
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+#if defined(RAJA_CUDA_ACTIVE)
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/// Number of elements a layout addresses: the product of its sizes
+/// (projected dimensions count as one).
+template <typename LayoutT>
+RAJA_INLINE Index_type layout_total_size(LayoutT const& layout)
+{
+  Index_type total = 1;
+  for (size_t d = 0; d < LayoutT::n_dims; ++d) {
+    total *= layout.sizes[d] ? static_cast<Index_type>(layout.sizes[d]) : 1;
+  }
+  return total;
+}
+
+/// Whether a layout addresses a dense contiguous block: under some
+/// ordering of the dimensions the strides telescope down to one, i.e.
+/// each stride is the next smaller stride times that dimension's size.
+/// Permuted (e.g. column-major) layouts qualify; offset gaps and
+/// strided slices do not.
+template <typename LayoutT>
+RAJA_INLINE bool layout_is_contiguous(LayoutT const& layout)
+{
+  constexpr size_t n_dims = LayoutT::n_dims;
+
+  Index_type strides[n_dims];
+  Index_type sizes[n_dims];
+  for (size_t d = 0; d < n_dims; ++d) {
+    strides[d] = static_cast<Index_type>(layout.strides[d]);
+    sizes[d] = layout.sizes[d] ? static_cast<Index_type>(layout.sizes[d]) : 1;
+  }
+
+  // insertion sort by ascending stride; n_dims is tiny
+  for (size_t d = 1; d < n_dims; ++d) {
+    for (size_t k = d; k > 0 && strides[k] < strides[k - 1]; --k) {
+      Index_type tmp_stride = strides[k];
+      strides[k] = strides[k - 1];
+      strides[k - 1] = tmp_stride;
+      Index_type tmp_size = sizes[k];
+      sizes[k] = sizes[k - 1];
+      sizes[k - 1] = tmp_size;
+    }
+  }
+
+  Index_type expected = 1;
+  for (size_t d = 0; d < n_dims; ++d) {
+    if (sizes[d] > 1 && strides[d] != expected) {
+      return false;
+    }
+    expected *= sizes[d];
+  }
+  return true;
+}
+
+/// Whether every byte of value is the same, so a fill can lower to
+/// memset (covers zero for all arithmetic types and any value of
+/// one-byte types).
+template <typename T>
+RAJA_INLINE bool is_byte_splat(T const& value, unsigned char& byte)
+{
+  unsigned char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  byte = bytes[0];
+  for (size_t b = 1; b < sizeof(T); ++b) {
+    if (bytes[b] != bytes[0]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Apply a layout to an array of indices.
+template <typename LayoutT, camp::idx_t... Is>
+RAJA_HOST_DEVICE RAJA_INLINE auto apply_layout(LayoutT const& layout,
+                                               Index_type const* indices,
+                                               camp::idx_seq<Is...>)
+    -> decltype(layout(indices[Is]...))
+{
+  return layout(indices[Is]...);
+}
+
+/// Decompose a linear index over the layout's sizes in row-major order.
+/// The decomposition order is only an iteration order -- each element is
+/// produced exactly once -- so it is correct for any layout, and for the
+/// common row-major case consecutive linear indices touch consecutive
+/// memory.
+template <typename LayoutT>
+RAJA_HOST_DEVICE RAJA_INLINE void delinearize(LayoutT const& layout,
+                                              Index_type linear,
+                                              Index_type* indices)
+{
+  for (size_t d = LayoutT::n_dims; d-- > 0;) {
+    Index_type size =
+        layout.sizes[d] ? static_cast<Index_type>(layout.sizes[d]) : 1;
+    indices[d] = linear % size;
+    linear /= size;
+  }
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  fill every element of a View with a value
+*
+* When the View's Layout addresses a dense contiguous block (any
+* dimension permutation) and the value is a byte splat -- zero for all
+* arithmetic types -- the fill lowers to std::memset, which saturates
+* bandwidth where an elementwise forall does not. Other cases run an
+* elementwise loop through the Layout.
+*
+* \param[in] res Host resource the fill runs on
+* \param[in,out] view View whose elements are written
+* \param[in] value value assigned to every element
+*
+* \return an event proxy for the fill's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ViewType,
+          typename T = typename camp::decay<ViewType>::nc_value_type>
+RAJA_INLINE resources::EventProxy<resources::Host> fill(resources::Host& res,
+                                                        ViewType const& view,
+                                                        T value)
+{
+  using LayoutT = typename camp::decay<ViewType>::layout_type;
+  constexpr size_t n_dims = LayoutT::n_dims;
+
+  const Index_type total = detail::layout_total_size(view.layout);
+
+  unsigned char byte;
+  if (detail::layout_is_contiguous(view.layout) &&
+      detail::is_byte_splat(value, byte)) {
+    std::memset(view.data, byte, static_cast<size_t>(total) * sizeof(T));
+    return resources::EventProxy<resources::Host>(&res);
+  }
+
+  for (Index_type i = 0; i < total; ++i) {
+    Index_type indices[n_dims];
+    detail::delinearize(view.layout, i, indices);
+    view.data[detail::apply_layout(view.layout, indices,
+                                   camp::make_idx_seq_t<n_dims>{})] = value;
+  }
+  return resources::EventProxy<resources::Host>(&res);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  copy every element of one View into another
+*
+* When both Layouts address dense contiguous blocks with identical
+* stride structure the copy lowers to std::memcpy. Views whose layouts
+* differ (e.g. row-major to column-major) run a permuting copy that
+* streams the destination in its layout order, so the stores are the
+* contiguous side and only the gathered loads stride.
+*
+* The index spaces (sizes per dimension) of the two views must match;
+* the ranges must not overlap.
+*
+* \param[in] res Host resource the copy runs on
+* \param[in,out] dst View written to
+* \param[in] src View read from
+*
+* \return an event proxy for the copy's completion on the resource
+*
+******************************************************************************
+*/
+template <typename DstView, typename SrcView>
+RAJA_INLINE resources::EventProxy<resources::Host> copy(resources::Host& res,
+                                                        DstView const& dst,
+                                                        SrcView const& src)
+{
+  using DstLayout = typename camp::decay<DstView>::layout_type;
+  using SrcLayout = typename camp::decay<SrcView>::layout_type;
+  using T = typename camp::decay<DstView>::nc_value_type;
+  static_assert(DstLayout::n_dims == SrcLayout::n_dims,
+                "Views must have the same number of dimensions");
+  constexpr size_t n_dims = DstLayout::n_dims;
+
+  const Index_type total = detail::layout_total_size(dst.layout);
+
+  bool same_strides = true;
+  for (size_t d = 0; d < n_dims; ++d) {
+    if (static_cast<Index_type>(dst.layout.strides[d]) !=
+        static_cast<Index_type>(src.layout.strides[d])) {
+      same_strides = false;
+      break;
+    }
+  }
+
+  if (same_strides && detail::layout_is_contiguous(dst.layout)) {
+    std::memcpy(dst.data, src.data, static_cast<size_t>(total) * sizeof(T));
+    return resources::EventProxy<resources::Host>(&res);
+  }
+
+  for (Index_type i = 0; i < total; ++i) {
+    Index_type indices[n_dims];
+    detail::delinearize(dst.layout, i, indices);
+    dst.data[detail::apply_layout(dst.layout, indices,
+                                  camp::make_idx_seq_t<n_dims>{})] =
+        src.data[detail::apply_layout(src.layout, indices,
+                                      camp::make_idx_seq_t<n_dims>{})];
+  }
+  return resources::EventProxy<resources::Host>(&res);
+}
+
+#if defined(RAJA_CUDA_ACTIVE)
+
+namespace detail
+{
+
+//! block size of the elementwise fill/copy fallback kernels
+constexpr size_t fill_cuda_block_size = 256;
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  fill every element of a View on a Cuda resource
+*
+* Contiguous layouts with byte-splat values lower to cudaMemsetAsync on
+* the resource's stream; everything else runs an elementwise kernel.
+* Asynchronous either way -- wait on the resource or returned event.
+*
+******************************************************************************
+*/
+template <typename ViewType,
+          typename T = typename camp::decay<ViewType>::nc_value_type>
+RAJA_INLINE resources::EventProxy<resources::Cuda> fill(resources::Cuda& res,
+                                                        ViewType const& view,
+                                                        T value)
+{
+  using LayoutT = typename camp::decay<ViewType>::layout_type;
+  constexpr size_t n_dims = LayoutT::n_dims;
+
+  const Index_type total = detail::layout_total_size(view.layout);
+
+  unsigned char byte;
+  if (detail::layout_is_contiguous(view.layout) &&
+      detail::is_byte_splat(value, byte)) {
+    cudaErrchk(cudaMemsetAsync(view.data, byte,
+                               static_cast<size_t>(total) * sizeof(T),
+                               res.get_stream()));
+    return resources::EventProxy<resources::Cuda>(&res);
+  }
+
+  auto layout = view.layout;
+  auto data = view.data;
+  return forall<cuda_exec<detail::fill_cuda_block_size, true>>(
+      res, TypedRangeSegment<Index_type>(0, total),
+      [=] RAJA_DEVICE(Index_type i) {
+        Index_type indices[n_dims];
+        detail::delinearize(layout, i, indices);
+        data[detail::apply_layout(layout, indices,
+                                  camp::make_idx_seq_t<n_dims>{})] = value;
+      });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  copy every element of one View into another on a Cuda resource
+*
+* Identical contiguous stride structures lower to cudaMemcpyAsync on the
+* resource's stream; layout-changing copies run a permuting kernel that
+* streams the destination in its layout order so the stores coalesce.
+* Asynchronous either way -- wait on the resource or returned event.
+*
+******************************************************************************
+*/
+template <typename DstView, typename SrcView>
+RAJA_INLINE resources::EventProxy<resources::Cuda> copy(resources::Cuda& res,
+                                                        DstView const& dst,
+                                                        SrcView const& src)
+{
+  using DstLayout = typename camp::decay<DstView>::layout_type;
+  using SrcLayout = typename camp::decay<SrcView>::layout_type;
+  using T = typename camp::decay<DstView>::nc_value_type;
+  static_assert(DstLayout::n_dims == SrcLayout::n_dims,
+                "Views must have the same number of dimensions");
+  constexpr size_t n_dims = DstLayout::n_dims;
+
+  const Index_type total = detail::layout_total_size(dst.layout);
+
+  bool same_strides = true;
+  for (size_t d = 0; d < n_dims; ++d) {
+    if (static_cast<Index_type>(dst.layout.strides[d]) !=
+        static_cast<Index_type>(src.layout.strides[d])) {
+      same_strides = false;
+      break;
+    }
+  }
+
+  if (same_strides && detail::layout_is_contiguous(dst.layout)) {
+    cudaErrchk(cudaMemcpyAsync(dst.data, src.data,
+                               static_cast<size_t>(total) * sizeof(T),
+                               cudaMemcpyDefault, res.get_stream()));
+    return resources::EventProxy<resources::Cuda>(&res);
+  }
+
+  auto dst_layout = dst.layout;
+  auto src_layout = src.layout;
+  auto dst_data = dst.data;
+  auto src_data = src.data;
+  return forall<cuda_exec<detail::fill_cuda_block_size, true>>(
+      res, TypedRangeSegment<Index_type>(0, total),
+      [=] RAJA_DEVICE(Index_type i) {
+        Index_type indices[n_dims];
+        detail::delinearize(dst_layout, i, indices);
+        dst_data[detail::apply_layout(dst_layout, indices,
+                                      camp::make_idx_seq_t<n_dims>{})] =
+            src_data[detail::apply_layout(src_layout, indices,
+                                          camp::make_idx_seq_t<n_dims>{})];
+      });
+}
+
+#endif  // RAJA_CUDA_ACTIVE
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
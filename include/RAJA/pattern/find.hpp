@@ -0,0 +1,195 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA find declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_find_HPP
+#define RAJA_find_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+namespace impl
+{
+namespace find
+{
+
+/*!
+        \brief adapter threading a Host resource through the CPU find
+   implementations; the calling thread(s) execute the search directly, so
+   the resource carries no stream to forward
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+RAJA_INLINE concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                                  type_traits::is_execution_policy<ExecPolicy>>
+find_if(resources::Host&, const ExecPolicy& p, Iter begin, Iter end,
+        Predicate pred)
+{
+  return find_if(p, begin, end, pred);
+}
+
+}  // namespace find
+}  // namespace impl
+
+/*!
+******************************************************************************
+*
+* \brief  find first match execution pattern on a resource
+*
+* Returns the offset of the first element in [begin, end) for which pred
+* is true, or end - begin when no element matches. Unlike emulating this
+* with a full-range ReduceMin, the back-ends terminate early: iterates
+* past a published match are abandoned rather than evaluated.
+*
+* \param[in] r Resource the search runs on; the call blocks until the
+*result is available
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate applied to each element; for device
+*back-ends it must be device-callable
+*
+* \return offset of the first matching element, or end - begin
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Iter,
+          typename Predicate>
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>>
+find_if(Res& r, const ExecPolicy& p, Iter begin, Iter end, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return RAJA::detail::IterDiff<Iter>(0);
+  }
+  return impl::find::find_if(r, p, begin, end, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  find first match execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate applied to each element
+*
+* \return offset of the first matching element, or end - begin
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>>
+find_if(const ExecPolicy& p, Iter begin, Iter end, Predicate pred)
+{
+  auto r = Res::get_default();
+  return find_if(r, p, begin, end, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  find first match execution pattern over a container
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container or segment to search
+* \param[in] pred unary predicate applied to each element
+*
+* \return position of the first matching element within c, or the size of
+*c when no element matches
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<RAJA::detail::IterDiff<camp::iterator_from<Container>>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>>
+find_if(const ExecPolicy& p, const Container& c, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  auto r = Res::get_default();
+  return find_if(r, p, std::begin(c), std::end(c), pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  find first match execution pattern over a container on a resource
+*
+* \param[in] r Resource the search runs on
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container or segment to search
+* \param[in] pred unary predicate applied to each element
+*
+* \return position of the first matching element within c, or the size of
+*c when no element matches
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Predicate>
+concepts::enable_if_t<RAJA::detail::IterDiff<camp::iterator_from<Container>>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<Container>>
+find_if(Res& r, const ExecPolicy& p, const Container& c, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return find_if(r, p, std::begin(c), std::end(c), pred);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if_t<
+    decltype(find_if(ExecPolicy{}, camp::val<Args>()...)),
+    type_traits::is_execution_policy<ExecPolicy>>
+find_if(Args&&... args)
+{
+  return find_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
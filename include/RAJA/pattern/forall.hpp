@@ -55,8 +55,10 @@
 #include "RAJA/config.hpp"
 
 #include <functional>
+#include <initializer_list>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
 #include "RAJA/internal/Iterators.hpp"
 
@@ -66,9 +68,12 @@
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/index/RunSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/util/CancellationToken.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Span.hpp"
 #include "RAJA/util/types.hpp"
@@ -132,6 +137,54 @@ struct CallForallIcount {
 
   const int start;
 };
+
+/*!
+ * Run a segment of an index set with the policy at position "tag" in the
+ * policy pack of a TaggedExecPolicy. Each policy runs on its own default
+ * resource, so host-bucketed and device-bucketed segments can share one
+ * set. Tags past the end of the pack run with the last policy.
+ */
+template <typename SegmentExecPolicy,
+          typename CallType,
+          typename... SegmentTypes,
+          typename LoopBody>
+RAJA_INLINE void tagged_segment_call(Index_type,
+                                     CallType&& caller,
+                                     const TypedIndexSet<SegmentTypes...>& iset,
+                                     int segID,
+                                     const LoopBody& loop_body)
+{
+  auto r = resources::get_resource<SegmentExecPolicy>::type::get_default();
+  iset.segmentCall(segID,
+                   std::forward<CallType>(caller),
+                   SegmentExecPolicy(),
+                   loop_body,
+                   r);
+}
+
+template <typename SegmentExecPolicy,
+          typename SegmentExecPolicyNext,
+          typename... SegmentExecPolicyRest,
+          typename CallType,
+          typename... SegmentTypes,
+          typename LoopBody>
+RAJA_INLINE void tagged_segment_call(Index_type tag,
+                                     CallType&& caller,
+                                     const TypedIndexSet<SegmentTypes...>& iset,
+                                     int segID,
+                                     const LoopBody& loop_body)
+{
+  if (tag <= 0) {
+    tagged_segment_call<SegmentExecPolicy>(tag,
+                                           std::forward<CallType>(caller),
+                                           iset,
+                                           segID,
+                                           loop_body);
+  } else {
+    tagged_segment_call<SegmentExecPolicyNext, SegmentExecPolicyRest...>(
+        tag - 1, std::forward<CallType>(caller), iset, segID, loop_body);
+  }
+}
 }  // namespace detail
 
 /*!
@@ -247,6 +300,65 @@ RAJA_INLINE resources::EventProxy<Res> forall(Res &r,
   return RAJA::resources::EventProxy<Res>(&r);
 }
 
+/*!
+******************************************************************************
+*
+* \brief Execute segments with per-segment execution policy selection.
+*
+*        Each segment runs with the policy at the position given by its
+*        exec tag in the TaggedExecPolicy policy list (see
+*        TypedIndexSet::setSegmentExecTag()), so e.g. tiny segments can
+*        be bucketed onto a sequential policy while large segments keep
+*        a parallel one, without splitting the set by hand.
+*
+******************************************************************************
+*/
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename... SegmentExecPolicies,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res& r,
+                                                TaggedExecPolicy<SegmentIterPolicy,
+                                                SegmentExecPolicies...>,
+                                                const TypedIndexSet<SegmentTypes...>& iset,
+                                                LoopBody loop_body)
+{
+  auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
+  wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=](int segID) {
+    detail::tagged_segment_call<SegmentExecPolicies...>(
+        iset.getSegmentExecTag(segID),
+        detail::CallForallIcount(iset.getStartingIcount(segID)),
+        iset,
+        segID,
+        loop_body);
+  });
+  return RAJA::resources::EventProxy<Res>(&r);
+}
+
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename... SegmentExecPolicies,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall(Res &r,
+                                         TaggedExecPolicy<SegmentIterPolicy,
+                                         SegmentExecPolicies...>,
+                                         const TypedIndexSet<SegmentTypes...>& iset,
+                                         LoopBody loop_body)
+{
+  auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
+  wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=](int segID) {
+    detail::tagged_segment_call<SegmentExecPolicies...>(
+        iset.getSegmentExecTag(segID),
+        detail::CallForall{},
+        iset,
+        segID,
+        loop_body);
+  });
+  return RAJA::resources::EventProxy<Res>(&r);
+}
+
 }  // end namespace wrap
 
 
@@ -380,7 +492,7 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 
   auto r = Res::get_default();
 
-  // plugins handled in multipolicy policy_invoker
+  // plugins handled in multipolicy policy_dispatcher
   forall_impl(r,
               std::forward<ExecutionPolicy>(p),
               std::forward<Container>(c),
@@ -507,6 +619,40 @@ forall(ExecutionPolicy&& p, Res &r, Container&& c, LoopBody&& loop_body)
   return e;
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over run-length-encoded segments.
+ *
+ * Walks the runs of a TypedRunSegment as contiguous ranges, so the inner
+ * loop is unit stride and vectorizable instead of gathering through an
+ * explicit index array. Parallelism is over runs; iteration order within
+ * each run (and across runs for sequential policies) matches the order of
+ * the encoded index array.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename T, typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type>
+RAJA_INLINE resources::EventProxy<Res> forall(ExecutionPolicy&& p,
+                                              const TypedRunSegment<T>& seg,
+                                              LoopBody&& loop_body)
+{
+  using Run = typename TypedRunSegment<T>::Run;
+
+  auto body = loop_body;
+  return forall(std::forward<ExecutionPolicy>(p),
+                seg.getRuns(),
+                [=] RAJA_HOST_DEVICE(Run run) {
+                  RAJA_SIMD
+                  for (T i = run.begin;
+                       i < static_cast<T>(run.begin + run.length);
+                       ++i) {
+                    body(i);
+                  }
+                });
+}
+
 }  // end inline namespace policy_by_value_interface
 
 
@@ -547,6 +693,252 @@ RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>, type_traits::is_re
   return policy_by_value_interface::forall_Icount(ExecutionPolicy(), r, std::forward<Args>(args)...);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Execute index set segments distributed across multiple
+ *         resources in one call.
+ *
+ * Segment number isi runs via SegmentExecPolicy on res[isi % num_res],
+ * so a set sharded over e.g. four device resources executes on four
+ * streams (or four GPUs, when each resource was constructed on its own
+ * device) from a single call. All launches are asynchronous on their
+ * resources; wait on the resources to synchronize.
+ *
+ ******************************************************************************
+ */
+template <typename SegmentExecPolicy,
+          typename RESOURCE,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE void forall_multi_resource(const TypedIndexSet<SegmentTypes...>& iset,
+                                       std::vector<RESOURCE> res,
+                                       LoopBody&& loop_body)
+{
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+  const int num_res = static_cast<int>(res.size());
+
+  for (int isi = 0; isi < num_seg; ++isi) {
+    iset.segmentCall(isi,
+                     detail::CallForall{},
+                     SegmentExecPolicy(),
+                     loop_body,
+                     res[isi % num_res]);
+  }
+}
+
+//! brace-initializer form: forall_multi_resource<pol>(iset, {r0, r1}, body)
+template <typename SegmentExecPolicy,
+          typename RESOURCE,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE void forall_multi_resource(const TypedIndexSet<SegmentTypes...>& iset,
+                                       std::initializer_list<RESOURCE> res,
+                                       LoopBody&& loop_body)
+{
+  forall_multi_resource<SegmentExecPolicy>(iset,
+                                           std::vector<RESOURCE>(res),
+                                           std::forward<LoopBody>(loop_body));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Dependence-driven index set execution distributed across
+ *         multiple resources.
+ *
+ * Segments are assigned to resources as in the independent form, and
+ * the dependences recorded in the DepGraph (one node per segment) are
+ * enforced with inter-stream event waits: before a segment is issued,
+ * its resource waits on the completion events of its predecessors that
+ * ran on other resources, while same-resource predecessors are already
+ * stream-ordered. The host only issues launches, in an order driven by
+ * the graph's semaphores, so cross-device ordering is enforced on the
+ * devices without host synchronization. The graph's semaphores are
+ * reloaded on entry, so one graph can drive a traversal per timestep.
+ *
+ * The call returns with work potentially in flight on the resources;
+ * wait on them to synchronize.
+ *
+ ******************************************************************************
+ */
+template <typename SegmentExecPolicy,
+          typename RESOURCE,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE void forall_multi_resource(const TypedIndexSet<SegmentTypes...>& iset,
+                                       DepGraph& graph,
+                                       std::vector<RESOURCE> res,
+                                       LoopBody&& loop_body)
+{
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+  const int num_res = static_cast<int>(res.size());
+
+  graph.reset();
+
+  //
+  // Invert the graph's forward edges into per-segment predecessor lists
+  //
+  std::vector<std::vector<int>> preds(num_seg);
+  for (int isi = 0; isi < num_seg; ++isi) {
+    DepGraphNode& node = graph.node(isi);
+    for (int ii = 0; ii < node.numDepTasks(); ++ii) {
+      preds[node.depTaskNum(ii)].push_back(isi);
+    }
+  }
+
+  //
+  // Completion events, recorded as segments are issued; a predecessor is
+  // always issued before its successors become ready, so its slot is
+  // valid when waited on
+  //
+  std::vector<resources::Event> events;
+  events.reserve(num_seg);
+  std::vector<int> event_slot(num_seg, -1);
+
+  //
+  // Seed the worklist with the segments that start with no unsatisfied
+  // dependences
+  //
+  std::vector<int> ready;
+  for (int isi = 0; isi < num_seg; ++isi) {
+    if (graph.node(isi).semaphoreValue() == 0) {
+      ready.push_back(isi);
+    }
+  }
+
+  int num_issued = 0;
+  while (!ready.empty()) {
+    const int isi = ready.back();
+    ready.pop_back();
+
+    RESOURCE& r = res[isi % num_res];
+
+    // order this segment behind predecessors issued to other resources
+    for (int pred : preds[isi]) {
+      if (pred % num_res != isi % num_res) {
+        r.wait_for(&events[event_slot[pred]]);
+      }
+    }
+
+    iset.segmentCall(isi,
+                     detail::CallForall{},
+                     SegmentExecPolicy(),
+                     loop_body,
+                     r);
+
+    events.push_back(r.get_event());
+    event_slot[isi] = static_cast<int>(events.size()) - 1;
+    ++num_issued;
+
+    DepGraphNode& task = graph.node(isi);
+    for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+      const int successor = task.depTaskNum(ii);
+      if (graph.node(successor).satisfyOne()) {
+        ready.push_back(successor);
+      }
+    }
+  }
+
+  if (num_issued != num_seg) {
+    RAJA_ABORT_OR_THROW("forall_multi_resource: dependence graph has a cycle\n");
+  }
+}
+
+//! brace-initializer form of the dependence-driven traversal
+template <typename SegmentExecPolicy,
+          typename RESOURCE,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE void forall_multi_resource(const TypedIndexSet<SegmentTypes...>& iset,
+                                       DepGraph& graph,
+                                       std::initializer_list<RESOURCE> res,
+                                       LoopBody&& loop_body)
+{
+  forall_multi_resource<SegmentExecPolicy>(iset,
+                                           graph,
+                                           std::vector<RESOURCE>(res),
+                                           std::forward<LoopBody>(loop_body));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Cancellable forall: execute in chunks, polling a token.
+ *
+ * The iteration space is executed chunk_size iterations at a time, with
+ * the CancellationToken checked before each chunk is issued and each
+ * chunk run to completion on the policy's default resource before the
+ * next check. This gives a guaranteed-progress contract in both
+ * directions: iterations that ran are never re-run or torn (chunks are
+ * whole), and after cancel() is raised at most one chunk of work is
+ * still issued, so the latency to yield is bounded by one chunk --
+ * size chunks for the worst-case body cost instead of tuning priorities
+ * or oversubscribing.
+ *
+ * Intended for low-priority work (e.g. in-situ analysis) that must
+ * surrender the device to the simulation on request; the canceled loop
+ * can later be resumed from the returned count by passing a segment
+ * sliced past the completed prefix.
+ *
+ * \param token cancellation token to poll between chunks
+ * \param c iterable of items to supply to body
+ * \param loop_body functor, receives each value produced by iterable c;
+ * must be host-device capturable for device policies
+ * \param chunk_size iterations per chunk, the poll granularity; both
+ * yield latency and per-chunk launch overhead scale with it
+ *
+ * \return the number of iterations completed (a whole number of chunks,
+ * or the full length); equal to the length iff the loop was not canceled
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<Index_type,
+                                  type_traits::is_range<Container>>
+forall_cancellable(CancellationToken const& token,
+                   Container&& c,
+                   LoopBody&& loop_body,
+                   Index_type chunk_size = 4096)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  using Res = typename resources::get_resource<ExecutionPolicy>::type;
+  using ValueType = camp::decay<decltype(*std::begin(c))>;
+
+  auto begin = std::begin(c);
+  const Index_type len =
+      static_cast<Index_type>(std::distance(begin, std::end(c)));
+  if (chunk_size < 1) {
+    chunk_size = 1;
+  }
+
+  auto r = Res::get_default();
+
+  Index_type completed = 0;
+  while (completed < len) {
+    if (token.canceled()) {
+      break;
+    }
+    const Index_type chunk_end =
+        (completed + chunk_size < len) ? completed + chunk_size : len;
+
+    forall<ExecutionPolicy>(r,
+                            TypedRangeSegment<Index_type>(completed,
+                                                          chunk_end),
+                            [=] RAJA_HOST_DEVICE(Index_type i) {
+                              loop_body(begin[i]);
+                            });
+    // run the chunk to completion so the next poll bounds in-flight work
+    r.wait();
+
+    completed = chunk_end;
+  }
+
+  return completed;
+}
+
 namespace detail
 {
 
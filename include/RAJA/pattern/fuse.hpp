@@ -0,0 +1,133 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file providing the fuse pattern, which executes a
+ *          sequence of loop bodies per iterate of a single traversal.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_fuse_HPP
+#define RAJA_pattern_fuse_HPP
+
+#include "RAJA/config.hpp"
+
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/concepts.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Loop body that invokes a sequence of loop bodies, in order, on
+ *         each iterate. Used by RAJA::fuse.
+ *
+ ******************************************************************************
+ */
+template <typename... Bodies>
+struct FusedBody {
+
+  camp::tuple<Bodies...> bodies;
+
+  template <typename Index>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index i) const
+  {
+    invoke_bodies(i, camp::make_idx_seq_t<sizeof...(Bodies)>{});
+  }
+
+private:
+  template <typename Index, camp::idx_t... Is>
+  RAJA_HOST_DEVICE RAJA_INLINE void invoke_bodies(Index i,
+                                                  camp::idx_seq<Is...>) const
+  {
+    camp::sink((camp::get<Is>(bodies)(i), 0)...);
+  }
+};
+
+}  // end namespace detail
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Execute a sequence of loop bodies as one fused traversal of a
+ *        container.
+ *
+ * Replaces consecutive foralls over the same iteration space,
+ *
+ *   RAJA::forall<pol>(seg, body1);
+ *   RAJA::forall<pol>(seg, body2);
+ *
+ * with a single traversal that runs body1 then body2 on each iterate, so
+ * arrays produced by one body and consumed by the next are touched while
+ * still in registers or cache instead of being re-streamed from memory.
+ *
+ * Fusion changes the interleaving of iterations across bodies: body2(i)
+ * runs before body1(j) for j > i (per thread under parallel policies).
+ * The caller must ensure this is legal, i.e. no body reads an element
+ * another body writes at a different index. Per-tile rather than
+ * per-element granularity falls out of the execution policy; e.g.
+ * omp_for_tiled_exec fuses at tile granularity.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Container,
+          typename... LoopBodies,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type>
+RAJA_INLINE resources::EventProxy<Res> fuse(Container&& c,
+                                            LoopBodies&&... loop_bodies)
+{
+  detail::FusedBody<camp::decay<LoopBodies>...> body{
+      camp::make_tuple(std::forward<LoopBodies>(loop_bodies)...)};
+
+  return forall<ExecutionPolicy>(std::forward<Container>(c), std::move(body));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Execute a sequence of loop bodies as one fused traversal of a
+ *        container, on a specific resource.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename... LoopBodies>
+RAJA_INLINE resources::EventProxy<Res> fuse(Res& r,
+                                            Container&& c,
+                                            LoopBodies&&... loop_bodies)
+{
+  detail::FusedBody<camp::decay<LoopBodies>...> body{
+      camp::make_tuple(std::forward<LoopBodies>(loop_bodies)...)};
+
+  return forall<ExecutionPolicy>(r,
+                                 std::forward<Container>(c),
+                                 std::move(body));
+}
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
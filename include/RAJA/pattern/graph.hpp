@@ -0,0 +1,161 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file providing an experimental dependency-graph
+ *          interface for composing asynchronous loop executions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_graph_HPP
+#define RAJA_graph_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Dependency graph over asynchronous loop executions.
+ *
+ * Nodes are callables that launch work on a resource and return the
+ * event tracking that work (forall, kernel, and scan calls with their
+ * Resource overloads all fit); edges are explicit and declare that one
+ * node's work must complete before another's begins.  exec() lowers the
+ * graph onto a pool of resources: independent nodes land on different
+ * resources (streams, on device back-ends) and may overlap, while each
+ * edge becomes a device-side event wait, so the host never blocks
+ * between nodes.  With Host resources execution degrades to ordered
+ * synchronous execution, which is always a valid schedule of the graph.
+ *
+ * Nodes must be added in a topological order: edges may only point from
+ * an earlier node to a later one.  A graph may be executed repeatedly.
+ *
+ * Usage example:
+ *
+ * \code
+ *
+ *  RAJA::expt::Graph<RAJA::resources::Cuda> graph;
+ *
+ *  auto a = graph.forall<pol>(range, [=] RAJA_DEVICE (int i) {...});
+ *  auto b = graph.forall<pol>(range, [=] RAJA_DEVICE (int i) {...});
+ *  auto c = graph.add_node([=](RAJA::resources::Cuda& r) {
+ *    return RAJA::inclusive_scan<pol>(r, in, in + n, out);
+ *  });
+ *
+ *  graph.add_edge(a, c);  // c reads what a wrote
+ *  graph.add_edge(b, c);
+ *
+ *  graph.exec();
+ *  graph.wait();
+ *
+ * \endcode
+ *
+ ******************************************************************************
+ */
+template <typename Resource>
+class Graph
+{
+public:
+  using node_id = size_t;
+
+  explicit Graph(size_t num_resources = 4) : m_pool(num_resources) {}
+
+  //! Add a node from a callable taking the graph's resource type and
+  //  returning the event for the work it launches
+  template <typename NodeBody>
+  node_id add_node(NodeBody&& body)
+  {
+    m_nodes.emplace_back(
+        new Node<camp::decay<NodeBody>>(std::forward<NodeBody>(body)));
+    return m_nodes.size() - 1;
+  }
+
+  //! Convenience node wrapping a forall on the graph's resource
+  template <typename ExecPolicy, typename Segment, typename LoopBody>
+  node_id forall(Segment&& segment, LoopBody&& loop_body)
+  {
+    auto seg = std::forward<Segment>(segment);
+    auto body = std::forward<LoopBody>(loop_body);
+    return add_node([=](Resource& r) -> resources::Event {
+      return RAJA::forall<ExecPolicy>(r, seg, body);
+    });
+  }
+
+  //! Declare that node before must complete before node after begins
+  void add_edge(node_id before, node_id after)
+  {
+    if (!(before < after && after < m_nodes.size())) {
+      RAJA_ABORT_OR_THROW(
+          "Graph edges must point from an earlier node to a later one\n");
+    }
+    m_nodes[after]->deps.push_back(before);
+  }
+
+  //! Launch every node, ordering each behind its dependencies' events
+  void exec()
+  {
+    m_events.clear();
+    m_events.reserve(m_nodes.size());
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+      Resource& r = m_pool.get();
+      for (node_id dep : m_nodes[i]->deps) {
+        r.wait_for(&m_events[dep]);
+      }
+      m_events.push_back(m_nodes[i]->exec(r));
+    }
+  }
+
+  //! Block until all work launched by exec() completes
+  void wait() { m_pool.wait(); }
+
+  //! Number of nodes in the graph
+  size_t size() const { return m_nodes.size(); }
+
+private:
+  struct NodeBase {
+    virtual ~NodeBase() = default;
+    virtual resources::Event exec(Resource& r) = 0;
+    std::vector<node_id> deps;
+  };
+
+  template <typename Body>
+  struct Node : NodeBase {
+    explicit Node(Body const& body_) : body(body_) {}
+    resources::Event exec(Resource& r) override { return body(r); }
+    Body body;
+  };
+
+  std::vector<std::unique_ptr<NodeBase>> m_nodes;
+  std::vector<resources::Event> m_events;
+  resources::ResourcePool<Resource> m_pool;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,265 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file providing an experimental halo-exchange
+ *          pattern built on the workgroup constructs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_halo_exchange_HPP
+#define RAJA_halo_exchange_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "RAJA/internal/get_platform.hpp"
+#include "RAJA/pattern/WorkGroup.hpp"
+#include "RAJA/pattern/synchronize.hpp"
+#include "RAJA/util/camp_aliases.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include "RAJA/policy/cuda/policy.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include "RAJA/policy/hip/policy.hpp"
+#endif
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+/*!
+ * Block until pack/unpack kernels launched with an asynchronous workgroup
+ * exec policy have completed. Host back-ends run loops synchronously so
+ * the generic case is a no-op.
+ */
+template <Platform platform>
+struct HaloExchangeSync {
+  static void synchronize() {}
+};
+
+#if defined(RAJA_ENABLE_CUDA)
+template <>
+struct HaloExchangeSync<Platform::cuda> {
+  static void synchronize() { RAJA::synchronize<RAJA::cuda_synchronize>(); }
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+template <>
+struct HaloExchangeSync<Platform::hip> {
+  static void synchronize() { RAJA::synchronize<RAJA::hip_synchronize>(); }
+};
+#endif
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent halo-exchange communication plan built on workgroups.
+ *
+ * A plan owns one pack and one unpack workgroup per neighbor. The loops
+ * that gather into and scatter out of each neighbor's message buffer are
+ * enqueued once, instantiated once via finalize, and the instantiated
+ * workgroups are reused every timestep, so capture and vtable setup costs
+ * are not paid on the exchange's critical path.
+ *
+ * The plan does not perform communication itself; the caller supplies a
+ * callable that sends a packed buffer and a callable that waits for the
+ * next received buffer, so any transport (MPI point-to-point, NCCL, shared
+ * memory) can be used. pack_and_send software-pipelines the two: with an
+ * asynchronous workgroup exec policy the pack kernel for neighbor n runs
+ * on the device while the host sends neighbor n-1's buffer. Likewise
+ * recv_and_unpack launches each neighbor's unpack as soon as its receive
+ * completes, overlapping the scatter with waiting on later receives.
+ *
+ * Usage example:
+ *
+ * \code
+ *
+ *  using workgroup_policy = RAJA::WorkGroupPolicy<
+ *      RAJA::cuda_work_async<256>, RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+ *      RAJA::constant_stride_array_of_objects>;
+ *
+ *  RAJA::expt::HaloExchangePlan<workgroup_policy, int, allocator_type>
+ *      plan(num_neighbors, allocator);
+ *
+ *  for (int n = 0; n < num_neighbors; ++n) {
+ *    plan.enqueue_pack(n, pack_list[n], [=] RAJA_DEVICE (int i) {
+ *      buffer[n][i] = var[pack_index[n][i]];
+ *    });
+ *    plan.enqueue_unpack(n, unpack_list[n], [=] RAJA_DEVICE (int i) {
+ *      var[unpack_index[n][i]] = buffer[n][i];
+ *    });
+ *  }
+ *  plan.finalize();
+ *
+ *  for (int step = 0; step < num_steps; ++step) {
+ *    // post receives, e.g. MPI_Irecv per neighbor
+ *    plan.pack_and_send([&](int n) {
+ *      MPI_Isend(buffer[n], ...);       // buffer n is packed
+ *    });
+ *    plan.recv_and_unpack([&]() {
+ *      int n;
+ *      MPI_Waitany(num_neighbors, recv_requests, &n, MPI_STATUS_IGNORE);
+ *      return n;                        // buffer n has arrived
+ *    });
+ *  }
+ *
+ * \endcode
+ *
+ ******************************************************************************
+ */
+template <typename WORKGROUP_POLICY_T,
+          typename INDEX_T,
+          typename ALLOCATOR_T>
+struct HaloExchangePlan
+{
+  using policy = WORKGROUP_POLICY_T;
+  using index_type = INDEX_T;
+  using Allocator = ALLOCATOR_T;
+
+  using workpool_type = WorkPool<policy, index_type, xargs<>, Allocator>;
+  using workgroup_type = WorkGroup<policy, index_type, xargs<>, Allocator>;
+  using worksite_type = WorkSite<policy, index_type, xargs<>, Allocator>;
+
+  using exec_policy = typename workpool_type::exec_policy;
+
+  HaloExchangePlan(size_t num_neighbors, Allocator const& aloc)
+    : m_num_neighbors(num_neighbors)
+  {
+    m_pack_pools.reserve(num_neighbors);
+    m_unpack_pools.reserve(num_neighbors);
+    for (size_t n = 0; n < num_neighbors; ++n) {
+      m_pack_pools.emplace_back(aloc);
+      m_unpack_pools.emplace_back(aloc);
+    }
+  }
+
+  HaloExchangePlan(HaloExchangePlan const&) = delete;
+  HaloExchangePlan& operator=(HaloExchangePlan const&) = delete;
+
+  HaloExchangePlan(HaloExchangePlan&&) = default;
+  HaloExchangePlan& operator=(HaloExchangePlan&&) = default;
+
+  size_t num_neighbors() const
+  {
+    return m_num_neighbors;
+  }
+
+  //! Enqueue a loop that packs values into neighbor's message buffer
+  template <typename segment_T, typename loop_T>
+  void enqueue_pack(size_t neighbor, segment_T&& seg, loop_T&& loop_body)
+  {
+    m_pack_pools[neighbor].enqueue(std::forward<segment_T>(seg),
+                                   std::forward<loop_T>(loop_body));
+  }
+
+  //! Enqueue a loop that unpacks neighbor's message buffer
+  template <typename segment_T, typename loop_T>
+  void enqueue_unpack(size_t neighbor, segment_T&& seg, loop_T&& loop_body)
+  {
+    m_unpack_pools[neighbor].enqueue(std::forward<segment_T>(seg),
+                                     std::forward<loop_T>(loop_body));
+  }
+
+  /*!
+   * Instantiate the per-neighbor workgroups from the enqueued loops.
+   * Call once after all enqueues; the workgroups persist and are run
+   * by every subsequent pack_and_send and recv_and_unpack call.
+   */
+  void finalize()
+  {
+    m_pack_groups.reserve(m_num_neighbors);
+    m_unpack_groups.reserve(m_num_neighbors);
+    for (size_t n = 0; n < m_num_neighbors; ++n) {
+      m_pack_groups.emplace_back(m_pack_pools[n].instantiate());
+      m_unpack_groups.emplace_back(m_unpack_pools[n].instantiate());
+    }
+  }
+
+  /*!
+   * Pack each neighbor's buffer and hand it to send when complete.
+   *
+   * send is called as send(n) once neighbor n's pack loops are done and
+   * its buffer may be given to the transport layer. With an asynchronous
+   * workgroup exec policy the pack of neighbor n runs on the device while
+   * send(n-1) runs on the host.
+   */
+  template <typename send_T>
+  void pack_and_send(send_T&& send)
+  {
+    m_sites.clear();
+    if (m_num_neighbors == 0) {
+      return;
+    }
+    m_sites.emplace_back(m_pack_groups[0].run());
+    synchronize();
+    for (size_t n = 1; n < m_num_neighbors; ++n) {
+      m_sites.emplace_back(m_pack_groups[n].run());
+      send(n - 1);
+      synchronize();
+    }
+    send(m_num_neighbors - 1);
+  }
+
+  /*!
+   * Unpack each neighbor's buffer as its receive completes.
+   *
+   * recv_ready is called m_num_neighbors times and returns the index of
+   * a neighbor whose buffer has arrived (e.g. from MPI_Waitany); that
+   * neighbor's unpack loops are launched immediately so unpacking
+   * overlaps waiting for the remaining receives. All unpack loops have
+   * completed when this call returns.
+   */
+  template <typename recv_ready_T>
+  void recv_and_unpack(recv_ready_T&& recv_ready)
+  {
+    m_sites.clear();
+    for (size_t k = 0; k < m_num_neighbors; ++k) {
+      size_t n = recv_ready();
+      m_sites.emplace_back(m_unpack_groups[n].run());
+    }
+    synchronize();
+  }
+
+private:
+  static void synchronize()
+  {
+    detail::HaloExchangeSync<
+        RAJA::detail::get_platform<exec_policy>::value>::synchronize();
+  }
+
+  size_t m_num_neighbors;
+  std::vector<workpool_type> m_pack_pools;
+  std::vector<workpool_type> m_unpack_pools;
+  std::vector<workgroup_type> m_pack_groups;
+  std::vector<workgroup_type> m_unpack_groups;
+  std::vector<worksite_type> m_sites;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -28,6 +28,7 @@
 #include "camp/tuple.hpp"
 
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/kernel/internal.hpp"
@@ -99,10 +100,13 @@ RAJA_INLINE constexpr auto make_wrapped_tuple(Tuple &&t)
 template <typename PolicyType,
           typename SegmentTuple,
           typename ParamTuple,
+          typename Resource,
           typename... Bodies>
-RAJA_INLINE void kernel_param(SegmentTuple &&segments,
-                              ParamTuple &&params,
-                              Bodies &&... bodies)
+RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(
+    SegmentTuple &&segments,
+    ParamTuple &&params,
+    Resource &resource,
+    Bodies &&... bodies)
 {
   util::PluginContext context{util::make_context<PolicyType>()};
 
@@ -119,6 +123,7 @@ RAJA_INLINE void kernel_param(SegmentTuple &&segments,
 
   using loop_data_t = internal::LoopData<segment_tuple_t,
                                          param_tuple_t,
+                                         Resource,
                                          camp::decay<Bodies>...>;
 
 
@@ -131,6 +136,7 @@ RAJA_INLINE void kernel_param(SegmentTuple &&segments,
   loop_data_t loop_data(make_wrapped_tuple(
                             std::forward<SegmentTuple>(segments)),
                         std::forward<ParamTuple>(params),
+                        resource,
                         std::forward<Bodies>(bodies)...);
 
   util::callPostCapturePlugins(context);
@@ -144,14 +150,169 @@ RAJA_INLINE void kernel_param(SegmentTuple &&segments,
   internal::execute_statement_list<PolicyType, loop_types_t>(loop_data);
 
   util::callPostLaunchPlugins(context);
+
+  return resources::EventProxy<Resource>(&resource);
+}
+
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename Resource,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Resource> kernel_resource(
+    SegmentTuple &&segments,
+    Resource &resource,
+    Bodies &&... bodies)
+{
+  return RAJA::kernel_param_resource<PolicyType>(
+      std::forward<SegmentTuple>(segments),
+      RAJA::make_tuple(),
+      resource,
+      std::forward<Bodies>(bodies)...);
+}
+
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename... Bodies>
+RAJA_INLINE void kernel_param(SegmentTuple &&segments,
+                              ParamTuple &&params,
+                              Bodies &&... bodies)
+{
+  auto res = resources::Host::get_default();
+  RAJA::kernel_param_resource<PolicyType>(
+      std::forward<SegmentTuple>(segments),
+      std::forward<ParamTuple>(params),
+      res,
+      std::forward<Bodies>(bodies)...);
 }
 
 template <typename PolicyType, typename SegmentTuple, typename... Bodies>
 RAJA_INLINE void kernel(SegmentTuple &&segments, Bodies &&... bodies)
 {
-  RAJA::kernel_param<PolicyType>(std::forward<SegmentTuple>(segments),
-                                 RAJA::make_tuple(),
-                                 std::forward<Bodies>(bodies)...);
+  auto res = resources::Host::get_default();
+  RAJA::kernel_resource<PolicyType>(std::forward<SegmentTuple>(segments),
+                                    res,
+                                    std::forward<Bodies>(bodies)...);
+}
+
+
+/*!
+ * A reusable, pre-resolved kernel object returned by RAJA::make_kernel.
+ *
+ * The policy tree is frozen in the type and the loop bodies and
+ * parameter tuple are captured once at construction, where the plugin
+ * capture hooks also run once. Each run() then only copies the stored
+ * bodies into the per-launch LoopData and fires the launch hooks,
+ * analogous to how WorkGroup caches WorkStructs and replays them, so
+ * kernels sitting in 10^6-iteration driver loops do not repeat the
+ * capture ceremony per call.
+ */
+template <typename PolicyType, typename ParamTuple, typename... Bodies>
+struct KernelObject
+{
+  using policy_t = PolicyType;
+
+  ParamTuple m_params;
+  camp::tuple<Bodies...> m_bodies;
+
+  /*!
+   * Run the kernel over the given segment tuple on a resource.
+   */
+  template <typename SegmentTuple, typename Resource>
+  RAJA_INLINE resources::EventProxy<Resource> run_resource(
+      SegmentTuple &&segments,
+      Resource &resource) const
+  {
+    return run_impl(std::forward<SegmentTuple>(segments),
+                    resource,
+                    camp::make_idx_seq_t<sizeof...(Bodies)>{});
+  }
+
+  /*!
+   * Run the kernel over the given segment tuple on the default Host
+   * resource.
+   */
+  template <typename SegmentTuple>
+  RAJA_INLINE void run(SegmentTuple &&segments) const
+  {
+    auto res = resources::Host::get_default();
+    run_resource(std::forward<SegmentTuple>(segments), res);
+  }
+
+private:
+  template <typename SegmentTuple, typename Resource, camp::idx_t... Is>
+  RAJA_INLINE resources::EventProxy<Resource> run_impl(
+      SegmentTuple &&segments,
+      Resource &resource,
+      camp::idx_seq<Is...>) const
+  {
+    util::PluginContext context{util::make_context<PolicyType>()};
+
+    using segment_tuple_t =
+        typename IterableWrapperTuple<camp::decay<SegmentTuple>>::type;
+
+    using param_tuple_t = camp::decay<ParamTuple>;
+
+    using loop_data_t = internal::
+        LoopData<segment_tuple_t, param_tuple_t, Resource, Bodies...>;
+
+    // the bodies were captured when the kernel object was built, so no
+    // capture plugins run here; only the per-launch hooks fire
+    loop_data_t loop_data(
+        make_wrapped_tuple(std::forward<SegmentTuple>(segments)),
+        m_params,
+        resource,
+        camp::get<Is>(m_bodies)...);
+
+    using loop_types_t = internal::makeInitialLoopTypes<loop_data_t>;
+
+    util::callPreLaunchPlugins(context);
+
+    RAJA_FORCEINLINE_RECURSIVE
+    internal::execute_statement_list<PolicyType, loop_types_t>(loop_data);
+
+    util::callPostLaunchPlugins(context);
+
+    return resources::EventProxy<Resource>(&resource);
+  }
+};
+
+/*!
+ * Builds a reusable kernel object with a parameter tuple
+ * (compile-once launch-many form of RAJA::kernel_param).
+ *
+ * Captures the loop bodies and parameters once, running the plugin
+ * capture hooks at that point; the returned object's run() only pays
+ * per-launch costs.
+ */
+template <typename PolicyType, typename ParamTuple, typename... Bodies>
+RAJA_INLINE auto make_kernel_param(ParamTuple &&params, Bodies &&... bodies)
+    -> KernelObject<PolicyType, camp::decay<ParamTuple>, camp::decay<Bodies>...>
+{
+  util::PluginContext context{util::make_context<PolicyType>()};
+
+  util::callPreCapturePlugins(context);
+
+  KernelObject<PolicyType, camp::decay<ParamTuple>, camp::decay<Bodies>...>
+      kernel_object{std::forward<ParamTuple>(params),
+                    camp::tuple<camp::decay<Bodies>...>(
+                        std::forward<Bodies>(bodies)...)};
+
+  util::callPostCapturePlugins(context);
+
+  return kernel_object;
+}
+
+/*!
+ * Builds a reusable kernel object
+ * (compile-once launch-many form of RAJA::kernel).
+ */
+template <typename PolicyType, typename... Bodies>
+RAJA_INLINE auto make_kernel(Bodies &&... bodies)
+    -> KernelObject<PolicyType, camp::tuple<>, camp::decay<Bodies>...>
+{
+  return RAJA::make_kernel_param<PolicyType>(RAJA::make_tuple(),
+                                             std::forward<Bodies>(bodies)...);
 }
 
 
@@ -162,14 +323,20 @@ RAJA_INLINE void kernel(SegmentTuple &&segments, Bodies &&... bodies)
 #include "RAJA/pattern/kernel/Conditional.hpp"
 #include "RAJA/pattern/kernel/For.hpp"
 #include "RAJA/pattern/kernel/ForICount.hpp"
+#include "RAJA/pattern/kernel/ForUnroll.hpp"
+#include "RAJA/pattern/kernel/ForWindow.hpp"
 #include "RAJA/pattern/kernel/Hyperplane.hpp"
 #include "RAJA/pattern/kernel/InitLocalMem.hpp"
 #include "RAJA/pattern/kernel/Lambda.hpp"
+#include "RAJA/pattern/kernel/LoadStore.hpp"
 #include "RAJA/pattern/kernel/Param.hpp"
+#include "RAJA/pattern/kernel/Prefetch.hpp"
 #include "RAJA/pattern/kernel/Reduce.hpp"
 #include "RAJA/pattern/kernel/Region.hpp"
 #include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/pattern/kernel/TilePrefetch.hpp"
 #include "RAJA/pattern/kernel/TileTCount.hpp"
+#include "RAJA/pattern/kernel/TileTemporal.hpp"
 
 
 #endif /* RAJA_pattern_kernel_HPP */
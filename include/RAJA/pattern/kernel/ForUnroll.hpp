@@ -0,0 +1,120 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for statement wrappers and executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_ForUnroll_HPP
+#define RAJA_pattern_kernel_ForUnroll_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/pattern/kernel/internal.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that implements a sequential loop unrolled
+ * at compile time, UnrollN iterations at a time.
+ * Assigns the loop iterate to argument ArgumentId.
+ *
+ * The enclosed statements are expanded through an index sequence, so a
+ * loop whose segment length equals UnrollN (the component-loop case)
+ * flattens into straight-line code without the per-iteration lambda
+ * indirection statement::For<seq_exec> goes through. Lengths that are
+ * not a multiple of UnrollN run the remainder one iteration at a time.
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t UnrollN,
+          typename... EnclosedStmts>
+struct ForUnroll : public internal::ForList,
+                   public internal::ForTraitBase<ArgumentId, seq_exec>,
+                   public internal::Statement<seq_exec, EnclosedStmts...> {
+
+  static_assert(UnrollN > 0, "UnrollN must be positive");
+
+  using execution_policy_t = seq_exec;
+};
+
+
+}  // end namespace statement
+
+namespace internal
+{
+
+/*!
+ * A RAJA::kernel executor for statement::ForUnroll
+ *
+ *
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t UnrollN,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::ForUnroll<ArgumentId, UnrollN, EnclosedStmts...>, Types> {
+
+  // Set the argument type for this loop
+  template <typename Data>
+  using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+  template <typename Data, typename IndexType, camp::idx_t... Is>
+  static RAJA_INLINE void unrolled_iterations(Data &&data,
+                                              IndexType base,
+                                              camp::idx_seq<Is...>)
+  {
+    // a braced initializer list evaluates left to right, keeping the
+    // expanded iterations in loop order
+    using expander = int[];
+    (void)expander{
+        0,
+        (data.template assign_offset<ArgumentId>(
+             base + static_cast<IndexType>(Is)),
+         execute_statement_list<camp::list<EnclosedStmts...>,
+                                NewTypes<camp::decay<Data>>>(data),
+         0)...};
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    len_t i = 0;
+    for (; i + static_cast<len_t>(UnrollN) <= len;
+         i += static_cast<len_t>(UnrollN)) {
+      unrolled_iterations(data, i, camp::make_idx_seq_t<UnrollN>{});
+    }
+    for (; i < len; ++i) {
+      data.template assign_offset<ArgumentId>(i);
+      execute_statement_list<camp::list<EnclosedStmts...>,
+                             NewTypes<camp::decay<Data>>>(data);
+    }
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_pattern_kernel_ForUnroll_HPP */
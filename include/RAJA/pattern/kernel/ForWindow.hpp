@@ -0,0 +1,158 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for statement wrappers and executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_ForWindow_HPP
+#define RAJA_pattern_kernel_ForWindow_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Fixed-radius window of values centered on the current iterate of a
+ * statement::ForWindow loop, kept in registers and rotated by one
+ * element per iteration.
+ *
+ * Pass one as a kernel parameter and read it in lambdas with signed
+ * offsets: window(-1), window(0), window(1) for a radius-1 stencil.
+ * Values are only valid inside the ForWindow loop that manages the
+ * window.
+ */
+template <typename T, camp::idx_t Radius>
+struct RotatingWindow {
+
+  static_assert(Radius > 0, "Radius must be positive");
+
+  static constexpr camp::idx_t radius = Radius;
+
+  T values[2 * Radius + 1];
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  T &operator()(camp::idx_t offset) { return values[offset + Radius]; }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  T const &operator()(camp::idx_t offset) const
+  {
+    return values[offset + Radius];
+  }
+};
+
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that implements a sequential loop carrying
+ * a rotating register window over a View, for 1d stencils along the
+ * innermost loop. Assigns the loop iterate to argument ArgumentId.
+ *
+ * ViewPos and WindowPos name a View and a RotatingWindow in the kernel
+ * parameter tuple; the window's radius is taken from its type. At the
+ * first iterate the full window is loaded; every later iterate shifts
+ * the window by one and loads only the leading neighbor, so a
+ * radius-1 stencil issues one load per point instead of three. The
+ * enclosed lambdas read neighbors through the window parameter rather
+ * than re-indexing the View.
+ *
+ * The window reaches Radius elements past both ends of the segment, so
+ * the segment must cover only iterates whose neighbors are in bounds
+ * (the interior points of the usual stencil formulation).
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t ViewPos,
+          camp::idx_t WindowPos,
+          typename... EnclosedStmts>
+struct ForWindow : public internal::ForList,
+                   public internal::ForTraitBase<ArgumentId, seq_exec>,
+                   public internal::Statement<seq_exec, EnclosedStmts...> {
+
+  using execution_policy_t = seq_exec;
+};
+
+
+}  // end namespace statement
+
+namespace internal
+{
+
+/*!
+ * A RAJA::kernel executor for statement::ForWindow
+ *
+ *
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t ViewPos,
+          camp::idx_t WindowPos,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::ForWindow<ArgumentId, ViewPos, WindowPos, EnclosedStmts...>,
+    Types> {
+
+  // Set the argument type for this loop
+  template <typename Data>
+  using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    auto begin = camp::get<ArgumentId>(data.segment_tuple).begin();
+    auto len = segment_length<ArgumentId>(data);
+
+    auto &view = camp::get<ViewPos>(data.param_tuple);
+    auto &window = camp::get<WindowPos>(data.param_tuple);
+    constexpr camp::idx_t radius =
+        camp::decay<decltype(window)>::radius;
+
+    for (decltype(len) i = 0; i < len; ++i) {
+
+      if (i == 0) {
+        // prime the full window around the first iterate
+        for (camp::idx_t k = -radius; k <= radius; ++k) {
+          window(k) = view(*begin + k);
+        }
+      } else {
+        // rotate the window and load only the leading neighbor
+        for (camp::idx_t k = -radius; k < radius; ++k) {
+          window(k) = window(k + 1);
+        }
+        window(radius) = view(*(begin + i) + radius);
+      }
+
+      data.template assign_offset<ArgumentId>(i);
+      execute_statement_list<camp::list<EnclosedStmts...>,
+                             NewTypes<camp::decay<Data>>>(data);
+    }
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_pattern_kernel_ForWindow_HPP */
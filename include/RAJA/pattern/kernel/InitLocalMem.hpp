@@ -53,6 +53,26 @@ struct InitLocalMem<RAJA::cpu_tile_mem, camp::idx_seq<Indices...>, EnclosedStmts
 };
 
 
+/*!
+ * Kernel statement that swaps the backing storage of two local arrays
+ * initialized by an enclosing InitLocalMem statement.
+ *
+ * Placing this at the bottom of a tiling loop implements double
+ * buffering: one array is the compute buffer for the current tile while
+ * the other is loaded with the next tile, and the swap flips their roles
+ * each iteration so only one synchronization per tile is needed between
+ * the load and the compute that consumes it.
+ *
+ * For example:
+ * SwapLocalMem<0, 1>
+ * Will exchange the storage of the 0th and 1st arrays in the param
+ * tuple. Both arrays must have the same element type and size.
+ */
+template<camp::idx_t Pos0, camp::idx_t Pos1>
+struct SwapLocalMem : public internal::Statement<camp::nil> {
+};
+
+
 }  // end namespace statement
 
 namespace internal
@@ -76,8 +96,9 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
   {
     using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::element_t;
     const camp::idx_t NumElem = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::NumElem;
-    
-    varType Array[NumElem];
+    const camp::idx_t Alignment = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::Alignment;
+
+    alignas(Alignment) varType Array[NumElem];
     camp::get<Pos>(data.param_tuple).m_arrayPtr = Array;
     initMem<others...>(data);
   }
@@ -106,6 +127,30 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
 };
 
 
+//Statement executor to swap the storage of two RAJA local arrays
+template<camp::idx_t Pos0, camp::idx_t Pos1, typename Types>
+struct StatementExecutor<statement::SwapLocalMem<Pos0, Pos1>, Types>{
+
+  template<typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using array0_t = camp::tuple_element_t<Pos0, typename camp::decay<Data>::param_tuple_t>;
+    using array1_t = camp::tuple_element_t<Pos1, typename camp::decay<Data>::param_tuple_t>;
+    static_assert(std::is_same<typename array0_t::element_t,
+                               typename array1_t::element_t>::value,
+                  "SwapLocalMem arrays must have the same element type");
+    static_assert(array0_t::NumElem == array1_t::NumElem,
+                  "SwapLocalMem arrays must have the same size");
+
+    auto tmp = camp::get<Pos0>(data.param_tuple).m_arrayPtr;
+    camp::get<Pos0>(data.param_tuple).m_arrayPtr =
+        camp::get<Pos1>(data.param_tuple).m_arrayPtr;
+    camp::get<Pos1>(data.param_tuple).m_arrayPtr = tmp;
+  }
+
+};
+
+
 }  // namespace internal
 }  // end namespace RAJA
 
@@ -123,6 +123,32 @@ struct Lambda : internal::Statement<camp::nil> {
   static const camp::idx_t loop_body_index = BodyIdx;
 };
 
+/*!
+ * A RAJA::kernel statement that invokes a lambda function compiled as a
+ * separate, non-inlined function.
+ *
+ * Used to fission a large kernel at statement boundaries: each
+ * FissionLambda body gets its own register allocation instead of
+ * inflating the register count of the enclosing kernel, while tile
+ * state staged through parameters stays reachable across the boundary.
+ *
+ * The Segs<>, Offsets<>, Params<> and ValuesT<> arguments declare the
+ * interface passed into the function; only those values cross the call
+ * boundary (parameters by reference, everything else by value), so the
+ * lambda's working set is explicit in the policy.
+ *
+ * for example:
+ * using Pol = KernelPolicy<
+ *   statement::For<0, exec,
+ *     statement::FissionLambda<0, Segs<0>, Params<0>>,
+ *     statement::FissionLambda<1, Segs<0>, Params<0>>>>;
+ *
+ */
+template <camp::idx_t BodyIdx, typename... Args >
+struct FissionLambda : internal::Statement<camp::nil> {
+  static const camp::idx_t loop_body_index = BodyIdx;
+};
+
 }  // end namespace statement
 
 namespace internal
@@ -288,6 +314,97 @@ struct StatementExecutor<statement::Lambda<LambdaIndex, Args...>, Types> {
   }
 };
 
+
+//Out-of-line call boundary for FissionLambda: the extracted argument
+//values are the only state crossing it, so the compiler allocates the
+//lambda body's registers independently of the enclosing kernel
+RAJA_SUPPRESS_HD_WARN
+template<typename Body, typename... Ts>
+RAJA_NO_INLINE RAJA_HOST_DEVICE void invoke_lambda_out_of_line(Body &&body,
+                                                               Ts &&... args)
+{
+  std::forward<Body>(body)(std::forward<Ts>(args)...);
+}
+
+
+RAJA_SUPPRESS_HD_WARN
+template <camp::idx_t LoopIndex,
+          typename Types,
+          camp::idx_t... OffsetIdx,
+          camp::idx_t... ParamIdx,
+          typename Data>
+RAJA_HOST_DEVICE RAJA_INLINE void invoke_fission_lambda_expanded(
+    camp::idx_seq<OffsetIdx...> const &,
+    camp::idx_seq<ParamIdx...> const &,
+    Data &&data)
+{
+
+  using segment_types = typename Types::segment_types_t;
+
+  // ensure that all segments have been set by a loop
+  static_assert(
+      foldl(RAJA::operators::bit_and<bool>(), (!std::is_same<camp::at_v<segment_types, OffsetIdx>, void>::value)...),
+      "Not all segments have been used in a loop:  Either add more loop statements, or use the FissionLambda<N, Args..> form");
+
+  // Invoke the Lambda across the out-of-line boundary
+  invoke_lambda_out_of_line(
+      camp::get<LoopIndex>(data.bodies),
+      (camp::at_v<segment_types, OffsetIdx>)(camp::get<OffsetIdx>(data.segment_tuple).begin()[camp::get<OffsetIdx>(data.offset_tuple)])...,
+      camp::get<ParamIdx>(data.param_tuple)...);
+}
+
+
+/*!
+ * A RAJA::kernel statement that invokes a lambda function out-of-line,
+ * passing the segment values and parameters.
+ */
+template <camp::idx_t LambdaIndex, typename Types>
+struct StatementExecutor<statement::FissionLambda<LambdaIndex>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(Data &&data)
+  {
+    using Data_t = camp::decay<Data>;
+    using offset_tuple_t = typename Data_t::offset_tuple_t;
+    using param_tuple_t = typename Data_t::param_tuple_t;
+
+    invoke_fission_lambda_expanded<LambdaIndex, Types>(
+        camp::make_idx_seq_t<camp::tuple_size<offset_tuple_t>::value>{},
+        camp::make_idx_seq_t<camp::tuple_size<param_tuple_t>::value>{},
+        std::forward<Data>(data));
+  }
+};
+
+
+RAJA_SUPPRESS_HD_WARN
+template<camp::idx_t LoopIndex, typename Types, typename Data, typename... targLists>
+RAJA_INLINE RAJA_HOST_DEVICE void invoke_fission_lambda_with_args(Data &&data,
+                                                       camp::list<targLists...> const &)
+{
+  invoke_lambda_out_of_line(
+      camp::get<LoopIndex>(data.bodies),
+      LambdaArgExtractor<Types, targLists>::extract_arg(data)...);
+}
+
+
+/*!
+ * A RAJA::kernel statement that invokes a lambda function out-of-line
+ * with user specified arguments.
+ */
+template <camp::idx_t LambdaIndex, typename... Args, typename Types>
+struct StatementExecutor<statement::FissionLambda<LambdaIndex, Args...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(Data &&data)
+  {
+
+    //Convert SegList, ParamList into Seg, Param types, and store in a list
+    using targList = typename camp::flatten<camp::list<Args...>>::type;
+
+    invoke_fission_lambda_with_args<LambdaIndex, Types>(std::forward<Data>(data), targList{});
+  }
+};
+
 }  // namespace internal
 
 }  // end namespace RAJA
@@ -0,0 +1,232 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for kernel tile load/store statements.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_LoadStore_HPP
+#define RAJA_pattern_kernel_LoadStore_HPP
+
+#include "RAJA/config.hpp"
+
+#include <initializer_list>
+#include <type_traits>
+
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+/*!
+ * Kernel statement that copies the current tile of a View into a local
+ * array declaratively, replacing hand-written per-element copy loops.
+ *
+ * ViewPos and ArrayPos name the View and the LocalArray in the kernel
+ * parameter tuple. The index sequence lists, for each dimension of the
+ * View, the segment argument indexing it; the local array holds the
+ * tile with one dimension per listed argument, ordered by ascending
+ * argument number, so a View and its transpose fill the same array
+ * consistently. Iterates outside a partial tile are skipped.
+ *
+ * For example, with Aview indexed as Aview(row, col) by arguments 1
+ * and 0:
+ *
+ *   Load<0, 2, camp::idx_seq<1, 0>>
+ *
+ * fills local array 2 (dimensions [arg0-tile][arg1-tile]) from view 0.
+ * Backends order the element copies for their memory systems: the CPU
+ * executor runs the View's innermost dimension as a SIMD loop, and the
+ * CUDA executor copies cooperatively across the thread block with
+ * consecutive threads touching consecutive innermost-dimension
+ * elements, so global accesses coalesce regardless of the local
+ * array's permutation.
+ */
+template <camp::idx_t ViewPos, camp::idx_t ArrayPos, typename ArgSeq>
+struct Load : public internal::Statement<camp::nil> {
+};
+
+/*!
+ * Kernel statement that copies a local array back into the current
+ * tile of a View; the mirror of statement::Load, with the same
+ * ViewPos/ArrayPos/argument-sequence conventions. Use after the
+ * compute statements of a tile to write results staged in the local
+ * array.
+ */
+template <camp::idx_t ViewPos, camp::idx_t ArrayPos, typename ArgSeq>
+struct Store : public internal::Statement<camp::nil> {
+};
+
+}  // end namespace statement
+
+namespace internal
+{
+
+namespace detail
+{
+
+//! number of true values, for ranking arguments at compile time
+RAJA_INLINE
+constexpr camp::idx_t count_true(std::initializer_list<bool> flags)
+{
+  camp::idx_t n = 0;
+  for (bool f : flags) {
+    if (f) {
+      ++n;
+    }
+  }
+  return n;
+}
+
+}  // namespace detail
+
+/*!
+ * Implementation shared by the Load and Store statement executors.
+ *
+ * Loops run in View-dimension order (the order of ArgSeq), bounded by
+ * the current segment lengths so partial tiles stay in bounds; the
+ * innermost loop is the View's innermost dimension and is marked for
+ * vectorization. At the leaf the collected indices address the View
+ * through the segments' values and the local array through the
+ * ascending-argument dimension order.
+ */
+template <bool IsLoad,
+          camp::idx_t ViewPos,
+          camp::idx_t ArrayPos,
+          camp::idx_t... Args>
+struct TileCopyExecutor {
+
+  static constexpr size_t rank = sizeof...(Args);
+
+  //! local-array dimension holding an argument's tile index: the
+  //  number of listed arguments smaller than it
+  static RAJA_INLINE constexpr camp::idx_t arg_rank(camp::idx_t arg)
+  {
+    return detail::count_true({(Args < arg)...});
+  }
+
+  template <typename Array, typename View>
+  static RAJA_INLINE void assign(std::true_type, Array&& a, View&& v)
+  {
+    a = v;
+  }
+
+  template <typename Array, typename View>
+  static RAJA_INLINE void assign(std::false_type, Array&& a, View&& v)
+  {
+    v = a;
+  }
+
+  template <typename Data, camp::idx_t... Ds, typename... Is>
+  static RAJA_INLINE void copy_leaf(Data& data,
+                                    camp::idx_seq<Ds...>,
+                                    Is... is)
+  {
+    auto& view = camp::get<ViewPos>(data.param_tuple);
+    auto& arr = camp::get<ArrayPos>(data.param_tuple);
+
+    static constexpr camp::idx_t ranks[] = {arg_rank(Args)...};
+    camp::idx_t vi[] = {static_cast<camp::idx_t>(is)...};
+    camp::idx_t ai[rank];
+    for (size_t p = 0; p < rank; ++p) {
+      ai[ranks[p]] = vi[p];
+    }
+
+    assign(std::integral_constant<bool, IsLoad>{},
+           arr(ai[Ds]...),
+           view(*(camp::get<Args>(data.segment_tuple).begin() + vi[Ds])...));
+  }
+
+  //! leaf: all dimension indices collected
+  template <typename Data, typename... Is>
+  static RAJA_INLINE
+      typename std::enable_if<(sizeof...(Is) == sizeof...(Args))>::type
+      copy(Data& data, Is... is)
+  {
+    copy_leaf(data, camp::make_idx_seq_t<rank>{}, is...);
+  }
+
+  //! innermost dimension: vectorizable stride over the View
+  template <typename Data, typename... Is>
+  static RAJA_INLINE
+      typename std::enable_if<(sizeof...(Is) + 1 == sizeof...(Args))>::type
+      copy(Data& data, Is... is)
+  {
+    constexpr camp::idx_t Arg =
+        camp::seq_at<sizeof...(Is), camp::idx_seq<Args...>>::value;
+    auto len = segment_length<Arg>(data);
+    RAJA_SIMD
+    for (decltype(len) i = 0; i < len; ++i) {
+      copy(data, is..., i);
+    }
+  }
+
+  //! outer dimensions
+  template <typename Data, typename... Is>
+  static RAJA_INLINE
+      typename std::enable_if<(sizeof...(Is) + 1 < sizeof...(Args))>::type
+      copy(Data& data, Is... is)
+  {
+    constexpr camp::idx_t Arg =
+        camp::seq_at<sizeof...(Is), camp::idx_seq<Args...>>::value;
+    auto len = segment_length<Arg>(data);
+    for (decltype(len) i = 0; i < len; ++i) {
+      copy(data, is..., i);
+    }
+  }
+};
+
+
+//! Executor for statement::Load on CPU backends
+template <camp::idx_t ViewPos,
+          camp::idx_t ArrayPos,
+          camp::idx_t... Args,
+          typename Types>
+struct StatementExecutor<
+    statement::Load<ViewPos, ArrayPos, camp::idx_seq<Args...>>,
+    Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    TileCopyExecutor<true, ViewPos, ArrayPos, Args...>::copy(data);
+  }
+};
+
+
+//! Executor for statement::Store on CPU backends
+template <camp::idx_t ViewPos,
+          camp::idx_t ArrayPos,
+          camp::idx_t... Args,
+          typename Types>
+struct StatementExecutor<
+    statement::Store<ViewPos, ArrayPos, camp::idx_seq<Args...>>,
+    Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    TileCopyExecutor<false, ViewPos, ArrayPos, Args...>::copy(data);
+  }
+};
+
+}  // end namespace internal
+
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_LoadStore_HPP */
@@ -0,0 +1,169 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the kernel Prefetch statement.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_Prefetch_HPP
+#define RAJA_pattern_kernel_Prefetch_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+/*!
+ * A RAJA::kernel statement that issues a software prefetch for a view a
+ * fixed iteration distance ahead in an enclosing For loop.
+ *
+ * Peer of Lambda: place it in the statement list next to the compute
+ * lambda inside the For over ArgumentId. At each iteration it looks up
+ * the iterate Distance positions ahead in that loop's segment and
+ * prefetches the view element it selects, so indirect accesses
+ * (a[perm[i]] and friends) have their cache misses issued Distance
+ * iterations early. Hand-written __builtin_prefetch calls inside the
+ * body lambda are at the optimizer's mercy; as a statement the prefetch
+ * is emitted by the kernel skeleton itself, outside the lambda, where it
+ * is not subject to the body's reordering or elimination.
+ *
+ * The view is passed as a kernel parameter and named by ParamId; plain
+ * pointers work as well as Views. The distance is in iterations of the
+ * enclosing For, and no prefetch is issued for the final Distance
+ * iterations, so list segments are not read past their end.
+ *
+ * On CUDA devices the statement lowers to the L2 prefetch instruction;
+ * L1 on GPUs is not worth prefetching into (it is small, incoherent,
+ * and thrashed by other warps), but L2 prefetch covers the long
+ * latency of the gather's DRAM access. Host code uses the compiler's
+ * prefetch builtin, and compilers without one elide the statement.
+ *
+ * For example, gathering through a permutation with an 8-iteration
+ * prefetch distance:
+ *
+ * \code
+ *
+ *  using EXEC_POL =
+ *    RAJA::KernelPolicy<
+ *      RAJA::statement::For<0, RAJA::loop_exec,
+ *        RAJA::statement::Prefetch<0, 0, 8>,   // param 0, loop 0
+ *        RAJA::statement::Lambda<0>
+ *      >
+ *    >;
+ *
+ *  RAJA::kernel_param<EXEC_POL>(
+ *      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N)),
+ *      RAJA::make_tuple(x_view),
+ *      [=](int i, decltype(x_view)&) { y[i] = x_view(perm[i]); });
+ *
+ * \endcode
+ *
+ * \tparam ParamId index of the view (or pointer) in the parameter tuple
+ * \tparam ArgumentId index of the enclosing For's segment
+ * \tparam Distance prefetch distance in iterations of that For
+ */
+template <camp::idx_t ParamId, camp::idx_t ArgumentId, camp::idx_t Distance>
+struct Prefetch : public internal::Statement<camp::nil> {
+  static_assert(Distance > 0, "prefetch distance must be positive");
+};
+
+}  // end namespace statement
+
+namespace internal
+{
+
+namespace detail
+{
+
+//! Issue a read prefetch appropriate for the compilation target: the
+//  L2 prefetch instruction on CUDA devices, the compiler builtin on
+//  the host, nothing elsewhere.
+RAJA_HOST_DEVICE RAJA_INLINE void prefetch_read_any(const void* addr)
+{
+#if defined(__CUDA_ARCH__)
+#if __CUDA_ARCH__ >= 350
+  asm volatile("prefetch.global.L2 [%0];" : : "l"(addr));
+#else
+  RAJA_UNUSED_VAR(addr);
+#endif
+#elif defined(__HIP_DEVICE_COMPILE__)
+  RAJA_UNUSED_VAR(addr);
+#else
+  RAJA_PREFETCH_READ(addr);
+#endif
+}
+
+//! Address of element idx of a view-like parameter (anything callable
+//  with one index)...
+template <typename ViewLike, typename IdxT>
+RAJA_HOST_DEVICE RAJA_INLINE auto prefetch_address(ViewLike const& view,
+                                                   IdxT idx)
+    -> decltype(&view(idx))
+{
+  return &view(idx);
+}
+
+//! ...or of element idx of a plain pointer parameter.
+template <typename T, typename IdxT>
+RAJA_HOST_DEVICE RAJA_INLINE T* prefetch_address(T* ptr, IdxT idx)
+{
+  return ptr + idx;
+}
+
+}  // namespace detail
+
+/*!
+ * A RAJA::kernel executor for statement::Prefetch
+ *
+ * Leaf statement: reads the iterate Distance ahead in the ArgumentId
+ * segment (when one exists) and prefetches the named parameter's
+ * element at that index.
+ */
+template <camp::idx_t ParamId,
+          camp::idx_t ArgumentId,
+          camp::idx_t Distance,
+          typename Types>
+struct StatementExecutor<statement::Prefetch<ParamId, ArgumentId, Distance>,
+                         Types> {
+
+  template <typename Data>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(Data&& data)
+  {
+    auto const& segment = camp::get<ArgumentId>(data.segment_tuple);
+    auto begin = segment.begin();
+    auto offset = camp::get<ArgumentId>(data.offset_tuple);
+
+    if (offset + Distance < static_cast<decltype(offset)>(segment.end() -
+                                                          begin)) {
+      auto idx = begin[offset + Distance];
+      detail::prefetch_read_any(
+          detail::prefetch_address(camp::get<ParamId>(data.param_tuple),
+                                   idx));
+    }
+  }
+};
+
+}  // end namespace internal
+
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_Prefetch_HPP */
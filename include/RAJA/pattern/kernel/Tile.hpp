@@ -28,6 +28,7 @@
 #include "camp/tuple.hpp"
 
 #include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/HwTopology.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -74,6 +75,52 @@ struct tile_dynamic {
   static constexpr camp::idx_t id = ArgumentId;
 };
 
+///! tag for a tiling loop that classifies tiles as full or partial.
+//
+//  Tiles spanning the whole chunk run through one instantiation of the
+//  enclosed statements and the remainder tile through another, so the
+//  interior of a stencil sweep and its boundary are optimized
+//  separately but execute fused, within one launch, instead of as a
+//  fast interior launch followed by a slow boundary launch.
+template <camp::idx_t chunk_size_>
+struct tile_fixed_partition {
+  static constexpr camp::idx_t chunk_size = chunk_size_;
+};
+
+
+/*!
+ * Compute a tile size whose working set fits the host data cache at the
+ * given level, for use as the TileSize parameter of a tile_dynamic
+ * statement. bytes_per_iterate is the number of bytes one iteration of
+ * the tiled loop touches across all of its arrays. Half of one cache
+ * instance's per-thread share is budgeted, leaving room for data the
+ * tiling does not control, and the size is rounded down to whole cache
+ * lines. Tile extents derived this way track the cache geometry of the
+ * machine actually running, where a tile size constant in a header
+ * encodes the geometry of the machine it was tuned on.
+ */
+RAJA_INLINE TileSize cache_tile_size(size_t bytes_per_iterate, int level = 1)
+{
+  if (bytes_per_iterate == 0) {
+    bytes_per_iterate = 1;
+  }
+
+  CacheLevel const& cache = hw_topology().data_cache(level);
+
+  size_t budget = cache.size / static_cast<size_t>(cache.sharing) / 2;
+
+  camp::idx_t num_elems =
+      static_cast<camp::idx_t>(budget / bytes_per_iterate);
+
+  camp::idx_t elems_per_line =
+      static_cast<camp::idx_t>(cache.line_size / bytes_per_iterate);
+  if (elems_per_line > 1) {
+    num_elems -= num_elems % elems_per_line;
+  }
+
+  return TileSize{num_elems > 0 ? num_elems : 1};
+}
+
 
 
 namespace internal
@@ -250,6 +297,99 @@ struct StatementExecutor<
   }
 };
 
+/*!
+ * Tile wrapper for the full tiles of a partitioned tiling loop. Every
+ * tile it sees spans exactly ChunkSize iterations, and it re-slices
+ * with the compile-time literal so the constant extent is visible to
+ * the enclosed loops after inlining. A distinct type from TileWrapper,
+ * so the enclosed statement list is instantiated separately for the
+ * full-tile and partial-tile paths.
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t ChunkSize,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct FullTileWrapper : public GenericWrapper<Data, Types, EnclosedStmts...> {
+
+  using Base = GenericWrapper<Data, Types, EnclosedStmts...>;
+  using Base::Base;
+  using privatizer = NestedPrivatizer<FullTileWrapper>;
+
+  template <typename InSegmentIndexType>
+  RAJA_INLINE void operator()(InSegmentIndexType si)
+  {
+    // Assign the tile's segment to the tuple, with its extent pinned
+    // to the chunk size
+    camp::get<ArgumentId>(Base::data.segment_tuple) =
+        si.s.slice(0, ChunkSize);
+
+    // Execute enclosed statements
+    Base::exec();
+  }
+};
+
+
+/*!
+ * A RAJA::kernel forall_impl executor for statement::Tile with tile
+ * classification: the tiles that span a whole chunk run first through
+ * the full-tile instantiation of the enclosed statements, then the
+ * remainder tile, if any, runs through the generic guarded one.
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t ChunkSize,
+          typename EPol,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Tile<ArgumentId, tile_fixed_partition<ChunkSize>, EPol, EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    // Get the segment we are going to tile
+    auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
+    using segment_t = camp::decay<decltype(segment)>;
+
+    auto chunk_size = tile_fixed_partition<ChunkSize>::chunk_size;
+
+    // Classify: the first num_full tiles span a whole chunk, anything
+    // past full_len is the boundary remainder
+    camp::idx_t dist = segment.end() - segment.begin();
+    camp::idx_t num_full = dist / chunk_size;
+    camp::idx_t full_len = num_full * chunk_size;
+
+    // Keep the original segment to restore when the tiling is done
+    segment_t orig_segment = segment;
+
+    auto r = resources::get_resource<EPol>::type::get_default();
+
+    if (num_full > 0) {
+      IterableTiler<segment_t> full_iterable(
+          orig_segment.slice(0, full_len), chunk_size);
+
+      FullTileWrapper<ArgumentId, ChunkSize, Data, Types,
+                      EnclosedStmts...> full_wrapper(data);
+
+      forall_impl(r, EPol{}, full_iterable, full_wrapper);
+    }
+
+    if (dist > full_len) {
+      IterableTiler<segment_t> partial_iterable(
+          orig_segment.slice(full_len, dist - full_len), chunk_size);
+
+      TileWrapper<ArgumentId, Data, Types,
+                  EnclosedStmts...> partial_wrapper(data);
+
+      forall_impl(r, EPol{}, partial_iterable, partial_wrapper);
+    }
+
+    // Set range back to original values
+    camp::get<ArgumentId>(data.segment_tuple) = orig_segment;
+  }
+};
+
+
 template<camp::idx_t ArgumentId,
   typename EPol,
   typename... EnclosedStmts,
@@ -0,0 +1,148 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for tiling loop with an inter-tile prefetch hook.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_TilePrefetch_HPP
+#define RAJA_pattern_kernel_TilePrefetch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iostream>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/concepts.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that implements a tiling loop with a software
+ * prefetch hook for the next tile.
+ *
+ * Tiles are visited in order on the calling thread. Before the enclosed
+ * statements execute over a tile, PrefetchStmt -- typically a
+ * Lambda<N, Segs<ArgumentId>> -- is executed once with the first index of
+ * the *next* tile, so the lambda can issue software prefetches (e.g. with
+ * RAJA_PREFETCH_READ) for the data that tile will touch while the current
+ * tile is still computing. The prefetch statement is not executed for the
+ * last tile.
+ *
+ * Nesting inside statement::Tile gives two-level blocking, with the outer
+ * tile sized for a large cache level and distributed by its ExecPolicy,
+ * and the inner prefetching tiles walked sequentially within it:
+ *
+ * \code
+ *
+ *  using EXEC_POL =
+ *    RAJA::KernelPolicy<
+ *      RAJA::statement::Tile<0, RAJA::tile_fixed<512>, RAJA::omp_parallel_for_exec,
+ *        RAJA::statement::TilePrefetch<0, RAJA::tile_fixed<32>,
+ *          RAJA::statement::Lambda<1, RAJA::Segs<0>>,  // prefetch hook
+ *          RAJA::statement::For<0, RAJA::seq_exec,
+ *            RAJA::statement::Lambda<0>                // tile body
+ *          >
+ *        >
+ *      >
+ *    >;
+ *
+ * \endcode
+ *
+ * Since the tile loop must run in order for the prefetch to overlap the
+ * current tile's computation, this statement takes no ExecPolicy and is
+ * host-only; use an enclosing Tile or For statement to distribute work
+ * across threads.
+ */
+template <camp::idx_t ArgumentId,
+          typename TilePolicy,
+          typename PrefetchStmt,
+          typename... EnclosedStmts>
+struct TilePrefetch : public internal::Statement<camp::nil, EnclosedStmts...> {
+  using tile_policy_t = TilePolicy;
+};
+
+
+}  // end namespace statement
+
+namespace internal
+{
+
+/*!
+ * A RAJA::kernel executor for statement::TilePrefetch
+ *
+ * Walks the tiles sequentially, executing the prefetch statement with the
+ * first index of tile i+1 before executing the enclosed statements over
+ * tile i.
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t ChunkSize,
+          typename PrefetchStmt,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::TilePrefetch<ArgumentId, tile_fixed<ChunkSize>, PrefetchStmt,
+                            EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    // Get the segment we are going to tile
+    auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
+
+    // Get the tiling policies chunk size
+    auto chunk_size = tile_fixed<ChunkSize>::chunk_size;
+
+    // Create a tile iterator, needs to survive until the loop is
+    // done executing.
+    IterableTiler<decltype(segment)> tiled_iterable(segment, chunk_size);
+
+    for (camp::idx_t i = 0; i < tiled_iterable.num_blocks; ++i) {
+
+      if (i + 1 < tiled_iterable.num_blocks) {
+        // Point the segment at the next tile and run the prefetch
+        // statement with that tile's first index.
+        camp::get<ArgumentId>(data.segment_tuple) =
+            tiled_iterable.it.slice((i + 1) * chunk_size, chunk_size);
+        camp::get<ArgumentId>(data.offset_tuple) = 0;
+        execute_statement_list<camp::list<PrefetchStmt>, Types>(data);
+      }
+
+      // Assign the current tile's segment and execute the enclosed
+      // statement list over it
+      camp::get<ArgumentId>(data.segment_tuple) =
+          tiled_iterable.it.slice(i * chunk_size, chunk_size);
+      execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+    }
+
+    // Set range back to original values
+    camp::get<ArgumentId>(data.segment_tuple) = tiled_iterable.it;
+  }
+};
+
+}  // end namespace internal
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_TilePrefetch_HPP */
@@ -0,0 +1,271 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for temporal (time-blocked) tiling loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_TileTemporal_HPP
+#define RAJA_pattern_kernel_TileTemporal_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iostream>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/concepts.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that implements temporal blocking for
+ * time-stepped stencil kernels.
+ *
+ * A plain time loop around a spatial sweep streams the whole domain
+ * through memory once per timestep. TileTemporal instead tiles the
+ * spatial axis (SpaceArgId) and advances each tile through the entire
+ * time segment (TimeArgId) before moving to the next tile, so a tile's
+ * data is read from DRAM once and then reused from cache for every
+ * timestep.
+ *
+ * To respect the stencil's data dependences without inter-tile
+ * communication, tiles are trapezoids: at time step k of T, the base
+ * tile of chunk_size iterates is expanded by halo * (T - 1 - k) on each
+ * side, clamped to the domain. Every value a step reads within its halo
+ * was computed by the same tile at the previous, wider step, so tiles
+ * are independent at the cost of recomputing the overlap regions.
+ *
+ * The statement assigns the expanded spatial slice and a one-element
+ * slice of the time segment before executing the enclosed statements,
+ * which loop only over space; the lambda receives both the space and
+ * time indices and selects its read/write buffers from the time index:
+ *
+ * \code
+ *
+ *  using EXEC_POL =
+ *    RAJA::KernelPolicy<
+ *      RAJA::statement::TileTemporal<0, 1, RAJA::tile_temporal<256, 1>,
+ *                                    RAJA::omp_parallel_for_exec,
+ *        RAJA::statement::For<0, RAJA::simd_exec,
+ *          RAJA::statement::Lambda<0>
+ *        >
+ *      >
+ *    >;
+ *
+ *  double* u[T + 1] = { ... };  // step k reads u[k], writes u[k + 1]
+ *
+ *  RAJA::kernel<EXEC_POL>(
+ *      RAJA::make_tuple(RAJA::RangeSegment(0, N),   // space
+ *                       RAJA::RangeSegment(0, T)),  // time
+ *      [=](int i, int t) {
+ *        const double* src = u[t];
+ *        double* dst = u[t + 1];
+ *        dst[i] = 0.25 * src[i > 0 ? i - 1 : i] + 0.5 * src[i] +
+ *                 0.25 * src[i < N - 1 ? i + 1 : i];
+ *      });
+ *
+ * \endcode
+ *
+ * For correctness halo must be at least the stencil radius, each
+ * iterate may write only its own point, and boundary updates must
+ * compute the same value no matter which tile performs them (clamped
+ * indexing, as above). Because a tile finishes all its steps before the
+ * next tile starts, no step's output may alias the data an expanded
+ * earlier step of another tile still reads: rotate through
+ * num_steps + 1 buffers as above rather than ping-ponging between two.
+ * (With two buffers, the last step of one tile overwrites first-step
+ * input that the widened trapezoid of a neighboring tile still needs.)
+ * The time axis runs sequentially within a tile; the ExecPolicy
+ * distributes the spatial tiles, and with a parallel policy the
+ * overlapping writes in recomputed halo regions store identical values.
+ * Keep the time segment short enough (2-4 steps) that the widest
+ * trapezoid base still fits in cache.
+ *
+ * Multidimensional stencils tile their outermost spatial axis here and
+ * keep the inner axes as ordinary For statements inside.
+ */
+template <camp::idx_t SpaceArgId,
+          camp::idx_t TimeArgId,
+          typename TemporalTilePolicy,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+struct TileTemporal : public internal::Statement<ExecPolicy, EnclosedStmts...> {
+  using tile_policy_t = TemporalTilePolicy;
+  using exec_policy_t = ExecPolicy;
+};
+
+
+}  // end namespace statement
+
+///! tag for a temporal tiling loop
+template <camp::idx_t chunk_size_, camp::idx_t halo_>
+struct tile_temporal {
+  static constexpr camp::idx_t chunk_size = chunk_size_;
+  static constexpr camp::idx_t halo = halo_;
+};
+
+
+namespace internal
+{
+
+/*!
+ * A RAJA::kernel forall_impl tile wrapper for statement::TileTemporal
+ *
+ * For each base spatial tile, walks the time segment in order; at each
+ * step it assigns the halo-expanded spatial slice and a one-element
+ * time slice, then executes the enclosed statements. Holds copies of
+ * the full space and time segments so the trapezoid can be recomputed
+ * after the segment tuple has been overwritten with slices.
+ */
+template <camp::idx_t SpaceArgId,
+          camp::idx_t TimeArgId,
+          camp::idx_t Halo,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct TemporalTileWrapper : public GenericWrapper<Data, Types, EnclosedStmts...> {
+
+  using Base = GenericWrapper<Data, Types, EnclosedStmts...>;
+
+  // the time segment's index type is assigned here, not by an enclosed
+  // For statement, so record it for the lambda invocation machinery
+  using NewTypes = setSegmentTypeFromData<Types, TimeArgId, Data>;
+
+  using space_segment_t =
+      camp::at_v<typename camp::decay<Data>::segment_tuple_t::TList, SpaceArgId>;
+  using time_segment_t =
+      camp::at_v<typename camp::decay<Data>::segment_tuple_t::TList, TimeArgId>;
+
+  space_segment_t space;
+  time_segment_t time;
+  camp::idx_t chunk_size;
+
+  RAJA_INLINE
+  TemporalTileWrapper(typename Base::data_t &d, camp::idx_t chunk_size_)
+      : Base{d},
+        space{camp::get<SpaceArgId>(d.segment_tuple)},
+        time{camp::get<TimeArgId>(d.segment_tuple)},
+        chunk_size{chunk_size_}
+  {
+  }
+
+  // NestedPrivatizer only reconstructs from the data reference, so this
+  // wrapper carries its own privatizer that forwards the tile geometry
+  struct privatizer {
+    using data_t = typename Base::data_t;
+    using value_type = TemporalTileWrapper;
+    using reference_type = value_type &;
+
+    data_t privatized_data;
+    value_type privatized_wrapper;
+
+    RAJA_INLINE
+    constexpr privatizer(const TemporalTileWrapper &o)
+        : privatized_data{o.data},
+          privatized_wrapper(privatized_data, o.chunk_size)
+    {
+    }
+
+    RAJA_INLINE
+    reference_type get_priv() { return privatized_wrapper; }
+  };
+
+  template <typename InSegmentIndexType>
+  RAJA_INLINE void operator()(InSegmentIndexType si)
+  {
+    const camp::idx_t space_len = space.end() - space.begin();
+    const camp::idx_t num_steps = time.end() - time.begin();
+
+    const camp::idx_t tile_begin = si.i * chunk_size;
+    camp::idx_t tile_end = tile_begin + chunk_size;
+    if (tile_end > space_len) {
+      tile_end = space_len;
+    }
+
+    for (camp::idx_t k = 0; k < num_steps; ++k) {
+
+      // expand the base tile by the halo each remaining step needs,
+      // clamped to the domain
+      const camp::idx_t grow = Halo * (num_steps - 1 - k);
+      const camp::idx_t lo = tile_begin > grow ? tile_begin - grow : 0;
+      camp::idx_t hi = tile_end + grow;
+      if (hi > space_len) {
+        hi = space_len;
+      }
+
+      camp::get<SpaceArgId>(Base::data.segment_tuple) = space.slice(lo, hi - lo);
+      camp::get<TimeArgId>(Base::data.segment_tuple) = time.slice(k, 1);
+      camp::get<TimeArgId>(Base::data.offset_tuple) = 0;
+
+      execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(Base::data);
+    }
+  }
+};
+
+
+/*!
+ * A RAJA::kernel forall_impl executor for statement::TileTemporal
+ *
+ */
+template <camp::idx_t SpaceArgId,
+          camp::idx_t TimeArgId,
+          camp::idx_t ChunkSize,
+          camp::idx_t Halo,
+          typename EPol,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::TileTemporal<SpaceArgId, TimeArgId, tile_temporal<ChunkSize, Halo>,
+                            EPol, EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    // Get the segment we are going to tile
+    auto const &segment = camp::get<SpaceArgId>(data.segment_tuple);
+
+    // Create a tile iterator over the space axis; only the block ids
+    // are used, but it needs to survive until the forall is done
+    // executing.
+    IterableTiler<decltype(segment)> tiled_iterable(segment, ChunkSize);
+
+    // Wrap in case forall_impl needs to thread_privatize
+    TemporalTileWrapper<SpaceArgId, TimeArgId, Halo, Data, Types,
+                        EnclosedStmts...> tile_wrapper(data, ChunkSize);
+
+    // Loop over tiles, advancing each through the full time segment
+    auto r = resources::get_resource<EPol>::type::get_default();
+    forall_impl(r, EPol{}, tiled_iterable, tile_wrapper);
+
+    // Set ranges back to original values
+    camp::get<SpaceArgId>(data.segment_tuple) = tiled_iterable.it;
+    camp::get<TimeArgId>(data.segment_tuple) = tile_wrapper.time;
+  }
+};
+
+}  // end namespace internal
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_TileTemporal_HPP */
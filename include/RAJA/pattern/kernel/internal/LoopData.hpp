@@ -30,6 +30,7 @@
 #include "RAJA/pattern/detail/privatizer.hpp"
 #include "RAJA/pattern/kernel/internal/StatementList.hpp"
 
+#include <array>
 #include <iterator>
 #include <type_traits>
 
@@ -98,10 +99,11 @@ using index_tuple_from_segments =
 
 template <typename SegmentTuple,
           typename ParamTuple,
+          typename Resource,
           typename... Bodies>
 struct LoopData {
 
-  using Self = LoopData<SegmentTuple, ParamTuple, Bodies...>;
+  using Self = LoopData<SegmentTuple, ParamTuple, Resource, Bodies...>;
 
   using offset_tuple_t =
       difftype_tuple_from_segments<typename SegmentTuple::TList>;
@@ -115,13 +117,17 @@ struct LoopData {
   using param_tuple_t = ParamTuple;
   ParamTuple param_tuple;
 
+  using resource_t = Resource;
+  Resource res;
+
   using BodiesTuple = camp::tuple<Bodies...>;
   const BodiesTuple bodies;
   offset_tuple_t offset_tuple;
 
   RAJA_INLINE RAJA_HOST_DEVICE constexpr
-  LoopData(SegmentTuple const &s, ParamTuple const &p, Bodies const &... b)
-      : segment_tuple(s), param_tuple(p), bodies(b...)
+  LoopData(SegmentTuple const &s, ParamTuple const &p, Resource const &r,
+           Bodies const &... b)
+      : segment_tuple(s), param_tuple(p), res(r), bodies(b...)
   {
     //assign_begin_all();
   }
@@ -173,6 +179,20 @@ RAJA_INLINE RAJA_HOST_DEVICE auto segment_length(Data const &data) ->
 }
 
 
+/*!
+ * Gathers the lengths of all segments in a LoopData object into an
+ * array, usable as a comparison key for caching launch parameters
+ * computed from the segment extents.
+ */
+template <typename Data, camp::idx_t... Is>
+RAJA_INLINE std::array<Index_type, sizeof...(Is)> get_segment_extents(
+    Data const &data, camp::idx_seq<Is...>)
+{
+  return std::array<Index_type, sizeof...(Is)>{
+      {static_cast<Index_type>(segment_length<Is>(data))...}};
+}
+
+
 
 
 template <typename Data, typename Types, typename... EnclosedStmts>
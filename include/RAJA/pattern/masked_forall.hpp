@@ -0,0 +1,164 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA masked forall declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_masked_forall_HPP
+#define RAJA_masked_forall_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/BitMask.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace impl
+{
+namespace masked
+{
+
+/*!
+        \brief adapter threading a Host resource through the CPU masked
+   forall implementations; the calling thread(s) execute directly, so the
+   resource carries no stream to forward
+*/
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+forall(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  forall(p, std::forward<Args>(args)...);
+}
+
+}  // namespace masked
+}  // namespace impl
+
+/*!
+******************************************************************************
+*
+* \brief  masked forall execution pattern on a resource
+*
+* Applies loop_body to the iterates of the segment whose bit is set in
+* mask, where bit i of the mask governs the i-th iterate of the segment.
+* This replaces the `if (!active[i]) return;` idiom inside loop bodies:
+* the CPU back-ends skip inactive words of the mask entirely and
+* vectorize fully-active words, and the GPU back-ends compact each
+* warp's active iterates onto its low lanes with a ballot so sparse
+* activity does not execute as divergent full-width warps.
+*
+* \param[in] r Resource the loop runs on; device back-ends enqueue on the
+*resource's stream
+* \param[in] p Execution policy
+* \param[in] seg Range or segment to iterate over
+* \param[in] mask view of one activity bit per iterate of seg; the words
+*must cover the segment length and be accessible where the policy runs
+* \param[in] loop_body loop body, invoked with the segment value of each
+*active iterate
+*
+* \return an event proxy for the loop's completion on the resource
+*
+* \note{Iteration order over active iterates follows the policy, as with
+*forall; bits past the segment length are ignored}
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Iterable,
+          typename LoopBody>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<Iterable>>
+masked_forall(Res& r,
+              const ExecPolicy& p,
+              Iterable&& seg,
+              const BitSetView& mask,
+              LoopBody&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  auto b = begin(seg);
+  const auto len = distance(b, end(seg));
+  if (len > 0) {
+    impl::masked::forall(r, p, b, static_cast<Index_type>(len), mask,
+                         std::forward<LoopBody>(loop_body));
+  }
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  masked forall execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] seg Range or segment to iterate over
+* \param[in] mask view of one activity bit per iterate of seg
+* \param[in] loop_body loop body, invoked with the segment value of each
+*active iterate
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iterable,
+          typename LoopBody,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Iterable>>
+masked_forall(const ExecPolicy& p,
+              Iterable&& seg,
+              const BitSetView& mask,
+              LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return masked_forall(r, p, std::forward<Iterable>(seg), mask,
+                       std::forward<LoopBody>(loop_body));
+}
+
+/*!
+******************************************************************************
+*
+* \brief  masked forall execution pattern, with execution policy given as
+*         a template parameter
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iterable,
+          typename LoopBody,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Iterable>>
+masked_forall(Iterable&& seg, const BitSetView& mask, LoopBody&& loop_body)
+{
+  return masked_forall(ExecPolicy{}, std::forward<Iterable>(seg), mask,
+                       std::forward<LoopBody>(loop_body));
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,135 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA multi-bin reduction declarations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_multi_reduce_HPP
+#define RAJA_multi_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Multi-bin sum reducer class template.
+ *
+ * Accumulates into num_bins values in a single pass, with all bins for a
+ * given thread stored in one contiguous, padded block so a histogram-style
+ * loop touches a single cache-resident tally array instead of one reducer
+ * object (and one finalization pass) per bin.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   Index_type* bin = ...;
+   MultiReduceSum<reduce_policy, Real_type> tally(num_bins, 0.0);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      tally.add(bin[i], data[i]);
+   }
+
+   Real_type bin0 = tally.get(0);
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class MultiReduceSum;
+
+namespace reduce
+{
+
+namespace detail
+{
+
+/*!
+ * Shared storage for host multi-bin reducers: one contiguous block of
+ * num_bins values per thread, with each thread's block padded out to a
+ * cache-line multiple to avoid false sharing between threads.
+ */
+template <typename T>
+class MultiReduceData
+{
+public:
+  MultiReduceData(size_t num_threads, size_t num_bins, T identity)
+      : m_num_bins(num_bins),
+        m_stride(pad_bins(num_bins)),
+        m_identity(identity),
+        m_data(num_threads * pad_bins(num_bins), identity)
+  {
+  }
+
+  //! pointer to the tally block for a given thread
+  T *thread_bins(size_t thread_id) { return &m_data[thread_id * m_stride]; }
+
+  size_t num_bins() const { return m_num_bins; }
+
+  size_t num_threads() const { return m_data.size() / m_stride; }
+
+  //! combine one bin across all per-thread blocks
+  template <typename Combiner>
+  T combine_bin(size_t bin) const
+  {
+    T result = m_identity;
+    for (size_t t = 0; t < num_threads(); ++t) {
+      Combiner{}(result, m_data[t * m_stride + bin]);
+    }
+    return result;
+  }
+
+  //! reset every per-thread tally to the identity
+  void reset()
+  {
+    for (size_t i = 0; i < m_data.size(); ++i) {
+      m_data[i] = m_identity;
+    }
+  }
+
+private:
+  static size_t pad_bins(size_t num_bins)
+  {
+    size_t per_line = RAJA::DATA_ALIGN / sizeof(T);
+    if (per_line == 0) {
+      return num_bins;
+    }
+    return ((num_bins + per_line - 1) / per_line) * per_line;
+  }
+
+  size_t m_num_bins;
+  size_t m_stride;
+  T m_identity;
+  std::vector<T> m_data;
+};
+
+}  // namespace detail
+
+}  // namespace reduce
+
+}  // end of namespace RAJA
+
+#endif  // closing endif for header file include guard
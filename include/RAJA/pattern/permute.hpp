@@ -0,0 +1,279 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA permutation apply and generation
+ *          patterns.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_permute_HPP
+#define RAJA_permute_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/sort.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! output elements per tile of the cache-blocked host permute
+constexpr Index_type permute_block_size = 1024;
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  apply a gather permutation: out[i] = in[perm[i]]
+*
+* Reorders a field by a precomputed permutation (e.g. one produced by
+* sort_pairs with identity values, or by sorted_permutation below). The
+* writes are the streaming side, so this is the form to use when the
+* destination layout is the sorted order.
+*
+* Host policies run cache-blocked: workers own contiguous output tiles,
+* so the stores stream and each tile's gathered reads form a bounded
+* working set that hardware prefetch and out-of-order misses can cover.
+* Device policies run flat so the stores coalesce across threads.
+*
+* \param[in] p Execution policy
+* \param[in] perm_begin Pointer or Random-Access Iterator to start of the
+*permutation indices
+* \param[in] perm_end Pointer or Random-Access Iterator to end of the
+*permutation indices (exclusive)
+* \param[in] in Pointer or Random-Access Iterator to start of input data;
+*must cover every index in the permutation
+* \param[out] out Pointer or Random-Access Iterator to start of output
+*data range; must not alias the input
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename PermIter,
+          typename Iter,
+          typename IterOut>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    concepts::negate<type_traits::is_cuda_policy<ExecPolicy>>,
+                    concepts::negate<type_traits::is_hip_policy<ExecPolicy>>,
+                    type_traits::is_iterator<PermIter>,
+                    type_traits::is_iterator<Iter>>
+permute(const ExecPolicy &p,
+        PermIter perm_begin,
+        PermIter perm_end,
+        Iter in,
+        IterOut out)
+{
+  static_assert(type_traits::is_random_access_iterator<PermIter>::value,
+                "PermIter must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  RAJA_UNUSED_VAR(p);
+
+  using std::distance;
+  const Index_type len = distance(perm_begin, perm_end);
+  const Index_type num_blocks =
+      (len + detail::permute_block_size - 1) / detail::permute_block_size;
+
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, num_blocks),
+      [=](Index_type b) {
+        const Index_type tile_begin = b * detail::permute_block_size;
+        const Index_type tile_end =
+            (tile_begin + detail::permute_block_size < len)
+                ? tile_begin + detail::permute_block_size
+                : len;
+        for (Index_type i = tile_begin; i < tile_end; ++i) {
+          out[i] = in[perm_begin[i]];
+        }
+      });
+}
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+
+/*!
+******************************************************************************
+*
+* \brief  apply a gather permutation on device policies: out[i] = in[perm[i]]
+*
+* One thread per output element; the permutation read and the output
+* write are both coalesced and only the gathered input read scatters.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename PermIter,
+          typename Iter,
+          typename IterOut>
+concepts::enable_if<concepts::any_of<type_traits::is_cuda_policy<ExecPolicy>,
+                                     type_traits::is_hip_policy<ExecPolicy>>,
+                    type_traits::is_iterator<PermIter>,
+                    type_traits::is_iterator<Iter>>
+permute(const ExecPolicy &p,
+        PermIter perm_begin,
+        PermIter perm_end,
+        Iter in,
+        IterOut out)
+{
+  static_assert(type_traits::is_random_access_iterator<PermIter>::value,
+                "PermIter must model RandomAccessIterator");
+  RAJA_UNUSED_VAR(p);
+
+  using std::distance;
+  const Index_type len = distance(perm_begin, perm_end);
+
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, len),
+      [=] RAJA_HOST_DEVICE(Index_type i) {
+        out[i] = in[perm_begin[i]];
+      });
+}
+
+#endif  // RAJA_ENABLE_CUDA || RAJA_ENABLE_HIP
+
+/*!
+******************************************************************************
+*
+* \brief  invert a permutation: inv[perm[i]] = i
+*
+* One scatter pass; with perm the gather permutation into sorted order,
+* inv answers "where did original element j land".
+*
+* \param[in] p Execution policy
+* \param[in] perm_begin Pointer or Random-Access Iterator to start of the
+*permutation indices
+* \param[in] perm_end Pointer or Random-Access Iterator to end of the
+*permutation indices (exclusive)
+* \param[out] inv Pointer or Random-Access Iterator to start of the
+*inverse permutation; must not alias perm
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename PermIter, typename IterOut>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<PermIter>,
+                    type_traits::is_iterator<IterOut>>
+invert_permutation(const ExecPolicy &p,
+                   PermIter perm_begin,
+                   PermIter perm_end,
+                   IterOut inv)
+{
+  static_assert(type_traits::is_random_access_iterator<PermIter>::value,
+                "PermIter must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  RAJA_UNUSED_VAR(p);
+
+  using std::distance;
+  const Index_type len = distance(perm_begin, perm_end);
+
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, len),
+      [=] RAJA_HOST_DEVICE(Index_type i) {
+        inv[perm_begin[i]] = i;
+      });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort keys and produce the permutation and its inverse
+*
+* Sorts [keys_begin, keys_end) in place with sort_pairs, filling perm
+* with the gather permutation into sorted order (out[i] = in[perm[i]]
+* reorders any companion field) and inv with its inverse, generated in
+* the same pass rather than by a separate argsort of perm.
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of
+*keys; sorted in place
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[out] perm Pointer or Random-Access Iterator to start of the
+*gather permutation; holds dist(keys_begin, keys_end) entries on return
+* \param[out] inv Pointer or Random-Access Iterator to start of the
+*inverse permutation; holds dist(keys_begin, keys_end) entries on return
+* \param[in] comp comparison function to apply to the keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename PermIter,
+          typename InvIter,
+          typename Compare =
+              operators::less<RAJA::detail::IterVal<KeyIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<PermIter>,
+                    type_traits::is_iterator<InvIter>>
+sorted_permutation(const ExecPolicy &p,
+                   KeyIter keys_begin,
+                   KeyIter keys_end,
+                   PermIter perm,
+                   InvIter inv,
+                   Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "KeyIter must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<PermIter>::value,
+                "PermIter must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<InvIter>::value,
+                "InvIter must model RandomAccessIterator");
+
+  using std::distance;
+  const Index_type len = distance(keys_begin, keys_end);
+
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, len),
+      [=] RAJA_HOST_DEVICE(Index_type i) {
+        perm[i] = i;
+      });
+
+  sort_pairs(p, keys_begin, keys_end, perm, comp);
+
+  invert_permutation(p, perm, perm + len, inv);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+permute(Args &&... args)
+{
+  permute(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+invert_permutation(Args &&... args)
+{
+  invert_permutation(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sorted_permutation(Args &&... args)
+{
+  sorted_permutation(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -231,6 +231,73 @@ class ReduceBitOr;
  */
 template <typename REDUCE_POLICY_T, typename T>
 class ReduceBitAnd;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Composite reducer class template.
+ *
+ * Applies several reduction operations to the same operand in a single
+ * pass, using one tally value (and, on device back-ends, one
+ * finalization sync) instead of one reducer per operation.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   ReduceComposite<reduce_policy, Real_type,
+                   RAJA::reduce::min,
+                   RAJA::reduce::max,
+                   RAJA::reduce::sum> my_stats;
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_stats.combine(data[i]);
+   }
+
+   Real_type minval = my_stats.get(0);
+   Real_type maxval = my_stats.get(1);
+   Real_type sumval = my_stats.get(2);
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T,
+          typename T,
+          template <typename> class... REDUCE_OPS>
+class ReduceComposite;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Generic reducer class template for user-defined reduction
+ *         operators.
+ *
+ * The operator object supplies the accumulation type, the identity, and
+ * the combine as a constexpr-friendly functor, so a custom reduction
+ * runs through the same per-policy combiner machinery as the built-in
+ * reducers instead of requiring forked reducer internals.
+ *
+ * Usage example (compensated summation):
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   Reduce<reduce_policy, RAJA::reduce::kahan_sum<Real_type>> my_sum;
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_sum.combine(data[i]);
+   }
+
+   Real_type sum = my_sum.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename REDUCE_OP>
+class Reduce;
 } //namespace RAJA
 
 
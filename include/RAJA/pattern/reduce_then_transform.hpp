@@ -0,0 +1,478 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file providing a fused reduce-then-transform
+ *          pattern (e.g. sum then normalize) in a single traversal.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_reduce_then_transform_HPP
+#define RAJA_reduce_then_transform_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <vector>
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#include "RAJA/policy/openmp/policy.hpp"
+#endif
+
+#if defined(RAJA_CUDA_ACTIVE)
+#include <cooperative_groups.h>
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/reduce.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#endif
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Fused reduce-then-transform over a segment.
+ *
+ * Computes total = binop over contribute(i) for all i in the segment,
+ * then applies transform(i, total) to every i, e.g. the ubiquitous
+ * normalize step (sum all elements, divide each by the sum). Written as
+ * two foralls this is two full passes over the data; this pattern fuses
+ * them so the second phase runs on data still resident close to the
+ * worker that reduced it:
+ *
+ *  - OpenMP policies run both phases inside one parallel region with a
+ *    barrier between them. Each thread reduces a static chunk, combines
+ *    the per-thread partials, and transforms the *same* chunk, so the
+ *    second phase hits that core's cache when chunks fit.
+ *
+ *  - CUDA policies launch a single cooperative kernel: tile-level partial
+ *    reductions through the block reduction tree of policy/cuda/reduce.hpp,
+ *    a grid-wide sync (cooperative groups), an in-kernel combine and
+ *    broadcast of the total, and the second-phase lambda over the same
+ *    grid-stride tiles, whose last tile is still L2/cache resident.
+ *
+ *  - Other policies fall back to a serial reduction followed by a forall
+ *    of the transform phase.
+ *
+ * Usage example (normalize):
+ *
+ * \code
+ *
+ *  double sum = RAJA::reduce_then_transform<RAJA::omp_parallel_for_exec>(
+ *      RAJA::RangeSegment(0, N),
+ *      0.0,
+ *      [=](RAJA::Index_type i) { return x[i]; },
+ *      [=](RAJA::Index_type i, double total) { x[i] /= total; });
+ *
+ * \endcode
+ *
+ * \param[in] seg segment or iterable of indices to traverse (twice)
+ * \param[in] init identity value the reduction starts from
+ * \param[in] contribute functor i -> value, supplies each index's
+ * contribution to the reduction
+ * \param[in] transform functor (i, total), applied to every index after
+ * the reduction completes; receives the reduced total
+ * \param[in] binop binary function combining contributions; must be
+ * associative and stateless (default operators::plus)
+ *
+ * \return the reduced total
+ *
+ ******************************************************************************
+ */
+
+namespace detail
+{
+
+#if defined(RAJA_CUDA_ACTIVE)
+
+/// Adapt a value-returning binary function to the accumulate-into
+/// combiner shape block_reduce expects; Function must be stateless.
+template <typename Function, typename T>
+struct ReduceTransformCombiner {
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T& acc, const T& rhs) const
+  {
+    acc = Function{}(acc, rhs);
+  }
+};
+
+/// Cooperative reduce-then-transform kernel. Each block reduces its
+/// grid-stride tiles and posts the partial, the grid syncs once, every
+/// block folds the (few) block partials into the total, and the same
+/// grid-stride tiles are transformed. Block (0,0) also publishes the
+/// total for the host through total_out.
+template <size_t BlockSize,
+          typename Iterator,
+          typename IndexType,
+          typename T,
+          typename Function,
+          typename ContribBody,
+          typename TransformBody>
+__launch_bounds__(BlockSize, 1) __global__
+    void reduce_then_transform_cuda_kernel(Iterator begin,
+                                           IndexType len,
+                                           T init,
+                                           ContribBody contribute,
+                                           TransformBody transform,
+                                           T* block_partials,
+                                           T* total_out)
+{
+  using combiner = ReduceTransformCombiner<Function, T>;
+
+  IndexType stride = static_cast<IndexType>(gridDim.x) * BlockSize;
+
+  T partial = init;
+  for (IndexType i = static_cast<IndexType>(blockIdx.x) * BlockSize +
+                     threadIdx.x;
+       i < len; i += stride) {
+    combiner{}(partial, contribute(begin[i]));
+  }
+
+  T block_total = impl::block_reduce<combiner>(partial, init);
+  if (threadIdx.x == 0) {
+    block_partials[blockIdx.x] = block_total;
+  }
+
+  cooperative_groups::this_grid().sync();
+
+  // every thread folds the per-block partials; gridDim.x is bounded by
+  // cooperative occupancy so this is cheap and needs no second sync
+  T total = init;
+  for (unsigned int b = 0; b < gridDim.x; ++b) {
+    combiner{}(total, block_partials[b]);
+  }
+
+  if (blockIdx.x == 0 && threadIdx.x == 0) {
+    *total_out = total;
+  }
+
+  for (IndexType i = static_cast<IndexType>(blockIdx.x) * BlockSize +
+                     threadIdx.x;
+       i < len; i += stride) {
+    transform(begin[i], total);
+  }
+}
+
+/// Phase-one-only kernel for devices without cooperative launch support:
+/// post per-block partials and stop; the host folds them and runs the
+/// transform phase as an ordinary forall.
+template <size_t BlockSize,
+          typename Iterator,
+          typename IndexType,
+          typename T,
+          typename Function,
+          typename ContribBody>
+__launch_bounds__(BlockSize, 1) __global__
+    void reduce_partials_cuda_kernel(Iterator begin,
+                                     IndexType len,
+                                     T init,
+                                     ContribBody contribute,
+                                     T* block_partials)
+{
+  using combiner = ReduceTransformCombiner<Function, T>;
+
+  IndexType stride = static_cast<IndexType>(gridDim.x) * BlockSize;
+
+  T partial = init;
+  for (IndexType i = static_cast<IndexType>(blockIdx.x) * BlockSize +
+                     threadIdx.x;
+       i < len; i += stride) {
+    combiner{}(partial, contribute(begin[i]));
+  }
+
+  T block_total = impl::block_reduce<combiner>(partial, init);
+  if (threadIdx.x == 0) {
+    block_partials[blockIdx.x] = block_total;
+  }
+}
+
+/// Extract the block size of a cuda_exec policy; only the plain
+/// fixed-block-size policy makes sense here since the kernel is one
+/// monolithic grid-stride loop.
+template <typename Policy>
+struct reduce_transform_block_size;
+
+template <size_t BlockSize, bool Async>
+struct reduce_transform_block_size<policy::cuda::cuda_exec<BlockSize, Async>>
+    : std::integral_constant<size_t, BlockSize> {
+};
+
+#endif  // RAJA_CUDA_ACTIVE
+
+}  // namespace detail
+
+/// Fallback for policies without a fused implementation: serial
+/// reduction pass, then the transform phase as a forall of the given
+/// policy.
+template <typename ExecPolicy,
+          typename Container,
+          typename ContribBody,
+          typename TransformBody,
+          typename T,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<T,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+#if defined(RAJA_ENABLE_OPENMP)
+                      concepts::negate<type_traits::is_openmp_policy<ExecPolicy>>,
+#endif
+                      concepts::negate<type_traits::is_cuda_policy<ExecPolicy>>>
+reduce_then_transform(Container&& seg,
+                      T init,
+                      ContribBody contribute,
+                      TransformBody transform,
+                      Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  using ValueType = camp::decay<decltype(*std::begin(seg))>;
+
+  T total = init;
+  for (auto i : seg) {
+    total = binop(total, contribute(i));
+  }
+
+  forall<ExecPolicy>(seg, [=](ValueType i) { transform(i, total); });
+
+  return total;
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+/// OpenMP policies: one parallel region, each thread reduces a static
+/// chunk, a barrier publishes the per-thread partials, every thread
+/// folds them, and each thread transforms the chunk it reduced so the
+/// second phase reads from that core's cache.
+template <typename ExecPolicy,
+          typename Container,
+          typename ContribBody,
+          typename TransformBody,
+          typename T,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<T,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      type_traits::is_range<Container>>
+reduce_then_transform(Container&& seg,
+                      T init,
+                      ContribBody contribute,
+                      TransformBody transform,
+                      Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  using std::begin;
+  using std::end;
+  using std::distance;
+  auto b = begin(seg);
+  auto len = distance(b, end(seg));
+
+  const int max_threads = omp_get_max_threads();
+  std::vector<T> partials(static_cast<size_t>(max_threads), init);
+  T* partials_ptr = partials.data();
+
+  T total = init;
+
+#pragma omp parallel firstprivate(init, contribute, transform, binop)
+  {
+    const int nthreads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+
+    const auto chunk = (len + nthreads - 1) / nthreads;
+    const auto chunk_begin = static_cast<decltype(len)>(tid) * chunk;
+    const auto chunk_end = (chunk_begin + chunk < len) ? chunk_begin + chunk
+                                                       : len;
+
+    T partial = init;
+    for (auto i = chunk_begin; i < chunk_end; ++i) {
+      partial = binop(partial, contribute(b[i]));
+    }
+    partials_ptr[tid] = partial;
+
+#pragma omp barrier
+
+    // every thread folds the (few) per-thread partials in index order,
+    // so all threads agree on the total bit-for-bit
+    T my_total = init;
+    for (int t = 0; t < nthreads; ++t) {
+      my_total = binop(my_total, partials_ptr[t]);
+    }
+
+#pragma omp single nowait
+    total = my_total;
+
+    for (auto i = chunk_begin; i < chunk_end; ++i) {
+      transform(b[i], my_total);
+    }
+  }
+
+  return total;
+}
+
+#endif  // RAJA_ENABLE_OPENMP
+
+#if defined(RAJA_CUDA_ACTIVE)
+
+/// CUDA policies: one cooperative kernel with an in-kernel grid sync
+/// when the device supports cooperative launch, otherwise a partials
+/// kernel plus host combine and a transform forall. Both lambdas must be
+/// device-capturable (RAJA_DEVICE); binop must be stateless as it is
+/// rebuilt on the device.
+template <typename ExecPolicy,
+          typename Container,
+          typename ContribBody,
+          typename TransformBody,
+          typename T,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<T,
+                      type_traits::is_cuda_policy<ExecPolicy>,
+                      type_traits::is_range<Container>>
+reduce_then_transform(Container&& seg,
+                      T init,
+                      ContribBody contribute,
+                      TransformBody transform,
+                      Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+  RAJA_UNUSED_VAR(binop);  // rebuilt statelessly on the device
+
+  static constexpr size_t BlockSize =
+      detail::reduce_transform_block_size<ExecPolicy>::value;
+
+  using Iterator = camp::decay<decltype(std::begin(seg))>;
+  using IndexType =
+      camp::decay<decltype(std::distance(std::begin(seg), std::end(seg)))>;
+
+  Iterator begin = std::begin(seg);
+  IndexType len = std::distance(begin, std::end(seg));
+  if (len <= 0) {
+    return init;
+  }
+
+  auto cuda_res = resources::Cuda::get_default();
+  cudaStream_t stream = cuda_res.get_stream();
+
+  if (RAJA::cuda::device_prop().cooperativeLaunch) {
+
+    auto func = detail::reduce_then_transform_cuda_kernel<BlockSize,
+                                                          Iterator,
+                                                          IndexType,
+                                                          T,
+                                                          Function,
+                                                          ContribBody,
+                                                          TransformBody>;
+
+    // the whole grid must be resident for the grid sync, so cap the
+    // block count at cooperative occupancy
+    int max_blocks =
+        RAJA::cuda::occupancy_max_active_blocks_per_sm((const void*)func,
+                                                       BlockSize) *
+        RAJA::cuda::device_prop().multiProcessorCount;
+    IndexType needed = (len + static_cast<IndexType>(BlockSize) - 1) /
+                       static_cast<IndexType>(BlockSize);
+    unsigned int num_blocks = static_cast<unsigned int>(
+        (needed < static_cast<IndexType>(max_blocks)) ? needed : max_blocks);
+    if (num_blocks < 1) {
+      num_blocks = 1;
+    }
+
+    T* block_partials =
+        RAJA::cuda::device_mempool_type::getInstance().malloc<T>(num_blocks);
+    T* total_out =
+        RAJA::cuda::pinned_mempool_type::getInstance().malloc<T>(1);
+
+    void* args[] = {(void*)&begin,
+                    (void*)&len,
+                    (void*)&init,
+                    (void*)&contribute,
+                    (void*)&transform,
+                    (void*)&block_partials,
+                    (void*)&total_out};
+    cudaErrchk(cudaLaunchCooperativeKernel((const void*)func,
+                                           cuda_dim_t{num_blocks, 1, 1},
+                                           cuda_dim_t{static_cast<cuda_dim_member_t>(BlockSize), 1, 1},
+                                           args,
+                                           0,
+                                           stream));
+    RAJA::cuda::launch(stream);
+
+    // the total is returned to the host, so this call synchronizes even
+    // for asynchronous policies
+    RAJA::cuda::synchronize(stream);
+
+    T total = *total_out;
+    RAJA::cuda::device_mempool_type::getInstance().free(block_partials);
+    RAJA::cuda::pinned_mempool_type::getInstance().free(total_out);
+    return total;
+  }
+
+  // no cooperative launch support: per-block partials, host combine,
+  // then the transform phase as an ordinary forall (two passes)
+  auto func = detail::reduce_partials_cuda_kernel<BlockSize,
+                                                  Iterator,
+                                                  IndexType,
+                                                  T,
+                                                  Function,
+                                                  ContribBody>;
+
+  unsigned int num_blocks = static_cast<unsigned int>(
+      ((len + static_cast<IndexType>(BlockSize) - 1) /
+       static_cast<IndexType>(BlockSize)));
+  constexpr unsigned int max_fallback_blocks = 1024;
+  if (num_blocks > max_fallback_blocks) {
+    num_blocks = max_fallback_blocks;
+  }
+
+  T* block_partials =
+      RAJA::cuda::pinned_mempool_type::getInstance().malloc<T>(num_blocks);
+
+  void* args[] = {(void*)&begin,
+                  (void*)&len,
+                  (void*)&init,
+                  (void*)&contribute,
+                  (void*)&block_partials};
+  RAJA::cuda::launch((const void*)func,
+                     cuda_dim_t{num_blocks, 1, 1},
+                     cuda_dim_t{static_cast<cuda_dim_member_t>(BlockSize), 1, 1},
+                     args,
+                     0,
+                     stream);
+  RAJA::cuda::synchronize(stream);
+
+  T total = init;
+  for (unsigned int p = 0; p < num_blocks; ++p) {
+    total = binop(total, block_partials[p]);
+  }
+  RAJA::cuda::pinned_mempool_type::getInstance().free(block_partials);
+
+  using ValueType = camp::decay<decltype(*begin)>;
+  forall<ExecPolicy>(seg, [=] RAJA_DEVICE(ValueType i) {
+    transform(i, total);
+  });
+
+  return total;
+}
+
+#endif  // RAJA_CUDA_ACTIVE
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
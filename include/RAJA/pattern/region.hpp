@@ -23,21 +23,53 @@
 
 #include "RAJA/policy/sequential/region.hpp"
 
+#include "RAJA/util/plugins.hpp"
+
 namespace RAJA
 {
 
 template <typename ExecutionPolicy, typename LoopBody>
 void region(LoopBody&& loop_body)
 {
+  // the region body is one open-ended notification for batched plugins
+  util::LaunchBatchScope batch(util::make_context<ExecutionPolicy>());
+
   region_impl(ExecutionPolicy(), loop_body);
 }
 
 template <typename ExecutionPolicy, typename OuterBody, typename InnerBody>
 void region(OuterBody&& outer_body, InnerBody&& inner_body)
 {
+  util::LaunchBatchScope batch(util::make_context<ExecutionPolicy>());
+
   region_impl(ExecutionPolicy(), outer_body, inner_body);
 }
 
+/*!
+ * \brief Run independent loop sequences as concurrent sections of one
+ *        region.
+ *
+ * Each body is a sequence of loops that is independent of the other
+ * bodies; the region policy decides whether the sections run
+ * concurrently (omp_parallel_sections_region, on disjoint thread
+ * subsets) or one after another (seq_sections_region).
+ *
+ * \code
+ *
+ * RAJA::region_sections<omp_parallel_sections_region>(
+ *   [=]() { // first loop sequence },
+ *   [=]() { // second loop sequence });
+ *
+ * \endcode
+ */
+template <typename ExecutionPolicy, typename... SectionBodies>
+void region_sections(SectionBodies&&... section_bodies)
+{
+  util::LaunchBatchScope batch(util::make_context<ExecutionPolicy>());
+
+  region_sections_impl(ExecutionPolicy(), section_bodies...);
+}
+
 }  // namespace RAJA
 
 
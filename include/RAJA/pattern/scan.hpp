@@ -26,31 +26,132 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/ScanContext.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/zip.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 namespace RAJA
 {
 
+namespace impl
+{
+namespace scan
+{
+
+/*!
+        \brief adapters threading a Host resource through the CPU scan
+   implementations; the calling thread(s) execute the scan directly, so
+   the resource carries no stream to forward
+*/
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_inplace(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  inclusive_inplace(p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_inplace(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  exclusive_inplace(p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  inclusive(p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  exclusive(p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_by_key(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  inclusive_by_key(p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_by_key(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  exclusive_by_key(p, std::forward<Args>(args)...);
+}
+
+/*!
+        \brief adapters dropping the scan context for the CPU scan
+   implementations, which retain no temporary storage between calls
+*/
+template <typename ExecPolicy, typename Context, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                                type_traits::is_scan_context<Context>>
+inclusive_inplace(resources::Host& r, Context&, const ExecPolicy& p, Args&&... args)
+{
+  inclusive_inplace(r, p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Context, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                                type_traits::is_scan_context<Context>>
+exclusive_inplace(resources::Host& r, Context&, const ExecPolicy& p, Args&&... args)
+{
+  exclusive_inplace(r, p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Context, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                                type_traits::is_scan_context<Context>>
+inclusive(resources::Host& r, Context&, const ExecPolicy& p, Args&&... args)
+{
+  inclusive(r, p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Context, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                                type_traits::is_scan_context<Context>>
+exclusive(resources::Host& r, Context&, const ExecPolicy& p, Args&&... args)
+{
+  exclusive(r, p, std::forward<Args>(args)...);
+}
+
+}  // namespace scan
+}  // namespace impl
+
 /*!
 ******************************************************************************
 *
 * \brief  inclusive in-place scan execution pattern
 *
+* \param[in] r Resource the scan runs on; device back-ends enqueue on the
+*resource's stream
 * \param[in] p Execution policy
 * \param[in,out] begin Pointer or Random-Access Iterator to start of data range
 * \param[in,out] end Pointer or Random-Access Iterator to end of data range
 *(exclusive)
 * \param[in] binop binary function to apply for scan
-* \param[in] value identity value for binary function, binop
+*
+* \return an event proxy for the scan's completion on the resource
 *
 ******************************************************************************
 */
 template <typename ExecPolicy,
+          typename Res,
           typename Iter,
           typename Function = operators::plus<RAJA::detail::IterVal<Iter>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<Iter>>
-inclusive_scan_inplace(const ExecPolicy &p,
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>>
+inclusive_scan_inplace(Res &r,
+                       const ExecPolicy &p,
                        Iter begin,
                        Iter end,
                        Function binop = Function{})
@@ -61,9 +162,40 @@ inclusive_scan_inplace(const ExecPolicy &p,
   static_assert(type_traits::is_random_access_iterator<Iter>::value,
                 "Iterator must model RandomAccessIterator");
   if (begin == end) {
-    return;
+    return resources::EventProxy<Res>(&r);
   }
-  impl::scan::inclusive_inplace(p, begin, end, binop);
+  impl::scan::inclusive_inplace(r, p, begin, end, binop);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive in-place scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Function = operators::plus<RAJA::detail::IterVal<Iter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>>
+inclusive_scan_inplace(const ExecPolicy &p,
+                       Iter begin,
+                       Iter end,
+                       Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return inclusive_scan_inplace(r, p, begin, end, binop);
 }
 
 /*!
@@ -71,6 +203,8 @@ inclusive_scan_inplace(const ExecPolicy &p,
 *
 * \brief  exclusive in-place scan execution pattern
 *
+* \param[in] r Resource the scan runs on; device back-ends enqueue on the
+*resource's stream
 * \param[in] p Execution policy
 * \param[in,out] begin Pointer or Random-Access Iterator to start of data range
 * \param[in,out] end Pointer or Random-Access Iterator to end of data range
@@ -78,15 +212,21 @@ inclusive_scan_inplace(const ExecPolicy &p,
 * \param[in] binop binary function to apply for scan
 * \param[in] value identity for binary function, binop
 *
+* \return an event proxy for the scan's completion on the resource
+*
 ******************************************************************************
 */
 template <typename ExecPolicy,
+          typename Res,
           typename Iter,
           typename T = RAJA::detail::IterVal<Iter>,
           typename Function = operators::plus<T>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<Iter>>
-exclusive_scan_inplace(const ExecPolicy &p,
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>>
+exclusive_scan_inplace(Res &r,
+                       const ExecPolicy &p,
                        Iter begin,
                        Iter end,
                        Function binop = Function{},
@@ -98,9 +238,42 @@ exclusive_scan_inplace(const ExecPolicy &p,
   static_assert(type_traits::is_random_access_iterator<Iter>::value,
                 "Iterator must model RandomAccessIterator");
   if (begin == end) {
-    return;
+    return resources::EventProxy<Res>(&r);
   }
-  impl::scan::exclusive_inplace(p, begin, end, binop, value);
+  impl::scan::exclusive_inplace(r, p, begin, end, binop, value);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive in-place scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity for binary function, binop
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename T = RAJA::detail::IterVal<Iter>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>>
+exclusive_scan_inplace(const ExecPolicy &p,
+                       Iter begin,
+                       Iter end,
+                       Function binop = Function{},
+                       T value = Function::identity())
+{
+  auto r = Res::get_default();
+  return exclusive_scan_inplace(r, p, begin, end, binop, value);
 }
 
 /*!
@@ -108,6 +281,8 @@ exclusive_scan_inplace(const ExecPolicy &p,
 *
 * \brief  inclusive scan execution pattern
 *
+* \param[in] r Resource the scan runs on; device back-ends enqueue on the
+*resource's stream
 * \param[in] p Execution policy
 * \param[in] begin Pointer or Random-Access Iterator to start of data range
 * \param[in] end Pointer or Random-Access Iterator to end of data range
@@ -115,20 +290,25 @@ exclusive_scan_inplace(const ExecPolicy &p,
 * \param[out] out Pointer or Random-Access Iterator to start of output data
 *range
 * \param[in] binop binary function to apply for scan
-* \param[in] value identity value for binary function, binop
+*
+* \return an event proxy for the scan's completion on the resource
 *
 * \note{The range of [begin, end) must be separate from [out, out + dist (begin,
 *end))}
 ******************************************************************************
 */
 template <typename ExecPolicy,
+          typename Res,
           typename Iter,
           typename IterOut,
           typename Function = operators::plus<RAJA::detail::IterVal<Iter>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<Iter>,
-                    type_traits::is_iterator<IterOut>>
-inclusive_scan(const ExecPolicy &p,
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+inclusive_scan(Res &r,
+               const ExecPolicy &p,
                Iter begin,
                Iter end,
                IterOut out,
@@ -143,9 +323,47 @@ inclusive_scan(const ExecPolicy &p,
   static_assert(type_traits::is_random_access_iterator<IterOut>::value,
                 "Output Iterator must model RandomAccessIterator");
   if (begin == end) {
-    return;
+    return resources::EventProxy<Res>(&r);
   }
-  impl::scan::inclusive(p, begin, end, out, binop);
+  impl::scan::inclusive(r, p, begin, end, out, binop);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Function = operators::plus<RAJA::detail::IterVal<Iter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+inclusive_scan(const ExecPolicy &p,
+               Iter begin,
+               Iter end,
+               IterOut out,
+               Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return inclusive_scan(r, p, begin, end, out, binop);
 }
 
 /*!
@@ -153,6 +371,8 @@ inclusive_scan(const ExecPolicy &p,
 *
 * \brief  exclusive scan execution pattern
 *
+* \param[in] r Resource the scan runs on; device back-ends enqueue on the
+*resource's stream
 * \param[in] p Execution policy
 * \param[in] begin Pointer or Random-Access Iterator to start of data range
 * \param[in] end Pointer or Random-Access Iterator to end of data range
@@ -162,19 +382,25 @@ inclusive_scan(const ExecPolicy &p,
 * \param[in] binop binary function to apply for scan
 * \param[in] value identity value for binary function, binop
 *
+* \return an event proxy for the scan's completion on the resource
+*
 * \note{The range of [begin, end) must be separate from [out, out + dist (begin,
 *end))}
 ******************************************************************************
 */
 template <typename ExecPolicy,
+          typename Res,
           typename Iter,
           typename IterOut,
           typename T = RAJA::detail::IterVal<Iter>,
           typename Function = operators::plus<T>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<Iter>,
-                    type_traits::is_iterator<IterOut>>
-exclusive_scan(const ExecPolicy &p,
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+exclusive_scan(Res &r,
+               const ExecPolicy &p,
                Iter begin,
                Iter end,
                IterOut out,
@@ -190,191 +416,1177 @@ exclusive_scan(const ExecPolicy &p,
   static_assert(type_traits::is_random_access_iterator<IterOut>::value,
                 "Output Iterator must model RandomAccessIterator");
   if (begin == end) {
-    return;
+    return resources::EventProxy<Res>(&r);
   }
-  impl::scan::exclusive(p, begin, end, out, binop, value);
+  impl::scan::exclusive(r, p, begin, end, out, binop, value);
+  return resources::EventProxy<Res>(&r);
 }
 
-// =============================================================================
-
 /*!
 ******************************************************************************
 *
-* \brief  inclusive in-place scan execution pattern
+* \brief  exclusive scan execution pattern
 *
 * \param[in] p Execution policy
-* \param[in,out] c Random-Access Container
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
 * \param[in] binop binary function to apply for scan
 * \param[in] value identity value for binary function, binop
 *
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
 ******************************************************************************
 */
 template <typename ExecPolicy,
-          typename Container,
-          typename Function = operators::plus<RAJA::detail::ContainerVal<Container>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>>
-inclusive_scan_inplace(const ExecPolicy &p,
-                       Container &c,
-                       Function binop = Function{})
+          typename Iter,
+          typename IterOut,
+          typename T = RAJA::detail::IterVal<Iter>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+exclusive_scan(const ExecPolicy &p,
+               Iter begin,
+               Iter end,
+               IterOut out,
+               Function binop = Function{},
+               T value = Function::identity())
 {
-  using R = RAJA::detail::ContainerVal<Container>;
-  static_assert(type_traits::is_binary_function<Function, R, R, R>::value,
-                "Function must model BinaryFunction");
-  static_assert(type_traits::is_random_access_range<Container>::value,
-                "Container must model RandomAccessRange");
-  if (std::begin(c) == std::end(c)) {
-    return;
-  }
-  impl::scan::inclusive_inplace(p, std::begin(c), std::end(c), binop);
+  auto r = Res::get_default();
+  return exclusive_scan(r, p, begin, end, out, binop, value);
 }
 
 /*!
 ******************************************************************************
 *
-* \brief  exclusive in-place scan execution pattern
+* \brief  inclusive scan-by-key execution pattern
 *
+* \param[in] r Resource the scan runs on; device back-ends enqueue on the
+*resource's stream
 * \param[in] p Execution policy
-* \param[in,out] c RandomAccess Container
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of key range
+* \param[in] keys_end Pointer or Random-Access Iterator to end of key range
+*(exclusive)
+* \param[in] values_in Pointer or Random-Access Iterator to start of input data
+*range
+* \param[out] values_out Pointer or Random-Access Iterator to start of output
+*data range
 * \param[in] binop binary function to apply for scan
-* \param[in] value identity for binary function, binop
 *
+* The scan restarts wherever consecutive keys compare unequal with
+* operator==, so each run of equal keys (segment) is scanned
+* independently in a single pass. Keys need not be globally unique,
+* only grouped into runs (e.g. the output of a sort or binning pass).
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{values_out may equal values_in for an in-place segmented scan;
+*otherwise the ranges must not overlap}
 ******************************************************************************
 */
 template <typename ExecPolicy,
-          typename Container,
-          typename T = RAJA::detail::ContainerVal<Container>,
-          typename Function = operators::plus<T>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>>
-exclusive_scan_inplace(const ExecPolicy &p,
-                       Container &c,
-                       Function binop = Function{},
-                       T value = Function::identity())
+          typename Res,
+          typename KeyIter,
+          typename Iter,
+          typename IterOut,
+          typename Function = operators::plus<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+inclusive_scan_by_key(Res &r,
+                      const ExecPolicy &p,
+                      KeyIter keys_begin,
+                      KeyIter keys_end,
+                      Iter values_in,
+                      IterOut values_out,
+                      Function binop = Function{})
 {
-  using R = RAJA::detail::ContainerVal<Container>;
+  using R = RAJA::detail::IterVal<IterOut>;
+  using T = RAJA::detail::IterVal<Iter>;
   static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
                 "Function must model BinaryFunction");
-  static_assert(type_traits::is_random_access_range<Container>::value,
-                "Container must model RandomAccessRange");
-  if (std::begin(c) == std::end(c)) {
-    return;
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Key Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return resources::EventProxy<Res>(&r);
   }
-  impl::scan::exclusive_inplace(p, std::begin(c), std::end(c), binop, value);
+  impl::scan::inclusive_by_key(r, p, keys_begin, keys_end, values_in,
+                               values_out, binop);
+  return resources::EventProxy<Res>(&r);
 }
 
 /*!
 ******************************************************************************
 *
-* \brief  inclusive scan execution pattern
+* \brief  inclusive scan-by-key execution pattern
 *
 * \param[in] p Execution policy
-* \param[in] c Random-Access Container
-* \param[out] out Pointer or Random-Access Iterator to start of output data
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of key range
+* \param[in] keys_end Pointer or Random-Access Iterator to end of key range
+*(exclusive)
+* \param[in] values_in Pointer or Random-Access Iterator to start of input data
 *range
+* \param[out] values_out Pointer or Random-Access Iterator to start of output
+*data range
 * \param[in] binop binary function to apply for scan
-* \param[in] value identity value for binary function, binop
 *
-* \note{The range of [begin, end) must be separate from [out, out + (end -
-*begin))}
+* \note{values_out may equal values_in for an in-place segmented scan;
+*otherwise the ranges must not overlap}
 ******************************************************************************
 */
 template <typename ExecPolicy,
-          typename Container,
+          typename KeyIter,
+          typename Iter,
           typename IterOut,
-          typename Function = operators::plus<RAJA::detail::ContainerVal<Container>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>,
-                    type_traits::is_iterator<IterOut>>
-inclusive_scan(const ExecPolicy &p,
-               const Container &c,
-               IterOut out,
-               Function binop = Function{})
+          typename Function = operators::plus<RAJA::detail::IterVal<Iter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+inclusive_scan_by_key(const ExecPolicy &p,
+                      KeyIter keys_begin,
+                      KeyIter keys_end,
+                      Iter values_in,
+                      IterOut values_out,
+                      Function binop = Function{})
 {
-  using R = RAJA::detail::IterVal<IterOut>;
-  using T = RAJA::detail::ContainerVal<Container>;
-  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
-                "Function must model BinaryFunction");
-  static_assert(type_traits::is_random_access_range<Container>::value,
-                "Container must model RandomAccessRange");
-  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
-                "Output Iterator must model RandomAccessIterator");
-  if (std::begin(c) == std::end(c)) {
-    return;
-  }
-  impl::scan::inclusive(p, std::begin(c), std::end(c), out, binop);
+  auto r = Res::get_default();
+  return inclusive_scan_by_key(r, p, keys_begin, keys_end, values_in,
+                               values_out, binop);
 }
 
 /*!
 ******************************************************************************
 *
-* \brief  exclusive scan execution pattern
+* \brief  exclusive scan-by-key execution pattern
 *
+* \param[in] r Resource the scan runs on; device back-ends enqueue on the
+*resource's stream
 * \param[in] p Execution policy
-* \param[in] c Random-Access Container
-* \param[out] out Pointer or Random-Access Iterator to start of output data
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of key range
+* \param[in] keys_end Pointer or Random-Access Iterator to end of key range
+*(exclusive)
+* \param[in] values_in Pointer or Random-Access Iterator to start of input data
 *range
+* \param[out] values_out Pointer or Random-Access Iterator to start of output
+*data range
 * \param[in] binop binary function to apply for scan
 * \param[in] value identity value for binary function, binop
 *
-* \note{The range of [begin, end) must be separate from [out, out + (end -
-*begin))}
+* The scan restarts from value wherever consecutive keys compare
+* unequal with operator==, so with the default plus each output is its
+* element's offset within its run of equal keys (e.g. a particle's slot
+* within its bin).
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{values_out may equal values_in for an in-place segmented scan;
+*otherwise the ranges must not overlap}
 ******************************************************************************
 */
 template <typename ExecPolicy,
-          typename Container,
+          typename Res,
+          typename KeyIter,
+          typename Iter,
           typename IterOut,
-          typename T = RAJA::detail::ContainerVal<Container>,
+          typename T = RAJA::detail::IterVal<Iter>,
           typename Function = operators::plus<T>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>,
-                    type_traits::is_iterator<IterOut>>
-exclusive_scan(const ExecPolicy &p,
-               const Container &c,
-               IterOut out,
-               Function binop = Function{},
-               T value = Function::identity())
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+exclusive_scan_by_key(Res &r,
+                      const ExecPolicy &p,
+                      KeyIter keys_begin,
+                      KeyIter keys_end,
+                      Iter values_in,
+                      IterOut values_out,
+                      Function binop = Function{},
+                      T value = Function::identity())
 {
   using R = RAJA::detail::IterVal<IterOut>;
-  using U = RAJA::detail::ContainerVal<Container>;
+  using U = RAJA::detail::IterVal<Iter>;
   static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
                 "Function must model BinaryFunction");
-  static_assert(type_traits::is_random_access_range<Container>::value,
-                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Key Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
   static_assert(type_traits::is_random_access_iterator<IterOut>::value,
                 "Output Iterator must model RandomAccessIterator");
-  if (std::begin(c) == std::end(c)) {
-    return;
+  if (keys_begin == keys_end) {
+    return resources::EventProxy<Res>(&r);
   }
-  impl::scan::exclusive(p, std::begin(c), std::end(c), out, binop, value);
+  impl::scan::exclusive_by_key(r, p, keys_begin, keys_end, values_in,
+                               values_out, binop, value);
+  return resources::EventProxy<Res>(&r);
 }
 
-template <typename ExecPolicy, typename... Args>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
-exclusive_scan(Args &&... args)
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan-by-key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of key range
+* \param[in] keys_end Pointer or Random-Access Iterator to end of key range
+*(exclusive)
+* \param[in] values_in Pointer or Random-Access Iterator to start of input data
+*range
+* \param[out] values_out Pointer or Random-Access Iterator to start of output
+*data range
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \note{values_out may equal values_in for an in-place segmented scan;
+*otherwise the ranges must not overlap}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Iter,
+          typename IterOut,
+          typename T = RAJA::detail::IterVal<Iter>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+exclusive_scan_by_key(const ExecPolicy &p,
+                      KeyIter keys_begin,
+                      KeyIter keys_end,
+                      Iter values_in,
+                      IterOut values_out,
+                      Function binop = Function{},
+                      T value = Function::identity())
 {
-  exclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+  auto r = Res::get_default();
+  return exclusive_scan_by_key(r, p, keys_begin, keys_end, values_in,
+                               values_out, binop, value);
 }
 
-template <typename ExecPolicy, typename... Args>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
-inclusive_scan(Args &&... args)
-{
-  inclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
-}
+// =============================================================================
 
-template <typename ExecPolicy, typename... Args>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
-exclusive_scan_inplace(Args &&... args)
+/*!
+******************************************************************************
+*
+* \brief  inclusive in-place scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>>
+inclusive_scan_inplace(const ExecPolicy &p,
+                       Container &c,
+                       Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  auto r = Res::get_default();
+  return inclusive_scan_inplace(r, p, std::begin(c), std::end(c), binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive in-place scan execution pattern on a resource
+*
+* \param[in] r Resource the scan runs on
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] binop binary function to apply for scan
+*
+* \return an event proxy for the scan's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<Container>>
+inclusive_scan_inplace(Res &r,
+                       const ExecPolicy &p,
+                       Container &c,
+                       Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return inclusive_scan_inplace(r, p, std::begin(c), std::end(c), binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive in-place scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity for binary function, binop
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename T = RAJA::detail::ContainerVal<Container>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>>
+exclusive_scan_inplace(const ExecPolicy &p,
+                       Container &c,
+                       Function binop = Function{},
+                       T value = Function::identity())
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  auto r = Res::get_default();
+  return exclusive_scan_inplace(r, p, std::begin(c), std::end(c), binop, value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive in-place scan execution pattern on a resource
+*
+* \param[in] r Resource the scan runs on
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity for binary function, binop
+*
+* \return an event proxy for the scan's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename T = RAJA::detail::ContainerVal<Container>,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<Container>>
+exclusive_scan_inplace(Res &r,
+                       const ExecPolicy &p,
+                       Container &c,
+                       Function binop = Function{},
+                       T value = Function::identity())
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return exclusive_scan_inplace(r, p, std::begin(c), std::end(c), binop, value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      type_traits::is_iterator<IterOut>>
+inclusive_scan(const ExecPolicy &p,
+               const Container &c,
+               IterOut out,
+               Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  auto r = Res::get_default();
+  return inclusive_scan(r, p, std::begin(c), std::end(c), out, binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan execution pattern on a resource
+*
+* \param[in] r Resource the scan runs on
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename IterOut,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<Container>,
+                      type_traits::is_iterator<IterOut>>
+inclusive_scan(Res &r,
+               const ExecPolicy &p,
+               const Container &c,
+               IterOut out,
+               Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return inclusive_scan(r, p, std::begin(c), std::end(c), out, binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename T = RAJA::detail::ContainerVal<Container>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      type_traits::is_iterator<IterOut>>
+exclusive_scan(const ExecPolicy &p,
+               const Container &c,
+               IterOut out,
+               Function binop = Function{},
+               T value = Function::identity())
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  auto r = Res::get_default();
+  return exclusive_scan(r, p, std::begin(c), std::end(c), out, binop, value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan execution pattern on a resource
+*
+* \param[in] r Resource the scan runs on
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename IterOut,
+          typename T = RAJA::detail::ContainerVal<Container>,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<Container>,
+                      type_traits::is_iterator<IterOut>>
+exclusive_scan(Res &r,
+               const ExecPolicy &p,
+               const Container &c,
+               IterOut out,
+               Function binop = Function{},
+               T value = Function::identity())
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return exclusive_scan(r, p, std::begin(c), std::end(c), out, binop, value);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive in-place scan retaining its workspace in a scan context
+*
+* \param[in] r Resource the scan runs on
+* \param[in] p Execution policy
+* \param[in,out] ctx Scan context retaining the temporary workspace; see
+*get_scan_context for the context type matching the policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] binop binary function to apply for scan
+*
+* The context keeps the maximum-size temporary workspace across calls, so
+* pipelines scanning many ranges of varying length size it once for the
+* largest range; any scan no longer than one the context already covered
+* involves neither an allocation nor a workspace size query. Back-ends
+* whose scans need no temporary storage ignore the context.
+*
+* \return an event proxy for the scan's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Context,
+          typename Iter,
+          typename Function = operators::plus<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_scan_context<Context>,
+                      type_traits::is_iterator<Iter>>
+inclusive_scan_inplace(Res &r,
+                       const ExecPolicy &p,
+                       Context &ctx,
+                       Iter begin,
+                       Iter end,
+                       Function binop = Function{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return resources::EventProxy<Res>(&r);
+  }
+  impl::scan::inclusive_inplace(r, ctx, p, begin, end, binop);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive in-place scan retaining its workspace in a scan context
+*
+* \param[in] p Execution policy
+* \param[in,out] ctx Scan context retaining the temporary workspace
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] binop binary function to apply for scan
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Context,
+          typename Iter,
+          typename Function = operators::plus<RAJA::detail::IterVal<Iter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_scan_context<Context>,
+                      type_traits::is_iterator<Iter>>
+inclusive_scan_inplace(const ExecPolicy &p,
+                       Context &ctx,
+                       Iter begin,
+                       Iter end,
+                       Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return inclusive_scan_inplace(r, p, ctx, begin, end, binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive in-place scan retaining its workspace in a scan context
+*
+* \param[in] r Resource the scan runs on
+* \param[in] p Execution policy
+* \param[in,out] ctx Scan context retaining the temporary workspace
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity for binary function, binop
+*
+* \return an event proxy for the scan's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Context,
+          typename Iter,
+          typename T = RAJA::detail::IterVal<Iter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_scan_context<Context>,
+                      type_traits::is_iterator<Iter>>
+exclusive_scan_inplace(Res &r,
+                       const ExecPolicy &p,
+                       Context &ctx,
+                       Iter begin,
+                       Iter end,
+                       Function binop = Function{},
+                       T value = Function::identity())
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return resources::EventProxy<Res>(&r);
+  }
+  impl::scan::exclusive_inplace(r, ctx, p, begin, end, binop, value);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive in-place scan retaining its workspace in a scan context
+*
+* \param[in] p Execution policy
+* \param[in,out] ctx Scan context retaining the temporary workspace
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity for binary function, binop
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Context,
+          typename Iter,
+          typename T = RAJA::detail::IterVal<Iter>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_scan_context<Context>,
+                      type_traits::is_iterator<Iter>>
+exclusive_scan_inplace(const ExecPolicy &p,
+                       Context &ctx,
+                       Iter begin,
+                       Iter end,
+                       Function binop = Function{},
+                       T value = Function::identity())
 {
-  exclusive_scan_inplace(ExecPolicy{}, std::forward<Args>(args)...);
+  auto r = Res::get_default();
+  return exclusive_scan_inplace(r, p, ctx, begin, end, binop, value);
 }
 
-template <typename ExecPolicy, typename... Args>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan retaining its workspace in a scan context
+*
+* \param[in] r Resource the scan runs on
+* \param[in] p Execution policy
+* \param[in,out] ctx Scan context retaining the temporary workspace
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Context,
+          typename Iter,
+          typename IterOut,
+          typename Function = operators::plus<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_scan_context<Context>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+inclusive_scan(Res &r,
+               const ExecPolicy &p,
+               Context &ctx,
+               Iter begin,
+               Iter end,
+               IterOut out,
+               Function binop = Function{})
+{
+  using R = RAJA::detail::IterVal<IterOut>;
+  using T = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return resources::EventProxy<Res>(&r);
+  }
+  impl::scan::inclusive(r, ctx, p, begin, end, out, binop);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan retaining its workspace in a scan context
+*
+* \param[in] p Execution policy
+* \param[in,out] ctx Scan context retaining the temporary workspace
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Context,
+          typename Iter,
+          typename IterOut,
+          typename Function = operators::plus<RAJA::detail::IterVal<Iter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_scan_context<Context>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+inclusive_scan(const ExecPolicy &p,
+               Context &ctx,
+               Iter begin,
+               Iter end,
+               IterOut out,
+               Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return inclusive_scan(r, p, ctx, begin, end, out, binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan retaining its workspace in a scan context
+*
+* \param[in] r Resource the scan runs on
+* \param[in] p Execution policy
+* \param[in,out] ctx Scan context retaining the temporary workspace
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Context,
+          typename Iter,
+          typename IterOut,
+          typename T = RAJA::detail::IterVal<Iter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_scan_context<Context>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+exclusive_scan(Res &r,
+               const ExecPolicy &p,
+               Context &ctx,
+               Iter begin,
+               Iter end,
+               IterOut out,
+               Function binop = Function{},
+               T value = Function::identity())
+{
+  using R = RAJA::detail::IterVal<IterOut>;
+  using U = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return resources::EventProxy<Res>(&r);
+  }
+  impl::scan::exclusive(r, ctx, p, begin, end, out, binop, value);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan retaining its workspace in a scan context
+*
+* \param[in] p Execution policy
+* \param[in,out] ctx Scan context retaining the temporary workspace
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Context,
+          typename Iter,
+          typename IterOut,
+          typename T = RAJA::detail::IterVal<Iter>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_scan_context<Context>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>>
+exclusive_scan(const ExecPolicy &p,
+               Context &ctx,
+               Iter begin,
+               Iter end,
+               IterOut out,
+               Function binop = Function{},
+               T value = Function::identity())
+{
+  auto r = Res::get_default();
+  return exclusive_scan(r, p, ctx, begin, end, out, binop, value);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan over multiple zipped sequences in one traversal
+*
+* \param[in] n Length of the zipped sequences
+* \param[in] in ZipIterator over the starts of the input sequences
+* \param[out] out ZipIterator over the starts of the output sequences
+*
+* Each zipped sequence is scanned independently with operators::plus on
+* its own element type, but all sequences are combined in a single sweep
+* rather than one scan call (and one full pass) per sequence. The CUDA
+* and HIP back-ends issue one device scan over the fused tuple type.
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{Each input range must be separate from its output range}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IndexType,
+          typename... InIters,
+          typename... OutIters,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_integral<IndexType>>
+inclusive_scan_zip(IndexType n,
+                   ZipIterator<InIters...> in,
+                   ZipIterator<OutIters...> out)
+{
+  return inclusive_scan(ExecPolicy{}, in,
+                        in + static_cast<std::ptrdiff_t>(n), out);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan over multiple zipped sequences on a resource
+*
+* \param[in] r Resource the scan runs on; device back-ends enqueue on the
+*resource's stream
+* \param[in] n Length of the zipped sequences
+* \param[in] in ZipIterator over the starts of the input sequences
+* \param[out] out ZipIterator over the starts of the output sequences
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{Each input range must be separate from its output range}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename IndexType,
+          typename... InIters,
+          typename... OutIters>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>,
+                                  type_traits::is_integral<IndexType>>
+inclusive_scan_zip(Res &r,
+                   IndexType n,
+                   ZipIterator<InIters...> in,
+                   ZipIterator<OutIters...> out)
+{
+  return inclusive_scan(r, ExecPolicy{}, in,
+                        in + static_cast<std::ptrdiff_t>(n), out);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan over multiple zipped sequences in one traversal
+*
+* \param[in] n Length of the zipped sequences
+* \param[in] in ZipIterator over the starts of the input sequences
+* \param[out] out ZipIterator over the starts of the output sequences
+*
+* Each zipped sequence gets an exclusive plus-scan from its element
+* type's identity, all combined in a single sweep:
+*
+*     RAJA::exclusive_scan_zip<policy>(n, RAJA::zip(c0, c1, c2, c3),
+*                                         RAJA::zip(o0, o1, o2, o3));
+*
+* replaces four exclusive_scan calls over the same length.
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{Each input range must be separate from its output range}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IndexType,
+          typename... InIters,
+          typename... OutIters,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_integral<IndexType>>
+exclusive_scan_zip(IndexType n,
+                   ZipIterator<InIters...> in,
+                   ZipIterator<OutIters...> out)
+{
+  return exclusive_scan(ExecPolicy{}, in,
+                        in + static_cast<std::ptrdiff_t>(n), out);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan over multiple zipped sequences on a resource
+*
+* \param[in] r Resource the scan runs on; device back-ends enqueue on the
+*resource's stream
+* \param[in] n Length of the zipped sequences
+* \param[in] in ZipIterator over the starts of the input sequences
+* \param[out] out ZipIterator over the starts of the output sequences
+*
+* \return an event proxy for the scan's completion on the resource
+*
+* \note{Each input range must be separate from its output range}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename IndexType,
+          typename... InIters,
+          typename... OutIters>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>,
+                                  type_traits::is_integral<IndexType>>
+exclusive_scan_zip(Res &r,
+                   IndexType n,
+                   ZipIterator<InIters...> in,
+                   ZipIterator<OutIters...> out)
+{
+  return exclusive_scan(r, ExecPolicy{}, in,
+                        in + static_cast<std::ptrdiff_t>(n), out);
+}
+
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan(Args &&... args)
+{
+  return exclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+exclusive_scan(Res &r, Args &&... args)
+{
+  return exclusive_scan(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan(Args &&... args)
+{
+  return inclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+inclusive_scan(Res &r, Args &&... args)
+{
+  return inclusive_scan(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_inplace(Args &&... args)
+{
+  return exclusive_scan_inplace(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+exclusive_scan_inplace(Res &r, Args &&... args)
+{
+  return exclusive_scan_inplace(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>>
 inclusive_scan_inplace(Args &&... args)
 {
-  inclusive_scan_inplace(ExecPolicy{}, std::forward<Args>(args)...);
+  return inclusive_scan_inplace(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+inclusive_scan_inplace(Res &r, Args &&... args)
+{
+  return inclusive_scan_inplace(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan_by_key(Args &&... args)
+{
+  return inclusive_scan_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+inclusive_scan_by_key(Res &r, Args &&... args)
+{
+  return inclusive_scan_by_key(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_by_key(Args &&... args)
+{
+  return exclusive_scan_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+exclusive_scan_by_key(Res &r, Args &&... args)
+{
+  return exclusive_scan_by_key(r, ExecPolicy{}, std::forward<Args>(args)...);
 }
 
 }  // namespace RAJA
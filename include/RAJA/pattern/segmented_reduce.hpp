@@ -0,0 +1,246 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented reduce declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_segmented_reduce_HPP
+#define RAJA_segmented_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+namespace impl
+{
+namespace segmented
+{
+
+/*!
+        \brief adapter threading a Host resource through the CPU segmented
+   reduce implementations; the calling thread(s) execute directly, so the
+   resource carries no stream to forward
+*/
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+reduce(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  reduce(p, std::forward<Args>(args)...);
+}
+
+}  // namespace segmented
+}  // namespace impl
+
+/*!
+******************************************************************************
+*
+* \brief  segmented reduction over CSR-style offsets on a resource
+*
+* Reduces each segment of values into one output entry, where segment s
+* spans values[offsets[s]] up to (not including) values[offsets[s+1]] in
+* the manner of CSR row offsets. The offsets range holds N + 1 entries
+* for N segments and the output range holds N entries; empty segments
+* yield init.
+*
+* \param[in] r Resource the reduction runs on; device back-ends enqueue on
+*the resource's stream
+* \param[in] p Execution policy
+* \param[in] values_begin Pointer or Random-Access Iterator to start of
+*values
+* \param[in] values_end Pointer or Random-Access Iterator to end of values
+*(exclusive); the distance must equal the last offset
+* \param[in] offsets_begin Pointer or Random-Access Iterator to start of
+*segment offsets
+* \param[in] offsets_end Pointer or Random-Access Iterator to end of segment
+*offsets (exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of per-segment
+*results
+* \param[in] binop binary function to apply for reduction
+* \param[in] init initial value each segment's reduction starts from
+*
+* \return an event proxy for the reduction's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename ValueIter,
+          typename OffsetIter,
+          typename OutIter,
+          typename T = RAJA::detail::IterVal<ValueIter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<ValueIter>,
+                      type_traits::is_iterator<OffsetIter>,
+                      type_traits::is_iterator<OutIter>>
+segmented_reduce(Res& r,
+                 const ExecPolicy& p,
+                 ValueIter values_begin,
+                 ValueIter values_end,
+                 OffsetIter offsets_begin,
+                 OffsetIter offsets_end,
+                 OutIter out,
+                 Function binop = Function{},
+                 T init = Function::identity())
+{
+  static_assert(type_traits::is_binary_function<Function, T, T, T>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<ValueIter>::value,
+                "ValueIter must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "OffsetIter must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OutIter>::value,
+                "OutIter must model RandomAccessIterator");
+  using std::distance;
+  const auto num_segments = distance(offsets_begin, offsets_end) - 1;
+  if (num_segments <= 0) {
+    return resources::EventProxy<Res>(&r);
+  }
+  impl::segmented::reduce(r, p, values_begin,
+                          static_cast<Index_type>(distance(values_begin,
+                                                           values_end)),
+                          offsets_begin,
+                          static_cast<Index_type>(num_segments), out, binop,
+                          init);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented reduction over CSR-style offsets
+*
+* \param[in] p Execution policy
+* \param[in] values_begin Pointer or Random-Access Iterator to start of
+*values
+* \param[in] values_end Pointer or Random-Access Iterator to end of values
+*(exclusive); the distance must equal the last offset
+* \param[in] offsets_begin Pointer or Random-Access Iterator to start of
+*segment offsets
+* \param[in] offsets_end Pointer or Random-Access Iterator to end of segment
+*offsets (exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of per-segment
+*results
+* \param[in] binop binary function to apply for reduction
+* \param[in] init initial value each segment's reduction starts from
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ValueIter,
+          typename OffsetIter,
+          typename OutIter,
+          typename T = RAJA::detail::IterVal<ValueIter>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<ValueIter>,
+                      type_traits::is_iterator<OffsetIter>,
+                      type_traits::is_iterator<OutIter>>
+segmented_reduce(const ExecPolicy& p,
+                 ValueIter values_begin,
+                 ValueIter values_end,
+                 OffsetIter offsets_begin,
+                 OffsetIter offsets_end,
+                 OutIter out,
+                 Function binop = Function{},
+                 T init = Function::identity())
+{
+  auto r = Res::get_default();
+  return segmented_reduce(r, p, values_begin, values_end, offsets_begin,
+                          offsets_end, out, binop, init);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented reduction over CSR-style offsets on a resource, with
+*         execution policy given as a template parameter
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename ValueIter,
+          typename OffsetIter,
+          typename OutIter,
+          typename T = RAJA::detail::IterVal<ValueIter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<ValueIter>,
+                      type_traits::is_iterator<OffsetIter>,
+                      type_traits::is_iterator<OutIter>>
+segmented_reduce(Res& r,
+                 ValueIter values_begin,
+                 ValueIter values_end,
+                 OffsetIter offsets_begin,
+                 OffsetIter offsets_end,
+                 OutIter out,
+                 Function binop = Function{},
+                 T init = Function::identity())
+{
+  return segmented_reduce(r, ExecPolicy{}, values_begin, values_end,
+                          offsets_begin, offsets_end, out, binop, init);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented reduction over CSR-style offsets, with execution policy
+*         given as a template parameter
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ValueIter,
+          typename OffsetIter,
+          typename OutIter,
+          typename T = RAJA::detail::IterVal<ValueIter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if_t<
+    resources::EventProxy<typename resources::get_resource<ExecPolicy>::type>,
+    type_traits::is_execution_policy<ExecPolicy>,
+    type_traits::is_iterator<ValueIter>,
+    type_traits::is_iterator<OffsetIter>,
+    type_traits::is_iterator<OutIter>>
+segmented_reduce(ValueIter values_begin,
+                 ValueIter values_end,
+                 OffsetIter offsets_begin,
+                 OffsetIter offsets_end,
+                 OutIter out,
+                 Function binop = Function{},
+                 T init = Function::identity())
+{
+  return segmented_reduce(ExecPolicy{}, values_begin, values_end,
+                          offsets_begin, offsets_end, out, binop, init);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -20,36 +20,125 @@
 
 #include "RAJA/config.hpp"
 
+#include <climits>
 #include <iterator>
 #include <type_traits>
 
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/sort.hpp"
+#include "RAJA/index/RangeSegment.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/forall.hpp"
 
 namespace RAJA
 {
 
+namespace impl
+{
+namespace sort
+{
+
+/*!
+        \brief adapters threading a Host resource through the CPU sort
+   implementations; the calling thread(s) execute the sort directly, so
+   the resource carries no stream to forward
+*/
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+unstable(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  unstable(p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+stable(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  stable(p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+unstable_pairs(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  unstable_pairs(p, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+stable_pairs(resources::Host&, const ExecPolicy& p, Args&&... args)
+{
+  stable_pairs(p, std::forward<Args>(args)...);
+}
+
+/*!
+    \brief generic fallback for bit-limited stable pair sort; compares only
+    the low num_key_bits of each key, so ordering matches radix backends
+    that skip the passes over higher bits
+*/
+template <typename Res, typename ExecPolicy, typename KeyIter, typename ValIter>
+concepts::enable_if<type_traits::is_resource<Res>,
+                    type_traits::is_execution_policy<ExecPolicy>,
+                    concepts::negate<type_traits::is_cuda_policy<ExecPolicy>>>
+stable_pairs_bits(Res &r,
+                  const ExecPolicy &p,
+                  KeyIter keys_begin,
+                  KeyIter keys_end,
+                  ValIter vals_begin,
+                  int num_key_bits)
+{
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using UK = typename std::make_unsigned<K>::type;
+
+  const int key_width = static_cast<int>(sizeof(K) * CHAR_BIT);
+  const UK mask = (num_key_bits >= key_width)
+                      ? static_cast<UK>(~UK(0))
+                      : static_cast<UK>((UK(1) << num_key_bits) - UK(1));
+
+  stable_pairs(r,
+               p,
+               keys_begin,
+               keys_end,
+               vals_begin,
+               [mask] RAJA_HOST_DEVICE(K lhs, K rhs) {
+                 return (static_cast<UK>(lhs) & mask) <
+                        (static_cast<UK>(rhs) & mask);
+               });
+}
+
+}  // namespace sort
+}  // namespace impl
+
 /*!
 ******************************************************************************
 *
-* \brief  sort execution pattern
+* \brief  sort execution pattern on a resource
 *
+* \param[in] r Resource the sort runs on; device back-ends enqueue on the
+*resource's stream
 * \param[in] p Execution policy
 * \param[in,out] begin Pointer or Random-Access Iterator to start of data range
 * \param[in,out] end Pointer or Random-Access Iterator to end of data range
 *(exclusive)
 * \param[in] comp comparison function to apply for sort
 *
+* \return an event proxy for the sort's completion on the resource
+*
 ******************************************************************************
 */
 template <typename ExecPolicy,
+          typename Res,
           typename Iter,
           typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<Iter>>
-sort(const ExecPolicy &p,
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>>
+sort(Res &r,
+     const ExecPolicy &p,
      Iter begin,
      Iter end,
      Compare comp = Compare{})
@@ -59,28 +148,66 @@ sort(const ExecPolicy &p,
                 "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_iterator<Iter>::value,
                 "Iterator must model RandomAccessIterator");
-  impl::sort::unstable(p, begin, end, comp);
+  impl::sort::unstable(r, p, begin, end, comp);
+  return resources::EventProxy<Res>(&r);
 }
 
 /*!
 ******************************************************************************
 *
-* \brief  stable sort execution pattern
+* \brief  sort execution pattern
 *
 * \param[in] p Execution policy
 * \param[in,out] begin Pointer or Random-Access Iterator to start of data range
 * \param[in,out] end Pointer or Random-Access Iterator to end of data range
 *(exclusive)
+* \param[in] comp comparison function to apply for sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>>
+sort(const ExecPolicy &p,
+     Iter begin,
+     Iter end,
+     Compare comp = Compare{})
+{
+  auto r = Res::get_default();
+  return sort(r, p, begin, end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort execution pattern on a resource
+*
+* \param[in] r Resource the sort runs on; device back-ends enqueue on the
+*resource's stream
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
 * \param[in] comp comparison function to apply for stable_sort
 *
+* \return an event proxy for the sort's completion on the resource
+*
 ******************************************************************************
 */
 template <typename ExecPolicy,
+          typename Res,
           typename Iter,
           typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<Iter>>
-stable_sort(const ExecPolicy &p,
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>>
+stable_sort(Res &r,
+            const ExecPolicy &p,
             Iter begin,
             Iter end,
             Compare comp = Compare{})
@@ -90,30 +217,68 @@ stable_sort(const ExecPolicy &p,
                 "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_iterator<Iter>::value,
                 "Iterator must model RandomAccessIterator");
-  impl::sort::stable(p, begin, end, comp);
+  impl::sort::stable(r, p, begin, end, comp);
+  return resources::EventProxy<Res>(&r);
 }
 
 /*!
 ******************************************************************************
 *
-* \brief  sort pairs execution pattern
+* \brief  stable sort execution pattern
 *
 * \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function to apply for stable_sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>>
+stable_sort(const ExecPolicy &p,
+            Iter begin,
+            Iter end,
+            Compare comp = Compare{})
+{
+  auto r = Res::get_default();
+  return stable_sort(r, p, begin, end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort pairs execution pattern on a resource
+*
+* \param[in] r Resource the sort runs on; device back-ends enqueue on the
+*resource's stream
+* \param[in] p Execution policy
 * \param[in,out] keys_begin Pointer or Random-Access Iterator to start of data keys range
 * \param[in,out] keys_end Pointer or Random-Access Iterator to end of data keys range
 * \param[in,out] vals_begin Pointer or Random-Access Iterator to start of data values range
 * \param[in] comp comparison function to apply for sort
 *
+* \return an event proxy for the sort's completion on the resource
+*
 ******************************************************************************
 */
 template <typename ExecPolicy,
+          typename Res,
           typename KeyIter,
           typename ValIter,
           typename Compare = operators::less<RAJA::detail::IterVal<KeyIter>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<KeyIter>,
-                    type_traits::is_iterator<ValIter>>
-sort_pairs(const ExecPolicy &p,
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<ValIter>>
+sort_pairs(Res &r,
+           const ExecPolicy &p,
            KeyIter keys_begin,
            KeyIter keys_end,
            ValIter vals_begin,
@@ -126,30 +291,71 @@ sort_pairs(const ExecPolicy &p,
                 "Keys Iterator must model RandomAccessIterator");
   static_assert(type_traits::is_random_access_iterator<ValIter>::value,
                 "Vals Iterator must model RandomAccessIterator");
-  impl::sort::unstable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+  impl::sort::unstable_pairs(r, p, keys_begin, keys_end, vals_begin, comp);
+  return resources::EventProxy<Res>(&r);
 }
 
 /*!
 ******************************************************************************
 *
-* \brief  stable sort pairs execution pattern
+* \brief  sort pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of data keys range
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of data keys range
+* \param[in,out] vals_begin Pointer or Random-Access Iterator to start of data values range
+* \param[in] comp comparison function to apply for sort
 *
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<KeyIter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<ValIter>>
+sort_pairs(const ExecPolicy &p,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare comp = Compare{})
+{
+  auto r = Res::get_default();
+  return sort_pairs(r, p, keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort pairs execution pattern on a resource
+*
+* \param[in] r Resource the sort runs on; device back-ends enqueue on the
+*resource's stream
 * \param[in] p Execution policy
 * \param[in,out] keys_begin Pointer or Random-Access Iterator to start of data keys range
 * \param[in,out] keys_end Pointer or Random-Access Iterator to end of data keys range
 * \param[in,out] vals_begin Pointer or Random-Access Iterator to start of data values range
 * \param[in] comp comparison function to apply for stable_sort
 *
+* \return an event proxy for the sort's completion on the resource
+*
 ******************************************************************************
 */
 template <typename ExecPolicy,
+          typename Res,
           typename KeyIter,
           typename ValIter,
           typename Compare = operators::less<RAJA::detail::IterVal<KeyIter>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<KeyIter>,
-                    type_traits::is_iterator<ValIter>>
-stable_sort_pairs(const ExecPolicy &p,
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<ValIter>>
+stable_sort_pairs(Res &r,
+                  const ExecPolicy &p,
                   KeyIter keys_begin,
                   KeyIter keys_end,
                   ValIter vals_begin,
@@ -162,7 +368,40 @@ stable_sort_pairs(const ExecPolicy &p,
                 "Keys Iterator must model RandomAccessIterator");
   static_assert(type_traits::is_random_access_iterator<ValIter>::value,
                 "Vals Iterator must model RandomAccessIterator");
-  impl::sort::stable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+  impl::sort::stable_pairs(r, p, keys_begin, keys_end, vals_begin, comp);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of data keys range
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of data keys range
+* \param[in,out] vals_begin Pointer or Random-Access Iterator to start of data values range
+* \param[in] comp comparison function to apply for stable_sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<KeyIter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<ValIter>>
+stable_sort_pairs(const ExecPolicy &p,
+                  KeyIter keys_begin,
+                  KeyIter keys_end,
+                  ValIter vals_begin,
+                  Compare comp = Compare{})
+{
+  auto r = Res::get_default();
+  return stable_sort_pairs(r, p, keys_begin, keys_end, vals_begin, comp);
 }
 
 
@@ -182,19 +421,52 @@ stable_sort_pairs(const ExecPolicy &p,
 */
 template <typename ExecPolicy,
           typename Container,
-          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>>
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>>
 sort(const ExecPolicy &p,
      Container &c,
      Compare comp = Compare{})
 {
-  using T = RAJA::detail::ContainerVal<Container>;
-  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
-                "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container must model RandomAccessRange");
-  impl::sort::unstable(p, std::begin(c), std::end(c), comp);
+  auto r = Res::get_default();
+  return sort(r, p, std::begin(c), std::end(c), comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort execution pattern on a resource
+*
+* \param[in] r Resource the sort runs on
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container
+*range
+* \param[in] comp comparison function to apply for sort
+*
+* \return an event proxy for the sort's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<Container>>
+sort(Res &r,
+     const ExecPolicy &p,
+     Container &c,
+     Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return sort(r, p, std::begin(c), std::end(c), comp);
 }
 
 /*!
@@ -211,19 +483,52 @@ sort(const ExecPolicy &p,
 */
 template <typename ExecPolicy,
           typename Container,
-          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>>
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>>
 stable_sort(const ExecPolicy &p,
             Container &c,
             Compare comp = Compare{})
 {
-  using T = RAJA::detail::ContainerVal<Container>;
-  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
-                "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container must model RandomAccessRange");
-  impl::sort::stable(p, std::begin(c), std::end(c), comp);
+  auto r = Res::get_default();
+  return stable_sort(r, p, std::begin(c), std::end(c), comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort execution pattern on a resource
+*
+* \param[in] r Resource the sort runs on
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container
+*range
+* \param[in] comp comparison function to apply for stable_sort
+*
+* \return an event proxy for the sort's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<Container>>
+stable_sort(Res &r,
+            const ExecPolicy &p,
+            Container &c,
+            Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return stable_sort(r, p, std::begin(c), std::end(c), comp);
 }
 
 /*!
@@ -242,23 +547,62 @@ stable_sort(const ExecPolicy &p,
 template <typename ExecPolicy,
           typename KeyContainer,
           typename ValContainer,
-          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<KeyContainer>,
-                    type_traits::is_range<ValContainer>>
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>>
 sort_pairs(const ExecPolicy &p,
            KeyContainer &keys,
            ValContainer &vals,
            Compare comp = Compare{})
 {
-  using T = RAJA::detail::ContainerVal<KeyContainer>;
-  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
-                "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_range<KeyContainer>::value,
                 "KeyContainer must model RandomAccessRange");
   static_assert(type_traits::is_random_access_range<ValContainer>::value,
                 "ValContainer must model RandomAccessRange");
-  impl::sort::unstable_pairs(p, std::begin(keys), std::end(keys), std::begin(vals), comp);
+  auto r = Res::get_default();
+  return sort_pairs(r, p, std::begin(keys), std::end(keys), std::begin(vals), comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort pairs execution pattern on a resource
+*
+* \param[in] r Resource the sort runs on
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to be sorted
+* \param[in,out] vals RandomAccess Container or range of values to reorder
+* along with keys
+* \param[in] comp comparison function to apply to keys for sort
+*
+* \return an event proxy for the sort's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>>
+sort_pairs(Res &r,
+           const ExecPolicy &p,
+           KeyContainer &keys,
+           ValContainer &vals,
+           Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  return sort_pairs(r, p, std::begin(keys), std::end(keys), std::begin(vals), comp);
 }
 
 /*!
@@ -277,25 +621,601 @@ sort_pairs(const ExecPolicy &p,
 template <typename ExecPolicy,
           typename KeyContainer,
           typename ValContainer,
-          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
-concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<KeyContainer>,
-                    type_traits::is_range<ValContainer>>
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>>
 stable_sort_pairs(const ExecPolicy &p,
                   KeyContainer &keys,
                   ValContainer &vals,
                   Compare comp = Compare{})
 {
-  using T = RAJA::detail::ContainerVal<KeyContainer>;
-  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
-                "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_range<KeyContainer>::value,
                 "KeyContainer must model RandomAccessRange");
   static_assert(type_traits::is_random_access_range<ValContainer>::value,
                 "ValContainer must model RandomAccessRange");
-  impl::sort::stable_pairs(p, std::begin(keys), std::end(keys), std::begin(vals), comp);
+  auto r = Res::get_default();
+  return stable_sort_pairs(r, p, std::begin(keys), std::end(keys), std::begin(vals), comp);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  stable sort pairs execution pattern on a resource
+*
+* \param[in] r Resource the sort runs on
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess KeyContainer or range of keys to be sorted
+* \param[in,out] vals RandomAccess Container or range of values to reorder
+* along with keys
+* \param[in] comp comparison function to apply to keys for stable_sort
+*
+* \return an event proxy for the sort's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>>
+stable_sort_pairs(Res &r,
+                  const ExecPolicy &p,
+                  KeyContainer &keys,
+                  ValContainer &vals,
+                  Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  return stable_sort_pairs(r, p, std::begin(keys), std::end(keys), std::begin(vals), comp);
+}
+
+
+/*!
+******************************************************************************
+*
+* \brief  bit-limited stable sort pairs execution pattern on a resource
+*
+* Stable sorts pairs by the low num_key_bits bits of each key. When the
+* meaningful key range is known at call time (e.g. 12-bit bin ids carried
+* in 32-bit keys), radix backends skip the passes over the bits above
+* num_key_bits instead of sorting the full key width; comparison backends
+* compare masked keys so all backends produce the same ordering. Key bits
+* at or above num_key_bits do not participate in the ordering.
+*
+* \param[in] r Resource the sort runs on; device back-ends enqueue on the
+*            resource's stream
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of
+*                data keys range
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of data
+*                keys range
+* \param[in,out] vals_begin Pointer or Random-Access Iterator to start of
+*                data values range
+* \param[in] num_key_bits number of low key bits that order the sort
+*
+* \return an event proxy for the sort's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Res, typename KeyIter, typename ValIter>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<ValIter>>
+stable_sort_pairs_bits(Res &r,
+                       const ExecPolicy &p,
+                       KeyIter keys_begin,
+                       KeyIter keys_end,
+                       ValIter vals_begin,
+                       int num_key_bits)
+{
+  using K = RAJA::detail::IterVal<KeyIter>;
+  static_assert(std::is_integral<K>::value,
+                "stable_sort_pairs_bits requires integral keys");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Iterator must model RandomAccessIterator");
+  impl::sort::stable_pairs_bits(r, p, keys_begin, keys_end, vals_begin,
+                                num_key_bits);
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  bit-limited stable sort pairs execution pattern
+*
+* See the resource form above for the ordering semantics.
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of
+*                data keys range
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of data
+*                keys range
+* \param[in,out] vals_begin Pointer or Random-Access Iterator to start of
+*                data values range
+* \param[in] num_key_bits number of low key bits that order the sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<ValIter>>
+stable_sort_pairs_bits(const ExecPolicy &p,
+                       KeyIter keys_begin,
+                       KeyIter keys_end,
+                       ValIter vals_begin,
+                       int num_key_bits)
+{
+  auto r = Res::get_default();
+  return stable_sort_pairs_bits(r, p, keys_begin, keys_end, vals_begin,
+                                num_key_bits);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented sort execution pattern
+*
+* Sorts many independent sub-ranges of one array in a single parallel pass
+* instead of launching one sort per segment. Segment s covers
+* [offsets_begin[s], offsets_begin[s+1]); offsets has one more entry than
+* there are segments. Parallelism is across segments, with each segment
+* sorted by a device-callable intro sort, so the pattern is suited to many
+* small segments (e.g. particles within cells).
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data
+* \param[in] offsets_begin Pointer or Random-Access Iterator to start of
+*            segment offsets range
+* \param[in] offsets_end Pointer or Random-Access Iterator to end of
+*            segment offsets range (exclusive)
+* \param[in] comp comparison function to apply for sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffsetIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OffsetIter>>
+sort_segments(const ExecPolicy &p,
+              Iter begin,
+              OffsetIter offsets_begin,
+              OffsetIter offsets_end,
+              Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "OffsetIter must model RandomAccessIterator");
+
+  Index_type num_segments =
+      static_cast<Index_type>(std::distance(offsets_begin, offsets_end)) - 1;
+
+  forall(p,
+         TypedRangeSegment<Index_type>(0, num_segments),
+         [=] RAJA_HOST_DEVICE(Index_type s) {
+           RAJA::intro_sort(begin + offsets_begin[s],
+                            begin + offsets_begin[s + 1],
+                            comp);
+         });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented sort execution pattern on a resource
+*
+* Same segment mapping as the policy-only form; the per-segment forall is
+* launched on the given resource and the returned event tracks it.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Iter,
+          typename OffsetIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<OffsetIter>>
+sort_segments(Res &r,
+              const ExecPolicy &p,
+              Iter begin,
+              OffsetIter offsets_begin,
+              OffsetIter offsets_end,
+              Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "OffsetIter must model RandomAccessIterator");
+
+  Index_type num_segments =
+      static_cast<Index_type>(std::distance(offsets_begin, offsets_end)) - 1;
+
+  return forall(p,
+                r,
+                TypedRangeSegment<Index_type>(0, num_segments),
+                [=] RAJA_HOST_DEVICE(Index_type s) {
+                  RAJA::intro_sort(begin + offsets_begin[s],
+                                   begin + offsets_begin[s + 1],
+                                   comp);
+                });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable segmented sort execution pattern
+*
+* Same segment mapping as sort_segments, with each segment sorted by a
+* stable, device-callable insertion sort; intended for short segments.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffsetIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OffsetIter>>
+stable_sort_segments(const ExecPolicy &p,
+                     Iter begin,
+                     OffsetIter offsets_begin,
+                     OffsetIter offsets_end,
+                     Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "OffsetIter must model RandomAccessIterator");
+
+  Index_type num_segments =
+      static_cast<Index_type>(std::distance(offsets_begin, offsets_end)) - 1;
+
+  forall(p,
+         TypedRangeSegment<Index_type>(0, num_segments),
+         [=] RAJA_HOST_DEVICE(Index_type s) {
+           RAJA::insertion_sort(begin + offsets_begin[s],
+                                begin + offsets_begin[s + 1],
+                                comp);
+         });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable segmented sort execution pattern on a resource
+*
+* Same segment mapping as stable_sort_segments; the per-segment forall is
+* launched on the given resource and the returned event tracks it.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Iter,
+          typename OffsetIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<OffsetIter>>
+stable_sort_segments(Res &r,
+                     const ExecPolicy &p,
+                     Iter begin,
+                     OffsetIter offsets_begin,
+                     OffsetIter offsets_end,
+                     Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "OffsetIter must model RandomAccessIterator");
+
+  Index_type num_segments =
+      static_cast<Index_type>(std::distance(offsets_begin, offsets_end)) - 1;
+
+  return forall(p,
+                r,
+                TypedRangeSegment<Index_type>(0, num_segments),
+                [=] RAJA_HOST_DEVICE(Index_type s) {
+                  RAJA::insertion_sort(begin + offsets_begin[s],
+                                       begin + offsets_begin[s + 1],
+                                       comp);
+                });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  incremental sorted-sequence maintenance on a resource
+*
+* Restores sorted order after a small batch of keys changed, without
+* re-sorting the whole sequence: [begin, middle) must already be sorted
+* and [middle, end) holds the batch in any order. The batch is sorted
+* with the policy's sort, then the two runs are merged by rank -- each
+* element binary searches the other run for its final position -- so the
+* merge is one scatter pass through a workspace instead of a full sort.
+* The merge is stable between the runs: among equal keys, elements of
+* the existing run precede elements of the batch. Deleted keys can be
+* retired by overwriting them with a sentinel that compares last and
+* shrinking the range after the merge.
+*
+* The workspace comes from the resource and is released before
+* returning, so the call waits for the merge to complete.
+*
+* \param[in] r Resource the update runs on
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of the
+*                sorted range
+* \param[in,out] middle Pointer or Random-Access Iterator to start of the
+*                batch (end of the sorted range)
+* \param[in,out] end Pointer or Random-Access Iterator to end of the batch
+* \param[in] comp comparison function the sorted range is ordered by
+*
+* \return an event proxy for the update's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Iter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<Iter>>
+sorted_insert(Res &r,
+              const ExecPolicy &p,
+              Iter begin,
+              Iter middle,
+              Iter end,
+              Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+
+  const Index_type n1 = static_cast<Index_type>(std::distance(begin, middle));
+  const Index_type n2 = static_cast<Index_type>(std::distance(middle, end));
+
+  if (n2 > 0) {
+    sort(r, p, middle, end, comp);
+  }
+
+  if (n1 > 0 && n2 > 0) {
+    const Index_type n = n1 + n2;
+    R* work = r.template allocate<R>(n);
+
+    forall(p,
+           r,
+           TypedRangeSegment<Index_type>(0, n),
+           [=] RAJA_HOST_DEVICE(Index_type i) {
+             if (i < n1) {
+               Index_type pos =
+                   i + RAJA::detail::lower_bound_index(middle, n2,
+                                                       begin[i], comp);
+               work[pos] = begin[i];
+             } else {
+               Index_type j = i - n1;
+               Index_type pos =
+                   j + RAJA::detail::upper_bound_index(begin, n1,
+                                                       middle[j], comp);
+               work[pos] = middle[j];
+             }
+           });
+
+    forall(p,
+           r,
+           TypedRangeSegment<Index_type>(0, n),
+           [=] RAJA_HOST_DEVICE(Index_type i) { begin[i] = work[i]; });
+
+    r.wait();
+    r.deallocate(work);
+  }
+
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  incremental sorted-sequence maintenance
+*
+* Same semantics as the resource form above, on the policy's default
+* resource.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>>
+sorted_insert(const ExecPolicy &p,
+              Iter begin,
+              Iter middle,
+              Iter end,
+              Compare comp = Compare{})
+{
+  auto r = Res::get_default();
+  return sorted_insert(r, p, begin, middle, end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  incremental sorted-sequence maintenance for key-value pairs on a
+*         resource
+*
+* Same run layout and rank merge as sorted_insert, applied to a keys
+* range with the corresponding values carried along: [keys_begin,
+* keys_middle) is sorted, [keys_middle, keys_end) is the batch, and
+* vals_begin points at the value for *keys_begin.
+*
+* \param[in] r Resource the update runs on
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of
+*                the sorted keys range
+* \param[in,out] keys_middle Pointer or Random-Access Iterator to start of
+*                the keys batch
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of the
+*                keys batch
+* \param[in,out] vals_begin Pointer or Random-Access Iterator to start of
+*                the values range
+* \param[in] comp comparison function the sorted keys are ordered by
+*
+* \return an event proxy for the update's completion on the resource
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<KeyIter>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<ValIter>>
+sorted_insert_pairs(Res &r,
+                    const ExecPolicy &p,
+                    KeyIter keys_begin,
+                    KeyIter keys_middle,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp = Compare{})
+{
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using V = RAJA::detail::IterVal<ValIter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, K, K>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Iterator must model RandomAccessIterator");
+
+  const Index_type n1 =
+      static_cast<Index_type>(std::distance(keys_begin, keys_middle));
+  const Index_type n2 =
+      static_cast<Index_type>(std::distance(keys_middle, keys_end));
+
+  if (n2 > 0) {
+    sort_pairs(r, p, keys_middle, keys_end, vals_begin + n1, comp);
+  }
+
+  if (n1 > 0 && n2 > 0) {
+    const Index_type n = n1 + n2;
+    K* key_work = r.template allocate<K>(n);
+    V* val_work = r.template allocate<V>(n);
+
+    forall(p,
+           r,
+           TypedRangeSegment<Index_type>(0, n),
+           [=] RAJA_HOST_DEVICE(Index_type i) {
+             if (i < n1) {
+               Index_type pos =
+                   i + RAJA::detail::lower_bound_index(keys_middle, n2,
+                                                       keys_begin[i], comp);
+               key_work[pos] = keys_begin[i];
+               val_work[pos] = vals_begin[i];
+             } else {
+               Index_type j = i - n1;
+               Index_type pos =
+                   j + RAJA::detail::upper_bound_index(keys_begin, n1,
+                                                       keys_middle[j], comp);
+               key_work[pos] = keys_middle[j];
+               val_work[pos] = vals_begin[n1 + j];
+             }
+           });
+
+    forall(p,
+           r,
+           TypedRangeSegment<Index_type>(0, n),
+           [=] RAJA_HOST_DEVICE(Index_type i) {
+             keys_begin[i] = key_work[i];
+             vals_begin[i] = val_work[i];
+           });
+
+    r.wait();
+    r.deallocate(key_work);
+    r.deallocate(val_work);
+  }
+
+  return resources::EventProxy<Res>(&r);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  incremental sorted-sequence maintenance for key-value pairs
+*
+* Same semantics as the resource form above, on the policy's default
+* resource.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<KeyIter>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<ValIter>>
+sorted_insert_pairs(const ExecPolicy &p,
+                    KeyIter keys_begin,
+                    KeyIter keys_middle,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp = Compare{})
+{
+  auto r = Res::get_default();
+  return sorted_insert_pairs(r, p, keys_begin, keys_middle, keys_end,
+                             vals_begin, comp);
+}
 
 // =============================================================================
 
@@ -306,6 +1226,15 @@ sort(Args &&... args)
   sort(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+sort(Res &r, Args &&... args)
+{
+  return sort(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 template <typename ExecPolicy, typename... Args>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
 stable_sort(Args &&... args)
@@ -313,6 +1242,15 @@ stable_sort(Args &&... args)
   stable_sort(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+stable_sort(Res &r, Args &&... args)
+{
+  return stable_sort(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 template <typename ExecPolicy, typename... Args>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
 sort_pairs(Args &&... args)
@@ -320,6 +1258,15 @@ sort_pairs(Args &&... args)
   sort_pairs(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+sort_pairs(Res &r, Args &&... args)
+{
+  return sort_pairs(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 template <typename ExecPolicy, typename... Args>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
 stable_sort_pairs(Args &&... args)
@@ -327,6 +1274,77 @@ stable_sort_pairs(Args &&... args)
   stable_sort_pairs(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+stable_sort_pairs(Res &r, Args &&... args)
+{
+  return stable_sort_pairs(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+stable_sort_pairs_bits(Args &&... args)
+{
+  stable_sort_pairs_bits(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+stable_sort_pairs_bits(Res &r, Args &&... args)
+{
+  return stable_sort_pairs_bits(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sorted_insert(Args &&... args)
+{
+  sorted_insert(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+sorted_insert(Res &r, Args &&... args)
+{
+  return sorted_insert(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sorted_insert_pairs(Args &&... args)
+{
+  sorted_insert_pairs(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_execution_policy<ExecPolicy>,
+                                  type_traits::is_resource<Res>>
+sorted_insert_pairs(Res &r, Args &&... args)
+{
+  return sorted_insert_pairs(r, ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sort_segments(Args &&... args)
+{
+  sort_segments(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+stable_sort_segments(Args &&... args)
+{
+  stable_sort_segments(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -37,4 +37,10 @@
 #include "RAJA/pattern/teams/teams_openmp.hpp"
 #endif
 
+//
+// Team-scope cooperative primitives (reduce, scan, broadcast), layered on
+// the back-ends above.
+//
+#include "RAJA/pattern/teams/teams_primitives.hpp"
+
 #endif /* RAJA_pattern_teams_HPP */
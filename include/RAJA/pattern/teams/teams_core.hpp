@@ -175,6 +175,182 @@ public:
 };
 
 
+///
+/// Team-collective loop over a segment with data-dependent inner
+/// iteration counts, rebalanced across the team.
+///
+/// For each outer iterate i in the segment, counts(i) gives a runtime
+/// inner trip count and body(i, j) is invoked for j in [0, counts(i)).
+/// The flattened inner iterations are distributed evenly across the
+/// threads of the team, so variable inner work keeps all threads busy
+/// instead of idling them on worst-case padded ranges.
+///
+/// All threads of the team must call loop_rebalance with the same
+/// arguments (it is collective and synchronizes internally), and the
+/// segment is processed by the whole team -- pass each team its own
+/// slice of the outer range. Inner iterations of one outer iterate may
+/// run on different threads, so the body must not rely on thread-local
+/// state across j.
+///
+template <typename CONTEXT, typename SEGMENT, typename COUNTS, typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_rebalance(
+    CONTEXT const &RAJA_UNUSED_ARG(ctx),
+    SEGMENT const &segment,
+    COUNTS const &counts,
+    BODY const &body)
+{
+#if defined(RAJA_DEVICE_CODE)
+  // process the outer range in tiles; per tile, scan the inner counts in
+  // shared memory and stride the flattened iteration space by the team
+  constexpr int tile_size = 256;
+  RAJA_TEAM_SHARED int s_prefix[tile_size];
+
+  const int tid =
+      threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+  const int nthreads = blockDim.x * blockDim.y * blockDim.z;
+  const int len = segment.end() - segment.begin();
+
+  for (int tile = 0; tile < len; tile += tile_size) {
+    const int tlen = (len - tile < tile_size) ? (len - tile) : tile_size;
+
+    // gather the inner trip counts for this tile
+    for (int i = tid; i < tlen; i += nthreads) {
+      s_prefix[i] = counts(*(segment.begin() + tile + i));
+    }
+    __syncthreads();
+
+    // inclusive scan; tiles are small so a serial scan is cheap and
+    // works for any team shape
+    if (tid == 0) {
+      int running = 0;
+      for (int i = 0; i < tlen; ++i) {
+        running += s_prefix[i];
+        s_prefix[i] = running;
+      }
+    }
+    __syncthreads();
+
+    const int tile_total = s_prefix[tlen - 1];
+
+    // each thread handles an even share of the flattened iterations,
+    // locating its outer iterate by binary search over the prefix sums
+    for (int k = tid; k < tile_total; k += nthreads) {
+      int lo = 0;
+      int hi = tlen - 1;
+      while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (s_prefix[mid] > k) {
+          hi = mid;
+        } else {
+          lo = mid + 1;
+        }
+      }
+      const int j = k - ((lo > 0) ? s_prefix[lo - 1] : 0);
+      body(*(segment.begin() + tile + lo), j);
+    }
+    __syncthreads();
+  }
+#else
+  const int len = segment.end() - segment.begin();
+  for (int i = 0; i < len; ++i) {
+    auto idx = *(segment.begin() + i);
+    const int n = counts(idx);
+    for (int j = 0; j < n; ++j) {
+      body(idx, j);
+    }
+  }
+#endif
+}
+
+///
+/// Asynchronous team-cooperative copy of a tile from global memory to
+/// RAJA_TEAM_SHARED memory.
+///
+/// All threads of the team must call team_memcpy_async with the same
+/// arguments; the copy is distributed across the team. On NVIDIA Ampere
+/// (sm_80) and newer, 4/8/16-byte elements are issued through the
+/// cp.async memory pipeline so the copy overlaps with compute; elsewhere
+/// this degrades to a synchronous cooperative copy. In either case the
+/// tile is only guaranteed visible to the team after a matching
+/// team_memcpy_wait().
+///
+/// Typical use:
+///
+///   RAJA_TEAM_SHARED double tile[TILE_SIZE];
+///   RAJA::expt::team_memcpy_async(ctx, tile, &A[offset], TILE_SIZE);
+///   RAJA::expt::team_memcpy_commit();
+///   // ... independent work ...
+///   RAJA::expt::team_memcpy_wait();  // includes a team sync
+///
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void team_memcpy_async(
+    LaunchContext const &RAJA_UNUSED_ARG(ctx),
+    T *dst,
+    T const *src,
+    size_t len)
+{
+#if defined(RAJA_DEVICE_CODE)
+  const size_t tid =
+      threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+  const size_t nthreads = blockDim.x * blockDim.y * blockDim.z;
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800) && \
+    defined(__CUDACC_VER_MAJOR__) && (__CUDACC_VER_MAJOR__ >= 11)
+  if (sizeof(T) == 4 || sizeof(T) == 8 || sizeof(T) == 16) {
+    for (size_t i = tid; i < len; i += nthreads) {
+      unsigned dst_s =
+          static_cast<unsigned>(__cvta_generic_to_shared(dst + i));
+      if (sizeof(T) == 4) {
+        asm volatile("cp.async.ca.shared.global [%0], [%1], 4;" ::"r"(dst_s),
+                     "l"(src + i));
+      } else if (sizeof(T) == 8) {
+        asm volatile("cp.async.ca.shared.global [%0], [%1], 8;" ::"r"(dst_s),
+                     "l"(src + i));
+      } else {
+        asm volatile("cp.async.cg.shared.global [%0], [%1], 16;" ::"r"(dst_s),
+                     "l"(src + i));
+      }
+    }
+    return;
+  }
+#endif
+  for (size_t i = tid; i < len; i += nthreads) {
+    dst[i] = src[i];
+  }
+#else
+  for (size_t i = 0; i < len; ++i) {
+    dst[i] = src[i];
+  }
+#endif
+}
+
+///
+/// Commit the team_memcpy_async copies issued so far as one batch.
+/// A no-op where the memory pipeline is unavailable.
+///
+RAJA_HOST_DEVICE RAJA_INLINE void team_memcpy_commit()
+{
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800) && \
+    defined(__CUDACC_VER_MAJOR__) && (__CUDACC_VER_MAJOR__ >= 11)
+  asm volatile("cp.async.commit_group;");
+#endif
+}
+
+///
+/// Wait for all outstanding team_memcpy_async copies to land, then
+/// synchronize the team so every thread sees the tile.
+///
+RAJA_HOST_DEVICE RAJA_INLINE void team_memcpy_wait()
+{
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800) && \
+    defined(__CUDACC_VER_MAJOR__) && (__CUDACC_VER_MAJOR__ >= 11)
+  asm volatile("cp.async.wait_all;");
+#endif
+#if defined(RAJA_DEVICE_CODE)
+  __syncthreads();
+#endif
+}
+
+
 template <typename LAUNCH_POLICY>
 struct LaunchExecute;
 
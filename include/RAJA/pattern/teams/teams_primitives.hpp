@@ -0,0 +1,375 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing team-scope cooperative primitives
+ *          (reduce, scan, broadcast, sort) for RAJA::Teams kernels
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_primitives_HPP
+#define RAJA_pattern_teams_primitives_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/sort.hpp"
+
+#if defined(RAJA_CUDA_ACTIVE)
+#include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/reduce.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/hip/reduce.hpp"
+#endif
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace internal
+{
+
+#if defined(RAJA_DEVICE_CODE)
+
+//! linear id of the calling thread within its team
+RAJA_DEVICE RAJA_INLINE int team_thread_id()
+{
+  return threadIdx.x + blockDim.x * threadIdx.y +
+         (blockDim.x * blockDim.y) * threadIdx.z;
+}
+
+//! number of threads in the calling team
+RAJA_DEVICE RAJA_INLINE int team_num_threads()
+{
+  return blockDim.x * blockDim.y * blockDim.z;
+}
+
+//! uninitialized team-shared storage for one or more values of type T;
+//  recast raw storage to avoid constructing objects in shared memory, as
+//  the block reduce implementations do
+template <typename T, size_t N>
+RAJA_DEVICE RAJA_INLINE T* team_shared_array()
+{
+  static __shared__ unsigned char mem[sizeof(T) * N];
+  return reinterpret_cast<T*>(mem);
+}
+
+#endif
+
+}  // namespace internal
+
+/*!
+ * Combine each team member's value into a single value, returned to every
+ * member of the team. All team members must call this at team scope (not
+ * inside a thread loop body that diverges).
+ *
+ * On a GPU device the combine uses shuffle-based warp reductions plus a
+ * shared-memory pass across warps; on the host, where a team is executed
+ * by a single thread, the value is returned unchanged.
+ *
+ * \tparam COMBINER reduction combiner, e.g. RAJA::reduce::sum<T>
+ * \param ctx launch context for the kernel
+ * \param value this team member's contribution
+ * \param identity identity value of the combiner
+ */
+template <typename COMBINER, typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T team_reduce(LaunchContext const& RAJA_UNUSED_ARG(ctx),
+                                           T value,
+                                           T identity)
+{
+#if defined(__CUDA_ARCH__)
+  T temp = ::RAJA::cuda::impl::block_reduce<COMBINER>(value, identity);
+  // block_reduce leaves the full value in the first warp; broadcast it
+  T* sd = internal::team_shared_array<T, 1>();
+  if (internal::team_thread_id() == 0) {
+    sd[0] = temp;
+  }
+  __syncthreads();
+  temp = sd[0];
+  __syncthreads();
+  return temp;
+#elif defined(__HIP_DEVICE_COMPILE__)
+  T temp = ::RAJA::hip::impl::block_reduce<COMBINER>(value, identity);
+  T* sd = internal::team_shared_array<T, 1>();
+  if (internal::team_thread_id() == 0) {
+    sd[0] = temp;
+  }
+  __syncthreads();
+  temp = sd[0];
+  __syncthreads();
+  return temp;
+#else
+  RAJA_UNUSED_VAR(identity);
+  return value;
+#endif
+}
+
+//! team_reduce convenience wrapper for sum
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T team_sum(LaunchContext const& ctx, T value)
+{
+  return team_reduce<RAJA::reduce::sum<T>>(ctx, value,
+                                           RAJA::reduce::sum<T>::identity());
+}
+
+//! team_reduce convenience wrapper for min
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T team_min(LaunchContext const& ctx, T value)
+{
+  return team_reduce<RAJA::reduce::min<T>>(ctx, value,
+                                           RAJA::reduce::min<T>::identity());
+}
+
+//! team_reduce convenience wrapper for max
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T team_max(LaunchContext const& ctx, T value)
+{
+  return team_reduce<RAJA::reduce::max<T>>(ctx, value,
+                                           RAJA::reduce::max<T>::identity());
+}
+
+/*!
+ * Broadcast one team member's value to every member of the team. All team
+ * members must call this at team scope.
+ *
+ * \param ctx launch context for the kernel
+ * \param value this team member's value; only the source member's is used
+ * \param src_thread linear id of the team member whose value is broadcast
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T team_broadcast(LaunchContext const& RAJA_UNUSED_ARG(ctx),
+                                              T value,
+                                              int src_thread)
+{
+#if defined(RAJA_DEVICE_CODE)
+  T* sd = internal::team_shared_array<T, 1>();
+  if (internal::team_thread_id() == src_thread) {
+    sd[0] = value;
+  }
+  __syncthreads();
+  T temp = sd[0];
+  __syncthreads();
+  return temp;
+#else
+  RAJA_UNUSED_VAR(src_thread);
+  return value;
+#endif
+}
+
+/*!
+ * Inclusive scan of each team member's value in linear thread id order:
+ * member i receives the combination of the values of members 0..i. All
+ * team members must call this at team scope.
+ *
+ * Uses a shared-memory Hillis-Steele sweep sized for the maximum team; on
+ * the host, where a team is executed by a single thread, the value is
+ * returned unchanged.
+ *
+ * \tparam COMBINER reduction combiner, e.g. RAJA::reduce::sum<T>
+ * \param ctx launch context for the kernel
+ * \param value this team member's contribution
+ * \param identity identity value of the combiner
+ */
+template <typename COMBINER, typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T team_scan(LaunchContext const& RAJA_UNUSED_ARG(ctx),
+                                         T value,
+                                         T identity)
+{
+#if defined(RAJA_DEVICE_CODE)
+#if defined(__CUDA_ARCH__)
+  constexpr int max_threads = ::RAJA::policy::cuda::MAX_BLOCK_SIZE;
+#else
+  constexpr int max_threads = ::RAJA::policy::hip::MAX_BLOCK_SIZE;
+#endif
+  int threadId = internal::team_thread_id();
+  int numThreads = internal::team_num_threads();
+
+  T* sd = internal::team_shared_array<T, max_threads>();
+
+  sd[threadId] = value;
+  __syncthreads();
+
+  for (int offset = 1; offset < numThreads; offset *= 2) {
+    T rhs = (threadId >= offset) ? sd[threadId - offset] : identity;
+    __syncthreads();
+    if (threadId >= offset) {
+      COMBINER{}(sd[threadId], rhs);
+    }
+    __syncthreads();
+  }
+
+  T temp = sd[threadId];
+  __syncthreads();
+  return temp;
+#else
+  RAJA_UNUSED_VAR(identity);
+  return value;
+#endif
+}
+
+//! team_scan convenience wrapper for sum
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T team_scan_sum(LaunchContext const& ctx, T value)
+{
+  return team_scan<RAJA::reduce::sum<T>>(ctx, value,
+                                         RAJA::reduce::sum<T>::identity());
+}
+
+/*!
+ * Cooperatively sort the range [begin, end) in place using every member
+ * of the team. All team members must call this at team scope with the
+ * same range; the range typically lives in team-shared or global memory.
+ *
+ * On a GPU device the sort is an odd-even transposition network: each
+ * round the team compare-exchanges disjoint neighbor pairs, with a team
+ * barrier between rounds, so it handles any range length and any team
+ * shape. The O(N) rounds make it best suited to the short per-team
+ * candidate lists it is intended for. On the host, where a team is
+ * executed by a single thread, the range is sorted serially.
+ *
+ * \param ctx launch context for the kernel
+ * \param begin iterator to the start of the range to sort
+ * \param end iterator to the end of the range to sort
+ * \param comp comparison function for the sort order
+ */
+template <typename Iter,
+          typename Compare = operators::less<detail::IterVal<Iter>>>
+RAJA_HOST_DEVICE RAJA_INLINE void team_sort(LaunchContext const& RAJA_UNUSED_ARG(ctx),
+                                            Iter begin,
+                                            Iter end,
+                                            Compare comp = Compare{})
+{
+#if defined(RAJA_DEVICE_CODE)
+  using RAJA::safe_iter_swap;
+
+  int threadId = internal::team_thread_id();
+  int numThreads = internal::team_num_threads();
+
+  auto n = end - begin;
+
+  for (decltype(n) round = 0; round < n; ++round) {
+    // even rounds exchange pairs (0,1), (2,3), ...; odd rounds
+    // (1,2), (3,4), ...; pairs within a round are disjoint
+    for (auto i = 2 * threadId + (round & 1); i + 1 < n;
+         i += 2 * numThreads) {
+      if (comp(begin[i + 1], begin[i])) {
+        safe_iter_swap(begin + i, begin + i + 1);
+      }
+    }
+    __syncthreads();
+  }
+#else
+  intro_sort(begin, end, comp);
+#endif
+}
+
+/*!
+ * Publish this team's writes to other teams and post a flag value with
+ * release semantics. All team members must call this at team scope; one
+ * member performs the store after a team barrier, so every member's
+ * prior global-memory writes are covered by the publication.
+ *
+ * Together with team_await this forms a neighbor-signal primitive for
+ * single-kernel multi-tile stencil sweeps: a team finishing layer k of
+ * its tile writes the tile edges to global memory, then signals
+ *
+ * \code
+ *   RAJA::expt::team_signal(ctx, &flags[my_team], k + 1);
+ * \endcode
+ *
+ * and the adjacent team consumes the fresh halo after
+ *
+ * \code
+ *   RAJA::expt::team_await(ctx, &flags[left_neighbor], k + 1);
+ * \endcode
+ *
+ * without breaking the kernel between layers. The same monotonically
+ * increasing flag is reused across layers, so flags are zeroed once at
+ * launch, not per step.
+ *
+ * Forward progress is the caller's contract: a team may only await a
+ * flag whose signaling team is either co-resident (grid no larger than
+ * occupancy, as with a cooperative launch) or earlier in team index
+ * order, since GPU schedulers start blocks in index order. On host
+ * back-ends teams execute in index order, so only the latter form is
+ * safe there.
+ *
+ * \param ctx launch context for the kernel
+ * \param flag location the signal is posted to; one per signaling team
+ * \param value flag value to post, typically the completed layer number
+ */
+RAJA_HOST_DEVICE RAJA_INLINE void team_signal(LaunchContext const& RAJA_UNUSED_ARG(ctx),
+                                              unsigned int* flag,
+                                              unsigned int value)
+{
+#if defined(RAJA_DEVICE_CODE)
+  // wait for every member's writes, make them device-visible, then post
+  __syncthreads();
+  __threadfence();
+  if (internal::team_thread_id() == 0) {
+    atomicExch(flag, value);
+  }
+#else
+  std::atomic_thread_fence(std::memory_order_release);
+  *static_cast<volatile unsigned int*>(flag) = value;
+#endif
+}
+
+/*!
+ * Wait until a flag posted by team_signal reaches at least value, with
+ * acquire semantics: after this returns, the signaling team's writes
+ * from before its signal are visible to every member of this team. All
+ * team members must call this at team scope.
+ *
+ * One member polls the flag; a team barrier then releases the rest, so
+ * the team does not hammer the flag line. See team_signal for the
+ * forward-progress contract.
+ *
+ * \param ctx launch context for the kernel
+ * \param flag location to poll
+ * \param value flag value to wait for (satisfied by any value >= value,
+ * as flags increase monotonically across layers)
+ */
+RAJA_HOST_DEVICE RAJA_INLINE void team_await(LaunchContext const& RAJA_UNUSED_ARG(ctx),
+                                             unsigned int* flag,
+                                             unsigned int value)
+{
+#if defined(RAJA_DEVICE_CODE)
+  if (internal::team_thread_id() == 0) {
+    // atomic read bypasses the team's private cache, matching the
+    // grid-reduce handshake in policy/cuda/reduce.hpp
+    while (atomicAdd(flag, 0u) < value) {
+    }
+  }
+  __syncthreads();
+  __threadfence();
+#else
+  while (*static_cast<volatile unsigned int*>(flag) < value) {
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+#endif
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
@@ -20,6 +20,9 @@
 
 #include "RAJA/config.hpp"
 
+#include <array>
+#include <limits>
+#include <memory>
 #include <tuple>
 
 #include "RAJA/policy/PolicyBase.hpp"
@@ -27,6 +30,7 @@
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/plugins.hpp"
 
+#include "RAJA/util/Timer.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/resource.hpp"
 
@@ -36,9 +40,27 @@ namespace RAJA
 
 namespace detail
 {
-template <size_t index, size_t size, typename Policy, typename... rest>
-struct policy_invoker;
-}
+template <typename PolicyTuple, typename Iterable, typename LoopBody>
+struct policy_dispatcher;
+
+/// Detect whether a selector wants timing feedback, i.e., provides
+/// update(size_t index, double seconds). Selectors without an update
+/// member are invoked without the timing overhead.
+template <typename Selector, typename = void>
+struct selector_has_update : std::false_type {
+};
+
+template <typename Selector>
+struct selector_has_update<
+    Selector,
+    typename std::conditional<
+        true,
+        void,
+        decltype(std::declval<Selector &>().update(size_t(),
+                                                   double()))>::type>
+    : std::true_type {
+};
+}  // namespace detail
 
 namespace policy
 {
@@ -57,8 +79,8 @@ class MultiPolicy
 
 public:
   MultiPolicy() = delete;  // No default construction
-  MultiPolicy(Selector s) : s(s), _policies({Policies{}...}) {}
-  MultiPolicy(Selector s, Policies... policies) : s(s), _policies({policies...})
+  MultiPolicy(Selector s) : s(s), _policies(Policies{}...) {}
+  MultiPolicy(Selector s, Policies... policies) : s(s), _policies(policies...)
   {
   }
 
@@ -68,13 +90,124 @@ public:
   int invoke(Iterable &&i, Body &&b)
   {
     size_t index = s(i);
-    _policies.invoke(index, i, b);
-    return s(i);
+    invoke_policy(detail::selector_has_update<Selector>{}, index, i, b);
+    return static_cast<int>(index);
+  }
+
+  std::tuple<Policies...> _policies;
+
+private:
+  /// Dispatch through the flat per-call-site function-pointer table;
+  /// runtime policy choice is a single indexed indirect call.
+  template <typename Iterable, typename Body>
+  void dispatch(size_t index, Iterable &i, Body &b)
+  {
+    using dispatcher = detail::policy_dispatcher<std::tuple<Policies...>,
+                                                 camp::decay<Iterable>,
+                                                 camp::decay<Body>>;
+    dispatcher::invoke(camp::make_idx_seq_t<sizeof...(Policies)>{},
+                       index,
+                       _policies,
+                       i,
+                       b);
+  }
+
+  /// Invoke the selected policy, without timing, for selectors that take
+  /// no feedback.
+  template <typename Iterable, typename Body>
+  void invoke_policy(std::false_type, size_t index, Iterable &&i, Body &&b)
+  {
+    dispatch(index, i, b);
   }
 
-  detail::
-      policy_invoker<sizeof...(Policies) - 1, sizeof...(Policies), Policies...>
-          _policies;
+  /// Invoke the selected policy and report its wall-clock time back to
+  /// the selector.
+  template <typename Iterable, typename Body>
+  void invoke_policy(std::true_type, size_t index, Iterable &&i, Body &&b)
+  {
+    Timer timer;
+    timer.start();
+    dispatch(index, i, b);
+    timer.stop();
+    s.update(index, timer.elapsed());
+  }
+};
+
+/// AutoTuningSelector - Selector for MultiPolicy that times each candidate
+/// policy for the first few invocations and then locks in the fastest.
+///
+/// Each MultiPolicy instance holds its own selector, so tuning state is
+/// per call site; copies of the selector (and of the containing
+/// MultiPolicy) share state, as the policy object is passed to forall by
+/// value. The right policy crossover depends on machine and loop body, so
+/// sampling at the call site replaces hand-tuned iteration-count
+/// thresholds.
+///
+/// \tparam NumPolicies number of candidate policies in the MultiPolicy
+template <size_t NumPolicies>
+class AutoTuningSelector
+{
+  static_assert(NumPolicies > 0, "MultiPolicy requires at least one policy");
+
+public:
+  /// \param num_samples number of timed invocations of each candidate
+  /// policy before the fastest is locked in
+  explicit AutoTuningSelector(size_t num_samples = 2)
+      : m_state(std::make_shared<State>(num_samples > 0 ? num_samples : 1))
+  {
+  }
+
+  /// Select the policy to run: cycles through candidates while sampling,
+  /// then always returns the fastest.
+  template <typename Iterable>
+  size_t operator()(Iterable const &)
+  {
+    State &state = *m_state;
+    if (state.best_index < NumPolicies) {
+      return state.best_index;
+    }
+    return (state.num_timed) % NumPolicies;
+  }
+
+  /// Record the time of an invocation; called by MultiPolicy after each
+  /// policy run until the fastest policy is locked in.
+  void update(size_t index, double seconds)
+  {
+    State &state = *m_state;
+    if (state.best_index < NumPolicies) {
+      return;
+    }
+    if (seconds < state.min_times[index]) {
+      state.min_times[index] = seconds;
+    }
+    ++state.num_timed;
+    if (state.num_timed >= NumPolicies * state.samples_per_policy) {
+      size_t best = 0;
+      for (size_t p = 1; p < NumPolicies; ++p) {
+        if (state.min_times[p] < state.min_times[best]) {
+          best = p;
+        }
+      }
+      state.best_index = best;
+    }
+  }
+
+private:
+  struct State {
+    explicit State(size_t num_samples)
+        : samples_per_policy(num_samples), num_timed(0),
+          best_index(NumPolicies)
+    {
+      min_times.fill(std::numeric_limits<double>::max());
+    }
+
+    size_t samples_per_policy;
+    size_t num_timed;
+    size_t best_index;  // NumPolicies until sampling completes
+    std::array<double, NumPolicies> min_times;
+  };
+
+  std::shared_ptr<State> m_state;
 };
 
 /// forall_impl - MultiPolicy specialization, select at runtime from a
@@ -109,6 +242,7 @@ RAJA_INLINE resources::EventProxy<Res> forall_impl(Res &r,
 }  // end namespace multi
 }  // end namespace policy
 
+using policy::multi::AutoTuningSelector;
 using policy::multi::MultiPolicy;
 
 namespace detail
@@ -157,73 +291,74 @@ auto make_multi_policy(std::tuple<Policies...> policies, Selector s)
       camp::make_idx_seq_t<sizeof...(Policies)>{}, s, policies);
 }
 
-namespace detail
+/// make_auto_tuning_multi_policy - Construct a MultiPolicy whose selector
+/// times each candidate policy for the first few invocations and then
+/// locks in the fastest
+///
+/// \tparam Policies list of candidate policies, 0 to N-1
+/// \param num_samples number of timed invocations of each candidate
+/// before the fastest is locked in
+/// \return A MultiPolicy containing an AutoTuningSelector
+template <typename... Policies>
+auto make_auto_tuning_multi_policy(size_t num_samples = 2)
+    -> MultiPolicy<AutoTuningSelector<sizeof...(Policies)>, Policies...>
 {
+  return MultiPolicy<AutoTuningSelector<sizeof...(Policies)>, Policies...>(
+      AutoTuningSelector<sizeof...(Policies)>(num_samples));
+}
 
-template <size_t index, size_t size, typename Policy, typename... rest>
-struct policy_invoker : public policy_invoker<index - 1, size, rest...> {
-  static_assert(index < size, "index must be in the range of possibilities");
-  Policy _p;
-  using NextInvoker = policy_invoker<index - 1, size, rest...>;
-
-  policy_invoker(Policy p, rest... args) : NextInvoker(args...), _p(p) {}
+namespace detail
+{
 
-  template <typename Iterable, typename LoopBody>
-  void invoke(int offset, Iterable &&iter, LoopBody &&loop_body)
+/// Flat dispatch table for one MultiPolicy call site.
+///
+/// One entry function is instantiated per candidate policy; their
+/// addresses form a static table built when the call site's
+/// instantiation is first reached, so each invocation is a bounds
+/// check and one indexed indirect call rather than a recursive
+/// if-chain over the policy pack.
+template <typename PolicyTuple, typename Iterable, typename LoopBody>
+struct policy_dispatcher {
+
+  using invoke_fn = void (*)(PolicyTuple &, Iterable &, LoopBody &);
+
+  template <size_t Index>
+  static void invoke_entry(PolicyTuple &policies,
+                           Iterable &iter,
+                           LoopBody &loop_body)
   {
-    if (offset == size - index - 1) {
+    using Policy = typename std::tuple_element<Index, PolicyTuple>::type;
 
-      util::PluginContext context{util::make_context<Policy>()};
-      util::callPreCapturePlugins(context);
+    util::PluginContext context{util::make_context<Policy>()};
+    util::callPreCapturePlugins(context);
 
-      using RAJA::util::trigger_updates_before;
-      auto body = trigger_updates_before(loop_body);
+    using RAJA::util::trigger_updates_before;
+    auto body = trigger_updates_before(loop_body);
 
-      util::callPostCapturePlugins(context);
+    util::callPostCapturePlugins(context);
 
-      util::callPreLaunchPlugins(context);
+    util::callPreLaunchPlugins(context);
 
-      using policy::multi::forall_impl;
-      RAJA_FORCEINLINE_RECURSIVE
-      auto r = resources::get_resource<Policy>::type::get_default();
-      forall_impl(r, _p, std::forward<Iterable>(iter), body);
+    using policy::multi::forall_impl;
+    RAJA_FORCEINLINE_RECURSIVE
+    auto r = resources::get_resource<Policy>::type::get_default();
+    forall_impl(r, std::get<Index>(policies), iter, body);
 
-      util::callPostLaunchPlugins(context);
-    } else {
-      NextInvoker::invoke(offset, std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
-    }
+    util::callPostLaunchPlugins(context);
   }
-};
 
-template <size_t size, typename Policy, typename... rest>
-struct policy_invoker<0, size, Policy, rest...> {
-  Policy _p;
-  policy_invoker(Policy p, rest...) : _p(p) {}
-  template <typename Iterable, typename LoopBody>
-  void invoke(int offset, Iterable &&iter, LoopBody &&loop_body)
+  template <camp::idx_t... Indices>
+  static void invoke(camp::idx_seq<Indices...>,
+                     size_t index,
+                     PolicyTuple &policies,
+                     Iterable &iter,
+                     LoopBody &loop_body)
   {
-    if (offset == size - 1) {
-
-      util::PluginContext context{util::make_context<Policy>()};
-      util::callPreCapturePlugins(context);
-
-      using RAJA::util::trigger_updates_before;
-      auto body = trigger_updates_before(loop_body);
-
-      util::callPostCapturePlugins(context);
-
-      util::callPreLaunchPlugins(context);
-
-      //std::cout <<"policy_invoker: No index\n";
-      using policy::multi::forall_impl;
-      RAJA_FORCEINLINE_RECURSIVE
-      auto r = resources::get_resource<Policy>::type::get_default();
-      forall_impl(r, _p, std::forward<Iterable>(iter), body);
-
-      util::callPostLaunchPlugins(context);
-    } else {
+    static const invoke_fn table[] = {&invoke_entry<Indices>...};
+    if (index >= sizeof...(Indices)) {
       throw std::runtime_error("unknown offset invoked");
     }
+    table[index](policies, iter, loop_body);
   }
 };
 
@@ -35,7 +35,9 @@ enum class Policy {
   target_openmp,
   cuda,
   hip,
-  tbb
+  sycl,
+  tbb,
+  threads
 };
 
 enum class Pattern {
@@ -186,6 +188,9 @@ template <typename Pol>
 struct is_tbb_policy : RAJA::policy_is<Pol, RAJA::Policy::tbb> {
 };
 template <typename Pol>
+struct is_threads_policy : RAJA::policy_is<Pol, RAJA::Policy::threads> {
+};
+template <typename Pol>
 struct is_target_openmp_policy
     : RAJA::policy_is<Pol, RAJA::Policy::target_openmp> {
 };
@@ -195,10 +200,16 @@ struct is_cuda_policy : RAJA::policy_is<Pol, RAJA::Policy::cuda> {
 template <typename Pol>
 struct is_hip_policy : RAJA::policy_is<Pol, RAJA::Policy::hip> {
 };
+template <typename Pol>
+struct is_sycl_policy : RAJA::policy_is<Pol, RAJA::Policy::sycl> {
+};
 
 template <typename Pol>
 struct is_device_exec_policy
-    : RAJA::policy_any_of<Pol, RAJA::Policy::cuda, RAJA::Policy::hip> {
+    : RAJA::policy_any_of<Pol,
+                          RAJA::Policy::cuda,
+                          RAJA::Policy::hip,
+                          RAJA::Policy::sycl> {
 };
 
 DefineTypeTraitFromConcept(is_execution_policy,
@@ -0,0 +1,252 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA runtime policy handle for library-boundary dispatch
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PolicyHandle_HPP
+#define RAJA_PolicyHandle_HPP
+
+#include "RAJA/config.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/simd/policy.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include "RAJA/policy/openmp/policy.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include "RAJA/policy/tbb/policy.hpp"
+#endif
+
+namespace RAJA
+{
+
+/// PolicyHandle - Plain value type naming an execution backend (plus GPU
+/// launch parameters) at runtime, for use where a policy template
+/// parameter cannot cross an ABI boundary.
+///
+/// A shared library wrapping RAJA can accept a PolicyHandle through its
+/// public API and pass it to forall(handle, segment, body); the
+/// pre-instantiated dispatch table inside forall turns the handle into
+/// the corresponding compile-time policy with one indexed indirect call
+/// of overhead, like MultiPolicy but selected by an open, registrable
+/// name rather than a per-call-site selector.
+///
+/// The set of backends is fixed by the RAJA configuration macros when the
+/// call site is compiled -- entries must be instantiated against the loop
+/// body type, so new backends cannot be added after the fact. What is
+/// open at runtime is the name registry: register_name() binds a string
+/// (e.g. "mylib.assembly") to a backend and parameters, and lookup()
+/// resolves it, so embedding applications choose backends from input
+/// decks without recompiling the library.
+struct PolicyHandle {
+
+  /// Backends a handle can name. Entries for backends not enabled in the
+  /// RAJA configuration throw std::runtime_error when invoked.
+  enum class Backend : int {
+    Sequential = 0,  ///< seq_exec
+    Loop,            ///< loop_exec
+    Simd,            ///< simd_exec
+    OpenMP,          ///< omp_parallel_for_exec
+    TBB,             ///< tbb_for_exec
+    Cuda,            ///< cuda_exec, async, block size from gpu_block_size
+    Hip,             ///< hip_exec, async, block size from gpu_block_size
+    NumBackends
+  };
+
+  Backend backend = Backend::Sequential;
+
+  /// Block size for the Cuda/Hip backends, rounded to the nearest
+  /// pre-instantiated variant (128, 256, or 512); ignored elsewhere.
+  size_t gpu_block_size = 256;
+
+  PolicyHandle() = default;
+  PolicyHandle(Backend b, size_t block_size = 256)
+      : backend(b), gpu_block_size(block_size)
+  {
+  }
+
+  /// Bind a name to a handle in the process-wide registry, replacing any
+  /// previous binding. Thread-safe.
+  static void register_name(const std::string& name, PolicyHandle handle)
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    registry()[name] = handle;
+  }
+
+  /// Resolve a registered name to its handle; throws std::runtime_error
+  /// for names that were never registered. Thread-safe.
+  static PolicyHandle lookup(const std::string& name)
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto it = registry().find(name);
+    if (it == registry().end()) {
+      throw std::runtime_error("PolicyHandle: no policy registered as \"" +
+                               name + "\"");
+    }
+    return it->second;
+  }
+
+  /// Test whether a name is registered without throwing. Thread-safe.
+  static bool is_registered(const std::string& name)
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    return registry().count(name) != 0;
+  }
+
+private:
+  static std::unordered_map<std::string, PolicyHandle>& registry()
+  {
+    static std::unordered_map<std::string, PolicyHandle> names;
+    return names;
+  }
+
+  static std::mutex& registry_mutex()
+  {
+    static std::mutex m;
+    return m;
+  }
+};
+
+namespace detail
+{
+
+/// Flat dispatch table for one PolicyHandle call site, indexed by
+/// PolicyHandle::Backend. One entry function per backend is instantiated
+/// when the call site's (segment, body) instantiation is first reached;
+/// backends absent from this RAJA configuration get a throwing stub so
+/// table indices match the enum in every configuration.
+template <typename Iterable, typename LoopBody>
+struct policy_handle_dispatcher {
+
+  using invoke_fn = void (*)(PolicyHandle const&, Iterable&, LoopBody&);
+
+  template <typename Policy>
+  static void invoke_entry(PolicyHandle const&, Iterable& iter, LoopBody& body)
+  {
+    RAJA::forall<Policy>(iter, body);
+  }
+
+  static void invoke_unavailable(PolicyHandle const&, Iterable&, LoopBody&)
+  {
+    throw std::runtime_error(
+        "PolicyHandle: backend not enabled in this RAJA configuration");
+  }
+
+#if defined(RAJA_ENABLE_CUDA)
+  /// GPU block size is a template parameter of cuda_exec, so the handle's
+  /// runtime value selects among a few pre-instantiated variants.
+  static void invoke_cuda(PolicyHandle const& h, Iterable& iter, LoopBody& body)
+  {
+    if (h.gpu_block_size <= 128) {
+      RAJA::forall<cuda_exec<128, true>>(iter, body);
+    } else if (h.gpu_block_size <= 256) {
+      RAJA::forall<cuda_exec<256, true>>(iter, body);
+    } else {
+      RAJA::forall<cuda_exec<512, true>>(iter, body);
+    }
+  }
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+  static void invoke_hip(PolicyHandle const& h, Iterable& iter, LoopBody& body)
+  {
+    if (h.gpu_block_size <= 128) {
+      RAJA::forall<hip_exec<128, true>>(iter, body);
+    } else if (h.gpu_block_size <= 256) {
+      RAJA::forall<hip_exec<256, true>>(iter, body);
+    } else {
+      RAJA::forall<hip_exec<512, true>>(iter, body);
+    }
+  }
+#endif
+
+  static void invoke(PolicyHandle const& h, Iterable& iter, LoopBody& body)
+  {
+    static const invoke_fn table[] = {
+        &invoke_entry<seq_exec>,
+        &invoke_entry<loop_exec>,
+        &invoke_entry<simd_exec>,
+#if defined(RAJA_ENABLE_OPENMP)
+        &invoke_entry<omp_parallel_for_exec>,
+#else
+        &invoke_unavailable,
+#endif
+#if defined(RAJA_ENABLE_TBB)
+        &invoke_entry<tbb_for_exec>,
+#else
+        &invoke_unavailable,
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+        &invoke_cuda,
+#else
+        &invoke_unavailable,
+#endif
+#if defined(RAJA_ENABLE_HIP)
+        &invoke_hip,
+#else
+        &invoke_unavailable,
+#endif
+    };
+    static_assert(sizeof(table) / sizeof(table[0]) ==
+                      static_cast<size_t>(PolicyHandle::Backend::NumBackends),
+                  "dispatch table must cover every PolicyHandle backend");
+
+    size_t index = static_cast<size_t>(h.backend);
+    if (index >= static_cast<size_t>(PolicyHandle::Backend::NumBackends)) {
+      throw std::runtime_error("PolicyHandle: invalid backend");
+    }
+    table[index](h, iter, body);
+  }
+};
+
+}  // end namespace detail
+
+/// forall - PolicyHandle overload, dispatch to the backend the handle
+/// names through a pre-instantiated per-call-site table
+///
+/// Plugins and resource selection are handled by the forall<Policy> each
+/// table entry forwards to. When a GPU backend is compiled in, every
+/// table entry is instantiated, so bodies passed to this overload must be
+/// host-device capturable (e.g. RAJA_HOST_DEVICE lambdas) in such builds.
+///
+/// \param h handle naming the backend to run
+/// \param c iterable of items to supply to body
+/// \param body functor, will receive each value produced by iterable c
+template <typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if<type_traits::is_range<Container>>
+forall(PolicyHandle const& h, Container&& c, LoopBody&& body)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  using dispatcher =
+      detail::policy_handle_dispatcher<camp::decay<Container>,
+                                       camp::decay<LoopBody>>;
+  dispatcher::invoke(h, c, body);
+}
+
+}  // end namespace RAJA
+
+#endif
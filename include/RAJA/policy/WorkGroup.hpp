@@ -43,6 +43,10 @@ struct reverse_ordered
     : RAJA::make_policy_pattern_t<Policy::undefined,
                                   Pattern::workgroup_order> {
 };
+struct colored
+    : RAJA::make_policy_pattern_t<Policy::undefined,
+                                  Pattern::workgroup_order> {
+};
 
 struct array_of_pointers
     : RAJA::make_policy_pattern_t<Policy::undefined,
@@ -56,6 +60,10 @@ struct constant_stride_array_of_objects
     : RAJA::make_policy_pattern_t<Policy::undefined,
                                   Pattern::workgroup_storage> {
 };
+struct chunked_array_of_objects
+    : RAJA::make_policy_pattern_t<Policy::undefined,
+                                  Pattern::workgroup_storage> {
+};
 
 template < typename EXEC_POLICY_T,
            typename ORDER_POLICY_T,
@@ -78,10 +86,12 @@ struct WorkGroupPolicy
 
 using policy::workgroup::ordered;
 using policy::workgroup::reverse_ordered;
+using policy::workgroup::colored;
 
 using policy::workgroup::array_of_pointers;
 using policy::workgroup::ragged_array_of_objects;
 using policy::workgroup::constant_stride_array_of_objects;
+using policy::workgroup::chunked_array_of_objects;
 
 using policy::workgroup::WorkGroupPolicy;
 
@@ -145,6 +145,39 @@ atomicCAS(auto_atomic, T volatile *acc, T compare, T value)
   return atomicCAS(RAJA_AUTO_ATOMIC, acc, compare, value);
 }
 
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicLoad(auto_atomic, Order, T volatile *acc)
+{
+  return atomicLoad(RAJA_AUTO_ATOMIC, Order{}, acc);
+}
+
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE void atomicStore(auto_atomic,
+                                              Order,
+                                              T volatile *acc,
+                                              T value)
+{
+  atomicStore(RAJA_AUTO_ATOMIC, Order{}, acc, value);
+}
+
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicExchange(auto_atomic,
+                                              Order,
+                                              T volatile *acc,
+                                              T value)
+{
+  return atomicExchange(RAJA_AUTO_ATOMIC, Order{}, acc, value);
+}
+
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicAdd(auto_atomic,
+                                         Order,
+                                         T volatile *acc,
+                                         T value)
+{
+  return atomicAdd(RAJA_AUTO_ATOMIC, Order{}, acc, value);
+}
+
 
 }  // namespace RAJA
 
@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <type_traits>
+
 #include "RAJA/util/TypeConvert.hpp"
 #include "RAJA/util/macros.hpp"
 
@@ -37,6 +39,53 @@ namespace RAJA
 struct builtin_atomic {
 };
 
+
+/*!
+ * Memory-ordering tags for the ordered atomic API.
+ *
+ * The unadorned RAJA::atomicXXX calls keep their historical (roughly
+ * sequentially consistent) semantics; passing one of these tags as the
+ * extra template parameter relaxes the ordering where the backend can
+ * honor it. Orders are minimums: a backend may substitute a stronger
+ * order when the requested one is not expressible.
+ */
+namespace atomic_order
+{
+
+struct relaxed {
+};
+struct acquire {
+};
+struct release {
+};
+struct acq_rel {
+};
+struct seq_cst {
+};
+
+//! Trait identifying the ordering tags, used to keep the ordered atomic
+//  overloads from competing with calls that name T explicitly
+template <typename T>
+struct is_order : std::false_type {
+};
+template <>
+struct is_order<relaxed> : std::true_type {
+};
+template <>
+struct is_order<acquire> : std::true_type {
+};
+template <>
+struct is_order<release> : std::true_type {
+};
+template <>
+struct is_order<acq_rel> : std::true_type {
+};
+template <>
+struct is_order<seq_cst> : std::true_type {
+};
+
+}  // namespace atomic_order
+
 namespace detail
 {
 
@@ -233,6 +282,155 @@ RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_CAS_oper_sc(T volatile *acc,
 }
 
 
+#if defined(RAJA_COMPILER_MSVC) || (defined(_WIN32) && defined(__INTEL_COMPILER))
+
+//
+// The interlocked intrinsics are full barriers; requested orders are
+// minimums, so every ordered operation falls back to the existing
+// sequentially consistent primitives.
+//
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_load(T volatile *acc, Order)
+{
+  T compare = *acc;
+  return builtin_atomic_CAS(acc, compare, compare);
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE void builtin_atomic_store(T volatile *acc,
+                                                      T value,
+                                                      Order)
+{
+  builtin_atomic_CAS_oper(acc, [=](T) { return value; });
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_exchange(T volatile *acc,
+                                                      T value,
+                                                      Order)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T) { return value; });
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_add(T volatile *acc,
+                                                 T value,
+                                                 Order)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+}
+
+#else  // RAJA_COMPILER_MSVC
+
+RAJA_DEVICE_HIP RAJA_INLINE constexpr int builtin_order(atomic_order::relaxed)
+{
+  return __ATOMIC_RELAXED;
+}
+RAJA_DEVICE_HIP RAJA_INLINE constexpr int builtin_order(atomic_order::acquire)
+{
+  return __ATOMIC_ACQUIRE;
+}
+RAJA_DEVICE_HIP RAJA_INLINE constexpr int builtin_order(atomic_order::release)
+{
+  return __ATOMIC_RELEASE;
+}
+RAJA_DEVICE_HIP RAJA_INLINE constexpr int builtin_order(atomic_order::acq_rel)
+{
+  return __ATOMIC_ACQ_REL;
+}
+RAJA_DEVICE_HIP RAJA_INLINE constexpr int builtin_order(atomic_order::seq_cst)
+{
+  return __ATOMIC_SEQ_CST;
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<sizeof(T) == sizeof(unsigned), T>::type
+    builtin_atomic_load(T volatile *acc, Order)
+{
+  unsigned old =
+      __atomic_load_n((unsigned volatile *)acc, builtin_order(Order{}));
+  return RAJA::util::reinterp_A_as_B<unsigned, T>(old);
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<sizeof(T) == sizeof(unsigned long long), T>::type
+    builtin_atomic_load(T volatile *acc, Order)
+{
+  unsigned long long old = __atomic_load_n((unsigned long long volatile *)acc,
+                                           builtin_order(Order{}));
+  return RAJA::util::reinterp_A_as_B<unsigned long long, T>(old);
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<sizeof(T) == sizeof(unsigned), void>::type
+    builtin_atomic_store(T volatile *acc, T value, Order)
+{
+  __atomic_store_n((unsigned volatile *)acc,
+                   RAJA::util::reinterp_A_as_B<T, unsigned>(value),
+                   builtin_order(Order{}));
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<sizeof(T) == sizeof(unsigned long long), void>::type
+    builtin_atomic_store(T volatile *acc, T value, Order)
+{
+  __atomic_store_n((unsigned long long volatile *)acc,
+                   RAJA::util::reinterp_A_as_B<T, unsigned long long>(value),
+                   builtin_order(Order{}));
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<sizeof(T) == sizeof(unsigned), T>::type
+    builtin_atomic_exchange(T volatile *acc, T value, Order)
+{
+  unsigned old =
+      __atomic_exchange_n((unsigned volatile *)acc,
+                          RAJA::util::reinterp_A_as_B<T, unsigned>(value),
+                          builtin_order(Order{}));
+  return RAJA::util::reinterp_A_as_B<unsigned, T>(old);
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<sizeof(T) == sizeof(unsigned long long), T>::type
+    builtin_atomic_exchange(T volatile *acc, T value, Order)
+{
+  unsigned long long old = __atomic_exchange_n(
+      (unsigned long long volatile *)acc,
+      RAJA::util::reinterp_A_as_B<T, unsigned long long>(value),
+      builtin_order(Order{}));
+  return RAJA::util::reinterp_A_as_B<unsigned long long, T>(old);
+}
+
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<std::is_integral<T>::value, T>::type
+    builtin_atomic_add(T volatile *acc, T value, Order)
+{
+  return __atomic_fetch_add(acc, value, builtin_order(Order{}));
+}
+
+//
+// Floating-point adds go through the CAS loop, whose compare-exchange is
+// acq_rel; a relaxed request cannot weaken it.
+//
+template <typename T, typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<!std::is_integral<T>::value, T>::type
+    builtin_atomic_add(T volatile *acc, T value, Order)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+}
+
+#endif  // RAJA_COMPILER_MSVC
+
+
 }  // namespace detail
 
 
@@ -353,6 +551,44 @@ atomicCAS(builtin_atomic, T volatile *acc, T compare, T value)
 }
 
 
+//
+// Ordered operations, selected by an atomic_order tag.
+//
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T atomicLoad(builtin_atomic, Order, T volatile *acc)
+{
+  return detail::builtin_atomic_load(acc, Order{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE void atomicStore(builtin_atomic,
+                                             Order,
+                                             T volatile *acc,
+                                             T value)
+{
+  detail::builtin_atomic_store(acc, value, Order{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T atomicExchange(builtin_atomic,
+                                             Order,
+                                             T volatile *acc,
+                                             T value)
+{
+  return detail::builtin_atomic_exchange(acc, value, Order{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T atomicAdd(builtin_atomic,
+                                        Order,
+                                        T volatile *acc,
+                                        T value)
+{
+  return detail::builtin_atomic_add(acc, value, Order{});
+}
+
+
 }  // namespace RAJA
 
 // make sure this define doesn't bleed out of this header
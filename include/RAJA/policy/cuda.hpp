@@ -28,13 +28,19 @@
 #include <cuda_runtime.h>
 
 #include "RAJA/policy/cuda/atomic.hpp"
+#include "RAJA/policy/cuda/compact.hpp"
 #include "RAJA/policy/cuda/forall.hpp"
+#include "RAJA/policy/cuda/masked_forall.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
 #include "RAJA/policy/cuda/reduce.hpp"
+#include "RAJA/policy/cuda/find.hpp"
 #include "RAJA/policy/cuda/scan.hpp"
 #include "RAJA/policy/cuda/sort.hpp"
+#include "RAJA/policy/cuda/segmented_reduce.hpp"
 #include "RAJA/policy/cuda/kernel.hpp"
 #include "RAJA/policy/cuda/synchronize.hpp"
+#include "RAJA/policy/cuda/DeviceVector.hpp"
+#include "RAJA/policy/cuda/TransferPipeline.hpp"
 #include "RAJA/policy/cuda/WorkGroup.hpp"
 
 #endif  // closing endif for if defined(RAJA_ENABLE_CUDA)
@@ -0,0 +1,256 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining a growable device-side vector with
+ *          atomic-bump append inside kernels.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_DeviceVector_CUDA_HPP
+#define RAJA_DeviceVector_CUDA_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <cstddef>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+
+namespace RAJA
+{
+
+namespace cuda
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Device-side vector for building variable-length result lists
+ *         (collision pairs, flux candidates) inside kernels without
+ *         preallocating for the worst case.
+ *
+ * Kernels append through a trivially-copyable appender captured by
+ * value; each append bumps a device counter atomically and writes its
+ * slot, so appends from different threads never collide. Appends past
+ * the current capacity are dropped but still counted, which the host
+ * detects with overflowed() and repairs by growing and re-running the
+ * producing kernel:
+ *
+ * \code
+ *
+ *  RAJA::resources::Cuda res;
+ *  RAJA::cuda::DeviceVector<PairT> pairs(estimate, res);
+ *
+ *  do {
+ *    pairs.clear();
+ *    auto out = pairs.appender();
+ *    RAJA::forall<RAJA::cuda_exec_async<256>>(res, seg,
+ *        [=] RAJA_DEVICE (int i) {
+ *          if (collides(i)) { out.append(make_pair_for(i)); }
+ *        });
+ *  } while (pairs.overflowed() && (pairs.reserve(pairs.size()), true));
+ *
+ * \endcode
+ *
+ * Growth is geometric and runs on the vector's stream: the contents
+ * move with an async device-to-device copy and the old buffer is
+ * retired to the mempool at the next synchronizing call, so reserve()
+ * between launches does not stall the pipeline. size() synchronizes
+ * the stream to read the device counter; capacity(), reserve() and
+ * appender() do not.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class DeviceVector
+{
+public:
+  //! Device-side handle for appending; capture by value in lambdas
+  struct Appender {
+    T* data;
+    unsigned long long* count;
+    unsigned long long capacity;
+
+    /*!
+     * \brief Append a value, returning the slot index it was assigned.
+     *
+     * An index at or past capacity means the value was dropped; the
+     * count still advances so the host can size the retry.
+     */
+    RAJA_DEVICE RAJA_INLINE unsigned long long append(T const& value) const
+    {
+      unsigned long long idx = ::atomicAdd(count, 1ull);
+      if (idx < capacity) {
+        data[idx] = value;
+      }
+      return idx;
+    }
+  };
+
+  /*!
+   * \brief Construct a vector with room for capacity elements.
+   *
+   * The buffer and counter come from the device mempools, so repeated
+   * construction reuses allocations.
+   */
+  explicit DeviceVector(size_t capacity,
+                        resources::Cuda res = resources::Cuda::get_default())
+      : m_res(res), m_capacity(capacity > 0 ? capacity : 1)
+  {
+    m_data = device_mempool_type::getInstance().template malloc<T>(m_capacity);
+    m_count = device_zeroed_mempool_type::getInstance()
+                  .template malloc<unsigned long long>(1);
+  }
+
+  DeviceVector(DeviceVector const&) = delete;
+  DeviceVector& operator=(DeviceVector const&) = delete;
+
+  ~DeviceVector()
+  {
+    synchronize();
+    device_zeroed_mempool_type::getInstance().free(m_count);
+    device_mempool_type::getInstance().free(m_data);
+  }
+
+  //! Appender for kernels launched on the vector's stream
+  Appender appender()
+  {
+    return Appender{m_data, m_count,
+                    static_cast<unsigned long long>(m_capacity)};
+  }
+
+  //! Device pointer to the first element
+  T* data() { return m_data; }
+
+  //! Number of elements the buffer can hold without dropping appends
+  size_t capacity() const { return m_capacity; }
+
+  /*!
+   * \brief Number of appends made so far; synchronizes the stream.
+   *
+   * May exceed capacity() when appends were dropped.
+   */
+  size_t size()
+  {
+    unsigned long long count = 0;
+    cudaErrchk(cudaMemcpyAsync(&count, m_count, sizeof(unsigned long long),
+                               cudaMemcpyDeviceToHost, stream()));
+    synchronize();
+    return static_cast<size_t>(count);
+  }
+
+  //! Whether appends were dropped for lack of capacity; synchronizes
+  bool overflowed() { return size() > m_capacity; }
+
+  /*!
+   * \brief Grow the buffer to hold at least min_capacity elements.
+   *
+   * Growth is geometric from the current capacity. The old contents
+   * move with an async device-to-device copy on the stream and the old
+   * buffer is retired at the next synchronizing call, so this is safe
+   * to enqueue between launches without stalling.
+   */
+  void reserve(size_t min_capacity)
+  {
+    if (min_capacity <= m_capacity) {
+      return;
+    }
+
+    size_t new_capacity = m_capacity;
+    while (new_capacity < min_capacity) {
+      new_capacity *= 2;
+    }
+
+    T* new_data =
+        device_mempool_type::getInstance().template malloc<T>(new_capacity);
+    cudaErrchk(cudaMemcpyAsync(new_data, m_data, m_capacity * sizeof(T),
+                               cudaMemcpyDeviceToDevice, stream()));
+
+    m_retired.push_back(m_data);
+    m_data = new_data;
+    m_capacity = new_capacity;
+  }
+
+  /*!
+   * \brief Release the unused tail back to the mempool.
+   *
+   * Returns the number of bytes reclaimed; synchronizes the stream to
+   * read the element count.
+   */
+  size_t shrink_to_fit()
+  {
+    size_t count = size();
+    size_t used = count < m_capacity ? count : m_capacity;
+    if (used == 0) {
+      used = 1;
+    }
+    if (used == m_capacity) {
+      return 0;
+    }
+
+    size_t reclaimed = (m_capacity - used) * sizeof(T);
+
+    T* new_data = device_mempool_type::getInstance().template malloc<T>(used);
+    cudaErrchk(cudaMemcpyAsync(new_data, m_data, used * sizeof(T),
+                               cudaMemcpyDeviceToDevice, stream()));
+    synchronize();
+    device_mempool_type::getInstance().free(m_data);
+
+    m_data = new_data;
+    m_capacity = used;
+    return reclaimed;
+  }
+
+  //! Reset the element count to zero on the stream; keeps capacity
+  void clear()
+  {
+    cudaErrchk(cudaMemsetAsync(m_count, 0, sizeof(unsigned long long),
+                               stream()));
+  }
+
+  //! Wait for enqueued work and free buffers retired by reserve()
+  void synchronize()
+  {
+    cudaErrchk(cudaStreamSynchronize(stream()));
+    for (T* ptr : m_retired) {
+      device_mempool_type::getInstance().free(ptr);
+    }
+    m_retired.clear();
+  }
+
+  //! Resource whose stream orders the vector's copies and kernels
+  resources::Cuda& resource() { return m_res; }
+
+private:
+  cudaStream_t stream() { return m_res.get_stream(); }
+
+  resources::Cuda m_res;
+  T* m_data;
+  unsigned long long* m_count;
+  size_t m_capacity;
+  std::vector<T*> m_retired;
+};
+
+}  // namespace cuda
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_CUDA
+
+#endif  // closing endif for header file include guard
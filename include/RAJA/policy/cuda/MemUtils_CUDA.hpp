@@ -23,13 +23,21 @@
 
 #if defined(RAJA_ENABLE_CUDA)
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdio>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "camp/resource.hpp"
+
+#include "RAJA/util/Allocators.hpp"
 #include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -43,12 +51,25 @@ namespace cuda
 {
 
 
-//! Allocator for pinned memory for use in basic_mempool
+//! record a block of device memory to be zeroed in a batch before the
+//  next kernel launch (defined below with the other stream helpers)
+void zero_at_next_launch(void* ptr, size_t nbytes);
+
+//! drop any pending zero request for a block that is being freed
+//  (defined below with the other stream helpers)
+void discard_pending_zero(void* ptr);
+
+//! Allocator for pinned memory for use in basic_mempool, honoring any
+//  pinned allocator registered through RAJA::util::set_allocator
 struct PinnedAllocator {
 
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
   {
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::pinned)) {
+      return RAJA::util::callback_allocate(RAJA::util::AllocatorSpace::pinned,
+                                           nbytes);
+    }
     void* ptr;
     cudaErrchk(cudaHostAlloc(&ptr, nbytes, cudaHostAllocMapped));
     return ptr;
@@ -57,17 +78,26 @@ struct PinnedAllocator {
   // returns true on success, false on failure
   bool free(void* ptr)
   {
-    cudaErrchk(cudaFreeHost(ptr));
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::pinned)) {
+      RAJA::util::callback_deallocate(RAJA::util::AllocatorSpace::pinned, ptr);
+    } else {
+      cudaErrchk(cudaFreeHost(ptr));
+    }
     return true;
   }
 };
 
-//! Allocator for device memory for use in basic_mempool
+//! Allocator for device memory for use in basic_mempool, honoring any
+//  device allocator registered through RAJA::util::set_allocator
 struct DeviceAllocator {
 
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
   {
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::device)) {
+      return RAJA::util::callback_allocate(RAJA::util::AllocatorSpace::device,
+                                           nbytes);
+    }
     void* ptr;
     cudaErrchk(cudaMalloc(&ptr, nbytes));
     return ptr;
@@ -76,12 +106,21 @@ struct DeviceAllocator {
   // returns true on success, false on failure
   bool free(void* ptr)
   {
-    cudaErrchk(cudaFree(ptr));
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::device)) {
+      RAJA::util::callback_deallocate(RAJA::util::AllocatorSpace::device, ptr);
+    } else {
+      cudaErrchk(cudaFree(ptr));
+    }
     return true;
   }
 };
 
-//! Allocator for pre-zeroed device memory for use in basic_mempool
+//! Allocator for pre-zeroed device memory for use in basic_mempool,
+//  honoring any device_zeroed allocator registered through
+//  RAJA::util::set_allocator; RAJA zeroes the memory either way.
+//  Zeroing is deferred and batched into coalesced async memsets issued
+//  just before the next kernel launch, so growing the pool does not
+//  serialize the stream on a synchronous memset per allocation.
 //  Note: Memory must be zero when returned to mempool
 struct DeviceZeroedAllocator {
 
@@ -89,15 +128,28 @@ struct DeviceZeroedAllocator {
   void* malloc(size_t nbytes)
   {
     void* ptr;
-    cudaErrchk(cudaMalloc(&ptr, nbytes));
-    cudaErrchk(cudaMemset(ptr, 0, nbytes));
+    if (RAJA::util::has_allocator(
+            RAJA::util::AllocatorSpace::device_zeroed)) {
+      ptr = RAJA::util::callback_allocate(
+          RAJA::util::AllocatorSpace::device_zeroed, nbytes);
+    } else {
+      cudaErrchk(cudaMalloc(&ptr, nbytes));
+    }
+    zero_at_next_launch(ptr, nbytes);
     return ptr;
   }
 
   // returns true on success, false on failure
   bool free(void* ptr)
   {
-    cudaErrchk(cudaFree(ptr));
+    discard_pending_zero(ptr);
+    if (RAJA::util::has_allocator(
+            RAJA::util::AllocatorSpace::device_zeroed)) {
+      RAJA::util::callback_deallocate(
+          RAJA::util::AllocatorSpace::device_zeroed, ptr);
+    } else {
+      cudaErrchk(cudaFree(ptr));
+    }
     return true;
   }
 };
@@ -107,6 +159,65 @@ using device_zeroed_mempool_type =
     basic_mempool::MemPool<DeviceZeroedAllocator>;
 using pinned_mempool_type = basic_mempool::MemPool<PinnedAllocator>;
 
+///
+/// Stream-ordered device allocation for transient workspace.
+///
+/// The arena mempool grows with synchronous cudaMalloc under the pool
+/// mutex, so a growth triggered by one stream's workspace stalls every
+/// stream. Where the runtime provides stream-ordered allocation (CUDA
+/// 11.2 and newer with device support), these helpers enqueue the
+/// allocation and free on the owning stream instead, so workspace churn
+/// rides the stream like any other work; elsewhere they fall back to
+/// the arena mempool. A pointer must be freed through device_free_async
+/// so it returns to the allocator it came from.
+///
+
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 11020
+//! whether the current device supports stream-ordered allocation;
+//  queried once, as RAJA assumes one device per process (see device_prop)
+RAJA_INLINE bool stream_ordered_alloc_supported()
+{
+  static bool supported = []() {
+    int device, attr = 0;
+    cudaErrchk(cudaGetDevice(&device));
+    cudaErrchk(cudaDeviceGetAttribute(
+        &attr, cudaDevAttrMemoryPoolsSupported, device));
+    return attr != 0;
+  }();
+  return supported;
+}
+#endif
+
+//! allocate nbytes of device memory ordered on stream
+RAJA_INLINE void* device_malloc_async(size_t nbytes, cudaStream_t stream)
+{
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 11020
+  if (stream_ordered_alloc_supported()) {
+    void* ptr;
+    cudaErrchk(cudaMallocAsync(&ptr, nbytes, stream));
+    return ptr;
+  }
+#else
+  RAJA_UNUSED_VAR(stream);
+#endif
+  return device_mempool_type::getInstance().malloc<char>(nbytes);
+}
+
+//! free device memory obtained from device_malloc_async once the work
+//  already enqueued on stream completes
+RAJA_INLINE void device_free_async(void* ptr, cudaStream_t stream)
+{
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 11020
+  if (stream_ordered_alloc_supported()) {
+    cudaErrchk(cudaFreeAsync(ptr, stream));
+    return;
+  }
+#else
+  RAJA_UNUSED_VAR(stream);
+#endif
+  device_mempool_type::getInstance().free(ptr);
+}
+
 namespace detail
 {
 
@@ -116,10 +227,7 @@ struct cudaInfo {
   cuda_dim_t blockDim{0, 0, 0};
   cudaStream_t stream = 0;
   bool setup_reducers = false;
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  cudaInfo* thread_states = nullptr;
-  omp::mutex lock;
-#endif
+  RAJA::mutex lock;
 };
 
 //! class that changes a value on construction then resets it at destruction
@@ -141,22 +249,244 @@ private:
 
 extern cudaInfo g_status;
 
-extern cudaInfo tl_status;
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-#pragma omp threadprivate(tl_status)
-#endif
+//! State of the launch in flight on this thread. thread_local rather
+//  than omp threadprivate so concurrent submission from any host
+//  threads, e.g. one std::thread per device, stays race-free.
+extern thread_local cudaInfo tl_status;
+
+//! Shared bookkeeping below is sharded across dedicated mutexes, one
+//  per concern, so threads driving independent Resources contend only
+//  on the map they actually touch rather than on one global lock.
 
+extern RAJA::mutex g_stream_lock;
 extern std::unordered_map<cudaStream_t, bool> g_stream_info_map;
 
+extern RAJA::mutex g_occ_lock;
+
+//! occupancy-calculator block sizes cached per kernel symbol
+extern std::unordered_map<const void*, int> g_occ_block_size_map;
+
+//! occupancy-calculator resident blocks per SM cached per kernel symbol
+extern std::unordered_map<const void*, int> g_occ_active_blocks_map;
+
+//! kernel symbols whose launch diagnostics have already been reported
+extern std::unordered_map<const void*, bool> g_diag_reported_map;
+
+extern RAJA::mutex g_zero_lock;
+
+//! device memory blocks awaiting batched zero-initialization
+extern std::vector<std::pair<void*, size_t>> g_pending_zero_list;
+
+//! lock-free mirror of g_pending_zero_list's size, so the per-launch
+//  flush check is one atomic load in the common empty case
+extern std::atomic<size_t> g_num_pending_zeros;
+
+//! completion events of zero batches already issued, with the stream
+//  each was issued on; flushes on other streams wait on these so a
+//  kernel consuming a zeroed block is ordered after its memset
+extern std::vector<std::pair<cudaStream_t, cudaEvent_t>> g_zero_event_list;
+
+//! lock-free mirror of g_zero_event_list's size, like g_num_pending_zeros
+extern std::atomic<size_t> g_num_zero_events;
+
 }  // namespace detail
 
+//! whether launch-shape diagnostics are requested, via the
+//  RAJA_CUDA_KERNEL_DIAGNOSTICS environment variable
+bool kernel_diagnostics_enabled();
+
+//! report warp fill, shared-memory pressure, and predicted occupancy
+//  for the given kernel symbol and resolved launch shape; reports once
+//  per symbol and only when kernel_diagnostics_enabled()
+void kernel_launch_diagnostics(const void* func,
+                               cuda_dim_t blocks,
+                               cuda_dim_t threads,
+                               size_t dynamic_shmem);
+
+//! Size of the kernel parameter space. Lambda captures travel through
+//  kernel arguments, so a capture footprint near this limit is the
+//  leading edge of the parameter-spill performance cliff.
+constexpr size_t kernel_param_space_limit = 4 * 1024;
+
+//! Resource footprint of one generated kernel, captured at its first
+//  launch. local_bytes is per-thread local memory from the compiled
+//  resource usage; the runtime does not expose spill load/store counts
+//  directly, but spilled registers land in local memory, so a nonzero
+//  value on a kernel with no local arrays indicates spilling.
+struct KernelResourceUsage {
+  const void* func;           //!< kernel symbol
+  size_t param_bytes;         //!< kernel argument (capture) size
+  size_t local_bytes;         //!< local memory per thread
+  size_t shared_bytes;        //!< static shared memory per block
+  size_t const_bytes;         //!< user constant memory
+  int num_regs;               //!< registers per thread
+  int max_threads_per_block;  //!< limit imposed by register/shmem use
+};
+
+//! Record the resource footprint of the given kernel symbol, querying
+//  cudaFuncGetAttributes once per symbol; launch sites call this at a
+//  kernel's first launch. When kernel_diagnostics_enabled() the first
+//  recording also reports the footprint and flags parameter sizes near
+//  the spill cliff.
+void record_kernel_resource_usage(const void* func, size_t param_bytes);
+
+//! Snapshot of the resource footprints recorded so far, one entry per
+//  generated kernel that has launched; the programmatic surface for CI
+//  perf harnesses tracking capture-size and register regressions.
+std::vector<KernelResourceUsage> kernel_resource_usage();
+
+//! Get an occupancy-maximizing block size for the given kernel symbol.
+//  Queries cudaOccupancyMaxPotentialBlockSize once per symbol and caches
+//  the result, so repeated launches pay only a map lookup.
+RAJA_INLINE
+int occupancy_max_potential_block_size(const void* func,
+                                       size_t dynamic_shmem = 0)
+{
+  lock_guard<RAJA::mutex> lock(detail::g_occ_lock);
+  auto iter = detail::g_occ_block_size_map.find(func);
+  if (iter != detail::g_occ_block_size_map.end()) {
+    return iter->second;
+  }
+  int min_grid_size, block_size;
+  cudaErrchk(cudaOccupancyMaxPotentialBlockSize(
+      &min_grid_size, &block_size, func, dynamic_shmem));
+  detail::g_occ_block_size_map.emplace(func, block_size);
+  return block_size;
+}
+
+//! Get the number of resident blocks per multiprocessor for the given
+//  kernel symbol at the given block size. Queries
+//  cudaOccupancyMaxActiveBlocksPerMultiprocessor once per symbol and
+//  caches the result, so repeated launches pay only a map lookup.
+RAJA_INLINE
+int occupancy_max_active_blocks_per_sm(const void* func,
+                                       int block_size,
+                                       size_t dynamic_shmem = 0)
+{
+  lock_guard<RAJA::mutex> lock(detail::g_occ_lock);
+  auto iter = detail::g_occ_active_blocks_map.find(func);
+  if (iter != detail::g_occ_active_blocks_map.end()) {
+    return iter->second;
+  }
+  int num_blocks;
+  cudaErrchk(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &num_blocks, func, block_size, dynamic_shmem));
+  detail::g_occ_active_blocks_map.emplace(func, num_blocks);
+  return num_blocks;
+}
+
+//! Record a block of device memory to be zeroed before the next kernel
+//  launch. Blocks queued here are cleared by flush_pending_zeros in a
+//  few coalesced async memsets instead of one synchronous memset each.
+RAJA_INLINE
+void zero_at_next_launch(void* ptr, size_t nbytes)
+{
+  lock_guard<RAJA::mutex> lock(detail::g_zero_lock);
+  detail::g_pending_zero_list.emplace_back(ptr, nbytes);
+  detail::g_num_pending_zeros.store(detail::g_pending_zero_list.size(),
+                                    std::memory_order_release);
+}
+
+//! Drop any pending zero request for a block that is being freed, so a
+//  later flush does not write through a stale pointer.
+RAJA_INLINE
+void discard_pending_zero(void* ptr)
+{
+  lock_guard<RAJA::mutex> lock(detail::g_zero_lock);
+  auto& pending = detail::g_pending_zero_list;
+  pending.erase(std::remove_if(pending.begin(),
+                               pending.end(),
+                               [=](std::pair<void*, size_t> const& block) {
+                                 return block.first == ptr;
+                               }),
+                pending.end());
+  detail::g_num_pending_zeros.store(pending.size(), std::memory_order_release);
+}
+
+//! Zero all blocks queued by zero_at_next_launch on the given stream.
+//  Blocks are sorted by address and adjacent blocks are merged, so the
+//  per-allocation zeroing collapses into one async memset per
+//  contiguous run. Called before each kernel launch and before
+//  synchronization.
+//
+//  A block may be consumed by a launch on a stream other than the one
+//  whose flush zeroed it, so each flush that issues memsets records a
+//  completion event on its stream, and every flush makes the given
+//  stream wait on the events recorded by other streams before
+//  returning. The kernel the caller is about to launch is therefore
+//  ordered after every zero batch, whichever stream issued it; events
+//  are destroyed once they have completed.
+RAJA_INLINE
+void flush_pending_zeros(cudaStream_t stream)
+{
+  // lock-free fast path: with no zeroing queued and no zero batch still
+  // in flight, which is the common case on the per-launch hot path,
+  // skip the lock entirely
+  if (detail::g_num_pending_zeros.load(std::memory_order_acquire) == 0 &&
+      detail::g_num_zero_events.load(std::memory_order_acquire) == 0) {
+    return;
+  }
+
+  lock_guard<RAJA::mutex> lock(detail::g_zero_lock);
+
+  if (!detail::g_pending_zero_list.empty()) {
+    std::vector<std::pair<void*, size_t>>& pending =
+        detail::g_pending_zero_list;
+    std::sort(pending.begin(), pending.end());
+
+    char* begin = static_cast<char*>(pending.front().first);
+    char* end = begin + pending.front().second;
+    for (size_t i = 1; i < pending.size(); ++i) {
+      char* block_begin = static_cast<char*>(pending[i].first);
+      if (block_begin == end) {
+        end = block_begin + pending[i].second;
+      } else {
+        cudaErrchk(cudaMemsetAsync(begin, 0, end - begin, stream));
+        begin = block_begin;
+        end = block_begin + pending[i].second;
+      }
+    }
+    cudaErrchk(cudaMemsetAsync(begin, 0, end - begin, stream));
+
+    pending.clear();
+    detail::g_num_pending_zeros.store(0, std::memory_order_release);
+
+    cudaEvent_t event;
+    cudaErrchk(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    cudaErrchk(cudaEventRecord(event, stream));
+    detail::g_zero_event_list.emplace_back(stream, event);
+  }
+
+  // order this stream after zero batches issued on other streams, and
+  // retire events whose batches have completed; batches issued on this
+  // stream are already ordered ahead of the caller's launch
+  auto& events = detail::g_zero_event_list;
+  for (auto iter = events.begin(); iter != events.end();) {
+    cudaError_t err = cudaEventQuery(iter->second);
+    if (err == cudaSuccess) {
+      cudaErrchk(cudaEventDestroy(iter->second));
+      iter = events.erase(iter);
+      continue;
+    } else if (err == cudaErrorNotReady) {
+      // swallow the not-ready sticky error so it is not picked up later
+      cudaGetLastError();
+      if (iter->first != stream) {
+        cudaErrchk(cudaStreamWaitEvent(stream, iter->second, 0));
+      }
+    } else {
+      cudaErrchk(err);
+    }
+    ++iter;
+  }
+  detail::g_num_zero_events.store(events.size(), std::memory_order_release);
+}
+
 //! Ensure all streams in use are synchronized wrt raja kernel launches
 RAJA_INLINE
 void synchronize()
 {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  lock_guard<omp::mutex> lock(detail::g_status.lock);
-#endif
+  flush_pending_zeros(0);
+  lock_guard<RAJA::mutex> lock(detail::g_stream_lock);
   bool synchronize = false;
   for (auto& val : detail::g_stream_info_map) {
     if (!val.second) {
@@ -173,9 +503,8 @@ void synchronize()
 RAJA_INLINE
 void synchronize(cudaStream_t stream)
 {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  lock_guard<omp::mutex> lock(detail::g_status.lock);
-#endif
+  flush_pending_zeros(stream);
+  lock_guard<RAJA::mutex> lock(detail::g_stream_lock);
   auto iter = detail::g_stream_info_map.find(stream);
   if (iter != detail::g_stream_info_map.end()) {
     if (!iter->second) {
@@ -188,13 +517,40 @@ void synchronize(cudaStream_t stream)
   }
 }
 
+//! Query stream completion wrt raja kernel launches without blocking.
+//  Returns true if all work launched on the stream has completed.
+RAJA_INLINE
+bool query(cudaStream_t stream)
+{
+  lock_guard<RAJA::mutex> lock(detail::g_stream_lock);
+  auto iter = detail::g_stream_info_map.find(stream);
+  if (iter != detail::g_stream_info_map.end()) {
+    if (iter->second) {
+      return true;
+    }
+    cudaError_t err = cudaStreamQuery(stream);
+    if (err == cudaSuccess) {
+      iter->second = true;
+      return true;
+    } else if (err == cudaErrorNotReady) {
+      // swallow the not-ready sticky error so it is not picked up later
+      cudaGetLastError();
+      return false;
+    } else {
+      cudaErrchk(err);
+      return false;
+    }
+  } else {
+    fprintf(stderr, "Cannot query unknown stream.\n");
+    std::abort();
+  }
+}
+
 //! Indicate stream is asynchronous
 RAJA_INLINE
 void launch(cudaStream_t stream)
 {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  lock_guard<omp::mutex> lock(detail::g_status.lock);
-#endif
+  lock_guard<RAJA::mutex> lock(detail::g_stream_lock);
   auto iter = detail::g_stream_info_map.find(stream);
   if (iter != detail::g_stream_info_map.end()) {
     iter->second = false;
@@ -207,6 +563,7 @@ void launch(cudaStream_t stream)
 RAJA_INLINE
 void launch(const void* func, cuda_dim_t gridDim, cuda_dim_t blockDim, void** args, size_t shmem, cudaStream_t stream)
 {
+  flush_pending_zeros(stream);
   cudaErrchk(cudaLaunchKernel(func, gridDim, blockDim, args, shmem, stream));
   launch(stream);
 }
@@ -215,6 +572,263 @@ void launch(const void* func, cuda_dim_t gridDim, cuda_dim_t blockDim, void** ar
 RAJA_INLINE
 void peekAtLastError() { cudaErrchk(cudaPeekAtLastError()); }
 
+//! Registry of instantiated kernel symbols used by preload_kernels.
+//  Launch sites register the kernels they instantiate during static
+//  initialization, so by the time an application can call
+//  preload_kernels the registry lists every RAJA kernel the executable
+//  may launch.
+class KernelRegistry
+{
+public:
+  static KernelRegistry& getInstance()
+  {
+    static KernelRegistry registry;
+    return registry;
+  }
+
+  //! record a kernel symbol; returns true so registration can run as
+  //  the initializer of a static flag
+  bool register_kernel(const void* func)
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+    m_kernels.push_back(func);
+    return true;
+  }
+
+  //! touch every registered kernel so the driver loads, and JITs if
+  //  necessary, its module now rather than at first launch
+  void preload()
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+    for (const void* func : m_kernels) {
+      cudaFuncAttributes attr;
+      cudaErrchk(cudaFuncGetAttributes(&attr, func));
+    }
+  }
+
+  //! number of kernels registered so far
+  size_t size()
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+    return m_kernels.size();
+  }
+
+private:
+  KernelRegistry() = default;
+
+  RAJA::mutex m_mutex;
+
+  std::vector<const void*> m_kernels;
+};
+
+namespace detail
+{
+
+//! Registers the kernel named by KernelGetter::get() with the
+//  KernelRegistry. Odr-using s_registered at a launch site instantiates
+//  this static member, whose dynamic initializer performs the
+//  registration at program startup.
+template <typename KernelGetter>
+struct KernelRegistrar {
+  static bool s_registered;
+};
+
+template <typename KernelGetter>
+bool KernelRegistrar<KernelGetter>::s_registered =
+    KernelRegistry::getInstance().register_kernel(
+        (const void*)KernelGetter::get());
+
+}  // namespace detail
+
+//! force driver module load for every registered kernel; see
+//  RAJA::preload_kernels for the resource-taking entry point
+RAJA_INLINE
+void preload_kernels() { KernelRegistry::getInstance().preload(); }
+
+//! Register the kernel function named by the argument, which must be a
+//  (possibly template-id) expression naming a __global__ function, for
+//  ahead-of-time warmup through RAJA::preload_kernels. The local getter
+//  class keys the registrar template so registration runs once per
+//  kernel instantiation during static initialization.
+#define RAJA_CUDA_REGISTER_KERNEL(...)                                   \
+  {                                                                      \
+    struct KernelGetter {                                                \
+      static const void* get() { return (const void*)&(__VA_ARGS__); }  \
+    };                                                                   \
+    (void)::RAJA::cuda::detail::KernelRegistrar<KernelGetter>::          \
+        s_registered;                                                    \
+  }
+
+#if defined(__CUDACC__)
+
+///
+/// Constant-memory binding for small read-only kernel parameters.
+///
+/// Lambda captures travel through kernel arguments, so a table of EOS or
+/// material constants captured by value is reloaded from memory per
+/// thread. Reserving a slot in the constant slab and binding the table
+/// before the launch instead serves every thread's loads from the
+/// constant cache, which broadcasts a uniform access to a warp in one
+/// transaction.
+///
+/// The slab is a static __constant__ symbol, so each translation unit
+/// gets its own copy: a binding is only visible to kernels launched from
+/// the same translation unit. Slot offsets are handed out from one
+/// program-wide watermark, so handles never alias even when reservations
+/// happen in different translation units.
+///
+/// Usage example:
+///
+/// \verbatim
+///
+///   static auto eos_slot = RAJA::cuda::reserve_constant_param<EosTable>();
+///
+///   RAJA::cuda::bind_constant_param(eos_slot, eos_table, stream);
+///   RAJA::forall<RAJA::cuda_exec_async<256>>(range, [=] RAJA_DEVICE (int i) {
+///     double p = eos_slot.get().pressure[matid[i]] * e[i];
+///     ...
+///   });
+///
+/// \endverbatim
+///
+
+#if !defined(RAJA_CUDA_CONSTANT_PARAM_BYTES)
+#define RAJA_CUDA_CONSTANT_PARAM_BYTES 8192
+#endif
+
+namespace detail
+{
+
+//! per-translation-unit constant slab that bound parameters live in
+static __constant__ char g_constant_params[RAJA_CUDA_CONSTANT_PARAM_BYTES];
+
+//! program-wide reservation watermark, in bytes
+RAJA_INLINE size_t& constant_param_watermark()
+{
+  static size_t watermark = 0;
+  return watermark;
+}
+
+}  // namespace detail
+
+/*!
+ * Handle to a reserved slot in the constant parameter slab. The handle
+ * is one offset, so capturing it into a device lambda is free; get()
+ * reads the bound value through the constant cache.
+ */
+template <typename T>
+struct ConstantParam {
+  size_t offset;
+
+  RAJA_DEVICE RAJA_INLINE const T& get() const
+  {
+    return *reinterpret_cast<const T*>(detail::g_constant_params + offset);
+  }
+};
+
+/*!
+ * Reserve a constant-memory slot for a value of type T; typically called
+ * once per parameter as the initializer of a static handle. Aborts if
+ * the reservations exceed the slab size, which can be raised by defining
+ * RAJA_CUDA_CONSTANT_PARAM_BYTES before including RAJA.
+ */
+template <typename T>
+RAJA_INLINE ConstantParam<T> reserve_constant_param()
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "constant parameters must be trivially copyable");
+  lock_guard<RAJA::mutex> lock(detail::g_status.lock);
+  size_t& watermark = detail::constant_param_watermark();
+  size_t offset = (watermark + alignof(T) - 1) & ~(alignof(T) - 1);
+  if (offset + sizeof(T) > RAJA_CUDA_CONSTANT_PARAM_BYTES) {
+    RAJA_ABORT_OR_THROW("Exceeded RAJA_CUDA_CONSTANT_PARAM_BYTES");
+  }
+  watermark = offset + sizeof(T);
+  return ConstantParam<T>{offset};
+}
+
+/*!
+ * Bind a value to a reserved slot. The copy is issued on the given
+ * stream, so a bind followed by a launch on the same stream is ordered
+ * and the value may be re-bound between launches.
+ */
+template <typename T>
+RAJA_INLINE void bind_constant_param(ConstantParam<T> handle,
+                                     const T& value,
+                                     cudaStream_t stream = 0)
+{
+  cudaErrchk(cudaMemcpyToSymbolAsync(detail::g_constant_params,
+                                     &value,
+                                     sizeof(T),
+                                     handle.offset,
+                                     cudaMemcpyHostToDevice,
+                                     stream));
+}
+
+#endif  // closing endif for __CUDACC__
+
+/*!
+ * Handle to a device-side parameter block, for hot/cold splitting of
+ * kernel lambda captures. A lambda that captures many Views pays for
+ * all of them on every launch: the parameter copy grows with the
+ * capture list and the compiler spills captured state to local memory.
+ * Gather the rarely dereferenced ("cold") captures into one struct,
+ * upload it once per step with make_param_block, and capture only this
+ * handle; the hot captures stay ordinary captures in the kernel
+ * arguments. The handle is one pointer, so the per-launch parameter
+ * traffic and the spill footprint shrink to that.
+ */
+template <typename T>
+struct ParamBlock {
+  const T* ptr;
+
+  RAJA_DEVICE RAJA_INLINE const T& get() const { return *ptr; }
+  RAJA_DEVICE RAJA_INLINE const T* operator->() const { return ptr; }
+};
+
+/*!
+ * Upload a value into a mempool-backed device block and return the
+ * handle to capture. The copy is issued on the given stream, so an
+ * upload followed by launches on the same stream is ordered.
+ */
+template <typename T>
+RAJA_INLINE ParamBlock<T> make_param_block(const T& value,
+                                           cudaStream_t stream = 0)
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "parameter blocks must be trivially copyable");
+  T* dptr = device_mempool_type::getInstance().template malloc<T>(1);
+  cudaErrchk(cudaMemcpyAsync(
+      dptr, &value, sizeof(T), cudaMemcpyHostToDevice, stream));
+  return ParamBlock<T>{dptr};
+}
+
+/*!
+ * Refresh the block contents in place, e.g. at the top of a step;
+ * kernels launched after the copy on the same stream see the new value.
+ */
+template <typename T>
+RAJA_INLINE void update_param_block(ParamBlock<T> handle,
+                                    const T& value,
+                                    cudaStream_t stream = 0)
+{
+  cudaErrchk(cudaMemcpyAsync(const_cast<T*>(handle.ptr),
+                             &value,
+                             sizeof(T),
+                             cudaMemcpyHostToDevice,
+                             stream));
+}
+
+/*!
+ * Return the block's memory to the device mempool. The caller must
+ * ensure kernels reading the block have completed.
+ */
+template <typename T>
+RAJA_INLINE void destroy_param_block(ParamBlock<T> handle)
+{
+  device_mempool_type::getInstance().free(const_cast<T*>(handle.ptr));
+}
+
 //! query whether reducers in this thread should setup for device execution now
 RAJA_INLINE
 bool setupReducers() { return detail::tl_status.setup_reducers; }
@@ -248,7 +862,14 @@ RAJA_INLINE typename std::remove_reference<LOOP_BODY>::type make_launch_body(
   detail::tl_status.blockDim = blockDim;
 
   using return_type = typename std::remove_reference<LOOP_BODY>::type;
-  return return_type(std::forward<LOOP_BODY>(loop_body));
+  return_type body(std::forward<LOOP_BODY>(loop_body));
+
+  // copying the body above runs reducer setup, which may queue zeroed
+  // tally blocks; clear them now so they are zero for any launch
+  // mechanism, including kernels launched without going through launch()
+  flush_pending_zeros(stream);
+
+  return body;
 }
 
 RAJA_INLINE
@@ -270,6 +891,16 @@ cudaDeviceProp& device_prop()
 
 }  // namespace cuda
 
+//! Touch every registered CUDA kernel so the driver pays module-load
+//  and JIT latency here, at init, instead of on first launch inside the
+//  timed loop. The resource selects the backend overload; attributes
+//  are queried in the calling thread's current device context.
+RAJA_INLINE
+void preload_kernels(camp::resources::Cuda& RAJA_UNUSED_ARG(res))
+{
+  cuda::preload_kernels();
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_CUDA
@@ -0,0 +1,225 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining a pinned-memory staging pipeline for
+ *          overlapping host-device transfers with kernel execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_TransferPipeline_CUDA_HPP
+#define RAJA_TransferPipeline_CUDA_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+
+namespace RAJA
+{
+
+namespace cuda
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Bounded ring of pinned staging buffers for streaming data that
+ *         does not fit on the device through chunked, overlapped
+ *         host-device transfers.
+ *
+ * Each stage of the ring owns a pinned host buffer, a device buffer of
+ * the same size, and an event marking when the stage's buffers may be
+ * reused. All transfers and the kernels that consume them are expected
+ * to run on the stream of the resource the pipeline was built with, so
+ * stream ordering serializes each stage's copy, its consumer, and the
+ * reuse event while different stages overlap PCIe transfer with compute.
+ *
+ * Typical out-of-core sweep:
+ *
+ * \code
+ *
+ *  RAJA::resources::Cuda res;
+ *  RAJA::cuda::TransferPipeline<double> pipe(chunk_len, 3, res);
+ *
+ *  for (size_t offset = 0; offset < total_len; offset += chunk_len) {
+ *    size_t len = std::min(chunk_len, total_len - offset);
+ *
+ *    auto stage = pipe.acquire();                  // wait for a free stage
+ *    double* d_chunk = pipe.send(stage, &host_data[offset], len);
+ *
+ *    RAJA::forall<RAJA::cuda_exec_async<256>>(res,
+ *        RAJA::RangeSegment(0, len), [=] RAJA_DEVICE (int i) {
+ *          // ... consume d_chunk[i] ...
+ *        });
+ *
+ *    pipe.release(stage);                          // stage reusable after kernel
+ *  }
+ *  pipe.drain();
+ *
+ * \endcode
+ *
+ * For results flowing back, call fetch() after the producing kernel is
+ * enqueued and receive() when the data is needed on the host.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class TransferPipeline
+{
+public:
+  //! Handle to one stage of the ring, valid from acquire() to release()
+  struct Stage {
+    T* hptr;       //! pinned staging buffer
+    T* dptr;       //! device buffer
+    size_t index;  //! position in the ring
+  };
+
+  /*!
+   * \brief Construct a pipeline whose stages hold up to chunk_len
+   *        elements each.
+   *
+   * Buffers come from the pinned and device mempools, so repeated
+   * pipeline construction reuses allocations.
+   */
+  TransferPipeline(size_t chunk_len,
+                   size_t num_stages = 3,
+                   resources::Cuda res = resources::Cuda::get_default())
+      : m_res(res), m_chunk_len(chunk_len), m_next(0)
+  {
+    m_stages.resize(num_stages);
+    for (StageState& s : m_stages) {
+      s.hptr = pinned_mempool_type::getInstance().template malloc<T>(chunk_len);
+      s.dptr = device_mempool_type::getInstance().template malloc<T>(chunk_len);
+      cudaErrchk(cudaEventCreateWithFlags(&s.reusable, cudaEventDisableTiming));
+      s.in_flight = false;
+    }
+  }
+
+  TransferPipeline(TransferPipeline const&) = delete;
+  TransferPipeline& operator=(TransferPipeline const&) = delete;
+
+  ~TransferPipeline()
+  {
+    drain();
+    for (StageState& s : m_stages) {
+      cudaErrchk(cudaEventDestroy(s.reusable));
+      device_mempool_type::getInstance().free(s.dptr);
+      pinned_mempool_type::getInstance().free(s.hptr);
+    }
+  }
+
+  //! Get the next stage in the ring, blocking until its previous
+  //  transfers and consumers have completed.
+  Stage acquire()
+  {
+    size_t index = m_next;
+    m_next = (m_next + 1) % m_stages.size();
+
+    StageState& s = m_stages[index];
+    if (s.in_flight) {
+      cudaErrchk(cudaEventSynchronize(s.reusable));
+      s.in_flight = false;
+    }
+    return Stage{s.hptr, s.dptr, index};
+  }
+
+  //! Copy len elements from src through the stage's pinned buffer and
+  //  enqueue the async transfer to the device; returns the device
+  //  pointer for the consuming kernel.
+  T* send(Stage const& stage, const T* src, size_t len)
+  {
+    std::memcpy(stage.hptr, src, len * sizeof(T));
+    cudaErrchk(cudaMemcpyAsync(stage.dptr, stage.hptr, len * sizeof(T),
+                               cudaMemcpyHostToDevice, stream()));
+    return stage.dptr;
+  }
+
+  //! Enqueue the async transfer of len elements from the stage's device
+  //  buffer into its pinned buffer, after the producing kernel.
+  void fetch(Stage const& stage, size_t len)
+  {
+    cudaErrchk(cudaMemcpyAsync(stage.hptr, stage.dptr, len * sizeof(T),
+                               cudaMemcpyDeviceToHost, stream()));
+  }
+
+  //! Wait for the stage's enqueued work and copy len elements from its
+  //  pinned buffer to dst.
+  void receive(Stage const& stage, T* dst, size_t len)
+  {
+    StageState& s = m_stages[stage.index];
+    cudaErrchk(cudaEventRecord(s.reusable, stream()));
+    cudaErrchk(cudaEventSynchronize(s.reusable));
+    s.in_flight = false;
+    std::memcpy(dst, stage.hptr, len * sizeof(T));
+  }
+
+  //! Mark the stage reusable once all work enqueued on the stream so
+  //  far, including the kernels consuming its device buffer, completes.
+  void release(Stage const& stage)
+  {
+    StageState& s = m_stages[stage.index];
+    cudaErrchk(cudaEventRecord(s.reusable, stream()));
+    s.in_flight = true;
+  }
+
+  //! Block until every in-flight stage is reusable
+  void drain()
+  {
+    for (StageState& s : m_stages) {
+      if (s.in_flight) {
+        cudaErrchk(cudaEventSynchronize(s.reusable));
+        s.in_flight = false;
+      }
+    }
+  }
+
+  //! Number of stages in the ring
+  size_t size() const { return m_stages.size(); }
+
+  //! Capacity of each stage in elements
+  size_t chunk_len() const { return m_chunk_len; }
+
+  //! Resource whose stream orders the pipeline's transfers and kernels
+  resources::Cuda& resource() { return m_res; }
+
+private:
+  struct StageState {
+    T* hptr;
+    T* dptr;
+    cudaEvent_t reusable;
+    bool in_flight;
+  };
+
+  cudaStream_t stream() { return m_res.get_stream(); }
+
+  resources::Cuda m_res;
+  std::vector<StageState> m_stages;
+  size_t m_chunk_len;
+  size_t m_next;
+};
+
+}  // namespace cuda
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_CUDA
+
+#endif  // closing endif for header file include guard
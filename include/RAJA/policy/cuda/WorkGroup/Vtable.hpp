@@ -21,12 +21,10 @@
 #include "RAJA/config.hpp"
 
 #include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 
 #include "RAJA/pattern/WorkGroup/Vtable.hpp"
 
-#include <thread>
-#include <mutex>
-
 
 namespace RAJA
 {
@@ -43,49 +41,30 @@ __global__ void get_Vtable_cuda_device_call_global(
   *ptrptr = &Vtable_T::template device_call<T>;
 }
 
-// allocate the pinned ptrptr buffer
-inline void* get_Vtable_cuda_device_call_ptrptr()
-{
-  void* ptrptr = nullptr;
-  cudaErrchk(cudaMallocHost(&ptrptr, sizeof(typename Vtable<>::call_sig)));
-  return ptrptr;
-}
-
-// get the pinned ptrptr buffer
-inline void* get_cached_Vtable_cuda_device_call_ptrptr()
-{
-  static void* ptrptr = get_Vtable_cuda_device_call_ptrptr();
-  return ptrptr;
-}
-
-// mutex that guards against concurrent use of
-// get_cached_Vtable_cuda_device_call_ptrptr()
-inline std::mutex& get_Vtable_cuda_mutex()
-{
-  static std::mutex s_mutex;
-  return s_mutex;
-}
-
 // get the device function pointer by calling a global function to
-// write it into a pinned ptrptr, beware different instantiates of this
-// function may run concurrently
+// write it into a pinned buffer, different instantiations of this
+// function may run concurrently as each uses its own buffer
 template < typename T, typename Vtable_T >
 inline typename Vtable_T::call_sig get_Vtable_cuda_device_call()
 {
-  const std::lock_guard<std::mutex> lock(get_Vtable_cuda_mutex());
-
   typename Vtable_T::call_sig* ptrptr =
-      static_cast<typename Vtable_T::call_sig*>(
-        get_cached_Vtable_cuda_device_call_ptrptr());
+      cuda::pinned_mempool_type::getInstance().template malloc<
+          typename Vtable_T::call_sig>(1);
+
   get_Vtable_cuda_device_call_global<T, Vtable_T><<<1,1>>>(ptrptr);
   cudaErrchk(cudaGetLastError());
   cudaErrchk(cudaDeviceSynchronize());
 
-  return *ptrptr;
+  typename Vtable_T::call_sig ptr = *ptrptr;
+
+  cuda::pinned_mempool_type::getInstance().free(ptrptr);
+
+  return ptr;
 }
 
-// get the device function pointer and store it so it can be used
-// multiple times
+// process-lifetime cache of device function pointers keyed by loop type,
+// populated on first use and concurrently readable afterwards so
+// steady-state WorkGroup builds never touch the driver for symbol lookups
 template < typename T, typename Vtable_T >
 inline typename Vtable_T::call_sig get_cached_Vtable_cuda_device_call()
 {
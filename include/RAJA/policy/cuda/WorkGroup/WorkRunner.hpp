@@ -342,11 +342,169 @@ struct WorkRunner<
     m_total_iterations = 0;
   }
 
-private:
+protected:
   index_type m_total_iterations = 0;
 };
 
 
+/*!
+ * Runs work in a storage container with the same block/thread mapping as
+ * unordered_cuda_loop_y_block_iter_x_threadblock_average, but captures the
+ * launch into a persistent CUDA graph on the first run and replays it with
+ * cudaGraphLaunch on later runs. Kernel node parameters are refreshed each
+ * run, so runs with different arguments or regrown storage stay correct
+ * while repeated runs of a long-lived WorkGroup skip most launch overhead.
+ */
+template <size_t BLOCK_SIZE, bool Async,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::cuda_work<BLOCK_SIZE, Async>,
+        RAJA::policy::cuda::unordered_cuda_loop_y_block_iter_x_threadblock_average_graph,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunner<
+        RAJA::cuda_work<BLOCK_SIZE, Async>,
+        RAJA::policy::cuda::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunner<
+      RAJA::cuda_work<BLOCK_SIZE, Async>,
+      RAJA::policy::cuda::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+      ALLOCATOR_T,
+      INDEX_T,
+      Args...>;
+
+  using exec_policy = RAJA::cuda_work<BLOCK_SIZE, Async>;
+  using order_policy = RAJA::policy::cuda::
+      unordered_cuda_loop_y_block_iter_x_threadblock_average_graph;
+  using index_type = INDEX_T;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner && o)
+    : base(std::move(o)),
+      m_graph_exec(o.m_graph_exec),
+      m_graph_node(o.m_graph_node)
+  {
+    o.m_graph_exec = nullptr;
+    o.m_graph_node = nullptr;
+  }
+  WorkRunner& operator=(WorkRunner && o)
+  {
+    base::operator=(std::move(o));
+    m_graph_exec = o.m_graph_exec;
+    m_graph_node = o.m_graph_node;
+
+    o.m_graph_exec = nullptr;
+    o.m_graph_node = nullptr;
+    return *this;
+  }
+
+  ~WorkRunner() { destroy_graph(); }
+
+  using per_run_storage = typename base::per_run_storage;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, Args... args) const
+  {
+    using Iterator  = camp::decay<decltype(std::begin(storage))>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(storage), std::end(storage)))>;
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    auto func = cuda_unordered_y_block_global<BLOCK_SIZE, Iterator, value_type, index_type, Args...>;
+
+    Iterator begin = std::begin(storage);
+    Iterator end = std::end(storage);
+    IndexType num_loops = std::distance(begin, end);
+
+    // Only launch kernel if we have something to iterate over
+    if (num_loops > 0 && BLOCK_SIZE > 0) {
+
+      index_type average_iterations = this->m_total_iterations / static_cast<index_type>(num_loops);
+
+      constexpr index_type block_size = static_cast<index_type>(BLOCK_SIZE);
+      cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(block_size), 1, 1};
+      cuda_dim_t gridSize{static_cast<cuda_dim_member_t>((average_iterations + block_size - 1) / block_size),
+                          static_cast<cuda_dim_member_t>(num_loops),
+                          1};
+
+      RAJA_FT_BEGIN;
+
+      size_t shmem = 0;
+      cudaStream_t stream = 0;
+
+      {
+        void* func_args[] = { (void*)&begin, (void*)&args... };
+
+        cudaKernelNodeParams params{};
+        params.func = (void*)func;
+        params.gridDim = gridSize;
+        params.blockDim = blockSize;
+        params.sharedMemBytes = static_cast<unsigned int>(shmem);
+        params.kernelParams = func_args;
+        params.extra = nullptr;
+
+        if (m_graph_exec == nullptr) {
+          //
+          // Capture the launch into a graph and instantiate it once
+          //
+          cudaGraph_t graph;
+          cudaErrchk(cudaGraphCreate(&graph, 0));
+          cudaErrchk(cudaGraphAddKernelNode(&m_graph_node, graph, nullptr, 0, &params));
+          cudaErrchk(cudaGraphInstantiate(&m_graph_exec, graph, nullptr, nullptr, 0));
+          cudaErrchk(cudaGraphDestroy(graph));
+        } else {
+          //
+          // Refresh parameters in the instantiated graph; launch dims and
+          // arguments may differ between runs
+          //
+          cudaErrchk(cudaGraphExecKernelNodeSetParams(m_graph_exec, m_graph_node, &params));
+        }
+
+        cudaErrchk(cudaGraphLaunch(m_graph_exec, stream));
+        RAJA::cuda::launch(stream);
+      }
+
+      if (!Async) { RAJA::cuda::synchronize(stream); }
+
+      RAJA_FT_END;
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    destroy_graph();
+    base::clear();
+  }
+
+private:
+  mutable cudaGraphExec_t m_graph_exec = nullptr;
+  mutable cudaGraphNode_t m_graph_node = nullptr;
+
+  void destroy_graph()
+  {
+    if (m_graph_exec != nullptr) {
+      cudaErrchk(cudaGraphExecDestroy(m_graph_exec));
+      m_graph_exec = nullptr;
+      m_graph_node = nullptr;
+    }
+  }
+};
+
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -29,6 +29,8 @@
 #include "RAJA/util/TypeConvert.hpp"
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/policy/atomic_builtin.hpp"
+
 
 namespace RAJA
 {
@@ -95,6 +97,43 @@ struct CudaAtomicCAS {
 };
 
 
+template <>
+struct CudaAtomicCAS<2> {
+
+  /*!
+   * Generic impementation of any atomic 16-bit operator.
+   * CUDA has no 16-bit CAS, so the operation CASes the aligned 32-bit
+   * word containing the operand, updating only the 16 bits it occupies.
+   * Returns the OLD value that was replaced by the result of this
+   * operation.
+   */
+  template <typename T, typename OPER>
+  RAJA_INLINE __device__ T operator()(T volatile *acc, OPER const &oper) const
+  {
+    unsigned volatile *wordacc = reinterpret_cast<unsigned volatile *>(
+        reinterpret_cast<uintptr_t>(acc) & ~static_cast<uintptr_t>(0x3));
+    unsigned shift = static_cast<unsigned>(
+        (reinterpret_cast<uintptr_t>(acc) & 0x2) * 8);
+    unsigned mask = 0xffffu << shift;
+
+    unsigned oldword, newword, readback;
+    oldword = *wordacc;
+    do {
+      T oldval = RAJA::util::reinterp_A_as_B<unsigned short, T>(
+          static_cast<unsigned short>((oldword >> shift) & 0xffffu));
+      unsigned newbits = RAJA::util::reinterp_A_as_B<T, unsigned short>(
+          oper(oldval));
+      newword = (oldword & ~mask) | (newbits << shift);
+      readback = cuda_atomic_CAS(wordacc, oldword, newword);
+      if (readback == oldword) {
+        return oldval;
+      }
+      oldword = readback;
+    } while (true);
+  }
+};
+
+
 template <>
 struct CudaAtomicCAS<4> {
 
@@ -232,6 +271,31 @@ RAJA_INLINE __device__ double cuda_atomicAdd<double>(double volatile *acc,
 }
 #endif
 
+
+// 16-bit __half atomicAdd support added for sm_70; older architectures
+// fall back to the generic 16-bit CAS path above, whose __half
+// arithmetic requires sm_53
+#if defined(RAJA_CUDA_HAS_HALF) && __CUDA_ARCH__ >= 700
+template <>
+RAJA_INLINE __device__ __half cuda_atomicAdd<__half>(__half volatile *acc,
+                                                __half value)
+{
+  return ::atomicAdd((__half *)acc, value);
+}
+#endif
+
+
+// 16-bit __nv_bfloat16 atomicAdd support added for sm_80
+#if defined(RAJA_CUDA_HAS_BFLOAT16) && __CUDA_ARCH__ >= 800
+template <>
+RAJA_INLINE __device__ __nv_bfloat16 cuda_atomicAdd<__nv_bfloat16>(
+    __nv_bfloat16 volatile *acc,
+    __nv_bfloat16 value)
+{
+  return ::atomicAdd((__nv_bfloat16 *)acc, value);
+}
+#endif
+
 #if __CUDA_ARCH__ >= 200
 template <typename T>
 RAJA_INLINE __device__ T cuda_atomicSub(T volatile *acc, T value)
@@ -764,6 +828,125 @@ atomicCAS(cuda_atomic, T volatile *acc, T compare, T value)
 #endif
 }
 
+
+#ifdef __CUDA_ARCH__
+
+namespace detail
+{
+
+//
+// CUDA atomics are relaxed; stronger orders are built by fencing before
+// (release side) and after (acquire side) the operation. The relaxed
+// order issues no fence, which is what spin-wait signaling wants.
+//
+
+RAJA_INLINE __device__ void cuda_release_fence(atomic_order::relaxed) {}
+RAJA_INLINE __device__ void cuda_release_fence(atomic_order::acquire) {}
+RAJA_INLINE __device__ void cuda_release_fence(atomic_order::release)
+{
+  __threadfence();
+}
+RAJA_INLINE __device__ void cuda_release_fence(atomic_order::acq_rel)
+{
+  __threadfence();
+}
+RAJA_INLINE __device__ void cuda_release_fence(atomic_order::seq_cst)
+{
+  __threadfence();
+}
+
+RAJA_INLINE __device__ void cuda_acquire_fence(atomic_order::relaxed) {}
+RAJA_INLINE __device__ void cuda_acquire_fence(atomic_order::release) {}
+RAJA_INLINE __device__ void cuda_acquire_fence(atomic_order::acquire)
+{
+  __threadfence();
+}
+RAJA_INLINE __device__ void cuda_acquire_fence(atomic_order::acq_rel)
+{
+  __threadfence();
+}
+RAJA_INLINE __device__ void cuda_acquire_fence(atomic_order::seq_cst)
+{
+  __threadfence();
+}
+
+}  // namespace detail
+
+#endif  // __CUDA_ARCH__
+
+
+//
+// Ordered operations, selected by an atomic_order tag. These are atomic
+// in cuda device code and non-atomic otherwise, like the operations
+// above.
+//
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicLoad(cuda_atomic, Order, T volatile *acc)
+{
+#ifdef __CUDA_ARCH__
+  T old = *acc;
+  detail::cuda_acquire_fence(Order{});
+  return old;
+#else
+  return *acc;
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE void atomicStore(cuda_atomic,
+                                              Order,
+                                              T volatile *acc,
+                                              T value)
+{
+#ifdef __CUDA_ARCH__
+  detail::cuda_release_fence(Order{});
+  *acc = value;
+#else
+  *acc = value;
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicExchange(cuda_atomic,
+                                              Order,
+                                              T volatile *acc,
+                                              T value)
+{
+#ifdef __CUDA_ARCH__
+  detail::cuda_release_fence(Order{});
+  T old = detail::cuda_atomicExchange(acc, value);
+  detail::cuda_acquire_fence(Order{});
+  return old;
+#else
+  T old = *acc;
+  *acc = value;
+  return old;
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicAdd(cuda_atomic,
+                                         Order,
+                                         T volatile *acc,
+                                         T value)
+{
+#ifdef __CUDA_ARCH__
+  detail::cuda_release_fence(Order{});
+  T old = detail::cuda_atomicAdd(acc, value);
+  detail::cuda_acquire_fence(Order{});
+  return old;
+#else
+  T old = *acc;
+  *acc = old + value;
+  return old;
+#endif
+}
+
 }  // namespace RAJA
 
 
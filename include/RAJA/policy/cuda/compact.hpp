@@ -0,0 +1,177 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing CUDA RAJA stream compaction.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_cuda_HPP
+#define RAJA_compact_cuda_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <iterator>
+
+#include "cub/device/device_partition.cuh"
+#include "cub/device/device_select.cuh"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+/*!
+        \brief single-pass device-wide copy_if via cub::DeviceSelect
+
+        The select runs in one pass over the input using cub's
+        decoupled-lookback machinery; no flags array or separate scan
+        is involved. The count is returned on the host, so the call
+        synchronizes even for Async policies.
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Predicate>
+Index_type copy_if(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+                   InputIter begin,
+                   InputIter end,
+                   OutputIter out,
+                   Predicate pred)
+{
+  cudaStream_t stream = 0;
+
+  int len = std::distance(begin, end);
+  int* d_num_selected =
+      cuda::device_mempool_type::getInstance().malloc<int>(1);
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  cudaErrchk(::cub::DeviceSelect::If(d_temp_storage,
+                                     temp_storage_bytes,
+                                     begin,
+                                     out,
+                                     d_num_selected,
+                                     len,
+                                     pred,
+                                     stream));
+  // Allocate temporary storage
+  d_temp_storage =
+      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
+          temp_storage_bytes);
+  // Run
+  cudaErrchk(::cub::DeviceSelect::If(d_temp_storage,
+                                     temp_storage_bytes,
+                                     begin,
+                                     out,
+                                     d_num_selected,
+                                     len,
+                                     pred,
+                                     stream));
+  // Free temporary storage
+  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+
+  cuda::launch(stream);
+
+  int num_selected = 0;
+  cudaErrchk(cudaMemcpy(&num_selected,
+                        d_num_selected,
+                        sizeof(int),
+                        cudaMemcpyDeviceToHost));
+  cuda::device_mempool_type::getInstance().free(d_num_selected);
+
+  return static_cast<Index_type>(num_selected);
+}
+
+/*!
+        \brief single-pass device-wide partition via cub::DevicePartition
+
+        Selected elements are written to the front of the output in
+        order; rejected elements are written in reverse order at the
+        end, which is cub's partition output layout.
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Predicate>
+Index_type partition(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+                     InputIter begin,
+                     InputIter end,
+                     OutputIter out,
+                     Predicate pred)
+{
+  cudaStream_t stream = 0;
+
+  int len = std::distance(begin, end);
+  int* d_num_selected =
+      cuda::device_mempool_type::getInstance().malloc<int>(1);
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  cudaErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                        temp_storage_bytes,
+                                        begin,
+                                        out,
+                                        d_num_selected,
+                                        len,
+                                        pred,
+                                        stream));
+  // Allocate temporary storage
+  d_temp_storage =
+      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
+          temp_storage_bytes);
+  // Run
+  cudaErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                        temp_storage_bytes,
+                                        begin,
+                                        out,
+                                        d_num_selected,
+                                        len,
+                                        pred,
+                                        stream));
+  // Free temporary storage
+  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+
+  cuda::launch(stream);
+
+  int num_selected = 0;
+  cudaErrchk(cudaMemcpy(&num_selected,
+                        d_num_selected,
+                        sizeof(int),
+                        cudaMemcpyDeviceToHost));
+  cuda::device_mempool_type::getInstance().free(d_num_selected);
+
+  return static_cast<Index_type>(num_selected);
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_CUDA guard
+
+#endif  // closing endif for header file include guard
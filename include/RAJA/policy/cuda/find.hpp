@@ -0,0 +1,163 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA find declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_find_cuda_HPP
+#define RAJA_find_cuda_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <algorithm>
+#include <iterator>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace find
+{
+
+namespace detail
+{
+namespace cuda
+{
+
+// cap on the grid so trailing blocks stay queued behind the abort check
+constexpr size_t get_find_max_blocks() { return 4096; }
+
+/*!
+        \brief grid-stride search kernel with per-warp ballots and a
+               global abort flag
+
+        Blocks walk tiles in increasing index order; before each tile the
+        published result is polled so tiles past a match return without
+        touching their data. Within a warp a ballot picks the first lane
+        with a hit, which holds the warp's smallest index, so at most one
+        atomicMin is issued per warp per tile.
+*/
+template <size_t BlockSize, typename Iter, typename Predicate>
+__launch_bounds__(BlockSize, 1) __global__
+void find_if_kernel(Iter begin,
+                    unsigned long long len,
+                    unsigned long long* found,
+                    Predicate pred)
+{
+  const unsigned long long stride =
+      static_cast<unsigned long long>(gridDim.x) * BlockSize;
+
+  for (unsigned long long base =
+           static_cast<unsigned long long>(blockIdx.x) * BlockSize;
+       base < len; base += stride) {
+
+    // abort: everything at or past a published match is dead work
+    if (base >= *reinterpret_cast<unsigned long long volatile*>(found)) {
+      return;
+    }
+
+    const unsigned long long i = base + threadIdx.x;
+    const bool hit = (i < len) && pred(begin[i]);
+
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 9000
+    const unsigned mask = __ballot_sync(0xffffffffu, hit);
+#else
+    const unsigned mask = __ballot(hit);
+#endif
+    if (mask != 0u &&
+        (threadIdx.x & (RAJA::policy::cuda::WARP_SIZE - 1)) ==
+            static_cast<unsigned>(__ffs(static_cast<int>(mask)) - 1)) {
+      ::atomicMin(found, i);
+    }
+  }
+}
+
+}  // namespace cuda
+}  // namespace detail
+
+/*!
+        \brief returns the offset of the first element satisfying the
+               predicate, or the range length
+
+        The result is returned by value, so this call synchronizes on the
+        resource's stream regardless of Async.
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Predicate>
+RAJA::detail::IterDiff<Iter>
+find_if(resources::Cuda& cuda_res,
+        const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+        Iter begin,
+        Iter end,
+        Predicate pred)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  cudaStream_t stream = cuda_res.get_stream();
+
+  const unsigned long long len =
+      static_cast<unsigned long long>(end - begin);
+
+  unsigned long long* dev_found =
+      RAJA::cuda::device_mempool_type::getInstance()
+          .malloc<unsigned long long>(1);
+
+  // "not found" sentinel; hits lower it with atomicMin
+  unsigned long long host_found = len;
+  cudaErrchk(cudaMemcpyAsync(dev_found,
+                             &host_found,
+                             sizeof(unsigned long long),
+                             cudaMemcpyDefault,
+                             stream));
+
+  const size_t num_blocks =
+      std::min(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(len, BLOCK_SIZE)),
+               detail::cuda::get_find_max_blocks());
+
+  detail::cuda::find_if_kernel<BLOCK_SIZE>
+      <<<num_blocks, BLOCK_SIZE, 0, stream>>>(begin, len, dev_found, pred);
+  cudaErrchk(cudaGetLastError());
+
+  cudaErrchk(cudaMemcpyAsync(&host_found,
+                             dev_found,
+                             sizeof(unsigned long long),
+                             cudaMemcpyDefault,
+                             stream));
+
+  RAJA::cuda::launch(stream);
+  RAJA::cuda::synchronize(stream);
+
+  RAJA::cuda::device_mempool_type::getInstance().free(dev_found);
+
+  return static_cast<diff_type>(host_found);
+}
+
+}  // namespace find
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_CUDA)
+
+#endif  // closing endif for header file include guard
@@ -27,9 +27,14 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include <algorithm>
+#include <atomic>
+#include <type_traits>
+#include <vector>
 
 #include "RAJA/pattern/forall.hpp"
 
+#include "RAJA/pattern/WorkGroup/Vtable.hpp"
+
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -38,8 +43,10 @@
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
 #include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#include "RAJA/policy/cuda/WorkGroup/Vtable.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/util/resource.hpp"
 
@@ -119,6 +126,12 @@ __device__ __forceinline__ unsigned int getGlobalNumThreads_3D_3D()
 //
 // CUDA kernel templates.
 //
+// Note: for strided range segments, idx[ii] is a single integer
+// multiply-add per thread, and with stride 1 or -1 a warp touches a
+// contiguous (ascending or descending) address range that coalesces
+// into the same memory transactions either way, so reversed sweeps
+// need no dedicated kernel.
+//
 //////////////////////////////////////////////////////////////////////
 //
 
@@ -127,13 +140,18 @@ __device__ __forceinline__ unsigned int getGlobalNumThreads_3D_3D()
  *
  * \brief  CUDA kernal forall template for indirection array.
  *
+ *         BlocksPerSM becomes the second __launch_bounds__ argument, so
+ *         policies may demand a minimum number of resident blocks per
+ *         multiprocessor and thereby cap the per-thread register count.
+ *
  ******************************************************************************
  */
 template <size_t BlockSize,
+          size_t BlocksPerSM,
           typename Iterator,
           typename LOOP_BODY,
           typename IndexType>
-__launch_bounds__(BlockSize, 1) __global__
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
     void forall_cuda_kernel(LOOP_BODY loop_body,
                             const Iterator idx,
                             IndexType length)
@@ -147,6 +165,383 @@ __launch_bounds__(BlockSize, 1) __global__
   }
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernal forall template for indirection array, without
+ *         launch bounds so the occupancy calculator is free to pick the
+ *         block size per device and per register footprint.
+ *
+ ******************************************************************************
+ */
+template <typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__global__ void forall_cuda_kernel_occ_calc(LOOP_BODY loop_body,
+                                            const Iterator idx,
+                                            IndexType length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto ii = static_cast<IndexType>(getGlobalIdx_1D_1D());
+  if (ii < length) {
+    body(idx[ii]);
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernal forall template for indirection array, grid-stride
+ *         form: each thread loops over the iteration space with a stride
+ *         of the whole grid, so the grid may be smaller than one thread
+ *         per iterate.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_cuda_grid_stride_kernel(LOOP_BODY loop_body,
+                                        const Iterator idx,
+                                        IndexType length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto stride = static_cast<IndexType>(getGlobalNumThreads_1D_1D());
+  for (auto ii = static_cast<IndexType>(getGlobalIdx_1D_1D()); ii < length;
+       ii += stride) {
+    body(idx[ii]);
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernal forall template staging indices through shared
+ *         memory. Each block owns a tile of BlockSize * ItemsPerThread
+ *         iterates; the tile of indices is loaded cooperatively with
+ *         coalesced accesses, then each thread gathers its ItemsPerThread
+ *         items from the staged indices.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          size_t ItemsPerThread,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_cuda_staged_kernel(LOOP_BODY loop_body,
+                                   const Iterator idx,
+                                   IndexType length)
+{
+  using IndexValue = camp::decay<decltype(idx[0])>;
+
+  __shared__ IndexValue tile[BlockSize * ItemsPerThread];
+
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+
+  constexpr IndexType tile_size =
+      static_cast<IndexType>(BlockSize * ItemsPerThread);
+  const IndexType tile_begin = static_cast<IndexType>(blockIdx.x) * tile_size;
+
+  for (IndexType j = static_cast<IndexType>(threadIdx.x); j < tile_size;
+       j += static_cast<IndexType>(BlockSize)) {
+    const IndexType ii = tile_begin + j;
+    if (ii < length) {
+      tile[j] = idx[ii];
+    }
+  }
+  __syncthreads();
+
+  for (size_t item = 0; item < ItemsPerThread; ++item) {
+    const IndexType j =
+        static_cast<IndexType>(threadIdx.x + item * BlockSize);
+    if (tile_begin + j < length) {
+      body(tile[j]);
+    }
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  One entry per thread block of a fused index set launch; block
+ *         blockIdx.x executes indices [begin, begin + length) of its
+ *         segment.
+ *
+ ******************************************************************************
+ */
+template <typename IndexType>
+struct FusedSegmentBlock {
+  IndexType begin;
+  cuda_dim_member_t length;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernal forall template for fused index set execution;
+ *         each block looks up its segment chunk in the mapping table.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize, typename LOOP_BODY, typename IndexType>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_cuda_fused_kernel(LOOP_BODY loop_body,
+                                  const FusedSegmentBlock<IndexType>* blocks)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  FusedSegmentBlock<IndexType> fb = blocks[blockIdx.x];
+  if (threadIdx.x < fb.length) {
+    body(fb.begin + static_cast<IndexType>(threadIdx.x));
+  }
+}
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Persistent-grid dispatch for cuda_exec_persistent.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Mailbox in pinned mapped memory connecting the host to a
+ *         persistent grid of NumBlocks blocks.
+ *
+ *         The host constructs a type-erased loop holder into obj, points
+ *         call at its device call shim, then publishes by bumping seq.
+ *         Each block polls seq, runs the loop, and reports the sequence
+ *         number it finished in its own done slot, so completion needs no
+ *         device-side atomics on host memory.
+ *
+ ******************************************************************************
+ */
+template <size_t NumBlocks>
+struct PersistentMailbox {
+  using vtable_type = ::RAJA::detail::Vtable<>;
+
+  static constexpr size_t obj_capacity = 1024;
+
+  unsigned long long seq;
+  int shutdown;
+  typename vtable_type::call_sig call;
+  typename std::aligned_storage<obj_capacity, alignof(std::max_align_t)>::type
+      obj;
+  unsigned long long done[NumBlocks];
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Loop holder stored in the persistent mailbox; grid-strides its
+ *         segment because the resident grid shape is fixed.
+ *
+ ******************************************************************************
+ */
+template <typename Iterator, typename LOOP_BODY, typename IndexType>
+struct HoldCudaPersistentLoop {
+  Iterator begin;
+  IndexType len;
+  LOOP_BODY body;
+
+  RAJA_DEVICE RAJA_INLINE void operator()() const
+  {
+    auto ii = static_cast<IndexType>(getGlobalIdx_1D_1D());
+    auto stride = static_cast<IndexType>(getGlobalNumThreads_1D_1D());
+    for (; ii < len; ii += stride) {
+      body(begin[ii]);
+    }
+  }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  The resident kernel; each block polls the mailbox for the next
+ *         sequence number, executes the published loop, and reports
+ *         completion in its done slot. A publish with shutdown set ends
+ *         the grid.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize, size_t NumBlocks>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_cuda_persistent_kernel(PersistentMailbox<NumBlocks>* box)
+{
+  __shared__ int sh_shutdown;
+  unsigned long long next = 1;
+  while (true) {
+    if (threadIdx.x == 0) {
+      while (*reinterpret_cast<volatile unsigned long long*>(&box->seq) <
+             next) {
+        // spin on the host-written sequence number
+      }
+      __threadfence_system();
+      sh_shutdown = *reinterpret_cast<volatile int*>(&box->shutdown);
+    }
+    __syncthreads();
+    if (sh_shutdown != 0) {
+      break;
+    }
+
+    box->call(&box->obj);
+
+    __syncthreads();
+    if (threadIdx.x == 0) {
+      __threadfence_system();
+      *reinterpret_cast<volatile unsigned long long*>(&box->done[blockIdx.x]) =
+          next;
+    }
+    ++next;
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Owns the resident grid and mailbox for one cuda_exec_persistent
+ *         instantiation; a process-lifetime singleton started on first
+ *         dispatch.
+ *
+ *         The grid and the vtable fetch kernels run on their own
+ *         non-blocking streams so neither serializes against the legacy
+ *         default stream, and stream-level synchronization never waits on
+ *         the never-terminating grid.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize, size_t NumBlocks>
+struct PersistentForallRunner {
+  using mailbox_type = PersistentMailbox<NumBlocks>;
+  using vtable_type = typename mailbox_type::vtable_type;
+
+  static PersistentForallRunner& getInstance()
+  {
+    static PersistentForallRunner runner;
+    return runner;
+  }
+
+  // mailbox of the resident grid, starting the grid on first use
+  mailbox_type* mailbox()
+  {
+    if (m_box == nullptr) {
+      start();
+    }
+    return m_box;
+  }
+
+  ///
+  /// Device call pointer for holder, fetched once per holder type on the
+  /// control stream; the WorkGroup fetch helper synchronizes the whole
+  /// device, which would deadlock against the resident grid.
+  ///
+  template <typename holder>
+  typename vtable_type::call_sig device_call()
+  {
+    static typename vtable_type::call_sig ptr = fetch_device_call<holder>();
+    return ptr;
+  }
+
+  ///
+  /// Publish the loop in the mailbox to the resident grid and wait for
+  /// every block to report completion.
+  ///
+  void publish_and_wait()
+  {
+    publish();
+    for (size_t b = 0; b < NumBlocks; ++b) {
+      while (*reinterpret_cast<volatile unsigned long long*>(&m_box->done[b]) <
+             m_seq) {
+        // spin; persistent dispatch targets loops far shorter than a
+        // host yield quantum
+      }
+    }
+  }
+
+  ~PersistentForallRunner()
+  {
+    if (m_box != nullptr) {
+      m_box->shutdown = 1;
+      publish();
+      // no cudaErrchk at static teardown, the context may already be
+      // tearing down; the mailbox is deliberately leaked because the
+      // pinned mempool singleton may be destroyed before this runner
+      cudaStreamSynchronize(m_grid_stream);
+      cudaStreamDestroy(m_grid_stream);
+      cudaStreamDestroy(m_ctrl_stream);
+    }
+  }
+
+private:
+  mailbox_type* m_box = nullptr;
+  unsigned long long m_seq = 0;
+  cudaStream_t m_grid_stream;
+  cudaStream_t m_ctrl_stream;
+
+  void start()
+  {
+    m_box = RAJA::cuda::pinned_mempool_type::getInstance()
+                .template malloc<mailbox_type>(1);
+    m_box->seq = 0;
+    m_box->shutdown = 0;
+    for (size_t b = 0; b < NumBlocks; ++b) {
+      m_box->done[b] = 0;
+    }
+
+    cudaErrchk(cudaStreamCreateWithFlags(&m_grid_stream, cudaStreamNonBlocking));
+    cudaErrchk(cudaStreamCreateWithFlags(&m_ctrl_stream, cudaStreamNonBlocking));
+
+    auto func = forall_cuda_persistent_kernel<BlockSize, NumBlocks>;
+    RAJA_CUDA_REGISTER_KERNEL(
+        forall_cuda_persistent_kernel<BlockSize, NumBlocks>);
+    cuda_dim_t gridSize{static_cast<cuda_dim_member_t>(NumBlocks), 1, 1};
+    cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(BlockSize), 1, 1};
+    void* args[] = {(void*)&m_box};
+    RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, 0,
+                       m_grid_stream);
+  }
+
+  void publish()
+  {
+    ++m_seq;
+    // make the payload visible before the sequence number
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    *reinterpret_cast<volatile unsigned long long*>(&m_box->seq) = m_seq;
+  }
+
+  template <typename holder>
+  typename vtable_type::call_sig fetch_device_call()
+  {
+    typename vtable_type::call_sig* ptrptr =
+        RAJA::cuda::pinned_mempool_type::getInstance()
+            .template malloc<typename vtable_type::call_sig>(1);
+
+    ::RAJA::detail::get_Vtable_cuda_device_call_global<holder, vtable_type>
+        <<<1, 1, 0, m_ctrl_stream>>>(ptrptr);
+    cudaErrchk(cudaGetLastError());
+    cudaErrchk(cudaStreamSynchronize(m_ctrl_stream));
+
+    typename vtable_type::call_sig ptr = *ptrptr;
+
+    RAJA::cuda::pinned_mempool_type::getInstance().free(ptrptr);
+
+    return ptr;
+  }
+};
+
 }  // namespace impl
 
 //
@@ -167,7 +562,9 @@ RAJA_INLINE resources::EventProxy<resources::Cuda> forall_impl(resources::Cuda &
   using LOOP_BODY = camp::decay<LoopBody>;
   using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
 
-  auto func = impl::forall_cuda_kernel<BlockSize, Iterator, LOOP_BODY, IndexType>;
+  auto func = impl::forall_cuda_kernel<BlockSize, 1, Iterator, LOOP_BODY, IndexType>;
+  RAJA_CUDA_REGISTER_KERNEL(
+      impl::forall_cuda_kernel<BlockSize, 1, Iterator, LOOP_BODY, IndexType>);
 
   cudaStream_t stream = cuda_res.get_stream();
 
@@ -222,6 +619,357 @@ RAJA_INLINE resources::EventProxy<resources::Cuda> forall_impl(resources::Cuda &
 }
 
 
+template <typename Iterable, typename LoopBody, size_t BlockSize, size_t BlocksPerSM, bool Async>
+RAJA_INLINE resources::EventProxy<resources::Cuda> forall_impl(resources::Cuda &cuda_res,
+                                                    policy::cuda::cuda_exec_explicit<BlockSize, BlocksPerSM, Async>,
+                                                    Iterable&& iter,
+                                                    LoopBody&& loop_body)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+  auto func = impl::forall_cuda_kernel<BlockSize, BlocksPerSM, Iterator, LOOP_BODY, IndexType>;
+  RAJA_CUDA_REGISTER_KERNEL(
+      impl::forall_cuda_kernel<BlockSize, BlocksPerSM, Iterator, LOOP_BODY,
+                               IndexType>);
+
+  cudaStream_t stream = cuda_res.get_stream();
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    //
+    // Compute the number of blocks
+    //
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize = impl::getGridDim(static_cast<cuda_dim_member_t>(len), blockSize);
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, stream, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      void *args[] = {(void*)&body, (void*)&begin, (void*)&len};
+      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, stream);
+    }
+
+    if (!Async) { RAJA::cuda::synchronize(stream); }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(&cuda_res);
+}
+
+
+template <typename Iterable, typename LoopBody, size_t BlockSize, size_t MaxBlocks, bool Async>
+RAJA_INLINE resources::EventProxy<resources::Cuda> forall_impl(resources::Cuda &cuda_res,
+                                                    policy::cuda::cuda_exec_grid_stride<BlockSize, MaxBlocks, Async>,
+                                                    Iterable&& iter,
+                                                    LoopBody&& loop_body)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+  auto func = impl::forall_cuda_grid_stride_kernel<BlockSize, Iterator, LOOP_BODY, IndexType>;
+  RAJA_CUDA_REGISTER_KERNEL(
+      impl::forall_cuda_grid_stride_kernel<BlockSize, Iterator, LOOP_BODY,
+                                           IndexType>);
+
+  cudaStream_t stream = cuda_res.get_stream();
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    //
+    // Compute the number of blocks to cover the iteration space, then
+    // clamp to a whole multiple of the SM count so each stride of the
+    // grid keeps the multiprocessors evenly loaded; excess iterates are
+    // absorbed by the grid-stride loop
+    //
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize = impl::getGridDim(static_cast<cuda_dim_member_t>(len), blockSize);
+
+    cuda_dim_member_t sm_count = static_cast<cuda_dim_member_t>(
+        RAJA::cuda::device_prop().multiProcessorCount);
+    cuda_dim_member_t max_blocks;
+    if (MaxBlocks > 0) {
+      max_blocks = static_cast<cuda_dim_member_t>(MaxBlocks);
+    } else {
+      max_blocks = static_cast<cuda_dim_member_t>(
+                       RAJA::cuda::occupancy_max_active_blocks_per_sm(
+                           (const void*)func, BlockSize, shmem)) *
+                   sm_count;
+    }
+    if (max_blocks > sm_count) {
+      max_blocks -= max_blocks % sm_count;
+    }
+    if (gridSize.x > max_blocks) {
+      gridSize.x = max_blocks;
+    }
+
+    RAJA_FT_BEGIN;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, stream, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      void *args[] = {(void*)&body, (void*)&begin, (void*)&len};
+      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, stream);
+    }
+
+    if (!Async) { RAJA::cuda::synchronize(stream); }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(&cuda_res);
+}
+
+
+template <typename Iterable, typename LoopBody, bool Async>
+RAJA_INLINE resources::EventProxy<resources::Cuda> forall_impl(resources::Cuda &cuda_res,
+                                                    policy::cuda::cuda_exec_occ_calc<Async>,
+                                                    Iterable&& iter,
+                                                    LoopBody&& loop_body)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+  auto func = impl::forall_cuda_kernel_occ_calc<Iterator, LOOP_BODY, IndexType>;
+  RAJA_CUDA_REGISTER_KERNEL(
+      impl::forall_cuda_kernel_occ_calc<Iterator, LOOP_BODY, IndexType>);
+
+  cudaStream_t stream = cuda_res.get_stream();
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0) {
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    //
+    // Let the occupancy calculator pick the block size for this kernel
+    // instantiation (cached per kernel symbol), then size the grid to
+    // cover the iteration space
+    //
+    cuda_dim_member_t block_size = static_cast<cuda_dim_member_t>(
+        RAJA::cuda::occupancy_max_potential_block_size((const void*)func,
+                                                       shmem));
+    cuda_dim_t blockSize{block_size, 1, 1};
+    cuda_dim_t gridSize = impl::getGridDim(static_cast<cuda_dim_member_t>(len), blockSize);
+
+    RAJA_FT_BEGIN;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, stream, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      void *args[] = {(void*)&body, (void*)&begin, (void*)&len};
+      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, stream);
+    }
+
+    if (!Async) { RAJA::cuda::synchronize(stream); }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(&cuda_res);
+}
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Shared-memory staged forall; see cuda_exec_staged. The index
+ *         loads stay coalesced while each thread executes ItemsPerThread
+ *         iterates, so blocks amortize their index traffic across more
+ *         gather work than one-iterate-per-thread execution.
+ *
+ ******************************************************************************
+ */
+template <typename Iterable, typename LoopBody,
+          size_t BlockSize, size_t ItemsPerThread, bool Async>
+RAJA_INLINE resources::EventProxy<resources::Cuda> forall_impl(resources::Cuda &cuda_res,
+                                                    cuda_exec_staged<BlockSize, ItemsPerThread, Async>,
+                                                    Iterable&& iter,
+                                                    LoopBody&& loop_body)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+  auto func = impl::forall_cuda_staged_kernel<BlockSize, ItemsPerThread,
+                                              Iterator, LOOP_BODY, IndexType>;
+  RAJA_CUDA_REGISTER_KERNEL(
+      impl::forall_cuda_staged_kernel<BlockSize, ItemsPerThread, Iterator,
+                                      LOOP_BODY, IndexType>);
+
+  cudaStream_t stream = cuda_res.get_stream();
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    //
+    // Compute the number of blocks; each covers a tile of
+    // BlockSize * ItemsPerThread iterates
+    //
+    constexpr cuda_dim_member_t tile_size =
+        static_cast<cuda_dim_member_t>(BlockSize * ItemsPerThread);
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize{(static_cast<cuda_dim_member_t>(len) + tile_size - 1) /
+                            tile_size,
+                        1, 1};
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Setup shared memory buffers; the index tile is statically sized
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, stream, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      void *args[] = {(void*)&body, (void*)&begin, (void*)&len};
+      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, stream);
+    }
+
+    if (!Async) { RAJA::cuda::synchronize(stream); }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(&cuda_res);
+}
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent-grid forall; the loop is constructed into the
+ *         mailbox of a resident grid and published with a few pinned
+ *         memory writes instead of a kernel launch. The resident grid is
+ *         started on first dispatch for this (BlockSize, NumBlocks)
+ *         instantiation. See cuda_exec_persistent for restrictions.
+ *
+ ******************************************************************************
+ */
+template <typename Iterable, typename LoopBody, size_t BlockSize, size_t NumBlocks>
+RAJA_INLINE resources::EventProxy<resources::Cuda> forall_impl(resources::Cuda &cuda_res,
+                                                    cuda_exec_persistent<BlockSize, NumBlocks>,
+                                                    Iterable&& iter,
+                                                    LoopBody&& loop_body)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+  using holder = impl::HoldCudaPersistentLoop<Iterator, LOOP_BODY, IndexType>;
+  using runner_type = impl::PersistentForallRunner<BlockSize, NumBlocks>;
+  using mailbox_type = typename runner_type::mailbox_type;
+
+  static_assert(sizeof(holder) <= mailbox_type::obj_capacity,
+      "loop body too large for the persistent mailbox, use cuda_exec");
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only dispatch if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    RAJA_FT_BEGIN;
+
+    runner_type& runner = runner_type::getInstance();
+    mailbox_type* box = runner.mailbox();
+
+    box->call = runner.template device_call<holder>();
+    new (&box->obj) holder{begin, len, std::forward<LoopBody>(loop_body)};
+
+    runner.publish_and_wait();
+
+    reinterpret_cast<holder*>(&box->obj)->~holder();
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(&cuda_res);
+}
+
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -262,6 +1010,105 @@ RAJA_INLINE resources::EventProxy<resources::Cuda> forall_impl(resources::Cuda &
   return resources::EventProxy<resources::Cuda>(&r);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Fused execution of all range segments of an index set in a
+ *         single CUDA kernel launch.
+ *
+ *         Each segment is chunked into thread blocks of size BlockSize
+ *         and a block-to-segment mapping table is copied to the device;
+ *         block i reads entry i of the table to find the index range it
+ *         covers. One table copy and one launch replace the per-segment
+ *         launches of the seq_segit policy, which dominate run time for
+ *         index sets made of many short segments.
+ *
+ ******************************************************************************
+ */
+template <typename LoopBody, size_t BlockSize, bool Async, typename T>
+RAJA_INLINE resources::EventProxy<resources::Cuda> forall_impl(resources::Cuda &cuda_res,
+                                                    ExecPolicy<cuda_fused_segit, cuda_exec<BlockSize, Async>>,
+                                                    const TypedIndexSet<TypedRangeSegment<T>>& iset,
+                                                    LoopBody&& loop_body)
+{
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using table_entry = impl::FusedSegmentBlock<T>;
+
+  auto func = impl::forall_cuda_fused_kernel<BlockSize, LOOP_BODY, T>;
+  RAJA_CUDA_REGISTER_KERNEL(
+      impl::forall_cuda_fused_kernel<BlockSize, LOOP_BODY, T>);
+
+  cudaStream_t stream = cuda_res.get_stream();
+
+  //
+  // Build the block-to-segment mapping table on the host, chunking each
+  // segment into blocks of at most BlockSize indices
+  //
+  std::vector<table_entry> blocks;
+  int num_seg = iset.getNumSegments();
+  for (int isi = 0; isi < num_seg; ++isi) {
+    const TypedRangeSegment<T>& seg =
+        iset.template getSegment<TypedRangeSegment<T>>(isi);
+    T seg_begin = *seg.begin();
+    auto seg_len = seg.size();
+    using seg_len_type = decltype(seg_len);
+    for (seg_len_type off = 0; off < seg_len;
+         off += static_cast<seg_len_type>(BlockSize)) {
+      cuda_dim_member_t chunk = static_cast<cuda_dim_member_t>(
+          std::min(seg_len - off, static_cast<seg_len_type>(BlockSize)));
+      blocks.push_back(table_entry{seg_begin + static_cast<T>(off), chunk});
+    }
+  }
+
+  // Only launch kernel if we have something to iterate over
+  if (!blocks.empty() && BlockSize > 0) {
+
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize{static_cast<cuda_dim_member_t>(blocks.size()), 1, 1};
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Copy the mapping table to the device; the one synchronous copy
+    // replaces a launch per segment
+    //
+    table_entry* d_blocks =
+        RAJA::cuda::device_mempool_type::getInstance().malloc<table_entry>(
+            blocks.size());
+    cudaErrchk(cudaMemcpy(d_blocks,
+                          blocks.data(),
+                          blocks.size() * sizeof(table_entry),
+                          cudaMemcpyHostToDevice));
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, stream, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      void *args[] = {(void*)&body, (void*)&d_blocks};
+      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, stream);
+    }
+
+    if (!Async) { RAJA::cuda::synchronize(stream); }
+
+    RAJA::cuda::device_mempool_type::getInstance().free(d_blocks);
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(&cuda_res);
+}
+
 }  // namespace cuda
 
 }  // namespace policy
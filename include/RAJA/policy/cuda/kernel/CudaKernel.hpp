@@ -23,12 +23,15 @@
 
 #if defined(RAJA_ENABLE_CUDA)
 
+#include <array>
 #include <cassert>
 #include <climits>
+#include <map>
 
 #include "camp/camp.hpp"
 
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/kernel.hpp"
@@ -55,8 +58,13 @@ namespace RAJA
  * If num_threads is 0 and num_blocks is non-zero then num_threads is chosen at
  * runtime.
  * Num_threads is 1024, which may not be appropriate for all kernels.
+ *
+ * When num_threads is fixed at compile time, blocks_per_sm becomes the
+ * second __launch_bounds__ argument of the generated kernel, pinning the
+ * minimum number of resident blocks per multiprocessor and thereby the
+ * register budget the compiler may spend per thread.
  */
-template <bool async0, size_t num_blocks, size_t num_threads>
+template <bool async0, size_t num_blocks, size_t num_threads, size_t blocks_per_sm = 1>
 struct cuda_launch {};
 
 /*!
@@ -65,8 +73,8 @@ struct cuda_launch {};
  * If num_blocks is 0 then num_blocks is chosen at runtime.
  * Num_blocks is chosen to maximize the number of blocks running concurrently.
  */
-template <bool async0, size_t num_blocks, size_t num_threads>
-using cuda_explicit_launch = cuda_launch<async0, num_blocks, num_threads>;
+template <bool async0, size_t num_blocks, size_t num_threads, size_t blocks_per_sm = 1>
+using cuda_explicit_launch = cuda_launch<async0, num_blocks, num_threads, blocks_per_sm>;
 
 
 /*!
@@ -149,6 +157,30 @@ using CudaKernelFixedAsync =
     CudaKernelExt<cuda_explicit_launch<true, operators::limits<size_t>::max(), num_threads>,
                   EnclosedStmts...>;
 
+/*!
+ * A RAJA::kernel statement that launches a CUDA kernel with a fixed
+ * number of threads (specified by num_threads) and a minimum number of
+ * resident blocks per multiprocessor (specified by blocks_per_sm),
+ * which caps the per-thread register count for this kernel only.
+ * The kernel launch is synchronous.
+ */
+template <size_t num_threads, size_t blocks_per_sm, typename... EnclosedStmts>
+using CudaKernelFixedSM =
+    CudaKernelExt<cuda_explicit_launch<false, operators::limits<size_t>::max(), num_threads, blocks_per_sm>,
+                  EnclosedStmts...>;
+
+/*!
+ * A RAJA::kernel statement that launches a CUDA kernel with a fixed
+ * number of threads (specified by num_threads) and a minimum number of
+ * resident blocks per multiprocessor (specified by blocks_per_sm),
+ * which caps the per-thread register count for this kernel only.
+ * The kernel launch is asynchronous.
+ */
+template <size_t num_threads, size_t blocks_per_sm, typename... EnclosedStmts>
+using CudaKernelFixedSMAsync =
+    CudaKernelExt<cuda_explicit_launch<true, operators::limits<size_t>::max(), num_threads, blocks_per_sm>,
+                  EnclosedStmts...>;
+
 /*!
  * A RAJA::kernel statement that launches a CUDA kernel with 1024 threads
  * The kernel launch is synchronous.
@@ -186,12 +218,14 @@ __global__ void CudaKernelLauncher(Data data)
 /*!
  * CUDA global function for launching CudaKernel policies
  * This is annotated to guarantee that device code generated
- * can be launched by a kernel with BlockSize number of threads.
+ * can be launched by a kernel with BlockSize number of threads, and
+ * that at least BlocksPerSM blocks are resident per multiprocessor,
+ * which bounds the registers available to each thread.
  *
  * This launcher is used by the CudaKerelFixed policies.
  */
-template <size_t BlockSize, typename Data, typename Exec>
-__launch_bounds__(BlockSize, 1) __global__
+template <size_t BlockSize, size_t BlocksPerSM, typename Data, typename Exec>
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
     void CudaKernelLauncherFixed(Data data)
 {
 
@@ -211,13 +245,13 @@ __launch_bounds__(BlockSize, 1) __global__
  * The default case handles BlockSize != 0 and gets the fixed max block size
  * version of the kernel.
  */
-template<size_t BlockSize, typename Data, typename executor_t>
+template<size_t BlockSize, size_t BlocksPerSM, typename Data, typename executor_t>
 struct CudaKernelLauncherGetter
 {
-  using type = camp::decay<decltype(&internal::CudaKernelLauncherFixed<BlockSize, Data, executor_t>)>;
+  using type = camp::decay<decltype(&internal::CudaKernelLauncherFixed<BlockSize, BlocksPerSM, Data, executor_t>)>;
   static constexpr type get() noexcept
   {
-    return internal::CudaKernelLauncherFixed<BlockSize, Data, executor_t>;
+    return internal::CudaKernelLauncherFixed<BlockSize, BlocksPerSM, Data, executor_t>;
   }
 };
 
@@ -225,8 +259,8 @@ struct CudaKernelLauncherGetter
  * Helper class specialization for BlockSize == 0 and gets the unfixed max
  * block size version of the kernel.
  */
-template<typename Data, typename executor_t>
-struct CudaKernelLauncherGetter<0, Data, executor_t>
+template<size_t BlocksPerSM, typename Data, typename executor_t>
+struct CudaKernelLauncherGetter<0, BlocksPerSM, Data, executor_t>
 {
   using type = camp::decay<decltype(&internal::CudaKernelLauncher<Data, executor_t>)>;
   static constexpr type get() noexcept
@@ -236,6 +270,24 @@ struct CudaKernelLauncherGetter<0, Data, executor_t>
 };
 
 
+/*!
+ * Helper functions to extract the launch stream from the resource carried
+ * in the LoopData object. Kernels launched through kernel/kernel_param
+ * carry a Host resource and use the default stream.
+ */
+RAJA_INLINE
+cudaStream_t get_cuda_stream(RAJA::resources::Cuda &res)
+{
+  return res.get_stream();
+}
+
+template <typename Resource>
+RAJA_INLINE cudaStream_t get_cuda_stream(Resource &)
+{
+  return cudaStream_t(0);
+}
+
+
 
 /*!
  * Helper class that handles CUDA kernel launching, and computing
@@ -250,8 +302,8 @@ struct CudaLaunchHelper;
  * The user may specify the number of threads and blocks or let one or both be
  * determined at runtime using the CUDA occupancy calculator.
  */
-template<bool async0, size_t num_blocks, size_t num_threads, typename StmtList, typename Data, typename Types>
-struct CudaLaunchHelper<cuda_launch<async0, num_blocks, num_threads>,StmtList,Data,Types>
+template<bool async0, size_t num_blocks, size_t num_threads, size_t blocks_per_sm, typename StmtList, typename Data, typename Types>
+struct CudaLaunchHelper<cuda_launch<async0, num_blocks, num_threads, blocks_per_sm>,StmtList,Data,Types>
 {
   using Self = CudaLaunchHelper;
 
@@ -259,7 +311,7 @@ struct CudaLaunchHelper<cuda_launch<async0, num_blocks, num_threads>,StmtList,Da
 
   using executor_t = internal::cuda_statement_list_executor_t<StmtList, Data, Types>;
 
-  using kernelGetter_t = CudaKernelLauncherGetter<(num_threads <= 0) ? 0 : num_threads, Data, executor_t>;
+  using kernelGetter_t = CudaKernelLauncherGetter<(num_threads <= 0) ? 0 : num_threads, blocks_per_sm, Data, executor_t>;
 
   inline static void recommended_blocks_threads(int shmem_size,
       size_t &recommended_blocks, size_t &recommended_threads)
@@ -383,9 +435,35 @@ struct CudaLaunchHelper<cuda_launch<async0, num_blocks, num_threads>,StmtList,Da
   {
     auto func = kernelGetter_t::get();
 
+    // the getter type keys static-init registration of this kernel for
+    // ahead-of-time warmup through RAJA::preload_kernels
+    (void)::RAJA::cuda::detail::KernelRegistrar<kernelGetter_t>::s_registered;
+
+    // capture this kernel's resource footprint (parameter bytes,
+    // registers, local/shared memory) at its first launch; queryable
+    // afterward through RAJA::cuda::kernel_resource_usage()
+    static const bool resources_recorded =
+        (RAJA::cuda::record_kernel_resource_usage((const void*)func,
+                                                  sizeof(Data)),
+         true);
+    (void)resources_recorded;
+
     void *args[] = {(void*)&data};
     RAJA::cuda::launch((const void*)func, launch_dims.blocks, launch_dims.threads, args, shmem, stream);
   }
+
+  //! report warp fill, shared-memory pressure, and predicted occupancy
+  //  for the resolved launch dimensions of the generated kernel
+  static void launch_diagnostics(internal::LaunchDims launch_dims,
+                                 size_t shmem)
+  {
+    auto func = kernelGetter_t::get();
+
+    RAJA::cuda::kernel_launch_diagnostics((const void*)func,
+                                          launch_dims.blocks,
+                                          launch_dims.threads,
+                                          shmem);
+  }
 };
 
 /*!
@@ -466,10 +544,32 @@ struct StatementExecutor<
     using launch_t = CudaLaunchHelper<LaunchConfig, stmt_list_t, data_t, Types>;
 
 
+    //
+    // Look for launch dimensions cached from a previous invocation at
+    // this call site with the same segment extents.  The cache variable
+    // is a function-local static of this template instantiation, so it
+    // is keyed on the statement tree and loop data types; the map keys
+    // on the extents themselves.  A hit skips both the statement tree
+    // walk and the occupancy calculator queries below.
+    //
+    static constexpr size_t num_segments =
+        camp::tuple_size<typename data_t::segment_tuple_t>::value;
+    using extents_t = std::array<Index_type, num_segments>;
+
+    extents_t extents =
+        get_segment_extents(data, camp::make_idx_seq_t<num_segments>{});
+
+    thread_local static std::map<extents_t, LaunchDims> launch_dims_cache;
+
+    auto cache_entry = launch_dims_cache.find(extents);
+    bool cache_hit = (cache_entry != launch_dims_cache.end());
+
+
     //
     // Compute the requested kernel dimensions
     //
-    LaunchDims launch_dims = executor_t::calculateDimensions(data);
+    LaunchDims launch_dims = cache_hit ? cache_entry->second
+                                       : executor_t::calculateDimensions(data);
 
 
     // Only launch kernel if we have something to iterate over
@@ -481,87 +581,105 @@ struct StatementExecutor<
       // Setup shared memory buffers
       //
       int shmem = 0;
-      cudaStream_t stream = 0;
+      cudaStream_t stream = get_cuda_stream(data.res);
 
+      if (!cache_hit) {
 
-      //
-      // Compute the recommended physical kernel blocks and threads
-      //
-      size_t recommended_blocks;
-      size_t recommended_threads;
-      launch_t::recommended_blocks_threads(
-          shmem, recommended_blocks, recommended_threads);
+        //
+        // Compute the recommended physical kernel blocks and threads
+        //
+        size_t recommended_blocks;
+        size_t recommended_threads;
+        launch_t::recommended_blocks_threads(
+            shmem, recommended_blocks, recommended_threads);
 
 
-      //
-      // Compute the MAX physical kernel threads
-      //
-      size_t max_threads;
-      launch_t::max_threads(shmem, max_threads);
+        //
+        // Compute the MAX physical kernel threads
+        //
+        size_t max_threads;
+        launch_t::max_threads(shmem, max_threads);
 
 
-      //
-      // Fit the requested threads
-      //
-      cuda_dim_t fit_threads{0,0,0};
+        //
+        // Fit the requested threads
+        //
+        cuda_dim_t fit_threads{0,0,0};
 
-      if ( recommended_threads >= get_size(launch_dims.min_threads) ) {
+        if ( recommended_threads >= get_size(launch_dims.min_threads) ) {
 
-        fit_threads = fitCudaDims(
-            recommended_threads, launch_dims.threads, launch_dims.min_threads);
+          fit_threads = fitCudaDims(
+              recommended_threads, launch_dims.threads, launch_dims.min_threads);
 
-      }
+        }
 
-      //
-      // Redo fit with max threads
-      //
-      if ( recommended_threads < max_threads &&
-           get_size(fit_threads) != recommended_threads ) {
+        //
+        // Redo fit with max threads
+        //
+        if ( recommended_threads < max_threads &&
+             get_size(fit_threads) != recommended_threads ) {
 
-        fit_threads = fitCudaDims(
-            max_threads, launch_dims.threads, launch_dims.min_threads);
+          fit_threads = fitCudaDims(
+              max_threads, launch_dims.threads, launch_dims.min_threads);
 
-      }
+        }
 
-      launch_dims.threads = fit_threads;
+        launch_dims.threads = fit_threads;
 
 
-      //
-      // Compute the MAX physical kernel blocks
-      //
-      size_t max_blocks;
-      launch_t::max_blocks(shmem, max_blocks, launch_dims.num_threads());
+        //
+        // Compute the MAX physical kernel blocks
+        //
+        size_t max_blocks;
+        launch_t::max_blocks(shmem, max_blocks, launch_dims.num_threads());
 
-      size_t use_blocks;
+        size_t use_blocks;
 
-      if ( launch_dims.num_threads() == recommended_threads ) {
+        if ( launch_dims.num_threads() == recommended_threads ) {
 
-        //
-        // Fit the requested blocks
-        //
-        use_blocks = recommended_blocks;
+          //
+          // Fit the requested blocks
+          //
+          use_blocks = recommended_blocks;
 
-      } else {
+        } else {
+
+          //
+          // Fit the max blocks
+          //
+          use_blocks = max_blocks;
+
+        }
+
+        launch_dims.blocks = fitCudaDims(
+            use_blocks, launch_dims.blocks, launch_dims.min_blocks);
 
         //
-        // Fit the max blocks
+        // make sure that we fit
         //
-        use_blocks = max_blocks;
-
-      }
+        /* Doesn't make sense to check this anymore - AJK
+        if(launch_dims.num_blocks() > max_blocks){
+          RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num blocks");
+        }*/
+        if(launch_dims.num_threads() > max_threads){
+          RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num threads");
+        }
 
-      launch_dims.blocks = fitCudaDims(
-          use_blocks, launch_dims.blocks, launch_dims.min_blocks);
+        //
+        // Flag mis-shaped launches (partial warps, shared-memory
+        // pressure, low predicted occupancy) before the first launch;
+        // opt-in via RAJA_CUDA_KERNEL_DIAGNOSTICS and reported once
+        // per generated kernel
+        //
+        if (RAJA::cuda::kernel_diagnostics_enabled()) {
+          launch_t::launch_diagnostics(launch_dims, shmem);
+        }
 
-      //
-      // make sure that we fit
-      //
-      /* Doesn't make sense to check this anymore - AJK
-      if(launch_dims.num_blocks() > max_blocks){
-        RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num blocks");
-      }*/
-      if(launch_dims.num_threads() > max_threads){
-        RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num threads");
+        //
+        // Remember the fitted dimensions for the next invocation with
+        // these extents
+        //
+        launch_dims_cache[extents] = launch_dims;
       }
 
       {
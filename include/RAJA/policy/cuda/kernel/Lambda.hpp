@@ -65,6 +65,29 @@ struct CudaStatementExecutor<Data, statement::Lambda<LambdaIndex, Args...>, Type
 };
 
 
+template <typename Data, camp::idx_t LambdaIndex, typename... Args, typename Types>
+struct CudaStatementExecutor<Data, statement::FissionLambda<LambdaIndex, Args...>, Types> {
+
+  static
+  inline RAJA_DEVICE void exec(Data &data, bool thread_active)
+  {
+    // Only execute the lambda if it hasn't been masked off
+    if(thread_active){
+      StatementExecutor<statement::FissionLambda<LambdaIndex, Args...>, Types>::exec(data);
+    }
+
+  }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const & RAJA_UNUSED_ARG(data))
+  {
+    return LaunchDims();
+  }
+};
+
+
 
 
 }  // namespace internal
@@ -0,0 +1,184 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for CUDA tile load/store executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_cuda_kernel_LoadStore_HPP
+#define RAJA_policy_cuda_kernel_LoadStore_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/kernel/LoadStore.hpp"
+#include "RAJA/policy/cuda/kernel/internal.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * Cooperative tile copy shared by the CUDA Load and Store executors.
+ *
+ * The whole thread block strides over the flattened tile with the
+ * View's innermost dimension fastest, so consecutive threads touch
+ * consecutive innermost-dimension elements and global accesses
+ * coalesce; any bank-avoiding permutation of the local array is
+ * absorbed by its layout. Leaf index bookkeeping matches the CPU
+ * executor in pattern/kernel/LoadStore.hpp.
+ */
+template <bool IsLoad,
+          camp::idx_t ViewPos,
+          camp::idx_t ArrayPos,
+          camp::idx_t... Args>
+struct CudaTileCopyExecutor {
+
+  static constexpr size_t rank = sizeof...(Args);
+
+  using cpu_impl_t = TileCopyExecutor<IsLoad, ViewPos, ArrayPos, Args...>;
+
+  template <typename Data>
+  static RAJA_DEVICE RAJA_INLINE void copy(Data& data)
+  {
+    camp::idx_t lens[] = {
+        static_cast<camp::idx_t>(segment_length<Args>(data))...};
+
+    camp::idx_t total = 1;
+    for (size_t p = 0; p < rank; ++p) {
+      total *= lens[p];
+    }
+
+    camp::idx_t num_threads = static_cast<camp::idx_t>(
+        blockDim.x * blockDim.y * blockDim.z);
+    camp::idx_t tid = static_cast<camp::idx_t>(
+        threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z));
+
+    for (camp::idx_t lin = tid; lin < total; lin += num_threads) {
+      // decompose with the last listed (innermost View) dimension
+      // fastest
+      camp::idx_t vi[rank];
+      camp::idx_t rem = lin;
+      for (size_t p = rank; p-- > 0;) {
+        vi[p] = rem % lens[p];
+        rem /= lens[p];
+      }
+      copy_leaf(data, camp::make_idx_seq_t<rank>{}, vi);
+    }
+  }
+
+  template <typename Data, camp::idx_t... Ds>
+  static RAJA_DEVICE RAJA_INLINE void copy_leaf(Data& data,
+                                                camp::idx_seq<Ds...>,
+                                                camp::idx_t (&vi)[rank])
+  {
+    auto& view = camp::get<ViewPos>(data.param_tuple);
+    auto& arr = camp::get<ArrayPos>(data.param_tuple);
+
+    constexpr camp::idx_t ranks[] = {cpu_impl_t::arg_rank(Args)...};
+    camp::idx_t ai[rank];
+    for (size_t p = 0; p < rank; ++p) {
+      ai[ranks[p]] = vi[p];
+    }
+
+    auto&& a = arr(ai[Ds]...);
+    auto&& v =
+        view(*(camp::get<Args>(data.segment_tuple).begin() + vi[Ds])...);
+    assign(std::integral_constant<bool, IsLoad>{}, a, v);
+  }
+
+  template <typename Array, typename View>
+  static RAJA_DEVICE RAJA_INLINE void assign(std::true_type,
+                                             Array&& a,
+                                             View&& v)
+  {
+    a = v;
+  }
+
+  template <typename Array, typename View>
+  static RAJA_DEVICE RAJA_INLINE void assign(std::false_type,
+                                             Array&& a,
+                                             View&& v)
+  {
+    v = a;
+  }
+};
+
+
+//! Executor for statement::Load inside CudaKernel statement lists
+template <typename Data,
+          camp::idx_t ViewPos,
+          camp::idx_t ArrayPos,
+          camp::idx_t... Args,
+          typename Types>
+struct CudaStatementExecutor<
+    Data,
+    statement::Load<ViewPos, ArrayPos, camp::idx_seq<Args...>>,
+    Types> {
+
+  static inline RAJA_DEVICE void exec(Data& data, bool)
+  {
+    // all threads of the block cooperate, then wait for the tile to be
+    // fully staged before any consumer runs
+    CudaTileCopyExecutor<true, ViewPos, ArrayPos, Args...>::copy(data);
+    __syncthreads();
+  }
+
+  static inline LaunchDims calculateDimensions(Data const&)
+  {
+    return LaunchDims();
+  }
+};
+
+
+//! Executor for statement::Store inside CudaKernel statement lists
+template <typename Data,
+          camp::idx_t ViewPos,
+          camp::idx_t ArrayPos,
+          camp::idx_t... Args,
+          typename Types>
+struct CudaStatementExecutor<
+    Data,
+    statement::Store<ViewPos, ArrayPos, camp::idx_seq<Args...>>,
+    Types> {
+
+  static inline RAJA_DEVICE void exec(Data& data, bool)
+  {
+    // wait for all producers of the tile, copy out cooperatively, and
+    // fence before the local array is reused
+    __syncthreads();
+    CudaTileCopyExecutor<false, ViewPos, ArrayPos, Args...>::copy(data);
+    __syncthreads();
+  }
+
+  static inline LaunchDims calculateDimensions(Data const&)
+  {
+    return LaunchDims();
+  }
+};
+
+}  // end namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_CUDA guard
+
+#endif  // closing endif for header file include guard
@@ -51,12 +51,59 @@ struct CudaSyncThreads : public internal::Statement<camp::nil> {
 struct CudaSyncWarp : public internal::Statement<camp::nil> {
 };
 
+/*!
+ * A RAJA::kernel statement that performs a device-wide barrier using
+ * block-to-block flag signaling, without a kernel launch boundary.
+ *
+ * Placed after the lambda inside a statement::Hyperplane, this lets a
+ * wavefront sweep span multiple blocks in a single kernel launch; each
+ * hyperplane is separated by this lightweight in-kernel barrier instead
+ * of a kernel launch and device synchronization.
+ *
+ * Restrictions: every block and thread of the launch must reach the
+ * barrier (use it only at full-grid control flow), the grid must be
+ * small enough that all blocks are resident on the device at once, and
+ * at most one kernel using CudaSyncGrid may be in flight on a device at
+ * a time since the barrier state is shared between launches.
+ */
+struct CudaSyncGrid : public internal::Statement<camp::nil> {
+};
+
 
 }  // namespace statement
 
 namespace internal
 {
 
+//! state for the software grid barrier used by CudaSyncGrid; count
+//  wraps back to zero each time the full grid arrives, and blocks
+//  waiting at the barrier spin on the generation flag
+static __device__ unsigned int cuda_grid_barrier_count = 0;
+static __device__ unsigned int cuda_grid_barrier_generation = 0;
+
+RAJA_INLINE RAJA_DEVICE void cuda_grid_barrier()
+{
+  // make this thread's prior writes visible device-wide, then gather
+  // the whole block before block 0-threads signal arrival
+  __threadfence();
+  __syncthreads();
+
+  if (threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0) {
+    unsigned int num_blocks = gridDim.x * gridDim.y * gridDim.z;
+    volatile unsigned int* generation = &cuda_grid_barrier_generation;
+    unsigned int my_generation = *generation;
+    if (atomicInc(&cuda_grid_barrier_count, num_blocks - 1) ==
+        num_blocks - 1) {
+      // last block to arrive releases the rest
+      atomicAdd(&cuda_grid_barrier_generation, 1u);
+    } else {
+      while (*generation == my_generation) {
+      }
+    }
+  }
+  __syncthreads();
+}
+
 template <typename Data, typename Types>
 struct CudaStatementExecutor<Data, statement::CudaSyncThreads, Types> {
 
@@ -74,6 +121,23 @@ struct CudaStatementExecutor<Data, statement::CudaSyncThreads, Types> {
   }
 };
 
+template <typename Data, typename Types>
+struct CudaStatementExecutor<Data, statement::CudaSyncGrid, Types> {
+
+  static
+  inline
+  RAJA_DEVICE
+  void exec(Data &, bool) { cuda_grid_barrier(); }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const & RAJA_UNUSED_ARG(data))
+  {
+    return LaunchDims();
+  }
+};
+
 template <typename Data, typename Types>
 struct CudaStatementExecutor<Data, statement::CudaSyncWarp, Types> {
 
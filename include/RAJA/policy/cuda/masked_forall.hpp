@@ -0,0 +1,167 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA masked forall declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_masked_forall_cuda_HPP
+#define RAJA_masked_forall_cuda_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <utility>
+
+#include "RAJA/util/BitMask.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+
+namespace RAJA
+{
+
+namespace cuda
+{
+
+namespace impl
+{
+
+/*!
+        \brief warp-compacted masked forall kernel
+
+   Each warp owns WARP_SIZE consecutive iterates and reads their
+   activity bits from the mask in one word access — the mask word is
+   the warp's ballot, known without a vote. The warp places its active
+   iterates on its low lanes: lane l executes the (l+1)-th active
+   iterate, so a warp with k active iterates retires after k lanes of
+   work instead of running full width with most lanes branching out.
+   Warps whose iterates are all inactive exit on the word test without
+   calling the body.
+*/
+template <size_t BlockSize,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__launch_bounds__(BlockSize, 1) __global__
+    void masked_forall_cuda_kernel(LOOP_BODY loop_body,
+                                   const Iterator idx,
+                                   const BitSetWord* mask_words,
+                                   IndexType length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+
+  const IndexType ii =
+      static_cast<IndexType>(blockIdx.x) * blockDim.x + threadIdx.x;
+  const int lane = threadIdx.x & (policy::cuda::WARP_SIZE - 1);
+  const IndexType warp_base = ii - static_cast<IndexType>(lane);
+  if (warp_base >= length) {
+    return;
+  }
+
+  // this warp's WARP_SIZE activity bits; warp bases are WARP_SIZE
+  // aligned, so the shift within the 64-bit mask word is 0 or 32
+  constexpr IndexType wbits =
+      static_cast<IndexType>(BitSetView::bits_per_word);
+  const BitSetWord word = mask_words[warp_base / wbits];
+  unsigned int m = static_cast<unsigned int>(word >> (warp_base % wbits));
+
+  // ignore bits past the end of the iteration space
+  if (length - warp_base < static_cast<IndexType>(policy::cuda::WARP_SIZE)) {
+    m &= (1u << (length - warp_base)) - 1u;
+  }
+
+  const int nactive = __popc(m);
+  if (lane < nactive) {
+    const int b = __fns(m, 0, lane + 1);
+    body(idx[warp_base + static_cast<IndexType>(b)]);
+  }
+}
+
+}  // namespace impl
+
+}  // namespace cuda
+
+namespace impl
+{
+namespace masked
+{
+
+/*!
+        \brief masked forall via warp-ballot compaction of the active
+   iterates
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename Iterator,
+          typename LoopBody>
+void forall(resources::Cuda& cuda_res,
+            const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+            Iterator begin,
+            Index_type length,
+            const BitSetView& mask,
+            LoopBody&& loop_body)
+{
+  using LOOP_BODY = camp::decay<LoopBody>;
+
+  cudaStream_t stream = cuda_res.get_stream();
+
+  cuda_dim_t blockSize{BLOCK_SIZE, 1, 1};
+  cuda_dim_t gridSize{static_cast<cuda_dim_member_t>(
+                          (length + static_cast<Index_type>(BLOCK_SIZE) - 1) /
+                          static_cast<Index_type>(BLOCK_SIZE)),
+                      1, 1};
+
+  RAJA_FT_BEGIN;
+
+  size_t shmem = 0;
+
+  {
+    //
+    // Privatize the loop_body, using make_launch_body to setup reductions
+    //
+    LOOP_BODY body = RAJA::cuda::make_launch_body(
+        gridSize, blockSize, shmem, stream,
+        std::forward<LoopBody>(loop_body));
+
+    cuda::impl::masked_forall_cuda_kernel<BLOCK_SIZE>
+        <<<gridSize, blockSize, shmem, stream>>>(body, begin, mask.words,
+                                                 length);
+    cudaErrchk(cudaPeekAtLastError());
+  }
+
+  cuda::launch(stream);
+  if (!Async) cuda::synchronize(stream);
+
+  RAJA_FT_END;
+}
+
+}  // namespace masked
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing check for RAJA_ENABLE_CUDA
+
+#endif  // closing endif for header file include guard
@@ -81,11 +81,113 @@ struct cuda_exec : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Platform::cuda> {
 };
 
+///
+/// Policy that, in addition to fixing the block size, pins the minimum
+/// number of resident blocks per multiprocessor through the second
+/// __launch_bounds__ argument. Raising BLOCKS_PER_SM tightens the
+/// per-thread register budget the compiler may use (possibly spilling),
+/// while BLOCKS_PER_SM = 1 leaves the register allocator free; this lets
+/// occupancy/spill tradeoffs be chosen per kernel from the policy type
+/// instead of compiling translation units with different -maxrregcount.
+///
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async = false>
+struct cuda_exec_explicit : public RAJA::make_policy_pattern_launch_platform_t<
+                                RAJA::Policy::cuda,
+                                RAJA::Pattern::forall,
+                                detail::get_launch<Async>::value,
+                                RAJA::Platform::cuda> {
+};
 
+///
+/// Policy that selects the block size (and resulting grid size) at launch
+/// time via cudaOccupancyMaxPotentialBlockSize for the instantiated kernel,
+/// cached per kernel symbol, instead of hard-coding a block size that is
+/// only right for one device and one register footprint.
+///
+template <bool Async = false>
+struct cuda_exec_occ_calc : public RAJA::make_policy_pattern_launch_platform_t<
+                                RAJA::Policy::cuda,
+                                RAJA::Pattern::forall,
+                                detail::get_launch<Async>::value,
+                                RAJA::Platform::cuda> {
+};
+
+///
+/// Policy that launches a grid-stride loop: the grid is sized to cover
+/// the iteration space but clamped to a whole multiple of the device's
+/// SM count, and each thread strides by the grid width over any
+/// remaining iterates. Very long ranges run in a bounded number of
+/// blocks instead of flooding the scheduler with one block per tile,
+/// while short ranges launch exactly as many blocks as cuda_exec would.
+/// MAX_BLOCKS caps the grid; the default of 0 derives the cap from the
+/// occupancy calculator (resident blocks per SM times SM count), so the
+/// grid just fills the device for the instantiated kernel.
+///
+template <size_t BLOCK_SIZE, size_t MAX_BLOCKS = 0, bool Async = false>
+struct cuda_exec_grid_stride
+    : public RAJA::make_policy_pattern_launch_platform_t<
+          RAJA::Policy::cuda,
+          RAJA::Pattern::forall,
+          detail::get_launch<Async>::value,
+          RAJA::Platform::cuda> {
+};
+
+///
+/// Policy that assigns ITEMS_PER_THREAD iterates to each thread and
+/// stages each block's chunk of the index array through shared memory:
+/// the chunk is loaded cooperatively with coalesced accesses, then each
+/// thread gathers its items from the staged indices. Intended for list
+/// segments driving scattered gathers, where per-thread multi-item
+/// loading would otherwise break coalescing of the index loads.
+///
+template <size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD = 4, bool Async = false>
+struct cuda_exec_staged : public RAJA::make_policy_pattern_launch_platform_t<
+                              RAJA::Policy::cuda,
+                              RAJA::Pattern::forall,
+                              detail::get_launch<Async>::value,
+                              RAJA::Platform::cuda> {
+};
+
+///
+/// Policy that dispatches foralls to a persistent grid of NUM_BLOCKS
+/// blocks of BLOCK_SIZE threads, started on first use and left resident.
+/// Each forall is published to the grid through a mailbox in pinned
+/// mapped memory instead of a kernel launch, so dispatch cost is a few
+/// memory writes — worthwhile for streams of very short foralls where
+/// launch overhead dominates. Execution is always synchronous.
+///
+/// Restrictions: loop bodies may not use RAJA reducers (there is no
+/// per-launch reduction setup), and device-wide synchronization
+/// (cudaDeviceSynchronize, RAJA::cuda::synchronize()) will deadlock
+/// while the grid is resident — synchronize on streams instead. Dispatch
+/// is not thread safe; publish from one host thread at a time.
+///
+template <size_t BLOCK_SIZE, size_t NUM_BLOCKS = 32>
+struct cuda_exec_persistent
+    : public RAJA::make_policy_pattern_launch_platform_t<
+          RAJA::Policy::cuda,
+          RAJA::Pattern::forall,
+          RAJA::Launch::sync,
+          RAJA::Platform::cuda> {
+};
 
-//
-// NOTE: There is no Index set segment iteration policy for CUDA
-//
+
+
+///
+/// Index set segment iteration policy that packs every range segment of
+/// an index set into one kernel launch using a block-to-segment mapping
+/// table, instead of launching one kernel per segment. Use it as the
+/// segment iteration policy in ExecPolicy<cuda_fused_segit,
+/// cuda_exec<BLOCK_SIZE>>; the cuda_exec policy supplies the block size
+/// and the Async behavior of the fused launch.
+///
+struct cuda_fused_segit
+    : public RAJA::make_policy_pattern_launch_platform_t<
+          RAJA::Policy::cuda,
+          RAJA::Pattern::forall,
+          RAJA::Launch::undefined,
+          RAJA::Platform::cuda> {
+};
 
 ///
 /// WorkGroup execution policies
@@ -105,6 +207,19 @@ struct unordered_cuda_loop_y_block_iter_x_threadblock_average
                        RAJA::Platform::cuda> {
 };
 
+///
+/// Same mapping as unordered_cuda_loop_y_block_iter_x_threadblock_average,
+/// but the launch is captured into a persistent CUDA graph on the first
+/// run and replayed with cudaGraphLaunch on subsequent runs, cutting
+/// per-launch overhead for WorkGroups that are run many times.
+///
+struct unordered_cuda_loop_y_block_iter_x_threadblock_average_graph
+    : public RAJA::make_policy_pattern_platform_t<
+                       RAJA::Policy::cuda,
+                       RAJA::Pattern::workgroup_order,
+                       RAJA::Platform::cuda> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -126,6 +241,39 @@ using cuda_reduce = cuda_reduce_base<false>;
 
 using cuda_reduce_atomic = cuda_reduce_base<true>;
 
+///
+/// Reduction policy guaranteeing a combine order fixed by the launch
+/// shape. The non-atomic grid reduce already has one: each block writes
+/// its fixed-shape block-tree partial to the slot for its block index,
+/// and the last finishing block folds the slots in block-index order,
+/// so results are bitwise reproducible from run to run no matter how
+/// blocks are scheduled. This name pins that path for verification and
+/// regression-comparison runs; unlike cuda_reduce it can never be
+/// traded for the atomic or launch-tuned combines, whose cross-block
+/// accumulation order follows block completion order.
+///
+using cuda_reduce_deterministic = cuda_reduce_base<false>;
+
+///
+/// Reduction policy with an explicit grid-combine topology, selected at
+/// launch from the grid size. Grids of at most ATOMIC_MAX_BLOCKS blocks
+/// accumulate directly into a single device slot with one atomic per
+/// block, skipping the cross-block tree entirely; larger grids combine
+/// through a two-level tree in which the last finishing block of every
+/// FAN_IN consecutive blocks reduces that group, so no single block
+/// combines more than FAN_IN (or one value per group) entries.
+/// Combiners without a device atomic always use the tree.
+///
+template <size_t ATOMIC_MAX_BLOCKS = 128, size_t FAN_IN = 128>
+struct cuda_reduce_tuned
+    : public RAJA::
+          make_policy_pattern_launch_platform_t<RAJA::Policy::cuda,
+                                                RAJA::Pattern::reduce,
+                                                detail::get_launch<false>::value,
+                                                RAJA::Platform::cuda> {
+  static_assert(FAN_IN > 1, "fan-in must be at least 2");
+};
+
 
 // Policy for RAJA::statement::Reduce that reduces threads in a block
 // down to threadIdx 0
@@ -201,16 +349,45 @@ using policy::cuda::cuda_exec;
 template <size_t BLOCK_SIZE>
 using cuda_exec_async = policy::cuda::cuda_exec<BLOCK_SIZE, true>;
 
+using policy::cuda::cuda_exec_explicit;
+
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM>
+using cuda_exec_explicit_async =
+    policy::cuda::cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, true>;
+
+using policy::cuda::cuda_exec_grid_stride;
+
+template <size_t BLOCK_SIZE, size_t MAX_BLOCKS = 0>
+using cuda_exec_grid_stride_async =
+    policy::cuda::cuda_exec_grid_stride<BLOCK_SIZE, MAX_BLOCKS, true>;
+
+using cuda_exec_occ_calc = policy::cuda::cuda_exec_occ_calc<false>;
+
+using cuda_exec_occ_calc_async = policy::cuda::cuda_exec_occ_calc<true>;
+
+using policy::cuda::cuda_exec_persistent;
+
+using policy::cuda::cuda_exec_staged;
+
+template <size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD = 4>
+using cuda_exec_staged_async =
+    policy::cuda::cuda_exec_staged<BLOCK_SIZE, ITEMS_PER_THREAD, true>;
+
+using policy::cuda::cuda_fused_segit;
+
 using policy::cuda::cuda_work;
 
 template <size_t BLOCK_SIZE>
 using cuda_work_async = policy::cuda::cuda_work<BLOCK_SIZE, true>;
 
 using policy::cuda::unordered_cuda_loop_y_block_iter_x_threadblock_average;
+using policy::cuda::unordered_cuda_loop_y_block_iter_x_threadblock_average_graph;
 
 using policy::cuda::cuda_reduce_base;
 using policy::cuda::cuda_reduce;
 using policy::cuda::cuda_reduce_atomic;
+using policy::cuda::cuda_reduce_deterministic;
+using policy::cuda::cuda_reduce_tuned;
 
 using policy::cuda::cuda_block_reduce;
 using policy::cuda::cuda_warp_reduce;
@@ -26,6 +26,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include <type_traits>
+#include <vector>
 
 #include <cuda.h>
 
@@ -87,6 +88,27 @@ struct cuda_atomic_available {
       std::is_same<T, float>::value || std::is_same<T, double>::value;
 };
 
+//! whether an atomic version of the Combiner exists for its value type
+template <typename Combiner>
+struct atomic_combiner_available {
+  static constexpr const bool value = false;
+};
+
+template <typename T>
+struct atomic_combiner_available<sum<T>> {
+  static constexpr const bool value = cuda_atomic_available<T>::value;
+};
+
+template <typename T>
+struct atomic_combiner_available<min<T>> {
+  static constexpr const bool value = cuda_atomic_available<T>::value;
+};
+
+template <typename T>
+struct atomic_combiner_available<max<T>> {
+  static constexpr const bool value = cuda_atomic_available<T>::value;
+};
+
 }  // namespace cuda
 
 }  // namespace reduce
@@ -335,6 +357,16 @@ RAJA_DEVICE RAJA_INLINE float shfl_sync<float>(float var, int srcLane)
 
 #endif
 
+//! warp vote returning a bit per lane that passed a non-zero predicate
+RAJA_DEVICE RAJA_INLINE unsigned int ballot_sync(int pred)
+{
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 9000
+  return ::__ballot_sync(0xffffffffu, pred);
+#else
+  return ::__ballot(pred);
+#endif
+}
+
 //! reduce values in block into thread 0
 template <typename Combiner, typename T>
 RAJA_DEVICE RAJA_INLINE T warp_reduce(T val, T RAJA_UNUSED_ARG(identity))
@@ -444,6 +476,135 @@ RAJA_DEVICE RAJA_INLINE T block_reduce(T val, T identity)
 }
 
 
+//! map a combiner over value-location pairs to one over values alone
+//  only min and max are meaningful for loc reductions
+template <typename Combiner>
+struct LocValueCombiner;
+
+template <typename T, typename IndexType, bool doing_min>
+struct LocValueCombiner<
+    RAJA::reduce::min<RAJA::reduce::detail::ValueLoc<T, IndexType, doing_min>>> {
+  using type = RAJA::reduce::min<T>;
+};
+
+template <typename T, typename IndexType, bool doing_min>
+struct LocValueCombiner<
+    RAJA::reduce::max<RAJA::reduce::detail::ValueLoc<T, IndexType, doing_min>>> {
+  using type = RAJA::reduce::max<T>;
+};
+
+//! reduce value-location pairs in block into thread 0
+//  The shuffle tree moves values only; the location is recovered afterward
+//  by pinpointing the winning lane with one ballot and fetching its
+//  location with a single shuffle per warp, rather than carrying the
+//  location through every tree step. This halves the shuffle traffic of
+//  loc reductions, whose payload is otherwise doubled by an index that
+//  only matters for the final winner.
+template <typename Combiner,
+          typename T,
+          typename IndexType,
+          bool doing_min,
+          typename ValueCombiner = typename LocValueCombiner<Combiner>::type>
+RAJA_DEVICE RAJA_INLINE RAJA::reduce::detail::ValueLoc<T, IndexType, doing_min>
+block_reduce(RAJA::reduce::detail::ValueLoc<T, IndexType, doing_min> val,
+             RAJA::reduce::detail::ValueLoc<T, IndexType, doing_min> identity)
+{
+  using value_loc = RAJA::reduce::detail::ValueLoc<T, IndexType, doing_min>;
+
+  int numThreads = blockDim.x * blockDim.y * blockDim.z;
+
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  int warpId = threadId % policy::cuda::WARP_SIZE;
+  int warpNum = threadId / policy::cuda::WARP_SIZE;
+
+  T temp_val = val.val;
+  T winner;
+
+  if (numThreads % policy::cuda::WARP_SIZE == 0) {
+
+    // reduce values in each warp; the butterfly pattern leaves the
+    // winning value in every lane
+    for (int i = 1; i < policy::cuda::WARP_SIZE; i *= 2) {
+      T rhs = shfl_xor_sync(temp_val, i);
+      ValueCombiner{}(temp_val, rhs);
+    }
+
+    winner = temp_val;
+
+  } else {
+
+    // reduce values in each warp
+    for (int i = 1; i < policy::cuda::WARP_SIZE; i *= 2) {
+      int srcLane = threadId ^ i;
+      T rhs = shfl_sync(temp_val, srcLane);
+      // only combine from threads that exist (don't double count own value)
+      if (srcLane < numThreads) {
+        ValueCombiner{}(temp_val, rhs);
+      }
+    }
+
+    // only lane 0 is guaranteed the full combine here, so broadcast it
+    winner = shfl_sync(temp_val, 0);
+  }
+
+  // pinpoint the first lane holding the winning value and fetch its
+  // location; ties resolve to the lowest lane
+  unsigned int winner_mask = ballot_sync(val.val == winner);
+  IndexType temp_loc =
+      shfl_sync(val.loc, __ffs(static_cast<int>(winner_mask)) - 1);
+
+  value_loc temp(winner, temp_loc);
+
+  // reduce per warp values
+  if (numThreads > policy::cuda::WARP_SIZE) {
+
+    // Need to separate declaration and initialization for clang-cuda
+    __shared__ unsigned char tmpsd[sizeof(RAJA::detail::SoAArray<value_loc, policy::cuda::MAX_WARPS>)];
+
+    // Partial placement new: Should call new(tmpsd) here but recasting memory
+    // to avoid calling constructor/destructor in shared memory.
+    RAJA::detail::SoAArray<value_loc, policy::cuda::MAX_WARPS> * sd = reinterpret_cast<RAJA::detail::SoAArray<value_loc, policy::cuda::MAX_WARPS> *>(tmpsd);
+
+    // write per warp values to shared memory
+    if (warpId == 0) {
+      sd->set(warpNum, temp);
+    }
+
+    __syncthreads();
+
+    if (warpNum == 0) {
+
+      // read per warp values; warp 0 is full since numThreads > WARP_SIZE
+      if (warpId * policy::cuda::WARP_SIZE < numThreads) {
+        temp = sd->get(warpId);
+      } else {
+        temp = identity;
+      }
+
+      // value-only tree across the per warp values, then pinpoint the
+      // winning warp's location the same way
+      temp_val = temp.val;
+      for (int i = 1; i < policy::cuda::WARP_SIZE; i *= 2) {
+        T rhs = shfl_xor_sync(temp_val, i);
+        ValueCombiner{}(temp_val, rhs);
+      }
+
+      winner_mask = ballot_sync(temp.val == temp_val);
+      temp_loc =
+          shfl_sync(temp.loc, __ffs(static_cast<int>(winner_mask)) - 1);
+
+      temp = value_loc(temp_val, temp_loc);
+    }
+
+    __syncthreads();
+  }
+
+  return temp;
+}
+
+
 //! reduce values in grid into thread 0 of last running block
 //  returns true if put reduced value in val
 template <typename Combiner, typename T, typename TempIterator>
@@ -499,6 +660,12 @@ RAJA_DEVICE RAJA_INLINE bool grid_reduce(T& val,
 
 
 //! reduce values in grid into thread 0 of last running block
+//  The block's values are pre-combined by block_reduce, so each block
+//  issues exactly one global atomic. device_mem[0] must hold identity
+//  on entry -- callers initialize it once at setup -- and the last
+//  block restores identity on its way out, so no per-block
+//  initialization handshake (atomicCAS plus spin) is needed in the
+//  kernel.
 //  returns true if put reduced value in val
 template <typename Combiner, typename T>
 RAJA_DEVICE RAJA_INLINE bool grid_reduce_atomic(T& val,
@@ -506,46 +673,150 @@ RAJA_DEVICE RAJA_INLINE bool grid_reduce_atomic(T& val,
                                                 T* device_mem,
                                                 unsigned int* device_count)
 {
-  int numBlocks = gridDim.x * gridDim.y * gridDim.z;
-  unsigned int wrap_around = numBlocks + 1;
+  unsigned int numBlocks = gridDim.x * gridDim.y * gridDim.z;
 
   int threadId = threadIdx.x + blockDim.x * threadIdx.y +
                  (blockDim.x * blockDim.y) * threadIdx.z;
 
-  // one thread in first block initializes device_mem
+  T temp = block_reduce<Combiner>(val, identity);
+
+  // one thread per block performs atomic on device_mem
+  bool lastBlock = false;
   if (threadId == 0) {
-    unsigned int old_val = ::atomicCAS(device_count, 0u, 1u);
-    if (old_val == 0u) {
+    RAJA::reduce::cuda::atomic<Combiner>{}(device_mem[0], temp);
+    __threadfence();
+    // increment counter, (wraps back to zero if old count == numBlocks - 1)
+    unsigned int old_count = ::atomicInc(device_count, numBlocks - 1);
+    lastBlock = (old_count == numBlocks - 1);
+
+    // last block gets value from device_mem and restores identity so the
+    // slot is ready for the next launch that reuses it
+    if (lastBlock) {
+      val = device_mem[0];
       device_mem[0] = identity;
       __threadfence();
-      ::atomicAdd(device_count, 1u);
     }
   }
 
+  return lastBlock;
+}
+
+
+//! reduce values in grid into thread 0 of the last finishing block of a
+//  two-level fan-in tree
+//  Every FAN_IN consecutive blocks form a group; the last finishing
+//  block of each group combines that group's per-block values into a
+//  per-group slot, and the last finishing group leader combines the
+//  per-group slots, so no single block folds more than FAN_IN entries
+//  (or one entry per group). device_mem holds the numBlocks per-block
+//  slots followed by the per-group slots; device_count holds the final
+//  counter followed by one counter per group.
+//  returns true if put reduced value in val
+template <typename Combiner, size_t FAN_IN, typename T, typename TempIterator>
+RAJA_DEVICE RAJA_INLINE bool grid_reduce_fanin(T& val,
+                                               T identity,
+                                               TempIterator device_mem,
+                                               unsigned int* device_count)
+{
+  int numBlocks = gridDim.x * gridDim.y * gridDim.z;
+  int numThreads = blockDim.x * blockDim.y * blockDim.z;
+  int numGroups =
+      (numBlocks + static_cast<int>(FAN_IN) - 1) / static_cast<int>(FAN_IN);
+
+  int blockId = blockIdx.x + gridDim.x * blockIdx.y +
+                (gridDim.x * gridDim.y) * blockIdx.z;
+
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  int group = blockId / static_cast<int>(FAN_IN);
+  int group_begin = group * static_cast<int>(FAN_IN);
+  int group_size = numBlocks - group_begin < static_cast<int>(FAN_IN)
+                       ? numBlocks - group_begin
+                       : static_cast<int>(FAN_IN);
+
   T temp = block_reduce<Combiner>(val, identity);
 
-  // one thread per block performs atomic on device_mem
-  bool lastBlock = false;
+  // one thread per block writes to this block's slot
+  bool lastInGroup = false;
   if (threadId == 0) {
-    // thread waits for device_mem to be initialized
-    while (static_cast<volatile unsigned int*>(device_count)[0] < 2u)
-      ;
-    __threadfence();
-    RAJA::reduce::cuda::atomic<Combiner>{}(device_mem[0], temp);
+    device_mem.set(blockId, temp);
+    // ensure write visible to all threadblocks
     __threadfence();
-    // increment counter, (wraps back to zero if old count == wrap_around)
-    unsigned int old_count = ::atomicInc(device_count, wrap_around);
-    lastBlock = (old_count == wrap_around);
+    unsigned int old_count =
+        ::atomicInc(&device_count[1 + group], group_size - 1);
+    lastInGroup = (old_count == static_cast<unsigned int>(group_size - 1));
+  }
+
+  // returns non-zero value if any thread passes in a non-zero value
+  lastInGroup = __syncthreads_or(lastInGroup);
+
+  // last block of each group combines the group's per-block values
+  bool lastBlock = false;
+  if (lastInGroup) {
+    temp = identity;
+
+    for (int i = group_begin + threadId; i < group_begin + group_size;
+         i += numThreads) {
+      Combiner{}(temp, device_mem.get(i));
+    }
+
+    temp = block_reduce<Combiner>(temp, identity);
+
+    if (threadId == 0) {
+      device_mem.set(numBlocks + group, temp);
+      __threadfence();
+      unsigned int old_count = ::atomicInc(device_count, numGroups - 1);
+      lastBlock = (old_count == static_cast<unsigned int>(numGroups - 1));
+    }
+
+    lastBlock = __syncthreads_or(lastBlock);
 
-    // last block gets value from device_mem
+    // last finishing group leader combines the per-group values
     if (lastBlock) {
-      val = device_mem[0];
+      temp = identity;
+
+      for (int i = threadId; i < numGroups; i += numThreads) {
+        Combiner{}(temp, device_mem.get(numBlocks + i));
+      }
+
+      temp = block_reduce<Combiner>(temp, identity);
+
+      // one thread returns value
+      if (threadId == 0) {
+        val = temp;
+      }
     }
   }
 
-  return lastBlock;
+  return lastBlock && threadId == 0;
 }
 
+
+//! compile-time guarded atomic accumulation tail
+//  the false specialization is selected for combiners without a device
+//  atomic, whose launch-time topology choice never takes the atomic
+//  path, and avoids instantiating reduce::cuda::atomic for them
+template <typename Combiner, typename T, bool atomic_ok>
+struct AtomicTail {
+  static RAJA_DEVICE RAJA_INLINE bool run(T& val,
+                                          T identity,
+                                          T* device_mem,
+                                          unsigned int* device_count)
+  {
+    return grid_reduce_atomic<Combiner>(val, identity, device_mem,
+                                        device_count);
+  }
+};
+
+template <typename Combiner, typename T>
+struct AtomicTail<Combiner, T, false> {
+  static RAJA_DEVICE RAJA_INLINE bool run(T&, T, T*, unsigned int*)
+  {
+    return false;
+  }
+};
+
 }  // namespace impl
 
 //! Object that manages pinned memory buffers for reduction results
@@ -649,7 +920,7 @@ public:
     Node* m_n;
   };
 
-  PinnedTally() : stream_list(nullptr) {}
+  PinnedTally() : stream_list(nullptr), free_node_list(nullptr) {}
 
   PinnedTally(const PinnedTally&) = delete;
 
@@ -671,9 +942,7 @@ public:
   //! get new value for use in stream
   T* new_value(cudaStream_t stream)
   {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    lock_guard<RAJA::mutex> lock(m_mutex);
     StreamNode* sn = stream_list;
     while (sn) {
       if (sn->stream == stream) break;
@@ -686,7 +955,13 @@ public:
       sn->node_list = nullptr;
       stream_list = sn;
     }
-    Node* n = cuda::pinned_mempool_type::getInstance().template malloc<Node>(1);
+    Node* n;
+    if (free_node_list) {
+      n = free_node_list;
+      free_node_list = n->next;
+    } else {
+      n = cuda::pinned_mempool_type::getInstance().template malloc<Node>(1);
+    }
     n->next = sn->node_list;
     sn->node_list = n;
     return &n->value;
@@ -701,16 +976,45 @@ public:
     }
   }
 
-  //! all values used in all streams
-  void free_list()
+  //! query all streams used without blocking
+  //  returns true if every pinned value written by a grid reduce has landed
+  bool query_streams()
   {
-    while (stream_list) {
-      StreamNode* s = stream_list;
+    auto end = streamEnd();
+    for (auto s = streamBegin(); s != end; ++s) {
+      if (!query(*s)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! move all values to the free pool for reuse by later launches,
+  //  keeping stream records; avoids pinned mempool traffic when the same
+  //  tally is reused across invocations
+  void release_values()
+  {
+    for (StreamNode* s = stream_list; s; s = s->next) {
       while (s->node_list) {
         Node* n = s->node_list;
         s->node_list = n->next;
-        cuda::pinned_mempool_type::getInstance().free(n);
+        n->next = free_node_list;
+        free_node_list = n;
       }
+    }
+  }
+
+  //! all values used in all streams
+  void free_list()
+  {
+    release_values();
+    while (free_node_list) {
+      Node* n = free_node_list;
+      free_node_list = n->next;
+      cuda::pinned_mempool_type::getInstance().free(n);
+    }
+    while (stream_list) {
+      StreamNode* s = stream_list;
       stream_list = s->next;
       free(s);
     }
@@ -718,12 +1022,122 @@ public:
 
   ~PinnedTally() { free_list(); }
 
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  omp::mutex m_mutex;
-#endif
+  RAJA::mutex m_mutex;
 
 private:
   StreamNode* stream_list;
+
+  Node* free_node_list;
+};
+
+//! Cache of PinnedTally objects, one per value type, that survives
+//  reducer object lifetime. Reducers acquire a tally on construction and
+//  return it, with its stream records and pinned value buffers intact, on
+//  destruction, so constructing a reducer inside a per-timestep scope is
+//  allocation-free after the first step.
+template <typename T>
+class PinnedTallyCache
+{
+public:
+  static PinnedTallyCache& getInstance()
+  {
+    static PinnedTallyCache cache;
+    return cache;
+  }
+
+  //! get a cached tally, or a new one if none is available
+  PinnedTally<T>* acquire()
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+    if (!m_tally_list.empty()) {
+      PinnedTally<T>* tally = m_tally_list.back();
+      m_tally_list.pop_back();
+      return tally;
+    }
+    return new PinnedTally<T>;
+  }
+
+  //! return a tally for reuse; its values move to the tally's free pool
+  void release(PinnedTally<T>* tally)
+  {
+    tally->release_values();
+    lock_guard<RAJA::mutex> lock(m_mutex);
+    m_tally_list.push_back(tally);
+  }
+
+private:
+  PinnedTallyCache() = default;
+
+  ~PinnedTallyCache()
+  {
+    for (PinnedTally<T>* tally : m_tally_list) {
+      delete tally;
+    }
+  }
+
+  RAJA::mutex m_mutex;
+
+  std::vector<PinnedTally<T>*> m_tally_list;
+};
+
+//! Kernel that folds per-launch tally values into a device-resident result.
+//  The tally values live in pinned memory, which is device-visible, so
+//  vals holds their addresses and no copy to device memory is needed.
+template <typename Combiner, typename T>
+__global__ void device_value_fold(T init_val,
+                                  T* const* vals,
+                                  int num_vals,
+                                  T* device_result)
+{
+  T temp = init_val;
+  for (int i = 0; i < num_vals; ++i) {
+    Combiner{}(temp, *vals[i]);
+  }
+  *device_result = temp;
+}
+
+//! Handle owning a device-resident copy of a reducer's final value.
+//  device_ptr() is consumable by kernels launched on the resource the
+//  value was produced on, or any stream ordered after it, without a
+//  host round trip. The handle returns its buffers to the mempools on
+//  destruction; destroy it only after the consuming work is done.
+template <typename T>
+class DeviceValue
+{
+public:
+  DeviceValue() = delete;
+
+  DeviceValue(T* device_val, T** pinned_ptrs)
+      : m_device_val(device_val), m_pinned_ptrs(pinned_ptrs)
+  {
+  }
+
+  DeviceValue(DeviceValue const&) = delete;
+  DeviceValue& operator=(DeviceValue const&) = delete;
+
+  DeviceValue(DeviceValue&& other)
+      : m_device_val(other.m_device_val), m_pinned_ptrs(other.m_pinned_ptrs)
+  {
+    other.m_device_val = nullptr;
+    other.m_pinned_ptrs = nullptr;
+  }
+
+  ~DeviceValue()
+  {
+    if (m_device_val) {
+      device_mempool_type::getInstance().free(m_device_val);
+    }
+    if (m_pinned_ptrs) {
+      pinned_mempool_type::getInstance().free(m_pinned_ptrs);
+    }
+  }
+
+  //! device pointer to the final value
+  T* device_ptr() const { return m_device_val; }
+
+private:
+  T* m_device_val;
+  T** m_pinned_ptrs;
 };
 
 //
@@ -744,6 +1158,7 @@ struct Reduce_Data {
   unsigned int* device_count;
   RAJA::detail::SoAPtr<T, device_mempool_type> device;
   bool own_device_ptr;
+  bool batch_combine;
 
   Reduce_Data() : Reduce_Data(T(), T()){};
 
@@ -757,7 +1172,8 @@ struct Reduce_Data {
         identity{identity_},
         device_count{nullptr},
         device{},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        batch_combine{false}
   {
   }
 
@@ -767,6 +1183,7 @@ struct Reduce_Data {
     identity = identity_;
     device_count = nullptr;
     own_device_ptr = false;
+    batch_combine = false;
   }
 
   RAJA_HOST_DEVICE
@@ -775,7 +1192,8 @@ struct Reduce_Data {
         identity{other.identity},
         device_count{other.device_count},
         device{other.device},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        batch_combine{other.batch_combine}
   {
   }
 
@@ -784,13 +1202,19 @@ struct Reduce_Data {
   void init_grid_val(T* output) { *output = identity; }
 
   //! reduce values in grid to single value, store in output
+  //  inside an accumulation window the output slot is shared by the
+  //  window's stream-ordered launches, so fold into it instead of storing
   RAJA_DEVICE
   void grid_reduce(T* output)
   {
     T temp = value;
 
     if (impl::grid_reduce<Combiner>(temp, identity, device, device_count)) {
-      *output = temp;
+      if (batch_combine) {
+        Combiner{}(*output, temp);
+      } else {
+        *output = temp;
+      }
     }
   }
 
@@ -835,6 +1259,7 @@ struct ReduceAtomic_Data {
   unsigned int* device_count;
   T* device;
   bool own_device_ptr;
+  bool batch_combine;
 
   ReduceAtomic_Data() : ReduceAtomic_Data(T(), T()){};
 
@@ -843,7 +1268,8 @@ struct ReduceAtomic_Data {
         identity{identity_},
         device_count{nullptr},
         device{nullptr},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        batch_combine{false}
   {
   }
 
@@ -854,6 +1280,7 @@ struct ReduceAtomic_Data {
     device_count = nullptr;
     device = nullptr;
     own_device_ptr = false;
+    batch_combine = false;
   }
 
   RAJA_HOST_DEVICE
@@ -862,7 +1289,8 @@ struct ReduceAtomic_Data {
         identity{other.identity},
         device_count{other.device_count},
         device{other.device},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        batch_combine{other.batch_combine}
   {
   }
 
@@ -871,6 +1299,8 @@ struct ReduceAtomic_Data {
   void init_grid_val(T* output) { *output = identity; }
 
   //! reduce values in grid to single value, store in output
+  //  inside an accumulation window the output slot is shared by the
+  //  window's stream-ordered launches, so fold into it instead of storing
   RAJA_DEVICE
   void grid_reduce(T* output)
   {
@@ -878,7 +1308,11 @@ struct ReduceAtomic_Data {
 
     if (impl::grid_reduce_atomic<Combiner>(
             temp, identity, device, device_count)) {
-      *output = temp;
+      if (batch_combine) {
+        Combiner{}(*output, temp);
+      } else {
+        *output = temp;
+      }
     }
   }
 
@@ -889,6 +1323,11 @@ struct ReduceAtomic_Data {
     bool act = !device && setupReducers();
     if (act) {
       device = device_mempool_type::getInstance().template malloc<T>(1);
+      // grid_reduce_atomic expects the slot to hold identity on entry;
+      // paying for the copy once here keeps the per-block initialization
+      // handshake out of the kernel
+      cudaErrchk(cudaMemcpy(
+          device, &identity, sizeof(T), cudaMemcpyHostToDevice));
       device_count = device_zeroed_mempool_type::getInstance()
                          .template malloc<unsigned int>(1);
       own_device_ptr = true;
@@ -912,26 +1351,231 @@ struct ReduceAtomic_Data {
   }
 };
 
-//! Cuda Reduction entity -- generalize on reduction, and type
-template <typename Combiner, typename T, bool maybe_atomic>
-class Reduce
-{
-public:
-  Reduce() : Reduce(T(), Combiner::identity()) {}
+//! Reduction data for Cuda Offload with a launch-selected grid combine:
+//  grids of at most ATOMIC_MAX_BLOCKS blocks accumulate into a single
+//  device slot with one atomic per block, larger grids combine through
+//  a FAN_IN-way two-level tree (see cuda_reduce_tuned)
+template <typename Combiner,
+          typename T,
+          size_t ATOMIC_MAX_BLOCKS,
+          size_t FAN_IN>
+struct ReduceTuned_Data {
 
-  //! create a reduce object
-  //  the original object's parent is itself
-  explicit Reduce(T init_val, T identity_ = Combiner::identity())
-      : parent{this},
-        tally_or_val_ptr{new PinnedTally<T>},
-        val(init_val, identity_)
+  static constexpr const bool atomic_ok =
+      RAJA::reduce::cuda::atomic_combiner_available<Combiner>::value;
+
+  mutable T value;
+  T identity;
+  unsigned int* device_count;
+  RAJA::detail::SoAPtr<T, device_mempool_type> device;
+  T* device_atomic;
+  bool use_atomic;
+  bool own_device_ptr;
+  bool batch_combine;
+
+  ReduceTuned_Data() : ReduceTuned_Data(T(), T()){};
+
+  ReduceTuned_Data(T initValue, T identity_)
+      : value{initValue},
+        identity{identity_},
+        device_count{nullptr},
+        device{},
+        device_atomic{nullptr},
+        use_atomic{false},
+        own_device_ptr{false},
+        batch_combine{false}
   {
   }
 
-  void reset(T in_val, T identity_ = Combiner::identity())
+  void reset(T initValue, T identity_ = T())
+  {
+    value = initValue;
+    identity = identity_;
+    device_count = nullptr;
+    device_atomic = nullptr;
+    use_atomic = false;
+    own_device_ptr = false;
+    batch_combine = false;
+  }
+
+  RAJA_HOST_DEVICE
+  ReduceTuned_Data(const ReduceTuned_Data& other)
+      : value{other.identity},
+        identity{other.identity},
+        device_count{other.device_count},
+        device{other.device},
+        device_atomic{other.device_atomic},
+        use_atomic{other.use_atomic},
+        own_device_ptr{false},
+        batch_combine{other.batch_combine}
+  {
+  }
+
+  //! initialize output to identity to ensure never read
+  //  uninitialized memory
+  void init_grid_val(T* output) { *output = identity; }
+
+  //! reduce values in grid to single value, store in output
+  //  inside an accumulation window the output slot is shared by the
+  //  window's stream-ordered launches, so fold into it instead of storing
+  RAJA_DEVICE
+  void grid_reduce(T* output)
+  {
+    T temp = value;
+
+    bool done =
+        use_atomic
+            ? impl::AtomicTail<Combiner, T, atomic_ok>::run(
+                  temp, identity, device_atomic, device_count)
+            : impl::grid_reduce_fanin<Combiner, FAN_IN>(
+                  temp, identity, device, device_count);
+
+    if (done) {
+      if (batch_combine) {
+        Combiner{}(*output, temp);
+      } else {
+        *output = temp;
+      }
+    }
+  }
+
+  //! check and setup for device
+  //  pick the grid-combine topology from this launch's grid size, then
+  //  allocate the device memory that topology needs
+  bool setupForDevice()
+  {
+    bool act = !device.allocated() && !device_atomic && setupReducers();
+    if (act) {
+      cuda_dim_t gridDim = currentGridDim();
+      size_t numBlocks = gridDim.x * gridDim.y * gridDim.z;
+      use_atomic = atomic_ok && numBlocks <= ATOMIC_MAX_BLOCKS;
+      if (use_atomic) {
+        device_atomic = device_mempool_type::getInstance().template malloc<T>(1);
+        // grid_reduce_atomic expects the slot to hold identity on entry
+        cudaErrchk(cudaMemcpy(
+            device_atomic, &identity, sizeof(T), cudaMemcpyHostToDevice));
+        device_count = device_zeroed_mempool_type::getInstance()
+                           .template malloc<unsigned int>(1);
+      } else {
+        size_t numGroups = (numBlocks + FAN_IN - 1) / FAN_IN;
+        device.allocate(numBlocks + numGroups);
+        device_count = device_zeroed_mempool_type::getInstance()
+                           .template malloc<unsigned int>(1 + numGroups);
+      }
+      own_device_ptr = true;
+    }
+    return act;
+  }
+
+  //! if own resources teardown device setup
+  //  free device pointers
+  bool teardownForDevice()
+  {
+    bool act = own_device_ptr;
+    if (act) {
+      if (device.allocated()) {
+        device.deallocate();
+      }
+      if (device_atomic) {
+        device_mempool_type::getInstance().free(device_atomic);
+        device_atomic = nullptr;
+      }
+      device_zeroed_mempool_type::getInstance().free(device_count);
+      device_count = nullptr;
+      use_atomic = false;
+      own_device_ptr = false;
+    }
+    return act;
+  }
+};
+
+//! Future-style handle to a reducer's final value.
+//  The final per-launch values are written into pinned memory on each
+//  kernel's stream by the grid reduce, so the handle can be polled with
+//  test() without stalling any stream; get() (or conversion to T) performs
+//  the final combine, synchronizing only the streams the reducer actually
+//  used and only at the point the value is truly consumed.
+template <typename Reducer, typename T>
+class AsyncValue
+{
+public:
+  AsyncValue() = delete;
+
+  explicit AsyncValue(Reducer* reducer) : m_reducer(reducer) {}
+
+  //! nonblocking check that all device contributions have landed
+  bool test() const { return m_reducer->test(); }
+
+  //! block (stream-scoped) until available and return the combined value
+  T get() { return m_reducer->get(); }
+
+  //! alias for get()
+  operator T() { return get(); }
+
+private:
+  Reducer* m_reducer;
+};
+
+//! Cuda Reduction entity -- generalize on reduction, and type
+//  reduce_data_t selects the grid-combine data storage class; the
+//  default picks the atomic variant when the policy allows it and the
+//  type supports device atomics
+template <typename Combiner,
+          typename T,
+          bool maybe_atomic,
+          typename reduce_data_t = typename std::conditional<
+              maybe_atomic &&
+                  RAJA::reduce::cuda::cuda_atomic_available<T>::value,
+              cuda::ReduceAtomic_Data<Combiner, T>,
+              cuda::Reduce_Data<Combiner, T>>::type>
+class Reduce
+{
+public:
+  Reduce() : Reduce(T(), Combiner::identity()) {}
+
+  //! create a reduce object
+  //  the original object's parent is itself
+  explicit Reduce(T init_val, T identity_ = Combiner::identity())
+      : parent{this},
+        tally_or_val_ptr{PinnedTallyCache<T>::getInstance().acquire()},
+        val(init_val, identity_),
+        batch_open{false},
+        batch_val_ptr{nullptr},
+        batch_stream{0},
+        split_pending{false},
+        split_result{nullptr},
+        split_ptrs{nullptr}
+  {
+  }
+
+  //! reset the reducer for reuse without reallocation
+  //  combines and releases outstanding tally values, then re-initializes
+  //  in place; the tally and device memory stay cached for the next launch
+  void reset(T in_val, T identity_ = Combiner::identity())
   {
     operator T();  // syncs device
-    val = reduce_data_type(in_val, identity_);
+    val.reset(in_val, identity_);
+  }
+
+  //! open an accumulation window spanning several kernel launches
+  //  launches made before the matching end_batch() fold into one shared
+  //  tally slot per stream instead of taking a fresh slot apiece, so a
+  //  residual norm accumulated across many foralls pays for one slot and
+  //  one combine at get() rather than one per launch; callable only from
+  //  the host on the original object
+  void begin_batch()
+  {
+    batch_open = true;
+    batch_val_ptr = nullptr;
+  }
+
+  //! close an accumulation window opened with begin_batch()
+  //  the shared slot stays in the tally until get() performs the single
+  //  deferred finalization for the whole window
+  void end_batch()
+  {
+    batch_open = false;
+    batch_val_ptr = nullptr;
   }
 
   //! copy and on host attempt to setup for device
@@ -945,14 +1589,35 @@ public:
       : parent{&other},
 #endif
         tally_or_val_ptr{other.tally_or_val_ptr},
-        val(other.val)
+        val(other.val),
+        batch_open{other.batch_open},
+        batch_val_ptr{nullptr},
+        batch_stream{0},
+        split_pending{false},
+        split_result{nullptr},
+        split_ptrs{nullptr}
   {
 #if !defined(RAJA_DEVICE_CODE)
     if (parent) {
       if (val.setupForDevice()) {
-        tally_or_val_ptr.val_ptr =
-            tally_or_val_ptr.list->new_value(currentStream());
-        val.init_grid_val(tally_or_val_ptr.val_ptr);
+        if (parent->batch_open) {
+          // reuse the window's shared slot for this stream; kernels on a
+          // stream are ordered, so the launch's grid reduce may fold into
+          // the slot in place
+          cudaStream_t stream = currentStream();
+          if (parent->batch_val_ptr == nullptr ||
+              parent->batch_stream != stream) {
+            parent->batch_val_ptr = tally_or_val_ptr.list->new_value(stream);
+            parent->batch_stream = stream;
+            val.init_grid_val(parent->batch_val_ptr);
+          }
+          tally_or_val_ptr.val_ptr = parent->batch_val_ptr;
+          val.batch_combine = true;
+        } else {
+          tally_or_val_ptr.val_ptr =
+              tally_or_val_ptr.list->new_value(currentStream());
+          val.init_grid_val(tally_or_val_ptr.val_ptr);
+        }
         parent = nullptr;
       }
     }
@@ -966,13 +1631,19 @@ public:
   {
 #if !defined(RAJA_DEVICE_CODE)
     if (parent == this) {
-      delete tally_or_val_ptr.list;
+      if (split_pending) {
+        // an unconsumed start_get(): let its fold finish before the
+        // tally and pinned buffers go back to their pools
+        cudaErrchk(cudaEventSynchronize(split_event));
+        cudaErrchk(cudaEventDestroy(split_event));
+        pinned_mempool_type::getInstance().free(split_result);
+        pinned_mempool_type::getInstance().free(split_ptrs);
+      }
+      PinnedTallyCache<T>::getInstance().release(tally_or_val_ptr.list);
       tally_or_val_ptr.list = nullptr;
     } else if (parent) {
       if (val.value != val.identity) {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-        lock_guard<omp::mutex> lock(tally_or_val_ptr.list->m_mutex);
-#endif
+        lock_guard<RAJA::mutex> lock(tally_or_val_ptr.list->m_mutex);
         parent->combine(val.value);
       }
     } else {
@@ -999,13 +1670,175 @@ public:
       for (; n != end; ++n) {
         Combiner{}(val.value, *n);
       }
-      tally_or_val_ptr.list->free_list();
+      tally_or_val_ptr.list->release_values();
+      batch_val_ptr = nullptr;
     }
     return val.value;
   }
   //! alias for operator T()
   T get() { return operator T(); }
 
+  //! nonblocking query whether all device contributions have been written
+  //  to the pinned tally; callable only from the host on the original object
+  bool test() { return tally_or_val_ptr.list->query_streams(); }
+
+  //! future-style handle to the final value; reading the handle performs
+  //  the final combine, synchronizing only this reducer's streams and only
+  //  when the value is consumed, so chained reductions do not serialize a
+  //  stream pipeline behind a device-wide sync
+  AsyncValue<Reduce, T> get_async() { return AsyncValue<Reduce, T>(this); }
+
+  //! produce a device-resident copy of the final value on the given
+  //  resource without a host round trip. The resource's stream is ordered
+  //  behind every stream this reducer launched on, then a single-thread
+  //  kernel folds the pinned per-launch values together with the host-side
+  //  value into device memory. The returned handle's device_ptr() may be
+  //  consumed directly by subsequent kernels on the same resource. Host
+  //  combines made after this call are not reflected in the device value.
+  template <typename Resource>
+  DeviceValue<T> get_device(Resource& res)
+  {
+    cudaStream_t stream = res.get_stream();
+
+    // order the consuming stream behind each stream with outstanding
+    // per-launch values, without stalling the host
+    auto s_end = tally_or_val_ptr.list->streamEnd();
+    for (auto s = tally_or_val_ptr.list->streamBegin(); s != s_end; ++s) {
+      if (*s != stream) {
+        cudaEvent_t event;
+        cudaErrchk(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+        cudaErrchk(cudaEventRecord(event, *s));
+        cudaErrchk(cudaStreamWaitEvent(stream, event, 0));
+        cudaErrchk(cudaEventDestroy(event));
+      }
+    }
+
+    // gather device-visible addresses of the pinned per-launch values;
+    // the values themselves are never read on the host here
+    int num_vals = 0;
+    auto n_end = tally_or_val_ptr.list->end();
+    for (auto n = tally_or_val_ptr.list->begin(); n != n_end; ++n) {
+      ++num_vals;
+    }
+    T** ptrs = pinned_mempool_type::getInstance().template malloc<T*>(
+        num_vals > 0 ? num_vals : 1);
+    int iv = 0;
+    for (auto n = tally_or_val_ptr.list->begin(); n != n_end; ++n) {
+      ptrs[iv++] = &(*n);
+    }
+
+    T* device_val = device_mempool_type::getInstance().template malloc<T>(1);
+    device_value_fold<Combiner><<<1, 1, 0, stream>>>(val.value, ptrs,
+                                                     num_vals, device_val);
+    cudaErrchk(cudaPeekAtLastError());
+
+    return DeviceValue<T>(device_val, ptrs);
+  }
+
+  //! split-phase get, first half: enqueue the final combine into pinned
+  //  memory on the given resource and return immediately. The resource's
+  //  stream is ordered behind every stream this reducer launched on, the
+  //  single-thread fold kernel writes the combined value into a pinned
+  //  slot, and an event marks its completion; the host does not stall.
+  //  Work launched between start_get() and finish_get() -- the next
+  //  kernel of a pipelined Krylov iteration, posting the MPI allreduce
+  //  once finish_get() returns -- overlaps the device combine. Host
+  //  combines made after this call are not reflected in the result.
+  template <typename Resource>
+  void start_get(Resource& res)
+  {
+    if (split_pending) {
+      finish_get();
+    }
+
+    cudaStream_t stream = res.get_stream();
+
+    // order the combining stream behind each stream with outstanding
+    // per-launch values, without stalling the host
+    auto s_end = tally_or_val_ptr.list->streamEnd();
+    for (auto s = tally_or_val_ptr.list->streamBegin(); s != s_end; ++s) {
+      if (*s != stream) {
+        cudaEvent_t event;
+        cudaErrchk(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+        cudaErrchk(cudaEventRecord(event, *s));
+        cudaErrchk(cudaStreamWaitEvent(stream, event, 0));
+        cudaErrchk(cudaEventDestroy(event));
+      }
+    }
+
+    // gather device-visible addresses of the pinned per-launch values
+    int num_vals = 0;
+    auto n_end = tally_or_val_ptr.list->end();
+    for (auto n = tally_or_val_ptr.list->begin(); n != n_end; ++n) {
+      ++num_vals;
+    }
+    split_ptrs = pinned_mempool_type::getInstance().template malloc<T*>(
+        num_vals > 0 ? num_vals : 1);
+    int iv = 0;
+    for (auto n = tally_or_val_ptr.list->begin(); n != n_end; ++n) {
+      split_ptrs[iv++] = &(*n);
+    }
+
+    split_result = pinned_mempool_type::getInstance().template malloc<T>(1);
+    device_value_fold<Combiner><<<1, 1, 0, stream>>>(val.value, split_ptrs,
+                                                     num_vals, split_result);
+    cudaErrchk(cudaPeekAtLastError());
+
+    cudaErrchk(cudaEventCreateWithFlags(&split_event,
+                                        cudaEventDisableTiming));
+    cudaErrchk(cudaEventRecord(split_event, stream));
+    split_pending = true;
+  }
+
+  //! nonblocking check whether the combine enqueued by start_get() has
+  //  completed, so the consumer can keep issuing work until the value
+  //  is truly needed
+  bool finish_ready()
+  {
+    if (!split_pending) {
+      return true;
+    }
+    cudaError_t err = cudaEventQuery(split_event);
+    if (err == cudaSuccess) {
+      return true;
+    } else if (err == cudaErrorNotReady) {
+      // swallow the not-ready sticky error so it is not picked up later
+      cudaGetLastError();
+      return false;
+    } else {
+      cudaErrchk(err);
+      return false;
+    }
+  }
+
+  //! split-phase get, second half: wait for the combine enqueued by
+  //  start_get() -- stalling only on its event, not the device -- and
+  //  return the final value. Without a start_get() outstanding this is
+  //  plain get().
+  T finish_get()
+  {
+    if (!split_pending) {
+      return operator T();
+    }
+
+    cudaErrchk(cudaEventSynchronize(split_event));
+    cudaErrchk(cudaEventDestroy(split_event));
+
+    // the fold consumed the per-launch values, so absorb its result and
+    // retire them; later get() calls see the same combined value
+    val.value = *split_result;
+    tally_or_val_ptr.list->release_values();
+    batch_val_ptr = nullptr;
+
+    pinned_mempool_type::getInstance().free(split_result);
+    split_result = nullptr;
+    pinned_mempool_type::getInstance().free(split_ptrs);
+    split_ptrs = nullptr;
+    split_pending = false;
+
+    return val.value;
+  }
+
   //! apply reduction (const version) -- still combines internal values
   RAJA_HOST_DEVICE
   void combine(T other) const { Combiner{}(val.value, other); }
@@ -1032,13 +1865,23 @@ private:
   tally_u tally_or_val_ptr;
 
   //! cuda reduction data storage class and folding algorithm
-  using reduce_data_type = typename std::conditional<
-      maybe_atomic && RAJA::reduce::cuda::cuda_atomic_available<T>::value,
-      cuda::ReduceAtomic_Data<Combiner, T>,
-      cuda::Reduce_Data<Combiner, T>>::type;
+  using reduce_data_type = reduce_data_t;
 
   //! storage for reduction data
   reduce_data_type val;
+
+  //! accumulation window state, written through the original object's
+  //  parent pointer while capturing copies set up for launch
+  bool batch_open;
+  mutable T* batch_val_ptr;
+  mutable cudaStream_t batch_stream;
+
+  //! split-phase get state, live between start_get() and finish_get()
+  //  on the original object
+  bool split_pending;
+  T* split_result;
+  T** split_ptrs;
+  cudaEvent_t split_event;
 };
 
 }  // end namespace cuda
@@ -1061,6 +1904,50 @@ public:
   }
 };
 
+#if defined(RAJA_CUDA_HAS_HALF)
+//! specialization of ReduceSum for cuda_reduce and __half
+//  accumulates in float so long sums do not lose mantissa bits: the
+//  tally storage, block and grid reductions, and atomics all run at
+//  float precision, and contributions convert at the += boundary
+template <bool maybe_atomic>
+class ReduceSum<cuda_reduce_base<maybe_atomic>, __half>
+    : public cuda::Reduce<RAJA::reduce::sum<float>, float, maybe_atomic>
+{
+
+public:
+  using Base = cuda::Reduce<RAJA::reduce::sum<float>, float, maybe_atomic>;
+  using Base::Base;
+  //! enable operator+= for ReduceSum -- alias for combine()
+  RAJA_HOST_DEVICE
+  const ReduceSum& operator+=(__half rhs) const
+  {
+    this->combine(static_cast<float>(rhs));
+    return *this;
+  }
+};
+#endif
+
+#if defined(RAJA_CUDA_HAS_BFLOAT16)
+//! specialization of ReduceSum for cuda_reduce and __nv_bfloat16
+//  accumulates in float, like the __half specialization above
+template <bool maybe_atomic>
+class ReduceSum<cuda_reduce_base<maybe_atomic>, __nv_bfloat16>
+    : public cuda::Reduce<RAJA::reduce::sum<float>, float, maybe_atomic>
+{
+
+public:
+  using Base = cuda::Reduce<RAJA::reduce::sum<float>, float, maybe_atomic>;
+  using Base::Base;
+  //! enable operator+= for ReduceSum -- alias for combine()
+  RAJA_HOST_DEVICE
+  const ReduceSum& operator+=(__nv_bfloat16 rhs) const
+  {
+    this->combine(static_cast<float>(rhs));
+    return *this;
+  }
+};
+#endif
+
 //! specialization of ReduceBitOr for cuda_reduce
 template <bool maybe_atomic, typename T>
 class ReduceBitOr<cuda_reduce_base<maybe_atomic>, T>
@@ -1152,6 +2039,13 @@ public:
       : Base(value_type(init_val, init_idx))
   {
   }
+  //! reset the reducer with a new value and location, reusing its memory
+  void reset(T init_val,
+             IndexType init_idx =
+                 RAJA::reduce::detail::DefaultLoc<IndexType>().value())
+  {
+    Base::reset(value_type(init_val, init_idx));
+  }
   //! reducer function; updates the current instance's state
   RAJA_HOST_DEVICE
   const ReduceMinLoc& minloc(T rhs, IndexType loc) const
@@ -1189,6 +2083,236 @@ public:
       : Base(value_type(init_val, init_idx))
   {
   }
+  //! reset the reducer with a new value and location, reusing its memory
+  void reset(T init_val,
+             IndexType init_idx =
+                 RAJA::reduce::detail::DefaultLoc<IndexType>().value())
+  {
+    Base::reset(value_type(init_val, init_idx));
+  }
+  //! reducer function; updates the current instance's state
+  RAJA_HOST_DEVICE
+  const ReduceMaxLoc& maxloc(T rhs, IndexType loc) const
+  {
+    this->combine(value_type(rhs, loc));
+    return *this;
+  }
+
+  //! Get the calculated reduced value
+  IndexType getLoc() { return Base::get().getLoc(); }
+
+  //! Get the calculated reduced value
+  operator T() { return Base::get(); }
+
+  //! Get the calculated reduced value
+  T get() { return Base::get(); }
+};
+
+//! reduction data storage matching the cuda_reduce_tuned policy
+//  parameters; shorthand for the tuned reducer specializations below
+template <typename Combiner,
+          typename T,
+          size_t ATOMIC_MAX_BLOCKS,
+          size_t FAN_IN>
+using cuda_tuned_reduce_t = cuda::Reduce<
+    Combiner,
+    T,
+    true,
+    cuda::ReduceTuned_Data<Combiner, T, ATOMIC_MAX_BLOCKS, FAN_IN>>;
+
+//! specialization of ReduceSum for cuda_reduce_tuned
+template <size_t ATOMIC_MAX_BLOCKS, size_t FAN_IN, typename T>
+class ReduceSum<cuda_reduce_tuned<ATOMIC_MAX_BLOCKS, FAN_IN>, T>
+    : public cuda_tuned_reduce_t<RAJA::reduce::sum<T>,
+                                 T,
+                                 ATOMIC_MAX_BLOCKS,
+                                 FAN_IN>
+{
+
+public:
+  using Base =
+      cuda_tuned_reduce_t<RAJA::reduce::sum<T>, T, ATOMIC_MAX_BLOCKS, FAN_IN>;
+  using Base::Base;
+  //! enable operator+= for ReduceSum -- alias for combine()
+  RAJA_HOST_DEVICE
+  const ReduceSum& operator+=(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+//! specialization of ReduceBitOr for cuda_reduce_tuned
+template <size_t ATOMIC_MAX_BLOCKS, size_t FAN_IN, typename T>
+class ReduceBitOr<cuda_reduce_tuned<ATOMIC_MAX_BLOCKS, FAN_IN>, T>
+    : public cuda_tuned_reduce_t<RAJA::reduce::or_bit<T>,
+                                 T,
+                                 ATOMIC_MAX_BLOCKS,
+                                 FAN_IN>
+{
+
+public:
+  using Base = cuda_tuned_reduce_t<RAJA::reduce::or_bit<T>,
+                                   T,
+                                   ATOMIC_MAX_BLOCKS,
+                                   FAN_IN>;
+  using Base::Base;
+  //! enable operator|= for ReduceBitOr -- alias for combine()
+  RAJA_HOST_DEVICE
+  const ReduceBitOr& operator|=(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+//! specialization of ReduceBitAnd for cuda_reduce_tuned
+template <size_t ATOMIC_MAX_BLOCKS, size_t FAN_IN, typename T>
+class ReduceBitAnd<cuda_reduce_tuned<ATOMIC_MAX_BLOCKS, FAN_IN>, T>
+    : public cuda_tuned_reduce_t<RAJA::reduce::and_bit<T>,
+                                 T,
+                                 ATOMIC_MAX_BLOCKS,
+                                 FAN_IN>
+{
+
+public:
+  using Base = cuda_tuned_reduce_t<RAJA::reduce::and_bit<T>,
+                                   T,
+                                   ATOMIC_MAX_BLOCKS,
+                                   FAN_IN>;
+  using Base::Base;
+  //! enable operator&= for ReduceBitAnd -- alias for combine()
+  RAJA_HOST_DEVICE
+  const ReduceBitAnd& operator&=(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+//! specialization of ReduceMin for cuda_reduce_tuned
+template <size_t ATOMIC_MAX_BLOCKS, size_t FAN_IN, typename T>
+class ReduceMin<cuda_reduce_tuned<ATOMIC_MAX_BLOCKS, FAN_IN>, T>
+    : public cuda_tuned_reduce_t<RAJA::reduce::min<T>,
+                                 T,
+                                 ATOMIC_MAX_BLOCKS,
+                                 FAN_IN>
+{
+
+public:
+  using Base =
+      cuda_tuned_reduce_t<RAJA::reduce::min<T>, T, ATOMIC_MAX_BLOCKS, FAN_IN>;
+  using Base::Base;
+  //! enable min() for ReduceMin -- alias for combine()
+  RAJA_HOST_DEVICE
+  const ReduceMin& min(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+//! specialization of ReduceMax for cuda_reduce_tuned
+template <size_t ATOMIC_MAX_BLOCKS, size_t FAN_IN, typename T>
+class ReduceMax<cuda_reduce_tuned<ATOMIC_MAX_BLOCKS, FAN_IN>, T>
+    : public cuda_tuned_reduce_t<RAJA::reduce::max<T>,
+                                 T,
+                                 ATOMIC_MAX_BLOCKS,
+                                 FAN_IN>
+{
+
+public:
+  using Base =
+      cuda_tuned_reduce_t<RAJA::reduce::max<T>, T, ATOMIC_MAX_BLOCKS, FAN_IN>;
+  using Base::Base;
+  //! enable max() for ReduceMax -- alias for combine()
+  RAJA_HOST_DEVICE
+  const ReduceMax& max(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+//! specialization of ReduceMinLoc for cuda_reduce_tuned
+//  loc pairs have no device atomic, so every launch uses the tree
+template <size_t ATOMIC_MAX_BLOCKS, size_t FAN_IN, typename T, typename IndexType>
+class ReduceMinLoc<cuda_reduce_tuned<ATOMIC_MAX_BLOCKS, FAN_IN>, T, IndexType>
+    : public cuda_tuned_reduce_t<
+          RAJA::reduce::min<RAJA::reduce::detail::ValueLoc<T, IndexType>>,
+          RAJA::reduce::detail::ValueLoc<T, IndexType>,
+          ATOMIC_MAX_BLOCKS,
+          FAN_IN>
+{
+
+public:
+  using value_type = RAJA::reduce::detail::ValueLoc<T, IndexType>;
+  using Base = cuda_tuned_reduce_t<RAJA::reduce::min<value_type>,
+                                   value_type,
+                                   ATOMIC_MAX_BLOCKS,
+                                   FAN_IN>;
+  using Base::Base;
+
+  //! constructor requires a default value for the reducer
+  ReduceMinLoc(T init_val, IndexType init_idx)
+      : Base(value_type(init_val, init_idx))
+  {
+  }
+  //! reset the reducer with a new value and location, reusing its memory
+  void reset(T init_val,
+             IndexType init_idx =
+                 RAJA::reduce::detail::DefaultLoc<IndexType>().value())
+  {
+    Base::reset(value_type(init_val, init_idx));
+  }
+  //! reducer function; updates the current instance's state
+  RAJA_HOST_DEVICE
+  const ReduceMinLoc& minloc(T rhs, IndexType loc) const
+  {
+    this->combine(value_type(rhs, loc));
+    return *this;
+  }
+
+  //! Get the calculated reduced value
+  IndexType getLoc() { return Base::get().getLoc(); }
+
+  //! Get the calculated reduced value
+  operator T() { return Base::get(); }
+
+  //! Get the calculated reduced value
+  T get() { return Base::get(); }
+};
+
+//! specialization of ReduceMaxLoc for cuda_reduce_tuned
+//  loc pairs have no device atomic, so every launch uses the tree
+template <size_t ATOMIC_MAX_BLOCKS, size_t FAN_IN, typename T, typename IndexType>
+class ReduceMaxLoc<cuda_reduce_tuned<ATOMIC_MAX_BLOCKS, FAN_IN>, T, IndexType>
+    : public cuda_tuned_reduce_t<
+          RAJA::reduce::max<RAJA::reduce::detail::ValueLoc<T, IndexType, false>>,
+          RAJA::reduce::detail::ValueLoc<T, IndexType, false>,
+          ATOMIC_MAX_BLOCKS,
+          FAN_IN>
+{
+public:
+  using value_type = RAJA::reduce::detail::ValueLoc<T, IndexType, false>;
+  using Base = cuda_tuned_reduce_t<RAJA::reduce::max<value_type>,
+                                   value_type,
+                                   ATOMIC_MAX_BLOCKS,
+                                   FAN_IN>;
+  using Base::Base;
+
+  //! constructor requires a default value for the reducer
+  ReduceMaxLoc(T init_val, IndexType init_idx)
+      : Base(value_type(init_val, init_idx))
+  {
+  }
+  //! reset the reducer with a new value and location, reusing its memory
+  void reset(T init_val,
+             IndexType init_idx =
+                 RAJA::reduce::detail::DefaultLoc<IndexType>().value())
+  {
+    Base::reset(value_type(init_val, init_idx));
+  }
   //! reducer function; updates the current instance's state
   RAJA_HOST_DEVICE
   const ReduceMaxLoc& maxloc(T rhs, IndexType loc) const
@@ -1207,6 +2331,61 @@ public:
   T get() { return Base::get(); }
 };
 
+//! specialization of ReduceComposite for cuda_reduce
+template <bool maybe_atomic, typename T, template <typename> class... ReduceOps>
+class ReduceComposite<cuda_reduce_base<maybe_atomic>, T, ReduceOps...>
+    : public cuda::Reduce<
+          RAJA::reduce::composite<
+              RAJA::reduce::detail::CompositeValue<T, ReduceOps<T>...>>,
+          RAJA::reduce::detail::CompositeValue<T, ReduceOps<T>...>,
+          maybe_atomic>
+{
+public:
+  using value_type = RAJA::reduce::detail::CompositeValue<T, ReduceOps<T>...>;
+  using Base = cuda::
+      Reduce<RAJA::reduce::composite<value_type>, value_type, maybe_atomic>;
+  using Base::Base;
+
+  //! constructor folding an initial operand into every component
+  explicit ReduceComposite(T init_val) : Base(value_type(init_val)) {}
+
+  //! reset the reducer with a new operand, reusing its memory
+  void reset(T init_val) { Base::reset(value_type(init_val)); }
+
+  //! reducer function; folds the operand into every component
+  RAJA_HOST_DEVICE
+  const ReduceComposite& combine(T rhs) const
+  {
+    Base::combine(value_type(rhs));
+    return *this;
+  }
+
+  //! Get one component of the calculated reduced value
+  T get(size_t i) { return Base::get().get(i); }
+};
+
+//! specialization of the generic operator reducer for cuda_reduce
+//  custom operators have no registered device atomic, so the tally
+//  always folds through the non-atomic grid combine; the ordered fold
+//  also keeps compensated sums deterministic
+template <bool maybe_atomic, typename ReduceOp>
+class Reduce<cuda_reduce_base<maybe_atomic>, ReduceOp>
+    : public cuda::Reduce<ReduceOp, typename ReduceOp::value_type, false>
+{
+public:
+  using value_type = typename ReduceOp::value_type;
+  using Base = cuda::Reduce<ReduceOp, value_type, false>;
+  using Base::Base;
+
+  //! reducer function; folds the operand into the running value
+  RAJA_HOST_DEVICE
+  const Reduce& combine(value_type const& rhs) const
+  {
+    Base::combine(rhs);
+    return *this;
+  }
+};
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_CUDA guard
@@ -28,11 +28,143 @@
 #include "cub/device/device_scan.cuh"
 #include "cub/util_allocator.cuh"
 
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/ScanContext.hpp"
+#include "RAJA/util/resource.hpp"
+
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
 
 namespace RAJA
 {
+
+namespace cuda
+{
+
+//! Persistent device workspace for scan temporary storage
+//  Sized once (see the *_scan_storage_bytes query functions) and passed to
+//  the workspace-taking scan overloads, so repeated scans of known maximum
+//  size involve no allocator at all. The workspace remembers the largest
+//  scan length it has covered, so any subsequent scan of that length or
+//  less also skips the cub size query (see the scan context overloads in
+//  pattern/scan.hpp).
+class ScanWorkspace : public ScanContextBase
+{
+public:
+  ScanWorkspace() : m_storage(nullptr), m_capacity(0), m_sized_len(0) {}
+
+  //! construct with capacity for nbytes of temporary storage
+  explicit ScanWorkspace(size_t nbytes) : ScanWorkspace() { reserve(nbytes); }
+
+  ScanWorkspace(const ScanWorkspace&) = delete;
+  ScanWorkspace& operator=(const ScanWorkspace&) = delete;
+
+  ~ScanWorkspace() { release(); }
+
+  //! ensure capacity for nbytes of temporary storage; existing contents
+  //  are not preserved
+  void reserve(size_t nbytes)
+  {
+    if (nbytes > m_capacity) {
+      release();
+      m_storage =
+          device_mempool_type::getInstance().malloc<unsigned char>(nbytes);
+      m_capacity = nbytes;
+    }
+  }
+
+  //! free the temporary storage
+  void release()
+  {
+    if (m_storage) {
+      device_mempool_type::getInstance().free(m_storage);
+      m_storage = nullptr;
+      m_capacity = 0;
+    }
+    m_sized_len = 0;
+  }
+
+  void* storage() const { return m_storage; }
+
+  size_t capacity() const { return m_capacity; }
+
+  //! true if a scan of length len needs no cub size query because a
+  //  previous scan of at least that length already sized this workspace
+  bool sized_for(int len) const { return len <= m_sized_len; }
+
+  //! record that the workspace now covers scans up to length len
+  void note_sized(int len)
+  {
+    if (len > m_sized_len) {
+      m_sized_len = len;
+    }
+  }
+
+private:
+  unsigned char* m_storage;
+  size_t m_capacity;
+  int m_sized_len;
+};
+
+}  // namespace cuda
+
+//! The scan context for cuda_exec policies is the device workspace
+template <size_t BLOCK_SIZE, bool Async>
+struct get_scan_context<cuda_exec<BLOCK_SIZE, Async>> {
+  using type = cuda::ScanWorkspace;
+};
+
+/*!
+        \brief query temporary storage bytes needed to inclusive scan a
+        range of the given length; use to size a cuda::ScanWorkspace once
+        for the largest scan in a pipeline
+*/
+template <typename InputIter,
+          typename OutputIter,
+          typename Function = operators::plus<
+              typename std::iterator_traits<InputIter>::value_type>>
+size_t inclusive_scan_storage_bytes(InputIter begin,
+                                    InputIter end,
+                                    OutputIter out,
+                                    Function binary_op = Function{})
+{
+  int len = std::distance(begin, end);
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  cudaErrchk(::cub::DeviceScan::InclusiveScan(
+      d_temp_storage, temp_storage_bytes, begin, out, binary_op, len, 0));
+  return temp_storage_bytes;
+}
+
+/*!
+        \brief query temporary storage bytes needed to exclusive scan a
+        range of the given length
+*/
+template <typename InputIter,
+          typename OutputIter,
+          typename T,
+          typename Function = operators::plus<
+              typename std::iterator_traits<InputIter>::value_type>>
+size_t exclusive_scan_storage_bytes(InputIter begin,
+                                    InputIter end,
+                                    OutputIter out,
+                                    Function binary_op,
+                                    T init)
+{
+  int len = std::distance(begin, end);
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                              temp_storage_bytes,
+                                              begin,
+                                              out,
+                                              binary_op,
+                                              init,
+                                              len,
+                                              0));
+  return temp_storage_bytes;
+}
+
 namespace impl
 {
 namespace scan
@@ -43,12 +175,13 @@ namespace scan
    initial value
 */
 template <size_t BLOCK_SIZE, bool Async, typename InputIter, typename Function>
-void inclusive_inplace(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+void inclusive_inplace(resources::Cuda& cuda_res,
+                       const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                        InputIter begin,
                        InputIter end,
                        Function binary_op)
 {
-  cudaStream_t stream = 0;
+  cudaStream_t stream = cuda_res.get_stream();
 
   int len = std::distance(begin, end);
   // Determine temporary device storage requirements
@@ -61,10 +194,8 @@ void inclusive_inplace(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                               binary_op,
                                               len,
                                               stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
   // Run
   cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
                                               temp_storage_bytes,
@@ -73,8 +204,8 @@ void inclusive_inplace(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                               binary_op,
                                               len,
                                               stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Free temporary storage once the scan completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
 
   cuda::launch(stream);
   if (!Async) cuda::synchronize(stream);
@@ -89,13 +220,14 @@ template <size_t BLOCK_SIZE,
           typename InputIter,
           typename Function,
           typename T>
-void exclusive_inplace(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+void exclusive_inplace(resources::Cuda& cuda_res,
+                       const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                        InputIter begin,
                        InputIter end,
                        Function binary_op,
                        T init)
 {
-  cudaStream_t stream = 0;
+  cudaStream_t stream = cuda_res.get_stream();
 
   int len = std::distance(begin, end);
   // Determine temporary device storage requirements
@@ -109,10 +241,8 @@ void exclusive_inplace(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                               init,
                                               len,
                                               stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
   // Run
   cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
                                               temp_storage_bytes,
@@ -122,8 +252,8 @@ void exclusive_inplace(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                               init,
                                               len,
                                               stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Free temporary storage once the scan completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
 
   cuda::launch(stream);
   if (!Async) cuda::synchronize(stream);
@@ -138,13 +268,14 @@ template <size_t BLOCK_SIZE,
           typename InputIter,
           typename OutputIter,
           typename Function>
-void inclusive(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+void inclusive(resources::Cuda& cuda_res,
+               const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                InputIter begin,
                InputIter end,
                OutputIter out,
                Function binary_op)
 {
-  cudaStream_t stream = 0;
+  cudaStream_t stream = cuda_res.get_stream();
 
   int len = std::distance(begin, end);
   // Determine temporary device storage requirements
@@ -152,15 +283,13 @@ void inclusive(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
   size_t temp_storage_bytes = 0;
   cudaErrchk(::cub::DeviceScan::InclusiveScan(
       d_temp_storage, temp_storage_bytes, begin, out, binary_op, len, stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
   // Run
   cudaErrchk(::cub::DeviceScan::InclusiveScan(
       d_temp_storage, temp_storage_bytes, begin, out, binary_op, len, stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Free temporary storage once the scan completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
 
   cuda::launch(stream);
   if (!Async) cuda::synchronize(stream);
@@ -176,14 +305,15 @@ template <size_t BLOCK_SIZE,
           typename OutputIter,
           typename Function,
           typename T>
-void exclusive(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+void exclusive(resources::Cuda& cuda_res,
+               const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                InputIter begin,
                InputIter end,
                OutputIter out,
                Function binary_op,
                T init)
 {
-  cudaStream_t stream = 0;
+  cudaStream_t stream = cuda_res.get_stream();
 
   int len = std::distance(begin, end);
   // Determine temporary device storage requirements
@@ -197,10 +327,8 @@ void exclusive(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                               init,
                                               len,
                                               stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
   // Run
   cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
                                               temp_storage_bytes,
@@ -210,8 +338,263 @@ void exclusive(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                               init,
                                               len,
                                               stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Free temporary storage once the scan completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
+
+  cuda::launch(stream);
+  if (!Async) cuda::synchronize(stream);
+}
+
+/*!
+        \brief explicit inclusive scan by key given key range, input values,
+   output, and function; the scan restarts at each key change
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename KeyIter,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+void inclusive_by_key(resources::Cuda& cuda_res,
+                      const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+                      KeyIter keys,
+                      KeyIter keys_end,
+                      InputIter begin,
+                      OutputIter out,
+                      Function binary_op)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(keys, keys_end);
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  cudaErrchk(::cub::DeviceScan::InclusiveScanByKey(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   keys,
+                                                   begin,
+                                                   out,
+                                                   binary_op,
+                                                   len,
+                                                   ::cub::Equality(),
+                                                   stream));
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
+  // Run
+  cudaErrchk(::cub::DeviceScan::InclusiveScanByKey(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   keys,
+                                                   begin,
+                                                   out,
+                                                   binary_op,
+                                                   len,
+                                                   ::cub::Equality(),
+                                                   stream));
+  // Free temporary storage once the scan completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
+
+  cuda::launch(stream);
+  if (!Async) cuda::synchronize(stream);
+}
+
+/*!
+        \brief explicit exclusive scan by key given key range, input values,
+   output, function, and initial value; the scan restarts at each key change
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename KeyIter,
+          typename InputIter,
+          typename OutputIter,
+          typename Function,
+          typename T>
+void exclusive_by_key(resources::Cuda& cuda_res,
+                      const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+                      KeyIter keys,
+                      KeyIter keys_end,
+                      InputIter begin,
+                      OutputIter out,
+                      Function binary_op,
+                      T init)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(keys, keys_end);
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  cudaErrchk(::cub::DeviceScan::ExclusiveScanByKey(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   keys,
+                                                   begin,
+                                                   out,
+                                                   binary_op,
+                                                   init,
+                                                   len,
+                                                   ::cub::Equality(),
+                                                   stream));
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
+  // Run
+  cudaErrchk(::cub::DeviceScan::ExclusiveScanByKey(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   keys,
+                                                   begin,
+                                                   out,
+                                                   binary_op,
+                                                   init,
+                                                   len,
+                                                   ::cub::Equality(),
+                                                   stream));
+  // Free temporary storage once the scan completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
+
+  cuda::launch(stream);
+  if (!Async) cuda::synchronize(stream);
+}
+
+/*!
+        \brief inclusive inplace scan reusing workspace temporary storage;
+   the cub size query runs only when the workspace has not yet covered a
+   scan of this length
+*/
+template <size_t BLOCK_SIZE, bool Async, typename InputIter, typename Function>
+void inclusive_inplace(resources::Cuda& cuda_res,
+                       cuda::ScanWorkspace& workspace,
+                       const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+                       InputIter begin,
+                       InputIter end,
+                       Function binary_op)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+  if (!workspace.sized_for(len)) {
+    workspace.reserve(inclusive_scan_storage_bytes(begin, end, begin, binary_op));
+    workspace.note_sized(len);
+  }
+  size_t temp_storage_bytes = workspace.capacity();
+  cudaErrchk(::cub::DeviceScan::InclusiveScan(workspace.storage(),
+                                              temp_storage_bytes,
+                                              begin,
+                                              begin,
+                                              binary_op,
+                                              len,
+                                              stream));
+
+  cuda::launch(stream);
+  if (!Async) cuda::synchronize(stream);
+}
+
+/*!
+        \brief exclusive inplace scan reusing workspace temporary storage
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename Function,
+          typename T>
+void exclusive_inplace(resources::Cuda& cuda_res,
+                       cuda::ScanWorkspace& workspace,
+                       const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+                       InputIter begin,
+                       InputIter end,
+                       Function binary_op,
+                       T init)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+  if (!workspace.sized_for(len)) {
+    workspace.reserve(
+        exclusive_scan_storage_bytes(begin, end, begin, binary_op, init));
+    workspace.note_sized(len);
+  }
+  size_t temp_storage_bytes = workspace.capacity();
+  cudaErrchk(::cub::DeviceScan::ExclusiveScan(workspace.storage(),
+                                              temp_storage_bytes,
+                                              begin,
+                                              begin,
+                                              binary_op,
+                                              init,
+                                              len,
+                                              stream));
+
+  cuda::launch(stream);
+  if (!Async) cuda::synchronize(stream);
+}
+
+/*!
+        \brief inclusive scan reusing workspace temporary storage
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+void inclusive(resources::Cuda& cuda_res,
+               cuda::ScanWorkspace& workspace,
+               const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+               InputIter begin,
+               InputIter end,
+               OutputIter out,
+               Function binary_op)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+  if (!workspace.sized_for(len)) {
+    workspace.reserve(inclusive_scan_storage_bytes(begin, end, out, binary_op));
+    workspace.note_sized(len);
+  }
+  size_t temp_storage_bytes = workspace.capacity();
+  cudaErrchk(::cub::DeviceScan::InclusiveScan(workspace.storage(),
+                                              temp_storage_bytes,
+                                              begin,
+                                              out,
+                                              binary_op,
+                                              len,
+                                              stream));
+
+  cuda::launch(stream);
+  if (!Async) cuda::synchronize(stream);
+}
+
+/*!
+        \brief exclusive scan reusing workspace temporary storage
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function,
+          typename T>
+void exclusive(resources::Cuda& cuda_res,
+               cuda::ScanWorkspace& workspace,
+               const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+               InputIter begin,
+               InputIter end,
+               OutputIter out,
+               Function binary_op,
+               T init)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+  if (!workspace.sized_for(len)) {
+    workspace.reserve(
+        exclusive_scan_storage_bytes(begin, end, out, binary_op, init));
+    workspace.note_sized(len);
+  }
+  size_t temp_storage_bytes = workspace.capacity();
+  cudaErrchk(::cub::DeviceScan::ExclusiveScan(workspace.storage(),
+                                              temp_storage_bytes,
+                                              begin,
+                                              out,
+                                              binary_op,
+                                              init,
+                                              len,
+                                              stream));
 
   cuda::launch(stream);
   if (!Async) cuda::synchronize(stream);
@@ -221,6 +604,61 @@ void exclusive(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
 
 }  // namespace impl
 
+/*!
+        \brief inclusive scan enqueued on the resource's stream using
+        caller-provided temporary storage
+
+        The workspace is grown if undersized; sized to the pipeline's
+        largest scan up front (via inclusive_scan_storage_bytes), the call
+        is a pure enqueue with no allocator involvement, and any scan no
+        longer than one the workspace already covered also skips the cub
+        size query. Synchronizes the stream only if the policy is not
+        asynchronous.
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function = operators::plus<
+              typename std::iterator_traits<InputIter>::value_type>>
+resources::EventProxy<resources::Cuda> inclusive_scan(
+    resources::Cuda& cuda_res,
+    cuda::ScanWorkspace& workspace,
+    const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& pol,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op = Function{})
+{
+  impl::scan::inclusive(cuda_res, workspace, pol, begin, end, out, binary_op);
+  return resources::EventProxy<resources::Cuda>(&cuda_res);
+}
+
+/*!
+        \brief exclusive scan enqueued on the resource's stream using
+        caller-provided temporary storage
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function,
+          typename T>
+resources::EventProxy<resources::Cuda> exclusive_scan(
+    resources::Cuda& cuda_res,
+    cuda::ScanWorkspace& workspace,
+    const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& pol,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op,
+    T init)
+{
+  impl::scan::exclusive(cuda_res, workspace, pol, begin, end, out, binary_op,
+                        init);
+  return resources::EventProxy<resources::Cuda>(&cuda_res);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_CUDA guard
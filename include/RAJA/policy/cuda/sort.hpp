@@ -30,6 +30,7 @@
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/resource.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
@@ -51,7 +52,8 @@ concepts::enable_if<concepts::negate<concepts::all_of<
                       concepts::any_of<
                         camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
                         camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
-stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+stable(resources::Cuda& cuda_res,
+       const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
        Iter,
        Iter,
        Compare)
@@ -73,12 +75,13 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                     std::is_pointer<Iter>>
-stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+stable(resources::Cuda& cuda_res,
+       const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
        Iter begin,
        Iter end,
        operators::less<RAJA::detail::IterVal<Iter>>)
 {
-  cudaStream_t stream = 0;
+  cudaStream_t stream = cuda_res.get_stream();
 
   using R = RAJA::detail::IterVal<Iter>;
 
@@ -86,8 +89,8 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
   int begin_bit=0;
   int end_bit=sizeof(R)*CHAR_BIT;
 
-  // Allocate temporary storage for the output array
-  R* d_out = cuda::device_mempool_type::getInstance().malloc<R>(len);
+  // Allocate temporary storage for the output array ordered on the stream
+  R* d_out = static_cast<R*>(cuda::device_malloc_async(len * sizeof(R), stream));
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
@@ -103,10 +106,8 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                               begin_bit,
                                               end_bit,
                                               stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
 
   // Run
   cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
@@ -116,8 +117,8 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                               begin_bit,
                                               end_bit,
                                               stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Free temporary storage once the sort completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
 
   if (d_keys.Current() == d_out) {
 
@@ -125,7 +126,7 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
     cudaErrchk(cudaMemcpyAsync(begin, d_out, len*sizeof(R), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_out);
+  cuda::device_free_async(d_out, stream);
 
   cuda::launch(stream);
   if (!Async) cuda::synchronize(stream);
@@ -137,12 +138,13 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                     std::is_pointer<Iter>>
-stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+stable(resources::Cuda& cuda_res,
+       const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
        Iter begin,
        Iter end,
        operators::greater<RAJA::detail::IterVal<Iter>>)
 {
-  cudaStream_t stream = 0;
+  cudaStream_t stream = cuda_res.get_stream();
 
   using R = RAJA::detail::IterVal<Iter>;
 
@@ -150,8 +152,8 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
   int begin_bit=0;
   int end_bit=sizeof(R)*CHAR_BIT;
 
-  // Allocate temporary storage for the output array
-  R* d_out = cuda::device_mempool_type::getInstance().malloc<R>(len);
+  // Allocate temporary storage for the output array ordered on the stream
+  R* d_out = static_cast<R*>(cuda::device_malloc_async(len * sizeof(R), stream));
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
@@ -167,10 +169,8 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                                         begin_bit,
                                                         end_bit,
                                                         stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
 
   // Run
   cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
@@ -180,8 +180,8 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                                         begin_bit,
                                                         end_bit,
                                                         stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Free temporary storage once the sort completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
 
   if (d_keys.Current() == d_out) {
 
@@ -189,7 +189,7 @@ stable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
     cudaErrchk(cudaMemcpyAsync(begin, d_out, len*sizeof(R), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_out);
+  cuda::device_free_async(d_out, stream);
 
   cuda::launch(stream);
   if (!Async) cuda::synchronize(stream);
@@ -206,7 +206,8 @@ concepts::enable_if<concepts::negate<concepts::all_of<
                       concepts::any_of<
                         camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
                         camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
-unstable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+unstable(resources::Cuda& cuda_res,
+         const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
          Iter,
          Iter,
          Compare)
@@ -228,12 +229,13 @@ unstable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                     std::is_pointer<Iter>>
-unstable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& p,
+unstable(resources::Cuda& cuda_res,
+         const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& p,
          Iter begin,
          Iter end,
          operators::less<RAJA::detail::IterVal<Iter>> comp)
 {
-  stable(p, begin, end, comp);
+  stable(cuda_res, p, begin, end, comp);
 }
 
 /*!
@@ -242,12 +244,13 @@ unstable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& p,
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                     std::is_pointer<Iter>>
-unstable(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& p,
+unstable(resources::Cuda& cuda_res,
+         const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& p,
          Iter begin,
          Iter end,
          operators::greater<RAJA::detail::IterVal<Iter>> comp)
 {
-  stable(p, begin, end, comp);
+  stable(cuda_res, p, begin, end, comp);
 }
 
 
@@ -263,7 +266,8 @@ concepts::enable_if<concepts::negate<concepts::all_of<
                       concepts::any_of<
                         camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
                         camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
-stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+stable_pairs(resources::Cuda& cuda_res,
+             const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
              KeyIter,
              KeyIter,
              ValIter,
@@ -290,13 +294,14 @@ template <size_t BLOCK_SIZE, bool Async,
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                     std::is_pointer<KeyIter>,
                     std::is_pointer<ValIter>>
-stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+stable_pairs(resources::Cuda& cuda_res,
+             const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
              KeyIter keys_begin,
              KeyIter keys_end,
              ValIter vals_begin,
              operators::less<RAJA::detail::IterVal<KeyIter>>)
 {
-  cudaStream_t stream = 0;
+  cudaStream_t stream = cuda_res.get_stream();
 
   using K = RAJA::detail::IterVal<KeyIter>;
   using V = RAJA::detail::IterVal<ValIter>;
@@ -305,9 +310,11 @@ stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
   int begin_bit=0;
   int end_bit=sizeof(K)*CHAR_BIT;
 
-  // Allocate temporary storage for the output arrays
-  K* d_keys_out = cuda::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = cuda::device_mempool_type::getInstance().malloc<V>(len);
+  // Allocate temporary storage for the output arrays ordered on the stream
+  K* d_keys_out =
+      static_cast<K*>(cuda::device_malloc_async(len * sizeof(K), stream));
+  V* d_vals_out =
+      static_cast<V*>(cuda::device_malloc_async(len * sizeof(V), stream));
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
@@ -325,10 +332,8 @@ stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                                begin_bit,
                                                end_bit,
                                                stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
 
   // Run
   cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
@@ -339,8 +344,8 @@ stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                                begin_bit,
                                                end_bit,
                                                stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Free temporary storage once the sort completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
 
   if (d_keys.Current() == d_keys_out) {
 
@@ -353,8 +358,8 @@ stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
     cudaErrchk(cudaMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_keys_out);
-  cuda::device_mempool_type::getInstance().free(d_vals_out);
+  cuda::device_free_async(d_keys_out, stream);
+  cuda::device_free_async(d_vals_out, stream);
 
   cuda::launch(stream);
   if (!Async) cuda::synchronize(stream);
@@ -368,13 +373,14 @@ template <size_t BLOCK_SIZE, bool Async,
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                     std::is_pointer<KeyIter>,
                     std::is_pointer<ValIter>>
-stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+stable_pairs(resources::Cuda& cuda_res,
+             const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
              KeyIter keys_begin,
              KeyIter keys_end,
              ValIter vals_begin,
              operators::greater<RAJA::detail::IterVal<KeyIter>>)
 {
-  cudaStream_t stream = 0;
+  cudaStream_t stream = cuda_res.get_stream();
 
   using K = RAJA::detail::IterVal<KeyIter>;
   using V = RAJA::detail::IterVal<ValIter>;
@@ -383,9 +389,11 @@ stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
   int begin_bit=0;
   int end_bit=sizeof(K)*CHAR_BIT;
 
-  // Allocate temporary storage for the output arrays
-  K* d_keys_out = cuda::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = cuda::device_mempool_type::getInstance().malloc<V>(len);
+  // Allocate temporary storage for the output arrays ordered on the stream
+  K* d_keys_out =
+      static_cast<K*>(cuda::device_malloc_async(len * sizeof(K), stream));
+  V* d_vals_out =
+      static_cast<V*>(cuda::device_malloc_async(len * sizeof(V), stream));
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
@@ -403,10 +411,8 @@ stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                                          begin_bit,
                                                          end_bit,
                                                          stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
 
   // Run
   cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
@@ -417,8 +423,8 @@ stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                                                          begin_bit,
                                                          end_bit,
                                                          stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Free temporary storage once the sort completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
 
   if (d_keys.Current() == d_keys_out) {
 
@@ -431,8 +437,88 @@ stable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
     cudaErrchk(cudaMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_keys_out);
-  cuda::device_mempool_type::getInstance().free(d_vals_out);
+  cuda::device_free_async(d_keys_out, stream);
+  cuda::device_free_async(d_vals_out, stream);
+
+  cuda::launch(stream);
+  if (!Async) cuda::synchronize(stream);
+}
+
+/*!
+        \brief stable sort given range of pairs in ascending order of the
+        low num_key_bits of the keys, skipping radix passes over higher bits
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter>
+concepts::enable_if<std::is_integral<RAJA::detail::IterVal<KeyIter>>,
+                    std::is_pointer<KeyIter>,
+                    std::is_pointer<ValIter>>
+stable_pairs_bits(resources::Cuda& cuda_res,
+                  const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+                  KeyIter keys_begin,
+                  KeyIter keys_end,
+                  ValIter vals_begin,
+                  int num_key_bits)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using V = RAJA::detail::IterVal<ValIter>;
+
+  int len = std::distance(keys_begin, keys_end);
+  int begin_bit=0;
+  int end_bit=std::max(1, std::min(num_key_bits, static_cast<int>(sizeof(K)*CHAR_BIT)));
+
+  // Allocate temporary storage for the output arrays ordered on the stream
+  K* d_keys_out =
+      static_cast<K*>(cuda::device_malloc_async(len * sizeof(K), stream));
+  V* d_vals_out =
+      static_cast<V*>(cuda::device_malloc_async(len * sizeof(V), stream));
+
+  // use cub double buffer to reduce temporary memory requirements
+  // by allowing cub to write to the keys_begin and vals_begin buffers
+  cub::DoubleBuffer<K> d_keys(keys_begin, d_keys_out);
+  cub::DoubleBuffer<V> d_vals(vals_begin, d_vals_out);
+
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                               temp_storage_bytes,
+                                               d_keys,
+                                               d_vals,
+                                               len,
+                                               begin_bit,
+                                               end_bit,
+                                               stream));
+  // Allocate temporary storage ordered on the stream
+  d_temp_storage = cuda::device_malloc_async(temp_storage_bytes, stream);
+
+  // Run
+  cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                               temp_storage_bytes,
+                                               d_keys,
+                                               d_vals,
+                                               len,
+                                               begin_bit,
+                                               end_bit,
+                                               stream));
+  // Free temporary storage once the sort completes on the stream
+  cuda::device_free_async(d_temp_storage, stream);
+
+  if (d_keys.Current() == d_keys_out) {
+
+    // copy keys
+    cudaErrchk(cudaMemcpyAsync(keys_begin, d_keys_out, len*sizeof(K), cudaMemcpyDefault, stream));
+  }
+  if (d_vals.Current() == d_vals_out) {
+
+    // copy vals
+    cudaErrchk(cudaMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), cudaMemcpyDefault, stream));
+  }
+
+  cuda::device_free_async(d_keys_out, stream);
+  cuda::device_free_async(d_vals_out, stream);
 
   cuda::launch(stream);
   if (!Async) cuda::synchronize(stream);
@@ -451,7 +537,8 @@ concepts::enable_if<concepts::negate<concepts::all_of<
                       concepts::any_of<
                         camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
                         camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
-unstable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
+unstable_pairs(resources::Cuda& cuda_res,
+               const ::RAJA::cuda_exec<BLOCK_SIZE, Async>&,
                KeyIter,
                KeyIter,
                ValIter,
@@ -478,13 +565,14 @@ template <size_t BLOCK_SIZE, bool Async,
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                     std::is_pointer<KeyIter>,
                     std::is_pointer<ValIter>>
-unstable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& p,
+unstable_pairs(resources::Cuda& cuda_res,
+               const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& p,
                KeyIter keys_begin,
                KeyIter keys_end,
                ValIter vals_begin,
                operators::less<RAJA::detail::IterVal<KeyIter>> comp)
 {
-  stable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+  stable_pairs(cuda_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
 /*!
@@ -495,13 +583,14 @@ template <size_t BLOCK_SIZE, bool Async,
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                     std::is_pointer<KeyIter>,
                     std::is_pointer<ValIter>>
-unstable_pairs(const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& p,
+unstable_pairs(resources::Cuda& cuda_res,
+               const ::RAJA::cuda_exec<BLOCK_SIZE, Async>& p,
                KeyIter keys_begin,
                KeyIter keys_end,
                ValIter vals_begin,
                operators::greater<RAJA::detail::IterVal<KeyIter>> comp)
 {
-  stable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+  stable_pairs(cuda_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
 }  // namespace sort
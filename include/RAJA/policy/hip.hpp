@@ -27,11 +27,15 @@
 #include <hip/hip_runtime.h>
 
 #include "RAJA/policy/hip/atomic.hpp"
+#include "RAJA/policy/hip/compact.hpp"
 #include "RAJA/policy/hip/forall.hpp"
+#include "RAJA/policy/hip/masked_forall.hpp"
 #include "RAJA/policy/hip/policy.hpp"
 #include "RAJA/policy/hip/reduce.hpp"
+#include "RAJA/policy/hip/find.hpp"
 #include "RAJA/policy/hip/scan.hpp"
 #include "RAJA/policy/hip/sort.hpp"
+#include "RAJA/policy/hip/segmented_reduce.hpp"
 #include "RAJA/policy/hip/kernel.hpp"
 #include "RAJA/policy/hip/synchronize.hpp"
 #include "RAJA/policy/hip/WorkGroup.hpp"
@@ -28,8 +28,12 @@
 #include <cstdio>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
+
+#include "camp/resource.hpp"
 
 #include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -116,10 +120,7 @@ struct hipInfo {
   hip_dim_t blockDim = 0;
   hipStream_t stream = 0;
   bool setup_reducers = false;
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  hipInfo* thread_states = nullptr;
-  omp::mutex lock;
-#endif
+  RAJA::mutex lock;
 };
 
 //! class that changes a value on construction then resets it at destruction
@@ -141,11 +142,14 @@ private:
 
 extern hipInfo g_status;
 
-extern hipInfo tl_status;
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-#pragma omp threadprivate(tl_status)
-#endif
+//! State of the launch in flight on this thread. thread_local rather
+//  than omp threadprivate so concurrent submission from any host
+//  threads, e.g. one std::thread per device, stays race-free.
+extern thread_local hipInfo tl_status;
 
+//! stream bookkeeping has its own mutex so threads driving independent
+//  Resources do not contend with reducer setup on one global lock
+extern RAJA::mutex g_stream_lock;
 extern std::unordered_map<hipStream_t, bool> g_stream_info_map;
 
 }  // namespace detail
@@ -154,9 +158,7 @@ extern std::unordered_map<hipStream_t, bool> g_stream_info_map;
 RAJA_INLINE
 void synchronize()
 {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  lock_guard<omp::mutex> lock(detail::g_status.lock);
-#endif
+  lock_guard<RAJA::mutex> lock(detail::g_stream_lock);
   bool synchronize = false;
   for (auto& val : detail::g_stream_info_map) {
     if (!val.second) {
@@ -173,9 +175,7 @@ void synchronize()
 RAJA_INLINE
 void synchronize(hipStream_t stream)
 {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  lock_guard<omp::mutex> lock(detail::g_status.lock);
-#endif
+  lock_guard<RAJA::mutex> lock(detail::g_stream_lock);
   auto iter = detail::g_stream_info_map.find(stream);
   if (iter != detail::g_stream_info_map.end()) {
     if (!iter->second) {
@@ -192,9 +192,7 @@ void synchronize(hipStream_t stream)
 RAJA_INLINE
 void launch(hipStream_t stream)
 {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  lock_guard<omp::mutex> lock(detail::g_status.lock);
-#endif
+  lock_guard<RAJA::mutex> lock(detail::g_stream_lock);
   auto iter = detail::g_stream_info_map.find(stream);
   if (iter != detail::g_stream_info_map.end()) {
     iter->second = false;
@@ -217,6 +215,93 @@ void launch(Func &func, hip_dim_t gridDim, hip_dim_t blockDim, Data &&data, size
 RAJA_INLINE
 void peekAtLastError() { hipErrchk(hipPeekAtLastError()); }
 
+//! Registry of instantiated kernel symbols used by preload_kernels.
+//  Launch sites register the kernels they instantiate during static
+//  initialization, so by the time an application can call
+//  preload_kernels the registry lists every RAJA kernel the executable
+//  may launch.
+class KernelRegistry
+{
+public:
+  static KernelRegistry& getInstance()
+  {
+    static KernelRegistry registry;
+    return registry;
+  }
+
+  //! record a kernel symbol; returns true so registration can run as
+  //  the initializer of a static flag
+  bool register_kernel(const void* func)
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+    m_kernels.push_back(func);
+    return true;
+  }
+
+  //! touch every registered kernel so the runtime loads its code object
+  //  now rather than at first launch
+  void preload()
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+    for (const void* func : m_kernels) {
+      hipFuncAttributes attr;
+      hipErrchk(hipFuncGetAttributes(&attr, func));
+    }
+  }
+
+  //! number of kernels registered so far
+  size_t size()
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+    return m_kernels.size();
+  }
+
+private:
+  KernelRegistry() = default;
+
+  RAJA::mutex m_mutex;
+
+  std::vector<const void*> m_kernels;
+};
+
+namespace detail
+{
+
+//! Registers the kernel named by KernelGetter::get() with the
+//  KernelRegistry. Odr-using s_registered at a launch site instantiates
+//  this static member, whose dynamic initializer performs the
+//  registration at program startup.
+template <typename KernelGetter>
+struct KernelRegistrar {
+  static bool s_registered;
+};
+
+template <typename KernelGetter>
+bool KernelRegistrar<KernelGetter>::s_registered =
+    KernelRegistry::getInstance().register_kernel(
+        (const void*)KernelGetter::get());
+
+}  // namespace detail
+
+//! force code-object load for every registered kernel; see
+//  RAJA::preload_kernels for the resource-taking entry point
+RAJA_INLINE
+void preload_kernels() { KernelRegistry::getInstance().preload(); }
+
+//! Register the kernel function named by the argument, which must be a
+//  (possibly template-id) expression naming a __global__ function, for
+//  ahead-of-time warmup through RAJA::preload_kernels. The local getter
+//  class keys the registrar template so registration runs once per
+//  kernel instantiation during static initialization.
+#define RAJA_HIP_REGISTER_KERNEL(...)                                    \
+  {                                                                      \
+    struct KernelGetter {                                                \
+      static const void* get() { return (const void*)&(__VA_ARGS__); }  \
+    };                                                                   \
+    (void)::RAJA::hip::detail::KernelRegistrar<KernelGetter>::           \
+        s_registered;                                                    \
+  }
+
 //! query whether reducers in this thread should setup for device execution now
 RAJA_INLINE
 bool setupReducers() { return detail::tl_status.setup_reducers; }
@@ -272,6 +357,16 @@ hipDeviceProp_t& device_prop()
 
 }  // namespace hip
 
+//! Touch every registered HIP kernel so the runtime pays code-object
+//  load latency here, at init, instead of on first launch inside the
+//  timed loop. The resource selects the backend overload; attributes
+//  are queried in the calling thread's current device context.
+RAJA_INLINE
+void preload_kernels(camp::resources::Hip& RAJA_UNUSED_ARG(res))
+{
+  hip::preload_kernels();
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_HIP
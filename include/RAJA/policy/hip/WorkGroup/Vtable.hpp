@@ -21,12 +21,10 @@
 #include "RAJA/config.hpp"
 
 #include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
 
 #include "RAJA/pattern/WorkGroup/Vtable.hpp"
 
-#include <thread>
-#include <mutex>
-
 
 namespace RAJA
 {
@@ -45,46 +43,32 @@ __global__ void get_Vtable_hip_device_call_global(
   *ptrptr = &Vtable_T::template device_call<T>;
 }
 
-// allocate the pinned ptrptr buffer
-inline void* get_Vtable_hip_device_call_ptrptr()
-{
-  void* ptrptr = nullptr;
-  hipErrchk(hipHostMalloc(&ptrptr, sizeof(typename Vtable<>::call_sig)));
-  return ptrptr;
-}
-
-// get the pinned ptrptr buffer
-inline void* get_cached_Vtable_hip_device_call_ptrptr()
-{
-  static void* ptrptr = get_Vtable_hip_device_call_ptrptr();
-  return ptrptr;
-}
-
-// mutex that guards against concurrent use of
-// get_cached_Vtable_hip_device_call_ptrptr()
-inline std::mutex& get_Vtable_hip_mutex()
-{
-  static std::mutex s_mutex;
-  return s_mutex;
-}
-
+// get the device function pointer by calling a global function to
+// write it into a pinned buffer, different instantiations of this
+// function may run concurrently as each uses its own buffer
 template < typename T, typename Vtable_T >
 inline typename Vtable_T::call_sig get_Vtable_hip_device_call()
 {
-  const std::lock_guard<std::mutex> lock(get_Vtable_hip_mutex());
-
   typename Vtable_T::call_sig* ptrptr =
-      static_cast<typename Vtable_T::call_sig*>(
-        get_cached_Vtable_hip_device_call_ptrptr());
+      hip::pinned_mempool_type::getInstance().template malloc<
+          typename Vtable_T::call_sig>(1);
+
   auto func = get_Vtable_hip_device_call_global<T, Vtable_T>;
   hipLaunchKernelGGL(func,
       dim3(1), dim3(1), 0, 0, ptrptr);
   hipErrchk(hipGetLastError());
   hipErrchk(hipDeviceSynchronize());
 
-  return *ptrptr;
+  typename Vtable_T::call_sig ptr = *ptrptr;
+
+  hip::pinned_mempool_type::getInstance().free(ptrptr);
+
+  return ptr;
 }
 
+// process-lifetime cache of device function pointers keyed by loop type,
+// populated on first use and concurrently readable afterwards so
+// steady-state WorkGroup builds never touch the driver for symbol lookups
 template < typename T, typename Vtable_T >
 inline typename Vtable_T::call_sig get_cached_Vtable_hip_device_call()
 {
@@ -30,6 +30,8 @@
 #include "RAJA/util/TypeConvert.hpp"
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/policy/atomic_builtin.hpp"
+
 
 namespace RAJA
 {
@@ -664,6 +666,124 @@ atomicCAS(hip_atomic, T volatile *acc, T compare, T value)
   return detail::hip_atomicCAS(acc, compare, value);
 }
 
+
+#ifdef __HIP_DEVICE_COMPILE__
+
+namespace detail
+{
+
+//
+// HIP atomics are relaxed; stronger orders are built by fencing before
+// (release side) and after (acquire side) the operation. The relaxed
+// order issues no fence, which is what spin-wait signaling wants.
+//
+
+RAJA_INLINE __device__ void hip_release_fence(atomic_order::relaxed) {}
+RAJA_INLINE __device__ void hip_release_fence(atomic_order::acquire) {}
+RAJA_INLINE __device__ void hip_release_fence(atomic_order::release)
+{
+  __threadfence();
+}
+RAJA_INLINE __device__ void hip_release_fence(atomic_order::acq_rel)
+{
+  __threadfence();
+}
+RAJA_INLINE __device__ void hip_release_fence(atomic_order::seq_cst)
+{
+  __threadfence();
+}
+
+RAJA_INLINE __device__ void hip_acquire_fence(atomic_order::relaxed) {}
+RAJA_INLINE __device__ void hip_acquire_fence(atomic_order::release) {}
+RAJA_INLINE __device__ void hip_acquire_fence(atomic_order::acquire)
+{
+  __threadfence();
+}
+RAJA_INLINE __device__ void hip_acquire_fence(atomic_order::acq_rel)
+{
+  __threadfence();
+}
+RAJA_INLINE __device__ void hip_acquire_fence(atomic_order::seq_cst)
+{
+  __threadfence();
+}
+
+}  // namespace detail
+
+#endif  // __HIP_DEVICE_COMPILE__
+
+
+//
+// Ordered operations, selected by an atomic_order tag. These are atomic
+// in hip device code and non-atomic otherwise, like the operations above.
+//
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicLoad(hip_atomic, Order, T volatile *acc)
+{
+#ifdef __HIP_DEVICE_COMPILE__
+  T old = *acc;
+  detail::hip_acquire_fence(Order{});
+  return old;
+#else
+  return *acc;
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE void atomicStore(hip_atomic,
+                                              Order,
+                                              T volatile *acc,
+                                              T value)
+{
+#ifdef __HIP_DEVICE_COMPILE__
+  detail::hip_release_fence(Order{});
+  *acc = value;
+#else
+  *acc = value;
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicExchange(hip_atomic,
+                                              Order,
+                                              T volatile *acc,
+                                              T value)
+{
+#ifdef __HIP_DEVICE_COMPILE__
+  detail::hip_release_fence(Order{});
+  T old = detail::hip_atomicExchange(acc, value);
+  detail::hip_acquire_fence(Order{});
+  return old;
+#else
+  T old = *acc;
+  *acc = value;
+  return old;
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicAdd(hip_atomic,
+                                         Order,
+                                         T volatile *acc,
+                                         T value)
+{
+#ifdef __HIP_DEVICE_COMPILE__
+  detail::hip_release_fence(Order{});
+  T old = detail::hip_atomicAdd(acc, value);
+  detail::hip_acquire_fence(Order{});
+  return old;
+#else
+  T old = *acc;
+  *acc = old + value;
+  return old;
+#endif
+}
+
 }  // namespace RAJA
 
 
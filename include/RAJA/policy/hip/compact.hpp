@@ -0,0 +1,226 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing HIP RAJA stream compaction.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_hip_HPP
+#define RAJA_compact_hip_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <iterator>
+
+#if defined(__HIPCC__)
+#define ROCPRIM_HIP_API 1
+#include "rocprim/device/device_partition.hpp"
+#include "rocprim/device/device_select.hpp"
+#elif defined(__CUDACC__)
+#include "cub/device/device_partition.cuh"
+#include "cub/device/device_select.cuh"
+#endif
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+/*!
+        \brief single-pass device-wide copy_if via rocprim::select
+
+        The select runs in one pass over the input; no flags array or
+        separate scan is involved. The count is returned on the host,
+        so the call synchronizes even for Async policies.
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Predicate>
+Index_type copy_if(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+                   InputIter begin,
+                   InputIter end,
+                   OutputIter out,
+                   Predicate pred)
+{
+  hipStream_t stream = 0;
+
+  int len = std::distance(begin, end);
+  int* d_num_selected =
+      hip::device_mempool_type::getInstance().malloc<int>(1);
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::select(d_temp_storage,
+                              temp_storage_bytes,
+                              begin,
+                              out,
+                              d_num_selected,
+                              len,
+                              pred,
+                              stream));
+#elif defined(__CUDACC__)
+  hipErrchk(::cub::DeviceSelect::If(d_temp_storage,
+                                    temp_storage_bytes,
+                                    begin,
+                                    out,
+                                    d_num_selected,
+                                    len,
+                                    pred,
+                                    stream));
+#endif
+  // Allocate temporary storage
+  d_temp_storage =
+      hip::device_mempool_type::getInstance().malloc<unsigned char>(
+          temp_storage_bytes);
+  // Run
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::select(d_temp_storage,
+                              temp_storage_bytes,
+                              begin,
+                              out,
+                              d_num_selected,
+                              len,
+                              pred,
+                              stream));
+#elif defined(__CUDACC__)
+  hipErrchk(::cub::DeviceSelect::If(d_temp_storage,
+                                    temp_storage_bytes,
+                                    begin,
+                                    out,
+                                    d_num_selected,
+                                    len,
+                                    pred,
+                                    stream));
+#endif
+  // Free temporary storage
+  hip::device_mempool_type::getInstance().free(d_temp_storage);
+
+  hip::launch(stream);
+
+  int num_selected = 0;
+  hipErrchk(hipMemcpy(&num_selected,
+                      d_num_selected,
+                      sizeof(int),
+                      hipMemcpyDeviceToHost));
+  hip::device_mempool_type::getInstance().free(d_num_selected);
+
+  return static_cast<Index_type>(num_selected);
+}
+
+/*!
+        \brief single-pass device-wide partition via rocprim::partition
+
+        Selected elements are written to the front of the output in
+        order; rejected elements are written in reverse order at the
+        end, matching the cub/rocprim partition output layout.
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Predicate>
+Index_type partition(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+                     InputIter begin,
+                     InputIter end,
+                     OutputIter out,
+                     Predicate pred)
+{
+  hipStream_t stream = 0;
+
+  int len = std::distance(begin, end);
+  int* d_num_selected =
+      hip::device_mempool_type::getInstance().malloc<int>(1);
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::partition(d_temp_storage,
+                                 temp_storage_bytes,
+                                 begin,
+                                 out,
+                                 d_num_selected,
+                                 len,
+                                 pred,
+                                 stream));
+#elif defined(__CUDACC__)
+  hipErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                       temp_storage_bytes,
+                                       begin,
+                                       out,
+                                       d_num_selected,
+                                       len,
+                                       pred,
+                                       stream));
+#endif
+  // Allocate temporary storage
+  d_temp_storage =
+      hip::device_mempool_type::getInstance().malloc<unsigned char>(
+          temp_storage_bytes);
+  // Run
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::partition(d_temp_storage,
+                                 temp_storage_bytes,
+                                 begin,
+                                 out,
+                                 d_num_selected,
+                                 len,
+                                 pred,
+                                 stream));
+#elif defined(__CUDACC__)
+  hipErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                       temp_storage_bytes,
+                                       begin,
+                                       out,
+                                       d_num_selected,
+                                       len,
+                                       pred,
+                                       stream));
+#endif
+  // Free temporary storage
+  hip::device_mempool_type::getInstance().free(d_temp_storage);
+
+  hip::launch(stream);
+
+  int num_selected = 0;
+  hipErrchk(hipMemcpy(&num_selected,
+                      d_num_selected,
+                      sizeof(int),
+                      hipMemcpyDeviceToHost));
+  hip::device_mempool_type::getInstance().free(d_num_selected);
+
+  return static_cast<Index_type>(num_selected);
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_HIP guard
+
+#endif  // closing endif for header file include guard
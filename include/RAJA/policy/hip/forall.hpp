@@ -166,6 +166,8 @@ RAJA_INLINE resources::EventProxy<resources::Hip> forall_impl(resources::Hip &hi
   using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
 
   auto func = impl::forall_hip_kernel<BlockSize, Iterator, LOOP_BODY, IndexType>;
+  RAJA_HIP_REGISTER_KERNEL(
+      impl::forall_hip_kernel<BlockSize, Iterator, LOOP_BODY, IndexType>);
 
   hipStream_t stream = hip_res.get_stream();
 
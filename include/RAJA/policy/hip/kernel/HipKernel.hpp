@@ -23,12 +23,15 @@
 
 #if defined(RAJA_ENABLE_HIP)
 
+#include <array>
 #include <cassert>
 #include <climits>
+#include <map>
 
 #include "camp/camp.hpp"
 
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/kernel.hpp"
@@ -235,6 +238,24 @@ struct HipKernelLauncherGetter<0, Data, executor_t>
 };
 
 
+/*!
+ * Helper functions to extract the launch stream from the resource carried
+ * in the LoopData object. Kernels launched through kernel/kernel_param
+ * carry a Host resource and use the default stream.
+ */
+RAJA_INLINE
+hipStream_t get_hip_stream(RAJA::resources::Hip &res)
+{
+  return res.get_stream();
+}
+
+template <typename Resource>
+RAJA_INLINE hipStream_t get_hip_stream(Resource &)
+{
+  return hipStream_t(0);
+}
+
+
 
 /*!
  * Helper class that handles HIP kernel launching, and computing
@@ -366,6 +387,10 @@ struct HipLaunchHelper<hip_launch<async0, num_blocks, num_threads>,StmtList,Data
   {
     auto func = kernelGetter_t::get();
 
+    // the getter type keys static-init registration of this kernel for
+    // ahead-of-time warmup through RAJA::preload_kernels
+    (void)::RAJA::hip::detail::KernelRegistrar<kernelGetter_t>::s_registered;
+
     RAJA::hip::launch(func, launch_dims.blocks, launch_dims.threads, std::move(data), shmem, stream);
   }
 };
@@ -448,10 +473,32 @@ struct StatementExecutor<
     using launch_t = HipLaunchHelper<LaunchConfig, stmt_list_t, data_t, Types>;
 
 
+    //
+    // Look for launch dimensions cached from a previous invocation at
+    // this call site with the same segment extents.  The cache variable
+    // is a function-local static of this template instantiation, so it
+    // is keyed on the statement tree and loop data types; the map keys
+    // on the extents themselves.  A hit skips both the statement tree
+    // walk and the occupancy calculator queries below.
+    //
+    static constexpr size_t num_segments =
+        camp::tuple_size<typename data_t::segment_tuple_t>::value;
+    using extents_t = std::array<Index_type, num_segments>;
+
+    extents_t extents =
+        get_segment_extents(data, camp::make_idx_seq_t<num_segments>{});
+
+    thread_local static std::map<extents_t, LaunchDims> launch_dims_cache;
+
+    auto cache_entry = launch_dims_cache.find(extents);
+    bool cache_hit = (cache_entry != launch_dims_cache.end());
+
+
     //
     // Compute the requested kernel dimensions
     //
-    LaunchDims launch_dims = executor_t::calculateDimensions(data);
+    LaunchDims launch_dims = cache_hit ? cache_entry->second
+                                       : executor_t::calculateDimensions(data);
 
 
     // Only launch kernel if we have something to iterate over
@@ -463,86 +510,94 @@ struct StatementExecutor<
       // Setup shared memory buffers
       //
       int shmem = 0;
-      hipStream_t stream = 0;
+      hipStream_t stream = get_hip_stream(data.res);
 
+      if (!cache_hit) {
 
-      //
-      // Compute the recommended physical kernel blocks and threads
-      //
-      int recommended_blocks, recommended_threads;
-      launch_t::recommended_blocks_threads(
-          shmem, recommended_blocks, recommended_threads);
+        //
+        // Compute the recommended physical kernel blocks and threads
+        //
+        int recommended_blocks, recommended_threads;
+        launch_t::recommended_blocks_threads(
+            shmem, recommended_blocks, recommended_threads);
 
 
-      //
-      // Compute the MAX physical kernel threads
-      //
-      int max_threads;
-      launch_t::max_threads(shmem, max_threads);
+        //
+        // Compute the MAX physical kernel threads
+        //
+        int max_threads;
+        launch_t::max_threads(shmem, max_threads);
 
 
-      //
-      // Fit the requested threads
-      //
-      hip_dim_t fit_threads{0,0,0};
+        //
+        // Fit the requested threads
+        //
+        hip_dim_t fit_threads{0,0,0};
 
-      if ( recommended_threads >= get_size(launch_dims.min_threads) ) {
+        if ( recommended_threads >= get_size(launch_dims.min_threads) ) {
 
-        fit_threads = fitHipDims(
-            recommended_threads, launch_dims.threads, launch_dims.min_threads);
+          fit_threads = fitHipDims(
+              recommended_threads, launch_dims.threads, launch_dims.min_threads);
 
-      }
+        }
 
-      //
-      // Redo fit with max threads
-      //
-      if ( recommended_threads < max_threads &&
-           get_size(fit_threads) != recommended_threads ) {
+        //
+        // Redo fit with max threads
+        //
+        if ( recommended_threads < max_threads &&
+             get_size(fit_threads) != recommended_threads ) {
 
-        fit_threads = fitHipDims(
-            max_threads, launch_dims.threads, launch_dims.min_threads);
+          fit_threads = fitHipDims(
+              max_threads, launch_dims.threads, launch_dims.min_threads);
 
-      }
+        }
 
-      launch_dims.threads = fit_threads;
+        launch_dims.threads = fit_threads;
 
 
-      //
-      // Compute the MAX physical kernel blocks
-      //
-      int max_blocks;
-      launch_t::max_blocks(shmem, max_blocks, launch_dims.num_threads());
+        //
+        // Compute the MAX physical kernel blocks
+        //
+        int max_blocks;
+        launch_t::max_blocks(shmem, max_blocks, launch_dims.num_threads());
 
-      int use_blocks;
+        int use_blocks;
 
-      if ( launch_dims.num_threads() == recommended_threads ) {
+        if ( launch_dims.num_threads() == recommended_threads ) {
 
-        //
-        // Fit the requested blocks
-        //
-        use_blocks = recommended_blocks;
+          //
+          // Fit the requested blocks
+          //
+          use_blocks = recommended_blocks;
 
-      } else {
+        } else {
 
-        //
-        // Fit the max blocks
-        //
-        use_blocks = max_blocks;
+          //
+          // Fit the max blocks
+          //
+          use_blocks = max_blocks;
 
-      }
+        }
 
-      launch_dims.blocks = fitHipDims(
-          use_blocks, launch_dims.blocks, launch_dims.min_blocks);
+        launch_dims.blocks = fitHipDims(
+            use_blocks, launch_dims.blocks, launch_dims.min_blocks);
 
-      //
-      // make sure that we fit
-      //
-      /* Doesn't make sense to check this anymore - AJK
-      if(launch_dims.num_blocks() > max_blocks){
-        RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num blocks");
-      }*/
-      if(launch_dims.num_threads() > max_threads){
-        RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num threads");
+        //
+        // make sure that we fit
+        //
+        /* Doesn't make sense to check this anymore - AJK
+        if(launch_dims.num_blocks() > max_blocks){
+          RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num blocks");
+        }*/
+        if(launch_dims.num_threads() > max_threads){
+          RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num threads");
+        }
+
+        //
+        // Remember the fitted dimensions for the next invocation with
+        // these extents
+        //
+        launch_dims_cache[extents] = launch_dims;
       }
 
       {
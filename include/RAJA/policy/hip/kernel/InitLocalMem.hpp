@@ -57,8 +57,9 @@ struct HipStatementExecutor<Data, statement::InitLocalMem<RAJA::hip_shared_mem,
   {
     using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::element_t;
     const camp::idx_t NumElem = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::NumElem;
+    const camp::idx_t Alignment = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::Alignment;
 
-    __shared__ varType Array[NumElem];
+    __shared__ alignas(Alignment) varType Array[NumElem];
     camp::get<Pos>(data.param_tuple).m_arrayPtr = Array;
 
     enclosed_stmts_t::exec(data, thread_active);
@@ -74,8 +75,9 @@ struct HipStatementExecutor<Data, statement::InitLocalMem<RAJA::hip_shared_mem,
   {
     using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::element_t;
     const camp::idx_t NumElem = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::NumElem;
+    const camp::idx_t Alignment = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::Alignment;
 
-    __shared__ varType Array[NumElem];
+    __shared__ alignas(Alignment) varType Array[NumElem];
     camp::get<Pos>(data.param_tuple).m_arrayPtr = Array;
     initMem<other0, others...>(data, thread_active);
   }
@@ -146,8 +148,9 @@ struct HipStatementExecutor<Data, statement::InitLocalMem<RAJA::hip_thread_mem,
   {
     using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::element_t;
     const camp::idx_t NumElem = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::NumElem;
+    const camp::idx_t Alignment = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::Alignment;
 
-    varType Array[NumElem];
+    alignas(Alignment) varType Array[NumElem];
     camp::get<Pos>(data.param_tuple).m_arrayPtr = Array;
 
     enclosed_stmts_t::exec(data, thread_active);
@@ -163,8 +166,9 @@ struct HipStatementExecutor<Data, statement::InitLocalMem<RAJA::hip_thread_mem,
   {
     using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::element_t;
     const camp::idx_t NumElem = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::NumElem;
+    const camp::idx_t Alignment = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::Alignment;
 
-    varType Array[NumElem];
+    alignas(Alignment) varType Array[NumElem];
     camp::get<Pos>(data.param_tuple).m_arrayPtr = Array;
     initMem<other0, others...>(data, thread_active);
   }
@@ -218,6 +222,37 @@ struct HipStatementExecutor<Data, statement::InitLocalMem<RAJA::hip_thread_mem,
 };
 
 
+//Swap the storage of two local arrays, for double buffering shared
+//memory tiles. Every thread swaps the pointers in its private copy of
+//the param tuple, so no synchronization is performed here; place a
+//HipSyncThreads before the swap to order it against the loads and
+//stores of the buffers.
+template <typename Data, camp::idx_t Pos0, camp::idx_t Pos1, typename Types>
+struct HipStatementExecutor<Data, statement::SwapLocalMem<Pos0, Pos1>, Types>
+{
+
+  static
+  inline
+  RAJA_DEVICE
+  void exec(Data &data, bool)
+  {
+    auto tmp = camp::get<Pos0>(data.param_tuple).m_arrayPtr;
+    camp::get<Pos0>(data.param_tuple).m_arrayPtr =
+        camp::get<Pos1>(data.param_tuple).m_arrayPtr;
+    camp::get<Pos1>(data.param_tuple).m_arrayPtr = tmp;
+  }
+
+
+  inline
+  static
+  LaunchDims calculateDimensions(Data const & RAJA_UNUSED_ARG(data))
+  {
+    return LaunchDims();
+  }
+
+};
+
+
 
 }  // namespace internal
 }  // end namespace RAJA
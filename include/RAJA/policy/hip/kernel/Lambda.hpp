@@ -62,6 +62,28 @@ struct HipStatementExecutor<Data, statement::Lambda<LambdaIndex, Args...>, Types
 };
 
 
+template <typename Data, camp::idx_t LambdaIndex, typename... Args, typename Types>
+struct HipStatementExecutor<Data, statement::FissionLambda<LambdaIndex, Args...>, Types> {
+
+  static
+  inline RAJA_DEVICE void exec(Data &data, bool thread_active)
+  {
+    // Only execute the lambda if it hasn't been masked off
+    if(thread_active){
+      StatementExecutor<statement::FissionLambda<LambdaIndex, Args...>, Types>::exec(data);
+    }
+  }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const & RAJA_UNUSED_ARG(data))
+  {
+    return LaunchDims();
+  }
+};
+
+
 
 
 }  // namespace internal
@@ -0,0 +1,190 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA masked forall declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_masked_forall_hip_HPP
+#define RAJA_masked_forall_hip_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <utility>
+
+#include "RAJA/util/BitMask.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+
+namespace RAJA
+{
+
+namespace hip
+{
+
+namespace impl
+{
+
+/*!
+        \brief rank-th (1-based) set bit of a word by binary search on
+   popcounts of successively narrower low halves
+*/
+RAJA_DEVICE RAJA_INLINE int nth_set_bit(BitSetWord w, int rank)
+{
+  int pos = 0;
+  for (int width = 32; width > 0; width >>= 1) {
+    const BitSetWord low = (1ull << width) - 1ull;
+    const int cnt = __popcll(w & low);
+    if (rank > cnt) {
+      rank -= cnt;
+      w >>= width;
+      pos += width;
+    } else {
+      w &= low;
+    }
+  }
+  return pos;
+}
+
+/*!
+        \brief warp-compacted masked forall kernel
+
+   Each warp owns WARP_SIZE consecutive iterates and reads their
+   activity bits from the mask in one word access. The warp places its
+   active iterates on its low lanes: lane l executes the (l+1)-th
+   active iterate, so a warp with k active iterates retires after k
+   lanes of work instead of running full width with most lanes
+   branching out. Warps whose iterates are all inactive exit on the
+   word test without calling the body.
+*/
+template <size_t BlockSize,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__launch_bounds__(BlockSize, 1) __global__
+    void masked_forall_hip_kernel(LOOP_BODY loop_body,
+                                  const Iterator idx,
+                                  const BitSetWord* mask_words,
+                                  IndexType length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+
+  const IndexType ii =
+      static_cast<IndexType>(blockIdx.x) * blockDim.x + threadIdx.x;
+  const int lane = threadIdx.x & (policy::hip::WARP_SIZE - 1);
+  const IndexType warp_base = ii - static_cast<IndexType>(lane);
+  if (warp_base >= length) {
+    return;
+  }
+
+  // this warp's WARP_SIZE activity bits; warp bases are WARP_SIZE
+  // aligned, so a warp's bits are a whole 64-bit mask word (wavefront
+  // size 64) or an aligned half of one (warp size 32)
+  constexpr IndexType wbits =
+      static_cast<IndexType>(BitSetView::bits_per_word);
+  BitSetWord m = mask_words[warp_base / wbits] >> (warp_base % wbits);
+  if (static_cast<IndexType>(policy::hip::WARP_SIZE) < wbits) {
+    m &= (1ull << policy::hip::WARP_SIZE) - 1ull;
+  }
+
+  // ignore bits past the end of the iteration space
+  if (length - warp_base < static_cast<IndexType>(policy::hip::WARP_SIZE)) {
+    m &= (1ull << (length - warp_base)) - 1ull;
+  }
+
+  const int nactive = __popcll(m);
+  if (lane < nactive) {
+    const int b = nth_set_bit(m, lane + 1);
+    body(idx[warp_base + static_cast<IndexType>(b)]);
+  }
+}
+
+}  // namespace impl
+
+}  // namespace hip
+
+namespace impl
+{
+namespace masked
+{
+
+/*!
+        \brief masked forall via warp compaction of the active iterates
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename Iterator,
+          typename LoopBody>
+void forall(resources::Hip& hip_res,
+            const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+            Iterator begin,
+            Index_type length,
+            const BitSetView& mask,
+            LoopBody&& loop_body)
+{
+  using LOOP_BODY = camp::decay<LoopBody>;
+
+  hipStream_t stream = hip_res.get_stream();
+
+  hip_dim_t blockSize{BLOCK_SIZE, 1, 1};
+  hip_dim_t gridSize{static_cast<hip_dim_member_t>(
+                         (length + static_cast<Index_type>(BLOCK_SIZE) - 1) /
+                         static_cast<Index_type>(BLOCK_SIZE)),
+                     1, 1};
+
+  RAJA_FT_BEGIN;
+
+  size_t shmem = 0;
+
+  {
+    //
+    // Privatize the loop_body, using make_launch_body to setup reductions
+    //
+    LOOP_BODY body = RAJA::hip::make_launch_body(
+        gridSize, blockSize, shmem, stream,
+        std::forward<LoopBody>(loop_body));
+
+    hipLaunchKernelGGL(
+        (hip::impl::masked_forall_hip_kernel<BLOCK_SIZE, Iterator, LOOP_BODY,
+                                             Index_type>),
+        gridSize, blockSize, shmem, stream, body, begin, mask.words, length);
+    hipErrchk(hipPeekAtLastError());
+  }
+
+  hip::launch(stream);
+  if (!Async) hip::synchronize(stream);
+
+  RAJA_FT_END;
+}
+
+}  // namespace masked
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing check for RAJA_ENABLE_HIP
+
+#endif  // closing endif for header file include guard
@@ -154,9 +154,14 @@ union AsIntegerArray {
   }
 };
 
-// hip only has shfl primitives for 32 bits
+// rocm has shfl primitives for 32 and 64 bits, hip on a cuda
+// platform only has them for 32 bits
 constexpr const size_t min_shfl_int_type_size = sizeof(int);
+#if defined(__HIP_PLATFORM_HCC__)
+constexpr const size_t max_shfl_int_type_size = sizeof(long long);
+#else
 constexpr const size_t max_shfl_int_type_size = sizeof(int);
+#endif
 
 /*!
  ******************************************************************************
@@ -309,7 +314,9 @@ RAJA_DEVICE RAJA_INLINE T block_reduce(T val, T identity)
         temp = identity;
       }
 
-      for (int i = 1; i < policy::hip::WARP_SIZE; i *= 2) {
+      // there are at most MAX_WARPS per warp values, so with wide
+      // wavefronts this tree is shorter than a full wavefront reduction
+      for (int i = 1; i < policy::hip::MAX_WARPS; i *= 2) {
         T rhs = shfl_xor_sync(temp, i);
         Combiner{}(temp, rhs);
       }
@@ -549,9 +556,7 @@ public:
   //! get new value for use in stream
   T* new_value(hipStream_t stream)
   {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    lock_guard<RAJA::mutex> lock(m_mutex);
     StreamNode* sn = stream_list;
     while (sn) {
       if (sn->stream == stream) break;
@@ -596,14 +601,72 @@ public:
 
   ~PinnedTally() { free_list(); }
 
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-  omp::mutex m_mutex;
-#endif
+  RAJA::mutex m_mutex;
 
 private:
   StreamNode* stream_list;
 };
 
+//! Kernel that folds per-launch tally values into a device-resident result.
+//  The tally values live in pinned memory, which is device-visible, so
+//  vals holds their addresses and no copy to device memory is needed.
+template <typename Combiner, typename T>
+__global__ void device_value_fold(T init_val,
+                                  T* const* vals,
+                                  int num_vals,
+                                  T* device_result)
+{
+  T temp = init_val;
+  for (int i = 0; i < num_vals; ++i) {
+    Combiner{}(temp, *vals[i]);
+  }
+  *device_result = temp;
+}
+
+//! Handle owning a device-resident copy of a reducer's final value.
+//  device_ptr() is consumable by kernels launched on the resource the
+//  value was produced on, or any stream ordered after it, without a
+//  host round trip. The handle returns its buffers to the mempools on
+//  destruction; destroy it only after the consuming work is done.
+template <typename T>
+class DeviceValue
+{
+public:
+  DeviceValue() = delete;
+
+  DeviceValue(T* device_val, T** pinned_ptrs)
+      : m_device_val(device_val), m_pinned_ptrs(pinned_ptrs)
+  {
+  }
+
+  DeviceValue(DeviceValue const&) = delete;
+  DeviceValue& operator=(DeviceValue const&) = delete;
+
+  DeviceValue(DeviceValue&& other)
+      : m_device_val(other.m_device_val), m_pinned_ptrs(other.m_pinned_ptrs)
+  {
+    other.m_device_val = nullptr;
+    other.m_pinned_ptrs = nullptr;
+  }
+
+  ~DeviceValue()
+  {
+    if (m_device_val) {
+      device_mempool_type::getInstance().free(m_device_val);
+    }
+    if (m_pinned_ptrs) {
+      pinned_mempool_type::getInstance().free(m_pinned_ptrs);
+    }
+  }
+
+  //! device pointer to the final value
+  T* device_ptr() const { return m_device_val; }
+
+private:
+  T* m_device_val;
+  T** m_pinned_ptrs;
+};
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -622,6 +685,7 @@ struct Reduce_Data {
   unsigned int* device_count;
   RAJA::detail::SoAPtr<T, device_mempool_type> device;
   bool own_device_ptr;
+  bool batch_combine;
 
   Reduce_Data() : Reduce_Data(T(), T()){};
 
@@ -635,7 +699,8 @@ struct Reduce_Data {
         identity{identity_},
         device_count{nullptr},
         device{},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        batch_combine{false}
   {
   }
 
@@ -645,6 +710,7 @@ struct Reduce_Data {
     identity = identity_;
     device_count = nullptr;
     own_device_ptr = false;
+    batch_combine = false;
   }
 
   RAJA_HOST_DEVICE
@@ -653,7 +719,8 @@ struct Reduce_Data {
         identity{other.identity},
         device_count{other.device_count},
         device{other.device},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        batch_combine{other.batch_combine}
   {
   }
 
@@ -662,13 +729,19 @@ struct Reduce_Data {
   void init_grid_val(T* output) { *output = identity; }
 
   //! reduce values in grid to single value, store in output
+  //  inside an accumulation window the output slot is shared by the
+  //  window's stream-ordered launches, so fold into it instead of storing
   RAJA_DEVICE
   void grid_reduce(T* output)
   {
     T temp = value;
 
     if (impl::grid_reduce<Combiner>(temp, identity, device, device_count)) {
-      *output = temp;
+      if (batch_combine) {
+        Combiner{}(*output, temp);
+      } else {
+        *output = temp;
+      }
     }
   }
 
@@ -713,6 +786,7 @@ struct ReduceAtomic_Data {
   unsigned int* device_count;
   T* device;
   bool own_device_ptr;
+  bool batch_combine;
 
   ReduceAtomic_Data() : ReduceAtomic_Data(T(), T()){};
 
@@ -721,7 +795,8 @@ struct ReduceAtomic_Data {
         identity{identity_},
         device_count{nullptr},
         device{nullptr},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        batch_combine{false}
   {
   }
 
@@ -732,6 +807,7 @@ struct ReduceAtomic_Data {
     device_count = nullptr;
     device = nullptr;
     own_device_ptr = false;
+    batch_combine = false;
   }
 
   RAJA_HOST_DEVICE
@@ -740,7 +816,8 @@ struct ReduceAtomic_Data {
         identity{other.identity},
         device_count{other.device_count},
         device{other.device},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        batch_combine{other.batch_combine}
   {
   }
 
@@ -749,6 +826,8 @@ struct ReduceAtomic_Data {
   void init_grid_val(T* output) { *output = identity; }
 
   //! reduce values in grid to single value, store in output
+  //  inside an accumulation window the output slot is shared by the
+  //  window's stream-ordered launches, so fold into it instead of storing
   RAJA_DEVICE
   void grid_reduce(T* output)
   {
@@ -756,7 +835,11 @@ struct ReduceAtomic_Data {
 
     if (impl::grid_reduce_atomic<Combiner>(
             temp, identity, device, device_count)) {
-      *output = temp;
+      if (batch_combine) {
+        Combiner{}(*output, temp);
+      } else {
+        *output = temp;
+      }
     }
   }
 
@@ -802,14 +885,41 @@ public:
   explicit Reduce(T init_val, T identity_ = Combiner::identity())
       : parent{this},
         tally_or_val_ptr{new PinnedTally<T>},
-        val(init_val, identity_)
+        val(init_val, identity_),
+        batch_open{false},
+        batch_val_ptr{nullptr},
+        batch_stream{0}
   {
   }
 
+  //! reset the reducer for reuse without reallocation
+  //  combines and releases outstanding tally values, then re-initializes
+  //  in place; the tally and device memory stay cached for the next launch
   void reset(T in_val, T identity_ = Combiner::identity())
   {
     operator T();  // syncs device
-    val = reduce_data_type(in_val, identity_);
+    val.reset(in_val, identity_);
+  }
+
+  //! open an accumulation window spanning several kernel launches
+  //  launches made before the matching end_batch() fold into one shared
+  //  tally slot per stream instead of taking a fresh slot apiece, so a
+  //  residual norm accumulated across many foralls pays for one slot and
+  //  one combine at get() rather than one per launch; callable only from
+  //  the host on the original object
+  void begin_batch()
+  {
+    batch_open = true;
+    batch_val_ptr = nullptr;
+  }
+
+  //! close an accumulation window opened with begin_batch()
+  //  the shared slot stays in the tally until get() performs the single
+  //  deferred finalization for the whole window
+  void end_batch()
+  {
+    batch_open = false;
+    batch_val_ptr = nullptr;
   }
 
   //! copy and on host attempt to setup for device
@@ -823,14 +933,32 @@ public:
       : parent{&other},
 #endif
         tally_or_val_ptr{other.tally_or_val_ptr},
-        val(other.val)
+        val(other.val),
+        batch_open{other.batch_open},
+        batch_val_ptr{nullptr},
+        batch_stream{0}
   {
 #if !defined(RAJA_DEVICE_CODE)
     if (parent) {
       if (val.setupForDevice()) {
-        tally_or_val_ptr.val_ptr =
-            tally_or_val_ptr.list->new_value(currentStream());
-        val.init_grid_val(tally_or_val_ptr.val_ptr);
+        if (parent->batch_open) {
+          // reuse the window's shared slot for this stream; kernels on a
+          // stream are ordered, so the launch's grid reduce may fold into
+          // the slot in place
+          hipStream_t stream = currentStream();
+          if (parent->batch_val_ptr == nullptr ||
+              parent->batch_stream != stream) {
+            parent->batch_val_ptr = tally_or_val_ptr.list->new_value(stream);
+            parent->batch_stream = stream;
+            val.init_grid_val(parent->batch_val_ptr);
+          }
+          tally_or_val_ptr.val_ptr = parent->batch_val_ptr;
+          val.batch_combine = true;
+        } else {
+          tally_or_val_ptr.val_ptr =
+              tally_or_val_ptr.list->new_value(currentStream());
+          val.init_grid_val(tally_or_val_ptr.val_ptr);
+        }
         parent = nullptr;
       }
     }
@@ -848,9 +976,7 @@ public:
       tally_or_val_ptr.list = nullptr;
     } else if (parent) {
       if (val.value != val.identity) {
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-        lock_guard<omp::mutex> lock(tally_or_val_ptr.list->m_mutex);
-#endif
+        lock_guard<RAJA::mutex> lock(tally_or_val_ptr.list->m_mutex);
         parent->combine(val.value);
       }
     } else {
@@ -878,12 +1004,61 @@ public:
         Combiner{}(val.value, *n);
       }
       tally_or_val_ptr.list->free_list();
+      batch_val_ptr = nullptr;
     }
     return val.value;
   }
   //! alias for operator T()
   T get() { return operator T(); }
 
+  //! produce a device-resident copy of the final value on the given
+  //  resource without a host round trip. The resource's stream is ordered
+  //  behind every stream this reducer launched on, then a single-thread
+  //  kernel folds the pinned per-launch values together with the host-side
+  //  value into device memory. The returned handle's device_ptr() may be
+  //  consumed directly by subsequent kernels on the same resource. Host
+  //  combines made after this call are not reflected in the device value.
+  template <typename Resource>
+  DeviceValue<T> get_device(Resource& res)
+  {
+    hipStream_t stream = res.get_stream();
+
+    // order the consuming stream behind each stream with outstanding
+    // per-launch values, without stalling the host
+    auto s_end = tally_or_val_ptr.list->streamEnd();
+    for (auto s = tally_or_val_ptr.list->streamBegin(); s != s_end; ++s) {
+      if (*s != stream) {
+        hipEvent_t event;
+        hipErrchk(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+        hipErrchk(hipEventRecord(event, *s));
+        hipErrchk(hipStreamWaitEvent(stream, event, 0));
+        hipErrchk(hipEventDestroy(event));
+      }
+    }
+
+    // gather device-visible addresses of the pinned per-launch values;
+    // the values themselves are never read on the host here
+    int num_vals = 0;
+    auto n_end = tally_or_val_ptr.list->end();
+    for (auto n = tally_or_val_ptr.list->begin(); n != n_end; ++n) {
+      ++num_vals;
+    }
+    T** ptrs = pinned_mempool_type::getInstance().template malloc<T*>(
+        num_vals > 0 ? num_vals : 1);
+    int iv = 0;
+    for (auto n = tally_or_val_ptr.list->begin(); n != n_end; ++n) {
+      ptrs[iv++] = &(*n);
+    }
+
+    T* device_val = device_mempool_type::getInstance().template malloc<T>(1);
+    hipLaunchKernelGGL((device_value_fold<Combiner, T>), dim3(1), dim3(1), 0,
+                       stream, val.value, (T* const*)ptrs, num_vals,
+                       device_val);
+    hipErrchk(hipPeekAtLastError());
+
+    return DeviceValue<T>(device_val, ptrs);
+  }
+
   //! apply reduction (const version) -- still combines internal values
   RAJA_HOST_DEVICE
   void combine(T other) const { Combiner{}(val.value, other); }
@@ -917,6 +1092,12 @@ private:
 
   //! storage for reduction data
   reduce_data_type val;
+
+  //! accumulation window state, written through the original object's
+  //  parent pointer while capturing copies set up for launch
+  bool batch_open;
+  mutable T* batch_val_ptr;
+  mutable hipStream_t batch_stream;
 };
 
 }  // end namespace hip
@@ -1030,6 +1211,13 @@ public:
       : Base(value_type(init_val, init_idx))
   {
   }
+  //! reset the reducer with a new value and location, reusing its memory
+  void reset(T init_val,
+             IndexType init_idx =
+                 RAJA::reduce::detail::DefaultLoc<IndexType>().value())
+  {
+    Base::reset(value_type(init_val, init_idx));
+  }
   //! reducer function; updates the current instance's state
   RAJA_HOST_DEVICE
   const ReduceMinLoc& minloc(T rhs, IndexType loc) const
@@ -1067,6 +1255,13 @@ public:
       : Base(value_type(init_val, init_idx))
   {
   }
+  //! reset the reducer with a new value and location, reusing its memory
+  void reset(T init_val,
+             IndexType init_idx =
+                 RAJA::reduce::detail::DefaultLoc<IndexType>().value())
+  {
+    Base::reset(value_type(init_val, init_idx));
+  }
   //! reducer function; updates the current instance's state
   RAJA_HOST_DEVICE
   const ReduceMaxLoc& maxloc(T rhs, IndexType loc) const
@@ -1085,6 +1280,61 @@ public:
   T get() { return Base::get(); }
 };
 
+//! specialization of ReduceComposite for hip_reduce
+template <bool maybe_atomic, typename T, template <typename> class... ReduceOps>
+class ReduceComposite<hip_reduce_base<maybe_atomic>, T, ReduceOps...>
+    : public hip::Reduce<
+          RAJA::reduce::composite<
+              RAJA::reduce::detail::CompositeValue<T, ReduceOps<T>...>>,
+          RAJA::reduce::detail::CompositeValue<T, ReduceOps<T>...>,
+          maybe_atomic>
+{
+public:
+  using value_type = RAJA::reduce::detail::CompositeValue<T, ReduceOps<T>...>;
+  using Base = hip::
+      Reduce<RAJA::reduce::composite<value_type>, value_type, maybe_atomic>;
+  using Base::Base;
+
+  //! constructor folding an initial operand into every component
+  explicit ReduceComposite(T init_val) : Base(value_type(init_val)) {}
+
+  //! reset the reducer with a new operand, reusing its memory
+  void reset(T init_val) { Base::reset(value_type(init_val)); }
+
+  //! reducer function; folds the operand into every component
+  RAJA_HOST_DEVICE
+  const ReduceComposite& combine(T rhs) const
+  {
+    Base::combine(value_type(rhs));
+    return *this;
+  }
+
+  //! Get one component of the calculated reduced value
+  T get(size_t i) { return Base::get().get(i); }
+};
+
+//! specialization of the generic operator reducer for hip_reduce
+//  custom operators have no registered device atomic, so the tally
+//  always folds through the non-atomic grid combine; the ordered fold
+//  also keeps compensated sums deterministic
+template <bool maybe_atomic, typename ReduceOp>
+class Reduce<hip_reduce_base<maybe_atomic>, ReduceOp>
+    : public hip::Reduce<ReduceOp, typename ReduceOp::value_type, false>
+{
+public:
+  using value_type = typename ReduceOp::value_type;
+  using Base = hip::Reduce<ReduceOp, value_type, false>;
+  using Base::Base;
+
+  //! reducer function; folds the operand into the running value
+  RAJA_HOST_DEVICE
+  const Reduce& combine(value_type const& rhs) const
+  {
+    Base::combine(rhs);
+    return *this;
+  }
+};
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_HIP guard
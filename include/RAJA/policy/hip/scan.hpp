@@ -33,6 +33,8 @@
 #include "cub/util_allocator.cuh"
 #endif
 
+#include "RAJA/util/resource.hpp"
+
 #include "RAJA/policy/hip/MemUtils_HIP.hpp"
 #include "RAJA/policy/hip/policy.hpp"
 
@@ -48,12 +50,13 @@ namespace scan
    initial value
 */
 template <size_t BLOCK_SIZE, bool Async, typename InputIter, typename Function>
-void inclusive_inplace(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+void inclusive_inplace(resources::Hip& hip_res,
+                       const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
                        InputIter begin,
                        InputIter end,
                        Function binary_op)
 {
-  hipStream_t stream = 0;
+  hipStream_t stream = hip_res.get_stream();
 
   int len = std::distance(begin, end);
   // Determine temporary device storage requirements
@@ -115,13 +118,14 @@ template <size_t BLOCK_SIZE,
           typename InputIter,
           typename Function,
           typename T>
-void exclusive_inplace(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+void exclusive_inplace(resources::Hip& hip_res,
+                       const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
                        InputIter begin,
                        InputIter end,
                        Function binary_op,
                        T init)
 {
-  hipStream_t stream = 0;
+  hipStream_t stream = hip_res.get_stream();
 
   int len = std::distance(begin, end);
   // Determine temporary device storage requirements
@@ -186,13 +190,14 @@ template <size_t BLOCK_SIZE,
           typename InputIter,
           typename OutputIter,
           typename Function>
-void inclusive(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+void inclusive(resources::Hip& hip_res,
+               const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
                InputIter begin,
                InputIter end,
                OutputIter out,
                Function binary_op)
 {
-  hipStream_t stream = 0;
+  hipStream_t stream = hip_res.get_stream();
 
   int len = std::distance(begin, end);
   // Determine temporary device storage requirements
@@ -234,14 +239,15 @@ template <size_t BLOCK_SIZE,
           typename OutputIter,
           typename Function,
           typename T>
-void exclusive(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+void exclusive(resources::Hip& hip_res,
+               const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
                InputIter begin,
                InputIter end,
                OutputIter out,
                Function binary_op,
                T init)
 {
-  hipStream_t stream = 0;
+  hipStream_t stream = hip_res.get_stream();
 
   int len = std::distance(begin, end);
   // Determine temporary device storage requirements
@@ -297,6 +303,176 @@ void exclusive(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
   if (!Async) hip::synchronize(stream);
 }
 
+/*!
+        \brief explicit inclusive scan by key given key range, input values,
+   output, and function; the scan restarts at each key change
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename KeyIter,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+void inclusive_by_key(resources::Hip& hip_res,
+                      const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+                      KeyIter keys,
+                      KeyIter keys_end,
+                      InputIter begin,
+                      OutputIter out,
+                      Function binary_op)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(keys, keys_end);
+#if defined(__HIPCC__)
+  using KeyT = typename std::iterator_traits<KeyIter>::value_type;
+  ::rocprim::equal_to<KeyT> key_compare;
+#endif
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::inclusive_scan_by_key(d_temp_storage,
+                                             temp_storage_bytes,
+                                             keys,
+                                             begin,
+                                             out,
+                                             len,
+                                             binary_op,
+                                             key_compare,
+                                             stream));
+#elif defined(__CUDACC__)
+  hipErrchk(::cub::DeviceScan::InclusiveScanByKey(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  keys,
+                                                  begin,
+                                                  out,
+                                                  binary_op,
+                                                  len,
+                                                  ::cub::Equality(),
+                                                  stream));
+#endif
+  // Allocate temporary storage
+  d_temp_storage =
+      hip::device_mempool_type::getInstance().malloc<unsigned char>(
+          temp_storage_bytes);
+  // Run
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::inclusive_scan_by_key(d_temp_storage,
+                                             temp_storage_bytes,
+                                             keys,
+                                             begin,
+                                             out,
+                                             len,
+                                             binary_op,
+                                             key_compare,
+                                             stream));
+#elif defined(__CUDACC__)
+  hipErrchk(::cub::DeviceScan::InclusiveScanByKey(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  keys,
+                                                  begin,
+                                                  out,
+                                                  binary_op,
+                                                  len,
+                                                  ::cub::Equality(),
+                                                  stream));
+#endif
+  // Free temporary storage
+  hip::device_mempool_type::getInstance().free(d_temp_storage);
+
+  hip::launch(stream);
+  if (!Async) hip::synchronize(stream);
+}
+
+/*!
+        \brief explicit exclusive scan by key given key range, input values,
+   output, function, and initial value; the scan restarts at each key change
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename KeyIter,
+          typename InputIter,
+          typename OutputIter,
+          typename Function,
+          typename T>
+void exclusive_by_key(resources::Hip& hip_res,
+                      const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+                      KeyIter keys,
+                      KeyIter keys_end,
+                      InputIter begin,
+                      OutputIter out,
+                      Function binary_op,
+                      T init)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(keys, keys_end);
+#if defined(__HIPCC__)
+  using KeyT = typename std::iterator_traits<KeyIter>::value_type;
+  ::rocprim::equal_to<KeyT> key_compare;
+#endif
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::exclusive_scan_by_key(d_temp_storage,
+                                             temp_storage_bytes,
+                                             keys,
+                                             begin,
+                                             out,
+                                             init,
+                                             len,
+                                             binary_op,
+                                             key_compare,
+                                             stream));
+#elif defined(__CUDACC__)
+  hipErrchk(::cub::DeviceScan::ExclusiveScanByKey(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  keys,
+                                                  begin,
+                                                  out,
+                                                  binary_op,
+                                                  init,
+                                                  len,
+                                                  ::cub::Equality(),
+                                                  stream));
+#endif
+  // Allocate temporary storage
+  d_temp_storage =
+      hip::device_mempool_type::getInstance().malloc<unsigned char>(
+          temp_storage_bytes);
+  // Run
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::exclusive_scan_by_key(d_temp_storage,
+                                             temp_storage_bytes,
+                                             keys,
+                                             begin,
+                                             out,
+                                             init,
+                                             len,
+                                             binary_op,
+                                             key_compare,
+                                             stream));
+#elif defined(__CUDACC__)
+  hipErrchk(::cub::DeviceScan::ExclusiveScanByKey(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  keys,
+                                                  begin,
+                                                  out,
+                                                  binary_op,
+                                                  init,
+                                                  len,
+                                                  ::cub::Equality(),
+                                                  stream));
+#endif
+  // Free temporary storage
+  hip::device_mempool_type::getInstance().free(d_temp_storage);
+
+  hip::launch(stream);
+  if (!Async) hip::synchronize(stream);
+}
+
 }  // namespace scan
 
 }  // namespace impl
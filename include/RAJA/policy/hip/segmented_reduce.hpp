@@ -0,0 +1,226 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented reduce declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_segmented_reduce_hip_HPP
+#define RAJA_segmented_reduce_hip_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#include "RAJA/policy/hip/atomic.hpp"
+#include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#include "RAJA/policy/hip/reduce.hpp"
+
+namespace RAJA
+{
+
+namespace hip
+{
+
+namespace impl
+{
+
+/*!
+        \brief find the segment containing value index i: the largest s
+   with offsets[s] <= i, which skips over empty segments
+*/
+template <typename OffsetIter, typename IndexType>
+RAJA_DEVICE RAJA_INLINE IndexType segment_of(OffsetIter offsets,
+                                             IndexType num_segments,
+                                             IndexType i)
+{
+  IndexType lo = 0;
+  IndexType hi = num_segments - 1;
+  while (lo < hi) {
+    IndexType mid = lo + (hi - lo + 1) / 2;
+    if (static_cast<IndexType>(offsets[mid]) <= i) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return lo;
+}
+
+/*!
+        \brief combine value into *acc atomically under an arbitrary
+   binary function via a compare-and-swap loop
+*/
+template <typename T, typename BinFn>
+RAJA_DEVICE RAJA_INLINE void atomic_combine(T* acc, T value, BinFn f)
+{
+  T old = *acc;
+  T assumed;
+  do {
+    assumed = old;
+    old = ::RAJA::atomicCAS(::RAJA::hip_atomic{},
+                            static_cast<T volatile*>(acc),
+                            assumed,
+                            f(assumed, value));
+  } while (old != assumed);
+}
+
+//! write the initial value into every output entry
+template <typename OutIter, typename T, typename IndexType>
+__global__ void segmented_reduce_init_kernel(OutIter out,
+                                             IndexType num_segments,
+                                             T init)
+{
+  const IndexType s =
+      static_cast<IndexType>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (s < num_segments) {
+    out[s] = init;
+  }
+}
+
+/*!
+        \brief load-balanced segmented reduction kernel
+
+   Threads are assigned one value each regardless of segment boundaries,
+   so skewed segment lengths cannot starve or overload a thread. Each
+   thread locates its segment by binary search on the offsets; runs of
+   consecutive lanes in the same segment are combined with warp shuffles
+   (segment ids of consecutive indices are monotonic, so id equality at
+   two lanes implies every lane between shares the segment), and the
+   first lane of each run folds the run's aggregate into the output with
+   an atomic.
+*/
+template <typename ValueIter,
+          typename OffsetIter,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename IndexType>
+__global__ void segmented_reduce_kernel(ValueIter values,
+                                        IndexType n_values,
+                                        OffsetIter offsets,
+                                        IndexType num_segments,
+                                        OutIter out,
+                                        BinFn f)
+{
+  const IndexType i =
+      static_cast<IndexType>(blockIdx.x) * blockDim.x + threadIdx.x;
+  const int lane = threadIdx.x & (policy::hip::WARP_SIZE - 1);
+  const bool active = (i < n_values);
+
+  T val{};
+  IndexType seg = static_cast<IndexType>(-1);
+  if (active) {
+    val = values[i];
+    seg = segment_of(offsets, num_segments, i);
+  }
+
+  // suffix-combine runs of same-segment lanes; inactive lanes carry
+  // seg == -1 and never match an active lane
+  for (int offset = 1; offset < policy::hip::WARP_SIZE; offset *= 2) {
+    int src = lane + offset;
+    if (src >= policy::hip::WARP_SIZE) {
+      src = lane;
+    }
+    T other_val = shfl_sync(val, src);
+    IndexType other_seg = shfl_sync(seg, src);
+    if (active && lane + offset < policy::hip::WARP_SIZE &&
+        other_seg == seg) {
+      val = f(val, other_val);
+    }
+  }
+
+  // first lane of each run holds the aggregate of its whole run
+  IndexType prev_seg = shfl_sync(seg, lane > 0 ? lane - 1 : 0);
+  if (active && (lane == 0 || prev_seg != seg)) {
+    T* target = &out[seg];
+    atomic_combine(target, val, f);
+  }
+}
+
+}  // namespace impl
+
+}  // namespace hip
+
+namespace impl
+{
+namespace segmented
+{
+
+/*!
+        \brief segmented reduction over CSR-style offsets via a
+   load-balanced value-parallel kernel with warp-aggregated atomics
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename ValueIter,
+          typename OffsetIter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+void reduce(resources::Hip& hip_res,
+            const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+            ValueIter values,
+            Index_type n_values,
+            OffsetIter offsets,
+            Index_type num_segments,
+            OutIter out,
+            BinFn f,
+            T init)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  const Index_type init_blocks =
+      (num_segments + static_cast<Index_type>(BLOCK_SIZE) - 1) /
+      static_cast<Index_type>(BLOCK_SIZE);
+  hipLaunchKernelGGL(
+      (hip::impl::segmented_reduce_init_kernel<OutIter, T, Index_type>),
+      dim3(init_blocks), dim3(BLOCK_SIZE), 0, stream, out, num_segments,
+      init);
+  hipErrchk(hipPeekAtLastError());
+
+  if (n_values > 0) {
+    const Index_type blocks =
+        (n_values + static_cast<Index_type>(BLOCK_SIZE) - 1) /
+        static_cast<Index_type>(BLOCK_SIZE);
+    hipLaunchKernelGGL((hip::impl::segmented_reduce_kernel<ValueIter,
+                                                           OffsetIter,
+                                                           OutIter,
+                                                           BinFn,
+                                                           T,
+                                                           Index_type>),
+                       dim3(blocks), dim3(BLOCK_SIZE), 0, stream, values,
+                       n_values, offsets, num_segments, out, f);
+    hipErrchk(hipPeekAtLastError());
+  }
+
+  hip::launch(stream);
+  if (!Async) hip::synchronize(stream);
+}
+
+}  // namespace segmented
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing check for RAJA_ENABLE_HIP
+
+#endif  // closing endif for header file include guard
@@ -36,6 +36,7 @@
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/resource.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/policy/hip/MemUtils_HIP.hpp"
 #include "RAJA/policy/hip/policy.hpp"
@@ -80,7 +81,8 @@ concepts::enable_if<concepts::negate<concepts::all_of<
                       concepts::any_of<
                         camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
                         camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
-stable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+stable(resources::Hip& hip_res,
+       const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
      Iter,
      Iter,
      Compare)
@@ -100,12 +102,13 @@ stable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                     std::is_pointer<Iter>>
-stable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+stable(resources::Hip& hip_res,
+       const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
      Iter begin,
      Iter end,
      operators::less<RAJA::detail::IterVal<Iter>>)
 {
-  hipStream_t stream = 0;
+  hipStream_t stream = hip_res.get_stream();
 
   using R = RAJA::detail::IterVal<Iter>;
 
@@ -184,12 +187,13 @@ stable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                     std::is_pointer<Iter>>
-stable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+stable(resources::Hip& hip_res,
+       const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
      Iter begin,
      Iter end,
      operators::greater<RAJA::detail::IterVal<Iter>>)
 {
-  hipStream_t stream = 0;
+  hipStream_t stream = hip_res.get_stream();
 
   using R = RAJA::detail::IterVal<Iter>;
 
@@ -273,7 +277,8 @@ concepts::enable_if<concepts::negate<concepts::all_of<
                       concepts::any_of<
                         camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
                         camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
-unstable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+unstable(resources::Hip& hip_res,
+         const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
          Iter,
          Iter,
          Compare)
@@ -293,12 +298,13 @@ unstable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                     std::is_pointer<Iter>>
-unstable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>& p,
+unstable(resources::Hip& hip_res,
+         const ::RAJA::hip_exec<BLOCK_SIZE, Async>& p,
      Iter begin,
      Iter end,
      operators::less<RAJA::detail::IterVal<Iter>> comp)
 {
-  stable(p, begin, end, comp);
+  stable(hip_res, p, begin, end, comp);
 }
 
 /*!
@@ -307,12 +313,13 @@ unstable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>& p,
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                     std::is_pointer<Iter>>
-unstable(const ::RAJA::hip_exec<BLOCK_SIZE, Async>& p,
+unstable(resources::Hip& hip_res,
+         const ::RAJA::hip_exec<BLOCK_SIZE, Async>& p,
      Iter begin,
      Iter end,
      operators::greater<RAJA::detail::IterVal<Iter>> comp)
 {
-  stable(p, begin, end, comp);
+  stable(hip_res, p, begin, end, comp);
 }
 
 
@@ -328,7 +335,8 @@ concepts::enable_if<concepts::negate<concepts::all_of<
                       concepts::any_of<
                         camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
                         camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
-stable_pairs(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+stable_pairs(resources::Hip& hip_res,
+             const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
              KeyIter,
              KeyIter,
              ValIter,
@@ -355,13 +363,14 @@ template <size_t BLOCK_SIZE, bool Async,
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                     std::is_pointer<KeyIter>,
                     std::is_pointer<ValIter>>
-stable_pairs(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+stable_pairs(resources::Hip& hip_res,
+             const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
              KeyIter keys_begin,
              KeyIter keys_end,
              ValIter vals_begin,
              operators::less<RAJA::detail::IterVal<KeyIter>>)
 {
-  hipStream_t stream = 0;
+  hipStream_t stream = hip_res.get_stream();
 
   using K = RAJA::detail::IterVal<KeyIter>;
   using V = RAJA::detail::IterVal<ValIter>;
@@ -455,13 +464,14 @@ template <size_t BLOCK_SIZE, bool Async,
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                     std::is_pointer<KeyIter>,
                     std::is_pointer<ValIter>>
-stable_pairs(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+stable_pairs(resources::Hip& hip_res,
+             const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
              KeyIter keys_begin,
              KeyIter keys_end,
              ValIter vals_begin,
              operators::greater<RAJA::detail::IterVal<KeyIter>>)
 {
-  hipStream_t stream = 0;
+  hipStream_t stream = hip_res.get_stream();
 
   using K = RAJA::detail::IterVal<KeyIter>;
   using V = RAJA::detail::IterVal<ValIter>;
@@ -560,7 +570,8 @@ concepts::enable_if<concepts::negate<concepts::all_of<
                       concepts::any_of<
                         camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
                         camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
-unstable_pairs(const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
+unstable_pairs(resources::Hip& hip_res,
+               const ::RAJA::hip_exec<BLOCK_SIZE, Async>&,
                KeyIter,
                KeyIter,
                ValIter,
@@ -587,13 +598,14 @@ template <size_t BLOCK_SIZE, bool Async,
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                     std::is_pointer<KeyIter>,
                     std::is_pointer<ValIter>>
-unstable_pairs(const ::RAJA::hip_exec<BLOCK_SIZE, Async>& p,
+unstable_pairs(resources::Hip& hip_res,
+               const ::RAJA::hip_exec<BLOCK_SIZE, Async>& p,
                KeyIter keys_begin,
                KeyIter keys_end,
                ValIter vals_begin,
                operators::less<RAJA::detail::IterVal<KeyIter>> comp)
 {
-  stable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+  stable_pairs(hip_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
 /*!
@@ -604,13 +616,14 @@ template <size_t BLOCK_SIZE, bool Async,
 concepts::enable_if<type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                     std::is_pointer<KeyIter>,
                     std::is_pointer<ValIter>>
-unstable_pairs(const ::RAJA::hip_exec<BLOCK_SIZE, Async>& p,
+unstable_pairs(resources::Hip& hip_res,
+               const ::RAJA::hip_exec<BLOCK_SIZE, Async>& p,
                KeyIter keys_begin,
                KeyIter keys_end,
                ValIter vals_begin,
                operators::greater<RAJA::detail::IterVal<KeyIter>> comp)
 {
-  stable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+  stable_pairs(hip_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
 }  // namespace sort
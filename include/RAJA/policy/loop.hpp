@@ -22,10 +22,13 @@
 
 #include "RAJA/policy/loop/atomic.hpp"
 #include "RAJA/policy/loop/forall.hpp"
+#include "RAJA/policy/loop/masked_forall.hpp"
 #include "RAJA/policy/loop/kernel.hpp"
 #include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/loop/find.hpp"
 #include "RAJA/policy/loop/scan.hpp"
 #include "RAJA/policy/loop/sort.hpp"
+#include "RAJA/policy/loop/segmented_reduce.hpp"
 #include "RAJA/policy/loop/WorkGroup.hpp"
 
 #endif  // closing endif for header file include guard
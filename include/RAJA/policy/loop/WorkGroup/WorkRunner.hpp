@@ -75,6 +75,28 @@ struct WorkRunner<
         Args...>
 { };
 
+/*!
+ * Runs work in a storage container with colored ordering; sequentially
+ * the color groups simply run one after another
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::loop_work,
+        RAJA::colored,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallColored<
+        RAJA::loop_exec,
+        RAJA::loop_work,
+        RAJA::colored,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{ };
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -0,0 +1,70 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA find declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_find_loop_HPP
+#define RAJA_find_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace find
+{
+
+/*!
+        \brief returns the offset of the first element satisfying the
+               predicate, or the range length; stops at the first match
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+find_if(const ExecPolicy&,
+        Iter begin,
+        Iter end,
+        Predicate pred)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  const diff_type n = end - begin;
+
+  for (diff_type i = 0; i < n; ++i) {
+    if (pred(begin[i])) {
+      return i;
+    }
+  }
+  return n;
+}
+
+}  // namespace find
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
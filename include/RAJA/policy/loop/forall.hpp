@@ -23,6 +23,7 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/loop/policy.hpp"
@@ -66,6 +67,56 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::
   return RAJA::resources::EventProxy<resources::Host>(&host_res);
 }
 
+namespace internal
+{
+
+//! prefetch the iterate one step ahead of a strand when the iterator
+//  exposes addressable storage (list segments); range iterators compute
+//  their iterates, so there is nothing to fetch and this is a no-op
+template <typename Iter>
+RAJA_INLINE auto prefetch_iterate(Iter it)
+    -> decltype(static_cast<void>(&*it))
+{
+  RAJA_PREFETCH_READ(&*it);
+}
+
+RAJA_INLINE void prefetch_iterate(...) {}
+
+}  // namespace internal
+
+template <size_t N, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    RAJA::resources::Host &host_res,
+    const seq_interleaved_exec<N> &,
+    Iterable &&iter,
+    Func &&body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  using diff_t = decltype(distance_it);
+
+  // advance N contiguous strands in lock step so independent
+  // iterations from different strands overlap their cache misses
+  diff_t strand_len = distance_it / static_cast<diff_t>(N);
+
+  for (diff_t k = 0; k < strand_len; ++k) {
+    for (diff_t s = 0; s < static_cast<diff_t>(N); ++s) {
+      diff_t i = s * strand_len + k;
+      if (k + 1 < strand_len) {
+        internal::prefetch_iterate(begin_it + (i + 1));
+      }
+      body(*(begin_it + i));
+    }
+  }
+
+  // remainder the strands did not cover
+  for (diff_t i = strand_len * static_cast<diff_t>(N); i < distance_it; ++i) {
+    body(*(begin_it + i));
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(&host_res);
+}
+
 }  // namespace loop
 
 }  // namespace policy
@@ -0,0 +1,84 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA masked forall declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_masked_forall_loop_HPP
+#define RAJA_masked_forall_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/BitMask.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace masked
+{
+
+/*!
+        \brief loop-policy masked forall; words with no active bits are
+   skipped without touching their iterates, fully-active words run as a
+   contiguous loop annotated for vectorization, and partially-active
+   words are walked bit-scan to bit-scan so inactive iterates cost
+   nothing
+*/
+template <typename ExecPolicy, typename Iterator, typename LoopBody>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+forall(const ExecPolicy&,
+       Iterator begin,
+       Index_type length,
+       const BitSetView& mask,
+       LoopBody&& loop_body)
+{
+  constexpr Index_type wbits =
+      static_cast<Index_type>(BitSetView::bits_per_word);
+  const Index_type num_words =
+      static_cast<Index_type>(BitSetView::num_words(length));
+
+  for (Index_type w = 0; w < num_words; ++w) {
+    BitSetWord word = mask.word(w);
+    if (word == 0ull) {
+      continue;
+    }
+    const Index_type base = w * wbits;
+    if (word == ~0ull && base + wbits <= length) {
+      RAJA_SIMD
+      for (Index_type b = 0; b < wbits; ++b) {
+        loop_body(begin[base + b]);
+      }
+    } else {
+      while (word != 0ull) {
+        const Index_type i =
+            base + static_cast<Index_type>(RAJA::detail::firstSetBit(word));
+        word &= word - 1ull;
+        if (i < length) {
+          loop_body(begin[i]);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace masked
+}  // namespace impl
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
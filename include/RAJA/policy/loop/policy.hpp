@@ -47,6 +47,24 @@ struct loop_exec : make_policy_pattern_launch_platform_t<Policy::loop,
                                                          Platform::host> {
 };
 
+///
+/// Strand-interleaved sequential execution policy (experimental). The
+/// iteration space is split into N contiguous strands that advance in
+/// lock step, so up to N independent iterations are in flight at once
+/// and their cache misses can overlap; the iterate stream one step
+/// ahead of each strand is software-prefetched when it is addressable
+/// (e.g. list segments). Intended for index-chasing host loops that
+/// stall on memory latency; iterations do not execute in segment order.
+///
+template <size_t N>
+struct seq_interleaved_exec
+    : make_policy_pattern_launch_platform_t<Policy::loop,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static_assert(N > 0, "seq_interleaved_exec requires at least one strand");
+};
+
 ///
 /// Index set segment iteration policies
 ///
@@ -78,6 +96,7 @@ using policy::loop::loop_exec;
 using policy::loop::loop_reduce;
 using policy::loop::loop_segit;
 using policy::loop::loop_work;
+using policy::loop::seq_interleaved_exec;
 
 }  // namespace RAJA
 
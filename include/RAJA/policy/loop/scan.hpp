@@ -47,7 +47,10 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive_inplace(
     Iter end,
     BinFn f)
 {
-  auto agg = *begin;
+  // accumulate in the iterator's value type so proxy-reference iterators
+  // (e.g. ZipIterator) aggregate into a copy, not through the proxy
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  ValueT agg = *begin;
 
   for (Iter i = ++begin; i != end; ++i) {
     agg = f(*i, agg);
@@ -71,12 +74,12 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive_inplace(
   const auto n = distance(begin, end);
 
   using DistanceT = typename std::remove_const<decltype(n)>::type;
-  using ValueT = decltype(*begin);
-  
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+
   ValueT agg = v;
 
   for (DistanceT i = 0; i < n; ++i) {
-    auto t = begin[i];
+    ValueT t = begin[i];
     begin[i] = agg;
     agg = f(agg, t);
   }
@@ -94,7 +97,8 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive(
     OutIter out,
     BinFn f)
 {
-  auto agg = *begin;
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  ValueT agg = *begin;
   *out++ = agg;
 
   for (Iter i = begin + 1; i != end; ++i) {
@@ -120,7 +124,7 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive(
     BinFn f,
     T v)
 {
-  typename std::remove_const< decltype(*begin) >::type agg = v;
+  typename std::iterator_traits<Iter>::value_type agg = v;
   OutIter o = out;
   *o++ = v;
 
@@ -130,6 +134,73 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive(
   }
 }
 
+/*!
+        \brief explicit inclusive scan by key given key range, input values,
+   output, and function; the scan restarts at each key change
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive_by_key(
+    const ExecPolicy &,
+    const KeyIter keys,
+    const KeyIter keys_end,
+    Iter begin,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  const auto n = distance(keys, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  ValueT agg{};
+
+  for (DistanceT i = 0; i < n; ++i) {
+    ValueT t = begin[i];
+    agg = (i == 0 || !(keys[i] == keys[i - 1])) ? t : f(agg, t);
+    out[i] = agg;
+  }
+}
+
+/*!
+        \brief explicit exclusive scan by key given key range, input values,
+   output, function, and initial value; the scan restarts at each key change
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive_by_key(
+    const ExecPolicy &,
+    const KeyIter keys,
+    const KeyIter keys_end,
+    Iter begin,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using std::distance;
+  const auto n = distance(keys, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  ValueT agg = v;
+
+  for (DistanceT i = 0; i < n; ++i) {
+    ValueT t = begin[i];
+    if (i > 0 && !(keys[i] == keys[i - 1])) {
+      agg = v;
+    }
+    out[i] = agg;
+    agg = f(agg, t);
+  }
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -0,0 +1,72 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented reduce declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_segmented_reduce_loop_HPP
+#define RAJA_segmented_reduce_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace segmented
+{
+
+/*!
+        \brief loop-policy segmented reduction over CSR-style offsets;
+   the per-segment accumulation loop is annotated for vectorization
+*/
+template <typename ExecPolicy,
+          typename ValueIter,
+          typename OffsetIter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+reduce(const ExecPolicy&,
+       ValueIter values,
+       Index_type RAJA_UNUSED_ARG(n_values),
+       OffsetIter offsets,
+       Index_type num_segments,
+       OutIter out,
+       BinFn f,
+       T init)
+{
+  for (Index_type s = 0; s < num_segments; ++s) {
+    const auto begin = offsets[s];
+    const auto end = offsets[s + 1];
+    T agg = init;
+    RAJA_SIMD
+    for (auto i = begin; i < end; ++i) {
+      agg = f(agg, values[i]);
+    }
+    out[s] = agg;
+  }
+}
+
+}  // namespace segmented
+}  // namespace impl
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
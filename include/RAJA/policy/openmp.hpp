@@ -31,12 +31,16 @@
 
 #include "RAJA/policy/openmp/atomic.hpp"
 #include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/masked_forall.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/multi_reduce.hpp"
 #include "RAJA/policy/openmp/reduce.hpp"
 #include "RAJA/policy/openmp/region.hpp"
+#include "RAJA/policy/openmp/find.hpp"
 #include "RAJA/policy/openmp/scan.hpp"
 #include "RAJA/policy/openmp/sort.hpp"
+#include "RAJA/policy/openmp/segmented_reduce.hpp"
 #include "RAJA/policy/openmp/synchronize.hpp"
 #include "RAJA/policy/openmp/WorkGroup.hpp"
 
@@ -75,6 +75,151 @@ struct WorkRunner<
         Args...>
 { };
 
+/*!
+ * Runs work in a storage container out of order with one parallel
+ * region spanning the whole run. Each stored loop is a nowait omp for,
+ * so the team shares the iterations of every loop and threads drift
+ * into later loops as soon as their share of the current one is done,
+ * overlapping independent loops across the team.
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_loop_team_iter_for_nowait,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::omp_work;
+  using order_policy = RAJA::policy::omp::unordered_omp_loop_team_iter_for_nowait;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+
+  using forall_exec_policy = RAJA::omp_for_nowait_exec;
+  using vtable_type = Vtable<Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner &&) = default;
+  WorkRunner& operator=(WorkRunner &&) = default;
+
+  // The type that will hold the segment and loop body in work storage;
+  // the nowait worksharing forall relies on run() providing the
+  // enclosing parallel region
+  template < typename segment_type, typename loop_type >
+  using holder_type = HoldForall<forall_exec_policy, segment_type, loop_type,
+                                 index_type, Args...>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host in a loop
+  using vtable_exec_policy = RAJA::loop_work;
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename segment_T, typename loop_T >
+  inline void enqueue(WorkContainer& storage, segment_T&& seg, loop_T&& loop)
+  {
+    using holder = holder_type<camp::decay<segment_T>, camp::decay<loop_T>>;
+
+    storage.template emplace<holder>(
+        get_Vtable<holder, vtable_type>(vtable_exec_policy{}),
+        std::forward<segment_T>(seg), std::forward<loop_T>(loop));
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  { }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  // run the loops inside a single parallel region; every thread sweeps
+  // the storage in order so the worksharing constructs match up, and
+  // the nowait in each loop's forall lets threads overlap distinct
+  // loops
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    auto end = storage.end();
+#pragma omp parallel
+    {
+      for (auto iter = storage.begin(); iter != end; ++iter) {
+        value_type::call(&*iter, args...);
+      }
+    }
+
+    return run_storage;
+  }
+};
+
+/*!
+ * Runs work in a storage container with colored ordering: the color
+ * groups are spread over the thread team with one group per thread at
+ * a time, and each thread runs its group's loops in enqueue order.
+ * Each loop runs whole on its group's thread (loop_exec), so the
+ * concurrency is across colors -- the windowed-ordering contract --
+ * rather than within a loop. Dynamic scheduling keeps threads busy
+ * when the groups are uneven.
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::colored,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallColored<
+        RAJA::loop_exec,
+        RAJA::omp_work,
+        RAJA::colored,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerForallColored<
+      RAJA::loop_exec,
+      RAJA::omp_work,
+      RAJA::colored,
+      ALLOCATOR_T,
+      INDEX_T,
+      Args...>;
+
+  // run the color groups across the thread team, each group's loops
+  // in enqueue order on one thread
+  template < typename WorkContainer >
+  typename base::per_run_storage run(WorkContainer const& storage,
+                                     Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    typename base::per_run_storage run_storage{};
+
+    auto groups =
+        this->template make_color_groups<value_type>(storage);
+    int num_groups = static_cast<int>(groups.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for (int g = 0; g < num_groups; ++g) {
+      for (const value_type* loop_ptr : groups[g]) {
+        value_type::call(loop_ptr, args...);
+      }
+    }
+
+    return run_storage;
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -208,6 +208,44 @@ RAJA_INLINE T atomicCAS(omp_atomic, T volatile *acc, T compare, T value)
   return RAJA::atomicCAS(builtin_atomic{}, acc, compare, value);
 }
 
+//
+// OpenMP atomics carry no memory-order clause before 5.0, so the ordered
+// operations lower through the compiler builtins, which emit the same
+// hardware atomics the omp pragmas do.
+//
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicLoad(omp_atomic, Order, T volatile *acc)
+{
+  return RAJA::atomicLoad(builtin_atomic{}, Order{}, acc);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE void atomicStore(omp_atomic, Order, T volatile *acc, T value)
+{
+  RAJA::atomicStore(builtin_atomic{}, Order{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicExchange(omp_atomic, Order, T volatile *acc, T value)
+{
+  return RAJA::atomicExchange(builtin_atomic{}, Order{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicAdd(omp_atomic, Order, T volatile *acc, T value)
+{
+  return RAJA::atomicAdd(builtin_atomic{}, Order{}, acc, value);
+}
+
 #endif  // not defined RAJA_COMPILER_MSVC
 
 
@@ -0,0 +1,123 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA find declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_find_openmp_HPP
+#define RAJA_find_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/loop/find.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace find
+{
+
+namespace detail
+{
+namespace openmp
+{
+
+// this number is arbitrary
+constexpr int get_find_chunk_size() { return 512; }
+
+}  // namespace openmp
+}  // namespace detail
+
+/*!
+        \brief returns the offset of the first element satisfying the
+               predicate, or the range length
+
+        Threads claim fixed-size chunks round-robin in increasing index
+        order and poll a shared result before each chunk, so once a match
+        is published every chunk past it is abandoned instead of scanned.
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+find_if(const ExecPolicy&,
+        Iter begin,
+        Iter end,
+        Predicate pred)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  constexpr diff_type chunk_size = detail::openmp::get_find_chunk_size();
+
+  const diff_type n = end - begin;
+
+  if (n <= chunk_size) {
+    return RAJA::impl::find::find_if(::RAJA::loop_exec{}, begin, end, pred);
+  }
+
+  diff_type found = n;
+
+#pragma omp parallel shared(found)
+  {
+    const diff_type num_threads = omp_get_num_threads();
+    const diff_type thread_id = omp_get_thread_num();
+
+    for (diff_type chunk_begin = thread_id * chunk_size; chunk_begin < n;
+         chunk_begin += num_threads * chunk_size) {
+
+      // cancellation check: everything at or past a published match is
+      // dead work
+      diff_type current;
+#pragma omp atomic read
+      current = found;
+      if (chunk_begin >= current) {
+        break;
+      }
+
+      const diff_type chunk_end = std::min(chunk_begin + chunk_size, n);
+      for (diff_type i = chunk_begin; i < chunk_end; ++i) {
+        if (pred(begin[i])) {
+#pragma omp critical(RAJA_omp_find_if)
+          {
+            if (i < found) {
+              found = i;
+            }
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  return found;
+}
+
+}  // namespace find
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -25,13 +25,18 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
@@ -185,6 +190,23 @@ namespace internal
   }
   #endif
 
+  /// Tile epilogue dispatch for the tiled policy: plain loop bodies have
+  /// no epilogue, bodies built with tiled_body() run theirs per tile
+
+  template <typename Func, typename IndexT, typename LenT>
+  RAJA_INLINE void call_tile_epilogue(Func const&, IndexT&&, LenT)
+  {
+  }
+
+  template <typename Body, typename Epilogue, typename IndexT, typename LenT>
+  RAJA_INLINE void call_tile_epilogue(
+      ::RAJA::policy::omp::TiledLoopBody<Body, Epilogue> const& body,
+      IndexT&& tile_begin,
+      LenT tile_len)
+  {
+    body.epilogue(std::forward<IndexT>(tile_begin), tile_len);
+  }
+
 } // end namespace internal
 
 template <typename Schedule, typename Iterable, typename Func>
@@ -207,6 +229,261 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host&
   return resources::EventProxy<resources::Host>(&host_res);
 }
 
+///
+/// Tiled policy implementation. Tiles of TileSize iterations are dealt
+/// round robin across the team, so each thread streams through one
+/// cache-sized window of the loop's arrays at a time instead of one
+/// large contiguous chunk. Bodies built with tiled_body() additionally
+/// run their epilogue after each tile while its data is still hot.
+///
+template <int TileSize, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host& host_res,
+                                                               const omp_for_tiled_exec<TileSize>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_t = decltype(distance_it);
+  const diff_t tile_size = static_cast<diff_t>(TileSize);
+  const diff_t num_tiles = (distance_it + tile_size - 1) / tile_size;
+  #pragma omp for schedule(static, 1)
+  for (diff_t t = 0; t < num_tiles; ++t) {
+    const diff_t tile_begin = t * tile_size;
+    const diff_t tile_end = std::min(tile_begin + tile_size, distance_it);
+    for (diff_t i = tile_begin; i < tile_end; ++i) {
+      loop_body(begin_it[i]);
+    }
+    internal::call_tile_epilogue(loop_body, begin_it[tile_begin],
+                                 tile_end - tile_begin);
+  }
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+///
+/// Taskloop policy implementation. One thread creates tasks of grain_size
+/// iterations; the OpenMP task scheduler distributes (steals) them across
+/// the team, load balancing segments with non-uniform per-element cost.
+/// Each task gets a firstprivate copy of the loop body, so reducer copies
+/// combine exactly as they do for the worksharing policies.
+///
+template <int GrainSize, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host& host_res,
+                                                               const omp_taskloop_exec<GrainSize>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  #pragma omp single nowait
+  {
+    #pragma omp taskloop grainsize(GrainSize) firstprivate(loop_body)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+  #pragma omp barrier
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+namespace internal
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Thread-to-chunk map for one pinned call site, recorded on the
+ *         first execution and replayed afterwards.
+ *
+ *         One instance exists per call site: the pinned forall_impl holds
+ *         it as a function-local static, and the template is instantiated
+ *         per loop-body type, which is unique to a lambda's source
+ *         location. State only changes between the barriers that end
+ *         every execution, so all threads of a team always agree on
+ *         whether to record or replay.
+ *
+ ******************************************************************************
+ */
+struct PinnedSchedule {
+
+  ///
+  /// Return true if the recorded map can be replayed for a loop of the
+  /// given length on a team of the given size.
+  ///
+  bool matches(Index_type len, int num_threads) const
+  {
+    return m_recorded && m_len == len && m_num_threads == num_threads;
+  }
+
+  ///
+  /// Discard any recorded map and prepare to record for a loop of the
+  /// given length; must be called by one thread while the rest of the
+  /// team waits.
+  ///
+  void reset(Index_type len, int num_threads)
+  {
+    m_recorded = false;
+    m_len = len;
+    m_num_threads = num_threads;
+    m_chunks.clear();
+    m_chunks.resize(num_threads);
+  }
+
+  void mark_recorded() { m_recorded = true; }
+
+  std::vector<Index_type>& chunks(int tid) { return m_chunks[tid]; }
+
+private:
+  std::vector<std::vector<Index_type>> m_chunks;
+  Index_type m_len = -1;
+  int m_num_threads = -1;
+  bool m_recorded = false;
+};
+
+}  // namespace internal
+
+///
+/// Pinned policy implementation. The first execution of a call site
+/// deals ChunkSize-iteration chunks dynamically, so the recording pass
+/// load balances, and logs which chunks each thread ran. Later
+/// executions hand each thread exactly the chunks it recorded, keeping
+/// every chunk's data resident in the same core's cache across the
+/// repeated invocations of an iterative solver. The map is re-recorded
+/// when the iteration count or team size changes.
+///
+template <int ChunkSize, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host& host_res,
+                                                               const omp_for_pinned_exec<ChunkSize>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  // one map per call site: this template is instantiated per loop-body
+  // type, and lambda types are unique to their source location
+  static internal::PinnedSchedule sched;
+
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_t = decltype(distance_it);
+  const diff_t chunk_size = static_cast<diff_t>(ChunkSize);
+  const diff_t num_chunks = (distance_it + chunk_size - 1) / chunk_size;
+  const int tid = omp_get_thread_num();
+
+  if (!sched.matches(static_cast<Index_type>(distance_it),
+                     omp_get_num_threads())) {
+    #pragma omp single
+    sched.reset(static_cast<Index_type>(distance_it), omp_get_num_threads());
+    // implicit barrier at the end of single
+
+    auto& mine = sched.chunks(tid);
+    #pragma omp for schedule(dynamic, 1)
+    for (diff_t c = 0; c < num_chunks; ++c) {
+      mine.push_back(static_cast<Index_type>(c));
+      const diff_t chunk_begin = c * chunk_size;
+      const diff_t chunk_end = std::min(chunk_begin + chunk_size, distance_it);
+      for (diff_t i = chunk_begin; i < chunk_end; ++i) {
+        loop_body(begin_it[i]);
+      }
+    }
+    // implicit barrier at the end of the worksharing loop
+
+    #pragma omp single
+    sched.mark_recorded();
+  } else {
+    for (Index_type c : sched.chunks(tid)) {
+      const diff_t chunk_begin = static_cast<diff_t>(c) * chunk_size;
+      const diff_t chunk_end = std::min(chunk_begin + chunk_size, distance_it);
+      for (diff_t i = chunk_begin; i < chunk_end; ++i) {
+        loop_body(begin_it[i]);
+      }
+    }
+    #pragma omp barrier
+  }
+
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+///
+/// Deterministic-reduction policy implementation. The iteration space is
+/// cut into ChunkSize-iteration chunks; each chunk runs on one thread,
+/// in iteration order, through its own privatized copy of the loop body.
+/// The chunk number is published before the copy runs, so when the copy
+/// is destroyed at the end of its chunk, omp_reduce_deterministic
+/// reducer copies fold their partial into a slot keyed by that number
+/// rather than by the executing thread. Which threads ran which chunks
+/// therefore never affects a reduction result.
+///
+template <int ChunkSize, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host& host_res,
+                                                               const omp_for_deterministic_exec<ChunkSize>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_t = decltype(distance_it);
+  const diff_t chunk_size = static_cast<diff_t>(ChunkSize);
+  const diff_t num_chunks = (distance_it + chunk_size - 1) / chunk_size;
+  #pragma omp for schedule(static)
+  for (diff_t c = 0; c < num_chunks; ++c) {
+    policy::omp::internal::deterministic_chunk() = static_cast<long>(c);
+    {
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      const diff_t chunk_begin = c * chunk_size;
+      const diff_t chunk_end = std::min(chunk_begin + chunk_size, distance_it);
+      for (diff_t i = chunk_begin; i < chunk_end; ++i) {
+        body.get_priv()(begin_it[i]);
+      }
+    }  // the chunk's body copy is destroyed here, folding its partials
+  }
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+///
+/// NUMA policy implementation. An outer team with one member per domain
+/// block-partitions the iteration space; each member runs a static inner
+/// team over its block. With OMP_PROC_BIND=spread,close the outer members
+/// land on distinct sockets and the same iteration-to-domain assignment
+/// repeats every invocation, keeping iterations aligned with first-touch
+/// data placement.
+///
+template <int NumDomains, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host& host_res,
+                                                               const omp_numa_exec<NumDomains>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  // nested parallelism is disabled by default
+  int prev_levels = omp_get_max_active_levels();
+  if (prev_levels < 2) {
+    omp_set_max_active_levels(2);
+  }
+
+  #pragma omp parallel num_threads(NumDomains) firstprivate(loop_body)
+  {
+    using diff_t = decltype(distance_it);
+    const diff_t domain = static_cast<diff_t>(omp_get_thread_num());
+    const diff_t block = (distance_it + NumDomains - 1) / NumDomains;
+    const diff_t d_begin = domain * block;
+    const diff_t d_end =
+        (d_begin + block < distance_it) ? d_begin + block : distance_it;
+
+    #pragma omp parallel
+    {
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for schedule(static)
+      for (diff_t i = d_begin; i < d_end; ++i) {
+        body.get_priv()(begin_it[i]);
+      }
+    }
+  }
+
+  if (prev_levels < 2) {
+    omp_set_max_active_levels(prev_levels);
+  }
+
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -217,71 +494,176 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host&
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace internal
+{
+
 /*!
  ******************************************************************************
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
+ * \brief  Lock-free ready queue of task numbers for one thread of a task
+ *         graph traversal.
  *
- *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         Only the owning thread pushes, so the tail has a single writer;
+ *         the owner and stealing threads pop by claiming the head with a
+ *         compare-and-swap. A task becomes ready exactly once per
+ *         traversal, so sizing the buffer with the total number of tasks
+ *         bounds every queue.
  *
  ******************************************************************************
  */
+struct RAJA_ALIGNED_ATTR(256) TaskGraphReadyQueue {
 
-/*
- * TODO: Fix this!!!
- */
+  void resize(int num_tasks) { m_tasks.resize(num_tasks); }
 
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
-{
-  if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+  ///
+  /// Append a ready task; may only be called by the owning thread.
+  ///
+  void push(int task_num)
+  {
+    int t = m_tail.load(std::memory_order_relaxed);
+    m_tasks[t] = task_num;
+    m_tail.store(t + 1, std::memory_order_release);
   }
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+  ///
+  /// Claim the oldest ready task; called by the owner and by stealing
+  /// threads. Returns false if the queue is empty.
+  ///
+  bool pop(int& task_num)
+  {
+    int h = m_head.load(std::memory_order_relaxed);
+    while (h < m_tail.load(std::memory_order_acquire)) {
+      if (m_head.compare_exchange_weak(h, h + 1,
+                                       std::memory_order_acq_rel)) {
+        task_num = m_tasks[h];
+        return true;
+      }
+    }
+    return false;
+  }
 
-  int num_seg = ncis.getNumSegments();
+private:
+  std::vector<int> m_tasks;
+  std::atomic<int> m_head{0};
+  std::atomic<int> m_tail{0};
+};
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+}  // namespace internal
 
-    task->wait();
+}  // namespace omp
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+}  // namespace policy
 
-    task->reset();
+///
+/// First-touch initialization companion to omp_numa_exec. Writes value to
+/// each element of the array using the same iteration-to-domain
+/// partitioning the policy uses for loops, so pages are faulted in on the
+/// domain that will later iterate over them.
+///
+template <int NumDomains, typename T>
+RAJA_INLINE void numa_first_touch(const omp_numa_exec<NumDomains>& p,
+                                  T* ptr,
+                                  Index_type len,
+                                  T value = T())
+{
+  resources::Host host_res = resources::Host::get_default();
+  policy::omp::forall_impl(host_res,
+                           p,
+                           TypedRangeSegment<Index_type>(0, len),
+                           [=](Index_type i) { ptr[i] = value; });
+}
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
-      }
+/*!
+ ******************************************************************************
+ *
+ * \brief  Dependence-driven iteration over index set segments using the
+ *         omp_taskgraph_segit policy, a DepGraph with one node per
+ *         segment, and the given segment execution policy.
+ *
+ *         Each OpenMP thread owns a lock-free ready queue, seeded with
+ *         the segments that start with no unsatisfied dependences. A
+ *         thread pops segments from its own queue and, when completing a
+ *         segment satisfies the last dependence of a successor, pushes
+ *         the successor onto its own queue; idle threads steal from the
+ *         other queues. Segments therefore execute at the parallelism of
+ *         the graph rather than in level-synchronous rounds, e.g. for
+ *         sweeps with wavefront dependences across mesh blocks.
+ *
+ *         The graph semaphores are reloaded on entry, so one graph can
+ *         drive a traversal per timestep.
+ *
+ ******************************************************************************
+ */
+template <typename SegmentExecPolicy, typename LoopBody, typename... SegmentTypes>
+RAJA_INLINE void forall_taskgraph(
+    ExecPolicy<omp_taskgraph_segit, SegmentExecPolicy>,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    DepGraph& graph,
+    LoopBody&& loop_body)
+{
+  const int num_seg = iset.getNumSegments();
+
+  graph.reset();
+
+  const int num_threads = omp_get_max_threads();
+  std::vector<policy::omp::internal::TaskGraphReadyQueue> queues(num_threads);
+  for (auto& queue : queues) {
+    queue.resize(num_seg);
+  }
+
+  //
+  // Seed the queues round-robin with the segments that are ready at the
+  // start of the traversal
+  //
+  int seed_queue = 0;
+  for (int isi = 0; isi < num_seg; ++isi) {
+    if (graph.node(isi).semaphoreValue() == 0) {
+      queues[seed_queue].push(isi);
+      seed_queue = (seed_queue + 1) % num_threads;
     }
+  }
 
-  }  // iterate over segments of index set
-}
-*/
+  std::atomic<int> num_done(0);
 
-}  // namespace omp
+  #pragma omp parallel num_threads(num_threads) firstprivate(loop_body)
+  {
+    resources::Host res = resources::Host::get_default();
+    const int tid = omp_get_thread_num();
+    int victim = tid;
+
+    while (num_done.load(std::memory_order_acquire) < num_seg) {
+
+      int isi;
+      if (queues[tid].pop(isi)) {
+        victim = tid;
+      } else {
+        // scan one victim per attempt so an empty own queue does not
+        // serialize behind a full sweep of the other queues
+        victim = (victim + 1) % num_threads;
+        if (victim == tid || !queues[victim].pop(isi)) {
+          std::this_thread::yield();
+          continue;
+        }
+      }
 
-}  // namespace policy
+      iset.segmentCall(isi,
+                       detail::CallForall(),
+                       SegmentExecPolicy(),
+                       loop_body,
+                       res);
+
+      DepGraphNode& task = graph.node(isi);
+      for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+        const int successor = task.depTaskNum(ii);
+        if (graph.node(successor).satisfyOne()) {
+          queues[tid].push(successor);
+        }
+      }
+
+      num_done.fetch_add(1, std::memory_order_acq_rel);
+    }
+  }
+}
 
 }  // namespace RAJA
 
@@ -22,6 +22,8 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <type_traits>
+
 #include "RAJA/pattern/detail/privatizer.hpp"
 
 #include "RAJA/pattern/kernel/Collapse.hpp"
@@ -41,9 +43,85 @@ struct omp_parallel_collapse_exec
                             RAJA::policy::omp::For> {
 };
 
+///
+/// Collapse policy that also carries a worksharing schedule, so collapsed
+/// loops with imbalanced outer iterations can be load balanced without
+/// flattening them by hand, e.g.
+///
+///   statement::Collapse<
+///       omp_parallel_collapse_schedule_exec<RAJA::policy::omp::Dynamic<4>>,
+///       ArgList<0, 1>, ...>
+///
+/// accepts the same schedule types as omp_for_schedule_exec.
+///
+template <typename Sched>
+struct omp_parallel_collapse_schedule_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For,
+                            Sched> {
+  static_assert(std::is_base_of<::RAJA::policy::omp::internal::ScheduleTag,
+                                Sched>::value,
+                "Schedule must be one of: Auto|Runtime|Static|Dynamic|Guided");
+};
+
 namespace internal
 {
 
+///
+/// Install the schedule carried by Sched as the OpenMP runtime schedule for
+/// the scope of a collapsed loop, restoring the previous setting on exit.
+/// The schedule-aware collapse pragmas below use schedule(runtime), so one
+/// executor per loop arity covers Static/Dynamic/Guided/Auto; for Runtime
+/// the environment setting is left untouched. MSVC does not provide
+/// omp_set_schedule, so there the environment setting always applies.
+///
+template <typename Sched>
+struct OmpCollapseScheduleGuard {
+#if !defined(RAJA_COMPILER_MSVC)
+  OmpCollapseScheduleGuard()
+  {
+    omp_get_schedule(&m_prev_sched, &m_prev_chunk);
+    omp_set_schedule(Sched::schedule, Sched::chunk_size);
+  }
+
+  ~OmpCollapseScheduleGuard()
+  {
+    omp_set_schedule(m_prev_sched, m_prev_chunk);
+  }
+
+private:
+  omp_sched_t m_prev_sched;
+  int m_prev_chunk;
+#endif
+};
+
+// Auto inherits its schedule constants privately, so name them directly
+template <>
+struct OmpCollapseScheduleGuard<::RAJA::policy::omp::Auto> {
+#if !defined(RAJA_COMPILER_MSVC)
+  OmpCollapseScheduleGuard()
+  {
+    omp_get_schedule(&m_prev_sched, &m_prev_chunk);
+    omp_set_schedule(omp_sched_auto, ::RAJA::policy::omp::default_chunk_size);
+  }
+
+  ~OmpCollapseScheduleGuard()
+  {
+    omp_set_schedule(m_prev_sched, m_prev_chunk);
+  }
+
+private:
+  omp_sched_t m_prev_sched;
+  int m_prev_chunk;
+#endif
+};
+
+// Runtime keeps whatever OMP_SCHEDULE requested
+template <>
+struct OmpCollapseScheduleGuard<::RAJA::policy::omp::Runtime> {
+};
+
 /////////
 // Collapsing two loops
 /////////
@@ -129,6 +207,99 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
 };
 
 
+/////////
+// Collapsing two loops with a worksharing schedule
+/////////
+
+template <typename Sched,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Collapse<
+                             omp_parallel_collapse_schedule_exec<Sched>,
+                             ArgList<Arg0, Arg1>,
+                             EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    auto i0 = l0;
+    auto i1 = l1;
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+
+    OmpCollapseScheduleGuard<Sched> schedule_guard;
+    RAJA_UNUSED_VAR(schedule_guard);
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel for schedule(runtime) private(i0, i1) \
+    firstprivate(privatizer) RAJA_COLLAPSE(2)
+    for (i0 = 0; i0 < l0; ++i0) {
+      for (i1 = 0; i1 < l1; ++i1) {
+        auto& private_data = privatizer.get_priv();
+        private_data.template assign_offset<Arg0>(i0);
+        private_data.template assign_offset<Arg1>(i1);
+        execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
+      }
+    }
+  }
+};
+
+
+template <typename Sched,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Collapse<
+                             omp_parallel_collapse_schedule_exec<Sched>,
+                             ArgList<Arg0, Arg1, Arg2>,
+                             EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    const auto l2 = segment_length<Arg2>(data);
+    auto i0 = l0;
+    auto i1 = l1;
+    auto i2 = l2;
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+    using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
+
+    OmpCollapseScheduleGuard<Sched> schedule_guard;
+    RAJA_UNUSED_VAR(schedule_guard);
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel for schedule(runtime) private(i0, i1, i2) \
+    firstprivate(privatizer) RAJA_COLLAPSE(3)
+    for (i0 = 0; i0 < l0; ++i0) {
+      for (i1 = 0; i1 < l1; ++i1) {
+        for (i2 = 0; i2 < l2; ++i2) {
+          auto& private_data = privatizer.get_priv();
+          private_data.template assign_offset<Arg0>(i0);
+          private_data.template assign_offset<Arg1>(i1);
+          private_data.template assign_offset<Arg2>(i2);
+          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes2>(private_data);
+        }
+      }
+    }
+  }
+};
 
 
 
@@ -0,0 +1,143 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for OpenMP team-shared memory window executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_InitLocalMem_HPP
+#define RAJA_policy_openmp_kernel_InitLocalMem_HPP
+
+#include "RAJA/config.hpp"
+
+#include <new>
+#include <type_traits>
+
+#include <omp.h>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/kernel/InitLocalMem.hpp"
+
+namespace RAJA
+{
+
+//! Local array memory policy mapping to one heap slab shared by all
+//  threads of the enclosing OpenMP parallel region, the CPU analogue of
+//  cuda_shared_mem. Use inside statement::Region<omp_parallel_region,...>
+//  with OmpSyncThreads providing the tile synchronization.
+struct omp_shared_mem;
+
+
+namespace statement
+{
+
+//Policy Specialization
+template<camp::idx_t... Indices, typename... EnclosedStmts>
+struct InitLocalMem<RAJA::omp_shared_mem, camp::idx_seq<Indices...>, EnclosedStmts...> : public internal::Statement<camp::nil> {
+};
+
+}  // end namespace statement
+
+
+namespace internal
+{
+
+//Statement executor to initalize a team-shared RAJA local array
+//
+//Every thread of the enclosing parallel region executes this statement;
+//one thread allocates and first-touches the slab (placing its pages on
+//the team's NUMA node) and the pointer is broadcast so all threads share
+//the same tile, matching the cross-thread reuse cuda_shared_mem provides
+//on device. The same kernel policy shape works on both back-ends with
+//OmpSyncThreads/CudaSyncThreads as the tile barrier.
+template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::InitLocalMem<RAJA::omp_shared_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>{
+
+  //Execute statement list
+  template<class Data>
+  static void RAJA_INLINE initMem(Data && data)
+  {
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+  }
+
+  //Intialize team-shared local array
+  //Identifies type + number of elements needed
+  template<camp::idx_t Pos, camp::idx_t... others, class Data>
+  static void RAJA_INLINE initMem(Data && data)
+  {
+    using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::element_t;
+    const camp::idx_t NumElem = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::NumElem;
+    const camp::idx_t Alignment = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::Alignment;
+
+    //posix_memalign needs at least pointer alignment
+    const size_t byte_align = (static_cast<size_t>(Alignment) > sizeof(void*))
+                                  ? static_cast<size_t>(Alignment)
+                                  : sizeof(void*);
+
+    varType* Array = nullptr;
+    //one thread allocates; value-initialization first-touches the pages
+    //so they land with the team; copyprivate broadcasts the pointer and
+    //its implicit barrier makes the slab visible to every thread
+#pragma omp single copyprivate(Array)
+    {
+      Array = RAJA::allocate_aligned_type<varType>(byte_align,
+                                                   NumElem * sizeof(varType));
+      for (camp::idx_t i = 0; i < NumElem; ++i) {
+        new (&Array[i]) varType();
+      }
+    }
+    camp::get<Pos>(data.param_tuple).m_arrayPtr = Array;
+    initMem<others...>(data);
+
+    //all threads are done with the tile before one thread frees it
+#pragma omp barrier
+#pragma omp single nowait
+    {
+      for (camp::idx_t i = 0; i < NumElem; ++i) {
+        Array[i].~varType();
+      }
+      RAJA::free_aligned(Array);
+    }
+  }
+
+  //Set pointer to null
+  template<class Data>
+  static void RAJA_INLINE setPtrToNull(Data &&) {}
+
+  template<camp::idx_t Pos, camp::idx_t... others, class Data>
+  static void RAJA_INLINE setPtrToNull(Data && data)
+  {
+    camp::get<Pos>(data.param_tuple).m_arrayPtr = nullptr;
+    setPtrToNull<others...>(data);
+  }
+
+  template<typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    //Initalize team-shared local arrays + execute statements
+    initMem<Indices...>(data);
+
+    //set array pointers to null
+    setPtrToNull<Indices...>(data);
+  }
+
+};
+
+}  // namespace internal
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,103 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for OpenMP statement executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_Reduce_HPP
+#define RAJA_policy_openmp_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/kernel.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+//
+// Executor that handles reductions of a kernel parameter across the
+// threads of the enclosing OpenMP parallel region.
+//
+// Each thread accumulates its partial value into the (privatized)
+// parameter while running the loops above this statement, so the hot
+// path touches only a register; this statement performs the one combine
+// across the team at loop exit and then runs the enclosed statements on
+// the root thread only. Every thread of the region must reach this
+// statement.
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Reduce<omp_reduce, ReduceOperator, ParamId, EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using value_t =
+        camp::decay<decltype(data.template get_param<ParamId>())>;
+    using combiner_t =
+        RAJA::reduce::detail::op_adapter<value_t, ReduceOperator>;
+
+    const int num_threads = omp_get_num_threads();
+    const int thread_id = omp_get_thread_num();
+
+    // one slot per team member; the pointer is broadcast so every thread
+    // writes into the same scratch array
+    value_t *team_values = nullptr;
+#pragma omp single copyprivate(team_values)
+    {
+      team_values = new value_t[num_threads];
+    }
+
+    team_values[thread_id] = data.template get_param<ParamId>();
+#pragma omp barrier
+
+    if (thread_id == 0) {
+      value_t result = team_values[0];
+      for (int t = 1; t < num_threads; ++t) {
+        combiner_t{}(result, team_values[t]);
+      }
+      data.template assign_param<ParamId>(result);
+
+      // only the root thread holds the reduced value and executes the
+      // enclosed statements
+      execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+    }
+
+#pragma omp barrier
+#pragma omp single
+    {
+      delete[] team_values;
+    }
+  }
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif /* RAJA_policy_openmp_kernel_Reduce_HPP */
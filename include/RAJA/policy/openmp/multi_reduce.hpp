@@ -0,0 +1,98 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA multi-bin reduction templates for
+ *          OpenMP execution.
+ *
+ *          These methods should work on any platform that supports OpenMP.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_omp_multi_reduce_HPP
+#define RAJA_omp_multi_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <cstddef>
+#include <memory>
+
+#include <omp.h>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/multi_reduce.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * OpenMP multi-bin sum reducer. Each thread owns one contiguous, padded
+ * block of bins, so a histogram loop updates a single cache-resident tally
+ * array without atomics or per-bin critical sections; get() combines the
+ * per-thread blocks.
+ */
+template <typename T>
+class MultiReduceSum<omp_reduce, T>
+{
+  using Combiner = reduce::sum<T>;
+
+public:
+  MultiReduceSum() = delete;
+
+  MultiReduceSum(size_t num_bins, T init_val = Combiner::identity())
+      : m_data(std::make_shared<reduce::detail::MultiReduceData<T>>(
+            static_cast<size_t>(omp_get_max_threads()),
+            num_bins,
+            Combiner::identity())),
+        m_init_val(init_val)
+  {
+  }
+
+  //! accumulate val into the given bin for the calling thread
+  void add(size_t bin, T val) const
+  {
+    Combiner{}(
+        m_data->thread_bins(static_cast<size_t>(omp_get_thread_num()))[bin],
+        val);
+  }
+
+  //! combined value for the given bin across all threads
+  T get(size_t bin) const
+  {
+    T result = m_init_val;
+    Combiner{}(result, m_data->template combine_bin<Combiner>(bin));
+    return result;
+  }
+
+  size_t size() const { return m_data->num_bins(); }
+
+  //! set all bins back to the initial value
+  void reset(T init_val = Combiner::identity())
+  {
+    m_init_val = init_val;
+    m_data->reset();
+  }
+
+private:
+  std::shared_ptr<reduce::detail::MultiReduceData<T>> m_data;
+  T m_init_val;
+};
+
+}  // end of namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
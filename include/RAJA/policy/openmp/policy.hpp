@@ -19,6 +19,7 @@
 #define policy_openmp_HPP
 
 #include <type_traits>
+#include <utility>
 
 #include "RAJA/policy/PolicyBase.hpp"
 
@@ -53,6 +54,20 @@ namespace internal
         constexpr static omp_sched_t schedule = Sched;
         constexpr static int chunk_size = Chunk;
     };
+
+    ///
+    /// Number of the iteration-space chunk the calling thread is
+    /// currently executing inside an omp_for_deterministic_exec loop.
+    /// The forall implementation stores the chunk number here before
+    /// running each chunk's body copy, and the omp_reduce_deterministic
+    /// reducers read it when that copy folds its partial, keying the
+    /// partial by chunk rather than by thread.
+    ///
+    RAJA_INLINE long& deterministic_chunk()
+    {
+        static thread_local long chunk = 0;
+        return chunk;
+    }
 }  // namespace internal
 
 //
@@ -105,6 +120,13 @@ struct omp_parallel_region
                                             Platform::host> {
 };
 
+struct omp_parallel_sections_region
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 template <typename Sched>
 struct omp_for_nowait_schedule_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                               Pattern::forall,
@@ -129,6 +151,133 @@ struct omp_for_schedule_exec : make_policy_pattern_launch_platform_t<Policy::ope
         "Schedule must be one of: Auto|Runtime|Static|Dynamic|Guided");
 };
 
+///
+/// Policy that runs iterations as OpenMP tasks via taskloop so the task
+/// scheduler load balances (steals) chunks of GrainSize iterations across
+/// threads. Intended for list segments with wildly non-uniform per-element
+/// cost, where any static partition leaves threads idle.
+///
+template <int GrainSize = 1>
+struct omp_taskloop_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static_assert(GrainSize > 0, "GrainSize must be positive");
+  static constexpr int grain_size = GrainSize;
+};
+
+///
+/// Policy that partitions the iteration space across NUMA domains using
+/// nested parallelism: an outer team with one member per domain, each
+/// running a static inner team over its block of the iteration space.
+/// With OMP_PROC_BIND=spread,close (or an equivalent places setting) the
+/// outer members land on distinct sockets, so iteration assignment stays
+/// aligned with first-touch data placement across timesteps. Use
+/// numa_first_touch (or a forall with this policy) to initialize data
+/// with the same partitioning.
+///
+template <int NumDomains = 2>
+struct omp_numa_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static_assert(NumDomains > 0, "NumDomains must be positive");
+  static constexpr int num_domains = NumDomains;
+};
+
+///
+/// Policy that workshares fixed-size tiles of the iteration space instead
+/// of one contiguous chunk per thread. Tiles are dealt round robin, so at
+/// any moment each thread streams through a TileSize-element window of the
+/// arrays the loop touches, keeping the combined working set cache sized.
+/// The loop body may be wrapped with tiled_body() to also run a tile
+/// epilogue after each tile completes.
+///
+template <int TileSize>
+struct omp_for_tiled_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static_assert(TileSize > 0, "TileSize must be positive");
+  static constexpr int tile_size = TileSize;
+};
+
+///
+/// Policy that pins the thread-to-chunk assignment of a call site across
+/// repeated executions. The first execution deals ChunkSize-iteration
+/// chunks dynamically, load balancing the loop, and records which chunks
+/// each thread ran; later executions replay that map exactly, so each
+/// chunk's data stays resident in the cache of the core that first
+/// touched it across the iterations of a solver. The map is held per
+/// call site (per loop-body type) and is re-recorded if the iteration
+/// count or team size changes.
+///
+template <int ChunkSize>
+struct omp_for_pinned_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static_assert(ChunkSize > 0, "ChunkSize must be positive");
+  static constexpr int chunk_size = ChunkSize;
+};
+
+///
+/// Policy that workshares ChunkSize-iteration chunks of the iteration
+/// space and privatizes the loop body once per chunk, the companion
+/// execution policy to omp_reduce_deterministic. Each chunk's partial
+/// reduction values are accumulated serially, in iteration order, by
+/// whichever thread runs the chunk, and are recorded under the chunk
+/// number, so reduction results are bitwise identical from run to run
+/// for any team size. Costs one loop-body copy per chunk; size chunks
+/// so that cost amortizes.
+///
+template <int ChunkSize>
+struct omp_for_deterministic_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static_assert(ChunkSize > 0, "ChunkSize must be positive");
+  static constexpr int chunk_size = ChunkSize;
+};
+
+///
+/// A loop body paired with a per-tile epilogue for the tiled forall
+/// policies. The epilogue is called after each tile with the first index
+/// of the tile and the tile length.
+///
+template <typename Body, typename Epilogue>
+struct TiledLoopBody {
+  Body body;
+  Epilogue epilogue;
+
+  template <typename... Args>
+  RAJA_INLINE void operator()(Args&&... args) const
+  {
+    body(std::forward<Args>(args)...);
+  }
+};
+
+///
+/// Pair a loop body with a tile epilogue for use with a tiled forall
+/// policy, e.g.
+///
+///   RAJA::forall<RAJA::omp_parallel_for_tiled_exec<512>>(range,
+///     RAJA::tiled_body([=](RAJA::Index_type i) { ... },
+///                      [=](RAJA::Index_type tile_begin,
+///                          RAJA::Index_type tile_len) { ... }));
+///
+template <typename Body, typename Epilogue>
+RAJA_INLINE TiledLoopBody<camp::decay<Body>, camp::decay<Epilogue>>
+tiled_body(Body&& body, Epilogue&& epilogue)
+{
+  return {std::forward<Body>(body), std::forward<Epilogue>(epilogue)};
+}
+
 using omp_for_exec = omp_for_schedule_exec<Auto>;
 
 using omp_for_nowait_exec = omp_for_nowait_schedule_exec<Auto>;
@@ -149,6 +298,19 @@ using omp_parallel_for_exec = omp_parallel_exec<omp_for_exec>;
 template <unsigned int N>
 using omp_parallel_for_static = omp_parallel_exec<omp_for_static<N>>;
 
+template <int GrainSize = 1>
+using omp_parallel_taskloop_exec = omp_parallel_exec<omp_taskloop_exec<GrainSize>>;
+
+template <int TileSize>
+using omp_parallel_for_tiled_exec = omp_parallel_exec<omp_for_tiled_exec<TileSize>>;
+
+template <int ChunkSize>
+using omp_parallel_for_pinned_exec = omp_parallel_exec<omp_for_pinned_exec<ChunkSize>>;
+
+template <int ChunkSize>
+using omp_parallel_for_deterministic_exec =
+    omp_parallel_exec<omp_for_deterministic_exec<ChunkSize>>;
+
 
 ///
 /// Index set segment iteration policies
@@ -175,6 +337,21 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+///
+/// Unordered WorkGroup ordering policy. One parallel region spans the
+/// whole run: every stored loop is workshared across the team with a
+/// nowait omp for, so a thread that finishes its share of one loop
+/// moves straight into the next instead of idling at a loop boundary.
+/// This combines loop-level and iteration-level parallelism the way
+/// the unordered CUDA and HIP orderings do on device; the stored loops
+/// must be safe to run concurrently with one another.
+///
+struct unordered_omp_loop_team_iter_for_nowait
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -190,6 +367,21 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+///
+/// Reduction policy whose combine tree has a fixed shape determined only
+/// by the iteration space, never by the team size or schedule: partials
+/// are keyed by the chunk numbers an omp_for_deterministic_exec loop
+/// publishes, and the final combine folds them pairwise in chunk order.
+/// Results are therefore bitwise reproducible across runs and across
+/// OMP_NUM_THREADS settings, at the cost of one lock acquisition per
+/// chunk. Must be paired with omp_for_deterministic_exec (or the
+/// omp_parallel_for_deterministic_exec alias); with other execution
+/// policies results are correct but only as reproducible as omp_reduce.
+///
+struct omp_reduce_deterministic
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
+};
+
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
                                                       Launch::sync> {
@@ -198,20 +390,34 @@ struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
 }  // namespace omp
 }  // namespace policy
 
+using policy::omp::omp_for_deterministic_exec;
 using policy::omp::omp_for_exec;
 using policy::omp::omp_for_nowait_exec;
 using policy::omp::omp_for_schedule_exec;
 using policy::omp::omp_for_nowait_schedule_exec;
+using policy::omp::omp_for_pinned_exec;
 using policy::omp::omp_for_static;
+using policy::omp::omp_for_tiled_exec;
+using policy::omp::omp_numa_exec;
 using policy::omp::omp_parallel_exec;
 using policy::omp::omp_parallel_for_exec;
+using policy::omp::omp_parallel_for_deterministic_exec;
 using policy::omp::omp_parallel_for_segit;
+using policy::omp::omp_parallel_for_pinned_exec;
+using policy::omp::omp_parallel_for_tiled_exec;
 using policy::omp::omp_parallel_region;
+using policy::omp::omp_parallel_sections_region;
 using policy::omp::omp_parallel_segit;
+using policy::omp::omp_parallel_taskloop_exec;
 using policy::omp::omp_reduce;
+using policy::omp::omp_reduce_deterministic;
 using policy::omp::omp_reduce_ordered;
 using policy::omp::omp_synchronize;
+using policy::omp::omp_taskgraph_segit;
+using policy::omp::omp_taskloop_exec;
+using policy::omp::tiled_body;
 using policy::omp::omp_work;
+using policy::omp::unordered_omp_loop_team_iter_for_nowait;
 
 }  // namespace RAJA
 
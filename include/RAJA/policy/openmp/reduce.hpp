@@ -25,11 +25,14 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <atomic>
+#include <map>
 #include <memory>
 #include <vector>
 
 #include <omp.h>
 
+#include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
@@ -42,31 +45,226 @@ namespace RAJA
 
 namespace detail
 {
+
+/*!
+ * OpenMP reducer combining through a per-thread tally array.
+ *
+ * Each thread owns one slot of the shared tally, padded out to a cache
+ * line so neighboring threads never share a line; worker copies fold
+ * their partial into their own slot at parallel region exit with no
+ * synchronization, replacing the serializing critical-section combine.
+ * Slots are indexed by a process-unique thread id rather than
+ * omp_get_thread_num(), which repeats across nested inner teams, so
+ * every slot has exactly one writer. Threads beyond the bound the tally
+ * was sized to at reset -- the team grew after construction, or nesting
+ * spawned more threads than expected -- fold through a mutex-guarded
+ * overflow slot instead of writing out of range. The tally is
+ * initialized to the identity once, when the reducer is constructed or
+ * reset, rather than at every region entry, so loops that reuse one
+ * reducer across many small parallel regions pay only the per-copy
+ * scalar setup.
+ */
 template <typename T, typename Reduce>
 class ReduceOMP
     : public reduce::detail::BaseCombinable<T, Reduce, ReduceOMP<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMP>;
 
+  //! per-thread slots plus the locked fallback for threads whose unique
+  //  id falls beyond the slots sized at reset; shared by all copies
+  struct Tally {
+    explicit Tally(size_t num_elems, T identity_)
+        : slots(num_elems, identity_), overflow(identity_)
+    {
+    }
+    std::vector<T> slots;
+    RAJA::mutex lock;
+    T overflow;
+  };
+  std::shared_ptr<Tally> tally;
+
+  //! elements per tally slot, padding each slot to a cache-line multiple
+  static size_t slot_stride()
+  {
+    size_t per_line = RAJA::DATA_ALIGN / sizeof(T);
+    return per_line > 0 ? per_line : 1;
+  }
+
+  //! source of process-unique thread ids, counting threads that have
+  //  combined through any ReduceOMP of this type
+  static std::atomic<size_t>& thread_id_counter()
+  {
+    static std::atomic<size_t> next_id{0};
+    return next_id;
+  }
+
+  //! dense process-unique id of the calling thread; unlike
+  //  omp_get_thread_num() it never repeats across nested teams, so the
+  //  slot it indexes has a single writer
+  static size_t thread_slot_id()
+  {
+    static thread_local size_t id =
+        thread_id_counter().fetch_add(1, std::memory_order_relaxed);
+    return id;
+  }
+
 public:
-  using Base::Base;
   //! prohibit compiler-generated default ctor
   ReduceOMP() = delete;
 
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMP(T init_val, T identity_) { reset(init_val, identity_); }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    // cover every id handed out so far plus a fresh team's worth; a
+    // team that outgrows even this lands in the overflow slot
+    size_t num_slots = thread_id_counter().load(std::memory_order_relaxed) +
+                       omp_get_max_threads();
+    tally = std::make_shared<Tally>(slot_stride() * num_slots, identity_);
+  }
+
   ~ReduceOMP()
   {
     if (Base::parent) {
-#pragma omp critical(ompReduceCritical)
-      Reduce()(Base::parent->local(), Base::my_data);
+      Tally& t = *tally;
+      size_t slot = thread_slot_id() * slot_stride();
+      if (slot < t.slots.size()) {
+        // this thread is the only writer of its slot
+        Reduce()(t.slots[slot], Base::my_data);
+      } else {
+        lock_guard<RAJA::mutex> lock(t.lock);
+        Reduce()(t.overflow, Base::my_data);
+      }
       Base::my_data = Base::identity;
     }
   }
+
+  T get_combined() const
+  {
+    const size_t stride = slot_stride();
+    const size_t num_threads = tally->slots.size() / stride;
+
+    // snapshot the slots and combine pairwise, giving log-depth error
+    // growth instead of a linear sweep's
+    std::vector<T> partial(num_threads, Base::identity);
+    for (size_t t = 0; t < num_threads; ++t) {
+      partial[t] = tally->slots[t * stride];
+    }
+    for (size_t gap = 1; gap < num_threads; gap *= 2) {
+      for (size_t i = 0; i + gap < num_threads; i += 2 * gap) {
+        Reduce{}(partial[i], partial[i + gap]);
+      }
+    }
+
+    T res = Base::my_data;
+    if (num_threads > 0) {
+      Reduce{}(res, partial[0]);
+    }
+    {
+      lock_guard<RAJA::mutex> lock(tally->lock);
+      Reduce{}(res, tally->overflow);
+    }
+    return res;
+  }
+};
+
+/*!
+ * OpenMP reducer with a combine order fixed by the iteration space.
+ *
+ * Partials are keyed by the chunk numbers an omp_for_deterministic_exec
+ * loop publishes while it runs: each chunk's body copy accumulates that
+ * chunk's contributions serially, in iteration order, and folds the
+ * partial into the slot for its chunk when the copy is destroyed. A
+ * chunk runs on exactly one thread, so slots have a single writer and
+ * the lock only orders the map insertions. get_combined() then folds
+ * the slots pairwise in chunk order, a tree whose shape depends only on
+ * which chunks ran -- never on the team size or on which threads ran
+ * them -- making results bitwise reproducible across runs and across
+ * OMP_NUM_THREADS settings. Costs one lock acquisition and one map node
+ * per chunk beyond omp_reduce.
+ *
+ * With execution policies that do not publish chunk numbers, all
+ * partials land under the calling threads' last-published chunks; the
+ * result is still correct, but only as reproducible as omp_reduce.
+ */
+template <typename T, typename Reduce>
+class ReduceOMPDeterministic
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceOMPDeterministic<T, Reduce>>
+{
+  using Base =
+      reduce::detail::BaseCombinable<T, Reduce, ReduceOMPDeterministic>;
+
+  //! chunk-number-keyed partials; shared by all copies of the reducer
+  struct ChunkTally {
+    RAJA::mutex lock;
+    std::map<long, T> partials;
+  };
+  std::shared_ptr<ChunkTally> tally;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceOMPDeterministic() = delete;
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMPDeterministic(T init_val, T identity_)
+  {
+    reset(init_val, identity_);
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    tally = std::make_shared<ChunkTally>();
+  }
+
+  ~ReduceOMPDeterministic()
+  {
+    if (Base::parent && Base::my_data != Base::identity) {
+      long chunk = policy::omp::internal::deterministic_chunk();
+      lock_guard<RAJA::mutex> lock(tally->lock);
+      auto it = tally->partials.emplace(chunk, Base::identity).first;
+      Reduce{}(it->second, Base::my_data);
+      Base::my_data = Base::identity;
+    }
+  }
+
+  T get_combined() const
+  {
+    // snapshot the partials in chunk order and combine pairwise; the
+    // tree's shape depends only on the chunks that contributed
+    std::vector<T> partial;
+    {
+      lock_guard<RAJA::mutex> lock(tally->lock);
+      partial.reserve(tally->partials.size());
+      for (auto const& entry : tally->partials) {
+        partial.push_back(entry.second);
+      }
+    }
+    const size_t num_chunks = partial.size();
+    for (size_t gap = 1; gap < num_chunks; gap *= 2) {
+      for (size_t i = 0; i + gap < num_chunks; i += 2 * gap) {
+        Reduce{}(partial[i], partial[i + gap]);
+      }
+    }
+
+    T res = Base::my_data;
+    if (num_chunks > 0) {
+      Reduce{}(res, partial[0]);
+    }
+    return res;
+  }
 };
 
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
 
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_deterministic,
+                          detail::ReduceOMPDeterministic)
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // Old ordered reductions are included below.
@@ -8,6 +8,10 @@
 #ifndef RAJA_region_openmp_HPP
 #define RAJA_region_openmp_HPP
 
+#include <omp.h>
+
+#include "camp/camp.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -46,6 +50,83 @@ RAJA_INLINE void region_impl(const omp_parallel_region &, Func &&body)
     }
 }
 
+namespace internal
+{
+
+//! invoke the index-th body of the tuple; each section thread runs only
+//  its own body, so dispatch is by runtime index over the pack
+template <camp::idx_t... Is, typename TupleT>
+RAJA_INLINE void invoke_section(camp::idx_seq<Is...>, TupleT &bodies, int index)
+{
+  camp::sink((index == static_cast<int>(Is) ? (camp::get<Is>(bodies)(), 0)
+                                            : 0)...);
+}
+
+}  // namespace internal
+
+/*!
+ * \brief RAJA::region_sections implementation for OpenMP.
+ *
+ * Runs each section body concurrently on a disjoint subset of the
+ * available threads. One outer team supplies a thread per section, and
+ * each section thread shrinks its nested team size so the parallel
+ * loops inside its body share the section's subset of threads:
+ *
+ * \code
+ *
+ * RAJA::region_sections<omp_parallel_sections_region>(
+ *   [=]() { // pressure chain: RAJA::forall<omp_parallel_for_exec> loops },
+ *   [=]() { // energy chain: independent loops, runs concurrently });
+ *
+ * \endcode
+ *
+ * Section bodies must use self-contained parallel loops such as
+ * omp_parallel_for_exec. Worksharing policies that bind to an enclosing
+ * region (omp_for_exec, omp_for_nowait_exec) would bind to the outer
+ * one-thread-per-section team and may not be used inside a section.
+ *
+ * \tparam Policy region policy
+ *
+ */
+
+template <typename... Bodies>
+RAJA_INLINE void region_sections_impl(const omp_parallel_sections_region &,
+                                      Bodies &&... bodies)
+{
+  constexpr int num_sections = static_cast<int>(sizeof...(Bodies));
+
+  // divide the available threads evenly among the sections
+  int total_threads = omp_get_max_threads();
+  int section_threads = total_threads / num_sections;
+  if (section_threads < 1) {
+    section_threads = 1;
+  }
+
+  // the nested parallel regions opened inside each section need a
+  // second active level
+  omp_set_max_active_levels(2);
+
+  auto body_tuple = camp::make_tuple(bodies...);
+
+#pragma omp parallel num_threads(num_sections)
+  {
+    // thread private copy of the section bodies
+    auto local_bodies = body_tuple;
+
+    // loops of nested regions spawned by this thread use the section's
+    // thread subset
+    omp_set_num_threads(section_threads);
+
+    // strided in case the implementation delivered fewer threads than
+    // sections
+    for (int s = omp_get_thread_num(); s < num_sections;
+         s += omp_get_num_threads()) {
+      internal::invoke_section(
+          camp::make_idx_seq_t<sizeof...(Bodies)>{}, local_bodies, s);
+    }
+  }
+}
+
 }  // namespace omp
 
 }  // namespace policy
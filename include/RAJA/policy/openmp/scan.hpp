@@ -157,6 +157,145 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
   exclusive_inplace(exec, out, out + distance(begin, end), f, v);
 }
 
+/*!
+        \brief explicit inclusive scan by key given key range, input values,
+   output, and function; the scan restarts at each key change
+
+   Each thread scans its block by key locally, then a serial pass
+   resolves the carry flowing into each block: a carry enters block t
+   only when block t's first key continues block t-1's last run, and a
+   carry compounds through a block only when that block is a single
+   uniform run. Each carried-into block then fixes up its leading run.
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_by_key(
+    const Policy&,
+    KeyIter keys,
+    KeyIter keys_end,
+    Iter begin,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const auto n = distance(keys, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<Value> sums(p0, Value());
+  ::std::vector<Value> carries(p0, Value());
+  ::std::vector<int> uniform(p0, 1);
+  ::std::vector<int> has_carry(p0, 0);
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    Value agg{};
+    int uni = 1;
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      Value t = begin[i];
+      if (i == idx_begin) {
+        agg = t;
+      } else if (!(keys[i] == keys[i - 1])) {
+        agg = t;
+        uni = 0;
+      } else {
+        agg = f(agg, t);
+      }
+      out[i] = agg;
+    }
+    if (idx_begin != idx_end) {
+      sums[pid] = out[idx_end - 1];
+      uniform[pid] = uni;
+    }
+#pragma omp barrier
+#pragma omp single
+    {
+      for (int t = 1; t < p; ++t) {
+        const DistanceT t_begin = firstIndex(n, p, t);
+        if (t_begin == firstIndex(n, p, t + 1)) {
+          continue;
+        }
+        if (keys[t_begin] == keys[t_begin - 1]) {
+          Value c = sums[t - 1];
+          if (uniform[t - 1] && has_carry[t - 1]) {
+            c = f(carries[t - 1], c);
+          }
+          carries[t] = c;
+          has_carry[t] = 1;
+        }
+      }
+    }
+    if (has_carry[pid]) {
+      for (auto i = idx_begin; i < idx_end; ++i) {
+        if (i > idx_begin && !(keys[i] == keys[i - 1])) {
+          break;
+        }
+        out[i] = f(carries[pid], out[i]);
+      }
+    }
+  }
+}
+
+/*!
+        \brief explicit exclusive scan by key given key range, input values,
+   output, function, and initial value; the scan restarts at each key change
+
+   Computed as the inclusive scan by key followed by a segment-aware
+   shift: each output becomes the initial value combined with its
+   predecessor's inclusive value, or the initial value alone at a
+   segment start. Block-boundary predecessors are saved before the shift
+   so the in-place pass cannot race with a neighboring block.
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_by_key(
+    const Policy& exec,
+    KeyIter keys,
+    KeyIter keys_end,
+    Iter begin,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const auto n = distance(keys, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  inclusive_by_key(exec, keys, keys_end, begin, out, f);
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    const Value boundary = (idx_begin != idx_end && idx_begin > 0)
+                               ? static_cast<Value>(out[idx_begin - 1])
+                               : Value();
+#pragma omp barrier
+    for (auto i = idx_end; i > idx_begin; --i) {
+      if (i - 1 == 0 || !(keys[i - 1] == keys[i - 2])) {
+        out[i - 1] = v;
+      } else {
+        out[i - 1] = f(v, (i - 1 == idx_begin) ? boundary
+                                               : static_cast<Value>(out[i - 2]));
+      }
+    }
+  }
+}
+
 }  // namespace scan
 
 }  // namespace impl
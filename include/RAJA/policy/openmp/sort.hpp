@@ -50,6 +50,69 @@ namespace openmp
 constexpr int get_min_iterates_per_task() { return 128; }
 
 #ifdef RAJA_ENABLE_OPENMP_TASK
+/*!
+        \brief stable merge of two consecutive sorted ranges using comparison
+               function by recursively splitting the merge and spawning tasks
+
+        Splits symmerge-style at the median of the larger side, rotates the
+        middle pieces into place, and merges the two independent halves as
+        tasks, so a single wide merge runs on many threads instead of one.
+*/
+template <typename Iter, typename Compare>
+inline void merge_task(Iter first,
+                       Iter middle,
+                       Iter last,
+                       RAJA::detail::IterDiff<Iter> iterates_per_task,
+                       Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  const diff_type len1 = middle - first;
+  const diff_type len2 = last - middle;
+
+  if (len1 == 0 || len2 == 0) {
+    // at least one side empty, already sorted
+    return;
+  }
+
+  if (!comp(*middle, *(middle-1))) {
+    // everything already in order, done
+    return;
+  }
+
+  if (len1 + len2 <= iterates_per_task) {
+
+    RAJA::detail::inplace_merge(first, middle, last, comp);
+
+  } else {
+
+    // split at the median of the larger side and find the matching cut
+    // in the other side, keeping the merge stable
+    Iter cut1, cut2;
+    if (len1 >= len2) {
+      cut1 = first + len1/2;
+      cut2 = std::lower_bound(middle, last, *cut1, comp);
+    } else {
+      cut2 = middle + len2/2;
+      cut1 = std::upper_bound(first, middle, *cut2, comp);
+    }
+
+    // bring the two middle pieces into sorted relative position
+    RAJA::detail::rotate_range(cut1, middle, cut2);
+    Iter new_middle = cut1 + (cut2 - middle);
+
+    // the halves on either side of the rotated block touch disjoint
+    // memory, so they merge concurrently
+#pragma omp taskgroup
+    {
+#pragma omp task
+      merge_task(first, cut1, new_middle, iterates_per_task, comp);
+
+      merge_task(new_middle, cut2, last, iterates_per_task, comp);
+    }
+  }
+}
+
 /*!
         \brief sort given range using sorter and comparison function
                by spawning tasks
@@ -73,16 +136,18 @@ inline void sort_task(Sorter sorter,
 
     const diff_type i_middle = i_begin + n/2;
 
+#pragma omp taskgroup
+    {
 #pragma omp task
-    sort_task(sorter, begin, i_begin, i_middle, iterates_per_task, comp);
-
-#pragma omp task
-    sort_task(sorter, begin, i_middle, i_end, iterates_per_task, comp);
+      sort_task(sorter, begin, i_begin, i_middle, iterates_per_task, comp);
 
-#pragma omp taskwait
+      sort_task(sorter, begin, i_middle, i_end, iterates_per_task, comp);
+    }
 
-    //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-    RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+    // merge the sorted halves with a task-parallel merge so wide merges
+    // near the root of the tree are not serialized on one thread
+    merge_task(begin + i_begin, begin + i_middle, begin + i_end,
+               iterates_per_task, comp);
   }
 }
 
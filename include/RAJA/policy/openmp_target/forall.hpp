@@ -31,6 +31,26 @@ namespace omp
 /// OpenMP target parallel for policy implementation
 ///
 
+///
+/// Thread capacity of one team, queried from the device on first use and
+/// cached; replaces the static MAXNUMTHREADS cap so launch shapes follow
+/// the actual device instead of a CUDA-sized constant.
+///
+RAJA_INLINE int max_threads_per_team()
+{
+  static int max_threads = []() {
+    int nthreads = 0;
+#pragma omp target map(tofrom : nthreads)
+    {
+      nthreads = omp_get_max_threads();
+    }
+    return (nthreads > 0 && nthreads < omp::MAXNUMTHREADS)
+               ? nthreads
+               : omp::MAXNUMTHREADS;
+  }();
+  return max_threads;
+}
+
 template <size_t ThreadsPerTeam, typename Iterable, typename Func>
 RAJA_INLINE resources::EventProxy<resources::Omp> forall_impl(resources::Omp &omp_res,
                                                               const omp_target_parallel_for_exec<ThreadsPerTeam>&,
@@ -42,11 +62,11 @@ RAJA_INLINE resources::EventProxy<resources::Omp> forall_impl(resources::Omp &om
 
   RAJA_EXTRACT_BED_IT(iter);
 
-  // Reset if exceed CUDA threads per block limit.
+  // Reset if exceed device threads per team limit.
   int tperteam = ThreadsPerTeam;
-  if ( tperteam > omp::MAXNUMTHREADS )
+  if ( tperteam > max_threads_per_team() )
   {
-    tperteam = omp::MAXNUMTHREADS;
+    tperteam = max_threads_per_team();
   }
 
   // calculate number of teams based on user defined threads per team
@@ -222,11 +222,27 @@ struct TargetReduce
   operator T()
   {
     if (!info.isMapped) {
+#if !defined(__ibmxl__)  // TODO: XL rejects block-scope declare reduction
+      // Combine the team partials natively on the device so only the
+      // combined value crosses the bus, instead of copying the whole
+      // tally back and folding it on the host.
+      T red = Reducer::identity();
+      T *device = val.device;
+#pragma omp declare reduction(combine : T : Reducer{}(omp_out, omp_in)) \
+    initializer(omp_priv = Reducer::identity())
+#pragma omp target teams distribute parallel for reduction(combine : red) \
+    is_device_ptr(device) map(tofrom : red)
+      for (int i = 0; i < omp::MaxNumTeams; ++i) {
+        Reducer{}(red, device[i]);
+      }
+      Reducer{}(val.value, red);
+#else
       val.deviceToHost(info);
 
       for (int i = 0; i < omp::MaxNumTeams; ++i) {
         Reducer{}(val.value, val.host[i]);
       }
+#endif
       val.cleanup(info);
       info.isMapped = true;
     }
@@ -21,12 +21,17 @@
 #define RAJA_sequential_HPP
 
 #include "RAJA/policy/sequential/atomic.hpp"
+#include "RAJA/policy/sequential/compact.hpp"
 #include "RAJA/policy/sequential/forall.hpp"
+#include "RAJA/policy/sequential/masked_forall.hpp"
 #include "RAJA/policy/sequential/kernel.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/sequential/multi_reduce.hpp"
 #include "RAJA/policy/sequential/reduce.hpp"
+#include "RAJA/policy/sequential/find.hpp"
 #include "RAJA/policy/sequential/scan.hpp"
 #include "RAJA/policy/sequential/sort.hpp"
+#include "RAJA/policy/sequential/segmented_reduce.hpp"
 #include "RAJA/policy/sequential/WorkGroup.hpp"
 
 #endif  // closing endif for header file include guard
@@ -163,6 +163,44 @@ RAJA_INLINE T atomicCAS(seq_atomic, T volatile *acc, T compare, T value)
 }
 
 
+//
+// Ordered operations: sequential execution has no other threads to order
+// against, so the atomic_order tag is ignored.
+//
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicLoad(seq_atomic, Order, T volatile *acc)
+{
+  return *acc;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE void atomicStore(seq_atomic, Order, T volatile *acc, T value)
+{
+  *acc = value;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicExchange(seq_atomic, Order, T volatile *acc, T value)
+{
+  return atomicExchange(seq_atomic{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicAdd(seq_atomic, Order, T volatile *acc, T value)
+{
+  return atomicAdd(seq_atomic{}, acc, value);
+}
+
+
 }  // namespace RAJA
 
 
@@ -0,0 +1,93 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing sequential RAJA stream compaction.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_sequential_HPP
+#define RAJA_compact_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+/*!
+        \brief sequential copy_if given range, output, and predicate
+*/
+template <typename ExecPolicy, typename Iter, typename IterOut, typename Predicate>
+concepts::enable_if_t<Index_type,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+copy_if(const ExecPolicy &, Iter begin, Iter end, IterOut out, Predicate pred)
+{
+  Index_type num_selected = 0;
+
+  RAJA_NO_SIMD
+  for (Iter i = begin; i != end; ++i) {
+    if (pred(*i)) {
+      out[num_selected++] = *i;
+    }
+  }
+
+  return num_selected;
+}
+
+/*!
+        \brief sequential partition given range, output, and predicate
+
+        Rejected elements are written in reverse order at the end of the
+        output range to match the device-wide partition primitives.
+*/
+template <typename ExecPolicy, typename Iter, typename IterOut, typename Predicate>
+concepts::enable_if_t<Index_type,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+partition(const ExecPolicy &, Iter begin, Iter end, IterOut out, Predicate pred)
+{
+  using std::distance;
+  const Index_type n = distance(begin, end);
+
+  Index_type num_selected = 0;
+  Index_type num_rejected = 0;
+
+  RAJA_NO_SIMD
+  for (Index_type i = 0; i < n; ++i) {
+    if (pred(begin[i])) {
+      out[num_selected++] = begin[i];
+    } else {
+      out[n - 1 - num_rejected++] = begin[i];
+    }
+  }
+
+  return num_selected;
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,60 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA find declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_find_sequential_HPP
+#define RAJA_find_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/loop/find.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace find
+{
+
+/*!
+        \brief returns the offset of the first element satisfying the
+               predicate, or the range length
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+find_if(const ExecPolicy&,
+        Iter begin,
+        Iter end,
+        Predicate pred)
+{
+  return RAJA::impl::find::find_if(::RAJA::loop_exec{}, begin, end, pred);
+}
+
+}  // namespace find
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,84 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA multi-bin reduction templates for
+ *          sequential execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sequential_multi_reduce_HPP
+#define RAJA_sequential_multi_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <memory>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/multi_reduce.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Sequential multi-bin sum reducer. All copies of a reducer share one
+ * tally block; the combine at get() is a read of the single block.
+ */
+template <typename T>
+class MultiReduceSum<seq_reduce, T>
+{
+  using Combiner = reduce::sum<T>;
+
+public:
+  MultiReduceSum() = delete;
+
+  MultiReduceSum(size_t num_bins, T init_val = Combiner::identity())
+      : m_data(std::make_shared<reduce::detail::MultiReduceData<T>>(
+            1, num_bins, Combiner::identity())),
+        m_init_val(init_val)
+  {
+  }
+
+  //! accumulate val into the given bin
+  void add(size_t bin, T val) const
+  {
+    Combiner{}(m_data->thread_bins(0)[bin], val);
+  }
+
+  //! combined value for the given bin
+  T get(size_t bin) const
+  {
+    T result = m_init_val;
+    Combiner{}(result, m_data->template combine_bin<Combiner>(bin));
+    return result;
+  }
+
+  size_t size() const { return m_data->num_bins(); }
+
+  //! set all bins back to the initial value
+  void reset(T init_val = Combiner::identity())
+  {
+    m_init_val = init_val;
+    m_data->reset();
+  }
+
+private:
+  std::shared_ptr<reduce::detail::MultiReduceData<T>> m_data;
+  T m_init_val;
+};
+
+}  // end of namespace RAJA
+
+#endif  // closing endif for header file include guard
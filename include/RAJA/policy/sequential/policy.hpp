@@ -45,6 +45,13 @@ struct seq_region : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                           Platform::host> {
 };
 
+struct seq_sections_region
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::region,
+                                            Launch::sync,
+                                            Platform::host> {
+};
+
 struct seq_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                         Pattern::forall,
                                                         Launch::undefined,
@@ -83,6 +90,7 @@ struct seq_reduce : make_policy_pattern_launch_platform_t<Policy::sequential,
 using policy::sequential::seq_exec;
 using policy::sequential::seq_reduce;
 using policy::sequential::seq_region;
+using policy::sequential::seq_sections_region;
 using policy::sequential::seq_segit;
 using policy::sequential::seq_work;
 
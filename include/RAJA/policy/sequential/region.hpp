@@ -8,6 +8,8 @@
 #ifndef RAJA_region_sequential_HPP
 #define RAJA_region_sequential_HPP
 
+#include "camp/camp.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -40,6 +42,30 @@ RAJA_INLINE void region_impl(const seq_region &, Func &&body)
   body();
 }
 
+/*!
+ * \brief RAJA::region_sections implementation for sequential
+ *
+ * Runs the section bodies one after another in declaration order
+ *
+ * \code
+ *
+ * RAJA::region_sections<seq_sections_region>(
+ *   [=]() { // first loop sequence },
+ *   [=]() { // second loop sequence });
+ *
+ * \endcode
+ *
+ * \tparam Policy region policy
+ *
+ */
+
+template <typename... Bodies>
+RAJA_INLINE void region_sections_impl(const seq_sections_region &,
+                                      Bodies &&... bodies)
+{
+  camp::sink((bodies(), 0)...);
+}
+
 }  // namespace sequential
 
 }  // namespace policy
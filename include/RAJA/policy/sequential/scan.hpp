@@ -44,7 +44,9 @@ template <typename ExecPolicy, typename Iter, typename BinFn>
 concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
 inclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f)
 {
-  using ValueT = typename std::remove_reference<decltype(*begin)>::type;
+  // accumulate in the iterator's value type so proxy-reference iterators
+  // (e.g. ZipIterator) aggregate into a copy, not through the proxy
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
   ValueT agg = *begin;
 
   RAJA_NO_SIMD
@@ -66,12 +68,12 @@ exclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f, T v)
   const auto n = distance(begin, end);
   using DistanceT = typename std::remove_const<decltype(n)>::type;
 
-  using ValueT = typename std::remove_reference<decltype(*begin)>::type;
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
   ValueT agg = v;
 
   RAJA_NO_SIMD
   for (DistanceT i = 0; i < n; ++i) {
-    auto t = begin[i];
+    ValueT t = begin[i];
     begin[i] = agg;
     agg = f(agg, t);
   }
@@ -89,7 +91,7 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> inclusive(
     OutIter out,
     BinFn f)
 {
-  using ValueT = typename std::remove_reference<decltype(*out)>::type;
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
   ValueT agg = *begin;
 
   *out++ = agg;
@@ -118,7 +120,7 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> exclusive(
     BinFn f,
     T v)
 {
-  using ValueT = typename std::remove_const<decltype(*begin)>::type;
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
   ValueT agg = v;
   OutIter o = out;
   *o++ = v;
@@ -130,6 +132,75 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> exclusive(
   }
 }
 
+/*!
+        \brief explicit inclusive scan by key given key range, input values,
+   output, and function; the scan restarts at each key change
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+inclusive_by_key(const ExecPolicy &,
+                 const KeyIter keys,
+                 const KeyIter keys_end,
+                 Iter begin,
+                 OutIter out,
+                 BinFn f)
+{
+  using std::distance;
+  const auto n = distance(keys, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  ValueT agg{};
+
+  RAJA_NO_SIMD
+  for (DistanceT i = 0; i < n; ++i) {
+    ValueT t = begin[i];
+    agg = (i == 0 || !(keys[i] == keys[i - 1])) ? t : f(agg, t);
+    out[i] = agg;
+  }
+}
+
+/*!
+        \brief explicit exclusive scan by key given key range, input values,
+   output, function, and initial value; the scan restarts at each key change
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+exclusive_by_key(const ExecPolicy &,
+                 const KeyIter keys,
+                 const KeyIter keys_end,
+                 Iter begin,
+                 OutIter out,
+                 BinFn f,
+                 T v)
+{
+  using std::distance;
+  const auto n = distance(keys, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  ValueT agg = v;
+
+  RAJA_NO_SIMD
+  for (DistanceT i = 0; i < n; ++i) {
+    ValueT t = begin[i];
+    if (i > 0 && !(keys[i] == keys[i - 1])) {
+      agg = v;
+    }
+    out[i] = agg;
+    agg = f(agg, t);
+  }
+}
+
 }  // namespace scan
 
 }  // namespace impl
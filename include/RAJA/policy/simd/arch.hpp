@@ -0,0 +1,85 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing runtime instruction-set detection for
+ *          the multi-versioned simd execution policy.
+ *
+ *          On x86 with compilers that support function target attributes,
+ *          loops run under simd_multi_exec are compiled once per
+ *          instruction set and the widest set the processor supports is
+ *          selected per process from CPUID. Elsewhere detection reports
+ *          Arch::scalar and dispatch degrades to the portable simd loop.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_simd_arch_HPP
+#define RAJA_policy_simd_arch_HPP
+
+#include "RAJA/config.hpp"
+
+//
+// Multi-versioned dispatch requires the gcc/clang target function
+// attribute and __builtin_cpu_supports, and only makes sense when
+// compiling host code for x86.
+//
+#if (defined(RAJA_COMPILER_GNU) || defined(RAJA_COMPILER_CLANG)) && \
+    (defined(__x86_64__) || defined(__i386__)) &&                   \
+    !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+#define RAJA_SIMD_ARCH_DISPATCH
+#endif
+
+#if defined(RAJA_SIMD_ARCH_DISPATCH)
+#define RAJA_TARGET_SSE __attribute__((target("sse2")))
+#define RAJA_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define RAJA_TARGET_AVX512 \
+  __attribute__((target("avx512f,avx512dq,avx512bw,avx512vl")))
+#endif
+
+namespace RAJA
+{
+
+namespace simd
+{
+
+//! Instruction sets distinguished by simd_multi_exec runtime dispatch
+enum struct Arch : int { scalar, sse, avx2, avx512 };
+
+//! Query CPUID for the widest instruction set this process may use
+RAJA_INLINE Arch detect_arch()
+{
+#if defined(RAJA_SIMD_ARCH_DISPATCH)
+  if (__builtin_cpu_supports("avx512f")) {
+    return Arch::avx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return Arch::avx2;
+  }
+  if (__builtin_cpu_supports("sse2")) {
+    return Arch::sse;
+  }
+#endif
+  return Arch::scalar;
+}
+
+//! Instruction set used by simd_multi_exec, detected once per process
+RAJA_INLINE Arch detected_arch()
+{
+  static Arch arch = detect_arch();
+  return arch;
+}
+
+}  // namespace simd
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -33,9 +33,13 @@
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/index/RangeSegment.hpp"
+
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/policy/simd/arch.hpp"
 #include "RAJA/policy/simd/policy.hpp"
+#include "RAJA/policy/simd/register.hpp"
 
 namespace RAJA
 {
@@ -62,6 +66,181 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::
   return RAJA::resources::EventProxy<resources::Host>(&host_res);
 }
 
+///
+/// Specialized traversal for strided range segments. The stride of a
+/// TypedRangeStrideSegment is a runtime value, so in the generic loop
+/// above the vectorizer must assume an arbitrary stride and falls back
+/// to gathers (or gives up). Dispatching once on the stride exposes the
+/// unit-stride cases to the compiler as literal constants: stride 1
+/// vectorizes as the contiguous loop it is, and stride -1 (reverse
+/// contiguous, e.g. backward-substitution sweeps) vectorizes with
+/// reversed vector loads instead of per-iteration strided addressing.
+///
+template <typename StorageT, typename DiffT, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    RAJA::resources::Host &host_res,
+    const simd_exec &,
+    TypedRangeStrideSegment<StorageT, DiffT> iter,
+    Func &&loop_body)
+{
+  using value_type =
+      typename TypedRangeStrideSegment<StorageT, DiffT>::value_type;
+  auto begin = std::begin(iter);
+  const DiffT distance = iter.size();
+  const DiffT stride = begin.get_stride();
+  const auto first = stripIndexType(*begin);
+
+  if (stride == DiffT{1}) {
+    RAJA_SIMD
+    for (DiffT i = 0; i < distance; ++i) {
+      loop_body(value_type(first + i));
+    }
+  } else if (stride == DiffT{-1}) {
+    RAJA_SIMD
+    for (DiffT i = 0; i < distance; ++i) {
+      loop_body(value_type(first - i));
+    }
+  } else {
+    RAJA_SIMD
+    for (DiffT i = 0; i < distance; ++i) {
+      loop_body(begin[i]);
+    }
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(&host_res);
+}
+
+#if defined(RAJA_SIMD_ARCH_DISPATCH)
+
+namespace detail
+{
+
+//
+// One compilation of the simd loop per instruction set. These must not
+// be forced inline: inlining a target-attributed function into a caller
+// compiled for the baseline instruction set is ill-formed. The loop body
+// may still inline into each variant since it requires no extra features.
+//
+
+template <typename Iterable, typename Func>
+RAJA_TARGET_SSE void simd_forall_sse(Iterable &&iter, Func &&loop_body)
+{
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  RAJA_SIMD
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    loop_body(*(begin + i));
+  }
+}
+
+template <typename Iterable, typename Func>
+RAJA_TARGET_AVX2 void simd_forall_avx2(Iterable &&iter, Func &&loop_body)
+{
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  RAJA_SIMD
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    loop_body(*(begin + i));
+  }
+}
+
+template <typename Iterable, typename Func>
+RAJA_TARGET_AVX512 void simd_forall_avx512(Iterable &&iter, Func &&loop_body)
+{
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  RAJA_SIMD
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    loop_body(*(begin + i));
+  }
+}
+
+}  // namespace detail
+
+#endif  // RAJA_SIMD_ARCH_DISPATCH
+
+///
+/// Multi-versioned traversal for simd_multi_exec. The per-process
+/// instruction set is detected from CPUID on first use; each call then
+/// costs one predictable branch over the simd_exec loop.
+///
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    RAJA::resources::Host &host_res,
+    const simd_multi_exec &,
+    Iterable &&iter,
+    Func &&loop_body)
+{
+#if defined(RAJA_SIMD_ARCH_DISPATCH)
+  switch (RAJA::simd::detected_arch()) {
+    case RAJA::simd::Arch::avx512:
+      detail::simd_forall_avx512(std::forward<Iterable>(iter),
+                                 std::forward<Func>(loop_body));
+      break;
+    case RAJA::simd::Arch::avx2:
+      detail::simd_forall_avx2(std::forward<Iterable>(iter),
+                               std::forward<Func>(loop_body));
+      break;
+    case RAJA::simd::Arch::sse:
+      detail::simd_forall_sse(std::forward<Iterable>(iter),
+                              std::forward<Func>(loop_body));
+      break;
+    default: {
+      auto begin = std::begin(iter);
+      auto end = std::end(iter);
+      auto distance = std::distance(begin, end);
+      RAJA_SIMD
+      for (decltype(distance) i = 0; i < distance; ++i) {
+        loop_body(*(begin + i));
+      }
+    } break;
+  }
+#else
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  RAJA_SIMD
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    loop_body(*(begin + i));
+  }
+#endif
+
+  return RAJA::resources::EventProxy<resources::Host>(&host_res);
+}
+
+///
+/// Chunked traversal for simd_register_exec. The loop body receives a
+/// RAJA::simd::VectorIndex per register-wide chunk; all chunks except a
+/// possible tail cover a full register, so packed loads/stores in the body
+/// map onto full-width vector instructions deterministically.
+///
+template <camp::idx_t Width, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    RAJA::resources::Host &host_res,
+    const simd_register_exec<Width> &,
+    Iterable &&iter,
+    Func &&loop_body)
+{
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  using IndexType = camp::decay<decltype(*begin)>;
+
+  decltype(distance) i = 0;
+  for (; i + Width <= distance; i += Width) {
+    loop_body(RAJA::simd::VectorIndex<IndexType, Width>(*(begin + i), Width));
+  }
+  if (i < distance) {
+    loop_body(
+        RAJA::simd::VectorIndex<IndexType, Width>(*(begin + i), distance - i));
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(&host_res);
+}
+
 }  // namespace simd
 
 }  // namespace policy
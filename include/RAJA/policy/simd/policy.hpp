@@ -18,6 +18,8 @@
 #ifndef policy_simd_HPP
 #define policy_simd_HPP
 
+#include "camp/camp.hpp"
+
 #include "RAJA/policy/PolicyBase.hpp"
 
 //
@@ -44,11 +46,42 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+///
+/// Policy that compiles the loop once per x86 instruction set (SSE,
+/// AVX2, AVX-512) via target attributes and picks the widest set the
+/// processor supports at runtime, so a single binary uses AVX-512 on
+/// capable nodes of a heterogeneous cluster. Where target-attribute
+/// dispatch is unavailable it behaves exactly like simd_exec.
+///
+struct simd_multi_exec
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+///
+/// Policy that iterates in register-wide chunks, passing a
+/// RAJA::simd::VectorIndex for each chunk (including a masked partial
+/// tail) so loop bodies can operate on RAJA::simd::Register values
+/// explicitly rather than relying on auto-vectorization.
+///
+template <camp::idx_t Width>
+struct simd_register_exec
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static constexpr camp::idx_t width = Width;
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::simd_multi_exec;
+using policy::simd::simd_register_exec;
 
 }  // end of namespace RAJA
 
@@ -0,0 +1,484 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing a fixed-width vector register abstraction
+ *          used by the RAJA simd execution policies.
+ *
+ *          A Register is a small, aligned array of lanes whose operations
+ *          are expressed as full-width loops annotated with RAJA_SIMD so
+ *          that compilers emit vector instructions deterministically rather
+ *          than relying on auto-vectorization through a lambda.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_simd_register_HPP
+#define RAJA_policy_simd_register_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace simd
+{
+
+/*!
+ * \brief Default register width, in lanes, for an element type.
+ *
+ * Chosen so that a full register spans RAJA::DATA_ALIGN bytes, which is
+ * the widest vector unit RAJA is configured for (64 bytes covers AVX-512).
+ */
+template <typename T>
+struct RegisterTraits {
+  static constexpr camp::idx_t default_width =
+      (RAJA::DATA_ALIGN / camp::idx_t(sizeof(T))) > 0 ? (RAJA::DATA_ALIGN / camp::idx_t(sizeof(T))) : 1;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Fixed-width SIMD register of Width lanes of type T.
+ *
+ * All lane-wise operations are written as constant-trip-count loops with
+ * RAJA_SIMD annotations over aligned storage, which compilers reliably map
+ * onto single vector instructions. Partial (tail) operations take an
+ * explicit lane count; inactive lanes are left untouched on stores and
+ * filled with the identity value supplied by the caller on loads.
+ *
+ ******************************************************************************
+ */
+template <typename T, camp::idx_t Width = RegisterTraits<T>::default_width>
+class Register
+{
+  static_assert(Width > 0, "Register width must be positive");
+
+public:
+  using element_type = T;
+  static constexpr camp::idx_t width = Width;
+
+  RAJA_INLINE
+  Register() = default;
+
+  ///
+  /// Broadcast a scalar across all lanes
+  ///
+  RAJA_INLINE
+  explicit Register(T val)
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      m_value[i] = val;
+    }
+  }
+
+  RAJA_INLINE
+  T &get(camp::idx_t lane) { return m_value[lane]; }
+
+  RAJA_INLINE
+  T const &get(camp::idx_t lane) const { return m_value[lane]; }
+
+  ///
+  /// Load Width contiguous elements starting at ptr
+  ///
+  RAJA_INLINE
+  Register &load_packed(T const *ptr)
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      m_value[i] = ptr[i];
+    }
+    return *this;
+  }
+
+  ///
+  /// Load the first n contiguous elements starting at ptr, filling the
+  /// remaining lanes with fill (defaults to zero) so that reductions over
+  /// a partially loaded register remain well defined.
+  ///
+  RAJA_INLINE
+  Register &load_packed_n(T const *ptr, camp::idx_t n, T fill = T(0))
+  {
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      m_value[i] = (i < n) ? ptr[i] : fill;
+    }
+    return *this;
+  }
+
+  ///
+  /// Load Width elements with a constant stride between them
+  ///
+  RAJA_INLINE
+  Register &load_strided(T const *ptr, camp::idx_t stride)
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      m_value[i] = ptr[i * stride];
+    }
+    return *this;
+  }
+
+  ///
+  /// Gather Width elements using per-lane indices
+  ///
+  template <typename IdxT>
+  RAJA_INLINE Register &gather(T const *ptr, IdxT const *idx)
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      m_value[i] = ptr[idx[i]];
+    }
+    return *this;
+  }
+
+  ///
+  /// Gather the first n elements using per-lane indices
+  ///
+  template <typename IdxT>
+  RAJA_INLINE Register &gather_n(T const *ptr,
+                                 IdxT const *idx,
+                                 camp::idx_t n,
+                                 T fill = T(0))
+  {
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      m_value[i] = (i < n) ? ptr[idx[i]] : fill;
+    }
+    return *this;
+  }
+
+  ///
+  /// Store all lanes contiguously at ptr
+  ///
+  RAJA_INLINE
+  Register const &store_packed(T *ptr) const
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      ptr[i] = m_value[i];
+    }
+    return *this;
+  }
+
+  ///
+  /// Store the first n lanes contiguously at ptr
+  ///
+  RAJA_INLINE
+  Register const &store_packed_n(T *ptr, camp::idx_t n) const
+  {
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      if (i < n) {
+        ptr[i] = m_value[i];
+      }
+    }
+    return *this;
+  }
+
+  ///
+  /// Store all lanes with a constant stride between them
+  ///
+  RAJA_INLINE
+  Register const &store_strided(T *ptr, camp::idx_t stride) const
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      ptr[i * stride] = m_value[i];
+    }
+    return *this;
+  }
+
+  ///
+  /// Scatter all lanes using per-lane indices
+  ///
+  template <typename IdxT>
+  RAJA_INLINE Register const &scatter(T *ptr, IdxT const *idx) const
+  {
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      ptr[idx[i]] = m_value[i];
+    }
+    return *this;
+  }
+
+  ///
+  /// Scatter the first n lanes using per-lane indices
+  ///
+  template <typename IdxT>
+  RAJA_INLINE Register const &scatter_n(T *ptr,
+                                        IdxT const *idx,
+                                        camp::idx_t n) const
+  {
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      if (i < n) {
+        ptr[idx[i]] = m_value[i];
+      }
+    }
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register operator+(Register const &rhs) const
+  {
+    Register result;
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      result.m_value[i] = m_value[i] + rhs.m_value[i];
+    }
+    return result;
+  }
+
+  RAJA_INLINE
+  Register operator-(Register const &rhs) const
+  {
+    Register result;
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      result.m_value[i] = m_value[i] - rhs.m_value[i];
+    }
+    return result;
+  }
+
+  RAJA_INLINE
+  Register operator*(Register const &rhs) const
+  {
+    Register result;
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      result.m_value[i] = m_value[i] * rhs.m_value[i];
+    }
+    return result;
+  }
+
+  RAJA_INLINE
+  Register operator/(Register const &rhs) const
+  {
+    Register result;
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      result.m_value[i] = m_value[i] / rhs.m_value[i];
+    }
+    return result;
+  }
+
+  RAJA_INLINE
+  Register &operator+=(Register const &rhs)
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      m_value[i] += rhs.m_value[i];
+    }
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &operator-=(Register const &rhs)
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      m_value[i] -= rhs.m_value[i];
+    }
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &operator*=(Register const &rhs)
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      m_value[i] *= rhs.m_value[i];
+    }
+    return *this;
+  }
+
+  ///
+  /// Fused multiply-add: this * b + c, lane-wise
+  ///
+  RAJA_INLINE
+  Register multiply_add(Register const &b, Register const &c) const
+  {
+    Register result;
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      result.m_value[i] = m_value[i] * b.m_value[i] + c.m_value[i];
+    }
+    return result;
+  }
+
+  ///
+  /// Horizontal sum of all lanes
+  ///
+  RAJA_INLINE
+  T sum() const
+  {
+    T result(0);
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      result += m_value[i];
+    }
+    return result;
+  }
+
+  ///
+  /// Horizontal minimum of all lanes
+  ///
+  RAJA_INLINE
+  T min() const
+  {
+    T result = m_value[0];
+    for (camp::idx_t i = 1; i < Width; ++i) {
+      result = (m_value[i] < result) ? m_value[i] : result;
+    }
+    return result;
+  }
+
+  ///
+  /// Horizontal maximum of all lanes
+  ///
+  RAJA_INLINE
+  T max() const
+  {
+    T result = m_value[0];
+    for (camp::idx_t i = 1; i < Width; ++i) {
+      result = (m_value[i] > result) ? m_value[i] : result;
+    }
+    return result;
+  }
+
+private:
+  alignas(RAJA::DATA_ALIGN) T m_value[Width];
+};
+
+
+///
+/// Lane-wise transcendental math on registers. The loops call the
+/// RAJA_DECLARE_SIMD-annotated scalar wrappers from RAJA::operators, so
+/// compilers with a vector math library (libmvec, SVML) emit one vector
+/// call per register instead of Width scalar libm calls.
+///
+
+template <typename T, camp::idx_t Width>
+RAJA_INLINE Register<T, Width> exp(Register<T, Width> const &arg)
+{
+  Register<T, Width> result;
+  RAJA_SIMD
+  for (camp::idx_t i = 0; i < Width; ++i) {
+    result.get(i) = RAJA::operators::detail::sv_exp(arg.get(i));
+  }
+  return result;
+}
+
+template <typename T, camp::idx_t Width>
+RAJA_INLINE Register<T, Width> log(Register<T, Width> const &arg)
+{
+  Register<T, Width> result;
+  RAJA_SIMD
+  for (camp::idx_t i = 0; i < Width; ++i) {
+    result.get(i) = RAJA::operators::detail::sv_log(arg.get(i));
+  }
+  return result;
+}
+
+template <typename T, camp::idx_t Width>
+RAJA_INLINE Register<T, Width> sqrt(Register<T, Width> const &arg)
+{
+  Register<T, Width> result;
+  RAJA_SIMD
+  for (camp::idx_t i = 0; i < Width; ++i) {
+    result.get(i) = RAJA::operators::detail::sv_sqrt(arg.get(i));
+  }
+  return result;
+}
+
+template <typename T, camp::idx_t Width>
+RAJA_INLINE Register<T, Width> pow(Register<T, Width> const &base,
+                                   Register<T, Width> const &exponent)
+{
+  Register<T, Width> result;
+  RAJA_SIMD
+  for (camp::idx_t i = 0; i < Width; ++i) {
+    result.get(i) = RAJA::operators::detail::sv_pow(base.get(i),
+                                                    exponent.get(i));
+  }
+  return result;
+}
+
+///
+/// pow with one scalar exponent across all lanes, the common case for
+/// equation-of-state kernels
+///
+template <typename T, camp::idx_t Width>
+RAJA_INLINE Register<T, Width> pow(Register<T, Width> const &base, T exponent)
+{
+  Register<T, Width> result;
+  RAJA_SIMD
+  for (camp::idx_t i = 0; i < Width; ++i) {
+    result.get(i) = RAJA::operators::detail::sv_pow(base.get(i), exponent);
+  }
+  return result;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Index of one register-wide chunk of an iteration space.
+ *
+ * Passed to loop bodies executed with simd_register_exec. Carries the
+ * scalar index of the first lane and the number of active lanes, which is
+ * Width for all chunks except a possible partial tail. Loop bodies use it
+ * to drive packed loads/stores with correct masked tail handling.
+ *
+ ******************************************************************************
+ */
+template <typename IndexType, camp::idx_t Width>
+class VectorIndex
+{
+public:
+  static constexpr camp::idx_t width = Width;
+
+  RAJA_INLINE
+  constexpr VectorIndex(IndexType begin, camp::idx_t size)
+      : m_begin(begin), m_size(size)
+  {
+  }
+
+  ///
+  /// Scalar index of lane 0
+  ///
+  RAJA_INLINE
+  constexpr IndexType begin() const { return m_begin; }
+
+  ///
+  /// Number of active lanes in this chunk
+  ///
+  RAJA_INLINE
+  constexpr camp::idx_t size() const { return m_size; }
+
+  ///
+  /// True when every lane of the register is active
+  ///
+  RAJA_INLINE
+  constexpr bool is_full() const { return m_size == Width; }
+
+private:
+  IndexType m_begin;
+  camp::idx_t m_size;
+};
+
+}  // end of namespace simd
+
+}  // end of namespace RAJA
+
+#endif  // closing endif for header file include guard
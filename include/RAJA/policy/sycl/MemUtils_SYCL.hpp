@@ -0,0 +1,88 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing prototypes and methods for managing
+ *          the SYCL queue RAJA submits work to.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_MemUtils_SYCL_HPP
+#define RAJA_MemUtils_SYCL_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <CL/sycl.hpp>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace sycl
+{
+
+namespace detail
+{
+
+//! pointer the queue accessors hand out; nullptr selects the default
+RAJA_INLINE cl::sycl::queue*& queue_slot()
+{
+  static cl::sycl::queue* queue = nullptr;
+  return queue;
+}
+
+}  // namespace detail
+
+/*!
+ * Get the queue all RAJA SYCL policies submit work to. By default this
+ * is an in-order queue on the default device, created on first use;
+ * in-order matches the stream semantics the CUDA and HIP back-ends
+ * give synchronous and async policies.
+ */
+RAJA_INLINE cl::sycl::queue* getQueue()
+{
+  if (detail::queue_slot() == nullptr) {
+    static cl::sycl::queue default_queue{
+        cl::sycl::default_selector{},
+        cl::sycl::property::queue::in_order{}};
+    detail::queue_slot() = &default_queue;
+  }
+  return detail::queue_slot();
+}
+
+/*!
+ * Replace the queue RAJA submits to, for embedders that own their SYCL
+ * context. The queue must be in-order and must outlive all RAJA calls;
+ * pass nullptr to return to the RAJA-owned default. Call only while no
+ * asynchronous RAJA work is in flight.
+ */
+RAJA_INLINE void setQueue(cl::sycl::queue* queue)
+{
+  detail::queue_slot() = queue;
+}
+
+//! block until all work submitted to the RAJA queue has completed
+RAJA_INLINE void synchronize()
+{
+  getQueue()->wait_and_throw();
+}
+
+}  // namespace sycl
+
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_SYCL
+
+#endif  // closing endif for header file include guard
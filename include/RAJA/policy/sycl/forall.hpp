@@ -0,0 +1,108 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA segment template methods for
+ *          execution via SYCL kernel launch.
+ *
+ *          These methods should work on any platform that supports
+ *          SYCL devices.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_sycl_HPP
+#define RAJA_forall_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <algorithm>
+
+#include <CL/sycl.hpp>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+
+namespace RAJA
+{
+
+namespace policy
+{
+namespace sycl
+{
+
+/*!
+ * SYCL forall policy implementation: one work-item per iterate, in
+ * work-groups of the policy's size clamped to the device limit. The
+ * loop body and iterator are captured by value into the kernel lambda,
+ * so both must be device-copyable; data they reference must be USM or
+ * buffer-accessor memory. With Async the queue is not waited on here;
+ * use RAJA::synchronize<RAJA::sycl_synchronize>() to observe results.
+ */
+template <size_t WORK_GROUP_SIZE, bool Async, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    resources::Host &host_res,
+    const sycl_exec<WORK_GROUP_SIZE, Async> &,
+    Iterable &&iter,
+    Func &&loop_body)
+{
+  using Body = camp::decay<Func>;
+  Body body = loop_body;
+
+  RAJA_EXTRACT_BED_IT(iter);
+
+  if (distance_it > 0) {
+    cl::sycl::queue *q = ::RAJA::sycl::getQueue();
+
+    size_t wg_size = WORK_GROUP_SIZE;
+    size_t device_max =
+        q->get_device()
+            .get_info<cl::sycl::info::device::max_work_group_size>();
+    wg_size = std::min(wg_size, device_max);
+
+    size_t len = static_cast<size_t>(distance_it);
+    size_t global_size = ((len + wg_size - 1) / wg_size) * wg_size;
+
+    q->submit([&](cl::sycl::handler &h) {
+      h.parallel_for(
+          cl::sycl::nd_range<1>{cl::sycl::range<1>{global_size},
+                                cl::sycl::range<1>{wg_size}},
+          [=](cl::sycl::nd_item<1> item) {
+            size_t i = item.get_global_id(0);
+            if (i < len) {
+              Body ib = body;
+              ib(begin_it[i]);
+            }
+          });
+    });
+
+    if (!Async) {
+      q->wait_and_throw();
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+}  // namespace sycl
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_SYCL
+
+#endif  // closing endif for header file include guard
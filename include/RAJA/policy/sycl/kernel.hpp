@@ -0,0 +1,27 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing constructs used to run kernel
+ *          traversals on devices with SYCL.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_sycl_kernel_HPP
+#define RAJA_policy_sycl_kernel_HPP
+
+#include "RAJA/policy/sycl/kernel/For.hpp"
+#include "RAJA/policy/sycl/kernel/Lambda.hpp"
+#include "RAJA/policy/sycl/kernel/SyclKernel.hpp"
+#include "RAJA/policy/sycl/kernel/internal.hpp"
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,211 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing constructs used to run kernel
+ *          traversals on devices with SYCL.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_sycl_kernel_For_HPP
+#define RAJA_policy_sycl_kernel_For_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+
+#include "RAJA/policy/sycl/kernel/internal.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+/*
+ * Executor for work sharing inside SyclKernel.
+ * Mapping directly from global ids in the given dimension to indices.
+ * Assigns the loop index to offset ArgumentId.
+ */
+template <typename Data,
+          camp::idx_t ArgumentId,
+          int Dim,
+          typename... EnclosedStmts,
+          typename Types>
+struct SyclStatementExecutor<
+    Data,
+    statement::For<ArgumentId, RAJA::sycl_global_012_direct<Dim>, EnclosedStmts...>,
+    Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  // Set the argument type for this loop
+  using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+  using enclosed_stmts_t =
+      SyclStatementListExecutor<Data, stmt_list_t, NewTypes>;
+
+  using diff_t = segment_diff_type<ArgumentId, Data>;
+
+  static inline void exec(Data &data,
+                          cl::sycl::nd_item<3> item,
+                          bool thread_active)
+  {
+    diff_t len = segment_length<ArgumentId>(data);
+    diff_t i = static_cast<diff_t>(item.get_global_id(Dim));
+
+    // assign global id directly to offset
+    data.template assign_offset<ArgumentId>(i);
+
+    // execute enclosed statements if in bounds
+    enclosed_stmts_t::exec(data, item, thread_active && (i < len));
+  }
+
+
+  static inline SyclLaunchDims calculateDimensions(Data const &data)
+  {
+    diff_t len = segment_length<ArgumentId>(data);
+
+    // request one work-item per element in the segment
+    SyclLaunchDims dims;
+    set_sycl_dim<Dim>(dims.global, len);
+
+    // since we are direct-mapping, we REQUIRE len
+    set_sycl_dim<Dim>(dims.min_global, len);
+
+    // combine with enclosed statements
+    SyclLaunchDims enclosed_dims = enclosed_stmts_t::calculateDimensions(data);
+    return dims.max(enclosed_dims);
+  }
+};
+
+
+/*
+ * Executor for work sharing inside SyclKernel.
+ * Provides a global-range-stride loop in the given dimension.
+ * Assigns the loop index to offset ArgumentId.
+ */
+template <typename Data,
+          camp::idx_t ArgumentId,
+          int Dim,
+          typename... EnclosedStmts,
+          typename Types>
+struct SyclStatementExecutor<
+    Data,
+    statement::For<ArgumentId, RAJA::sycl_global_012_loop<Dim>, EnclosedStmts...>,
+    Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  // Set the argument type for this loop
+  using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+  using enclosed_stmts_t =
+      SyclStatementListExecutor<Data, stmt_list_t, NewTypes>;
+
+  using diff_t = segment_diff_type<ArgumentId, Data>;
+
+  static inline void exec(Data &data,
+                          cl::sycl::nd_item<3> item,
+                          bool thread_active)
+  {
+    diff_t len = segment_length<ArgumentId>(data);
+    diff_t i_init = static_cast<diff_t>(item.get_global_id(Dim));
+    diff_t i_stride = static_cast<diff_t>(item.get_global_range(Dim));
+
+    for (diff_t i = i_init; i < len; i += i_stride) {
+
+      // assign global id to offset
+      data.template assign_offset<ArgumentId>(i);
+
+      // execute enclosed statements
+      enclosed_stmts_t::exec(data, item, thread_active);
+    }
+  }
+
+
+  static inline SyclLaunchDims calculateDimensions(Data const &data)
+  {
+    diff_t len = segment_length<ArgumentId>(data);
+
+    // request one work-item per element, but the stride loop tolerates
+    // any smaller launch, so no minimum is required
+    SyclLaunchDims dims;
+    set_sycl_dim<Dim>(dims.global, len);
+
+    // combine with enclosed statements
+    SyclLaunchDims enclosed_dims = enclosed_stmts_t::calculateDimensions(data);
+    return dims.max(enclosed_dims);
+  }
+};
+
+
+/*
+ * Executor for sequential loops inside SyclKernel.
+ * Each work-item runs the whole segment; used for inner loops that must
+ * stay sequential per work-item.
+ */
+template <typename Data,
+          camp::idx_t ArgumentId,
+          typename... EnclosedStmts,
+          typename Types>
+struct SyclStatementExecutor<
+    Data,
+    statement::For<ArgumentId, seq_exec, EnclosedStmts...>,
+    Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  // Set the argument type for this loop
+  using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+  using enclosed_stmts_t =
+      SyclStatementListExecutor<Data, stmt_list_t, NewTypes>;
+
+  using diff_t = segment_diff_type<ArgumentId, Data>;
+
+  static inline void exec(Data &data,
+                          cl::sycl::nd_item<3> item,
+                          bool thread_active)
+  {
+    diff_t len = segment_length<ArgumentId>(data);
+
+    for (diff_t i = 0; i < len; ++i) {
+
+      // assign i to offset
+      data.template assign_offset<ArgumentId>(i);
+
+      // execute enclosed statements
+      enclosed_stmts_t::exec(data, item, thread_active);
+    }
+  }
+
+
+  static inline SyclLaunchDims calculateDimensions(Data const &data)
+  {
+    return enclosed_stmts_t::calculateDimensions(data);
+  }
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,69 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing constructs used to run kernel
+ *          traversals on devices with SYCL.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_sycl_kernel_Lambda_HPP
+#define RAJA_policy_sycl_kernel_Lambda_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/pattern/kernel/Lambda.hpp"
+
+#include "RAJA/policy/sycl/kernel/internal.hpp"
+
+
+namespace RAJA
+{
+namespace internal
+{
+
+template <typename Data, camp::idx_t LambdaIndex, typename... Args, typename Types>
+struct SyclStatementExecutor<Data, statement::Lambda<LambdaIndex, Args...>, Types> {
+
+  static inline void exec(Data &data,
+                          cl::sycl::nd_item<3>,
+                          bool thread_active)
+  {
+    // Only execute the lambda if it hasn't been masked off
+    if (thread_active) {
+      StatementExecutor<statement::Lambda<LambdaIndex, Args...>, Types>::exec(data);
+    }
+  }
+
+
+  static inline SyclLaunchDims calculateDimensions(
+      Data const &RAJA_UNUSED_ARG(data))
+  {
+    return SyclLaunchDims();
+  }
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,182 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing constructs used to run kernel
+ *          traversals on devices with SYCL.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_sycl_kernel_SyclKernel_HPP
+#define RAJA_policy_sycl_kernel_SyclKernel_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <algorithm>
+
+#include <CL/sycl.hpp>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/Lambda.hpp"
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+
+#include "RAJA/policy/sycl/kernel/internal.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * SYCL kernel launch policy where the user specifies the maximum
+ * work-group size in the innermost dimension; the launch clamps it to
+ * the device limit.
+ */
+template <bool async0, int work_group_size>
+struct sycl_launch {
+};
+
+namespace statement
+{
+
+/*!
+ * A RAJA::kernel statement that launches a SYCL kernel.
+ */
+template <typename LaunchConfig, typename... EnclosedStmts>
+struct SyclKernelExt
+    : public internal::Statement<sycl_exec<0>, EnclosedStmts...> {
+};
+
+/*!
+ * A RAJA::kernel statement that launches a SYCL kernel with a fixed
+ * maximum work-group size. The kernel launch is synchronous.
+ */
+template <int work_group_size, typename... EnclosedStmts>
+using SyclKernelFixed =
+    SyclKernelExt<sycl_launch<false, work_group_size>, EnclosedStmts...>;
+
+/*!
+ * A RAJA::kernel statement that launches a SYCL kernel with a fixed
+ * maximum work-group size. The kernel launch is asynchronous.
+ */
+template <int work_group_size, typename... EnclosedStmts>
+using SyclKernelFixedAsync =
+    SyclKernelExt<sycl_launch<true, work_group_size>, EnclosedStmts...>;
+
+/*!
+ * A RAJA::kernel statement that launches a SYCL kernel with work-groups
+ * of up to 256 work-items. The kernel launch is synchronous.
+ */
+template <typename... EnclosedStmts>
+using SyclKernel = SyclKernelFixed<256, EnclosedStmts...>;
+
+/*!
+ * A RAJA::kernel statement that launches a SYCL kernel with work-groups
+ * of up to 256 work-items. The kernel launch is asynchronous.
+ */
+template <typename... EnclosedStmts>
+using SyclKernelAsync = SyclKernelFixedAsync<256, EnclosedStmts...>;
+
+}  // namespace statement
+
+namespace internal
+{
+
+/*!
+ * Specialization that launches SYCL kernels for RAJA::kernel from host
+ * code. Unlike the CUDA and HIP launchers there is no occupancy
+ * machinery: the statement tree requests global sizes per dimension,
+ * the innermost dimension is grouped by the launch policy's work-group
+ * size clamped to the device limit, and each global size is rounded up
+ * to whole work-groups with the executors masking the overhang.
+ */
+template <bool async0,
+          int work_group_size,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::SyclKernelExt<sycl_launch<async0, work_group_size>,
+                             EnclosedStmts...>,
+    Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  template <typename Data>
+  static inline void exec(Data &&data)
+  {
+    using data_t = camp::decay<Data>;
+    using executor_t =
+        sycl_statement_list_executor_t<stmt_list_t, data_t, Types>;
+
+    //
+    // Compute the requested kernel dimensions
+    //
+    SyclLaunchDims launch_dims = executor_t::calculateDimensions(data);
+    launch_dims.clamp_to_min_global();
+
+    // Only launch kernel if we have something to iterate over
+    if (launch_dims.num_items() > 0) {
+
+      cl::sycl::queue *q = ::RAJA::sycl::getQueue();
+
+      size_t wg_size = static_cast<size_t>(work_group_size);
+      size_t device_max =
+          q->get_device()
+              .get_info<cl::sycl::info::device::max_work_group_size>();
+      wg_size = std::min(wg_size, device_max);
+
+      cl::sycl::range<3> local{
+          std::min(wg_size,
+                   launch_dims.global[0] ? launch_dims.global[0] : 1),
+          1,
+          1};
+      cl::sycl::range<3> global{
+          ((std::max<size_t>(launch_dims.global[0], 1) + local[0] - 1) /
+           local[0]) * local[0],
+          std::max<size_t>(launch_dims.global[1], 1),
+          std::max<size_t>(launch_dims.global[2], 1)};
+
+      //
+      // Privatize the LoopData before submission so the kernel lambda
+      // captures its own copy by value
+      //
+      data_t launch_data = data;
+
+      q->submit([&](cl::sycl::handler &h) {
+        h.parallel_for(cl::sycl::nd_range<3>{global, local},
+                       [=](cl::sycl::nd_item<3> item) {
+                         data_t private_data = launch_data;
+                         executor_t::exec(private_data, item, true);
+                       });
+      });
+
+      if (!async0) {
+        q->wait_and_throw();
+      }
+    }
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
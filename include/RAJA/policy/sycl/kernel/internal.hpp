@@ -0,0 +1,206 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing constructs used to run kernel
+ *          traversals on devices with SYCL.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#ifndef RAJA_policy_sycl_kernel_internal_HPP
+#define RAJA_policy_sycl_kernel_internal_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <algorithm>
+
+#include <CL/sycl.hpp>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+//
+// SYCL has no free functions for work-item ids, so unlike the CUDA and
+// HIP statement executors the SYCL ones receive the launch's nd_item
+// alongside the loop data; the hierarchy is otherwise the same shape.
+//
+
+RAJA_INLINE
+size_t get_size(sycl_dim_t dims)
+{
+  if (dims[0] == 0 && dims[1] == 0 && dims[2] == 0) {
+    return 0;
+  }
+  return (dims[0] ? dims[0] : 1) *
+         (dims[1] ? dims[1] : 1) *
+         (dims[2] ? dims[2] : 1);
+}
+
+struct SyclLaunchDims {
+
+  sycl_dim_t global;
+  sycl_dim_t min_global;
+
+  RAJA_INLINE
+  SyclLaunchDims() : global{0, 0, 0}, min_global{0, 0, 0} {}
+
+  RAJA_INLINE
+  SyclLaunchDims(SyclLaunchDims const &c)
+      : global(c.global), min_global(c.min_global)
+  {
+  }
+
+  RAJA_INLINE
+  SyclLaunchDims max(SyclLaunchDims const &c) const
+  {
+    SyclLaunchDims result;
+
+    result.global[0] = std::max(c.global[0], global[0]);
+    result.global[1] = std::max(c.global[1], global[1]);
+    result.global[2] = std::max(c.global[2], global[2]);
+
+    result.min_global[0] = std::max(c.min_global[0], min_global[0]);
+    result.min_global[1] = std::max(c.min_global[1], min_global[1]);
+    result.min_global[2] = std::max(c.min_global[2], min_global[2]);
+
+    return result;
+  }
+
+  RAJA_INLINE
+  size_t num_items() const { return get_size(global); }
+
+  RAJA_INLINE
+  void clamp_to_min_global()
+  {
+    global[0] = std::max(min_global[0], global[0]);
+    global[1] = std::max(min_global[1], global[1]);
+    global[2] = std::max(min_global[2], global[2]);
+  };
+};
+
+
+template <camp::idx_t cur_stmt, camp::idx_t num_stmts, typename StmtList>
+struct SyclStatementListExecutorHelper {
+
+  using next_helper_t =
+      SyclStatementListExecutorHelper<cur_stmt + 1, num_stmts, StmtList>;
+
+  using cur_stmt_t = camp::at_v<StmtList, cur_stmt>;
+
+  template <typename Data>
+  inline static void exec(Data &data,
+                          cl::sycl::nd_item<3> item,
+                          bool thread_active)
+  {
+    // Execute stmt
+    cur_stmt_t::exec(data, item, thread_active);
+
+    // Execute next stmt
+    next_helper_t::exec(data, item, thread_active);
+  }
+
+
+  template <typename Data>
+  inline static SyclLaunchDims calculateDimensions(Data &data)
+  {
+    // Compute this statements launch dimensions
+    SyclLaunchDims statement_dims = cur_stmt_t::calculateDimensions(data);
+
+    // call the next statement in the list
+    SyclLaunchDims next_dims = next_helper_t::calculateDimensions(data);
+
+    // Return the maximum of the two
+    return statement_dims.max(next_dims);
+  }
+};
+
+template <camp::idx_t num_stmts, typename StmtList>
+struct SyclStatementListExecutorHelper<num_stmts, num_stmts, StmtList> {
+
+  template <typename Data>
+  inline static void exec(Data &, cl::sycl::nd_item<3>, bool)
+  {
+    // nop terminator
+  }
+
+  template <typename Data>
+  inline static SyclLaunchDims calculateDimensions(Data &)
+  {
+    return SyclLaunchDims();
+  }
+};
+
+
+template <typename Data, typename Policy, typename Types>
+struct SyclStatementExecutor;
+
+template <typename Data, typename StmtList, typename Types>
+struct SyclStatementListExecutor;
+
+
+template <typename Data, typename... Stmts, typename Types>
+struct SyclStatementListExecutor<Data, StatementList<Stmts...>, Types> {
+
+  using enclosed_stmts_t =
+      camp::list<SyclStatementExecutor<Data, Stmts, Types>...>;
+
+  static constexpr size_t num_stmts = sizeof...(Stmts);
+
+  static inline void exec(Data &data,
+                          cl::sycl::nd_item<3> item,
+                          bool thread_active)
+  {
+    // Execute statements in order with helper class
+    SyclStatementListExecutorHelper<0, num_stmts, enclosed_stmts_t>::exec(
+        data, item, thread_active);
+  }
+
+
+  static inline SyclLaunchDims calculateDimensions(Data const &data)
+  {
+    // Compute this statements launch dimensions
+    return SyclStatementListExecutorHelper<0, num_stmts, enclosed_stmts_t>::
+        calculateDimensions(data);
+  }
+};
+
+
+template <typename StmtList, typename Data, typename Types>
+using sycl_statement_list_executor_t = SyclStatementListExecutor<
+    Data,
+    StmtList,
+    Types>;
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
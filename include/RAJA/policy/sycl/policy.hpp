@@ -0,0 +1,174 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA SYCL policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_sycl_HPP
+#define RAJA_policy_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <CL/sycl.hpp>
+
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+using sycl_dim_t = cl::sycl::range<3>;
+
+//
+/////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+/////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies
+///
+
+namespace policy
+{
+namespace sycl
+{
+
+namespace detail
+{
+template <bool Async>
+struct get_launch {
+  static constexpr RAJA::Launch value = RAJA::Launch::async;
+};
+
+template <>
+struct get_launch<false> {
+  static constexpr RAJA::Launch value = RAJA::Launch::sync;
+};
+}  // end namespace detail
+
+template <size_t WORK_GROUP_SIZE, bool Async = false>
+struct sycl_exec : public RAJA::make_policy_pattern_launch_t<
+                        RAJA::Policy::sycl,
+                        RAJA::Pattern::forall,
+                        detail::get_launch<Async>::value> {
+};
+
+//
+// NOTE: There is no Index set segment iteration policy for SYCL
+//
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Reduction execution policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+
+struct sycl_reduce
+    : public RAJA::make_policy_pattern_launch_t<RAJA::Policy::sycl,
+                                                RAJA::Pattern::reduce,
+                                                detail::get_launch<false>::value> {
+};
+
+struct sycl_synchronize : make_policy_pattern_launch_t<Policy::sycl,
+                                                       Pattern::synchronize,
+                                                       Launch::sync> {
+};
+
+//
+// Operations in the included files are parametrized using the following
+// maximum work-group size; launch shapes clamp to the device limit at
+// submission time.
+//
+constexpr const RAJA::Index_type MAX_WORK_GROUP_SIZE = 1024;
+
+}  // end namespace sycl
+}  // end namespace policy
+
+using policy::sycl::sycl_exec;
+
+template <size_t WORK_GROUP_SIZE>
+using sycl_exec_async = policy::sycl::sycl_exec<WORK_GROUP_SIZE, true>;
+
+using policy::sycl::sycl_reduce;
+
+using policy::sycl::sycl_synchronize;
+
+
+/*!
+ * Maps segment indices to SYCL global ids in the given dimension.
+ * This is the lowest overhead mapping, but requires that the nd-range
+ * launched has enough work-items in that dimension to fit all of the
+ * direct map requests.
+ */
+template <int dim>
+struct sycl_global_012_direct {
+};
+
+using sycl_global_0_direct = sycl_global_012_direct<0>;
+using sycl_global_1_direct = sycl_global_012_direct<1>;
+using sycl_global_2_direct = sycl_global_012_direct<2>;
+
+
+/*!
+ * Maps segment indices to SYCL global ids in the given dimension.
+ * Uses a global-range-stride loop to exceed the number of physical
+ * work-items in that dimension.
+ */
+template <int dim>
+struct sycl_global_012_loop {
+};
+
+using sycl_global_0_loop = sycl_global_012_loop<0>;
+using sycl_global_1_loop = sycl_global_012_loop<1>;
+using sycl_global_2_loop = sycl_global_012_loop<2>;
+
+
+namespace internal
+{
+
+//
+// SYCL reports nd-range shapes as cl::sycl::range<3>, which indexes
+// with operator[] instead of the .x/.y/.z members the CUDA and HIP dim
+// helpers read; a plain accessor pair keeps the kernel executors
+// uniform across the three device backends.
+//
+template <int dim>
+constexpr auto get_sycl_dim(sycl_dim_t const &d) -> decltype(d[0])
+{
+  return d[dim];
+}
+
+template <int dim>
+inline void set_sycl_dim(sycl_dim_t &d, size_t value)
+{
+  d[dim] = value;
+}
+
+}  // namespace internal
+
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_SYCL
+#endif
@@ -0,0 +1,497 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for
+ *          SYCL execution.
+ *
+ *          These methods should work on any platform that supports
+ *          SYCL devices.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sycl_reduce_HPP
+#define RAJA_sycl_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <CL/sycl.hpp>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+
+namespace RAJA
+{
+
+namespace sycl
+{
+
+//
+// SYCL does not guarantee that kernel-functor destructors run on the
+// device, so the tally-on-destruction scheme the CUDA and HIP reducers
+// use is unavailable. Each reduce() call instead combines immediately
+// into one USM shared slot with a SYCL 2020 atomic_ref; sum, min, max,
+// and the bit reductions map onto hardware fetch ops, and the loc pairs
+// serialize through a one-word spinlock since a value/index pair has no
+// single atomic. Combines are therefore per-call, so hoist arithmetic
+// into a local value and reduce once per iterate where it matters.
+//
+
+template <typename T>
+using atomic_ref_t = cl::sycl::atomic_ref<T,
+                                          cl::sycl::memory_order::relaxed,
+                                          cl::sycl::memory_scope::device,
+                                          cl::sycl::access::address_space::
+                                              global_space>;
+
+struct atomic_sum {
+  template <typename T>
+  void operator()(T *target, T v) const
+  {
+    atomic_ref_t<T>(*target).fetch_add(v);
+  }
+};
+
+struct atomic_min {
+  template <typename T>
+  void operator()(T *target, T v) const
+  {
+    atomic_ref_t<T>(*target).fetch_min(v);
+  }
+};
+
+struct atomic_max {
+  template <typename T>
+  void operator()(T *target, T v) const
+  {
+    atomic_ref_t<T>(*target).fetch_max(v);
+  }
+};
+
+struct atomic_or_bit {
+  template <typename T>
+  void operator()(T *target, T v) const
+  {
+    atomic_ref_t<T>(*target).fetch_or(v);
+  }
+};
+
+struct atomic_and_bit {
+  template <typename T>
+  void operator()(T *target, T v) const
+  {
+    atomic_ref_t<T>(*target).fetch_and(v);
+  }
+};
+
+template <typename T, typename IndexType>
+struct minloc {
+  RAJA_HOST_DEVICE static constexpr T identity()
+  {
+    return T(::RAJA::operators::limits<T>::max());
+  }
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T &val,
+                                               IndexType &loc,
+                                               const T v,
+                                               const IndexType l) const
+  {
+    if (v < val) {
+      loc = l;
+      val = v;
+    }
+  }
+};
+
+template <typename T, typename IndexType>
+struct maxloc {
+  RAJA_HOST_DEVICE static constexpr T identity()
+  {
+    return T(::RAJA::operators::limits<T>::min());
+  }
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T &val,
+                                               IndexType &loc,
+                                               const T v,
+                                               const IndexType l) const
+  {
+    if (v > val) {
+      loc = l;
+      val = v;
+    }
+  }
+};
+
+}  // end namespace sycl
+
+//! SYCL reduction entity -- generalize on reduction and type
+template <typename Reducer, typename AtomicReducer, typename T>
+struct SyclReduce
+{
+  SyclReduce() = delete;
+  SyclReduce(const SyclReduce &) = default;
+
+  explicit SyclReduce(T init_val_, T identity_ = Reducer::identity())
+      : device(cl::sycl::malloc_shared<T>(1, *::RAJA::sycl::getQueue())),
+        initVal(init_val_),
+        finalVal(identity_),
+        identity(identity_),
+        isMapped(false)
+  {
+    *device = identity_;
+  }
+
+  void reset(T init_val_, T identity_ = Reducer::identity())
+  {
+    operator T();
+    device = cl::sycl::malloc_shared<T>(1, *::RAJA::sycl::getQueue());
+    *device = identity_;
+    initVal = init_val_;
+    finalVal = identity_;
+    identity = identity_;
+    isMapped = false;
+  }
+
+  //! wait out in-flight combines and return the aggregate value
+  operator T()
+  {
+    if (!isMapped) {
+      ::RAJA::sycl::getQueue()->wait_and_throw();
+      finalVal = identity;
+      Reducer{}(finalVal, initVal);
+      Reducer{}(finalVal, *device);
+      cl::sycl::free(device, *::RAJA::sycl::getQueue());
+      device = nullptr;
+      isMapped = true;
+    }
+    return finalVal;
+  }
+  //! alias for operator T()
+  T get() { return operator T(); }
+
+  //! apply reduction
+  SyclReduce &reduce(T rhsVal)
+  {
+    AtomicReducer{}(device, rhsVal);
+    return *this;
+  }
+
+  //! apply reduction (const version) -- still reduces internal values
+  const SyclReduce &reduce(T rhsVal) const
+  {
+    AtomicReducer{}(device, rhsVal);
+    return *this;
+  }
+
+private:
+  //! USM shared slot all copies combine into
+  T *device;
+  T initVal;
+  T finalVal;
+  T identity;
+  bool isMapped;
+};
+
+//! SYCL reduction location entity -- generalize on reduction and type
+template <typename Reducer, typename T, typename IndexType>
+struct SyclReduceLoc
+{
+  //! value/index pair plus the spinlock word guarding it
+  struct Data {
+    T val;
+    IndexType loc;
+    int lock;
+  };
+
+  SyclReduceLoc() = delete;
+  SyclReduceLoc(const SyclReduceLoc &) = default;
+
+  explicit SyclReduceLoc(T init_val_,
+                         IndexType init_loc_,
+                         T identity_ = Reducer::identity())
+      : device(cl::sycl::malloc_shared<Data>(1, *::RAJA::sycl::getQueue())),
+        initVal(init_val_),
+        finalVal(identity_),
+        identity(identity_),
+        initLoc(init_loc_),
+        finalLoc(IndexType(RAJA::reduce::detail::DefaultLoc<IndexType>().value())),
+        isMapped(false)
+  {
+    device->val = identity_;
+    device->loc = IndexType(RAJA::reduce::detail::DefaultLoc<IndexType>().value());
+    device->lock = 0;
+  }
+
+  void reset(T init_val_,
+             IndexType init_loc_ =
+                 IndexType(RAJA::reduce::detail::DefaultLoc<IndexType>().value()),
+             T identity_ = Reducer::identity())
+  {
+    operator T();
+    device = cl::sycl::malloc_shared<Data>(1, *::RAJA::sycl::getQueue());
+    device->val = identity_;
+    device->loc = IndexType(RAJA::reduce::detail::DefaultLoc<IndexType>().value());
+    device->lock = 0;
+    initVal = init_val_;
+    finalVal = identity_;
+    identity = identity_;
+    initLoc = init_loc_;
+    finalLoc = IndexType(RAJA::reduce::detail::DefaultLoc<IndexType>().value());
+    isMapped = false;
+  }
+
+  //! wait out in-flight combines and return the aggregate value
+  operator T()
+  {
+    if (!isMapped) {
+      ::RAJA::sycl::getQueue()->wait_and_throw();
+      finalVal = identity;
+      finalLoc = IndexType(RAJA::reduce::detail::DefaultLoc<IndexType>().value());
+      Reducer{}(finalVal, finalLoc, initVal, initLoc);
+      Reducer{}(finalVal, finalLoc, device->val, device->loc);
+      cl::sycl::free(device, *::RAJA::sycl::getQueue());
+      device = nullptr;
+      isMapped = true;
+    }
+    return finalVal;
+  }
+  //! alias for operator T()
+  T get() { return operator T(); }
+
+  //! return the aggregate location
+  IndexType getLoc()
+  {
+    if (!isMapped) get();
+    return finalLoc;
+  }
+
+  //! apply reduction, serializing value/index updates through the lock
+  const SyclReduceLoc &reduce(T rhsVal, IndexType rhsLoc) const
+  {
+    ::RAJA::sycl::atomic_ref_t<int> lock(device->lock);
+    while (lock.exchange(1, cl::sycl::memory_order::acq_rel) == 1) {
+    }
+    Reducer{}(device->val, device->loc, rhsVal, rhsLoc);
+    lock.store(0, cl::sycl::memory_order::release);
+    return *this;
+  }
+
+  //! apply reduction
+  SyclReduceLoc &reduce(T rhsVal, IndexType rhsLoc)
+  {
+    static_cast<const SyclReduceLoc &>(*this).reduce(rhsVal, rhsLoc);
+    return *this;
+  }
+
+private:
+  //! USM shared slots all copies combine into
+  Data *device;
+  T initVal;
+  T finalVal;
+  T identity;
+  IndexType initLoc;
+  IndexType finalLoc;
+  bool isMapped;
+};
+
+
+//! specialization of ReduceSum for sycl_reduce
+template <typename T>
+class ReduceSum<sycl_reduce, T>
+    : public SyclReduce<RAJA::reduce::sum<T>, sycl::atomic_sum, T>
+{
+public:
+
+  using self = ReduceSum<sycl_reduce, T>;
+  using parent = SyclReduce<RAJA::reduce::sum<T>, sycl::atomic_sum, T>;
+  using parent::parent;
+
+  //! enable operator+= for ReduceSum -- alias for reduce()
+  self &operator+=(T rhsVal)
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+
+  //! enable operator+= for ReduceSum -- alias for reduce()
+  const self &operator+=(T rhsVal) const
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+};
+
+//! specialization of ReduceBitOr for sycl_reduce
+template <typename T>
+class ReduceBitOr<sycl_reduce, T>
+    : public SyclReduce<RAJA::reduce::or_bit<T>, sycl::atomic_or_bit, T>
+{
+public:
+
+  using self = ReduceBitOr<sycl_reduce, T>;
+  using parent = SyclReduce<RAJA::reduce::or_bit<T>, sycl::atomic_or_bit, T>;
+  using parent::parent;
+
+  //! enable operator|= for ReduceBitOr -- alias for reduce()
+  self &operator|=(T rhsVal)
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+
+  //! enable operator|= for ReduceBitOr -- alias for reduce()
+  const self &operator|=(T rhsVal) const
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+};
+
+//! specialization of ReduceBitAnd for sycl_reduce
+template <typename T>
+class ReduceBitAnd<sycl_reduce, T>
+    : public SyclReduce<RAJA::reduce::and_bit<T>, sycl::atomic_and_bit, T>
+{
+public:
+
+  using self = ReduceBitAnd<sycl_reduce, T>;
+  using parent = SyclReduce<RAJA::reduce::and_bit<T>, sycl::atomic_and_bit, T>;
+  using parent::parent;
+
+  //! enable operator&= for ReduceBitAnd -- alias for reduce()
+  self &operator&=(T rhsVal)
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+
+  //! enable operator&= for ReduceBitAnd -- alias for reduce()
+  const self &operator&=(T rhsVal) const
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+};
+
+//! specialization of ReduceMin for sycl_reduce
+template <typename T>
+class ReduceMin<sycl_reduce, T>
+    : public SyclReduce<RAJA::reduce::min<T>, sycl::atomic_min, T>
+{
+public:
+
+  using self = ReduceMin<sycl_reduce, T>;
+  using parent = SyclReduce<RAJA::reduce::min<T>, sycl::atomic_min, T>;
+  using parent::parent;
+
+  //! enable min() for ReduceMin -- alias for reduce()
+  self &min(T rhsVal)
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+
+  //! enable min() for ReduceMin -- alias for reduce()
+  const self &min(T rhsVal) const
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+};
+
+//! specialization of ReduceMax for sycl_reduce
+template <typename T>
+class ReduceMax<sycl_reduce, T>
+    : public SyclReduce<RAJA::reduce::max<T>, sycl::atomic_max, T>
+{
+public:
+
+  using self = ReduceMax<sycl_reduce, T>;
+  using parent = SyclReduce<RAJA::reduce::max<T>, sycl::atomic_max, T>;
+  using parent::parent;
+
+  //! enable max() for ReduceMax -- alias for reduce()
+  self &max(T rhsVal)
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+
+  //! enable max() for ReduceMax -- alias for reduce()
+  const self &max(T rhsVal) const
+  {
+    parent::reduce(rhsVal);
+    return *this;
+  }
+};
+
+//! specialization of ReduceMinLoc for sycl_reduce
+template <typename T, typename IndexType>
+class ReduceMinLoc<sycl_reduce, T, IndexType>
+    : public SyclReduceLoc<sycl::minloc<T, IndexType>, T, IndexType>
+{
+public:
+
+  using self = ReduceMinLoc<sycl_reduce, T, IndexType>;
+  using parent = SyclReduceLoc<sycl::minloc<T, IndexType>, T, IndexType>;
+  using parent::parent;
+
+  //! enable minloc() for ReduceMinLoc -- alias for reduce()
+  self &minloc(T rhsVal, IndexType rhsLoc)
+  {
+    parent::reduce(rhsVal, rhsLoc);
+    return *this;
+  }
+
+  //! enable minloc() for ReduceMinLoc -- alias for reduce()
+  const self &minloc(T rhsVal, IndexType rhsLoc) const
+  {
+    parent::reduce(rhsVal, rhsLoc);
+    return *this;
+  }
+};
+
+//! specialization of ReduceMaxLoc for sycl_reduce
+template <typename T, typename IndexType>
+class ReduceMaxLoc<sycl_reduce, T, IndexType>
+    : public SyclReduceLoc<sycl::maxloc<T, IndexType>, T, IndexType>
+{
+public:
+
+  using self = ReduceMaxLoc<sycl_reduce, T, IndexType>;
+  using parent = SyclReduceLoc<sycl::maxloc<T, IndexType>, T, IndexType>;
+  using parent::parent;
+
+  //! enable maxloc() for ReduceMaxLoc -- alias for reduce()
+  self &maxloc(T rhsVal, IndexType rhsLoc)
+  {
+    parent::reduce(rhsVal, rhsLoc);
+    return *this;
+  }
+
+  //! enable maxloc() for ReduceMaxLoc -- alias for reduce()
+  const self &maxloc(T rhsVal, IndexType rhsLoc) const
+  {
+    parent::reduce(rhsVal, rhsLoc);
+    return *this;
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,139 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA scan declarations for SYCL
+ *          execution, lowered onto the oneDPL device algorithms.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_sycl_HPP
+#define RAJA_scan_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/numeric>
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+//
+// The oneDPL device algorithms block until the result is visible, so
+// Async scans complete before returning just like synchronous ones;
+// the policy parameter is still honored for API symmetry.
+//
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <size_t WORK_GROUP_SIZE,
+          bool Async,
+          typename InputIter,
+          typename Function>
+void inclusive_inplace(resources::Host&,
+                       const ::RAJA::sycl_exec<WORK_GROUP_SIZE, Async>&,
+                       InputIter begin,
+                       InputIter end,
+                       Function binary_op)
+{
+  auto dpl_policy =
+      oneapi::dpl::execution::make_device_policy(*::RAJA::sycl::getQueue());
+
+  oneapi::dpl::inclusive_scan(dpl_policy, begin, end, begin, binary_op);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <size_t WORK_GROUP_SIZE,
+          bool Async,
+          typename InputIter,
+          typename Function,
+          typename T>
+void exclusive_inplace(resources::Host&,
+                       const ::RAJA::sycl_exec<WORK_GROUP_SIZE, Async>&,
+                       InputIter begin,
+                       InputIter end,
+                       Function binary_op,
+                       T init)
+{
+  auto dpl_policy =
+      oneapi::dpl::execution::make_device_policy(*::RAJA::sycl::getQueue());
+
+  oneapi::dpl::exclusive_scan(dpl_policy, begin, end, begin, init, binary_op);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <size_t WORK_GROUP_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+void inclusive(resources::Host&,
+               const ::RAJA::sycl_exec<WORK_GROUP_SIZE, Async>&,
+               InputIter begin,
+               InputIter end,
+               OutputIter out,
+               Function binary_op)
+{
+  auto dpl_policy =
+      oneapi::dpl::execution::make_device_policy(*::RAJA::sycl::getQueue());
+
+  oneapi::dpl::inclusive_scan(dpl_policy, begin, end, out, binary_op);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <size_t WORK_GROUP_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function,
+          typename T>
+void exclusive(resources::Host&,
+               const ::RAJA::sycl_exec<WORK_GROUP_SIZE, Async>&,
+               InputIter begin,
+               InputIter end,
+               OutputIter out,
+               Function binary_op,
+               T init)
+{
+  auto dpl_policy =
+      oneapi::dpl::execution::make_device_policy(*::RAJA::sycl::getQueue());
+
+  oneapi::dpl::exclusive_scan(dpl_policy, begin, end, out, init, binary_op);
+}
+
+}  // namespace scan
+}  // namespace impl
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,140 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA sort declarations for SYCL
+ *          execution, lowered onto the oneDPL device algorithms.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_sycl_HPP
+#define RAJA_sort_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <utility>
+
+#include <oneapi/dpl/algorithm>
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/iterator>
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+//
+// oneDPL takes arbitrary comparators, so unlike the CUDA and HIP sorts
+// there is no arithmetic-type/radix restriction here; the pairs sorts
+// run over a zip iterator with the comparator applied to the key
+// element. All four entry points block until the result is visible.
+//
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <size_t WORK_GROUP_SIZE, bool Async, typename Iter, typename Compare>
+void unstable(resources::Host&,
+              const ::RAJA::sycl_exec<WORK_GROUP_SIZE, Async>&,
+              Iter begin,
+              Iter end,
+              Compare comp)
+{
+  auto dpl_policy =
+      oneapi::dpl::execution::make_device_policy(*::RAJA::sycl::getQueue());
+
+  oneapi::dpl::sort(dpl_policy, begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <size_t WORK_GROUP_SIZE, bool Async, typename Iter, typename Compare>
+void stable(resources::Host&,
+            const ::RAJA::sycl_exec<WORK_GROUP_SIZE, Async>&,
+            Iter begin,
+            Iter end,
+            Compare comp)
+{
+  auto dpl_policy =
+      oneapi::dpl::execution::make_device_policy(*::RAJA::sycl::getQueue());
+
+  oneapi::dpl::stable_sort(dpl_policy, begin, end, comp);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <size_t WORK_GROUP_SIZE,
+          bool Async,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+void unstable_pairs(resources::Host&,
+                    const ::RAJA::sycl_exec<WORK_GROUP_SIZE, Async>&,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  auto dpl_policy =
+      oneapi::dpl::execution::make_device_policy(*::RAJA::sycl::getQueue());
+
+  auto begin = oneapi::dpl::make_zip_iterator(keys_begin, vals_begin);
+  auto end = begin + (keys_end - keys_begin);
+  oneapi::dpl::sort(dpl_policy, begin, end,
+                    [comp](const auto& lhs, const auto& rhs) {
+                      return comp(std::get<0>(lhs), std::get<0>(rhs));
+                    });
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+   keys
+*/
+template <size_t WORK_GROUP_SIZE,
+          bool Async,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+void stable_pairs(resources::Host&,
+                  const ::RAJA::sycl_exec<WORK_GROUP_SIZE, Async>&,
+                  KeyIter keys_begin,
+                  KeyIter keys_end,
+                  ValIter vals_begin,
+                  Compare comp)
+{
+  auto dpl_policy =
+      oneapi::dpl::execution::make_device_policy(*::RAJA::sycl::getQueue());
+
+  auto begin = oneapi::dpl::make_zip_iterator(keys_begin, vals_begin);
+  auto end = begin + (keys_end - keys_begin);
+  oneapi::dpl::stable_sort(dpl_policy, begin, end,
+                           [comp](const auto& lhs, const auto& rhs) {
+                             return comp(std::get<0>(lhs), std::get<0>(rhs));
+                           });
+}
+
+}  // namespace sort
+}  // namespace impl
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,52 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Header file for SYCL synchronize method.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_synchronize_sycl_HPP
+#define RAJA_synchronize_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+
+namespace RAJA
+{
+
+namespace policy
+{
+
+namespace sycl
+{
+
+/*!
+ * \brief Synchronize the RAJA SYCL queue.
+ */
+RAJA_INLINE
+void synchronize_impl(const sycl_synchronize&)
+{
+  ::RAJA::sycl::synchronize();
+}
+
+
+}  // end of namespace sycl
+}  // namespace policy
+}  // end of namespace RAJA
+
+#endif  // defined(RAJA_ENABLE_SYCL)
+
+#endif  // RAJA_synchronize_sycl_HPP
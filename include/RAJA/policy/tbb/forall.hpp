@@ -137,6 +137,55 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host &
   return resources::EventProxy<resources::Host>(&host_res);
 }
 
+/**
+ * @brief TBB affinity-partitioned for implementation
+ *
+ * @param tbb_for_affinity tbb tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall implements a TBB parallel_for loop over the specified iterable
+ * using an affinity_partitioner that persists across invocations.  Each call
+ * site instantiates this template with a unique loop-body type, so the
+ * function-local partitioner below is effectively keyed per call site: the
+ * first invocation trains the chunk-to-worker mapping and later invocations
+ * replay it, keeping data resident in per-core caches across repeated sweeps.
+ * NOTE: a given call site must not be invoked concurrently from multiple
+ * host threads, since they would share (and race on) one partitioner.
+ */
+
+template <typename Iterable, typename Func, size_t GrainSize>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host &host_res,
+                                                               const tbb_for_affinity<GrainSize>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+
+  // one partitioner per instantiation, i.e. per call site
+  static ::tbb::affinity_partitioner partitioner;
+
+  ::tbb::parallel_for(
+      brange(0, dist, GrainSize),
+      [=](const brange& r) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto body = privatizer.get_priv();
+        for (auto i = r.begin(); i != r.end(); ++i)
+          body(b[i]);
+      },
+      partitioner);
+
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
 }  // namespace tbb
 }  // namespace policy
 
@@ -60,11 +60,35 @@ struct tbb_for_static : make_policy_pattern_launch_platform_t<Policy::tbb,
 
 using tbb_for_exec = tbb_for_static<>;
 
+///
+/// TBB affinity-partitioned loop policy. The partitioner records which
+/// worker ran each chunk and replays that mapping on later invocations of
+/// the same loop, so iterative solvers that sweep the same ranges keep
+/// tiles on the cores whose caches already hold them. The partitioner
+/// state is keyed per call site (one per loop-body type), so each loop in
+/// the program trains its own mapping; a given call site must not be
+/// invoked concurrently from multiple host threads.
+///
+template <std::size_t GrainSize = 1>
+struct tbb_for_affinity
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 ///
 /// Index set segment iteration policies
 ///
 using tbb_segit = tbb_for_exec;
 
+///
+/// Affinity-partitioned segment iteration; with
+/// ExecPolicy<tbb_segit_affinity, ...> repeated sweeps over an index set
+/// keep each segment on the worker that last executed it.
+///
+using tbb_segit_affinity = tbb_for_affinity<>;
+
 ///
 /// WorkGroup execution policies
 ///
@@ -91,11 +115,13 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
 }  // namespace tbb
 }  // namespace policy
 
+using policy::tbb::tbb_for_affinity;
 using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
 using policy::tbb::tbb_reduce;
 using policy::tbb::tbb_segit;
+using policy::tbb::tbb_segit_affinity;
 using policy::tbb::tbb_work;
 
 }  // namespace RAJA
@@ -0,0 +1,225 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the persistent worker pool backing the
+ *          std::thread policy family.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_ThreadPool_HPP
+#define RAJA_threads_ThreadPool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace threads
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Singleton pool of persistent worker threads for the
+ *         std::thread backend.
+ *
+ * Workers are spawned once, on first use, and park on a condition
+ * variable between loops, so each forall pays a wakeup rather than a
+ * thread spawn. The launching thread participates in every loop as
+ * worker zero; the pool holds hardware_concurrency() - 1 workers unless
+ * the RAJA_NUM_THREADS environment variable overrides the total.
+ *
+ * run() executes one work function on every participant and blocks
+ * until all have finished. Calls are serialized, and a call made from
+ * inside a parallel loop (nested parallelism) degrades to serial
+ * execution on the calling thread.
+ *
+ ******************************************************************************
+ */
+class ThreadPool
+{
+public:
+  static ThreadPool& getInstance()
+  {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  //! number of threads participating in each run, pool plus launcher
+  size_t num_participants() const { return m_workers.size() + 1; }
+
+  //! participant index of the calling thread: 0 for the launching
+  //  thread, 1..num_participants()-1 for pool workers
+  static int this_participant_id() { return participant_id(); }
+
+  /*!
+   * \brief Run work(participant_id, num_participants) on every
+   *        participant, returning when all have completed.
+   */
+  void run(std::function<void(size_t, size_t)> const& work)
+  {
+    if (in_parallel()) {
+      // nested use from inside a parallel loop runs serially on the
+      // calling thread
+      work(0, 1);
+      return;
+    }
+
+    std::lock_guard<std::mutex> serialize(m_run_mutex);
+
+    size_t num_workers = m_workers.size();
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_work = &work;
+      m_remaining = num_workers;
+      ++m_generation;
+    }
+    m_wake.notify_all();
+
+    in_parallel() = true;
+    work(0, num_workers + 1);
+    in_parallel() = false;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [&] { return m_remaining == 0; });
+    m_work = nullptr;
+  }
+
+  ThreadPool(ThreadPool const&) = delete;
+  ThreadPool& operator=(ThreadPool const&) = delete;
+
+private:
+  ThreadPool() : m_work(nullptr), m_generation(0), m_remaining(0), m_exit(false)
+  {
+    size_t total = std::thread::hardware_concurrency();
+    if (const char* env = std::getenv("RAJA_NUM_THREADS")) {
+      long requested = std::strtol(env, nullptr, 10);
+      if (requested > 0) {
+        total = static_cast<size_t>(requested);
+      }
+    }
+    if (total < 1) {
+      total = 1;
+    }
+
+    m_workers.reserve(total - 1);
+    for (size_t i = 0; i < total - 1; ++i) {
+      m_workers.emplace_back([this, i] { worker_loop(i + 1); });
+    }
+  }
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_exit = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  //! calling thread's participant slot; function-local so the header
+  //  needs no out-of-line thread_local definition
+  static int& participant_id()
+  {
+    static thread_local int id = 0;
+    return id;
+  }
+
+  //! whether the calling thread is already executing inside run()
+  static bool& in_parallel()
+  {
+    static thread_local bool flag = false;
+    return flag;
+  }
+
+  void worker_loop(size_t id)
+  {
+    participant_id() = static_cast<int>(id);
+
+    unsigned long long seen = 0;
+    for (;;) {
+      std::function<void(size_t, size_t)> const* work;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wake.wait(lock, [&] { return m_exit || m_generation != seen; });
+        if (m_exit) {
+          return;
+        }
+        seen = m_generation;
+        work = m_work;
+      }
+
+      in_parallel() = true;
+      (*work)(id, m_workers.size() + 1);
+      in_parallel() = false;
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_remaining;
+      }
+      m_done.notify_one();
+    }
+  }
+
+  std::vector<std::thread> m_workers;
+  std::mutex m_run_mutex;
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_done;
+  std::function<void(size_t, size_t)> const* m_work;
+  unsigned long long m_generation;
+  size_t m_remaining;
+  bool m_exit;
+};
+
+/*!
+ * \brief Contiguous static partition of n iterates: participant tid of
+ *        num gets [begin, end). Deterministic, so separate passes over
+ *        the same range see identical blocks.
+ */
+RAJA_INLINE void static_block(size_t tid,
+                              size_t num,
+                              Index_type n,
+                              Index_type& begin,
+                              Index_type& end)
+{
+  Index_type len =
+      (n + static_cast<Index_type>(num) - 1) / static_cast<Index_type>(num);
+  begin = static_cast<Index_type>(tid) * len;
+  end = begin + len < n ? begin + len : n;
+  if (begin > n) {
+    begin = n;
+  }
+}
+
+}  // namespace threads
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,99 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA segment iteration template
+ *          methods for the std::thread pool backend.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_threads_HPP
+#define RAJA_forall_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/fault_tolerance.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+/**
+ * @brief std::thread pool static for implementation
+ *
+ * Runs the loop across the persistent worker pool with static
+ * scheduling: one contiguous block per participant when ChunkSize is
+ * zero, round-robin blocks of ChunkSize iterates otherwise. The loop
+ * body is privatized per participant, matching the other host backends.
+ */
+template <typename Iterable, typename Func, size_t ChunkSize>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    resources::Host& host_res,
+    const threads_for_static<ChunkSize>&,
+    Iterable&& iter,
+    Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  using diff_t = decltype(distance_it);
+
+  ::RAJA::threads::ThreadPool::getInstance().run([&](size_t tid, size_t num) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto body = privatizer.get_priv();
+
+    if (ChunkSize == 0) {
+      Index_type block_begin, block_end;
+      ::RAJA::threads::static_block(tid, num,
+                                    static_cast<Index_type>(distance_it),
+                                    block_begin, block_end);
+      for (Index_type i = block_begin; i < block_end; ++i) {
+        body(*(begin_it + i));
+      }
+    } else {
+      diff_t chunk = static_cast<diff_t>(ChunkSize ? ChunkSize : 1);
+      for (diff_t chunk_begin = static_cast<diff_t>(tid) * chunk;
+           chunk_begin < distance_it;
+           chunk_begin += static_cast<diff_t>(num) * chunk) {
+        diff_t chunk_end = chunk_begin + chunk < distance_it
+                               ? chunk_begin + chunk
+                               : distance_it;
+        for (diff_t i = chunk_begin; i < chunk_end; ++i) {
+          body(*(begin_it + i));
+        }
+      }
+    }
+  });
+
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+}  // namespace threads
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
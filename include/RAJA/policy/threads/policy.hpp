@@ -0,0 +1,90 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA std::thread pool policy
+ *          definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_threads_HPP
+#define policy_threads_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include <cstddef>
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies
+///
+
+///
+/// Statically scheduled loop over the persistent std::thread pool. A
+/// ChunkSize of zero gives each participant one contiguous block;
+/// a nonzero ChunkSize deals blocks of that many iterates round-robin,
+/// which evens out imbalanced bodies at the cost of locality.
+///
+template <std::size_t ChunkSize = 0>
+struct threads_for_static
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+using threads_exec = threads_for_static<>;
+
+///
+/// Index set segment iteration policies
+///
+using threads_segit = threads_exec;
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Reduction execution policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+struct threads_reduce
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+}  // namespace threads
+}  // namespace policy
+
+using policy::threads::threads_exec;
+using policy::threads::threads_for_static;
+using policy::threads::threads_reduce;
+using policy::threads::threads_segit;
+
+}  // namespace RAJA
+
+#endif
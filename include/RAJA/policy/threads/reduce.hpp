@@ -0,0 +1,111 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for the
+ *          std::thread pool backend.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_reduce_HPP
+#define RAJA_threads_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <memory>
+#include <vector>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Per-participant reduction storage for the std::thread pool backend.
+ * Each pool participant combines into its own cache-line-sized slot,
+ * indexed by the pool's participant id, so no synchronization happens
+ * inside the loop; get() folds the slots.
+ */
+template <typename T, typename Reduce>
+class ReduceThreads
+{
+  struct alignas(RAJA::DATA_ALIGN) Slot {
+    T value;
+  };
+
+  //! shared by all copies of the reducer, like the other host backends
+  std::shared_ptr<std::vector<Slot>> data;
+
+public:
+  //! default constructor calls the reset method
+  ReduceThreads() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceThreads(T init_val, T initializer)
+  {
+    reset(init_val, initializer);
+  }
+
+  void reset(T init_val, T initializer)
+  {
+    size_t num_slots =
+        ::RAJA::threads::ThreadPool::getInstance().num_participants();
+    data = std::make_shared<std::vector<Slot>>(num_slots, Slot{initializer});
+    this->local() = init_val;
+  }
+
+  /*!
+   *  \return the calculated reduced value
+   */
+  T get() const
+  {
+    T res = (*data)[0].value;
+    for (size_t i = 1; i < data->size(); ++i) {
+      Reduce{}(res, (*data)[i].value);
+    }
+    return res;
+  }
+
+  /*!
+   *  \return update the local value
+   */
+  void combine(const T& other) { Reduce{}(this->local(), other); }
+
+  /*!
+   *  \return reference to the local value
+   */
+  T& local()
+  {
+    return (*data)[::RAJA::threads::ThreadPool::this_participant_id()].value;
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(threads_reduce, detail::ReduceThreads)
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,178 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations for the
+*          std::thread pool backend.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_threads_HPP
+#define RAJA_scan_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <iterator>
+#include <vector>
+
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+namespace detail
+{
+
+/*!
+ * Two-pass parallel scan over the std::thread pool: each participant
+ * first reduces its static block, a serial pass turns the block sums
+ * into block carries, and a second parallel pass scans each block
+ * seeded with its carry. Both passes use the same deterministic block
+ * partition.
+ */
+template <typename Iter, typename OutIter, typename BinFn, typename ValueT>
+void threads_scan(Iter begin,
+                  OutIter out,
+                  Index_type n,
+                  BinFn f,
+                  ValueT init,
+                  bool exclusive)
+{
+  auto& pool = ::RAJA::threads::ThreadPool::getInstance();
+
+  std::vector<ValueT> carries(pool.num_participants(), BinFn::identity());
+
+  pool.run([&](size_t tid, size_t num) {
+    Index_type block_begin, block_end;
+    ::RAJA::threads::static_block(tid, num, n, block_begin, block_end);
+
+    ValueT agg = BinFn::identity();
+    for (Index_type i = block_begin; i < block_end; ++i) {
+      agg = f(agg, begin[i]);
+    }
+    carries[tid] = agg;
+  });
+
+  ValueT carry = init;
+  for (size_t t = 0; t < carries.size(); ++t) {
+    ValueT block_sum = carries[t];
+    carries[t] = carry;
+    carry = f(carry, block_sum);
+  }
+
+  pool.run([&](size_t tid, size_t num) {
+    Index_type block_begin, block_end;
+    ::RAJA::threads::static_block(tid, num, n, block_begin, block_end);
+
+    ValueT agg = carries[tid];
+    for (Index_type i = block_begin; i < block_end; ++i) {
+      ValueT t = begin[i];
+      if (exclusive) {
+        out[i] = agg;
+        agg = f(agg, t);
+      } else {
+        agg = f(agg, t);
+        out[i] = agg;
+      }
+    }
+  });
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename ExecPolicy, typename Iter, typename BinFn>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>>
+inclusive_inplace(const ExecPolicy&, Iter begin, Iter end, BinFn f)
+{
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  detail::threads_scan<Iter, Iter, BinFn, ValueT>(
+      begin, begin, static_cast<Index_type>(std::distance(begin, end)), f,
+      BinFn::identity(), false);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename ExecPolicy, typename Iter, typename BinFn, typename T>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>>
+exclusive_inplace(const ExecPolicy&, Iter begin, Iter end, BinFn f, T v)
+{
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  detail::threads_scan<Iter, Iter, BinFn, ValueT>(
+      begin, begin, static_cast<Index_type>(std::distance(begin, end)), f,
+      static_cast<ValueT>(v), true);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> inclusive(
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  detail::threads_scan<Iter, OutIter, BinFn, ValueT>(
+      begin, out, static_cast<Index_type>(std::distance(begin, end)), f,
+      BinFn::identity(), false);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> exclusive(
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  detail::threads_scan<Iter, OutIter, BinFn, ValueT>(
+      begin, out, static_cast<Index_type>(std::distance(begin, end)), f,
+      static_cast<ValueT>(v), true);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
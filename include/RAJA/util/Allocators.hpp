@@ -0,0 +1,142 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for global allocator registration.
+ *
+ *          User-provided allocation callbacks registered here are used
+ *          by all RAJA-internal allocation paths: the basic_mempool
+ *          backing allocators, the CUDA device/pinned/zeroed pools,
+ *          ListSegment index buffers, and RAJAVec growth. This lets an
+ *          application route RAJA allocations through a vendor pool
+ *          (e.g. Umpire) and pre-register pinned slabs for reducer
+ *          tallies instead of hitting malloc/cudaMalloc mid-run.
+ *
+ *          Callbacks must be registered before RAJA performs any
+ *          allocation in the corresponding space and must not be
+ *          changed or reset while allocations from that space are
+ *          outstanding, since memory is returned to whichever
+ *          deallocator is registered at free time.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_Allocators_HPP
+#define RAJA_util_Allocators_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <new>
+
+namespace RAJA
+{
+
+namespace util
+{
+
+//! Allocation spaces whose internal allocators can be overridden
+enum struct AllocatorSpace : int {
+  host = 0,
+  device,
+  pinned,
+  managed,
+  device_zeroed,
+  num_spaces
+};
+
+/*!
+ * User callbacks for one allocation space.
+ *
+ * allocate receives the requested size in bytes and user_data and
+ * returns a valid pointer in the space; deallocate receives a pointer
+ * previously returned by allocate and user_data. For device_zeroed,
+ * RAJA zeroes the returned memory itself, so the callback does not
+ * need to.
+ */
+struct AllocatorCallbacks {
+  void* (*allocate)(std::size_t nbytes, void* user_data);
+  void (*deallocate)(void* ptr, void* user_data);
+  void* user_data;
+};
+
+//! register allocation callbacks for a space
+void set_allocator(AllocatorSpace space, AllocatorCallbacks callbacks);
+
+//! restore the built-in allocator for a space
+void reset_allocator(AllocatorSpace space);
+
+//! whether callbacks are registered for a space
+bool has_allocator(AllocatorSpace space);
+
+//! allocate through the registered callbacks; has_allocator(space)
+//  must be true
+void* callback_allocate(AllocatorSpace space, std::size_t nbytes);
+
+//! deallocate through the registered callbacks; has_allocator(space)
+//  must be true
+void callback_deallocate(AllocatorSpace space, void* ptr);
+
+
+/*!
+ * std-style host allocator that routes through the registered host
+ * callbacks, falling back to operator new. Used as the default
+ * allocator for RAJAVec so container growth honors the registry.
+ */
+template <typename T>
+struct hooked_allocator {
+  using value_type = T;
+
+  hooked_allocator() = default;
+
+  template <typename U>
+  constexpr hooked_allocator(hooked_allocator<U> const&) noexcept
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    if (has_allocator(AllocatorSpace::host)) {
+      return static_cast<T*>(
+          callback_allocate(AllocatorSpace::host, n * sizeof(T)));
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t)
+  {
+    if (has_allocator(AllocatorSpace::host)) {
+      callback_deallocate(AllocatorSpace::host, ptr);
+    } else {
+      ::operator delete(ptr);
+    }
+  }
+};
+
+template <typename T, typename U>
+constexpr bool operator==(hooked_allocator<T> const&,
+                          hooked_allocator<U> const&) noexcept
+{
+  return true;
+}
+
+template <typename T, typename U>
+constexpr bool operator!=(hooked_allocator<T> const&,
+                          hooked_allocator<U> const&) noexcept
+{
+  return false;
+}
+
+}  // end namespace util
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
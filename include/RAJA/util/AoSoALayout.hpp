@@ -0,0 +1,154 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining AoSoALayout, a 2-dimensional index
+ *          calculator with tiled (Array-of-Struct-of-Array) striding
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AOSOALAYOUT_HPP
+#define RAJA_AOSOALAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief A 2-dimensional mapping of (element, component) index pairs to a
+ *        linear index space with Array-of-Struct-of-Array (AoSoA) tiling.
+ *
+ * Elements are grouped into tiles of TileSize; within a tile, each
+ * component is stored contiguously for all TileSize elements. For a view
+ * with accesses view(i, comp), consecutive values of i within a tile are
+ * unit stride, so inner loops over elements vectorize as they would for
+ * SoA storage, while all components of a tile stay within one cache
+ * footprint as they would for AoS storage.
+ *
+ * For example:
+ *
+ *     // Particle data: num_particles elements with 3 components each,
+ *     // tiled in blocks of 8 elements
+ *     AoSoALayout<8> layout(num_particles, 3);
+ *     RAJA::View<double, AoSoALayout<8>> view(data, layout);
+ *
+ *     // Accessed exactly like a 2-d (element, component) view
+ *     double x = view(i, 0);
+ *
+ * The linear index of (i, comp) is
+ *
+ *     (i / TileSize) * num_components * TileSize + comp * TileSize
+ *                                                + (i % TileSize)
+ *
+ * TileSize must be a power of two so the division and modulo compile to
+ * shifts and masks. The backing array must be sized to whole tiles:
+ * size() reports the number of elements rounded up to a tile multiple
+ * times the number of components.
+ */
+template <size_t TileSize, typename IdxLin = Index_type>
+struct AoSoALayout {
+
+  static_assert(TileSize > 0 && (TileSize & (TileSize - 1)) == 0,
+                "AoSoALayout tile size must be a power of two");
+
+  using IndexLinear = IdxLin;
+
+  static constexpr size_t n_dims = 2;
+  static constexpr ptrdiff_t stride1_dim = 0;
+  static constexpr IdxLin tile_size = static_cast<IdxLin>(TileSize);
+
+  IdxLin num_elements;
+  IdxLin num_components;
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr AoSoALayout()
+      : num_elements(0), num_components(0)
+  {
+  }
+
+  /*!
+   * Construct a layout given the number of elements and components.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr AoSoALayout(IdxLin n_elements,
+                                                     IdxLin n_components)
+      : num_elements(n_elements), num_components(n_components)
+  {
+  }
+
+  /*!
+   * Computes a linear space index from an (element, component) index pair.
+   *
+   * @param i     Element index
+   * @param comp  Component index
+   * @return Linear space index.
+   */
+  template <typename Idx0, typename Idx1>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin operator()(Idx0 i,
+                                                           Idx1 comp) const
+  {
+    // i / TileSize * TileSize == i with the lane bits masked off, so the
+    // tile base address needs no division or multiply by TileSize
+    return (static_cast<IdxLin>(stripIndexType(i)) & ~(tile_size - 1)) *
+               num_components +
+           static_cast<IdxLin>(stripIndexType(comp)) * tile_size +
+           (static_cast<IdxLin>(stripIndexType(i)) & (tile_size - 1));
+  }
+
+  /*!
+   * Given a linear-space index, compute the (element, component) indices
+   * defined by this layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param i     Element index to be assigned
+   * @param comp  Component index to be assigned
+   */
+  template <typename Idx0, typename Idx1>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Idx0 &i,
+                                              Idx1 &comp) const
+  {
+    IdxLin tile_extent = num_components * tile_size;
+    IdxLin lane = linear_index % tile_size;
+    i = static_cast<Idx0>((linear_index / tile_extent) * tile_size + lane);
+    comp = static_cast<Idx1>((linear_index % tile_extent) / tile_size);
+  }
+
+  /*!
+   * Computes a total size of the layout's space, i.e., the required size
+   * of a backing array: the number of elements rounded up to a whole
+   * number of tiles times the number of components.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return ((num_elements + tile_size - 1) & ~(tile_size - 1)) *
+           num_components;
+  }
+};
+
+template <size_t TileSize, typename IdxLin>
+constexpr size_t AoSoALayout<TileSize, IdxLin>::n_dims;
+template <size_t TileSize, typename IdxLin>
+constexpr IdxLin AoSoALayout<TileSize, IdxLin>::tile_size;
+
+}  // namespace RAJA
+
+#endif
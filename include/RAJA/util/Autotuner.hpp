@@ -0,0 +1,288 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for the self-tuning kernel variant harness.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Autotuner_HPP
+#define RAJA_Autotuner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/util/Permutations.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * Persistent cache of autotuning winners, keyed by kernel name.
+ *
+ * Entries live in a plain-text host-config cache file with one line per
+ * tuned kernel: name, candidate count, winner index, winner time. The
+ * file location comes from the RAJA_TUNING_CACHE environment variable,
+ * or raja_tuning.cache in the working directory. The file is read once,
+ * lazily, and rewritten by record(), so a tuning run leaves a complete
+ * cache behind for subsequent runs on the same host configuration.
+ *
+ * An entry whose candidate count does not match the current variant
+ * list is ignored, so growing or shrinking a candidate set triggers a
+ * retune instead of indexing a stale winner. Kernel names must not
+ * contain whitespace.
+ */
+class TuningCache
+{
+public:
+  static TuningCache& getInstance();
+
+  //! winner index for the named kernel, or -1 when not cached or the
+  //  cached candidate count does not match num_variants
+  int lookup(const std::string& name, size_t num_variants);
+
+  //! record the winner for the named kernel and rewrite the cache file
+  void record(const std::string& name,
+              size_t num_variants,
+              size_t winner,
+              double time);
+
+  //! path of the host-config cache file
+  static std::string filePath();
+
+private:
+  TuningCache() = default;
+
+  struct Entry {
+    std::string name;
+    size_t num_variants;
+    size_t winner;
+    double time;
+  };
+
+  void load();
+
+  std::mutex m_mutex;
+  bool m_loaded = false;
+  std::vector<Entry> m_entries;
+};
+
+/*!
+ * Plugin supplying the timing hooks for the autotune() harness.
+ *
+ * While a measurement window is open on a thread, the pre/postLaunch
+ * hooks time every RAJA launch. On device platforms the device is
+ * synchronized before the timer stops, as in the profiling plugin, so
+ * the measurement covers kernel execution rather than the asynchronous
+ * launch. Outside a window the hooks return after one thread-local
+ * check, so ordinary launches are unaffected.
+ */
+class AutotunerPlugin : public PluginStrategy
+{
+public:
+  void preLaunch(const PluginContext& p) override;
+
+  void postLaunch(const PluginContext& p) override;
+
+  //! open a measurement window on the calling thread
+  static void beginWindow();
+
+  //! close the window, returning the accumulated launch seconds; when
+  //  num_launches is non-null it receives the number of launches seen
+  static double endWindow(unsigned long* num_launches = nullptr);
+};
+
+namespace detail
+{
+
+/*!
+ * Flat invocation table over a candidate variant list; maps a runtime
+ * winner index onto the matching template instantiation with one
+ * indexed indirect call, as the MultiPolicy dispatcher does.
+ */
+template <typename Body, typename... Variants>
+struct variant_invoker {
+  using invoke_fn = void (*)(Body&);
+
+  template <typename Variant>
+  static void run_variant(Body& body)
+  {
+    body(Variant{});
+  }
+
+  static void invoke(size_t index, Body& body)
+  {
+    static const invoke_fn table[sizeof...(Variants)] = {
+        &run_variant<Variants>...};
+    table[index](body);
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * Run the named kernel through its tuned variant, benchmarking the
+ * candidates first if this host configuration has no cached winner.
+ *
+ * Variants are default-constructible tag types (tile-size tags, policy
+ * types, camp::num<..>, ...) and body is a functor whose call operator
+ * takes the tag by value, typically a generic lambda that builds its
+ * kernel policy from the tag:
+ *
+ *   RAJA::util::autotune("heat_tile",
+ *       camp::list<RAJA::tile_fixed<8>, RAJA::tile_fixed<16>>{},
+ *       [=](auto tile) {
+ *         using Pol = RAJA::KernelPolicy<RAJA::statement::Tile<
+ *             0, decltype(tile), RAJA::loop_exec,
+ *             RAJA::statement::For<0, RAJA::loop_exec,
+ *                                  RAJA::statement::Lambda<0>>>>;
+ *         RAJA::kernel<Pol>(segs, lam);
+ *       });
+ *
+ * On the first run each candidate executes once inside a plugin timing
+ * window and the fastest is persisted through TuningCache; subsequent
+ * runs (and subsequent processes on the same host configuration)
+ * dispatch straight to the cached winner. The tuning run executes the
+ * kernel once per candidate, so bodies must tolerate re-execution.
+ */
+template <typename... Variants, typename Body>
+RAJA_INLINE void autotune(const std::string& name,
+                          camp::list<Variants...>,
+                          Body&& body)
+{
+  static_assert(sizeof...(Variants) > 0,
+                "autotune requires at least one candidate variant");
+
+  using invoker = detail::variant_invoker<camp::decay<Body>, Variants...>;
+  constexpr size_t num_variants = sizeof...(Variants);
+
+  int winner = TuningCache::getInstance().lookup(name, num_variants);
+  if (winner >= 0) {
+    invoker::invoke(static_cast<size_t>(winner), body);
+    return;
+  }
+
+  // no cached winner for this host configuration: benchmark every
+  // candidate and persist the fastest
+  size_t best = 0;
+  double best_time = 0.0;
+  for (size_t index = 0; index < num_variants; ++index) {
+    AutotunerPlugin::beginWindow();
+    Timer timer;
+    timer.start();
+    invoker::invoke(index, body);
+    timer.stop();
+    unsigned long launches = 0;
+    double launch_time = AutotunerPlugin::endWindow(&launches);
+    // prefer the launch times seen by the plugin hooks, which are
+    // device-synchronized; fall back to wall time for bodies that made
+    // no RAJA launches
+    double elapsed = (launches > 0) ? launch_time : timer.elapsed();
+    if (index == 0 || elapsed < best_time) {
+      best = index;
+      best_time = elapsed;
+    }
+  }
+  TuningCache::getInstance().record(name, num_variants, best, best_time);
+}
+
+namespace detail
+{
+
+//! Build the nested statement::For tree running the loops in Perm's
+//  order, innermost statement a Lambda<0>
+template <typename Perm, typename ExecPolicy>
+struct nested_for_build;
+
+template <camp::idx_t I0, typename ExecPolicy>
+struct nested_for_build<camp::idx_seq<I0>, ExecPolicy> {
+  using type = statement::For<I0, ExecPolicy, statement::Lambda<0>>;
+};
+
+template <camp::idx_t I0, camp::idx_t I1, camp::idx_t... IRest,
+          typename ExecPolicy>
+struct nested_for_build<camp::idx_seq<I0, I1, IRest...>, ExecPolicy> {
+  using type = statement::For<
+      I0,
+      ExecPolicy,
+      typename nested_for_build<camp::idx_seq<I1, IRest...>,
+                                ExecPolicy>::type>;
+};
+
+}  // namespace detail
+
+/*!
+ * Kernel policy running a perfect loop nest in the order given by a
+ * permutation: loop_order_policy<PERM_KJI> is For<2, For<1, For<0,
+ * Lambda<0>>>>. The permutation is outermost-first, matching the For
+ * nesting it replaces.
+ */
+template <typename Perm, typename ExecPolicy = loop_exec>
+using loop_order_policy = RAJA::KernelPolicy<
+    typename detail::nested_for_build<Perm, ExecPolicy>::type>;
+
+/*!
+ * Run a perfect loop nest through its best iteration order,
+ * benchmarking every order first if this host configuration has no
+ * cached winner.
+ *
+ * The kernel is given as its segment tuple and body lambda, exactly as
+ * to RAJA::kernel; the statement tree is generated rather than written,
+ * one loop_order_policy per permutation of the segments. On the first
+ * run each of the N! orders executes once inside the autotune timing
+ * window and the fastest is persisted through TuningCache under the
+ * kernel's name, so the hand-maintained families of permuted policy
+ * variants collapse to one call:
+ *
+ *   RAJA::util::kernel_tune_order("heat_stencil",
+ *       RAJA::make_tuple(RAJA::RangeSegment(0, NI),
+ *                        RAJA::RangeSegment(0, NJ),
+ *                        RAJA::RangeSegment(0, NK)),
+ *       [=](int i, int j, int k) { ... });
+ *
+ * The tuning run executes the kernel once per order, so bodies must
+ * tolerate re-execution (as with autotune generally). Orders all use
+ * the same per-loop execution policy, ExecPolicy; nests needing mixed
+ * policies (threaded outer loop, simd inner) are beyond what can be
+ * permuted blindly and keep their explicit policies.
+ */
+template <typename ExecPolicy = loop_exec,
+          typename SegmentTuple,
+          typename LoopBody>
+RAJA_INLINE void kernel_tune_order(const std::string& name,
+                                   SegmentTuple&& segments,
+                                   LoopBody&& body)
+{
+  constexpr size_t N =
+      camp::tuple_size<camp::decay<SegmentTuple>>::value;
+  static_assert(N > 0, "kernel_tune_order requires at least one segment");
+
+  autotune(name, all_permutations<N>{}, [&](auto perm) {
+    using Pol = loop_order_policy<decltype(perm), ExecPolicy>;
+    RAJA::kernel<Pol>(segments, body);
+  });
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
@@ -52,6 +52,71 @@ namespace RAJA
     }
   };
 
+
+  /*!
+   * Word type holding one activity bit per loop iterate for masked
+   * execution; iterate i lives at bit (i % 64) of word (i / 64).
+   */
+  using BitSetWord = unsigned long long;
+
+  /*!
+   * A non-owning view of a packed set of activity bits
+   *
+   * Wraps an array of BitSetWord covering a loop's iteration space,
+   * one bit per iterate. The view does not own the words; the caller
+   * keeps them alive (and device-accessible for device policies) for
+   * the duration of any masked loop using the view. Bits at positions
+   * past the loop length are ignored.
+   */
+  struct BitSetView {
+    static constexpr size_t bits_per_word = 8 * sizeof(BitSetWord);
+
+    const BitSetWord* words = nullptr;
+
+    constexpr BitSetView() = default;
+
+    RAJA_HOST_DEVICE
+    constexpr explicit BitSetView(const BitSetWord* words_) : words(words_) {}
+
+    //! number of words needed to cover num_bits iterates
+    RAJA_HOST_DEVICE
+    static constexpr size_t num_words(size_t num_bits) {
+      return (num_bits + bits_per_word - 1) / bits_per_word;
+    }
+
+    //! the word holding bits [w * bits_per_word, (w+1) * bits_per_word)
+    RAJA_HOST_DEVICE
+    constexpr BitSetWord word(size_t w) const { return words[w]; }
+
+    //! whether iterate i is active
+    RAJA_HOST_DEVICE
+    constexpr bool test(size_t i) const {
+      return (words[i / bits_per_word] >>
+              (static_cast<BitSetWord>(i) % bits_per_word)) & 1ull;
+    }
+  };
+
+
+namespace detail
+{
+
+  //! position of the lowest set bit of a non-zero word
+  RAJA_INLINE int firstSetBit(BitSetWord w)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(w);
+#else
+    int b = 0;
+    while (!(w & 1ull)) {
+      w >>= 1;
+      ++b;
+    }
+    return b;
+#endif
+  }
+
+}  // namespace detail
+
 }  // namespace RAJA
 
 #endif //RAJA_util_BitMask_HPP
@@ -0,0 +1,255 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a block-sparse view with implicit
+ *          zeros for absent blocks.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BLOCKSPARSEVIEW_HPP
+#define RAJA_BLOCKSPARSEVIEW_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Non-owning block-sparse view over a 2d field that is mostly
+ *        structured zeros.
+ *
+ * The field is tiled into block_i x block_j blocks. Blocks holding only
+ * zeros are not stored: a block index map holds the pool slot of each
+ * present block (or -1), and present blocks live densely packed in a
+ * block pool, so loops over the pool stream only real data. The
+ * element accessor returns a zero constant for absent blocks, keeping
+ * whole-field reads correct without materializing the zeros.
+ *
+ * Like View, this type does not own its arrays; the map, the slot-to-
+ * block table, and the pool live in user-managed memory so they can be
+ * placed wherever the loops run. The blockSparseCountBlocks and
+ * blockSparseFill helpers build the three arrays from a dense field on
+ * the host.
+ *
+ * Material loops iterate the present blocks only:
+ *
+ * \code
+ *
+ *  RAJA::BlockSparseView2d<double> vf(pool, map, ids, nblk, ni, nj, bi, bj);
+ *
+ *  RAJA::forall<policy>(vf.present_blocks(), [=] (RAJA::Index_type s) {
+ *    auto blk = vf.block_view(s);        // dense bi x bj View into pool
+ *    for (...) blk(li, lj) = ...;
+ *  });
+ *
+ * \endcode
+ */
+template <typename ValueType, typename IndexType = Index_type>
+struct BlockSparseView2d {
+
+  using value_type = ValueType;
+  using index_type = IndexType;
+  using block_view_type = RAJA::View<ValueType, RAJA::Layout<2, IndexType, 1>>;
+
+  ValueType* pool;             //! packed storage of present blocks
+  const IndexType* block_map;  //! per block: pool slot, or -1 if absent
+  const IndexType* block_ids;  //! per pool slot: linear block id
+  IndexType num_present;       //! number of present blocks
+  IndexType ni, nj;            //! field extents
+  IndexType block_i, block_j;  //! block extents
+  IndexType nbi, nbj;          //! block-grid extents
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  BlockSparseView2d(ValueType* pool_,
+                    const IndexType* block_map_,
+                    const IndexType* block_ids_,
+                    IndexType num_present_,
+                    IndexType ni_,
+                    IndexType nj_,
+                    IndexType block_i_,
+                    IndexType block_j_)
+      : pool(pool_),
+        block_map(block_map_),
+        block_ids(block_ids_),
+        num_present(num_present_),
+        ni(ni_),
+        nj(nj_),
+        block_i(block_i_),
+        block_j(block_j_),
+        nbi((ni_ + block_i_ - 1) / block_i_),
+        nbj((nj_ + block_j_ - 1) / block_j_)
+  {
+  }
+
+  //! Element read; absent blocks read as zero
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  ValueType operator()(IndexType i, IndexType j) const
+  {
+    IndexType slot = block_map[(i / block_i) * nbj + (j / block_j)];
+    if (slot < 0) {
+      return ValueType(0);
+    }
+    return pool[slot * block_i * block_j + (i % block_i) * block_j +
+                (j % block_j)];
+  }
+
+  //! Reference into a present block; the block holding (i, j) must be
+  //  present
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  ValueType& at(IndexType i, IndexType j) const
+  {
+    IndexType slot = block_map[(i / block_i) * nbj + (j / block_j)];
+    return pool[slot * block_i * block_j + (i % block_i) * block_j +
+                (j % block_j)];
+  }
+
+  //! Segment over the pool slots of present blocks, for use with forall
+  RAJA_INLINE
+  RAJA::TypedRangeSegment<IndexType> present_blocks() const
+  {
+    return RAJA::TypedRangeSegment<IndexType>(0, num_present);
+  }
+
+  //! Dense block_i x block_j view over the given pool slot
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  block_view_type block_view(IndexType slot) const
+  {
+    return block_view_type(pool + slot * block_i * block_j, block_i, block_j);
+  }
+
+  //! Field coordinates of the first element of the given pool slot
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  IndexType block_begin_i(IndexType slot) const
+  {
+    return (block_ids[slot] / nbj) * block_i;
+  }
+  ///
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  IndexType block_begin_j(IndexType slot) const
+  {
+    return (block_ids[slot] % nbj) * block_j;
+  }
+};
+
+
+/*!
+ * \brief Count the blocks of a dense field holding any nonzero, i.e. the
+ *        pool slots a block-sparse view of it needs.
+ *
+ * The field extents need not be block multiples; edge blocks are padded
+ * with zeros in the pool. Runs on the host.
+ */
+template <typename ValueType, typename IndexType = Index_type>
+RAJA_INLINE IndexType blockSparseCountBlocks(const ValueType* dense,
+                                             IndexType ni,
+                                             IndexType nj,
+                                             IndexType block_i,
+                                             IndexType block_j)
+{
+  IndexType nbi = (ni + block_i - 1) / block_i;
+  IndexType nbj = (nj + block_j - 1) / block_j;
+
+  IndexType count = 0;
+  for (IndexType b = 0; b < nbi * nbj; ++b) {
+    IndexType i0 = (b / nbj) * block_i;
+    IndexType j0 = (b % nbj) * block_j;
+    bool present = false;
+    for (IndexType i = i0; i < i0 + block_i && i < ni && !present; ++i) {
+      for (IndexType j = j0; j < j0 + block_j && j < nj; ++j) {
+        if (dense[i * nj + j] != ValueType(0)) {
+          present = true;
+          break;
+        }
+      }
+    }
+    if (present) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+/*!
+ * \brief Fill the block map, slot table, and pool of a block-sparse view
+ *        from a dense field and return the view.
+ *
+ * block_map must hold nbi * nbj entries; block_ids and pool must be
+ * sized for the count returned by blockSparseCountBlocks. Runs on the
+ * host; copy the arrays to the target memory space afterwards if the
+ * loops run elsewhere.
+ */
+template <typename ValueType, typename IndexType = Index_type>
+RAJA_INLINE BlockSparseView2d<ValueType, IndexType> blockSparseFill(
+    const ValueType* dense,
+    IndexType ni,
+    IndexType nj,
+    IndexType block_i,
+    IndexType block_j,
+    ValueType* pool,
+    IndexType* block_map,
+    IndexType* block_ids)
+{
+  IndexType nbi = (ni + block_i - 1) / block_i;
+  IndexType nbj = (nj + block_j - 1) / block_j;
+
+  IndexType count = 0;
+  for (IndexType b = 0; b < nbi * nbj; ++b) {
+    IndexType i0 = (b / nbj) * block_i;
+    IndexType j0 = (b % nbj) * block_j;
+    bool present = false;
+    for (IndexType i = i0; i < i0 + block_i && i < ni && !present; ++i) {
+      for (IndexType j = j0; j < j0 + block_j && j < nj; ++j) {
+        if (dense[i * nj + j] != ValueType(0)) {
+          present = true;
+          break;
+        }
+      }
+    }
+
+    if (present) {
+      ValueType* blk = pool + count * block_i * block_j;
+      for (IndexType li = 0; li < block_i; ++li) {
+        for (IndexType lj = 0; lj < block_j; ++lj) {
+          IndexType i = i0 + li;
+          IndexType j = j0 + lj;
+          blk[li * block_j + lj] =
+              (i < ni && j < nj) ? dense[i * nj + j] : ValueType(0);
+        }
+      }
+      block_map[b] = count;
+      block_ids[count] = b;
+      ++count;
+    } else {
+      block_map[b] = IndexType(-1);
+    }
+  }
+
+  return BlockSparseView2d<ValueType, IndexType>(
+      pool, block_map, block_ids, count, ni, nj, block_i, block_j);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,117 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining a cooperative cancellation token for
+ *          abandoning in-flight RAJA loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_CancellationToken_HPP
+#define RAJA_CancellationToken_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <memory>
+
+#if defined(RAJA_ENABLE_CUDA)
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#endif
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Cooperative cancellation token, observed by forall_cancellable.
+ *
+ * A token is a shared flag the controlling thread raises with cancel()
+ * to ask a running cancellable loop to stop at its next poll point. The
+ * typical use is low-priority in-situ analysis that must surrender the
+ * device when the simulation needs it back: the simulation thread holds
+ * a copy of the token and cancels it, and the analysis loop yields
+ * within one chunk of work instead of running to completion.
+ *
+ * Copies share state (like the reducer objects), so the token captured
+ * by the launching code and the one the controller cancels are the same
+ * flag. When CUDA is enabled the flag lives in pinned mapped memory so
+ * future device-side poll points can read it; cancel() itself is always
+ * a host-side store and never touches the device.
+ *
+ * Tokens are reusable: reset() rearms a canceled token for the next
+ * analysis pass.
+ *
+ ******************************************************************************
+ */
+class CancellationToken
+{
+public:
+  CancellationToken() : m_state(std::make_shared<State>()) {}
+
+  //! Request cancellation: cancellable loops observing this token stop
+  //  at their next poll point. Const so captured copies can cancel; the
+  //  flag is shared state, not part of the token's value.
+  void cancel() const { m_state->store(1); }
+
+  //! Rearm the token for reuse after a cancellation was observed.
+  void reset() const { m_state->store(0); }
+
+  //! Whether cancellation has been requested.
+  bool canceled() const { return m_state->load() != 0; }
+
+private:
+#if defined(RAJA_ENABLE_CUDA)
+  //! flag in pinned mapped memory, device-readable under UVA
+  struct State {
+    State()
+        : flag(RAJA::cuda::pinned_mempool_type::getInstance()
+                   .malloc<unsigned int>(1))
+    {
+      *flag = 0;
+    }
+    ~State()
+    {
+      RAJA::cuda::pinned_mempool_type::getInstance().free(flag);
+    }
+    State(State const&) = delete;
+    State& operator=(State const&) = delete;
+
+    void store(unsigned int v)
+    {
+      *static_cast<volatile unsigned int*>(flag) = v;
+      std::atomic_thread_fence(std::memory_order_release);
+    }
+    unsigned int load() const
+    {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return *static_cast<volatile unsigned int*>(flag);
+    }
+
+    unsigned int* flag;
+  };
+#else
+  struct State {
+    void store(unsigned int v) { flag.store(v, std::memory_order_release); }
+    unsigned int load() const { return flag.load(std::memory_order_acquire); }
+
+    std::atomic<unsigned int> flag{0};
+  };
+#endif
+
+  std::shared_ptr<State> m_state;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,72 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for host cache-topology probing.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_HwTopology_HPP
+#define RAJA_util_HwTopology_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+namespace RAJA
+{
+
+//! One level of the host's data cache hierarchy.
+struct CacheLevel {
+  int level;         //!< hierarchy level, 1 is closest to the core
+  size_t size;       //!< capacity of one cache instance in bytes
+  size_t line_size;  //!< cache line size in bytes
+  int sharing;       //!< hardware threads sharing one instance
+};
+
+//! Data-cache topology of the host.
+//
+//  Tile-size constants baked into headers assume one cache geometry and
+//  go stale on parts that differ (larger L1 partitions, stacked L3).
+//  This struct carries what the probe discovered so tile extents and
+//  blocking factors can be derived at runtime instead.
+struct HwTopology {
+  static constexpr int max_cache_levels = 3;
+
+  int num_logical_cpus;
+  CacheLevel cache[max_cache_levels];
+
+  //! cache description for the given level (1-based). Out-of-range
+  //  levels clamp to the nearest probed level, so asking for L3 on a
+  //  machine described only through L2 yields the outermost known
+  //  cache rather than garbage.
+  CacheLevel const& data_cache(int level) const
+  {
+    int idx = level - 1;
+    if (idx < 0) {
+      idx = 0;
+    } else if (idx >= max_cache_levels) {
+      idx = max_cache_levels - 1;
+    }
+    return cache[idx];
+  }
+};
+
+//! Host topology singleton, probed once at first call. On Linux the
+//  probe reads the sysfs cache directories, falling back to sysconf
+//  queries and finally to conservative built-in defaults, so every
+//  field is always populated.
+HwTopology const& hw_topology();
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -261,6 +261,45 @@ public:
     return foldl(RAJA::operators::multiplies<IdxLin>(),
                          (sizes[RangeInts] == IdxLin(0) ? IdxLin(1) : sizes[RangeInts])...);
   }
+
+  /*!
+   * Type of the layout obtained by removing dimension DIM. The stride-1
+   * annotation follows the dimension it names: it is dropped if that
+   * dimension is the one removed, and renumbered if a dimension before
+   * it is removed.
+   */
+  template <camp::idx_t DIM>
+  using RemoveDimLayout = LayoutBase_impl<
+      camp::make_idx_seq_t<sizeof...(RangeInts) - 1>,
+      IdxLin,
+      (StrideOneDim < 0 || StrideOneDim == static_cast<ptrdiff_t>(DIM))
+          ? static_cast<ptrdiff_t>(-1)
+          : (StrideOneDim > static_cast<ptrdiff_t>(DIM) ? StrideOneDim - 1
+                                                        : StrideOneDim)>;
+
+  /*!
+   * Returns the layout of a slice through dimension DIM: the remaining
+   * dimensions keep the sizes and strides of this layout, so nothing is
+   * re-derived. Used by View::slice to make subview creation free of
+   * layout arithmetic.
+   */
+  template <camp::idx_t DIM>
+  RAJA_INLINE RAJA_HOST_DEVICE RemoveDimLayout<DIM> remove_dim() const
+  {
+    static_assert(n_dims > 1, "cannot remove the only dimension of a layout");
+    static_assert(DIM >= 0 && DIM < static_cast<camp::idx_t>(n_dims),
+                  "removed dimension must exist");
+
+    RemoveDimLayout<DIM> lay;
+    for (camp::idx_t j = 0; j < static_cast<camp::idx_t>(n_dims) - 1; ++j) {
+      camp::idx_t p = (j < DIM) ? j : j + 1;
+      lay.sizes[j] = sizes[p];
+      lay.strides[j] = strides[p];
+      lay.inv_strides[j] = inv_strides[p];
+      lay.inv_mods[j] = inv_mods[p];
+    }
+    return lay;
+  }
 };
 
 template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
@@ -324,6 +363,29 @@ template <size_t n_dims, typename IdxLin = Index_type, ptrdiff_t StrideOne = -1>
 using Layout =
     detail::LayoutBase_impl<camp::make_idx_seq_t<n_dims>, IdxLin, StrideOne>;
 
+/*!
+ * Layout with the right-most (last) dimension statically annotated as
+ * stride-1.
+ *
+ * The default Layout constructor taking only dimension sizes always makes
+ * the last dimension stride-1, but the plain Layout type does not record
+ * that fact, so indexing multiplies by a runtime stride of one that the
+ * compiler cannot remove through the View indirection. StrideOneLayout
+ * keeps runtime extents but compiles inner-dimension indexing to a plain
+ * add, as StaticLayout achieves with fully static extents:
+ *
+ *     // drop-in replacement when using default (right-most stride-1)
+ *     // striding
+ *     RAJA::View<double, RAJA::StrideOneLayout<2>> view(data, n, m);
+ *
+ * Only use this with the default striding; for permuted strides, annotate
+ * with make_stride_one or the permutation-typed make_permuted_layout
+ * overload instead.
+ */
+template <size_t n_dims, typename IdxLin = Index_type>
+using StrideOneLayout =
+    Layout<n_dims, IdxLin, static_cast<ptrdiff_t>(n_dims) - 1>;
+
 template <typename IdxLin, typename DimTuple, ptrdiff_t StrideOne = -1>
 struct TypedLayout;
 
@@ -60,6 +60,7 @@ struct TypedLocalArray<DataType, camp::idx_seq<Perm...>, RAJA::SizeList<Sizes...
   using element_t = DataType;
   using layout_t = StaticLayout<camp::idx_seq<Perm...>, Sizes...>;
   static const camp::idx_t NumElem = layout_t::size();
+  static const camp::idx_t Alignment = alignof(DataType);
 
   RAJA_HOST_DEVICE
   element_t &operator()(IndexTypes ...indices) const
@@ -84,6 +85,7 @@ struct AtomicTypedLocalArray<AtomicPolicy, DataType, camp::idx_seq<Perm ...>,
   using atomic_ref_t = RAJA::AtomicRef<element_t, AtomicPolicy>;
   using layout_t = RAJA::StaticLayout<camp::idx_seq<Perm ...>, Sizes ...>;
   static const camp::idx_t NumElem = layout_t::size();
+  static const camp::idx_t Alignment = alignof(DataType);
 
   RAJA_HOST_DEVICE
   atomic_ref_t operator()(IndexTypes ... indices) const
@@ -107,6 +109,46 @@ struct LocalArray<DataType, camp::idx_seq<Perm...>, RAJA::SizeList<Sizes...> >
   using element_t = DataType;
   using layout_t = StaticLayout<camp::idx_seq<Perm...>, Sizes...>;
   static const camp::idx_t NumElem = layout_t::size();
+  static const camp::idx_t Alignment = alignof(DataType);
+
+  template<typename ...Indices>
+  RAJA_HOST_DEVICE
+  element_t &operator()(Indices ...indices) const
+  {
+    return m_arrayPtr[layout_t::s_oper(indices...)];
+  }
+
+};
+
+
+/*!
+ * RAJA local array with bank-conflict-avoiding padding and an explicit
+ * alignment guarantee for its backing storage.
+ *
+ * The fastest-varying extent is padded by Pad elements (Pad = 1 gives
+ * the classic "+1 element per row"), staggering rows of power-of-two
+ * tiles across CUDA shared memory banks and across CPU cache sets.
+ * Indexing uses the unpadded logical extents, so loop bounds are the
+ * same as for an unpadded LocalArray; only NumElem and the row stride
+ * grow. Align is the byte alignment requested for the backing storage
+ * when the array is materialized by an InitLocalMem statement.
+ */
+template<typename DataType, typename Perm, typename Sizes,
+         camp::idx_t Pad = 1, camp::idx_t Align = alignof(DataType)>
+struct PaddedLocalArray
+{
+};
+
+template<typename DataType, camp::idx_t ... Perm, camp::idx_t ...Sizes,
+         camp::idx_t Pad, camp::idx_t Align>
+struct PaddedLocalArray<DataType, camp::idx_seq<Perm...>,
+                        RAJA::SizeList<Sizes...>, Pad, Align>
+{
+  DataType *m_arrayPtr = nullptr;
+  using element_t = DataType;
+  using layout_t = PaddedStaticLayout<camp::idx_seq<Perm...>, Pad, Sizes...>;
+  static const camp::idx_t NumElem = layout_t::size();
+  static const camp::idx_t Alignment = Align;
 
   template<typename ...Indices>
   RAJA_HOST_DEVICE
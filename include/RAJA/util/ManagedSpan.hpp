@@ -0,0 +1,256 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for RAJA managed memory span constructs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_MANAGED_SPAN_HPP
+#define RAJA_MANAGED_SPAN_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include <cuda_runtime.h>
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include <hip/hip_runtime.h>
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#endif
+
+namespace RAJA
+{
+
+namespace util
+{
+namespace detail
+{
+
+/*!
+ * Platform of the RAJA launch currently being captured on this thread,
+ * Platform::undefined outside of lambda capture. Maintained by the
+ * managed span plugin from the preCapture/postCapture plugin hooks.
+ */
+Platform& managedSpanCapturePlatform();
+
+}  // namespace detail
+}  // namespace util
+
+/*!
+ * @brief A span over unified memory that prefetches toward its users.
+ *
+ * Like Span, a non-owning view of a contiguous sequence, but restricted
+ * to raw pointers and aware that the memory is CUDA/HIP managed. When a
+ * ManagedSpan is captured into a RAJA loop body, its copy constructor
+ * runs between the preCapture and postCapture plugin hooks, where the
+ * managed span plugin has recorded the launch platform; the copy issues
+ * a memory-prefetch toward the device (or back toward the host for host
+ * policies) before the kernel traverses the data, replacing the
+ * page-fault-per-touch cost of unhinted unified memory after the data
+ * migrates away.
+ *
+ * For example:
+ *
+ *     double* data;  // cudaMallocManaged allocation
+ *     auto span = RAJA::make_managed_span(data, len);
+ *
+ *     // span's bytes are prefetched to the device before the kernel runs
+ *     RAJA::forall<RAJA::cuda_exec<256>>(range, [=] RAJA_DEVICE (int i) {
+ *       span[i] = ...;
+ *     });
+ *
+ * Pointers that are not managed allocations are detected at
+ * construction and never prefetched, so the span is safe to use
+ * uniformly. read_mostly() additionally advises the driver that the
+ * data is read-shared, enabling replicated read-only copies on host
+ * and device.
+ *
+ * Prefetches are advisory and issued on the default stream; they
+ * overlap the launch bookkeeping but are not required for correctness.
+ */
+template <typename T, typename IndexType = Index_type>
+struct ManagedSpan {
+  using element_type = T;
+  using value_type = camp::decay<T>;
+  using size_type = IndexType;
+  using difference_type = std::ptrdiff_t;
+  using reference = element_type&;
+  using const_reference = const element_type&;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  static_assert(type_traits::is_integral<IndexType>::value,
+                "IndexType must model Integral");
+
+  ManagedSpan(iterator begin, size_type size)
+      : m_begin{begin}, m_end{begin + size}, m_managed{isManaged(begin)}
+  {
+  }
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE ManagedSpan(const ManagedSpan& other)
+      : m_begin{other.m_begin},
+        m_end{other.m_end},
+        m_managed{other.m_managed}
+  {
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+    prefetch(util::detail::managedSpanCapturePlatform());
+#endif
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE iterator begin() const { return m_begin; }
+  RAJA_HOST_DEVICE RAJA_INLINE iterator end() const { return m_end; }
+  RAJA_HOST_DEVICE RAJA_INLINE const_iterator cbegin() const { return m_begin; }
+  RAJA_HOST_DEVICE RAJA_INLINE const_iterator cend() const { return m_end; }
+
+  RAJA_HOST_DEVICE RAJA_INLINE reference front() const { return *begin(); }
+  RAJA_HOST_DEVICE RAJA_INLINE reference back() const { return *(end()-1); }
+  RAJA_HOST_DEVICE RAJA_INLINE reference operator[](size_type i) const { return data()[i]; }
+  RAJA_HOST_DEVICE RAJA_INLINE iterator data() const { return m_begin; }
+
+  RAJA_HOST_DEVICE RAJA_INLINE size_type size() const
+  {
+    return static_cast<size_type>(m_end - m_begin);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE bool empty() const
+  {
+    return size() == static_cast<size_type>(0);
+  }
+
+  //! whether the spanned memory is a managed allocation
+  RAJA_HOST_DEVICE RAJA_INLINE bool managed() const { return m_managed; }
+
+  /*!
+   * Advise the driver that the spanned data is mostly read, so host and
+   * device may keep replicated read-only copies instead of migrating
+   * pages back and forth. Call once after construction for spans that
+   * kernels only read.
+   */
+  ManagedSpan& read_mostly()
+  {
+#if defined(RAJA_ENABLE_CUDA)
+    if (m_managed) {
+      int device = 0;
+      cudaErrchk(cudaGetDevice(&device));
+      cudaErrchk(cudaMemAdvise(m_begin, size_bytes(),
+                               cudaMemAdviseSetReadMostly, device));
+    }
+#elif defined(RAJA_ENABLE_HIP)
+    if (m_managed) {
+      int device = 0;
+      hipErrchk(hipGetDevice(&device));
+      hipErrchk(hipMemAdvise(m_begin, size_bytes(),
+                             hipMemAdviseSetReadMostly, device));
+    }
+#endif
+    return *this;
+  }
+
+  /*!
+   * Prefetch the spanned bytes toward where platform executes: the
+   * current device for device platforms, the host otherwise. No-op for
+   * non-managed memory and outside of launch capture.
+   */
+  void prefetch(Platform platform) const
+  {
+#if defined(RAJA_ENABLE_CUDA)
+    if (m_managed) {
+      if (platform == Platform::cuda) {
+        int device = 0;
+        cudaErrchk(cudaGetDevice(&device));
+        cudaErrchk(cudaMemPrefetchAsync(m_begin, size_bytes(), device, 0));
+      } else if (platform == Platform::host) {
+        cudaErrchk(cudaMemPrefetchAsync(m_begin, size_bytes(),
+                                        cudaCpuDeviceId, 0));
+      }
+    }
+#elif defined(RAJA_ENABLE_HIP)
+    if (m_managed) {
+      if (platform == Platform::hip) {
+        int device = 0;
+        hipErrchk(hipGetDevice(&device));
+        hipErrchk(hipMemPrefetchAsync(m_begin, size_bytes(), device, 0));
+      } else if (platform == Platform::host) {
+        hipErrchk(hipMemPrefetchAsync(m_begin, size_bytes(),
+                                      hipCpuDeviceId, 0));
+      }
+    }
+#else
+    RAJA_UNUSED_VAR(platform);
+#endif
+  }
+
+private:
+  RAJA_HOST_DEVICE RAJA_INLINE size_t size_bytes() const
+  {
+    return static_cast<size_t>(m_end - m_begin) * sizeof(T);
+  }
+
+  //! whether ptr is a managed allocation, queried once at construction
+  static bool isManaged(T* ptr)
+  {
+#if defined(RAJA_ENABLE_CUDA)
+    cudaPointerAttributes attr;
+    if (cudaPointerGetAttributes(&attr, ptr) != cudaSuccess) {
+      cudaGetLastError();  // consume the error from unknown pointers
+      return false;
+    }
+#if CUDART_VERSION >= 10000
+    return attr.type == cudaMemoryTypeManaged;
+#else
+    return attr.isManaged != 0;
+#endif
+#elif defined(RAJA_ENABLE_HIP)
+    hipPointerAttribute_t attr;
+    if (hipPointerGetAttributes(&attr, ptr) != hipSuccess) {
+      hipGetLastError();  // consume the error from unknown pointers
+      return false;
+    }
+    return attr.isManaged != 0;
+#else
+    RAJA_UNUSED_VAR(ptr);
+    return false;
+#endif
+  }
+
+  iterator m_begin;
+  iterator m_end;
+  bool m_managed;
+};
+
+/*!
+ * @brief Creates a managed span from a pointer and length.
+ * @param begin beginning of the sequence being spanned
+ * @param size length of the sequence being spanned
+ * @return Returns a ManagedSpan representing the given sequence
+ */
+template <typename T, typename IndexType>
+RAJA_INLINE ManagedSpan<T, IndexType> make_managed_span(T* begin,
+                                                        IndexType size)
+{
+  return ManagedSpan<T, IndexType>(begin, size);
+}
+
+}  // end namespace RAJA
+
+#endif /* RAJA_MANAGED_SPAN_HPP */
@@ -0,0 +1,203 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a memory-mapped read-only view.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_MappedView_HPP
+#define RAJA_MappedView_HPP
+
+#include "RAJA/config.hpp"
+
+#if !defined(_WIN32)
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Access-pattern hint for a mapped view, forwarded to madvise so the
+ * kernel's readahead matches the traversal the table will see:
+ * sequential widens readahead for streaming sweeps, random disables it
+ * for scattered interpolation lookups, and willneed starts paging the
+ * whole table in immediately.
+ */
+enum struct MappedViewAdvice {
+  normal,
+  sequential,
+  random,
+  willneed
+};
+
+/*!
+ * Read-only view over a file mapped into memory, for lookup tables too
+ * large to stage through the heap. The file's bytes back the view
+ * directly, so there is no load step and no staging copy: pages fault
+ * in lazily on first touch, and because the mapping is shared, multiple
+ * ranks on a node read one page-cache copy of the table.
+ *
+ * The object owns the mapping and unmaps on destruction, so it is
+ * move-only. Kernels capture the lightweight non-owning view() by
+ * value; the MappedView itself must outlive any use of that view.
+ * Access is host-only -- file pages are not addressable from device
+ * code.
+ *
+ * Construct through make_mapped_view below.
+ */
+template <typename ValueType, typename LayoutType>
+struct MappedView {
+  using value_type = ValueType const;
+  using layout_type = LayoutType;
+  using view_type = View<ValueType const, LayoutType, ValueType const*>;
+
+  MappedView(void* addr, size_t length, size_t byte_offset, LayoutType layout)
+      : m_addr(addr),
+        m_length(length),
+        m_view(reinterpret_cast<ValueType const*>(
+                   static_cast<char const*>(addr) + byte_offset),
+               std::move(layout))
+  {
+  }
+
+  MappedView(MappedView const&) = delete;
+  MappedView& operator=(MappedView const&) = delete;
+
+  MappedView(MappedView&& other)
+      : m_addr(other.m_addr), m_length(other.m_length), m_view(other.m_view)
+  {
+    other.m_addr = nullptr;
+    other.m_length = 0;
+  }
+
+  ~MappedView()
+  {
+    if (m_addr) {
+      munmap(m_addr, m_length);
+    }
+  }
+
+  //! non-owning view for capture into kernels
+  view_type const& view() const { return m_view; }
+
+  template <typename... Args>
+  RAJA_INLINE value_type& operator()(Args... args) const
+  {
+    return m_view(args...);
+  }
+
+  //! re-advise the mapping, e.g. before switching from a streaming
+  //  initialization sweep to scattered lookups
+  void advise(MappedViewAdvice advice) const
+  {
+    int flag = MADV_NORMAL;
+    switch (advice) {
+      case MappedViewAdvice::sequential: flag = MADV_SEQUENTIAL; break;
+      case MappedViewAdvice::random: flag = MADV_RANDOM; break;
+      case MappedViewAdvice::willneed: flag = MADV_WILLNEED; break;
+      default: break;
+    }
+    madvise(m_addr, m_length, flag);
+  }
+
+private:
+  void* m_addr;
+  size_t m_length;
+  view_type m_view;
+};
+
+/*!
+ * Map the file at path read-only and wrap it in a view with the given
+ * layout. The mapping must cover byte_offset plus layout.size() values;
+ * a short file aborts rather than handing out a view that faults on
+ * first access past the end.
+ *
+ *     auto table = RAJA::make_mapped_view<double>(
+ *         "opacity.tbl", RAJA::Layout<2>(num_temps, num_rhos),
+ *         RAJA::MappedViewAdvice::random);
+ *     ... table(t, r) ...
+ */
+template <typename ValueType, typename LayoutType>
+RAJA_INLINE MappedView<ValueType, LayoutType> make_mapped_view(
+    const std::string& path,
+    LayoutType layout,
+    MappedViewAdvice advice = MappedViewAdvice::normal,
+    size_t byte_offset = 0)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    RAJA_ABORT_OR_THROW("make_mapped_view failed to open file");
+  }
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    RAJA_ABORT_OR_THROW("make_mapped_view failed to stat file");
+  }
+
+  size_t length = byte_offset +
+                  static_cast<size_t>(stripIndexType(layout.size())) *
+                      sizeof(ValueType);
+  if (static_cast<size_t>(file_stat.st_size) < length) {
+    close(fd);
+    RAJA_ABORT_OR_THROW("make_mapped_view file shorter than layout");
+  }
+
+  void* addr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  // the mapping holds its own reference to the file
+  close(fd);
+  if (addr == MAP_FAILED) {
+    RAJA_ABORT_OR_THROW("make_mapped_view failed to map file");
+  }
+
+  MappedView<ValueType, LayoutType> mapped(
+      addr, length, byte_offset, std::move(layout));
+  mapped.advise(advice);
+  return mapped;
+}
+
+/*!
+ * One-dimensional convenience overload: the extent is derived from the
+ * file size, so a flat table maps without restating its length.
+ */
+template <typename ValueType>
+RAJA_INLINE MappedView<ValueType, Layout<1>> make_mapped_view(
+    const std::string& path,
+    MappedViewAdvice advice = MappedViewAdvice::normal)
+{
+  struct stat file_stat;
+  if (stat(path.c_str(), &file_stat) != 0) {
+    RAJA_ABORT_OR_THROW("make_mapped_view failed to stat file");
+  }
+  Index_type len =
+      static_cast<Index_type>(file_stat.st_size / sizeof(ValueType));
+  return make_mapped_view<ValueType>(path, Layout<1>(len), advice);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for !defined(_WIN32)
+
+#endif
@@ -24,6 +24,7 @@
 
 #include <stdint.h>
 #include <cfloat>
+#include <cmath>
 #include <cstdint>
 #include <type_traits>
 #if defined(RAJA_CHECK_LIMITS)
@@ -32,6 +33,7 @@
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
 
 namespace RAJA
 {
@@ -299,6 +301,69 @@ struct limits<long double> {
   }
 };
 
+#if defined(RAJA_CUDA_HAS_HALF)
+// Constructed from raw bit patterns since the half types have no
+// constexpr constructors; +-65504 is the largest finite __half.
+template <>
+struct limits<__half> {
+  RAJA_INLINE RAJA_HOST_DEVICE static __half min()
+  {
+    __half_raw raw;
+    raw.x = 0xfbffu;
+    return __half(raw);
+  }
+  RAJA_INLINE RAJA_HOST_DEVICE static __half max()
+  {
+    __half_raw raw;
+    raw.x = 0x7bffu;
+    return __half(raw);
+  }
+};
+#endif
+
+#if defined(RAJA_CUDA_HAS_BFLOAT16)
+// +-3.3895e38, the largest finite __nv_bfloat16
+template <>
+struct limits<__nv_bfloat16> {
+  RAJA_INLINE RAJA_HOST_DEVICE static __nv_bfloat16 min()
+  {
+    __nv_bfloat16_raw raw;
+    raw.x = 0xff7fu;
+    return __nv_bfloat16(raw);
+  }
+  RAJA_INLINE RAJA_HOST_DEVICE static __nv_bfloat16 max()
+  {
+    __nv_bfloat16_raw raw;
+    raw.x = 0x7f7fu;
+    return __nv_bfloat16(raw);
+  }
+};
+#endif
+
+/*!
+        \brief type used to accumulate values of the given type in a
+   reduction. Half-precision types accumulate in float so long sums do
+   not lose mantissa bits; everything else accumulates in its own type.
+*/
+template <typename T>
+struct accumulating {
+  using type = T;
+};
+
+#if defined(RAJA_CUDA_HAS_HALF)
+template <>
+struct accumulating<__half> {
+  using type = float;
+};
+#endif
+
+#if defined(RAJA_CUDA_HAS_BFLOAT16)
+template <>
+struct accumulating<__nv_bfloat16> {
+  using type = float;
+};
+#endif
+
 
 #if defined(RAJA_CHECK_LIMITS)
 template <typename T>
@@ -336,6 +401,184 @@ struct plus : public detail::binary_function<Arg1, Arg2, Ret>,
   RAJA_HOST_DEVICE static constexpr Ret identity() { return Ret{0}; }
 };
 
+/*!
+        \brief accumulator for compensated (Kahan/Neumaier) summation
+
+        Carries the running sum together with a correction term holding the
+        low-order bits that additions into the sum have rounded away.
+        Converts back to the element type by folding the correction in.
+*/
+template <typename T>
+struct kahan_tally {
+  using value_type = T;
+
+  T sum = T{0};
+  T c = T{0};
+
+  constexpr kahan_tally() = default;
+  constexpr kahan_tally(kahan_tally const&) = default;
+  kahan_tally& operator=(kahan_tally const&) = default;
+
+  RAJA_HOST_DEVICE constexpr kahan_tally(T const& v) : sum{v}, c{T{0}} {}
+  RAJA_HOST_DEVICE constexpr kahan_tally(T const& sum_, T const& c_)
+      : sum{sum_}, c{c_}
+  {
+  }
+
+  RAJA_HOST_DEVICE constexpr operator T() const { return sum + c; }
+
+  RAJA_HOST_DEVICE constexpr bool operator==(kahan_tally const& rhs) const
+  {
+    return sum == rhs.sum && c == rhs.c;
+  }
+  RAJA_HOST_DEVICE constexpr bool operator!=(kahan_tally const& rhs) const
+  {
+    return !(*this == rhs);
+  }
+};
+
+/*!
+        \brief compensated addition over kahan_tally values
+
+        Neumaier's variant: the high-order parts add normally while the
+        magnitude test recovers the bits that addition rounded away into
+        the correction term; the operands' correction terms add exactly.
+        The rounding error of a long fold stays O(1) in the number of
+        contributions instead of growing with it.
+*/
+template <typename Ret, typename Arg1 = Ret, typename Arg2 = Arg1>
+struct kahan_plus : public detail::binary_function<Arg1, Arg2, Ret>,
+                    detail::associative_tag {
+  using value_type = typename Ret::value_type;
+
+  RAJA_HOST_DEVICE constexpr Ret operator()(const Arg1& lhs,
+                                            const Arg2& rhs) const
+  {
+    return Ret{lhs.sum + rhs.sum,
+               lhs.c + rhs.c + lost_bits(lhs.sum, rhs.sum)};
+  }
+  RAJA_HOST_DEVICE static constexpr Ret identity() { return Ret{}; }
+
+private:
+  RAJA_HOST_DEVICE static constexpr value_type mag(value_type const& v)
+  {
+    return v < value_type{0} ? -v : v;
+  }
+
+  //! the round-off that the addition a + b discarded
+  RAJA_HOST_DEVICE static constexpr value_type lost_bits(value_type const& a,
+                                                         value_type const& b)
+  {
+    return mag(a) >= mag(b) ? (a - (a + b)) + b : (b - (a + b)) + a;
+  }
+};
+
+/*!
+        \brief double-double value for extended-precision accumulation
+
+        Carries an unevaluated sum of two doubles (hi + lo, with lo below
+        the last bit of hi), giving roughly 32 significant digits where
+        kahan_tally recovers one rounding's worth per combine. Additions
+        go through the two-sum error-free transforms -- a handful of adds
+        per element with no data motion -- so using it as the value type
+        of an ordinary sum reduction,
+
+            ReduceSum<policy, RAJA::extended_double> sum(0.0);
+
+        gives conservation-critical sums extended accumulation in one
+        pass at far less than the cost of a separate compensated sweep.
+        The transforms rely on IEEE rounding of each individual
+        operation: do not compile loops accumulating this type with
+        -ffast-math or inside RAJA_FASTMATH regions. Reduction policies
+        that combine tallies with native atomic operations cannot carry
+        a two-word value; the default fan-in reductions can.
+*/
+struct extended_double {
+  double hi = 0.0;
+  double lo = 0.0;
+
+  constexpr extended_double() = default;
+  constexpr extended_double(extended_double const&) = default;
+  extended_double& operator=(extended_double const&) = default;
+
+  RAJA_HOST_DEVICE constexpr extended_double(double v) : hi{v}, lo{0.0} {}
+  RAJA_HOST_DEVICE constexpr extended_double(double hi_, double lo_)
+      : hi{hi_}, lo{lo_}
+  {
+  }
+
+  //! fold the carried low-order bits back into one double
+  RAJA_HOST_DEVICE constexpr operator double() const { return hi + lo; }
+
+  RAJA_HOST_DEVICE RAJA_INLINE extended_double& operator+=(double y)
+  {
+    extended_double s = two_sum(hi, y);
+    s.lo += lo;
+    *this = renormalize(s.hi, s.lo);
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE extended_double& operator+=(
+      extended_double const& rhs)
+  {
+    extended_double s = two_sum(hi, rhs.hi);
+    extended_double t = two_sum(lo, rhs.lo);
+    s.lo += t.hi;
+    s = renormalize(s.hi, s.lo);
+    s.lo += t.lo;
+    *this = renormalize(s.hi, s.lo);
+    return *this;
+  }
+
+private:
+  //! error-free sum: hi + lo == a + b exactly
+  RAJA_HOST_DEVICE RAJA_INLINE static extended_double two_sum(double a,
+                                                              double b)
+  {
+    double s = a + b;
+    double bb = s - a;
+    return extended_double{s, (a - (s - bb)) + (b - bb)};
+  }
+
+  //! error-free sum for |a| >= |b|
+  RAJA_HOST_DEVICE RAJA_INLINE static extended_double renormalize(double a,
+                                                                  double b)
+  {
+    double s = a + b;
+    return extended_double{s, b - (s - a)};
+  }
+};
+
+RAJA_HOST_DEVICE RAJA_INLINE extended_double operator+(
+    extended_double lhs, extended_double const& rhs)
+{
+  lhs += rhs;
+  return lhs;
+}
+
+// the mixed overloads are templated so they match any arithmetic operand
+// exactly; a plain double overload would tie with the built-in operator
+// reached through the conversion to double
+template <typename U,
+          typename std::enable_if<std::is_arithmetic<U>::value, bool>::type =
+              true>
+RAJA_HOST_DEVICE RAJA_INLINE extended_double operator+(extended_double lhs,
+                                                       U rhs)
+{
+  lhs += static_cast<double>(rhs);
+  return lhs;
+}
+
+template <typename U,
+          typename std::enable_if<std::is_arithmetic<U>::value, bool>::type =
+              true>
+RAJA_HOST_DEVICE RAJA_INLINE extended_double operator+(U lhs,
+                                                       extended_double rhs)
+{
+  rhs += static_cast<double>(lhs);
+  return rhs;
+}
+
 template <typename Ret, typename Arg1 = Ret, typename Arg2 = Arg1>
 struct minus : public detail::binary_function<Arg1, Arg2, Ret> {
   RAJA_HOST_DEVICE constexpr Ret operator()(const Arg1& lhs,
@@ -533,6 +776,105 @@ struct less_equal : public detail::comparison_function<Arg1, Arg2> {
   }
 };
 
+// Math
+
+namespace detail
+{
+
+///
+/// Scalar math wrappers annotated with RAJA_DECLARE_SIMD so that calls
+/// made from inside RAJA_SIMD loops (e.g. loop bodies run through
+/// forall<simd_exec>) may be replaced with the compiler's vector math
+/// variants (libmvec, SVML) instead of serializing the loop behind
+/// scalar libm calls. Declared with plain inline rather than RAJA_INLINE
+/// so the compiler is free to call a vector variant instead of inlining
+/// the scalar body into the loop.
+///
+
+RAJA_DECLARE_SIMD
+RAJA_HOST_DEVICE inline float sv_exp(float arg) { return std::exp(arg); }
+RAJA_DECLARE_SIMD
+RAJA_HOST_DEVICE inline double sv_exp(double arg) { return std::exp(arg); }
+template <typename T>
+RAJA_HOST_DEVICE inline T sv_exp(const T& arg)
+{
+  using std::exp;
+  return exp(arg);
+}
+
+RAJA_DECLARE_SIMD
+RAJA_HOST_DEVICE inline float sv_log(float arg) { return std::log(arg); }
+RAJA_DECLARE_SIMD
+RAJA_HOST_DEVICE inline double sv_log(double arg) { return std::log(arg); }
+template <typename T>
+RAJA_HOST_DEVICE inline T sv_log(const T& arg)
+{
+  using std::log;
+  return log(arg);
+}
+
+RAJA_DECLARE_SIMD
+RAJA_HOST_DEVICE inline float sv_sqrt(float arg) { return std::sqrt(arg); }
+RAJA_DECLARE_SIMD
+RAJA_HOST_DEVICE inline double sv_sqrt(double arg) { return std::sqrt(arg); }
+template <typename T>
+RAJA_HOST_DEVICE inline T sv_sqrt(const T& arg)
+{
+  using std::sqrt;
+  return sqrt(arg);
+}
+
+RAJA_DECLARE_SIMD
+RAJA_HOST_DEVICE inline float sv_pow(float base, float exponent)
+{
+  return std::pow(base, exponent);
+}
+RAJA_DECLARE_SIMD
+RAJA_HOST_DEVICE inline double sv_pow(double base, double exponent)
+{
+  return std::pow(base, exponent);
+}
+template <typename T, typename U>
+RAJA_HOST_DEVICE inline T sv_pow(const T& base, const U& exponent)
+{
+  using std::pow;
+  return pow(base, exponent);
+}
+
+}  // namespace detail
+
+template <typename Ret, typename Arg = Ret>
+struct exp : public detail::unary_function<Arg, Ret> {
+  RAJA_HOST_DEVICE Ret operator()(const Arg& arg) const
+  {
+    return detail::sv_exp(Ret{arg});
+  }
+};
+
+template <typename Ret, typename Arg = Ret>
+struct log : public detail::unary_function<Arg, Ret> {
+  RAJA_HOST_DEVICE Ret operator()(const Arg& arg) const
+  {
+    return detail::sv_log(Ret{arg});
+  }
+};
+
+template <typename Ret, typename Arg = Ret>
+struct sqrt : public detail::unary_function<Arg, Ret> {
+  RAJA_HOST_DEVICE Ret operator()(const Arg& arg) const
+  {
+    return detail::sv_sqrt(Ret{arg});
+  }
+};
+
+template <typename Ret, typename Arg1 = Ret, typename Arg2 = Arg1>
+struct pow : public detail::binary_function<Arg1, Arg2, Ret> {
+  RAJA_HOST_DEVICE Ret operator()(const Arg1& base, const Arg2& exponent) const
+  {
+    return detail::sv_pow(Ret{base}, Ret{exponent});
+  }
+};
+
 // Filters
 
 template <typename Ret, typename Orig = Ret>
@@ -579,6 +921,8 @@ struct safe_plus
 
 }  // namespace operators
 
+using operators::extended_double;
+
 namespace concepts
 {
 
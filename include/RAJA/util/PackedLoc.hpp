@@ -0,0 +1,183 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for packed value+location reduction keys.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_PackedLoc_HPP
+#define RAJA_util_PackedLoc_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * PackedMinLoc / PackedMaxLoc - single-word keys for min-loc and
+ * max-loc reductions over 32-bit-indexable ranges.
+ *
+ * The loc reducers carry a {value, index} struct whose comparator mixes
+ * the two members, which keeps the loop out of the vectorizer on host.
+ * These helpers encode a 32-bit value and a 32-bit location into one
+ * 64-bit key whose integer ordering matches the value ordering (the
+ * value's bits, remapped so they compare monotonically, in the high
+ * half; the location in the low half), so a loc reduction becomes a
+ * plain scalar min or max over keys that the simd and OpenMP paths can
+ * vectorize:
+ *
+ * \code
+ *
+ *  using P = RAJA::PackedMinLoc<float>;
+ *  RAJA::ReduceMin<RAJA::omp_reduce, P::key_type> m(P::identity());
+ *
+ *  RAJA::forall<RAJA::omp_parallel_for_exec>(range, [=](RAJA::Index_type i) {
+ *    m.min(P::pack(x[i], static_cast<uint32_t>(i)));
+ *  });
+ *
+ *  float min_val = P::value(m.get());
+ *  uint32_t min_loc = P::loc(m.get());
+ *
+ * \endcode
+ *
+ * The value type must be 32 bits wide: float, or a 32-bit integer.
+ * Among equal values the smallest location wins for both min and max.
+ * Ordering of NaN values is unspecified, as it is for the struct-based
+ * comparator; the struct-based reducers remain the fallback for double
+ * values or 64-bit index spaces.
+ */
+
+namespace detail
+{
+
+//! remap float bits so unsigned comparison matches float ordering
+RAJA_HOST_DEVICE RAJA_INLINE uint32_t orderable_bits(float v)
+{
+  uint32_t bits;
+  memcpy(&bits, &v, sizeof(bits));
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+//! invert the float bit remap
+RAJA_HOST_DEVICE RAJA_INLINE float float_from_orderable_bits(uint32_t bits)
+{
+  bits = (bits & 0x80000000u) ? (bits & ~0x80000000u) : ~bits;
+  float v;
+  memcpy(&v, &bits, sizeof(v));
+  return v;
+}
+
+//! remap a signed 32-bit integer into unsigned order
+RAJA_HOST_DEVICE RAJA_INLINE uint32_t orderable_bits(int32_t v)
+{
+  return static_cast<uint32_t>(v) ^ 0x80000000u;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE uint32_t orderable_bits(uint32_t v) { return v; }
+
+template <typename T>
+struct from_orderable_bits {
+  static RAJA_HOST_DEVICE RAJA_INLINE T get(uint32_t bits)
+  {
+    return static_cast<T>(bits ^ 0x80000000u);
+  }
+};
+
+template <>
+struct from_orderable_bits<float> {
+  static RAJA_HOST_DEVICE RAJA_INLINE float get(uint32_t bits)
+  {
+    return float_from_orderable_bits(bits);
+  }
+};
+
+template <>
+struct from_orderable_bits<uint32_t> {
+  static RAJA_HOST_DEVICE RAJA_INLINE uint32_t get(uint32_t bits)
+  {
+    return bits;
+  }
+};
+
+}  // namespace detail
+
+template <typename T>
+struct PackedMinLoc {
+  static_assert(sizeof(T) == sizeof(uint32_t),
+                "PackedMinLoc requires a 32-bit value type");
+
+  using key_type = uint64_t;
+
+  //! key that loses to every packed key; use as the reducer's initial value
+  static RAJA_HOST_DEVICE RAJA_INLINE key_type identity()
+  {
+    return ~key_type(0);
+  }
+
+  //! encode value and location; smaller key means smaller value, and
+  //  among equal values the smaller location
+  static RAJA_HOST_DEVICE RAJA_INLINE key_type pack(T value, uint32_t loc)
+  {
+    return (static_cast<key_type>(detail::orderable_bits(value)) << 32) | loc;
+  }
+
+  static RAJA_HOST_DEVICE RAJA_INLINE T value(key_type key)
+  {
+    return detail::from_orderable_bits<T>::get(static_cast<uint32_t>(key >> 32));
+  }
+
+  static RAJA_HOST_DEVICE RAJA_INLINE uint32_t loc(key_type key)
+  {
+    return static_cast<uint32_t>(key);
+  }
+};
+
+template <typename T>
+struct PackedMaxLoc {
+  static_assert(sizeof(T) == sizeof(uint32_t),
+                "PackedMaxLoc requires a 32-bit value type");
+
+  using key_type = uint64_t;
+
+  //! key that loses to every packed key; use as the reducer's initial value
+  static RAJA_HOST_DEVICE RAJA_INLINE key_type identity() { return key_type(0); }
+
+  //! encode value and location; larger key means larger value, and the
+  //  location is stored inverted so among equal values the smaller
+  //  location produces the larger key
+  static RAJA_HOST_DEVICE RAJA_INLINE key_type pack(T value, uint32_t loc)
+  {
+    return (static_cast<key_type>(detail::orderable_bits(value)) << 32) |
+           static_cast<uint32_t>(~loc);
+  }
+
+  static RAJA_HOST_DEVICE RAJA_INLINE T value(key_type key)
+  {
+    return detail::from_orderable_bits<T>::get(static_cast<uint32_t>(key >> 32));
+  }
+
+  static RAJA_HOST_DEVICE RAJA_INLINE uint32_t loc(key_type key)
+  {
+    return ~static_cast<uint32_t>(key);
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -229,6 +229,84 @@ struct InversePermutationHelper<camp::idx_seq<Range...>,
 
 
 
+//
+// Compile-time enumeration of every permutation of 0..N-1, built by
+// inserting each index at every position of the permutations of the
+// remaining indices. Grows as N!, so intended for the loop-nest depths
+// the named PERM_ aliases above cover.
+//
+
+template <typename L1, typename L2>
+struct ListAppend;
+
+template <typename... A, typename... B>
+struct ListAppend<camp::list<A...>, camp::list<B...>> {
+  using type = camp::list<A..., B...>;
+};
+
+template <camp::idx_t H, typename Seq>
+struct PrependIdx;
+
+template <camp::idx_t H, camp::idx_t... Is>
+struct PrependIdx<H, camp::idx_seq<Is...>> {
+  using type = camp::idx_seq<H, Is...>;
+};
+
+//! list of the sequences formed by inserting I at each position of Seq
+template <camp::idx_t I, typename Seq>
+struct InsertEverywhere;
+
+template <camp::idx_t I>
+struct InsertEverywhere<I, camp::idx_seq<>> {
+  using type = camp::list<camp::idx_seq<I>>;
+};
+
+template <camp::idx_t I, camp::idx_t H, camp::idx_t... T>
+struct InsertEverywhere<I, camp::idx_seq<H, T...>> {
+  using rest = typename InsertEverywhere<I, camp::idx_seq<T...>>::type;
+
+  template <typename L>
+  struct prepend_each;
+
+  template <typename... Seqs>
+  struct prepend_each<camp::list<Seqs...>> {
+    using type = camp::list<typename PrependIdx<H, Seqs>::type...>;
+  };
+
+  using type =
+      typename ListAppend<camp::list<camp::idx_seq<I, H, T...>>,
+                          typename prepend_each<rest>::type>::type;
+};
+
+template <camp::idx_t I, typename SeqList>
+struct InsertIntoEach;
+
+template <camp::idx_t I>
+struct InsertIntoEach<I, camp::list<>> {
+  using type = camp::list<>;
+};
+
+template <camp::idx_t I, typename S0, typename... SRest>
+struct InsertIntoEach<I, camp::list<S0, SRest...>> {
+  using type = typename ListAppend<
+      typename InsertEverywhere<I, S0>::type,
+      typename InsertIntoEach<I, camp::list<SRest...>>::type>::type;
+};
+
+template <typename Seq>
+struct PermutationsOfSeq;
+
+template <>
+struct PermutationsOfSeq<camp::idx_seq<>> {
+  using type = camp::list<camp::idx_seq<>>;
+};
+
+template <camp::idx_t H, camp::idx_t... T>
+struct PermutationsOfSeq<camp::idx_seq<H, T...>> {
+  using rest_perms = typename PermutationsOfSeq<camp::idx_seq<T...>>::type;
+  using type = typename InsertIntoEach<H, rest_perms>::type;
+};
+
 } // namespace internal
 
 
@@ -239,6 +317,15 @@ struct InversePermutationHelper<camp::idx_seq<Range...>,
 template<typename Perm>
 using invert_permutation = typename internal::InversePermutationHelper<camp::make_idx_seq_t<camp::size<Perm>::value>, Perm>::type;
 
+/*!
+  camp::list of every permutation of 0..N-1 (N! entries), in the order
+  produced by inserting each index into the permutations of its
+  successors; the identity permutation is first
+*/
+template <size_t N>
+using all_permutations =
+    typename internal::PermutationsOfSeq<camp::make_idx_seq_t<N>>::type;
+
 }  // namespace RAJA
 
 #endif /* RAJA_FORALLN_PERMUTATIONS_HPP */
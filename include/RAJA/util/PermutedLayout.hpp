@@ -97,6 +97,34 @@ using Perm = camp::idx_seq<Ints...>;
 template <camp::idx_t N>
 using MakePerm = typename camp::make_idx_seq<N>::type;
 
+/*!
+ * @brief Creates a permuted Layout object from a compile-time permutation,
+ *        statically annotating the stride-1 dimension.
+ *
+ * When the permutation is known at compile time (the common case, via the
+ * PERM_... aliases), the last entry of the permutation names the stride-1
+ * dimension. This overload records that dimension in the returned layout
+ * type so indexing along it compiles to a plain add rather than a multiply
+ * by a runtime stride of one:
+ *
+ *     // J is stride-1; the layout type carries that annotation
+ *     auto layout = make_permuted_layout({{5, 7}}, PERM_IJ{});
+ *
+ * Sizes and strides remain runtime values as with the std::array overload.
+ */
+template <typename IdxLin = Index_type, camp::idx_t... Ints>
+auto make_permuted_layout(std::array<IdxLin, sizeof...(Ints)> sizes,
+                          Perm<Ints...>)
+    -> Layout<sizeof...(Ints),
+              IdxLin,
+              camp::seq_at<sizeof...(Ints) - 1, Perm<Ints...>>::value>
+{
+  return Layout<sizeof...(Ints),
+                IdxLin,
+                camp::seq_at<sizeof...(Ints) - 1, Perm<Ints...>>::value>(
+      make_permuted_layout(sizes, as_array<Perm<Ints...>>::get()));
+}
+
 }  // namespace RAJA
 
 #endif
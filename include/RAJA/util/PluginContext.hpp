@@ -8,6 +8,8 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <cstddef>
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
@@ -35,6 +37,20 @@ PluginContext make_context()
   return PluginContext{detail::get_platform<Policy>::value};
 }
 
+/*!
+ * Describes a host buffer that takes part in host<->device transfers,
+ * passed to plugins through the registerBuffer hook.
+ *
+ * The name identifies the call site and is used as the aggregation key
+ * by plugins that collect per-site statistics, so it should be a string
+ * literal or other pointer that outlives the registration.
+ */
+struct TransferBufferInfo {
+  const void* ptr;
+  std::size_t size;
+  const char* name;
+};
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
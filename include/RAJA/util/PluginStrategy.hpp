@@ -8,6 +8,9 @@
 #ifndef RAJA_PluginStrategy_HPP
 #define RAJA_PluginStrategy_HPP
 
+#include <cstddef>
+#include <vector>
+
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
 #include "RAJA/util/Registry.hpp"
@@ -32,11 +35,87 @@ class PluginStrategy
 
     virtual void postLaunch(const PluginContext& p);
 
+    //! Whether this plugin opts into per-batch launch notification:
+    //  batched plugins receive preLaunchBatch/postLaunchBatch at batch
+    //  scopes (WorkGroup runs, region scopes, LaunchBatchScope) and
+    //  are skipped by the per-launch preLaunch/postLaunch dispatch.
+    //  Queried once at registration; the answer must not change.
+    virtual bool usesBatchedNotification();
+
+    //! Called at the start of a launch batch; num_launches is the
+    //  number of grouped launches when the scope knows it, 0 when the
+    //  scope is open-ended (a region body).
+    virtual void preLaunchBatch(const PluginContext& p, size_t num_launches);
+
+    //! Called at the end of a launch batch.
+    virtual void postLaunchBatch(const PluginContext& p, size_t num_launches);
+
+    virtual void registerBuffer(const TransferBufferInfo& info);
+
     virtual void finalize();
 };
 
 using PluginRegistry = Registry<PluginStrategy>;
 
+//! One plugin's slice of the flat dispatch table: the plugin instance
+//  and statically bound thunks for the hooks on the launch hot path.
+//  Each thunk calls the registered concrete type's member directly,
+//  with no vtable load, and the table is contiguous, so the per-launch
+//  dispatch loop is an array sweep of direct calls instead of a
+//  linked-list walk of virtual calls through shared_ptr handles.
+struct PluginDispatch {
+  using context_fn = void (*)(PluginStrategy*, const PluginContext&);
+  using batch_fn = void (*)(PluginStrategy*, const PluginContext&, size_t);
+
+  PluginStrategy* plugin;
+  context_fn preCapture;
+  context_fn postCapture;
+  context_fn preLaunch;
+  context_fn postLaunch;
+  batch_fn preLaunchBatch;
+  batch_fn postLaunchBatch;
+  bool batched;
+};
+
+//! The flat dispatch table, in registration order. Function-local
+//  static storage in the library, so filling it during static
+//  initialization of the registration objects is ordered safely.
+std::vector<PluginDispatch>& plugin_dispatch();
+
+//! Build a concrete plugin type's dispatch entry at registration: the
+//  registry's registration constructor is the one place the concrete
+//  type is known, so the thunks it creates here bind statically.
+template <typename V>
+struct RegistryDispatch<PluginStrategy, V> {
+  static void add(V* plugin)
+  {
+    PluginDispatch dispatch;
+    dispatch.plugin = plugin;
+    dispatch.preCapture = [](PluginStrategy* s, const PluginContext& p) {
+      static_cast<V*>(s)->V::preCapture(p);
+    };
+    dispatch.postCapture = [](PluginStrategy* s, const PluginContext& p) {
+      static_cast<V*>(s)->V::postCapture(p);
+    };
+    dispatch.preLaunch = [](PluginStrategy* s, const PluginContext& p) {
+      static_cast<V*>(s)->V::preLaunch(p);
+    };
+    dispatch.postLaunch = [](PluginStrategy* s, const PluginContext& p) {
+      static_cast<V*>(s)->V::postLaunch(p);
+    };
+    dispatch.preLaunchBatch =
+        [](PluginStrategy* s, const PluginContext& p, size_t n) {
+          static_cast<V*>(s)->V::preLaunchBatch(p, n);
+        };
+    dispatch.postLaunchBatch =
+        [](PluginStrategy* s, const PluginContext& p, size_t n) {
+          static_cast<V*>(s)->V::postLaunchBatch(p, n);
+        };
+    dispatch.batched = plugin->usesBatchedNotification();
+    plugin_dispatch().push_back(dispatch);
+  }
+};
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ProfilingPlugin_HPP
+#define RAJA_ProfilingPlugin_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_PROFILING_PLUGIN)
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * Plugin that aggregates launch counts and wall times for every RAJA
+ * kernel launch, bucketed by the launch platform from PluginContext.
+ *
+ * The plugin times each launch with the Timer classes from
+ * util/Timer.hpp. On device platforms the device is synchronized before
+ * the timer stops so the measurement covers kernel execution rather
+ * than just the asynchronous launch; set the environment variable
+ * RAJA_PROFILE_NOSYNC to measure launch overhead instead. A summary
+ * with launch counts and min/avg/max times is written to stderr by
+ * finalize_plugins().
+ *
+ * The plugin is only compiled and registered when RAJA is configured
+ * with RAJA_ENABLE_PROFILING_PLUGIN, so production builds pay nothing
+ * for it.
+ */
+class ProfilingPlugin : public PluginStrategy
+{
+  public:
+    struct LaunchStats {
+      unsigned long num_launches = 0;
+      double total_time = 0.0;
+      double min_time = 0.0;
+      double max_time = 0.0;
+    };
+
+    void preLaunch(const PluginContext& p) override;
+
+    void postLaunch(const PluginContext& p) override;
+
+    void finalize() override;
+
+    //! Aggregated stats for launches on one platform
+    static LaunchStats getStats(Platform platform);
+
+    //! Clear all aggregated stats
+    static void resetStats();
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif  // closing endif for RAJA_ENABLE_PROFILING_PLUGIN
+
+#endif
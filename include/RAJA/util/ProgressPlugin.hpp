@@ -0,0 +1,138 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ProgressPlugin_HPP
+#define RAJA_ProgressPlugin_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_PROGRESS_PLUGIN)
+
+#include <cstdio>
+#include <string>
+
+#include "RAJA/pattern/atomic.hpp"
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * Lightweight handle a loop body captures to report chunk completions.
+ * The handle is a single pointer into the counter's host-visible slab,
+ * so capturing it into a device lambda copies no other state. tick()
+ * may be called concurrently from any thread or device block.
+ */
+struct ProgressTicker {
+  unsigned long long* slab = nullptr;
+
+  RAJA_HOST_DEVICE void tick() const
+  {
+    if (slab) {
+      RAJA::atomicAdd<RAJA::auto_atomic>(slab, 1ull);
+    }
+  }
+};
+
+/*!
+ * Chunk-completion counter for one long-running kernel. The counter's
+ * slab lives in host-visible memory (pinned mapped memory when a device
+ * back-end is enabled), so the host can poll completed() while the
+ * kernel is still running and a watchdog can distinguish a slow kernel,
+ * whose count keeps rising, from a wedged one, whose count has stopped.
+ *
+ * Counters register themselves with the progress plugin on construction
+ * so ProgressPlugin::writeReport() covers every live counter; typical
+ * use keeps one counter per instrumented call site for the life of the
+ * run and resets it before each launch.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   static RAJA::util::ProgressCounter progress("pack", num_chunks);
+   progress.reset();
+
+   auto ticker = progress.ticker();
+   RAJA::forall<exec_policy>(chunks, [=] RAJA_DEVICE (Index_type c) {
+     ... // process chunk c
+     ticker.tick();
+   });
+
+ * \endverbatim
+ */
+class ProgressCounter
+{
+  public:
+    ProgressCounter(const char* name, unsigned long long num_chunks);
+    ~ProgressCounter();
+
+    ProgressCounter(ProgressCounter const&) = delete;
+    ProgressCounter& operator=(ProgressCounter const&) = delete;
+
+    //! Handle to capture in the instrumented loop body
+    ProgressTicker ticker() const { return ProgressTicker{m_slab}; }
+
+    //! Chunks completed so far; safe to call while the kernel runs
+    unsigned long long completed() const;
+
+    unsigned long long total() const { return m_total; }
+
+    const std::string& name() const { return m_name; }
+
+    //! Zero the count before re-running the instrumented kernel
+    void reset();
+
+  private:
+    std::string m_name;
+    unsigned long long m_total;
+    unsigned long long* m_slab;
+};
+
+/*!
+ * Plugin that tracks kernel launches in flight so an external watchdog
+ * can poll for progress. preLaunch/postLaunch record when each launch
+ * starts and completes; poll() reports how many launches have started
+ * and completed and how long the oldest still-running launch has been
+ * executing, and writeReport() additionally prints the state of every
+ * live ProgressCounter. Both are safe to call from a watchdog thread
+ * while kernels run.
+ *
+ * The plugin is only compiled and registered when RAJA is configured
+ * with RAJA_ENABLE_PROGRESS_PLUGIN, so production builds pay nothing
+ * for it.
+ */
+class ProgressPlugin : public PluginStrategy
+{
+  public:
+    struct Snapshot {
+      unsigned long launches_started = 0;
+      unsigned long launches_completed = 0;
+      double oldest_running_seconds = 0.0;
+    };
+
+    void preLaunch(const PluginContext& p) override;
+
+    void postLaunch(const PluginContext& p) override;
+
+    //! Launch progress snapshot for an external watchdog
+    static Snapshot poll();
+
+    //! Write launch progress and every live counter's state to a stream
+    static void writeReport(FILE* to);
+
+    //! Clear the launch counts
+    static void resetLaunchCounts();
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif  // closing endif for RAJA_ENABLE_PROGRESS_PLUGIN
+
+#endif
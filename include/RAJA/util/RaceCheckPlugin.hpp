@@ -0,0 +1,183 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_RaceCheckPlugin_HPP
+#define RAJA_RaceCheckPlugin_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_RACE_CHECK_PLUGIN)
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/PluginStrategy.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA {
+namespace util {
+
+namespace race_check {
+
+//! Granularity of write tracking. One shadow slot covers one cache
+//  line of the checked array, so the shadow is ~1.6% the size of the
+//  data it watches and a write costs one atomic operation on its line
+//  rather than one per element.
+constexpr size_t shadow_line_bytes = 64;
+
+//! Shadow state for one checked view: a signature slot per cache line
+//  of the underlying array plus conflict accounting. Owned by the
+//  registry in the plugin translation unit.
+struct ShadowRecord {
+  std::string name;
+  const char* base;
+  size_t num_bytes;
+  size_t num_lines;
+  std::atomic<unsigned>* lines;
+  std::atomic<unsigned long> num_conflicts;
+  std::atomic<size_t> first_conflict_line;
+};
+
+//! Signature of the executing worker thread, assigned on first use.
+//  Nonzero, so zero can mean "line untouched this launch".
+RAJA_INLINE unsigned current_signature()
+{
+  static std::atomic<unsigned> next_signature{1};
+  static thread_local unsigned signature =
+      next_signature.fetch_add(1, std::memory_order_relaxed);
+  return signature;
+}
+
+//! Register a shadow for num_bytes of data at base; called once per
+//  checked view by make_race_check_view.
+ShadowRecord* register_shadow(const std::string& name,
+                              const void* base,
+                              size_t num_bytes);
+
+//! Record one write through a checked view. The first writer of a
+//  cache line in a launch window claims its slot; a later writer with
+//  a different signature is a cross-iteration overlap at line
+//  granularity. Reads of a slot already carrying this thread's
+//  signature, the steady state of a well-blocked loop, cost one
+//  relaxed atomic load.
+RAJA_INLINE void record_write(ShadowRecord* shadow, const void* addr)
+{
+  size_t offset = static_cast<size_t>(
+      static_cast<const char*>(addr) - shadow->base);
+  if (offset >= shadow->num_bytes) {
+    return;
+  }
+  size_t line = offset / shadow_line_bytes;
+
+  unsigned signature = current_signature();
+  unsigned seen = shadow->lines[line].load(std::memory_order_relaxed);
+  if (seen == signature) {
+    return;
+  }
+  if (seen == 0 &&
+      shadow->lines[line].compare_exchange_strong(
+          seen, signature, std::memory_order_relaxed)) {
+    return;
+  }
+  if (seen != signature) {
+    shadow->num_conflicts.fetch_add(1, std::memory_order_relaxed);
+    size_t expected = ~size_t(0);
+    shadow->first_conflict_line.compare_exchange_strong(
+        expected, line, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace race_check
+
+/*!
+ * View wrapper that records every access into the shadow bitmap of its
+ * registered base array. Wrap the views a kernel writes with
+ * make_race_check_view; the race-check plugin clears the shadows
+ * before each launch and reports overlaps after it, so iterations of
+ * one launch that touch the same cache line from different workers are
+ * flagged without a sanitizer rebuild.
+ *
+ * Detection is a smoke test, not a proof: overlaps only show when the
+ * colliding iterations land on different workers in this run, and line
+ * granularity folds false sharing into the signal. Host platforms
+ * only.
+ */
+template <typename ViewType>
+struct RaceCheckView {
+  ViewType base;
+  race_check::ShadowRecord* shadow;
+
+  template <typename... Args>
+  RAJA_INLINE auto operator()(Args... args) const
+      -> decltype(base(args...))
+  {
+    auto& ref = base(args...);
+    race_check::record_write(shadow, &ref);
+    return ref;
+  }
+};
+
+/*!
+ * Wrap a RAJA::View for conflict detection, registering a shadow
+ * bitmap covering its data. The name labels reports and queries.
+ */
+template <typename ViewType>
+RAJA_INLINE RaceCheckView<camp::decay<ViewType>> make_race_check_view(
+    const std::string& name, ViewType&& view)
+{
+  using view_t = camp::decay<ViewType>;
+  size_t num_bytes =
+      view.layout.size() * sizeof(typename view_t::value_type);
+  return RaceCheckView<view_t>{
+      std::forward<ViewType>(view),
+      race_check::register_shadow(name, view.data, num_bytes)};
+}
+
+/*!
+ * Plugin that scopes conflict detection to single launches: preLaunch
+ * clears every registered shadow, postLaunch reports views whose
+ * shadows saw writes from more than one worker signature. Reports go
+ * to stderr once per view per launch; getConflicts() is the
+ * programmatic surface for test harnesses.
+ *
+ * The plugin is only compiled and registered when RAJA is configured
+ * with RAJA_ENABLE_RACE_CHECK_PLUGIN, so production builds pay nothing
+ * for it.
+ */
+class RaceCheckPlugin : public PluginStrategy
+{
+  public:
+    struct Conflict {
+      std::string name;
+      unsigned long num_conflicts;
+      size_t first_conflict_offset;  //!< byte offset of first overlap
+    };
+
+    void preLaunch(const PluginContext& p) override;
+
+    void postLaunch(const PluginContext& p) override;
+
+    void finalize() override;
+
+    //! Conflicts observed in the most recently completed launch
+    static std::vector<Conflict> getConflicts();
+
+    //! Drop all registered shadows and recorded conflicts; checked
+    //  views made before the reset must not be used afterwards
+    static void resetShadows();
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif  // closing endif for RAJA_ENABLE_RACE_CHECK_PLUGIN
+
+#endif
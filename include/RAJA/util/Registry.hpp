@@ -13,6 +13,15 @@
 namespace RAJA {
 namespace util {
 
+  /// Customization point invoked when a concrete type V is registered
+  /// in a Registry<T>. A registry may specialize this on T to record
+  /// statically bound dispatch information for V at registration time;
+  /// the default records nothing.
+  template <typename T, typename V>
+  struct RegistryDispatch {
+    static void add(V*) {}
+  };
+
   template <typename T>
   class RegistryEntry {
     std::string Name, Desc;
@@ -101,6 +110,7 @@ namespace util {
       add(const std::string& Name, const std::string& Desc)
           : Entry(Name, Desc, CtorFn), Node(Entry) {
         add_node(&Node);
+        RegistryDispatch<T, V>::add(static_cast<V*>(Entry.get().get()));
       }
     };
   };
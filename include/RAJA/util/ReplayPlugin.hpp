@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ReplayPlugin_HPP
+#define RAJA_ReplayPlugin_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_REPLAY_PLUGIN)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+namespace replay {
+
+/*!
+ * Set the call-site label attributed to subsequent kernel launches on
+ * the calling thread, or nullptr to return to unattributed. The pointer
+ * must stay valid until finalize_plugins(); string literals are the
+ * intended use.
+ */
+void setCallSite(const char* name);
+
+/*!
+ * RAII form of setCallSite for labeling one region of launches:
+ *
+ *   {
+ *     RAJA::util::replay::CallSite cs("pressure_update");
+ *     RAJA::forall<...>(...);
+ *   }
+ */
+struct CallSite {
+  explicit CallSite(const char* name);
+  ~CallSite();
+};
+
+/*!
+ * Record the iteration extent of the next launch on the calling thread;
+ * call once per dimension for nested loops. The pending extents are
+ * consumed by the next launch and do not carry over.
+ */
+void describeSegment(long begin, long end);
+
+/*!
+ * Register an input array so a capture snapshots its contents. The
+ * pointer must be host-readable and stay valid while registered; pass
+ * the pointer returned by View::data() for RAJA Views. Registration is
+ * global, not per call site, so register once after allocation and
+ * deregister before freeing.
+ */
+void registerArray(const char* name,
+                   const void* ptr,
+                   std::size_t elem_size,
+                   std::size_t num_elems);
+
+//! typed convenience form of registerArray
+template <typename T>
+void registerArray(const char* name, const T* ptr, std::size_t num_elems)
+{
+  registerArray(name, ptr, sizeof(T), num_elems);
+}
+
+//! remove a previously registered array; a no-op for unknown pointers
+void deregisterArray(const void* ptr);
+
+//! one snapshotted array in a capture record
+struct ArraySnapshot {
+  std::string name;
+  std::size_t elem_size = 0;
+  std::size_t num_elems = 0;
+  std::vector<unsigned char> data;
+};
+
+/*!
+ * A capture record read back for replay. The kernel body itself cannot
+ * be serialized, so a replay driver is a small program containing the
+ * same RAJA call that loads the record, copies each snapshot into its
+ * arrays, and launches over the recorded extents:
+ *
+ *   RAJA::util::replay::Record rec;
+ *   rec.load("raja_replay.bin");
+ *   std::memcpy(x, rec.find("x")->data.data(), rec.find("x")->data.size());
+ *   RAJA::forall<policy>(RAJA::RangeSegment(rec.segments[0].begin,
+ *                                           rec.segments[0].end), body);
+ */
+struct Record {
+  struct Extent {
+    long begin = 0;
+    long end = 0;
+  };
+
+  std::string call_site;
+  Platform platform = Platform::undefined;
+  std::vector<Extent> segments;
+  std::vector<ArraySnapshot> snapshots;
+
+  //! read a record written by the plugin; returns false on any error
+  bool load(const char* path);
+
+  //! look up a snapshot by registered name, or nullptr if absent
+  const ArraySnapshot* find(const char* name) const;
+};
+
+} // closing brace for replay namespace
+
+/*!
+ * Plugin that captures one kernel launch for deterministic off-line
+ * replay: the call-site label, platform, iteration extents described
+ * with replay::describeSegment, and a byte snapshot of every array
+ * registered with replay::registerArray are written to a binary file
+ * just before the selected launch runs, so the snapshot reflects the
+ * kernel's production inputs.
+ *
+ * The capture is armed with environment variables: RAJA_REPLAY_CAPTURE
+ * names the call site to capture, RAJA_REPLAY_INDEX selects which
+ * launch at that site (default 0, the first), and RAJA_REPLAY_FILE
+ * names the output file (default "raja_replay.bin"). A replay driver
+ * loads the file with replay::Record and re-executes just that kernel
+ * under a profiler; see the Record documentation for the pattern.
+ *
+ * Device-memory arrays must be registered through a host-readable
+ * mirror, since snapshots are plain host reads. The plugin is only
+ * compiled and registered when RAJA is configured with
+ * RAJA_ENABLE_REPLAY_PLUGIN, so production builds pay nothing for it.
+ */
+class ReplayPlugin : public PluginStrategy
+{
+  public:
+    void init(const PluginOptions& p) override;
+
+    void preLaunch(const PluginContext& p) override;
+
+    void postLaunch(const PluginContext& p) override;
+
+    void finalize() override;
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif  // closing endif for RAJA_ENABLE_REPLAY_PLUGIN
+
+#endif
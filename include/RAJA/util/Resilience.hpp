@@ -0,0 +1,224 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing forall-granularity fault recovery on top
+ *          of the RAJA fault tolerance macros.
+ *
+ *          The RAJA_FT_BEGIN/RAJA_FT_END macros re-execute a loop when the
+ *          external signal handler reports a transient fault, which is only
+ *          safe when the loop body is idempotent. The utilities here extend
+ *          recovery to non-idempotent loops: the caller names the views a
+ *          loop writes, an in-memory snapshot of each is taken before the
+ *          first execution, and the snapshots are restored before every
+ *          re-execution. A transient fault then costs one loop re-execution
+ *          instead of a job restart.
+ *
+ *          Like the macros, this layer cooperates with an external signal
+ *          handler that sets the global variable fault_type when a fault
+ *          occurs; fault_type must be initialized to zero. The fault check
+ *          runs after forall returns, so asynchronous execution policies
+ *          must not be used here, and snapshotted views must reference
+ *          host-accessible memory.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Resilience_HPP
+#define RAJA_Resilience_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/camp_aliases.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace ft
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Annotation passed to resilient_forall for loop bodies that are
+ *        idempotent, meaning re-execution from faulted state produces the
+ *        same result. Idempotent loops are retried without taking or
+ *        restoring snapshots.
+ *
+ ******************************************************************************
+ */
+struct idempotent {
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief In-memory snapshot of the data referenced by a View.
+ *
+ *        The constructor copies the full extent of the view's data into an
+ *        internal buffer; restore() copies the saved image back. The view's
+ *        data pointer must remain valid and host-accessible for the lifetime
+ *        of the snapshot.
+ *
+ ******************************************************************************
+ */
+template <typename ViewType>
+class ViewSnapshot
+{
+public:
+  using view_type = ViewType;
+  using value_type = typename ViewType::nc_value_type;
+
+  explicit ViewSnapshot(ViewType const& view)
+      : m_data(view.data),
+        m_size(static_cast<size_t>(stripIndexType(view.layout.size()))),
+        m_saved(m_data, m_data + m_size)
+  {
+  }
+
+  //! Copy the saved image back over the view's data.
+  void restore() const { std::copy(m_saved.begin(), m_saved.end(), m_data); }
+
+  //! Number of elements saved.
+  size_t size() const { return m_size; }
+
+private:
+  value_type* m_data;
+  size_t m_size;
+  std::vector<value_type> m_saved;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Create a snapshot of the given view.
+ *
+ ******************************************************************************
+ */
+template <typename ViewType>
+RAJA_INLINE ViewSnapshot<camp::decay<ViewType>> make_snapshot(
+    ViewType const& view)
+{
+  return ViewSnapshot<camp::decay<ViewType>>(view);
+}
+
+namespace detail
+{
+
+template <typename TupleType, camp::idx_t... Is>
+RAJA_INLINE void restore_all(TupleType const& snapshots, camp::idx_seq<Is...>)
+{
+  camp::sink((camp::get<Is>(snapshots).restore(), 0)...);
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Execute a forall over an idempotent loop body, re-executing the
+ *        loop when the signal handler reports a transient fault.
+ *
+ *        No snapshots are taken; the idempotent annotation is the caller's
+ *        assertion that plain re-execution is safe.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Container,
+          typename LoopBody>
+RAJA_INLINE void resilient_forall(Container&& c, idempotent, LoopBody&& body)
+{
+#if defined(RAJA_ENABLE_FT)
+  extern volatile int fault_type;
+  bool repeat;
+  if (fault_type == 0) {
+    do {
+      repeat = false;
+      RAJA::forall<ExecutionPolicy>(c, body);
+      if (fault_type > 0) {
+        repeat = true;
+        fault_type = 0;
+      }
+    } while (repeat);
+  } else {
+    // fault arrived outside a resilient region; nothing to roll back
+    fault_type = 0;
+  }
+#else
+  RAJA::forall<ExecutionPolicy>(std::forward<Container>(c),
+                                std::forward<LoopBody>(body));
+#endif
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Execute a forall over a non-idempotent loop body, naming the views
+ *        the loop writes.
+ *
+ *        Snapshots of the written views are taken before the first
+ *        execution and restored before each re-execution, so a transient
+ *        fault mid-loop cannot leave partially updated data visible to the
+ *        retry. Read-only views need not be listed.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Container,
+          typename LoopBody,
+          typename... ViewTypes>
+RAJA_INLINE void resilient_forall(Container&& c,
+                                  LoopBody&& body,
+                                  ViewTypes const&... written_views)
+{
+#if defined(RAJA_ENABLE_FT)
+  extern volatile int fault_type;
+  bool repeat;
+  if (fault_type == 0) {
+    auto snapshots = camp::make_tuple(
+        ViewSnapshot<camp::decay<ViewTypes>>(written_views)...);
+    do {
+      repeat = false;
+      RAJA::forall<ExecutionPolicy>(c, body);
+      if (fault_type > 0) {
+        detail::restore_all(snapshots,
+                            camp::make_idx_seq_t<sizeof...(ViewTypes)>{});
+        repeat = true;
+        fault_type = 0;
+      }
+    } while (repeat);
+  } else {
+    // fault arrived outside a resilient region; nothing to roll back
+    fault_type = 0;
+  }
+#else
+  camp::sink(written_views...);
+  RAJA::forall<ExecutionPolicy>(std::forward<Container>(c),
+                                std::forward<LoopBody>(body));
+#endif
+}
+
+}  // namespace ft
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
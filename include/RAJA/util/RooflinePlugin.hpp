@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_RooflinePlugin_HPP
+#define RAJA_RooflinePlugin_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_ROOFLINE_PLUGIN)
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+namespace roofline {
+
+/*!
+ * Set the call-site label attributed to subsequent kernel launches on
+ * the calling thread, or nullptr to return to unattributed. The pointer
+ * must stay valid until finalize_plugins(); string literals are the
+ * intended use.
+ */
+void setCallSite(const char* name);
+
+/*!
+ * RAII form of setCallSite for labeling one region of launches:
+ *
+ *   {
+ *     RAJA::util::roofline::CallSite cs("pressure_update");
+ *     RAJA::forall<...>(...);
+ *   }
+ */
+struct CallSite {
+  explicit CallSite(const char* name);
+  ~CallSite();
+};
+
+} // closing brace for roofline namespace
+
+/*!
+ * Plugin that reads PAPI hardware counters around each kernel launch
+ * and aggregates achieved FLOP rate and memory bandwidth per call site,
+ * for placing loops on a roofline without an external profiler.
+ *
+ * Call sites are labeled with roofline::CallSite; launches outside any
+ * labeled region are pooled under "<unattributed>". Floating-point work
+ * comes from the PAPI_DP_OPS event (PAPI_FP_OPS when unavailable) and
+ * traffic is estimated as last-level cache misses times the line size,
+ * so both are host-side measurements: launches on device platforms are
+ * counted and timed but get no counter attribution. Counters are read
+ * on the launching thread only, which undercounts OpenMP worker
+ * threads; treat parallel-region numbers as per-thread.
+ *
+ * finalize_plugins() writes a per-call-site summary to stderr. When the
+ * environment variables RAJA_ROOFLINE_PEAK_GFLOPS and
+ * RAJA_ROOFLINE_PEAK_GBPS hold the machine peaks, each line also
+ * reports the achieved fraction of peak.
+ *
+ * The plugin is only compiled and registered when RAJA is configured
+ * with RAJA_ENABLE_ROOFLINE_PLUGIN (which requires PAPI), so production
+ * builds pay nothing for it.
+ */
+class RooflinePlugin : public PluginStrategy
+{
+  public:
+    void init(const PluginOptions& p) override;
+
+    void preLaunch(const PluginContext& p) override;
+
+    void postLaunch(const PluginContext& p) override;
+
+    void finalize() override;
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif  // closing endif for RAJA_ENABLE_ROOFLINE_PLUGIN
+
+#endif
@@ -0,0 +1,65 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for RAJA scan context definitions.
+ *
+ *          A scan context retains the temporary workspace a scan
+ *          implementation needs between calls, so pipelines that scan
+ *          many ranges of varying length size the workspace once for
+ *          the largest range and pay no allocation or size query for
+ *          the rest.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ScanContext_HPP
+#define RAJA_util_ScanContext_HPP
+
+#include <type_traits>
+
+namespace RAJA
+{
+
+//! Base class identifying scan context types to the context-taking scan
+//  overloads in pattern/scan.hpp; back-end workspace classes derive from
+//  it (see cuda::ScanWorkspace)
+struct ScanContextBase {
+};
+
+//! Scan context for back-ends whose scans retain no temporary storage;
+//  the CPU scan implementations ignore it
+struct HostScanContext : ScanContextBase {
+  //! nothing is retained, so there is nothing to free
+  void release() {}
+};
+
+//! Map an execution policy to the scan context type retaining its
+//  workspace; back-ends with device workspaces specialize this (see
+//  policy/cuda/scan.hpp), all others need no storage
+template <typename ExecPolicy>
+struct get_scan_context {
+  using type = HostScanContext;
+};
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_scan_context
+    : std::is_base_of<::RAJA::ScanContextBase, typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -20,6 +20,14 @@
 
 #include "RAJA/config.hpp"
 
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/Operators.hpp"
+
 // for RAJA::reduce::detail::ValueLoc
 #include "RAJA/pattern/detail/reduce.hpp"
 
@@ -123,8 +131,225 @@ private:
   second_type* mem_idx = nullptr;
 };
 
+/*!
+ * @brief Specialization for camp::tuple records; each member of the tuple
+ *        gets its own DATA_ALIGN-aligned array, so member streams stay
+ *        unit stride and vectorizable.
+ */
+template <typename... Members, typename mempool>
+class SoAPtr<camp::tuple<Members...>, mempool>
+{
+  using value_type = camp::tuple<Members...>;
+
+  template <camp::idx_t I>
+  using member_type = camp::at_v<camp::list<Members...>, I>;
+
+public:
+  static constexpr size_t num_members = sizeof...(Members);
+
+  SoAPtr() = default;
+  explicit SoAPtr(size_t size) { allocate(size); }
+
+  SoAPtr& allocate(size_t size)
+  {
+    allocate_members(size, camp::make_idx_seq_t<num_members>{});
+    return *this;
+  }
+
+  SoAPtr& deallocate()
+  {
+    deallocate_members(camp::make_idx_seq_t<num_members>{});
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE bool allocated() const
+  {
+    return camp::get<0>(mem) != nullptr;
+  }
+
+  RAJA_HOST_DEVICE value_type get(size_t i) const
+  {
+    return get_members(i, camp::make_idx_seq_t<num_members>{});
+  }
+  RAJA_HOST_DEVICE void set(size_t i, value_type val)
+  {
+    set_members(i, val, camp::make_idx_seq_t<num_members>{});
+  }
+
+  //! contiguous stream of member I, suitable for SIMD traversal
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE member_type<I>* member_data() const
+  {
+    return camp::get<I>(mem);
+  }
+
+  //! reference to member I of record i
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE member_type<I>& member(size_t i) const
+  {
+    return camp::get<I>(mem)[i];
+  }
+
+private:
+  camp::tuple<Members*...> mem =
+      camp::tuple<Members*...>{static_cast<Members*>(nullptr)...};
+
+  template <camp::idx_t... Is>
+  void allocate_members(size_t size, camp::idx_seq<Is...>)
+  {
+    camp::sink((camp::get<Is>(mem) =
+        mempool::getInstance().template malloc<member_type<Is>>(
+            size, static_cast<size_t>(DATA_ALIGN)))...);
+  }
+
+  template <camp::idx_t... Is>
+  void deallocate_members(camp::idx_seq<Is...>)
+  {
+    camp::sink((mempool::getInstance().free(camp::get<Is>(mem)),
+                camp::get<Is>(mem) = nullptr)...);
+  }
+
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE value_type get_members(size_t i, camp::idx_seq<Is...>) const
+  {
+    return value_type(camp::get<Is>(mem)[i]...);
+  }
+
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE void set_members(size_t i, value_type const& val,
+                                    camp::idx_seq<Is...>)
+  {
+    camp::sink((camp::get<Is>(mem)[i] = camp::get<Is>(val))...);
+  }
+};
+
 }  // namespace detail
 
+
+/*!
+ * @brief Struct-of-arrays container over a record type described as a
+ *        camp::tuple, giving AoS-style element syntax over SoA storage.
+ *
+ * Each member of the record is stored in its own DATA_ALIGN-aligned array
+ * allocated from the given mempool, so loops that touch one member stream
+ * through contiguous, vectorizable memory while element access keeps
+ * whole-record syntax:
+ *
+ *   using Particle = camp::tuple<double, double, int>;
+ *   RAJA::SoAArray<Particle> particles(N);
+ *   particles(i) = Particle(x, v, flag);   // whole-record access
+ *   particles.member<1>(i) += dt * a;      // single member of record i
+ *   double* v = particles.member_data<1>(); // raw stream for SIMD loops
+ *
+ * Copies are shallow like RAJA::View, so the container can be captured by
+ * value into device lambdas; storage is explicitly managed with
+ * allocate()/deallocate(). Multi-dimensional indexing can be layered on
+ * top with a RAJA::Layout mapping indices to the linear record index.
+ */
+template <typename RecordType,
+          typename mempool = RAJA::basic_mempool::MemPool<
+              RAJA::basic_mempool::generic_allocator> >
+class SoAArray;
+
+template <typename... Members, typename mempool>
+class SoAArray<camp::tuple<Members...>, mempool>
+{
+  static_assert(
+      RAJA::foldl(RAJA::operators::bit_and<bool>(),
+                  true, std::is_trivially_copyable<Members>::value...),
+      "SoAArray members must be trivially copyable");
+
+  using soa_ptr_type = detail::SoAPtr<camp::tuple<Members...>, mempool>;
+
+public:
+  using value_type = camp::tuple<Members...>;
+
+  template <camp::idx_t I>
+  using member_type = camp::at_v<camp::list<Members...>, I>;
+
+  /*!
+   * Reference proxy to one record; converts to the record tuple on read
+   * and scatters a record tuple to the member arrays on assignment.
+   */
+  class reference
+  {
+  public:
+    RAJA_HOST_DEVICE reference(soa_ptr_type const& ptr, size_t i)
+        : m_ptr(ptr), m_i(i)
+    {
+    }
+
+    RAJA_HOST_DEVICE operator value_type() const { return m_ptr.get(m_i); }
+
+    RAJA_HOST_DEVICE reference& operator=(value_type const& val)
+    {
+      m_ptr.set(m_i, val);
+      return *this;
+    }
+
+    //! reference to member I of this record
+    template <camp::idx_t I>
+    RAJA_HOST_DEVICE member_type<I>& member() const
+    {
+      return m_ptr.template member<I>(m_i);
+    }
+
+  private:
+    soa_ptr_type m_ptr;
+    size_t m_i;
+  };
+
+  SoAArray() = default;
+  explicit SoAArray(size_t size) : m_ptr(size), m_size(size) {}
+
+  SoAArray& allocate(size_t size)
+  {
+    m_ptr.allocate(size);
+    m_size = size;
+    return *this;
+  }
+
+  SoAArray& deallocate()
+  {
+    m_ptr.deallocate();
+    m_size = 0;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE bool allocated() const { return m_ptr.allocated(); }
+
+  RAJA_HOST_DEVICE size_t size() const { return m_size; }
+
+  RAJA_HOST_DEVICE reference operator()(size_t i) const
+  {
+    return reference(m_ptr, i);
+  }
+
+  RAJA_HOST_DEVICE value_type get(size_t i) const { return m_ptr.get(i); }
+  RAJA_HOST_DEVICE void set(size_t i, value_type const& val)
+  {
+    m_ptr.set(i, val);
+  }
+
+  //! contiguous stream of member I, suitable for SIMD traversal
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE member_type<I>* member_data() const
+  {
+    return m_ptr.template member_data<I>();
+  }
+
+  //! reference to member I of record i
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE member_type<I>& member(size_t i) const
+  {
+    return m_ptr.template member<I>(i);
+  }
+
+private:
+  soa_ptr_type m_ptr;
+  size_t m_size = 0;
+};
+
 }  // namespace RAJA
 
 #endif /* RAJA_SOA_PTR_HPP */
@@ -161,6 +161,57 @@ struct StrideCalculator<IdxLin,
 };
 
 
+template <typename IdxLin, typename Range, typename Sizes, camp::idx_t Fastest, IdxLin Pad>
+struct PadSizesImpl;
+
+template <typename IdxLin, IdxLin... Range, IdxLin... Sizes, camp::idx_t Fastest, IdxLin Pad>
+struct PadSizesImpl<IdxLin,
+                    camp::int_seq<IdxLin, Range...>,
+                    camp::int_seq<IdxLin, Sizes...>,
+                    Fastest,
+                    Pad> {
+  using type =
+      camp::int_seq<IdxLin, (Range == IdxLin(Fastest) ? Sizes + Pad : Sizes)...>;
+};
+
+/*!
+ * Computes the sizes of a layout with the fastest-varying dimension
+ * (the last entry of the permutation) padded by Pad elements.
+ */
+template <typename Perm, typename IdxLin, IdxLin Pad, typename Sizes>
+struct PaddedSizes;
+
+template <camp::idx_t... Perm, typename IdxLin, IdxLin Pad, IdxLin... Sizes>
+struct PaddedSizes<camp::idx_seq<Perm...>,
+                   IdxLin,
+                   Pad,
+                   camp::int_seq<IdxLin, Sizes...>> {
+  static constexpr camp::idx_t fastest_dim =
+      camp::seq_at<sizeof...(Perm) - 1, camp::idx_seq<Perm...>>::value;
+  using type = typename PadSizesImpl<
+      IdxLin,
+      camp::make_int_seq_t<IdxLin, sizeof...(Sizes)>,
+      camp::int_seq<IdxLin, Sizes...>,
+      fastest_dim,
+      Pad>::type;
+};
+
+template <typename Perm, typename IdxLin, typename SizeSeq>
+struct StaticLayoutFromSeq;
+
+template <typename Perm, typename IdxLin, IdxLin... Sizes>
+struct StaticLayoutFromSeq<Perm, IdxLin, camp::int_seq<IdxLin, Sizes...>> {
+  using type = StaticLayoutBase_impl<
+      IdxLin,
+      camp::make_int_seq_t<IdxLin, sizeof...(Sizes)>,
+      camp::int_seq<IdxLin, Sizes...>,
+      typename StrideCalculator<IdxLin,
+                                camp::make_int_seq_t<IdxLin, sizeof...(Sizes)>,
+                                Perm,
+                                camp::int_seq<IdxLin, Sizes...>>::strides>;
+};
+
+
 template <typename Layout, typename DimTypeList>
 struct TypedStaticLayoutImpl;
 
@@ -212,6 +263,26 @@ template <typename Perm, camp::idx_t... Sizes>
 using StaticLayout = StaticLayoutT<Perm, camp::idx_t, Sizes...>;
 
 
+/*!
+ * StaticLayout whose fastest-varying extent is padded by Pad elements
+ * when computing strides and total size.
+ *
+ * Padding rows of power-of-two tiles (Pad = 1 gives the classic
+ * "+1 element per row") staggers rows across shared memory banks on
+ * GPUs and across cache sets on CPUs. Indices stay in the unpadded
+ * logical ranges; the padding elements are never addressed.
+ */
+template <typename Perm, camp::idx_t Pad, camp::idx_t... Sizes>
+using PaddedStaticLayout = typename detail::StaticLayoutFromSeq<
+    Perm,
+    camp::idx_t,
+    typename detail::PaddedSizes<Perm,
+                                 camp::idx_t,
+                                 Pad,
+                                 camp::int_seq<camp::idx_t, Sizes...>>::type>::
+    type;
+
+
 
 template <typename Perm, typename IdxLin, typename TypeList, camp::idx_t... Sizes>
 using TypedStaticLayout =
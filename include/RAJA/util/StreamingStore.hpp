@@ -0,0 +1,125 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA streaming (cache-bypass) stores.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_StreamingStore_HPP
+#define RAJA_StreamingStore_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void stream_store_impl(T* ptr,
+                                                    T val,
+                                                    std::true_type)
+{
+#if defined(__CUDA_ARCH__)
+#if __CUDA_ARCH__ >= 320
+  // streaming cache hint: likely accessed once, evict first
+  __stcs(ptr, val);
+#else
+  *ptr = val;
+#endif
+#elif defined(RAJA_COMPILER_CLANG)
+  __builtin_nontemporal_store(val, ptr);
+#else
+  // no scalar non-temporal store on this compiler; a plain store keeps
+  // the semantics and loses only the cache hint
+  *ptr = val;
+#endif
+}
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void stream_store_impl(T* ptr,
+                                                    T val,
+                                                    std::false_type)
+{
+  *ptr = val;
+}
+
+//! types the streaming intrinsics have forms for; everything else
+//  falls back to a plain store
+template <typename T>
+using has_streaming_store =
+    std::integral_constant<bool,
+                           std::is_arithmetic<T>::value &&
+                               !std::is_same<T, bool>::value>;
+
+}  // namespace detail
+
+/*!
+ * Store val to *ptr with a non-temporal / cache-bypass hint, for
+ * write-only data that will not be re-read before eviction. Lowers to
+ * __stcs on CUDA devices, __builtin_nontemporal_store with clang on
+ * the host, and a plain store where no streaming form exists, so it is
+ * always safe to use; ordinary loads of the stored location remain
+ * correct either way.
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void stream_store(T* ptr, T val)
+{
+  detail::stream_store_impl(ptr, val, detail::has_streaming_store<T>{});
+}
+
+/*!
+ * Proxy reference that turns assignment into a streaming store; only
+ * assignment is provided since streamed locations are write-only by
+ * intent.
+ */
+template <typename T>
+struct StreamingRef {
+
+  T* ptr;
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  StreamingRef& operator=(T val)
+  {
+    stream_store(ptr, val);
+    return *this;
+  }
+};
+
+/*!
+ * Wrap a reference - typically a View element access - so assignment
+ * through it bypasses the cache:
+ *
+ * \code
+ *
+ *  RAJA::forall<RAJA::simd_exec>(range, [=](RAJA::Index_type i) {
+ *    RAJA::streaming(yview(i)) = a * xview(i) + yview(i);
+ *  });
+ *
+ * \endcode
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE StreamingRef<T> streaming(T& ref)
+{
+  return StreamingRef<T>{&ref};
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,264 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining TiledLayout, a N-dimensional index
+ *          calculator with cache-tiled data ordering that composes with
+ *          index offsets and stride permutations
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_TILEDLAYOUT_HPP
+#define RAJA_TILEDLAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/Permutations.hpp"
+#include "RAJA/util/PermutedLayout.hpp"
+
+namespace RAJA
+{
+
+//! Compile-time tile extents for TiledLayout, one per dimension
+template <camp::idx_t... TileSizes>
+struct Tiles {
+};
+
+namespace internal
+{
+
+//! product of a compile-time tile extent pack, as the linear index type
+template <typename IdxLin, camp::idx_t... TileSizes>
+struct TileProduct;
+
+template <typename IdxLin>
+struct TileProduct<IdxLin> {
+  static constexpr IdxLin value = 1;
+};
+
+template <typename IdxLin, camp::idx_t T0, camp::idx_t... TileSizes>
+struct TileProduct<IdxLin, T0, TileSizes...> {
+  static constexpr IdxLin value =
+      static_cast<IdxLin>(T0) * TileProduct<IdxLin, TileSizes...>::value;
+};
+
+template <typename Range, typename IdxLin, camp::idx_t... TileSizes>
+struct TiledLayout_impl;
+
+template <camp::idx_t... RangeInts, typename IdxLin, camp::idx_t... TileSizes>
+struct TiledLayout_impl<camp::idx_seq<RangeInts...>, IdxLin, TileSizes...> {
+  using Self = TiledLayout_impl<camp::idx_seq<RangeInts...>, IdxLin,
+                                TileSizes...>;
+  using IndexRange = camp::idx_seq<RangeInts...>;
+  using IndexLinear = IdxLin;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+
+  //! elements per tile, folded at compile time
+  static constexpr IdxLin tile_volume =
+      TileProduct<IdxLin, TileSizes...>::value;
+
+  //! layout of whole tiles over the (permuted) tile grid
+  Layout<n_dims, IdxLin> tile_grid;
+  IdxLin offsets[n_dims] = {0};  // If not specified set to zero
+
+  constexpr RAJA_INLINE TiledLayout_impl() : tile_grid() {}
+
+  constexpr RAJA_INLINE TiledLayout_impl(
+      Layout<n_dims, IdxLin> const& tile_grid_in,
+      std::array<IdxLin, sizeof...(RangeInts)> const& offsets_in)
+      : tile_grid{tile_grid_in}, offsets{offsets_in[RangeInts]...}
+  {
+  }
+
+  constexpr RAJA_INLINE RAJA_HOST_DEVICE TiledLayout_impl(Self const& c)
+      : tile_grid(c.tile_grid), offsets{c.offsets[RangeInts]...}
+  {
+  }
+
+  /*!
+   * Computes a linear index from the given (possibly offset) indices.
+   * Each index splits into a tile coordinate and an intra-tile
+   * coordinate by its compile-time tile extent, so the divides and
+   * moduli fold to shifts and masks for power-of-two tiles; elements of
+   * one tile are contiguous, in row-major order within the tile.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin operator()(Indices... indices) const
+  {
+    return tile_grid(((indices - offsets[RangeInts]) /
+                      static_cast<IdxLin>(TileSizes))...) *
+               tile_volume +
+           intra_fold<TileSizes...>(
+               0, ((indices - offsets[RangeInts]) %
+                   static_cast<IdxLin>(TileSizes))...);
+  }
+
+  /*!
+   * Storage span required by the layout: whole tiles cover each
+   * dimension, so sizes that do not divide their tile extent are padded
+   * up to the next tile boundary.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return tile_grid.size() * tile_volume;
+  }
+
+private:
+  //! Horner fold of intra-tile coordinates into a row-major offset
+  template <camp::idx_t... None>
+  static RAJA_INLINE RAJA_HOST_DEVICE IdxLin intra_fold(IdxLin acc)
+  {
+    return acc;
+  }
+
+  template <camp::idx_t T0, camp::idx_t... Rest, typename U0, typename... Us>
+  static RAJA_INLINE RAJA_HOST_DEVICE IdxLin intra_fold(IdxLin acc,
+                                                        U0 u0,
+                                                        Us... us)
+  {
+    return intra_fold<Rest...>(acc * static_cast<IdxLin>(T0) +
+                                   static_cast<IdxLin>(u0),
+                               us...);
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin, camp::idx_t... TileSizes>
+constexpr IdxLin TiledLayout_impl<camp::idx_seq<RangeInts...>, IdxLin,
+                                  TileSizes...>::tile_volume;
+
+}  // namespace internal
+
+/*!
+ * @brief A tiled data layout: elements of one tile are contiguous and
+ *        whole tiles are ordered by a (permutable) grid layout.
+ *
+ * Tile extents are compile-time constants, so the per-dimension divide
+ * and modulus fold to constant arithmetic and the resulting index
+ * function matches a hand-derived formula. Compose with offsets and
+ * permutations through make_tiled_offset_layout.
+ */
+template <typename IdxLin, camp::idx_t... TileSizes>
+struct TiledLayout
+    : public internal::TiledLayout_impl<
+          camp::make_idx_seq_t<sizeof...(TileSizes)>, IdxLin, TileSizes...> {
+  using Base =
+      internal::TiledLayout_impl<camp::make_idx_seq_t<sizeof...(TileSizes)>,
+                                 IdxLin, TileSizes...>;
+
+  using internal::TiledLayout_impl<camp::make_idx_seq_t<sizeof...(TileSizes)>,
+                                   IdxLin, TileSizes...>::TiledLayout_impl;
+
+  constexpr RAJA_INLINE RAJA_HOST_DEVICE TiledLayout(Base const& rhs)
+      : Base{rhs}
+  {
+  }
+};
+
+/*!
+ * @brief Creates a tiled Layout object.
+ *
+ * Tiling composes with the stride permutation of the tile grid:
+ *
+ *     // 8x8 cache tiles; whole tiles ordered with J's tiles stride-1
+ *     auto layout = make_tiled_layout({{ni, nj}}, Tiles<8, 8>{},
+ *                                     as_array<PERM_IJ>::get());
+ *
+ * Sizes that do not divide their tile extent are padded up to whole
+ * tiles, so views built on the layout must allocate layout.size()
+ * elements.
+ */
+template <typename IdxLin, camp::idx_t... TileSizes>
+auto make_tiled_layout(
+    const std::array<IdxLin, sizeof...(TileSizes)>& sizes,
+    Tiles<TileSizes...>,
+    const std::array<camp::idx_t, sizeof...(TileSizes)>& permutation)
+    -> TiledLayout<IdxLin, TileSizes...>
+{
+  constexpr size_t Rank = sizeof...(TileSizes);
+  constexpr camp::idx_t tile_sizes[Rank] = {TileSizes...};
+
+  std::array<IdxLin, Rank> grid_sizes;
+  for (size_t i = 0; i < Rank; ++i) {
+    grid_sizes[i] = (sizes[i] + static_cast<IdxLin>(tile_sizes[i]) - 1) /
+                    static_cast<IdxLin>(tile_sizes[i]);
+  }
+
+  return TiledLayout<IdxLin, TileSizes...>{
+      typename TiledLayout<IdxLin, TileSizes...>::Base{
+          make_permuted_layout(grid_sizes, permutation),
+          std::array<IdxLin, Rank>{}}};
+}
+
+/*!
+ * @brief Creates a tiled Layout object with the default striding order.
+ */
+template <typename IdxLin, camp::idx_t... TileSizes>
+auto make_tiled_layout(const std::array<IdxLin, sizeof...(TileSizes)>& sizes,
+                       Tiles<TileSizes...> tiles)
+    -> TiledLayout<IdxLin, TileSizes...>
+{
+  std::array<camp::idx_t, sizeof...(TileSizes)> permutation;
+  for (size_t i = 0; i < sizeof...(TileSizes); ++i) {
+    permutation[i] = static_cast<camp::idx_t>(i);
+  }
+  return make_tiled_layout(sizes, tiles, permutation);
+}
+
+/*!
+ * @brief Creates a layout composing index offsets, a stride
+ *        permutation, and cache tiling in one flattened index function.
+ *
+ * The combinator for ghost-cell-offset, dimension-permuted, tiled
+ * views: indices in [lower, upper] per dimension shift to zero-based,
+ * split by the compile-time tile extents, and whole tiles follow the
+ * given striding order:
+ *
+ *     // indices in [-2, n+1], 8x8 tiles, I's tiles stride-1
+ *     auto layout = make_tiled_offset_layout({{-2, -2}},
+ *                                            {{n + 1, n + 1}},
+ *                                            Tiles<8, 8>{},
+ *                                            as_array<PERM_JI>::get());
+ */
+template <typename IdxLin, camp::idx_t... TileSizes>
+auto make_tiled_offset_layout(
+    const std::array<IdxLin, sizeof...(TileSizes)>& lower,
+    const std::array<IdxLin, sizeof...(TileSizes)>& upper,
+    Tiles<TileSizes...> tiles,
+    const std::array<camp::idx_t, sizeof...(TileSizes)>& permutation)
+    -> TiledLayout<IdxLin, TileSizes...>
+{
+  constexpr size_t Rank = sizeof...(TileSizes);
+
+  std::array<IdxLin, Rank> sizes;
+  for (size_t i = 0; i < Rank; ++i) {
+    sizes[i] = upper[i] - lower[i] + 1;
+  }
+
+  TiledLayout<IdxLin, TileSizes...> ret =
+      make_tiled_layout(sizes, tiles, permutation);
+  for (size_t i = 0; i < Rank; ++i) {
+    ret.offsets[i] = lower[i];
+  }
+  return ret;
+}
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_TransferAdvisorPlugin_HPP
+#define RAJA_TransferAdvisorPlugin_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TRANSFER_ADVISOR_PLUGIN)
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * Plugin that detects pageable host buffers feeding host<->device
+ * transfers and, optionally, pins the hottest ones.
+ *
+ * Transfers from pageable memory go through an internal staging copy in
+ * the driver and run several times slower than transfers from pinned
+ * memory, a mistake that is invisible at the call site. Code announces
+ * its transfer buffers with
+ * RAJA::util::register_transfer_buffer(ptr, size, "site"), and this
+ * plugin checks each registration at or above a size threshold against
+ * the CUDA runtime: a host pointer the runtime does not know about is
+ * pageable. Registrations are aggregated per site name, and the
+ * finalize_plugins() report lists, for each site, how many
+ * registrations and bytes were seen and how many were pageable.
+ *
+ * With a nonzero pin budget the plugin also self-corrects: pageable
+ * buffers are pinned in place with cudaHostRegister, and a least
+ * recently used list bounded by the budget decides which pinned
+ * buffers to release when new ones arrive. Re-registering a buffer
+ * refreshes its place in the list, so buffers transferred every step
+ * stay pinned while one-shot buffers age out. All pins are released in
+ * finalize().
+ *
+ * Environment variables:
+ *   RAJA_TRANSFER_ADVISOR_THRESHOLD   minimum buffer size in bytes to
+ *                                     inspect (default 1048576)
+ *   RAJA_TRANSFER_ADVISOR_PIN_BUDGET  total bytes the plugin may keep
+ *                                     pinned; 0 reports only (default 0)
+ *
+ * Without CUDA the plugin still aggregates registrations per site but
+ * cannot classify or pin them. It is only compiled and registered when
+ * RAJA is configured with RAJA_ENABLE_TRANSFER_ADVISOR_PLUGIN, so
+ * production builds pay nothing for it.
+ */
+class TransferAdvisorPlugin : public PluginStrategy
+{
+  public:
+    struct SiteStats {
+      unsigned long num_registrations = 0;
+      unsigned long num_pageable = 0;
+      unsigned long long total_bytes = 0;
+      unsigned long long pageable_bytes = 0;
+    };
+
+    void init(const PluginOptions& p) override;
+
+    void registerBuffer(const TransferBufferInfo& info) override;
+
+    void finalize() override;
+
+    //! Aggregated stats for one registration site, keyed by its name
+    static SiteStats getStats(const char* name);
+
+    //! Total bytes currently pinned by the plugin
+    static unsigned long long getPinnedBytes();
+
+    //! Release all plugin-held pins and clear aggregated stats
+    static void resetStats();
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif  // closing endif for RAJA_ENABLE_TRANSFER_ADVISOR_PLUGIN
+
+#endif
@@ -18,6 +18,8 @@
 #ifndef RAJA_VIEW_HPP
 #define RAJA_VIEW_HPP
 
+#include <cstdlib>
+#include <string>
 #include <type_traits>
 
 #include "RAJA/config.hpp"
@@ -113,6 +115,27 @@ struct View {
     auto idx = stripIndexType(layout(args...));
     return data[idx];
   }
+
+  /*!
+   * Return a non-owning lower-rank view of the slice at index i through
+   * dimension DIM. The slice layout reuses the parent's sizes and
+   * strides directly and the data pointer advances by i times the
+   * sliced stride, so constructing a slice performs no stride
+   * re-derivation and touches no heap, making it free inside hot loops.
+   */
+  template <camp::idx_t DIM, typename Idx>
+  RAJA_HOST_DEVICE RAJA_INLINE
+      RAJA::View<ValueType,
+                 typename layout_type::template RemoveDimLayout<DIM>,
+                 pointer_type>
+      slice(Idx i) const
+  {
+    return RAJA::View<ValueType,
+                      typename layout_type::template RemoveDimLayout<DIM>,
+                      pointer_type>(
+        data + stripIndexType(i) * stripIndexType(layout.strides[DIM]),
+        layout.template remove_dim<DIM>());
+  }
 };
 
 
@@ -378,6 +401,224 @@ RAJA_INLINE AtomicViewWrapper<ViewType, AtomicPolicy> make_atomic_view(
 }
 
 
+/*
+ * Wrapper around a View whose accessor validates every index against the
+ * layout extents before forming the linear index. Whether a given view is
+ * wrapped is decided once, where the view is constructed; the unwrapped
+ * access path is the unmodified View accessor, so views that are not
+ * wrapped consult no runtime flag per access.
+ */
+template <typename ViewType>
+struct BoundsCheckedViewWrapper {
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using value_type = typename base_type::value_type;
+
+  base_type base_;
+
+  RAJA_INLINE
+  constexpr explicit BoundsCheckedViewWrapper(ViewType const &view)
+      : base_{view}
+  {
+  }
+
+  RAJA_INLINE void set_data(pointer_type data_ptr) { base_.set_data(data_ptr); }
+
+  template <typename... ARGS>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(ARGS... args) const
+  {
+    base_.layout.template BoundsCheck<0>(stripIndexType(args)...);
+    return base_.operator()(args...);
+  }
+};
+
+
+template <typename ViewType>
+RAJA_INLINE BoundsCheckedViewWrapper<ViewType> make_bounds_checked_view(
+    ViewType const &view)
+{
+  return RAJA::BoundsCheckedViewWrapper<ViewType>(view);
+}
+
+
+/*!
+ * Returns true when the given view name is listed in the
+ * RAJA_BOUNDS_CHECK environment variable, a comma-separated list of view
+ * names (or "all" to check every named view). The environment is read
+ * once and cached, so the query is a string compare, not a getenv call.
+ */
+RAJA_INLINE bool bounds_check_requested(const char *name)
+{
+  static const std::string spec = []() {
+    const char *env = std::getenv("RAJA_BOUNDS_CHECK");
+    return std::string(env ? env : "");
+  }();
+
+  if (spec.empty()) {
+    return false;
+  }
+  if (spec == "all") {
+    return true;
+  }
+
+  const std::string target(name);
+  size_t pos = 0;
+  while (pos <= spec.size()) {
+    size_t next = spec.find(',', pos);
+    size_t len = (next == std::string::npos ? spec.size() : next) - pos;
+    if (spec.compare(pos, len, target) == 0 && len == target.size()) {
+      return true;
+    }
+    if (next == std::string::npos) {
+      break;
+    }
+    pos = next + 1;
+  }
+  return false;
+}
+
+
+/*!
+ * Invoke body with either the plain view or its bounds-checked wrapper,
+ * selected once at view-construction time from the RAJA_BOUNDS_CHECK
+ * environment variable. Both instantiations of body live in one binary,
+ * so a production build can enable checking for individual named views
+ * while every other view keeps the branch-free plain accessor:
+ *
+ *     RAJA::with_bounds_check("pressure", view, [&](auto const &v) {
+ *       RAJA::forall<policy>(range, [=](Index_type i) { ... v(i) ... });
+ *     });
+ */
+template <typename ViewType, typename Body>
+RAJA_INLINE void with_bounds_check(const char *name,
+                                   ViewType const &view,
+                                   Body &&body)
+{
+  if (bounds_check_requested(name)) {
+    body(RAJA::BoundsCheckedViewWrapper<ViewType>(view));
+  } else {
+    body(view);
+  }
+}
+
+
+namespace detail
+{
+
+/*!
+ * Load through a restrict-qualified read-only pointer. On CUDA devices
+ * arithmetic types go through __ldg so the value is fetched via the
+ * read-only data cache; everything else (and all host code) is a plain
+ * dereference.
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE
+    typename std::enable_if<std::is_arithmetic<T>::value, T>::type
+    read_only_load(const T *RAJA_RESTRICT ptr)
+{
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 350)
+  return __ldg(ptr);
+#else
+  return *ptr;
+#endif
+}
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE
+    typename std::enable_if<!std::is_arithmetic<T>::value, T>::type
+    read_only_load(const T *RAJA_RESTRICT ptr)
+{
+  return *ptr;
+}
+
+}  // namespace detail
+
+
+/*
+ * Wrapper around a View whose data pointer is held RAJA_RESTRICT
+ * qualified, telling the compiler accesses through this wrapper do not
+ * alias other pointers in the enclosing scope. The layout and pointer
+ * are copied out of the wrapped view because a restrict-qualified
+ * pointer type cannot be threaded through the View template arguments
+ * portably. Only views exposing layout and data members (RAJA::View)
+ * can be wrapped. The no-alias promise is the caller's to keep: wrap a
+ * view only when nothing else writes its data during the loop.
+ */
+template <typename ViewType>
+struct RestrictViewWrapper {
+  using base_type = ViewType;
+  using layout_type = typename base_type::layout_type;
+  using value_type = typename base_type::value_type;
+  using pointer_type = typename base_type::pointer_type;
+
+  layout_type const layout;
+  value_type *RAJA_RESTRICT data;
+
+  RAJA_INLINE
+  constexpr explicit RestrictViewWrapper(ViewType const &view)
+      : layout(view.layout), data(view.data)
+  {
+  }
+
+  RAJA_INLINE void set_data(pointer_type data_ptr) { data = data_ptr; }
+
+  template <typename... ARGS>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(ARGS... args) const
+  {
+    auto idx = stripIndexType(layout(args...));
+    return data[idx];
+  }
+};
+
+
+/*
+ * Read-only variant of RestrictViewWrapper: the pointer is held
+ * const-restrict and the accessor returns by value, loading through the
+ * CUDA read-only data cache (__ldg) on device for arithmetic types.
+ */
+template <typename ViewType>
+struct ReadOnlyRestrictViewWrapper {
+  using base_type = ViewType;
+  using layout_type = typename base_type::layout_type;
+  using value_type = camp::decay<typename base_type::value_type>;
+  using pointer_type = const value_type *;
+
+  layout_type const layout;
+  const value_type *RAJA_RESTRICT data;
+
+  RAJA_INLINE
+  constexpr explicit ReadOnlyRestrictViewWrapper(ViewType const &view)
+      : layout(view.layout), data(view.data)
+  {
+  }
+
+  RAJA_INLINE void set_data(pointer_type data_ptr) { data = data_ptr; }
+
+  template <typename... ARGS>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type operator()(ARGS... args) const
+  {
+    auto idx = stripIndexType(layout(args...));
+    return detail::read_only_load(data + idx);
+  }
+};
+
+
+template <typename ViewType>
+RAJA_INLINE RestrictViewWrapper<ViewType> make_restrict_view(
+    ViewType const &view)
+{
+  return RAJA::RestrictViewWrapper<ViewType>(view);
+}
+
+
+template <typename ViewType>
+RAJA_INLINE ReadOnlyRestrictViewWrapper<ViewType> make_readonly_restrict_view(
+    ViewType const &view)
+{
+  return RAJA::ReadOnlyRestrictViewWrapper<ViewType>(view);
+}
+
+
 }  // namespace RAJA
 
 #endif
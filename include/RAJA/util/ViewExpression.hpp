@@ -0,0 +1,257 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining an opt-in expression-template layer
+ *          over RAJA::View for fusing elementwise update chains.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_VIEW_EXPRESSION_HPP
+#define RAJA_VIEW_EXPRESSION_HPP
+
+#include <type_traits>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/policy/simd/policy.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace et
+{
+
+//
+// Expression nodes evaluate operands at a *linear* storage index, so all
+// Views combined in one expression must use identical layouts (same sizes,
+// permutation, and striding). Elementwise operations are then
+// layout-agnostic and the fused loop runs unit stride over the underlying
+// storage, which is what lets the simd policy vectorize it.
+//
+
+//! base class tagging expression nodes for operator overload resolution
+struct ExpressionBase {
+};
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_expression
+    : std::is_base_of<ExpressionBase, camp::decay<T>> {
+};
+
+template <typename T>
+struct is_operand
+    : std::integral_constant<bool,
+                             is_expression<T>::value ||
+                                 std::is_arithmetic<camp::decay<T>>::value> {
+};
+
+}  // namespace type_traits
+
+//! expression leaf reading a View's storage at the linear index
+template <typename ViewType>
+struct ViewOperand : ExpressionBase {
+  using value_type = typename ViewType::nc_value_type;
+
+  typename ViewType::pointer_type data;
+
+  RAJA_INLINE explicit ViewOperand(typename ViewType::pointer_type data_ptr)
+      : data(data_ptr)
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE value_type eval(Index_type i) const
+  {
+    return data[i];
+  }
+};
+
+//! expression leaf broadcasting a scalar to every index
+template <typename T>
+struct ScalarOperand : ExpressionBase {
+  using value_type = T;
+
+  T value;
+
+  RAJA_INLINE explicit ScalarOperand(T value_in) : value(value_in) {}
+
+  RAJA_HOST_DEVICE RAJA_INLINE value_type eval(Index_type) const
+  {
+    return value;
+  }
+};
+
+//! interior expression node applying Op to the results of two sub-trees
+template <typename Op, typename Lhs, typename Rhs>
+struct BinaryExpression : ExpressionBase {
+  using value_type = typename Lhs::value_type;
+
+  Lhs lhs;
+  Rhs rhs;
+
+  RAJA_INLINE BinaryExpression(Lhs const& lhs_in, Rhs const& rhs_in)
+      : lhs(lhs_in), rhs(rhs_in)
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE value_type eval(Index_type i) const
+  {
+    return Op{}(lhs.eval(i), rhs.eval(i));
+  }
+};
+
+namespace detail
+{
+
+template <typename T,
+          typename std::enable_if<type_traits::is_expression<T>::value,
+                                  int>::type = 0>
+RAJA_INLINE camp::decay<T> normalize_operand(T const& operand)
+{
+  return operand;
+}
+
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<camp::decay<T>>::value,
+                                  int>::type = 0>
+RAJA_INLINE ScalarOperand<camp::decay<T>> normalize_operand(T const& operand)
+{
+  return ScalarOperand<camp::decay<T>>(operand);
+}
+
+//! value type of a binary expression; taken from whichever side is an
+//  expression, preferring the left
+template <typename Lhs, typename Rhs,
+          bool = type_traits::is_expression<Lhs>::value>
+struct operand_value {
+  using type = typename camp::decay<Lhs>::value_type;
+};
+
+template <typename Lhs, typename Rhs>
+struct operand_value<Lhs, Rhs, false> {
+  using type = typename camp::decay<Rhs>::value_type;
+};
+
+}  // namespace detail
+
+//! assignable wrapper over a View; usable directly as an operand, and
+//  assigning an expression to it runs the fused traversal
+template <typename ViewType>
+struct ExpressionView : ViewOperand<ViewType> {
+
+  Index_type len;
+
+  explicit ExpressionView(ViewType const& view)
+      : ViewOperand<ViewType>(view.data),
+        len(static_cast<Index_type>(stripIndexType(view.layout.size())))
+  {
+  }
+
+  //! evaluate an expression into this view with an explicit policy
+  template <typename ExecPolicy, typename Expression,
+            typename std::enable_if<
+                type_traits::is_expression<Expression>::value, int>::type = 0>
+  void evaluate(Expression const& expression)
+  {
+    auto dst = this->data;
+    auto src = expression;
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, len),
+                             [=] RAJA_HOST_DEVICE(Index_type i) {
+                               dst[i] = src.eval(i);
+                             });
+  }
+
+  //! assignment fuses the whole expression into one simd traversal
+  template <typename Expression,
+            typename std::enable_if<
+                type_traits::is_expression<Expression>::value, int>::type = 0>
+  ExpressionView& operator=(Expression const& expression)
+  {
+    evaluate<RAJA::simd_exec>(expression);
+    return *this;
+  }
+};
+
+}  // namespace et
+
+
+/*!
+ * \brief Wrap a View for use in fused elementwise expressions.
+ *
+ * Wrapped views combine with +, -, *, / and arithmetic scalars into a
+ * lazy expression tree; nothing executes until the tree is assigned to
+ * another wrapped view, at which point the whole chain runs as a single
+ * traversal with no intermediate arrays:
+ *
+ *   auto A = RAJA::make_expression(a);
+ *   auto B = RAJA::make_expression(b);
+ *   auto D = RAJA::make_expression(d);
+ *   auto C = RAJA::make_expression(c);
+ *
+ *   C = A * B + D;                     // one simd_exec traversal
+ *   C.evaluate<RAJA::omp_parallel_for_exec>(A * B + D);  // explicit policy
+ *
+ * All views in one expression must use identical layouts; operands are
+ * evaluated at the linear storage index, so striding and permutation are
+ * honored as long as they agree across the expression.
+ */
+template <typename ViewType>
+RAJA_INLINE et::ExpressionView<ViewType> make_expression(ViewType const& view)
+{
+  return et::ExpressionView<ViewType>(view);
+}
+
+namespace et
+{
+
+#define RAJA_DEFINE_ET_BINARY_OPERATOR(OPERATOR, FUNCTOR)                    \
+  template <typename Lhs, typename Rhs,                                      \
+            typename std::enable_if<                                         \
+                (type_traits::is_expression<Lhs>::value ||                   \
+                 type_traits::is_expression<Rhs>::value) &&                  \
+                    type_traits::is_operand<Lhs>::value &&                   \
+                    type_traits::is_operand<Rhs>::value,                     \
+                int>::type = 0>                                              \
+  RAJA_INLINE auto OPERATOR(Lhs const& lhs, Rhs const& rhs)                  \
+      -> BinaryExpression<                                                   \
+          RAJA::operators::FUNCTOR<                                          \
+              typename detail::operand_value<Lhs, Rhs>::type>,               \
+          decltype(detail::normalize_operand(lhs)),                          \
+          decltype(detail::normalize_operand(rhs))>                          \
+  {                                                                          \
+    return {detail::normalize_operand(lhs),                                  \
+            detail::normalize_operand(rhs)};                                 \
+  }
+
+RAJA_DEFINE_ET_BINARY_OPERATOR(operator+, plus)
+RAJA_DEFINE_ET_BINARY_OPERATOR(operator-, minus)
+RAJA_DEFINE_ET_BINARY_OPERATOR(operator*, multiplies)
+RAJA_DEFINE_ET_BINARY_OPERATOR(operator/, divides)
+
+#undef RAJA_DEFINE_ET_BINARY_OPERATOR
+
+}  // namespace et
+
+}  // namespace RAJA
+
+#endif  // RAJA_VIEW_EXPRESSION_HPP
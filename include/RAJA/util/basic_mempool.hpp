@@ -18,16 +18,24 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
 #include <map>
+#include <utility>
+#include <vector>
 
+#include "RAJA/util/Allocators.hpp"
 #include "RAJA/util/align.hpp"
 #include "RAJA/util/mutex.hpp"
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace RAJA
 {
 
@@ -62,7 +70,8 @@ public:
   MemoryArena(void* ptr, size_t size)
     : m_allocation{ ptr, static_cast<char*>(ptr)+size },
       m_free_space(),
-      m_used_space()
+      m_used_space(),
+      m_used_bytes(0)
   {
      m_free_space[ptr] = static_cast<char*>(ptr)+size ;
     if (m_allocation.begin == nullptr) {
@@ -87,6 +96,40 @@ public:
 
   void* get_allocation() { return m_allocation.begin; }
 
+  //! bytes currently handed out of this arena
+  size_t used_bytes() { return m_used_bytes; }
+
+  //! bytes available in this arena
+  size_t free_bytes() { return capacity() - m_used_bytes; }
+
+  //! size of the largest contiguous free chunk in this arena
+  size_t largest_free_chunk()
+  {
+    size_t largest = 0;
+    free_type::iterator end = m_free_space.end();
+    for (free_type::iterator iter = m_free_space.begin(); iter != end;
+         ++iter) {
+      size_t chunk_size =
+          static_cast<char*>(iter->second) - static_cast<char*>(iter->first);
+      if (chunk_size > largest) {
+        largest = chunk_size;
+      }
+    }
+    return largest;
+  }
+
+  //! accumulate a size -> count histogram of this arena's live allocations
+  void count_used_chunks(std::map<size_t, size_t>& histogram)
+  {
+    used_type::iterator end = m_used_space.end();
+    for (used_type::iterator iter = m_used_space.begin(); iter != end;
+         ++iter) {
+      size_t chunk_size =
+          static_cast<char*>(iter->second) - static_cast<char*>(iter->first);
+      ++histogram[chunk_size];
+    }
+  }
+
   void* get(size_t nbytes, size_t alignment)
   {
     void* ptr_out = nullptr;
@@ -124,6 +167,9 @@ public:
 
       if (found != m_used_space.end()) {
 
+        m_used_bytes -= static_cast<char*>(found->second) -
+                        static_cast<char*>(found->first);
+
         add_free_chunk(found->first, found->second);
 
         m_used_space.erase(found);
@@ -232,16 +278,42 @@ private:
   {
     // simply inserts a chunk of memory into used_space
     m_used_space.insert(used_value_type{begin, end});
+    m_used_bytes += static_cast<char*>(end) - static_cast<char*>(begin);
   }
 
   memory_chunk m_allocation;
   free_type m_free_space;
   used_type m_used_space;
+  size_t m_used_bytes;
 };
 
 } /* end namespace detail */
 
 
+/*! \struct PoolStatistics
+ ******************************************************************************
+ *
+ * \brief  Snapshot of a MemPool's occupancy, taken by MemPool::statistics().
+ *
+ * used_bytes counts allocations currently handed out of the pool's arenas,
+ * including blocks parked in per-thread recycling caches. The fragmentation
+ * ratio is 1 - (largest free chunk / total free bytes); 0 means all free
+ * space is contiguous, values near 1 mean free space is scattered into
+ * chunks too small to satisfy large requests. The histogram maps live
+ * allocation sizes in bytes to their counts.
+ *
+ ******************************************************************************
+ */
+struct PoolStatistics {
+  size_t used_bytes = 0;
+  size_t high_watermark_bytes = 0;
+  size_t capacity_bytes = 0;
+  size_t arena_count = 0;
+  double fragmentation_ratio = 0.0;
+  std::map<size_t, size_t> size_histogram;
+};
+
+
 /*! \class MemPool
  ******************************************************************************
  *
@@ -296,8 +368,19 @@ public:
 
   static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
 
+  //! new arenas grow geometrically by this factor by default
+  static constexpr double default_arena_growth_factor = 2.0;
+
+  //! per-thread recycling cache keeps at most this many blocks per size
+  static const size_t max_cached_blocks_per_size = 16;
+
   MemPool()
-      : m_arenas(), m_default_arena_size(default_default_arena_size), m_alloc()
+      : m_arenas(),
+        m_default_arena_size(default_default_arena_size),
+        m_next_arena_size(default_default_arena_size),
+        m_arena_growth_factor(default_arena_growth_factor),
+        m_high_watermark_bytes(0),
+        m_alloc()
   {
   }
 
@@ -311,9 +394,7 @@ public:
 
   void free_chunks()
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    lock_guard<RAJA::mutex> lock(m_mutex);
 
     while (!m_arenas.empty()) {
       void* allocation_ptr = m_arenas.front().get_allocation();
@@ -324,50 +405,171 @@ public:
 
   size_t arena_size()
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    lock_guard<RAJA::mutex> lock(m_mutex);
 
     return m_default_arena_size;
   }
 
   size_t arena_size(size_t new_size)
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    lock_guard<RAJA::mutex> lock(m_mutex);
 
     size_t prev_size = m_default_arena_size;
     m_default_arena_size = new_size;
+    m_next_arena_size = new_size;
     return prev_size;
   }
 
-  template <typename T>
-  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  double arena_growth_factor()
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    lock_guard<RAJA::mutex> lock(m_mutex);
+
+    return m_arena_growth_factor;
+  }
+
+  //! set geometric growth factor for new arenas (>= 1.0);
+  //  1.0 restores the old fixed-size-arena behavior
+  double arena_growth_factor(double new_factor)
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+
+    double prev_factor = m_arena_growth_factor;
+    m_arena_growth_factor = (new_factor >= 1.0) ? new_factor : 1.0;
+    return prev_factor;
+  }
+
+  //! snapshot occupancy counters for this pool; cheap enough for periodic
+  //  polling by an external memory monitor, but walks the arena maps so
+  //  avoid calling it on a hot allocation path
+  PoolStatistics statistics()
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+
+    PoolStatistics stats;
+    stats.high_watermark_bytes = m_high_watermark_bytes;
+
+    size_t total_free = 0;
+    size_t largest_free = 0;
 
-    const size_t size = nTs * sizeof(T);
-    void* ptr = nullptr;
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
-      ptr = iter->get(size, alignment);
-      if (ptr != nullptr) {
-        break;
+      stats.used_bytes += iter->used_bytes();
+      stats.capacity_bytes += iter->capacity();
+      stats.arena_count += 1;
+      total_free += iter->free_bytes();
+      largest_free = std::max(largest_free, iter->largest_free_chunk());
+      iter->count_used_chunks(stats.size_histogram);
+    }
+
+    if (total_free > 0) {
+      stats.fragmentation_ratio =
+          1.0 - static_cast<double>(largest_free) /
+                    static_cast<double>(total_free);
+    }
+
+    return stats;
+  }
+
+  //! return blocks parked in the calling thread's recycling cache to their
+  //  arenas, then free arenas left with no outstanding allocations; cached
+  //  blocks otherwise pin their arenas as used, so a monitor reacting to
+  //  pool bloat should prefer this over free_unused_chunks
+  void release_unused()
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+
+    ThreadCache& cache = getThreadCache();
+    typename ThreadCache::freelist_type::iterator cend = cache.freelist.end();
+    for (typename ThreadCache::freelist_type::iterator clist =
+             cache.freelist.begin();
+         clist != cend; ++clist) {
+      for (void* ptr : clist->second) {
+        give_to_arenas(ptr);
       }
     }
+    cache.freelist.clear();
+
+    free_unused_arenas();
+  }
+
+  //! free arenas with no outstanding allocations, trimming the pool back
+  //  toward its high watermark of actually-used memory
+  void free_unused_chunks()
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+
+    free_unused_arenas();
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    const size_t size = nTs * sizeof(T);
+
+    //
+    // Fast path: recycle a block of the same size and alignment from this
+    // thread's cache without touching the arena mutex; only the short
+    // key-map insert is locked. Reducer churn, which mallocs and frees
+    // same-sized tally blocks repeatedly, stays on this path after warmup.
+    //
+    ThreadCache& cache = getThreadCache();
+    typename ThreadCache::freelist_type::iterator clist =
+        cache.freelist.find(block_key{size, alignment});
+    if (clist != cache.freelist.end() && !clist->second.empty()) {
+      void* ptr = clist->second.back();
+      clist->second.pop_back();
+      record_block_key(ptr, block_key{size, alignment});
+      return static_cast<T*>(ptr);
+    }
 
-    if (ptr == nullptr) {
-      const size_t alloc_size =
-          std::max(size + alignment, m_default_arena_size);
-      void* arena_ptr = m_alloc.malloc(alloc_size);
-      if (arena_ptr != nullptr) {
-        m_arenas.emplace_front(arena_ptr, alloc_size);
-        ptr = m_arenas.front().get(size, alignment);
+    void* ptr = nullptr;
+    {
+      lock_guard<RAJA::mutex> lock(m_mutex);
+
+      arena_container_type::iterator end = m_arenas.end();
+      for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
+           ++iter) {
+        ptr = iter->get(size, alignment);
+        if (ptr != nullptr) {
+          break;
+        }
+      }
+
+      if (ptr == nullptr) {
+        //
+        // Grow by allocating a new arena; arena sizes increase
+        // geometrically so a pool under heavy churn settles into a few
+        // large arenas instead of a long list of fixed-size ones.
+        //
+        const size_t alloc_size =
+            std::max(size + alignment, m_next_arena_size);
+        void* arena_ptr = m_alloc.malloc(alloc_size);
+        if (arena_ptr != nullptr) {
+          m_arenas.emplace_front(arena_ptr, alloc_size);
+          ptr = m_arenas.front().get(size, alignment);
+          m_next_arena_size = static_cast<size_t>(
+              static_cast<double>(m_next_arena_size) * m_arena_growth_factor);
+        }
       }
+
+      if (ptr != nullptr) {
+        //
+        // Update the high watermark; thread-cache hits skip this, but
+        // recycled blocks stay counted in their arena so the watermark
+        // still bounds live bytes.
+        //
+        size_t total_used = 0;
+        for (arena_container_type::iterator iter = m_arenas.begin();
+             iter != end; ++iter) {
+          total_used += iter->used_bytes();
+        }
+        m_high_watermark_bytes = std::max(m_high_watermark_bytes, total_used);
+      }
+    }
+
+    if (ptr != nullptr) {
+      record_block_key(ptr, block_key{size, alignment});
     }
 
     return static_cast<T*>(ptr);
@@ -375,11 +577,123 @@ public:
 
   void free(const void* cptr)
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
-
     void* ptr = const_cast<void*>(cptr);
+
+    //
+    // Fast path: a block whose size class is known is pushed onto the
+    // freeing thread's recycling cache without taking the pool mutex.
+    // The key lookup also erases the live-block entry, so a free from
+    // any thread retires the mapping and no stale key can survive a
+    // reuse of the address. Overflow beyond the per-size cache limit
+    // falls through to the arenas.
+    //
+    block_key key;
+    if (take_block_key(ptr, key)) {
+      ThreadCache& cache = getThreadCache();
+      std::vector<void*>& list = cache.freelist[key];
+      if (list.size() < max_cached_blocks_per_size) {
+        list.push_back(ptr);
+        return;
+      }
+    }
+
+    lock_guard<RAJA::mutex> lock(m_mutex);
+
+    give_to_arenas(ptr);
+  }
+
+private:
+  using arena_container_type = std::list<detail::MemoryArena>;
+
+  //! size/alignment pair identifying a class of recyclable blocks
+  using block_key = std::pair<size_t, size_t>;
+
+  //! cache of free blocks parked with one thread, keyed by size and
+  //  alignment; lookups and recycling here take no lock. The destructor
+  //  returns the blocks to the arenas so an exiting thread does not
+  //  strand them.
+  struct ThreadCache {
+    using freelist_type = std::map<block_key, std::vector<void*>>;
+
+    MemPool* pool = nullptr;
+    freelist_type freelist;
+
+    ~ThreadCache()
+    {
+      if (pool != nullptr) {
+        pool->drain_cache(*this);
+      }
+    }
+  };
+
+  ThreadCache& getThreadCache()
+  {
+    static thread_local ThreadCache cache;
+    if (cache.pool == nullptr) {
+      cache.pool = this;
+    }
+    return cache;
+  }
+
+  //! return a cache's blocks to the arenas; called at thread exit, and
+  //  purely bookkeeping so it is safe during static destruction
+  void drain_cache(ThreadCache& cache)
+  {
+    lock_guard<RAJA::mutex> lock(m_mutex);
+
+    typename ThreadCache::freelist_type::iterator cend = cache.freelist.end();
+    for (typename ThreadCache::freelist_type::iterator clist =
+             cache.freelist.begin();
+         clist != cend; ++clist) {
+      for (void* ptr : clist->second) {
+        give_to_arenas(ptr);
+      }
+    }
+    cache.freelist.clear();
+  }
+
+  //! record the size class of a live block; the map is shared by all
+  //  threads, under its own mutex so recording stays off the arena lock
+  void record_block_key(void* ptr, block_key key)
+  {
+    lock_guard<RAJA::mutex> lock(m_key_mutex);
+
+    m_block_keys[ptr] = key;
+  }
+
+  //! look up and retire the size class of a live block; returns false
+  //  for pointers this pool did not hand out
+  bool take_block_key(void* ptr, block_key& key)
+  {
+    lock_guard<RAJA::mutex> lock(m_key_mutex);
+
+    std::map<void*, block_key>::iterator found = m_block_keys.find(ptr);
+    if (found == m_block_keys.end()) {
+      return false;
+    }
+    key = found->second;
+    m_block_keys.erase(found);
+    return true;
+  }
+
+  //! free arenas with no outstanding allocations; caller must hold the
+  //  pool mutex
+  void free_unused_arenas()
+  {
+    arena_container_type::iterator iter = m_arenas.begin();
+    while (iter != m_arenas.end()) {
+      if (iter->unused()) {
+        m_alloc.free(iter->get_allocation());
+        iter = m_arenas.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+
+  //! return a block to its arena; caller must hold the pool mutex
+  void give_to_arenas(void* ptr)
+  {
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
@@ -393,30 +707,134 @@ public:
     }
   }
 
-private:
-  using arena_container_type = std::list<detail::MemoryArena>;
-
-#if defined(RAJA_ENABLE_OPENMP)
-  omp::mutex m_mutex;
-#endif
+  RAJA::mutex m_mutex;
+  RAJA::mutex m_key_mutex;
 
+  std::map<void*, block_key> m_block_keys;
   arena_container_type m_arenas;
   size_t m_default_arena_size;
+  size_t m_next_arena_size;
+  double m_arena_growth_factor;
+  size_t m_high_watermark_bytes;
   allocator_t m_alloc;
 };
 
-//! example allocator for basic_mempool using malloc/free
+//! example allocator for basic_mempool using malloc/free, honoring
+//  any host allocator registered through RAJA::util::set_allocator
 struct generic_allocator {
 
   // returns a valid pointer on success, nullptr on failure
-  void* malloc(size_t nbytes) { return std::malloc(nbytes); }
+  void* malloc(size_t nbytes)
+  {
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::host)) {
+      return RAJA::util::callback_allocate(RAJA::util::AllocatorSpace::host,
+                                           nbytes);
+    }
+    return std::malloc(nbytes);
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    if (RAJA::util::has_allocator(RAJA::util::AllocatorSpace::host)) {
+      RAJA::util::callback_deallocate(RAJA::util::AllocatorSpace::host, ptr);
+    } else {
+      std::free(ptr);
+    }
+    return true;
+  }
+};
+
+/*!
+ * Allocator for basic_mempool backing arenas with huge pages, so the
+ * large long-lived buffers handed out of the pool sit on 2MB TLB
+ * entries instead of thousands of 4KB ones.
+ *
+ * Arena requests are rounded up to whole huge pages and satisfied, in
+ * order of preference, by
+ *   - mmap with MAP_HUGETLB, when the system has hugetlb pages reserved
+ *   - an anonymous mapping aligned and sized to huge-page boundaries
+ *     with madvise(MADV_HUGEPAGE), letting transparent huge pages back
+ *     it (the alignment is what makes the region eligible)
+ *   - plain malloc, on failure or off Linux
+ * so a pool instantiated with this allocator degrades gracefully to the
+ * generic behavior where huge pages are unavailable:
+ *
+ *   using hugepage_mempool_type =
+ *       basic_mempool::MemPool<basic_mempool::hugepage_allocator>;
+ *
+ * The rounding wastes under one huge page per arena, which the default
+ * arena sizes amortize away.
+ */
+struct hugepage_allocator {
+
+  //! huge-page size arenas are rounded and aligned to
+  static const size_t hugepage_size = 2ull * 1024ull * 1024ull;
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+#if defined(__linux__)
+    const size_t size =
+        ((nbytes + hugepage_size - 1) / hugepage_size) * hugepage_size;
+
+    void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED) {
+      m_mappings[ptr] = size;
+      return ptr;
+    }
+
+    // no reserved hugetlb pages: overmap an anonymous region, trim it
+    // to a huge-page-aligned span, and ask for transparent huge pages
+    void* raw = ::mmap(nullptr, size + hugepage_size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw != MAP_FAILED) {
+      char* base = static_cast<char*>(raw);
+      char* aligned = reinterpret_cast<char*>(
+          (reinterpret_cast<size_t>(base) + hugepage_size - 1) &
+          ~(hugepage_size - 1));
+      if (aligned != base) {
+        ::munmap(base, aligned - base);
+      }
+      size_t tail = hugepage_size - static_cast<size_t>(aligned - base);
+      if (tail > 0) {
+        ::munmap(aligned + size, tail);
+      }
+#if defined(MADV_HUGEPAGE)
+      ::madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+      m_mappings[aligned] = size;
+      return aligned;
+    }
+#endif
+
+    // off Linux, or with both mappings refused, fall back to the heap
+    return std::malloc(nbytes);
+  }
 
   // returns true on success, false on failure
   bool free(void* ptr)
   {
+#if defined(__linux__)
+    std::map<void*, size_t>::iterator found = m_mappings.find(ptr);
+    if (found != m_mappings.end()) {
+      ::munmap(found->first, found->second);
+      m_mappings.erase(found);
+      return true;
+    }
+#endif
     std::free(ptr);
     return true;
   }
+
+#if defined(__linux__)
+private:
+  //! mapped arena sizes for munmap; no lock needed, as MemPool only
+  //  calls its allocator under the pool mutex
+  std::map<void*, size_t> m_mappings;
+#endif
 };
 
 } /* end namespace basic_mempool */
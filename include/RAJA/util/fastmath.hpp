@@ -0,0 +1,217 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for per-kernel fast-math annotation: markers
+ *          scoping value-unsafe floating point optimization to the
+ *          bracketed kernels, and per-operation approximate math
+ *          functions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_fastmath_HPP
+#define RAJA_util_fastmath_HPP
+
+#include <cmath>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+//
+// RAJA_FASTMATH_BEGIN / RAJA_FASTMATH_END - bracket, at file or
+// namespace scope, the functions whose kernels may be compiled with
+// value-unsafe floating point optimization (reassociation, FMA
+// contraction, reciprocal approximation of division) while the rest of
+// the build stays precise:
+//
+//   RAJA_FASTMATH_BEGIN
+//   void applyEos(...)
+//   {
+//     RAJA::forall<RAJA::omp_parallel_for_exec>(range, [=](...) {...});
+//   }
+//   RAJA_FASTMATH_END
+//
+// Floating point semantics attach to a lambda where it is parsed, so
+// this is the mechanism that reaches a kernel's loop body: everything
+// defined between the markers, lambdas included, gets the relaxed
+// options, and the always-inline forall implementations collapse into
+// the bracketed function, so the loop itself is optimized under them.
+// GNU compilers scope the options with push_options/optimize pragmas;
+// Clang-based compilers (including HIP and Clang CUDA device
+// compilation) and MSVC use float_control push/pop. With nvcc the
+// markers expand to nothing and device code keeps the flags it was
+// built with; use the RAJA::fastmath functions below for per-operation
+// control there.
+//
+#if defined(RAJA_COMPILER_GNU) && !defined(__CUDACC__)
+#define RAJA_FASTMATH_BEGIN        \
+  RAJA_PRAGMA(GCC push_options)    \
+  RAJA_PRAGMA(GCC optimize("fast-math"))
+#define RAJA_FASTMATH_END RAJA_PRAGMA(GCC pop_options)
+#elif defined(__clang__) || defined(RAJA_COMPILER_MSVC)
+#define RAJA_FASTMATH_BEGIN          \
+  RAJA_PRAGMA(float_control(push))   \
+  RAJA_PRAGMA(float_control(precise, off))
+#define RAJA_FASTMATH_END RAJA_PRAGMA(float_control(pop))
+#else
+#define RAJA_FASTMATH_BEGIN
+#define RAJA_FASTMATH_END
+#endif
+
+namespace RAJA
+{
+
+//
+// Per-operation approximate math functions, for opting in one operation
+// at a time where a whole-kernel marker region is too coarse or, with
+// nvcc, unavailable. In device code the float overloads map to the
+// hardware approximation instructions that -use_fast_math would apply
+// globally; on the host, and for double, they fall back to the precise
+// operations (there are no double-precision approximation
+// instructions). fma() requests contraction explicitly everywhere,
+// independent of the -ffp-contract setting of the translation unit.
+//
+namespace fastmath
+{
+
+//! approximate division; device float maps to the fast divide instruction
+RAJA_HOST_DEVICE RAJA_INLINE float div(float x, float y)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __fdividef(x, y);
+#else
+  return x / y;
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE double div(double x, double y) { return x / y; }
+
+//! approximate reciprocal
+RAJA_HOST_DEVICE RAJA_INLINE float rcp(float x)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __fdividef(1.0f, x);
+#else
+  return 1.0f / x;
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE double rcp(double x) { return 1.0 / x; }
+
+//! approximate reciprocal square root
+RAJA_HOST_DEVICE RAJA_INLINE float rsqrt(float x)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return ::rsqrtf(x);
+#else
+  return 1.0f / std::sqrt(x);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE double rsqrt(double x)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return ::rsqrt(x);
+#else
+  return 1.0 / std::sqrt(x);
+#endif
+}
+
+//! approximate exponential
+RAJA_HOST_DEVICE RAJA_INLINE float exp(float x)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __expf(x);
+#else
+  return std::exp(x);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE double exp(double x) { return std::exp(x); }
+
+//! approximate natural logarithm
+RAJA_HOST_DEVICE RAJA_INLINE float log(float x)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __logf(x);
+#else
+  return std::log(x);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE double log(double x) { return std::log(x); }
+
+//! approximate power function
+RAJA_HOST_DEVICE RAJA_INLINE float pow(float x, float y)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __powf(x, y);
+#else
+  return std::pow(x, y);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE double pow(double x, double y)
+{
+  return std::pow(x, y);
+}
+
+//! approximate sine
+RAJA_HOST_DEVICE RAJA_INLINE float sin(float x)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __sinf(x);
+#else
+  return std::sin(x);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE double sin(double x) { return std::sin(x); }
+
+//! approximate cosine
+RAJA_HOST_DEVICE RAJA_INLINE float cos(float x)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __cosf(x);
+#else
+  return std::cos(x);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE double cos(double x) { return std::cos(x); }
+
+//! fused multiply-add x * y + z, contracted regardless of the
+//  translation unit's -ffp-contract setting
+RAJA_HOST_DEVICE RAJA_INLINE float fma(float x, float y, float z)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return ::__fmaf_rn(x, y, z);
+#else
+  return std::fma(x, y, z);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE double fma(double x, double y, double z)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return ::__fma_rn(x, y, z);
+#else
+  return std::fma(x, y, z);
+#endif
+}
+
+}  // namespace fastmath
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -59,6 +59,26 @@
 #define RAJA_SUPPRESS_HD_WARN
 #endif
 
+/*!
+ *******************************************************************************
+ * \def RAJA_NO_INLINE
+ *
+ * \brief Macro forcing a function to be compiled out-of-line.
+ *
+ * \note Used to fission kernels at statement boundaries (see
+ *  RAJA::statement::FissionLambda): a lambda body kept out of line gets
+ *  its own register allocation instead of inflating the register count
+ *  of the enclosing kernel.
+ *******************************************************************************
+ */
+#if defined(RAJA_ENABLE_CUDA) && defined(__CUDACC__)
+#define RAJA_NO_INLINE __noinline__
+#elif defined(_MSC_VER)
+#define RAJA_NO_INLINE __declspec(noinline)
+#else
+#define RAJA_NO_INLINE __attribute__((noinline))
+#endif
+
 /*!
  *******************************************************************************
  * \def RAJA_USED_ARG(x)
@@ -122,6 +142,27 @@ RAJA_HOST_DEVICE RAJA_INLINE void RAJA_UNUSED_VAR(T &&...) noexcept
 #define RAJA_DIVIDE_CEILING_INT(dividend, divisor) \
   (((dividend) + (divisor)-1) / (divisor))
 
+/*!
+ *******************************************************************************
+ * \def RAJA_PREFETCH_READ(addr)
+ * \def RAJA_PREFETCH_WRITE(addr)
+ *
+ * \brief Macros that issue a software prefetch for the cache line
+ *        containing addr, hinting a subsequent read or write.
+ *
+ * These expand to nothing in device code and with compilers that do not
+ * provide a prefetch builtin, so they are always safe to leave in loop
+ * bodies.
+ *******************************************************************************
+ */
+#if defined(RAJA_DEVICE_CODE) || defined(RAJA_COMPILER_MSVC)
+#define RAJA_PREFETCH_READ(addr)
+#define RAJA_PREFETCH_WRITE(addr)
+#else
+#define RAJA_PREFETCH_READ(addr) __builtin_prefetch((addr), 0)
+#define RAJA_PREFETCH_WRITE(addr) __builtin_prefetch((addr), 1)
+#endif
+
 
 RAJA_HOST_DEVICE
 inline void RAJA_ABORT_OR_THROW(const char *str)
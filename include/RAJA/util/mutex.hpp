@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <mutex>
+
 #if defined(RAJA_ENABLE_OPENMP)
 #include <omp.h>
 #endif
@@ -27,6 +29,12 @@
 namespace RAJA
 {
 
+//! mutex guarding internal state against any host threads. Unlike
+//  omp::mutex this is available in every build, so state shared between
+//  driving threads stays locked even when RAJA is driven from
+//  std::thread without OpenMP.
+using mutex = std::mutex;
+
 #if defined(RAJA_ENABLE_OPENMP)
 namespace omp
 {
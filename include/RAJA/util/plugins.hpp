@@ -11,6 +11,10 @@
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
 #include "RAJA/util/PluginStrategy.hpp"
+#include "RAJA/util/ProfilingPlugin.hpp"
+#include "RAJA/util/ProgressPlugin.hpp"
+#include "RAJA/util/TransferAdvisorPlugin.hpp"
+#include "RAJA/util/RaceCheckPlugin.hpp"
 #include "RAJA/util/RuntimePluginLoader.hpp"
 #include "RAJA/util/KokkosPluginLoader.hpp"
 
@@ -24,15 +28,21 @@ RAJA_INLINE auto trigger_updates_before(T&& item)
   return item;
 }
 
+//
+// The per-launch hooks below run for every forall and kernel, so they
+// dispatch through the flat thunk table built at registration rather
+// than walking the registry's linked list of shared_ptr-held plugins
+// through their vtables. Plugins that opted into batched notification
+// are skipped on the launch hooks; they hear from the batch hooks at
+// batch scopes instead.
+//
+
 RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
-  for (auto plugin = PluginRegistry::begin();
-      plugin != PluginRegistry::end();
-      ++plugin)
-  {
-    (*plugin).get()->preCapture(p);
+  for (PluginDispatch const& d : plugin_dispatch()) {
+    d.preCapture(d.plugin, p);
   }
 }
 
@@ -40,11 +50,8 @@ RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
-  for (auto plugin = PluginRegistry::begin();
-      plugin != PluginRegistry::end();
-      ++plugin)
-  {
-    (*plugin).get()->postCapture(p);
+  for (PluginDispatch const& d : plugin_dispatch()) {
+    d.postCapture(d.plugin, p);
   }
 }
 
@@ -52,26 +59,98 @@ RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
-  for (auto plugin = PluginRegistry::begin();
-      plugin != PluginRegistry::end();
-      ++plugin)
-  {
-    (*plugin).get()->preLaunch(p);
+  for (PluginDispatch const& d : plugin_dispatch()) {
+    if (!d.batched) {
+      d.preLaunch(d.plugin, p);
+    }
   }
 }
 
 RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
+{
+  for (PluginDispatch const& d : plugin_dispatch()) {
+    if (!d.batched) {
+      d.postLaunch(d.plugin, p);
+    }
+  }
+}
+
+RAJA_INLINE
+void
+callPreLaunchBatchPlugins(const PluginContext& p, size_t num_launches)
+{
+  for (PluginDispatch const& d : plugin_dispatch()) {
+    if (d.batched) {
+      d.preLaunchBatch(d.plugin, p, num_launches);
+    }
+  }
+}
+
+RAJA_INLINE
+void
+callPostLaunchBatchPlugins(const PluginContext& p, size_t num_launches)
+{
+  for (PluginDispatch const& d : plugin_dispatch()) {
+    if (d.batched) {
+      d.postLaunchBatch(d.plugin, p, num_launches);
+    }
+  }
+}
+
+/*!
+ * Scope object bracketing a batch of launches for batched plugins:
+ * construction notifies preLaunchBatch, destruction postLaunchBatch.
+ * WorkGroup runs and regions open one internally; wrap any other loop
+ * sequence that should count as one notification in one of these.
+ */
+class LaunchBatchScope
+{
+public:
+  LaunchBatchScope(const PluginContext& p, size_t num_launches = 0)
+      : m_context(p), m_num_launches(num_launches)
+  {
+    callPreLaunchBatchPlugins(m_context, m_num_launches);
+  }
+
+  LaunchBatchScope(const LaunchBatchScope&) = delete;
+  LaunchBatchScope& operator=(const LaunchBatchScope&) = delete;
+
+  ~LaunchBatchScope()
+  {
+    callPostLaunchBatchPlugins(m_context, m_num_launches);
+  }
+
+private:
+  PluginContext m_context;
+  size_t m_num_launches;
+};
+
+RAJA_INLINE
+void
+callRegisterBufferPlugins(const TransferBufferInfo& info)
 {
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
-    (*plugin).get()->postLaunch(p);
+    (*plugin).get()->registerBuffer(info);
   }
 }
 
+/*!
+ * Announce a host buffer that feeds host<->device transfers to all
+ * loaded plugins. Call this at the site that issues (or fills the data
+ * for) the transfer; name labels that site in aggregated reports.
+ */
+RAJA_INLINE
+void
+register_transfer_buffer(const void* ptr, std::size_t size, const char* name)
+{
+  callRegisterBufferPlugins(TransferBufferInfo{ptr, size, name});
+}
+
 RAJA_INLINE
 void
 callInitPlugins(const PluginOptions p)
@@ -20,6 +20,9 @@
 #ifndef RAJA_resource_HPP
 #define RAJA_resource_HPP
 
+#include <cstddef>
+#include <vector>
+
 #include "camp/resource.hpp"
 #if defined(RAJA_CUDA_ACTIVE)
 #include "RAJA/policy/cuda/policy.hpp"
@@ -91,6 +94,78 @@ namespace RAJA
   };
 #endif
 
+  /*!
+   * Fixed-size pool of resources handed out round-robin.
+   *
+   * Each call to get() returns the next resource in the pool, so
+   * independent foralls launched through the pool land on different
+   * streams and may overlap on the device. depends_on() makes the
+   * handed-out resource wait for a previously recorded event before
+   * running new work, expressing cross-stream dependencies without
+   * managing streams and events in client code:
+   *
+   * \code
+   *
+   *  RAJA::resources::ResourcePool<RAJA::resources::Cuda> pool;
+   *
+   *  RAJA::resources::Event e1 = RAJA::forall<pol>(pool.get(), ...);
+   *  RAJA::resources::Event e2 = RAJA::forall<pol>(pool.get(), ...);
+   *
+   *  // runs after the second forall, overlaps with the first
+   *  RAJA::forall<pol>(pool.depends_on(e2), ...);
+   *
+   *  pool.wait();
+   *
+   * \endcode
+   *
+   * Handing out resources is not thread safe; share a pool across
+   * threads only with external synchronization.
+   */
+  template <typename RESOURCE>
+  class ResourcePool
+  {
+  public:
+    explicit ResourcePool(size_t num_resources = 4) : m_next(0)
+    {
+      m_resources.reserve(num_resources);
+      for (size_t i = 0; i < num_resources; ++i) {
+        m_resources.emplace_back(RESOURCE{});
+      }
+    }
+
+    //! Get the next resource in round-robin order
+    RESOURCE& get()
+    {
+      RESOURCE& r = m_resources[m_next];
+      m_next = (m_next + 1) % m_resources.size();
+      return r;
+    }
+
+    //! Get the next resource, made to wait for event e before running
+    //  any work subsequently launched on it
+    RESOURCE& depends_on(Event e)
+    {
+      RESOURCE& r = get();
+      r.wait_for(&e);
+      return r;
+    }
+
+    //! Block until all work launched on the pool's resources completes
+    void wait()
+    {
+      for (RESOURCE& r : m_resources) {
+        r.wait();
+      }
+    }
+
+    //! Number of resources in the pool
+    size_t size() const { return m_resources.size(); }
+
+  private:
+    std::vector<RESOURCE> m_resources;
+    size_t m_next;
+  };
+
   } // end namespace resources
 
   namespace type_traits
@@ -412,13 +412,60 @@ intro_sort(Iter begin,
   }
 }
 
+/*!
+    \brief index of the first element in sorted [first, first+n) that is
+    not ordered before val, by binary search; callable from device code
+    so parallel merges can rank elements per thread
+*/
+template <typename Iter, typename DiffT, typename T, typename Compare>
+RAJA_HOST_DEVICE RAJA_INLINE
+DiffT
+lower_bound_index(Iter first,
+                  DiffT n,
+                  const T& val,
+                  Compare comp)
+{
+  DiffT lo = 0;
+  DiffT hi = n;
+  while ( lo < hi )
+  {
+    DiffT mid = lo + (hi - lo)/2;
+    if ( comp(first[mid], val) ) { lo = mid + 1; }
+    else                         { hi = mid; }
+  }
+  return lo;
+}
+
+/*!
+    \brief index of the first element in sorted [first, first+n) that is
+    ordered after val, by binary search; callable from device code
+*/
+template <typename Iter, typename DiffT, typename T, typename Compare>
+RAJA_HOST_DEVICE RAJA_INLINE
+DiffT
+upper_bound_index(Iter first,
+                  DiffT n,
+                  const T& val,
+                  Compare comp)
+{
+  DiffT lo = 0;
+  DiffT hi = n;
+  while ( lo < hi )
+  {
+    DiffT mid = lo + (hi - lo)/2;
+    if ( comp(val, first[mid]) ) { hi = mid; }
+    else                         { lo = mid + 1; }
+  }
+  return lo;
+}
+
 /*!
     \brief merge a range with midpoint using comparison function
     with local range/2 copy
 */
 template <typename Iter, typename Compare>
 void
-RAJA_INLINE 
+RAJA_INLINE
 inplace_merge(  Iter first,
                 Iter middle,
                 Iter last,
@@ -491,6 +538,184 @@ inplace_merge(  Iter first,
   return;
 }
 
+/*!
+    \brief rotate the range [first, last) left so that middle becomes
+    the first element, using O(N) swaps and O(1) memory
+*/
+template <typename Iter>
+RAJA_INLINE
+void
+rotate_range(Iter first,
+             Iter middle,
+             Iter last)
+{
+  using ::RAJA::safe_iter_swap;
+
+  if (first == middle || middle == last) {
+    // nothing to rotate
+    return;
+  }
+
+  // Gries-Mills block-swap rotation
+  Iter next = middle;
+  while (first != next) {
+
+    safe_iter_swap(first, next);
+    ++first;
+    ++next;
+
+    if (next == last) {
+      next = middle;
+    } else if (first == middle) {
+      middle = next;
+    }
+  }
+}
+
+/*!
+    \brief stable merge of two consecutive sorted ranges inplace using
+    comparison function, rotations, and binary searches,
+    using O(N*lg(N)) comparisons/swaps and O(lg(N)) stack memory
+*/
+template <typename Iter, typename Compare>
+RAJA_INLINE
+void
+rotation_merge(Iter first,
+               Iter middle,
+               Iter last,
+               Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using ::RAJA::safe_iter_swap;
+
+  diff_type len1 = middle - first;
+  diff_type len2 = last - middle;
+
+  if ( len1 == 0 || len2 == 0 )
+  {
+    // at least one side empty, already sorted
+    return;
+  }
+
+  if ( !comp(*middle, *(middle-1)) )
+  {
+    // everything already in order, done
+    return;
+  }
+
+  if ( len1 + len2 == 2 ) // only 2 elements, out of order, simple swap
+  {
+    safe_iter_swap( first, middle );
+    return;
+  }
+
+  // symmerge: split the larger side in half and binary search the other
+  // side for the matching cut, keeping the merge stable
+  Iter cut1, cut2;
+  if ( len1 >= len2 )
+  {
+    cut1 = first + len1/2;
+
+    // lower bound of *cut1 in [middle, last)
+    diff_type lo = 0;
+    diff_type hi = len2;
+    while ( lo < hi )
+    {
+      diff_type mid = lo + (hi - lo)/2;
+      if ( comp(*(middle + mid), *cut1) ) { lo = mid + 1; }
+      else                                { hi = mid; }
+    }
+    cut2 = middle + lo;
+  }
+  else
+  {
+    cut2 = middle + len2/2;
+
+    // upper bound of *cut2 in [first, middle)
+    diff_type lo = 0;
+    diff_type hi = len1;
+    while ( lo < hi )
+    {
+      diff_type mid = lo + (hi - lo)/2;
+      if ( comp(*cut2, *(first + mid)) ) { hi = mid; }
+      else                               { lo = mid + 1; }
+    }
+    cut1 = first + lo;
+  }
+
+  // bring the two middle pieces into sorted relative position
+  rotate_range( cut1, middle, cut2 );
+  Iter new_middle = cut1 + (cut2 - middle);
+
+  // merge the halves on either side of the rotated block
+  detail::rotation_merge( first, cut1, new_middle, comp );
+  detail::rotation_merge( new_middle, cut2, last, comp );
+}
+
+/*!
+    \brief merge a range with midpoint using comparison function
+    and a caller-provided workspace of at least middle - first
+    constructed elements
+*/
+template <typename Iter, typename Compare>
+RAJA_INLINE
+void
+workspace_merge( Iter first,
+                 Iter middle,
+                 Iter last,
+                 Compare comp,
+                 RAJA::detail::IterVal<Iter>* work )
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  diff_type copylen = middle - first;
+
+  if ( first == middle || middle == last )
+  {
+    // at least one side empty, already sorted
+    return;
+  }
+
+  if ( !comp(*middle, *(middle-1)) )
+  {
+    // everything already in order, done
+    return;
+  }
+
+  // move the first half into the workspace
+  for ( diff_type cc = 0; cc < copylen; ++cc )
+  {
+    work[cc] = std::move(first[cc]);
+  }
+
+  // merge
+  for ( diff_type cur = 0; cur < copylen; )
+  {
+    if ( middle >= last ) // moved all second half, put workspace into remainder
+    {
+      std::move( work+cur, work+copylen, first );
+      break;
+    }
+    else if ( first == middle ) // everything prior to middle is sorted, done
+    {
+      break;
+    }
+
+    if ( comp(*middle, work[cur]) )
+    {
+      *first = std::move(*middle);
+      ++middle;
+    }
+    else
+    {
+      *first = std::move(work[cur]);
+      ++cur;
+    }
+    ++first;
+  }
+  return;
+}
+
 /*!
     \brief merge given two ranges using comparison function
     while copies are outside, somewhat follows STL API
@@ -667,6 +892,72 @@ merge_sort(Iter begin,
   //}
 }
 
+/*!
+    \brief stable merge sort given range inplace using comparison function
+    and a caller-provided workspace of work_len constructed elements,
+    allocating no memory internally; merges whose first half exceeds the
+    workspace fall back to in-place rotation merges
+*/
+template <typename Iter, typename Compare>
+RAJA_INLINE
+void
+merge_sort(Iter begin,
+           Iter end,
+           Compare comp,
+           RAJA::detail::IterVal<Iter>* work,
+           RAJA::detail::IterDiff<Iter> work_len)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  // iterative mergesort (bottom up), same structure as the allocating
+  // variant above but with the caller owning the merge workspace
+
+  // min helper
+  auto minlam = [] (diff_type a, diff_type b) {return (a < b) ? a : b;};
+
+  diff_type len = end - begin;
+  static constexpr diff_type insertion_sort_cutoff = 16;
+  if ( len <= insertion_sort_cutoff && len > 0 )
+  {
+    detail::insertion_sort( begin, end, comp );
+  }
+  else
+  {
+    // insertion sort on 16-element chunks, then merge
+    for ( diff_type start = 0; start < len; start += insertion_sort_cutoff )
+    {
+      diff_type lastchunk = minlam( insertion_sort_cutoff, len - start );
+      detail::insertion_sort( begin + start, begin + start + lastchunk, comp );
+    }
+
+    for ( diff_type midpoint = 16; midpoint < len; midpoint *= 2 )  // O(log n) loop
+    {
+      for ( diff_type start = 0; start < len; start += midpoint * 2 )  // O(n) merging loop
+      {
+        if ( start + midpoint >= len )
+        {
+          break;  // skip merge if no second half exists
+        }
+
+        diff_type finish = minlam( start + midpoint * 2, len );
+
+        if ( work != nullptr && midpoint <= work_len )
+        {
+          // first half fits in the workspace, use a buffered merge
+          detail::workspace_merge( begin + start, begin + start + midpoint,
+                                   begin + finish, comp, work );
+        }
+        else
+        {
+          // workspace too small for this level, merge in place
+          detail::rotation_merge( begin + start, begin + start + midpoint,
+                                  begin + finish, comp );
+        }
+      }
+    }
+  }
+}
+
 }  // namespace detail
 
 /*!
@@ -779,6 +1070,36 @@ merge_sort(Iter begin,
   }
 }
 
+/*!
+    \brief stable merge sort given range inplace using comparison function
+    and a caller-provided workspace of work_len constructed elements,
+    using O(N*lg(N)) comparisons and allocating no memory internally
+
+    Merge levels whose first half fits in the workspace use buffered
+    merges; wider levels fall back to in-place rotation merges, which
+    cost O(N*lg(N)) moves per level instead of O(N). With work_len == 0
+    (work may be nullptr) the sort is fully in-place; an O(sqrt(N))
+    workspace buffers the lower half of the merge levels without
+    doubling the memory footprint the way the allocating overload does.
+*/
+template <typename Iter,
+          typename Compare = operators::less<detail::IterVal<Iter>>>
+RAJA_INLINE
+concepts::enable_if<type_traits::is_iterator<Iter>>
+merge_sort(Iter begin,
+           Iter end,
+           detail::IterVal<Iter>* work,
+           detail::IterDiff<Iter> work_len,
+           Compare comp = Compare{})
+{
+  auto N = end - begin;
+
+  if (N > 1) {
+
+    detail::merge_sort(begin, end, comp, work, work_len);
+  }
+}
+
 }  // namespace RAJA
 
 #endif
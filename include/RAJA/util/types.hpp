@@ -30,6 +30,21 @@
 
 #include "camp/helpers.hpp"
 
+//
+// Half-precision floating point types. CUDA supplies __half, and
+// __nv_bfloat16 starting with CUDA 11; the macros below gate the
+// limits, atomic, and reducer specializations for these types
+// elsewhere in RAJA.
+//
+#if defined(RAJA_ENABLE_CUDA) && defined(__CUDACC__)
+#include <cuda_fp16.h>
+#define RAJA_CUDA_HAS_HALF
+#if defined(__CUDACC_VER_MAJOR__) && (__CUDACC_VER_MAJOR__ >= 11)
+#include <cuda_bf16.h>
+#define RAJA_CUDA_HAS_BFLOAT16
+#endif
+#endif
+
 namespace RAJA
 {
 
@@ -22,9 +22,12 @@
 #include "RAJA/config.hpp"
 
 #include <iostream>
+#include <iterator>
 #include <type_traits>
 
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/Span.hpp"
 #include "RAJA/util/camp_aliases.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/zip_tuple.hpp"
@@ -217,6 +220,91 @@ auto zip(Args&&... args)
   return {std::forward<Args>(args)...};
 }
 
+/*!
+    \brief Make a forall iterable that walks multiple equal-length
+    containers in lockstep, passing a zip_ref of per-container references
+    to the loop body.
+
+    Each zipped stream advances with unit stride through its own
+    container, so loops over a zip span executed with simd_exec keep the
+    unit-stride vector loads and stores that a hand-written multi-pointer
+    loop would have, without the manual pointer bookkeeping:
+
+        RAJA::forall<RAJA::simd_exec>(RAJA::zip_span(x, y, z),
+            [=](RAJA::zip_ref<double&, double&, double&> r) {
+              RAJA::get<2>(r) = RAJA::get<0>(r) + RAJA::get<1>(r);
+            });
+
+    The length of the span is taken from the first container; the
+    remaining containers must be at least as long.
+*/
+template < typename First, typename... Rest >
+RAJA_HOST_DEVICE RAJA_INLINE
+auto zip_span(First&& first, Rest&&... rest)
+  -> Span<ZipIterator<camp::decay<decltype(std::begin(first))>,
+                      camp::decay<decltype(std::begin(rest))>...>,
+          std::ptrdiff_t>
+{
+  return {zip(std::begin(first), std::begin(rest)...),
+          static_cast<std::ptrdiff_t>(std::end(first) - std::begin(first))};
+}
+
+/*!
+    \brief zip_span overload for raw iterators or pointers with an
+    explicit length.
+*/
+template < typename IndexType, typename... Iters,
+           typename = concepts::enable_if<type_traits::is_integral<IndexType>> >
+RAJA_HOST_DEVICE RAJA_INLINE
+auto zip_span(IndexType len, Iters&&... iters)
+  -> Span<ZipIterator<camp::decay<Iters>...>, IndexType>
+{
+  return {zip(std::forward<Iters>(iters)...), len};
+}
+
+namespace operators
+{
+
+/*!
+    \brief plus specialization for zip_tuples that adds member-wise, with
+    the tuple of member identities as its identity. This lets zipped
+    sequences flow through the scan patterns unchanged, combining
+    multiple same-length sequences in a single traversal.
+*/
+template < bool is_val, typename ... Ts >
+struct plus<zip_tuple<is_val, Ts...>,
+            zip_tuple<is_val, Ts...>,
+            zip_tuple<is_val, Ts...>>
+    : public detail::binary_function<zip_tuple<is_val, Ts...>,
+                                     zip_tuple<is_val, Ts...>,
+                                     zip_tuple<is_val, Ts...>>,
+      detail::associative_tag
+{
+  using Ret = zip_tuple<is_val, Ts...>;
+
+  // accept zip_tuples of either reference type (zip_ref or zip_val)
+  template < typename L, typename R >
+  RAJA_HOST_DEVICE RAJA_INLINE Ret operator()(L const& lhs, R const& rhs) const
+  {
+    return plus_helper(lhs, rhs, camp::make_idx_seq_t<sizeof...(Ts)>{});
+  }
+
+  RAJA_HOST_DEVICE static Ret identity()
+  {
+    return Ret(plus<camp::decay<Ts>>::identity()...);
+  }
+
+private:
+  template < typename L, typename R, camp::idx_t ... Is >
+  RAJA_HOST_DEVICE RAJA_INLINE static Ret plus_helper(L const& lhs, R const& rhs,
+                                                      camp::idx_seq<Is...>)
+  {
+    return Ret(plus<camp::decay<Ts>>{}(RAJA::get<Is>(lhs), RAJA::get<Is>(rhs))...);
+  }
+};
+
+}  // end namespace operators
+
 /*!
     \brief Comparator object that compares the first member
     of tuple like objects.
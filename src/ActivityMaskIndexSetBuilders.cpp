@@ -0,0 +1,196 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for activity-mask index set builder methods.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <cstring>
+#include <vector>
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/util/BitMask.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace RAJA
+{
+
+namespace
+{
+
+constexpr RAJA::Index_type bits_per_word =
+    static_cast<RAJA::Index_type>(BitSetView::bits_per_word);
+
+//
+// Append the runs of set bits in word, whose bit 0 governs index base,
+// as [begin, end) pairs. Count-trailing-zeros jumps from run to run, so
+// the cost is per run, not per bit.
+//
+void appendWordRuns(
+    std::vector<std::pair<RAJA::Index_type, RAJA::Index_type>>& runs,
+    RAJA::BitSetWord word,
+    RAJA::Index_type base)
+{
+  while (word) {
+    int b = detail::firstSetBit(word);
+    RAJA::BitSetWord shifted = word >> b;
+    RAJA::BitSetWord inverted = ~shifted;
+    int run_len = inverted ? detail::firstSetBit(inverted)
+                           : static_cast<int>(bits_per_word) - b;
+    runs.emplace_back(base + b, base + b + run_len);
+    if (b + run_len >= static_cast<int>(bits_per_word)) {
+      break;
+    }
+    word &= ~(((RAJA::BitSetWord(1) << run_len) - 1) << b);
+  }
+}
+
+}  // unnamed namespace
+
+/*
+ ******************************************************************************
+ *
+ * ActivityMaskIndexSetBuilder methods: maintain per-tile run lists over
+ * the mask words and rescan only tiles containing changed words.
+ *
+ ******************************************************************************
+ */
+ActivityMaskIndexSetBuilder::ActivityMaskIndexSetBuilder(
+    RAJA::Index_type begin,
+    RAJA::Index_type end)
+    : m_begin(begin), m_len(end > begin ? end - begin : 0)
+{
+  size_t num_words = BitSetView::num_words(m_len);
+  size_t num_tiles = (num_words + s_words_per_tile - 1) / s_words_per_tile;
+  m_tile_runs.resize(num_tiles);
+}
+
+void ActivityMaskIndexSetBuilder::rebuildTile(size_t tile,
+                                              const RAJA::BitSetView& mask)
+{
+  auto& runs = m_tile_runs[tile];
+  runs.clear();
+
+  size_t num_words = BitSetView::num_words(m_len);
+  size_t word_begin = tile * s_words_per_tile;
+  size_t word_end = word_begin + s_words_per_tile;
+  if (word_end > num_words) word_end = num_words;
+
+  for (size_t w = word_begin; w < word_end; ++w) {
+    RAJA::BitSetWord word = mask.word(w);
+
+    // ignore bits past the end of the range in the final word
+    RAJA::Index_type tail = m_len - static_cast<RAJA::Index_type>(w) *
+                                        bits_per_word;
+    if (tail < bits_per_word) {
+      word &= (RAJA::BitSetWord(1) << tail) - 1;
+    }
+
+    appendWordRuns(runs, word,
+                   m_begin + static_cast<RAJA::Index_type>(w) * bits_per_word);
+  }
+}
+
+void ActivityMaskIndexSetBuilder::emit()
+{
+  m_iset = RAJA::TypedIndexSet<RAJA::RangeSegment>();
+  m_num_active = 0;
+
+  // walk tiles in order, merging runs that abut across word and tile
+  // boundaries into single range segments
+  RAJA::Index_type cur_begin = 0;
+  RAJA::Index_type cur_end = 0;
+  bool open = false;
+
+  for (auto& runs : m_tile_runs) {
+    for (auto& run : runs) {
+      if (open && run.first == cur_end) {
+        cur_end = run.second;
+      } else {
+        if (open) {
+          m_iset.push_back(RangeSegment(cur_begin, cur_end));
+          m_num_active += cur_end - cur_begin;
+        }
+        cur_begin = run.first;
+        cur_end = run.second;
+        open = true;
+      }
+    }
+  }
+  if (open) {
+    m_iset.push_back(RangeSegment(cur_begin, cur_end));
+    m_num_active += cur_end - cur_begin;
+  }
+}
+
+const RAJA::TypedIndexSet<RAJA::RangeSegment>&
+ActivityMaskIndexSetBuilder::update(const RAJA::BitSetView& mask)
+{
+  size_t num_words = BitSetView::num_words(m_len);
+
+  if (m_built) {
+    // find the tiles whose words changed since the previous update
+    std::vector<size_t> dirty_tiles;
+    for (size_t tile = 0; tile < m_tile_runs.size(); ++tile) {
+      size_t word_begin = tile * s_words_per_tile;
+      size_t word_end = word_begin + s_words_per_tile;
+      if (word_end > num_words) word_end = num_words;
+      for (size_t w = word_begin; w < word_end; ++w) {
+        if (m_words[w] != mask.word(w)) {
+          dirty_tiles.push_back(tile);
+          m_words[w] = mask.word(w);
+          for (size_t w2 = w + 1; w2 < word_end; ++w2) {
+            m_words[w2] = mask.word(w2);
+          }
+          break;
+        }
+      }
+    }
+
+    if (dirty_tiles.empty()) {
+      return m_iset;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (long id = 0; id < static_cast<long>(dirty_tiles.size()); ++id) {
+      rebuildTile(dirty_tiles[id], mask);
+    }
+  } else {
+    m_words.resize(num_words);
+    for (size_t w = 0; w < num_words; ++w) {
+      m_words[w] = mask.word(w);
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (long tile = 0; tile < static_cast<long>(m_tile_runs.size()); ++tile) {
+      rebuildTile(tile, mask);
+    }
+    m_built = true;
+  }
+
+  emit();
+  return m_iset;
+}
+
+}  // namespace RAJA
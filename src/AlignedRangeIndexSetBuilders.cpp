@@ -20,6 +20,7 @@
 #include <cstring>
 
 #include <iostream>
+#include <vector>
 
 #include "RAJA/index/IndexSetBuilders.hpp"
 
@@ -29,18 +30,53 @@
 
 #include "camp/resource.hpp"
 
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+#include <omp.h>
+#endif
+
 namespace RAJA
 {
 
+namespace
+{
+
+//
+// Functor used with segmentCall to deep-copy segments from a privately
+// built index set into the caller's index set, preserving order.
+//
+struct CopySegmentsToIndexSet {
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& dest;
+
+  template <typename SEG_T>
+  void operator()(SEG_T const& seg) const
+  {
+    dest.push_back(seg);
+  }
+};
+
+void appendSegments(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& dest,
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> const& src)
+{
+  size_t num_seg = src.getNumSegments();
+  for (size_t i = 0; i < num_seg; ++i) {
+    src.segmentCall(i, CopySegmentsToIndexSet{dest});
+  }
+}
+
 /*
  ******************************************************************************
  *
- * Generate an index set with aligned Range segments and List segments,
- * as needed, from given array of indices.
+ * Serial scan that generates aligned Range segments and List segments,
+ * as needed, from given array of indices and appends them to the given
+ * index set. Used whole-array in the serial build and per-chunk/per-box
+ * in the parallel and incremental builds; segments record index values
+ * (not positions), so a slice of the array is scanned by passing an
+ * offset base pointer and the slice length.
  *
  ******************************************************************************
  */
-void buildIndexSetAligned(
+void buildIndexSetAlignedPart(
     RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
     camp::resources::Resource& work_res,
     const RAJA::Index_type* const indices_in,
@@ -199,4 +235,163 @@ void buildIndexSetAligned(
   }
 }
 
+}  // unnamed namespace
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set with aligned Range segments and List segments,
+ * as needed, from given array of indices.
+ *
+ * When OpenMP is enabled and the index array is large, the array is split
+ * into chunks at discontinuities in the index sequence (so no candidate
+ * range straddles a chunk boundary), chunks are scanned in parallel into
+ * private index sets, and the results are appended in chunk order.
+ *
+ ******************************************************************************
+ */
+void buildIndexSetAligned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource& work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length,
+    RAJA::Index_type range_align)
+{
+  if (length == 0) return;
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+  const RAJA::Index_type chunk_min_length = 8192;
+  int nthreads = omp_get_max_threads();
+
+  if (nthreads > 1 && length >= 2 * chunk_min_length) {
+
+    /* carve chunks at points where the index sequence breaks so each */
+    /* chunk scans independently and produces the same segments the   */
+    /* serial scan would (modulo the per-chunk repack cutoff)         */
+    std::vector<RAJA::Index_type> chunk_begin;
+    chunk_begin.push_back(0);
+
+    RAJA::Index_type target = length / nthreads;
+    if (target < chunk_min_length) target = chunk_min_length;
+
+    RAJA::Index_type next = target;
+    while (next < length) {
+      RAJA::Index_type split = next;
+      while (split < length && indices_in[split] == indices_in[split - 1] + 1) {
+        ++split;
+      }
+      if (split >= length) break;
+      chunk_begin.push_back(split);
+      next = split + target;
+    }
+
+    size_t nchunks = chunk_begin.size();
+    if (nchunks > 1) {
+      chunk_begin.push_back(length);
+
+      std::vector<RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>>
+          parts(nchunks);
+
+#pragma omp parallel for schedule(static)
+      for (long ic = 0; ic < static_cast<long>(nchunks); ++ic) {
+        buildIndexSetAlignedPart(parts[ic], work_res,
+                                 &indices_in[chunk_begin[ic]],
+                                 chunk_begin[ic + 1] - chunk_begin[ic],
+                                 range_min_length, range_align);
+      }
+
+      for (size_t ic = 0; ic < nchunks; ++ic) {
+        appendSegments(iset, parts[ic]);
+      }
+      return;
+    }
+  }
+#endif
+
+  buildIndexSetAlignedPart(iset, work_res, indices_in, length,
+                           range_min_length, range_align);
+}
+
+
+/*
+ ******************************************************************************
+ *
+ * AlignedIndexSetBuilder methods: maintain per-box segment lists and
+ * regenerate only dirty boxes on rebuild.
+ *
+ ******************************************************************************
+ */
+AlignedIndexSetBuilder::AlignedIndexSetBuilder(
+    camp::resources::Resource work_res,
+    RAJA::Index_type range_min_length,
+    RAJA::Index_type range_align)
+    : m_work_res(work_res),
+      m_range_min_length(range_min_length),
+      m_range_align(range_align)
+{
+}
+
+void AlignedIndexSetBuilder::setBoxes(const RAJA::Index_type* box_offsets,
+                                      const RAJA::Index_type* box_lengths,
+                                      RAJA::Index_type num_boxes)
+{
+  m_box_offsets.assign(box_offsets, box_offsets + num_boxes);
+  m_box_lengths.assign(box_lengths, box_lengths + num_boxes);
+  m_parts.clear();
+  m_parts.resize(num_boxes);
+}
+
+void AlignedIndexSetBuilder::rebuildBox(RAJA::Index_type box,
+                                        const RAJA::Index_type* indices_in)
+{
+  m_parts[box] =
+      RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>();
+  buildIndexSetAlignedPart(m_parts[box], m_work_res,
+                           &indices_in[m_box_offsets[box]],
+                           m_box_lengths[box],
+                           m_range_min_length, m_range_align);
+}
+
+void AlignedIndexSetBuilder::emit(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset)
+{
+  size_t num_boxes = m_parts.size();
+  for (size_t ib = 0; ib < num_boxes; ++ib) {
+    appendSegments(iset, m_parts[ib]);
+  }
+}
+
+void AlignedIndexSetBuilder::rebuild(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    const RAJA::Index_type* indices_in)
+{
+  long num_boxes = static_cast<long>(m_parts.size());
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (long ib = 0; ib < num_boxes; ++ib) {
+    rebuildBox(ib, indices_in);
+  }
+
+  emit(iset);
+}
+
+void AlignedIndexSetBuilder::rebuild(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    const RAJA::Index_type* indices_in,
+    const RAJA::Index_type* dirty_boxes,
+    RAJA::Index_type num_dirty)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (long id = 0; id < static_cast<long>(num_dirty); ++id) {
+    rebuildBox(dirty_boxes[id], indices_in);
+  }
+
+  emit(iset);
+}
+
 }  // namespace RAJA
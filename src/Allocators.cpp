@@ -0,0 +1,73 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for global allocator registration.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/Allocators.hpp"
+
+#include <mutex>
+
+namespace RAJA
+{
+
+namespace util
+{
+
+namespace
+{
+
+//! registered callbacks per space; null allocate means not registered
+AllocatorCallbacks g_allocators[static_cast<int>(
+    AllocatorSpace::num_spaces)] = {};
+
+//! guards registration; lookups are unsynchronized, which is safe
+//  under the documented constraint that registration happens before
+//  any RAJA allocation in the space
+std::mutex g_allocators_mutex;
+
+}  // namespace
+
+void set_allocator(AllocatorSpace space, AllocatorCallbacks callbacks)
+{
+  std::lock_guard<std::mutex> lock(g_allocators_mutex);
+  g_allocators[static_cast<int>(space)] = callbacks;
+}
+
+void reset_allocator(AllocatorSpace space)
+{
+  std::lock_guard<std::mutex> lock(g_allocators_mutex);
+  g_allocators[static_cast<int>(space)] = AllocatorCallbacks{};
+}
+
+bool has_allocator(AllocatorSpace space)
+{
+  return g_allocators[static_cast<int>(space)].allocate != nullptr;
+}
+
+void* callback_allocate(AllocatorSpace space, std::size_t nbytes)
+{
+  AllocatorCallbacks const& cb = g_allocators[static_cast<int>(space)];
+  return cb.allocate(nbytes, cb.user_data);
+}
+
+void callback_deallocate(AllocatorSpace space, void* ptr)
+{
+  AllocatorCallbacks const& cb = g_allocators[static_cast<int>(space)];
+  cb.deallocate(ptr, cb.user_data);
+}
+
+}  // end namespace util
+
+}  // end namespace RAJA
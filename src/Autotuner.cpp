@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/Autotuner.hpp"
+
+#include <cstdlib>
+#include <fstream>
+
+#include "RAJA/util/mutex.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#endif
+
+namespace {
+
+//! per-thread measurement window state for the autotuner plugin
+thread_local bool t_window_open = false;
+thread_local unsigned long t_window_launches = 0;
+thread_local double t_window_time = 0.0;
+
+//! per-thread stack of running timers, to tolerate nested launches
+thread_local std::vector<RAJA::Timer> t_timers;
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+TuningCache& TuningCache::getInstance()
+{
+  static TuningCache cache;
+  return cache;
+}
+
+std::string TuningCache::filePath()
+{
+  const char* env = std::getenv("RAJA_TUNING_CACHE");
+  return env ? std::string(env) : std::string("raja_tuning.cache");
+}
+
+void TuningCache::load()
+{
+  if (m_loaded) {
+    return;
+  }
+  m_loaded = true;
+
+  std::ifstream file(filePath());
+  Entry e;
+  while (file >> e.name >> e.num_variants >> e.winner >> e.time) {
+    m_entries.push_back(e);
+  }
+}
+
+int TuningCache::lookup(const std::string& name, size_t num_variants)
+{
+  lock_guard<std::mutex> lock(m_mutex);
+  load();
+  for (const Entry& e : m_entries) {
+    if (e.name == name && e.num_variants == num_variants &&
+        e.winner < num_variants) {
+      return static_cast<int>(e.winner);
+    }
+  }
+  return -1;
+}
+
+void TuningCache::record(const std::string& name,
+                         size_t num_variants,
+                         size_t winner,
+                         double time)
+{
+  lock_guard<std::mutex> lock(m_mutex);
+  load();
+
+  bool found = false;
+  for (Entry& e : m_entries) {
+    if (e.name == name) {
+      e.num_variants = num_variants;
+      e.winner = winner;
+      e.time = time;
+      found = true;
+      break;
+    }
+  }
+  if (!found) {
+    m_entries.push_back(Entry{name, num_variants, winner, time});
+  }
+
+  std::ofstream file(filePath(), std::ios::trunc);
+  for (const Entry& e : m_entries) {
+    file << e.name << " " << e.num_variants << " " << e.winner << " "
+         << e.time << "\n";
+  }
+}
+
+void AutotunerPlugin::preLaunch(const PluginContext&)
+{
+  if (!t_window_open) {
+    return;
+  }
+  t_timers.emplace_back();
+  t_timers.back().start();
+}
+
+void AutotunerPlugin::postLaunch(const PluginContext& p)
+{
+  if (!t_window_open || t_timers.empty()) {
+    return;
+  }
+
+#if defined(RAJA_ENABLE_CUDA)
+  if (p.platform == Platform::cuda) {
+    cudaErrchk(cudaDeviceSynchronize());
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if (p.platform == Platform::hip) {
+    hipErrchk(hipDeviceSynchronize());
+  }
+#endif
+  RAJA_UNUSED_VAR(p);
+
+  t_timers.back().stop();
+  t_window_time += t_timers.back().elapsed();
+  t_window_launches += 1;
+  t_timers.pop_back();
+}
+
+void AutotunerPlugin::beginWindow()
+{
+  t_window_open = true;
+  t_window_launches = 0;
+  t_window_time = 0.0;
+  t_timers.clear();
+}
+
+double AutotunerPlugin::endWindow(unsigned long* num_launches)
+{
+  t_window_open = false;
+  if (num_launches) {
+    *num_launches = t_window_launches;
+  }
+  return t_window_time;
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+static RAJA::util::PluginRegistry::add<RAJA::util::AutotunerPlugin> P(
+    "autotuner",
+    "Times launches inside autotune() measurement windows.");
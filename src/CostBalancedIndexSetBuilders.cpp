@@ -0,0 +1,92 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for cost-balanced index set builder methods.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <algorithm>
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+namespace RAJA
+{
+
+/*
+ ******************************************************************************
+ *
+ * Cut [0, length) at ideal cost prefix-sum boundaries. Chunk c's cut
+ * point is where the running cost first reaches total * (c+1) /
+ * num_chunks; measuring against the ideal boundary rather than a fixed
+ * per-chunk quota keeps rounding from accumulating into the last chunk.
+ *
+ ******************************************************************************
+ */
+void buildCostBalancedIndexSet(
+    RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
+    const double* costs,
+    RAJA::Index_type length,
+    RAJA::Index_type num_chunks)
+{
+  if (length <= 0) {
+    return;
+  }
+  if (num_chunks < 1) {
+    num_chunks = 1;
+  }
+
+  double total = 0.0;
+  for (RAJA::Index_type i = 0; i < length; ++i) {
+    total += costs[i];
+  }
+
+  if (!(total > 0.0)) {
+    // degenerate weights: fall back to an equal-count partition
+    RAJA::Index_type chunks = std::min(num_chunks, length);
+    for (RAJA::Index_type c = 0; c < chunks; ++c) {
+      RAJA::Index_type begin = (length * c) / chunks;
+      RAJA::Index_type end = (length * (c + 1)) / chunks;
+      iset.push_back(RAJA::RangeSegment(begin, end));
+    }
+    return;
+  }
+
+  RAJA::Index_type begin = 0;
+  double running = 0.0;
+  for (RAJA::Index_type c = 0; c < num_chunks && begin < length; ++c) {
+
+    RAJA::Index_type end = begin;
+    if (c == num_chunks - 1) {
+      // last chunk takes the remainder, including any zero-cost tail
+      end = length;
+    } else {
+      double boundary = (total * (c + 1)) / num_chunks;
+      while (end < length && running < boundary) {
+        running += costs[end];
+        ++end;
+      }
+    }
+
+    if (end > begin) {
+      iset.push_back(RAJA::RangeSegment(begin, end));
+      begin = end;
+    }
+    // end == begin means an expensive earlier iteration already absorbed
+    // this chunk's quota; emit nothing and move to the next boundary
+  }
+}
+
+}  // namespace RAJA
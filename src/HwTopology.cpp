@@ -0,0 +1,183 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for host cache-topology probing.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/HwTopology.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace RAJA
+{
+
+namespace
+{
+
+//! read the first line of a sysfs attribute; empty string on failure
+std::string read_sysfs(std::string const& path)
+{
+  std::ifstream file(path);
+  std::string line;
+  if (file) {
+    std::getline(file, line);
+  }
+  return line;
+}
+
+//! parse a sysfs cache size, e.g. "32K" or "1M"; 0 on failure
+size_t parse_cache_size(std::string const& str)
+{
+  if (str.empty()) {
+    return 0;
+  }
+  char* suffix = nullptr;
+  size_t size = std::strtoul(str.c_str(), &suffix, 10);
+  if (suffix != nullptr) {
+    if (*suffix == 'K') {
+      size *= 1024;
+    } else if (*suffix == 'M') {
+      size *= 1024 * 1024;
+    }
+  }
+  return size;
+}
+
+//! count the cpus named by a sysfs cpu list, e.g. "0-3,64-67"; 0 on
+//  failure
+int parse_cpu_list_count(std::string const& str)
+{
+  int count = 0;
+  const char* pos = str.c_str();
+  while (*pos != '\0') {
+    char* next = nullptr;
+    long first = std::strtol(pos, &next, 10);
+    if (next == pos) {
+      break;
+    }
+    long last = first;
+    if (*next == '-') {
+      pos = next + 1;
+      last = std::strtol(pos, &next, 10);
+    }
+    count += static_cast<int>(last - first) + 1;
+    pos = (*next == ',') ? next + 1 : next;
+  }
+  return count;
+}
+
+HwTopology probe_hw_topology()
+{
+  // conservative defaults for hosts the probe cannot describe: the
+  // common 32KB 8-way L1 geometry and a private 512KB L2, with a 16MB
+  // L3 shared across a 16-thread complex
+  HwTopology topo;
+  topo.num_logical_cpus = 1;
+  topo.cache[0] = {1, 32 * 1024, 64, 2};
+  topo.cache[1] = {2, 512 * 1024, 64, 2};
+  topo.cache[2] = {3, 16 * 1024 * 1024, 64, 16};
+
+#if defined(__linux__)
+
+  long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  if (num_cpus > 0) {
+    topo.num_logical_cpus = static_cast<int>(num_cpus);
+  }
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  // sysconf first: it covers hosts without the sysfs cache
+  // directories, and sysfs refines whatever it reports
+  long l1_size = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+  if (l1_size > 0) {
+    topo.cache[0].size = static_cast<size_t>(l1_size);
+  }
+  long l1_line = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+  if (l1_line > 0) {
+    topo.cache[0].line_size = static_cast<size_t>(l1_line);
+  }
+  long l2_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  if (l2_size > 0) {
+    topo.cache[1].size = static_cast<size_t>(l2_size);
+  }
+  long l3_size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+  if (l3_size > 0) {
+    topo.cache[2].size = static_cast<size_t>(l3_size);
+  }
+#endif
+
+  // all cpus see the same per-core hierarchy, so describing cpu0's
+  // cache directories describes the machine
+  const std::string base = "/sys/devices/system/cpu/cpu0/cache/index";
+  for (int index = 0; index < 16; ++index) {
+    std::string dir = base + std::to_string(index) + "/";
+
+    std::string type = read_sysfs(dir + "type");
+    if (type != "Data" && type != "Unified") {
+      continue;
+    }
+
+    std::string level_str = read_sysfs(dir + "level");
+    if (level_str.empty()) {
+      continue;
+    }
+    int level = std::atoi(level_str.c_str());
+    if (level < 1 || level > HwTopology::max_cache_levels) {
+      continue;
+    }
+    CacheLevel& cache = topo.cache[level - 1];
+
+    // a split data cache describes its level better than a unified one
+    // listed earlier or later at the same level
+    if (type == "Unified" && level == 1) {
+      continue;
+    }
+
+    size_t size = parse_cache_size(read_sysfs(dir + "size"));
+    if (size > 0) {
+      cache.size = size;
+    }
+
+    size_t line_size =
+        parse_cache_size(read_sysfs(dir + "coherency_line_size"));
+    if (line_size > 0) {
+      cache.line_size = line_size;
+    }
+
+    int sharing = parse_cpu_list_count(read_sysfs(dir + "shared_cpu_list"));
+    if (sharing > 0) {
+      cache.sharing = sharing;
+    }
+  }
+
+#endif  // defined(__linux__)
+
+  return topo;
+}
+
+}  // namespace
+
+HwTopology const& hw_topology()
+{
+  static HwTopology topo = probe_hw_topology();
+  return topo;
+}
+
+}  // namespace RAJA
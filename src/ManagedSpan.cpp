@@ -0,0 +1,50 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/ManagedSpan.hpp"
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+namespace detail {
+
+Platform& managedSpanCapturePlatform()
+{
+  static thread_local Platform platform = Platform::undefined;
+  return platform;
+}
+
+}  // namespace detail
+
+/*!
+ * Plugin recording the platform of the launch being captured, so
+ * ManagedSpan copy constructors that run during lambda capture know
+ * where to prefetch their memory. Outside of capture the recorded
+ * platform is undefined and span copies prefetch nothing.
+ */
+class ManagedSpanPlugin : public PluginStrategy
+{
+  public:
+    void preCapture(const PluginContext& p) override
+    {
+      detail::managedSpanCapturePlatform() = p.platform;
+    }
+
+    void postCapture(const PluginContext&) override
+    {
+      detail::managedSpanCapturePlatform() = Platform::undefined;
+    }
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+static RAJA::util::PluginRegistry::add<RAJA::util::ManagedSpanPlugin> P(
+    "managed_span",
+    "Records the capture platform for ManagedSpan prefetching.");
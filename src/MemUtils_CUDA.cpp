@@ -24,6 +24,11 @@
 
 #include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
 
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
 
 namespace RAJA
 {
@@ -45,18 +50,198 @@ namespace detail
 cudaInfo g_status;
 
 //! State of the host code in this thread
-cudaInfo tl_status;
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-#pragma omp threadprivate(tl_status)
-#endif
+thread_local cudaInfo tl_status;
 
 //! State of raja cuda stream synchronization for cuda reducer objects
+RAJA::mutex g_stream_lock;
 std::unordered_map<cudaStream_t, bool> g_stream_info_map{
     {cudaStream_t(0), true}};
 
+RAJA::mutex g_occ_lock;
+
+//! Occupancy-calculator block sizes cached per kernel symbol
+std::unordered_map<const void*, int> g_occ_block_size_map;
+
+//! Occupancy-calculator resident blocks per SM cached per kernel symbol
+std::unordered_map<const void*, int> g_occ_active_blocks_map;
+
+//! Kernel symbols whose launch diagnostics have already been reported
+std::unordered_map<const void*, bool> g_diag_reported_map;
+
+RAJA::mutex g_zero_lock;
+
+//! Device memory blocks awaiting batched zero-initialization
+std::vector<std::pair<void*, size_t>> g_pending_zero_list;
+
+//! Lock-free mirror of g_pending_zero_list's size
+std::atomic<size_t> g_num_pending_zeros{0};
+
+//! Completion events of issued zero batches, per issuing stream
+std::vector<std::pair<cudaStream_t, cudaEvent_t>> g_zero_event_list;
+
+//! Lock-free mirror of g_zero_event_list's size
+std::atomic<size_t> g_num_zero_events{0};
+
+//! Resource footprints recorded at first launch, per kernel symbol.
+//  File-local: the header-inline launch path only calls through the
+//  non-inline recording functions below.
+namespace {
+RAJA::mutex g_resource_lock;
+std::map<const void*, KernelResourceUsage> g_resource_usage_map;
+}  // namespace
+
 
 }  // namespace detail
 
+bool kernel_diagnostics_enabled()
+{
+  static const bool enabled =
+      (std::getenv("RAJA_CUDA_KERNEL_DIAGNOSTICS") != nullptr);
+  return enabled;
+}
+
+void kernel_launch_diagnostics(const void* func,
+                               cuda_dim_t blocks,
+                               cuda_dim_t threads,
+                               size_t dynamic_shmem)
+{
+  if (!kernel_diagnostics_enabled()) {
+    return;
+  }
+
+  {
+    lock_guard<RAJA::mutex> lock(detail::g_occ_lock);
+    if (!detail::g_diag_reported_map.emplace(func, true).second) {
+      return;
+    }
+  }
+
+  cudaFuncAttributes attr;
+  if (cudaFuncGetAttributes(&attr, func) != cudaSuccess) {
+    cudaGetLastError();
+    return;
+  }
+
+  cudaDeviceProp& prop = device_prop();
+
+  int block_size = static_cast<int>(threads.x * threads.y * threads.z);
+  int warp_size = prop.warpSize;
+  int num_warps = (block_size + warp_size - 1) / warp_size;
+  int last_warp_fill = block_size - (num_warps - 1) * warp_size;
+
+  // occupancy_max_active_blocks_per_sm takes the status lock itself
+  int active_blocks =
+      occupancy_max_active_blocks_per_sm(func, block_size, dynamic_shmem);
+
+  size_t shmem_per_block = attr.sharedSizeBytes + dynamic_shmem;
+  size_t shmem_per_sm = shmem_per_block * static_cast<size_t>(active_blocks);
+  double occupancy = 100.0 * static_cast<double>(active_blocks * block_size) /
+                     static_cast<double>(prop.maxThreadsPerMultiProcessor);
+
+  fprintf(stderr,
+          "RAJA CUDA kernel diagnostics for kernel %p:\n"
+          "  launch shape: grid (%u, %u, %u), block (%u, %u, %u), "
+          "%d threads/block in %d warps\n",
+          func,
+          blocks.x, blocks.y, blocks.z,
+          threads.x, threads.y, threads.z,
+          block_size, num_warps);
+
+  if (last_warp_fill != warp_size) {
+    fprintf(stderr,
+            "  WARNING: block size %d is not a multiple of the warp size "
+            "%d; the last warp of every block runs %d/%d threads\n",
+            block_size, warp_size, last_warp_fill, warp_size);
+  }
+
+  fprintf(stderr,
+          "  shared memory: %zu bytes/block (%zu static + %zu dynamic), "
+          "%zu of %zu bytes/SM at %d resident blocks\n",
+          shmem_per_block, attr.sharedSizeBytes, dynamic_shmem,
+          shmem_per_sm, prop.sharedMemPerMultiprocessor, active_blocks);
+
+  fprintf(stderr,
+          "  predicted occupancy: %d blocks/SM, %.1f%% of %d threads/SM\n",
+          active_blocks, occupancy, prop.maxThreadsPerMultiProcessor);
+
+  if (occupancy < 50.0) {
+    fprintf(stderr,
+            "  WARNING: predicted occupancy is below 50%%; consider "
+            "resizing tiles or thread mappings in the kernel policy\n");
+  }
+}
+
+void record_kernel_resource_usage(const void* func, size_t param_bytes)
+{
+  {
+    lock_guard<RAJA::mutex> lock(detail::g_resource_lock);
+    if (detail::g_resource_usage_map.count(func)) {
+      return;
+    }
+  }
+
+  cudaFuncAttributes attr;
+  if (cudaFuncGetAttributes(&attr, func) != cudaSuccess) {
+    cudaGetLastError();
+    return;
+  }
+
+  KernelResourceUsage usage;
+  usage.func = func;
+  usage.param_bytes = param_bytes;
+  usage.local_bytes = attr.localSizeBytes;
+  usage.shared_bytes = attr.sharedSizeBytes;
+  usage.const_bytes = attr.constSizeBytes;
+  usage.num_regs = attr.numRegs;
+  usage.max_threads_per_block = attr.maxThreadsPerBlock;
+
+  {
+    lock_guard<RAJA::mutex> lock(detail::g_resource_lock);
+    if (!detail::g_resource_usage_map.emplace(func, usage).second) {
+      return;
+    }
+  }
+
+  if (!kernel_diagnostics_enabled()) {
+    return;
+  }
+
+  fprintf(stderr,
+          "RAJA CUDA kernel resource usage for kernel %p:\n"
+          "  %zu parameter bytes, %d registers/thread, %zu bytes local "
+          "memory/thread, %zu bytes static shared memory/block, "
+          "%d max threads/block\n",
+          func,
+          usage.param_bytes, usage.num_regs, usage.local_bytes,
+          usage.shared_bytes, usage.max_threads_per_block);
+
+  if (usage.param_bytes > kernel_param_space_limit / 2) {
+    fprintf(stderr,
+            "  WARNING: kernel parameters use %zu of %zu bytes of "
+            "parameter space; consider trimming lambda captures or "
+            "moving cold state into a parameter block\n",
+            usage.param_bytes, kernel_param_space_limit);
+  }
+
+  if (usage.local_bytes > 0) {
+    fprintf(stderr,
+            "  WARNING: %zu bytes of local memory per thread; register "
+            "or parameter spills are hitting device memory\n",
+            usage.local_bytes);
+  }
+}
+
+std::vector<KernelResourceUsage> kernel_resource_usage()
+{
+  lock_guard<RAJA::mutex> lock(detail::g_resource_lock);
+  std::vector<KernelResourceUsage> usage;
+  usage.reserve(detail::g_resource_usage_map.size());
+  for (auto const& entry : detail::g_resource_usage_map) {
+    usage.push_back(entry.second);
+  }
+  return usage;
+}
+
 }  // namespace cuda
 
 }  // namespace RAJA
@@ -45,12 +45,10 @@ namespace detail
 hipInfo g_status;
 
 //! State of the host code in this thread
-hipInfo tl_status;
-#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
-#pragma omp threadprivate(tl_status)
-#endif
+thread_local hipInfo tl_status;
 
 //! State of raja hip stream synchronization for hip reducer objects
+RAJA::mutex g_stream_lock;
 std::unordered_map<hipStream_t, bool> g_stream_info_map{
     {hipStream_t(0), true}};
 
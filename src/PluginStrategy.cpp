@@ -24,6 +24,20 @@ void PluginStrategy::preLaunch(const PluginContext&) { }
 
 void PluginStrategy::postLaunch(const PluginContext&) { }
 
+bool PluginStrategy::usesBatchedNotification() { return false; }
+
+void PluginStrategy::preLaunchBatch(const PluginContext&, size_t) { }
+
+void PluginStrategy::postLaunchBatch(const PluginContext&, size_t) { }
+
+std::vector<PluginDispatch>& plugin_dispatch()
+{
+  static std::vector<PluginDispatch> dispatch_table;
+  return dispatch_table;
+}
+
+void PluginStrategy::registerBuffer(const TransferBufferInfo&) { }
+
 void PluginStrategy::finalize() { }
 
 }
@@ -0,0 +1,152 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/ProfilingPlugin.hpp"
+
+#if defined(RAJA_ENABLE_PROFILING_PLUGIN)
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/mutex.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#endif
+
+namespace {
+
+constexpr int num_platforms = 5;
+
+int platformIndex(RAJA::Platform platform)
+{
+  switch (platform) {
+    case RAJA::Platform::host: return 1;
+    case RAJA::Platform::cuda: return 2;
+    case RAJA::Platform::omp_target: return 3;
+    case RAJA::Platform::hip: return 4;
+    default: return 0;
+  }
+}
+
+const char* platformName(int index)
+{
+  static const char* names[num_platforms] = {
+      "undefined", "host", "cuda", "omp_target", "hip"};
+  return names[index];
+}
+
+bool syncLaunches()
+{
+  static bool sync = (std::getenv("RAJA_PROFILE_NOSYNC") == nullptr);
+  return sync;
+}
+
+std::mutex stats_mutex;
+
+std::array<RAJA::util::ProfilingPlugin::LaunchStats, num_platforms> g_stats;
+
+//! per-thread stack of running timers, to tolerate nested launches
+thread_local std::vector<RAJA::Timer> t_timers;
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+void ProfilingPlugin::preLaunch(const PluginContext&)
+{
+  t_timers.emplace_back();
+  t_timers.back().start();
+}
+
+void ProfilingPlugin::postLaunch(const PluginContext& p)
+{
+  if (t_timers.empty()) {
+    return;
+  }
+
+  if (syncLaunches()) {
+#if defined(RAJA_ENABLE_CUDA)
+    if (p.platform == Platform::cuda) {
+      cudaErrchk(cudaDeviceSynchronize());
+    }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+    if (p.platform == Platform::hip) {
+      hipErrchk(hipDeviceSynchronize());
+    }
+#endif
+  }
+
+  t_timers.back().stop();
+  double elapsed = t_timers.back().elapsed();
+  t_timers.pop_back();
+
+  lock_guard<std::mutex> lock(stats_mutex);
+  LaunchStats& stats = g_stats[platformIndex(p.platform)];
+  if (stats.num_launches == 0 || elapsed < stats.min_time) {
+    stats.min_time = elapsed;
+  }
+  if (elapsed > stats.max_time) {
+    stats.max_time = elapsed;
+  }
+  stats.total_time += elapsed;
+  stats.num_launches += 1;
+}
+
+void ProfilingPlugin::finalize()
+{
+  lock_guard<std::mutex> lock(stats_mutex);
+  fprintf(stderr, "RAJA profiling plugin summary\n");
+  for (int i = 0; i < num_platforms; ++i) {
+    const LaunchStats& stats = g_stats[i];
+    if (stats.num_launches == 0) {
+      continue;
+    }
+    fprintf(stderr,
+            "  %-10s launches: %10lu  total: %.6fs  "
+            "min: %.3es  avg: %.3es  max: %.3es\n",
+            platformName(i),
+            stats.num_launches,
+            stats.total_time,
+            stats.min_time,
+            stats.total_time / static_cast<double>(stats.num_launches),
+            stats.max_time);
+  }
+}
+
+ProfilingPlugin::LaunchStats ProfilingPlugin::getStats(Platform platform)
+{
+  lock_guard<std::mutex> lock(stats_mutex);
+  return g_stats[platformIndex(platform)];
+}
+
+void ProfilingPlugin::resetStats()
+{
+  lock_guard<std::mutex> lock(stats_mutex);
+  for (LaunchStats& stats : g_stats) {
+    stats = LaunchStats{};
+  }
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+static RAJA::util::PluginRegistry::add<RAJA::util::ProfilingPlugin> P(
+    "profiling",
+    "Aggregates per-platform kernel launch counts and wall times.");
+
+#endif  // closing endif for RAJA_ENABLE_PROFILING_PLUGIN
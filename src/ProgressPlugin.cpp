@@ -0,0 +1,194 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/ProgressPlugin.hpp"
+
+#if defined(RAJA_ENABLE_PROGRESS_PLUGIN)
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "RAJA/util/mutex.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#endif
+
+namespace {
+
+double timeNow()
+{
+  using clock = std::chrono::steady_clock;
+  return std::chrono::duration<double>(clock::now().time_since_epoch())
+      .count();
+}
+
+std::mutex progress_mutex;
+
+unsigned long g_launches_started = 0;
+unsigned long g_launches_completed = 0;
+
+//! start times of launches currently in flight, in no particular order
+std::vector<double> g_active_starts;
+
+//! per-thread stack of this thread's launch start times, for nesting
+thread_local std::vector<double> t_starts;
+
+std::vector<RAJA::util::ProgressCounter*> g_counters;
+
+//! allocate one counter slab in host-visible memory
+unsigned long long* allocateSlab()
+{
+  unsigned long long* slab = nullptr;
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk(cudaHostAlloc(reinterpret_cast<void**>(&slab),
+                           sizeof(unsigned long long),
+                           cudaHostAllocMapped | cudaHostAllocPortable));
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk(hipHostMalloc(reinterpret_cast<void**>(&slab),
+                          sizeof(unsigned long long),
+                          hipHostMallocMapped | hipHostMallocPortable));
+#else
+  slab = new unsigned long long;
+#endif
+  *slab = 0;
+  return slab;
+}
+
+void freeSlab(unsigned long long* slab)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk(cudaFreeHost(slab));
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk(hipHostFree(slab));
+#else
+  delete slab;
+#endif
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+ProgressCounter::ProgressCounter(const char* name,
+                                 unsigned long long num_chunks)
+    : m_name(name), m_total(num_chunks), m_slab(allocateSlab())
+{
+  lock_guard<std::mutex> lock(progress_mutex);
+  g_counters.push_back(this);
+}
+
+ProgressCounter::~ProgressCounter()
+{
+  {
+    lock_guard<std::mutex> lock(progress_mutex);
+    g_counters.erase(std::find(g_counters.begin(), g_counters.end(), this));
+  }
+  freeSlab(m_slab);
+}
+
+unsigned long long ProgressCounter::completed() const
+{
+  return *static_cast<volatile unsigned long long*>(m_slab);
+}
+
+void ProgressCounter::reset()
+{
+  *static_cast<volatile unsigned long long*>(m_slab) = 0;
+}
+
+void ProgressPlugin::preLaunch(const PluginContext&)
+{
+  double start = timeNow();
+  t_starts.push_back(start);
+
+  lock_guard<std::mutex> lock(progress_mutex);
+  g_launches_started += 1;
+  g_active_starts.push_back(start);
+}
+
+void ProgressPlugin::postLaunch(const PluginContext&)
+{
+  if (t_starts.empty()) {
+    return;
+  }
+  double start = t_starts.back();
+  t_starts.pop_back();
+
+  lock_guard<std::mutex> lock(progress_mutex);
+  g_launches_completed += 1;
+  auto iter =
+      std::find(g_active_starts.begin(), g_active_starts.end(), start);
+  if (iter != g_active_starts.end()) {
+    g_active_starts.erase(iter);
+  }
+}
+
+ProgressPlugin::Snapshot ProgressPlugin::poll()
+{
+  lock_guard<std::mutex> lock(progress_mutex);
+  Snapshot snap;
+  snap.launches_started = g_launches_started;
+  snap.launches_completed = g_launches_completed;
+  if (!g_active_starts.empty()) {
+    double oldest =
+        *std::min_element(g_active_starts.begin(), g_active_starts.end());
+    snap.oldest_running_seconds = timeNow() - oldest;
+  }
+  return snap;
+}
+
+void ProgressPlugin::writeReport(FILE* to)
+{
+  Snapshot snap = poll();
+  fprintf(to,
+          "RAJA progress: launches started: %lu  completed: %lu",
+          snap.launches_started,
+          snap.launches_completed);
+  if (snap.oldest_running_seconds > 0.0) {
+    fprintf(to, "  oldest running: %.3fs", snap.oldest_running_seconds);
+  }
+  fprintf(to, "\n");
+
+  lock_guard<std::mutex> lock(progress_mutex);
+  for (ProgressCounter* counter : g_counters) {
+    unsigned long long done = counter->completed();
+    unsigned long long total = counter->total();
+    fprintf(to,
+            "  %-20s chunks: %llu / %llu (%.1f%%)\n",
+            counter->name().c_str(),
+            done,
+            total,
+            total != 0 ? 100.0 * static_cast<double>(done) /
+                             static_cast<double>(total)
+                       : 0.0);
+  }
+}
+
+void ProgressPlugin::resetLaunchCounts()
+{
+  lock_guard<std::mutex> lock(progress_mutex);
+  g_launches_started = 0;
+  g_launches_completed = 0;
+  g_active_starts.clear();
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+static RAJA::util::PluginRegistry::add<RAJA::util::ProgressPlugin> P(
+    "progress",
+    "Tracks launch and chunk completion progress for external watchdogs.");
+
+#endif  // closing endif for RAJA_ENABLE_PROGRESS_PLUGIN
@@ -0,0 +1,137 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/RaceCheckPlugin.hpp"
+
+#if defined(RAJA_ENABLE_RACE_CHECK_PLUGIN)
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+#include "RAJA/util/mutex.hpp"
+
+namespace {
+
+using RAJA::util::race_check::ShadowRecord;
+using RAJA::util::race_check::shadow_line_bytes;
+
+struct OwnedShadow {
+  ShadowRecord record;
+  std::unique_ptr<std::atomic<unsigned>[]> storage;
+};
+
+//! guards the registry; the per-write hot path only touches the line
+//  arrays, never the registry itself
+std::mutex shadow_mutex;
+
+std::vector<std::unique_ptr<OwnedShadow>> g_shadows;
+
+//! conflicts gathered by the most recent postLaunch
+std::vector<RAJA::util::RaceCheckPlugin::Conflict> g_last_conflicts;
+
+void clear_shadow(ShadowRecord& shadow)
+{
+  for (size_t line = 0; line < shadow.num_lines; ++line) {
+    shadow.lines[line].store(0, std::memory_order_relaxed);
+  }
+  shadow.num_conflicts.store(0, std::memory_order_relaxed);
+  shadow.first_conflict_line.store(~size_t(0), std::memory_order_relaxed);
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+namespace race_check {
+
+ShadowRecord* register_shadow(const std::string& name,
+                              const void* base,
+                              size_t num_bytes)
+{
+  auto shadow = std::unique_ptr<OwnedShadow>(new OwnedShadow);
+
+  size_t num_lines =
+      (num_bytes + shadow_line_bytes - 1) / shadow_line_bytes;
+  shadow->storage.reset(new std::atomic<unsigned>[num_lines]);
+
+  shadow->record.name = name;
+  shadow->record.base = static_cast<const char*>(base);
+  shadow->record.num_bytes = num_bytes;
+  shadow->record.num_lines = num_lines;
+  shadow->record.lines = shadow->storage.get();
+  clear_shadow(shadow->record);
+
+  lock_guard<std::mutex> lock(shadow_mutex);
+  g_shadows.push_back(std::move(shadow));
+  return &g_shadows.back()->record;
+}
+
+}  // namespace race_check
+
+void RaceCheckPlugin::preLaunch(const PluginContext&)
+{
+  lock_guard<std::mutex> lock(shadow_mutex);
+  for (auto& shadow : g_shadows) {
+    clear_shadow(shadow->record);
+  }
+}
+
+void RaceCheckPlugin::postLaunch(const PluginContext&)
+{
+  lock_guard<std::mutex> lock(shadow_mutex);
+  g_last_conflicts.clear();
+  for (auto& shadow : g_shadows) {
+    ShadowRecord& record = shadow->record;
+    unsigned long num_conflicts =
+        record.num_conflicts.load(std::memory_order_relaxed);
+    if (num_conflicts == 0) {
+      continue;
+    }
+    size_t first_line =
+        record.first_conflict_line.load(std::memory_order_relaxed);
+    size_t first_offset = first_line * shadow_line_bytes;
+    g_last_conflicts.push_back(
+        Conflict{record.name, num_conflicts, first_offset});
+    fprintf(stderr,
+            "RAJA race check: view '%s' saw %lu cross-worker write "
+            "overlaps this launch, first near byte offset %zu\n",
+            record.name.c_str(), num_conflicts, first_offset);
+  }
+}
+
+void RaceCheckPlugin::finalize()
+{
+  lock_guard<std::mutex> lock(shadow_mutex);
+  size_t num_shadows = g_shadows.size();
+  fprintf(stderr,
+          "RAJA race check plugin: %zu view(s) were checked\n",
+          num_shadows);
+}
+
+std::vector<RaceCheckPlugin::Conflict> RaceCheckPlugin::getConflicts()
+{
+  lock_guard<std::mutex> lock(shadow_mutex);
+  return g_last_conflicts;
+}
+
+void RaceCheckPlugin::resetShadows()
+{
+  lock_guard<std::mutex> lock(shadow_mutex);
+  g_shadows.clear();
+  g_last_conflicts.clear();
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+static RAJA::util::PluginRegistry::add<RAJA::util::RaceCheckPlugin> P(
+    "race-check",
+    "Flags cross-worker write overlaps through checked views.");
+
+#endif  // closing endif for RAJA_ENABLE_RACE_CHECK_PLUGIN
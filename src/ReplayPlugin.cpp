@@ -0,0 +1,297 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/ReplayPlugin.hpp"
+
+#if defined(RAJA_ENABLE_REPLAY_PLUGIN)
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/mutex.hpp"
+
+namespace {
+
+//! identifies the file format; bump the version on layout changes
+const char magic[8] = {'R', 'A', 'J', 'A', 'R', 'P', 'L', '1'};
+
+struct RegisteredArray {
+  std::string name;
+  const void* ptr;
+  std::size_t elem_size;
+  std::size_t num_elems;
+};
+
+std::mutex replay_mutex;
+
+std::vector<RegisteredArray> g_arrays;
+
+//! launches seen so far per call site, for RAJA_REPLAY_INDEX selection
+std::map<std::string, unsigned long> g_site_counts;
+
+bool g_captured = false;
+
+//! call site to capture, empty when the plugin is not armed
+std::string g_target_site;
+
+unsigned long g_target_index = 0;
+
+std::string g_file_name;
+
+//! call-site label for launches on this thread; nullptr is unattributed
+thread_local const char* t_call_site = nullptr;
+
+//! extents described for the next launch on this thread
+thread_local std::vector<RAJA::util::replay::Record::Extent> t_segments;
+
+bool writeBytes(FILE* f, const void* p, std::size_t n)
+{
+  return std::fwrite(p, 1, n, f) == n;
+}
+
+bool writeU64(FILE* f, std::uint64_t v)
+{
+  return writeBytes(f, &v, sizeof(v));
+}
+
+bool writeI64(FILE* f, std::int64_t v)
+{
+  return writeBytes(f, &v, sizeof(v));
+}
+
+bool writeString(FILE* f, const std::string& s)
+{
+  return writeU64(f, s.size()) && writeBytes(f, s.data(), s.size());
+}
+
+bool readBytes(FILE* f, void* p, std::size_t n)
+{
+  return std::fread(p, 1, n, f) == n;
+}
+
+bool readU64(FILE* f, std::uint64_t& v)
+{
+  return readBytes(f, &v, sizeof(v));
+}
+
+bool readI64(FILE* f, std::int64_t& v)
+{
+  return readBytes(f, &v, sizeof(v));
+}
+
+bool readString(FILE* f, std::string& s)
+{
+  std::uint64_t len = 0;
+  if (!readU64(f, len)) {
+    return false;
+  }
+  s.resize(len);
+  return len == 0 || readBytes(f, &s[0], len);
+}
+
+//
+// Write the capture record; called with replay_mutex held, after the
+// per-thread state has been copied into the arguments.
+//
+bool writeRecord(const char* site,
+                 RAJA::Platform platform,
+                 const std::vector<RAJA::util::replay::Record::Extent>& segs)
+{
+  FILE* f = std::fopen(g_file_name.c_str(), "wb");
+  if (f == nullptr) {
+    return false;
+  }
+
+  bool ok = writeBytes(f, magic, sizeof(magic)) &&
+            writeString(f, site) &&
+            writeI64(f, static_cast<std::int64_t>(platform)) &&
+            writeU64(f, segs.size());
+  for (std::size_t i = 0; ok && i < segs.size(); ++i) {
+    ok = writeI64(f, segs[i].begin) && writeI64(f, segs[i].end);
+  }
+
+  ok = ok && writeU64(f, g_arrays.size());
+  for (std::size_t i = 0; ok && i < g_arrays.size(); ++i) {
+    const RegisteredArray& a = g_arrays[i];
+    ok = writeString(f, a.name) &&
+         writeU64(f, a.elem_size) &&
+         writeU64(f, a.num_elems) &&
+         writeBytes(f, a.ptr, a.elem_size * a.num_elems);
+  }
+
+  return (std::fclose(f) == 0) && ok;
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+namespace replay {
+
+void setCallSite(const char* name) { t_call_site = name; }
+
+CallSite::CallSite(const char* name) { setCallSite(name); }
+
+CallSite::~CallSite() { setCallSite(nullptr); }
+
+void describeSegment(long begin, long end)
+{
+  t_segments.push_back(Record::Extent{begin, end});
+}
+
+void registerArray(const char* name,
+                   const void* ptr,
+                   std::size_t elem_size,
+                   std::size_t num_elems)
+{
+  lock_guard<std::mutex> lock(replay_mutex);
+  g_arrays.push_back(RegisteredArray{name, ptr, elem_size, num_elems});
+}
+
+void deregisterArray(const void* ptr)
+{
+  lock_guard<std::mutex> lock(replay_mutex);
+  for (std::size_t i = 0; i < g_arrays.size(); ++i) {
+    if (g_arrays[i].ptr == ptr) {
+      g_arrays.erase(g_arrays.begin() + i);
+      return;
+    }
+  }
+}
+
+bool Record::load(const char* path)
+{
+  FILE* f = std::fopen(path, "rb");
+  if (f == nullptr) {
+    return false;
+  }
+
+  char header[sizeof(magic)];
+  bool ok = readBytes(f, header, sizeof(header)) &&
+            std::memcmp(header, magic, sizeof(magic)) == 0;
+
+  std::int64_t plat = 0;
+  std::uint64_t num_segments = 0;
+  ok = ok && readString(f, call_site) && readI64(f, plat) &&
+       readU64(f, num_segments);
+  platform = static_cast<Platform>(plat);
+
+  segments.clear();
+  for (std::uint64_t i = 0; ok && i < num_segments; ++i) {
+    std::int64_t begin = 0;
+    std::int64_t end = 0;
+    ok = readI64(f, begin) && readI64(f, end);
+    segments.push_back(Extent{static_cast<long>(begin),
+                              static_cast<long>(end)});
+  }
+
+  std::uint64_t num_arrays = 0;
+  ok = ok && readU64(f, num_arrays);
+
+  snapshots.clear();
+  for (std::uint64_t i = 0; ok && i < num_arrays; ++i) {
+    ArraySnapshot snap;
+    std::uint64_t elem_size = 0;
+    std::uint64_t num_elems = 0;
+    ok = readString(f, snap.name) && readU64(f, elem_size) &&
+         readU64(f, num_elems);
+    if (ok) {
+      snap.elem_size = elem_size;
+      snap.num_elems = num_elems;
+      snap.data.resize(elem_size * num_elems);
+      ok = snap.data.empty() ||
+           readBytes(f, snap.data.data(), snap.data.size());
+      snapshots.push_back(std::move(snap));
+    }
+  }
+
+  std::fclose(f);
+  return ok;
+}
+
+const ArraySnapshot* Record::find(const char* name) const
+{
+  for (const ArraySnapshot& snap : snapshots) {
+    if (snap.name == name) {
+      return &snap;
+    }
+  }
+  return nullptr;
+}
+
+} // closing brace for replay namespace
+
+void ReplayPlugin::init(const PluginOptions&)
+{
+  const char* site = std::getenv("RAJA_REPLAY_CAPTURE");
+  g_target_site = site ? site : "";
+
+  const char* index = std::getenv("RAJA_REPLAY_INDEX");
+  g_target_index = index ? std::strtoul(index, nullptr, 10) : 0;
+
+  const char* file = std::getenv("RAJA_REPLAY_FILE");
+  g_file_name = file ? file : "raja_replay.bin";
+}
+
+void ReplayPlugin::preLaunch(const PluginContext& p)
+{
+  if (g_target_site.empty() || t_call_site == nullptr ||
+      g_target_site != t_call_site) {
+    return;
+  }
+
+  lock_guard<std::mutex> lock(replay_mutex);
+  if (g_captured || g_site_counts[g_target_site] != g_target_index) {
+    return;
+  }
+  g_captured = true;
+
+  if (!writeRecord(t_call_site, p.platform, t_segments)) {
+    fprintf(stderr,
+            "RAJA replay plugin: failed to write capture of \"%s\" "
+            "to %s\n",
+            t_call_site,
+            g_file_name.c_str());
+  }
+}
+
+void ReplayPlugin::postLaunch(const PluginContext&)
+{
+  if (t_call_site != nullptr) {
+    lock_guard<std::mutex> lock(replay_mutex);
+    g_site_counts[t_call_site] += 1;
+  }
+  t_segments.clear();
+}
+
+void ReplayPlugin::finalize()
+{
+  lock_guard<std::mutex> lock(replay_mutex);
+  if (!g_target_site.empty() && !g_captured) {
+    fprintf(stderr,
+            "RAJA replay plugin: call site \"%s\" launch %lu was "
+            "never reached, nothing captured\n",
+            g_target_site.c_str(),
+            g_target_index);
+  }
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+static RAJA::util::PluginRegistry::add<RAJA::util::ReplayPlugin> P(
+    "replay",
+    "Captures one labeled kernel launch to a file for off-line replay.");
+
+#endif  // closing endif for RAJA_ENABLE_REPLAY_PLUGIN
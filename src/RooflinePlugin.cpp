@@ -0,0 +1,211 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/RooflinePlugin.hpp"
+
+#if defined(RAJA_ENABLE_ROOFLINE_PLUGIN)
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <papi.h>
+
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/mutex.hpp"
+
+namespace {
+
+//! bytes charged per last-level cache miss
+long long lineBytes()
+{
+  static long long bytes = [] {
+    const char* env = std::getenv("RAJA_ROOFLINE_LINE_BYTES");
+    return env ? std::atoll(env) : 64ll;
+  }();
+  return bytes;
+}
+
+double envPeak(const char* name)
+{
+  const char* env = std::getenv(name);
+  return env ? std::atof(env) : 0.0;
+}
+
+struct CallSiteStats {
+  unsigned long num_launches = 0;
+  double total_time = 0.0;
+  long long total_flops = 0;
+  long long total_misses = 0;
+};
+
+std::mutex stats_mutex;
+
+std::map<std::string, CallSiteStats> g_stats;
+
+//! call-site label for launches on this thread; nullptr is unattributed
+thread_local const char* t_call_site = nullptr;
+
+//! one counter snapshot per in-flight launch, to tolerate nesting
+struct Snapshot {
+  RAJA::Timer timer;
+  long long counts[2] = {0, 0};
+};
+
+thread_local std::vector<Snapshot> t_snapshots;
+
+//
+// Per-thread PAPI event set holding the FLOP and last-level-miss
+// events; PAPI_NULL when counter setup failed on this thread, in which
+// case launches are still counted and timed.
+//
+int threadEventSet()
+{
+  static thread_local int event_set = [] {
+    if (!PAPI_is_initialized()) {
+      return PAPI_NULL;
+    }
+    int es = PAPI_NULL;
+    if (PAPI_create_eventset(&es) != PAPI_OK) {
+      return PAPI_NULL;
+    }
+    if (PAPI_add_event(es, PAPI_DP_OPS) != PAPI_OK &&
+        PAPI_add_event(es, PAPI_FP_OPS) != PAPI_OK) {
+      PAPI_destroy_eventset(&es);
+      return PAPI_NULL;
+    }
+    if (PAPI_add_event(es, PAPI_L3_TCM) != PAPI_OK &&
+        PAPI_add_event(es, PAPI_L2_TCM) != PAPI_OK) {
+      PAPI_destroy_eventset(&es);
+      return PAPI_NULL;
+    }
+    if (PAPI_start(es) != PAPI_OK) {
+      PAPI_destroy_eventset(&es);
+      return PAPI_NULL;
+    }
+    return es;
+  }();
+  return event_set;
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+namespace roofline {
+
+void setCallSite(const char* name) { t_call_site = name; }
+
+CallSite::CallSite(const char* name) { setCallSite(name); }
+
+CallSite::~CallSite() { setCallSite(nullptr); }
+
+} // closing brace for roofline namespace
+
+void RooflinePlugin::init(const PluginOptions&)
+{
+  if (!PAPI_is_initialized()) {
+    if (PAPI_library_init(PAPI_VER_CURRENT) != PAPI_VER_CURRENT) {
+      fprintf(stderr,
+              "RAJA roofline plugin: PAPI initialization failed, "
+              "only launch counts and times will be reported\n");
+    }
+  }
+}
+
+void RooflinePlugin::preLaunch(const PluginContext&)
+{
+  t_snapshots.emplace_back();
+  Snapshot& snap = t_snapshots.back();
+
+  int es = threadEventSet();
+  if (es != PAPI_NULL) {
+    PAPI_read(es, snap.counts);
+  }
+  snap.timer.start();
+}
+
+void RooflinePlugin::postLaunch(const PluginContext& p)
+{
+  if (t_snapshots.empty()) {
+    return;
+  }
+
+  Snapshot& snap = t_snapshots.back();
+  snap.timer.stop();
+
+  long long flops = 0;
+  long long misses = 0;
+  int es = threadEventSet();
+  // counters only reflect host execution on the launching thread
+  if (es != PAPI_NULL && p.platform == Platform::host) {
+    long long counts[2] = {0, 0};
+    PAPI_read(es, counts);
+    flops = counts[0] - snap.counts[0];
+    misses = counts[1] - snap.counts[1];
+  }
+  double elapsed = snap.timer.elapsed();
+
+  const char* site = t_call_site ? t_call_site : "<unattributed>";
+
+  t_snapshots.pop_back();
+
+  lock_guard<std::mutex> lock(stats_mutex);
+  CallSiteStats& stats = g_stats[site];
+  stats.num_launches += 1;
+  stats.total_time += elapsed;
+  stats.total_flops += flops;
+  stats.total_misses += misses;
+}
+
+void RooflinePlugin::finalize()
+{
+  double peak_gflops = envPeak("RAJA_ROOFLINE_PEAK_GFLOPS");
+  double peak_gbps = envPeak("RAJA_ROOFLINE_PEAK_GBPS");
+
+  lock_guard<std::mutex> lock(stats_mutex);
+  fprintf(stderr, "RAJA roofline plugin summary\n");
+  for (auto const& entry : g_stats) {
+    const CallSiteStats& stats = entry.second;
+    if (stats.num_launches == 0 || stats.total_time <= 0.0) {
+      continue;
+    }
+
+    double gflops = stats.total_flops / stats.total_time * 1.0e-9;
+    double gbps =
+        stats.total_misses * lineBytes() / stats.total_time * 1.0e-9;
+
+    fprintf(stderr,
+            "  %-24s launches: %8lu  total: %.6fs  "
+            "%8.3f GFLOP/s  %8.3f GB/s",
+            entry.first.c_str(),
+            stats.num_launches,
+            stats.total_time,
+            gflops,
+            gbps);
+    if (peak_gflops > 0.0 && peak_gbps > 0.0) {
+      fprintf(stderr,
+              "  (%5.1f%% / %5.1f%% of peak)",
+              100.0 * gflops / peak_gflops,
+              100.0 * gbps / peak_gbps);
+    }
+    fprintf(stderr, "\n");
+  }
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+static RAJA::util::PluginRegistry::add<RAJA::util::RooflinePlugin> P(
+    "roofline",
+    "Aggregates per-call-site FLOP rates and bandwidth from PAPI counters.");
+
+#endif  // closing endif for RAJA_ENABLE_ROOFLINE_PLUGIN
@@ -0,0 +1,225 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/TransferAdvisorPlugin.hpp"
+
+#if defined(RAJA_ENABLE_TRANSFER_ADVISOR_PLUGIN)
+
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "RAJA/util/mutex.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include <cuda_runtime.h>
+#endif
+
+namespace {
+
+std::size_t envBytes(const char* name, std::size_t default_value)
+{
+  const char* str = std::getenv(name);
+  if (str == nullptr) {
+    return default_value;
+  }
+  return static_cast<std::size_t>(std::strtoull(str, nullptr, 10));
+}
+
+std::mutex advisor_mutex;
+
+std::size_t g_threshold = 1024 * 1024;
+std::size_t g_pin_budget = 0;
+
+std::map<std::string, RAJA::util::TransferAdvisorPlugin::SiteStats> g_stats;
+
+#if defined(RAJA_ENABLE_CUDA)
+
+struct PinnedBuffer {
+  const void* ptr;
+  std::size_t size;
+};
+
+//! most recently used pins at the front; total bounded by g_pin_budget
+std::list<PinnedBuffer> g_pinned_lru;
+std::map<const void*, std::list<PinnedBuffer>::iterator> g_pinned_index;
+std::size_t g_pinned_bytes = 0;
+
+//! a host pointer the CUDA runtime cannot attribute is pageable
+bool isPageable(const void* ptr)
+{
+  cudaPointerAttributes attr;
+  cudaError_t err = cudaPointerGetAttributes(&attr, ptr);
+  if (err != cudaSuccess) {
+    // unregistered host memory; clear the sticky error state
+    (void)cudaGetLastError();
+    return true;
+  }
+#if CUDART_VERSION >= 10000
+  return attr.type == cudaMemoryTypeUnregistered;
+#else
+  return false;
+#endif
+}
+
+void unpinOne()
+{
+  PinnedBuffer victim = g_pinned_lru.back();
+  g_pinned_lru.pop_back();
+  g_pinned_index.erase(victim.ptr);
+  g_pinned_bytes -= victim.size;
+  (void)cudaHostUnregister(const_cast<void*>(victim.ptr));
+}
+
+void unpinAll()
+{
+  while (!g_pinned_lru.empty()) {
+    unpinOne();
+  }
+}
+
+//! pin a pageable buffer, evicting least recently used pins to budget
+void pinBuffer(const void* ptr, std::size_t size)
+{
+  auto found = g_pinned_index.find(ptr);
+  if (found != g_pinned_index.end()) {
+    // already pinned by us; refresh its place in the list
+    g_pinned_lru.splice(g_pinned_lru.begin(), g_pinned_lru, found->second);
+    return;
+  }
+
+  if (size > g_pin_budget) {
+    return;
+  }
+
+  while (g_pinned_bytes + size > g_pin_budget) {
+    unpinOne();
+  }
+
+  cudaError_t err =
+      cudaHostRegister(const_cast<void*>(ptr), size, cudaHostRegisterDefault);
+  if (err != cudaSuccess) {
+    // overlapping registration or exhausted pinnable memory; advise only
+    (void)cudaGetLastError();
+    return;
+  }
+
+  g_pinned_lru.push_front(PinnedBuffer{ptr, size});
+  g_pinned_index[ptr] = g_pinned_lru.begin();
+  g_pinned_bytes += size;
+}
+
+#endif  // RAJA_ENABLE_CUDA
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+void TransferAdvisorPlugin::init(const PluginOptions&)
+{
+  lock_guard<std::mutex> lock(advisor_mutex);
+  g_threshold = envBytes("RAJA_TRANSFER_ADVISOR_THRESHOLD", 1024 * 1024);
+  g_pin_budget = envBytes("RAJA_TRANSFER_ADVISOR_PIN_BUDGET", 0);
+}
+
+void TransferAdvisorPlugin::registerBuffer(const TransferBufferInfo& info)
+{
+  if (info.ptr == nullptr || info.size < g_threshold) {
+    return;
+  }
+
+  lock_guard<std::mutex> lock(advisor_mutex);
+
+  SiteStats& stats = g_stats[info.name ? info.name : "(unnamed)"];
+  stats.num_registrations += 1;
+  stats.total_bytes += info.size;
+
+#if defined(RAJA_ENABLE_CUDA)
+  if (isPageable(info.ptr)) {
+    stats.num_pageable += 1;
+    stats.pageable_bytes += info.size;
+    if (g_pin_budget > 0) {
+      pinBuffer(info.ptr, info.size);
+    }
+  } else {
+    // a buffer we pinned earlier shows up as registered; keep it warm
+    if (g_pin_budget > 0) {
+      pinBuffer(info.ptr, info.size);
+    }
+  }
+#endif
+}
+
+void TransferAdvisorPlugin::finalize()
+{
+  lock_guard<std::mutex> lock(advisor_mutex);
+
+  if (!g_stats.empty()) {
+    fprintf(stderr, "RAJA transfer advisor summary (threshold %zu bytes)\n",
+            g_threshold);
+    for (const auto& entry : g_stats) {
+      const SiteStats& stats = entry.second;
+      fprintf(stderr,
+              "  %-30s registrations: %8lu (%llu bytes)  "
+              "pageable: %8lu (%llu bytes)\n",
+              entry.first.c_str(),
+              stats.num_registrations,
+              stats.total_bytes,
+              stats.num_pageable,
+              stats.pageable_bytes);
+      if (stats.num_pageable > 0 && g_pin_budget == 0) {
+        fprintf(stderr,
+                "    advice: allocate pinned or set "
+                "RAJA_TRANSFER_ADVISOR_PIN_BUDGET to pin hot buffers\n");
+      }
+    }
+  }
+
+#if defined(RAJA_ENABLE_CUDA)
+  unpinAll();
+#endif
+}
+
+TransferAdvisorPlugin::SiteStats TransferAdvisorPlugin::getStats(
+    const char* name)
+{
+  lock_guard<std::mutex> lock(advisor_mutex);
+  auto found = g_stats.find(name);
+  return found != g_stats.end() ? found->second : SiteStats{};
+}
+
+unsigned long long TransferAdvisorPlugin::getPinnedBytes()
+{
+  lock_guard<std::mutex> lock(advisor_mutex);
+#if defined(RAJA_ENABLE_CUDA)
+  return g_pinned_bytes;
+#else
+  return 0;
+#endif
+}
+
+void TransferAdvisorPlugin::resetStats()
+{
+  lock_guard<std::mutex> lock(advisor_mutex);
+  g_stats.clear();
+#if defined(RAJA_ENABLE_CUDA)
+  unpinAll();
+#endif
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+static RAJA::util::PluginRegistry::add<RAJA::util::TransferAdvisorPlugin> P(
+    "transfer-advisor",
+    "Detects pageable host transfer buffers and optionally pins hot ones.");
+
+#endif  // closing endif for RAJA_ENABLE_TRANSFER_ADVISOR_PLUGIN
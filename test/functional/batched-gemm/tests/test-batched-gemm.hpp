@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_BATCHED_GEMM_HPP__
+#define __TEST_BATCHED_GEMM_HPP__
+
+#include <cmath>
+
+//
+// Batched matrix multiply against a reference triple loop. Extents are
+// deliberately non-square in one case so that row/column mix-ups in the
+// compile-time layouts are caught, and the batch is large enough that
+// every CUDA block computes a different element.
+//
+template <typename WORKING_RES, typename EXEC_POLICY,
+          camp::idx_t N, camp::idx_t M, camp::idx_t K>
+void BatchedGemmTestImpl(RAJA::Index_type num_elements)
+{
+  using ALayout = RAJA::StaticLayout<RAJA::PERM_IJ, N, K>;
+  using BLayout = RAJA::StaticLayout<RAJA::PERM_IJ, K, M>;
+  using CLayout = RAJA::StaticLayout<RAJA::PERM_IJ, N, M>;
+
+  camp::resources::Resource work_res{WORKING_RES::get_default()};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  const RAJA::Index_type A_len = num_elements * ALayout::s_size;
+  const RAJA::Index_type B_len = num_elements * BLayout::s_size;
+  const RAJA::Index_type C_len = num_elements * CLayout::s_size;
+
+  double* A = host_res.allocate<double>(A_len);
+  double* B = host_res.allocate<double>(B_len);
+  double* C = host_res.allocate<double>(C_len);
+
+  double* dA = work_res.allocate<double>(A_len);
+  double* dB = work_res.allocate<double>(B_len);
+  double* dC = work_res.allocate<double>(C_len);
+
+  for (RAJA::Index_type i = 0; i < A_len; ++i) {
+    A[i] = std::sin(static_cast<double>(i));
+  }
+  for (RAJA::Index_type i = 0; i < B_len; ++i) {
+    B[i] = std::cos(static_cast<double>(i));
+  }
+  for (RAJA::Index_type i = 0; i < C_len; ++i) {
+    C[i] = -1.0;
+  }
+
+  work_res.memcpy(dA, A, sizeof(double) * A_len);
+  work_res.memcpy(dB, B, sizeof(double) * B_len);
+  work_res.memcpy(dC, C, sizeof(double) * C_len);
+
+  RAJA::View<double, ALayout> Aview(dA);
+  RAJA::View<double, BLayout> Bview(dB);
+  RAJA::View<double, CLayout> Cview(dC);
+
+  RAJA::batched_gemm<EXEC_POLICY>(num_elements, Cview, Aview, Bview);
+
+  work_res.memcpy(C, dC, sizeof(double) * C_len);
+
+  for (RAJA::Index_type e = 0; e < num_elements; ++e) {
+    const double* a = A + e * ALayout::s_size;
+    const double* b = B + e * BLayout::s_size;
+    const double* c = C + e * CLayout::s_size;
+    for (camp::idx_t n = 0; n < N; ++n) {
+      for (camp::idx_t m = 0; m < M; ++m) {
+        double expected = 0.0;
+        for (camp::idx_t k = 0; k < K; ++k) {
+          expected += a[ALayout::s_oper(n, k)] * b[BLayout::s_oper(k, m)];
+        }
+        ASSERT_NEAR(c[CLayout::s_oper(n, m)], expected, 1e-12);
+      }
+    }
+  }
+
+  host_res.deallocate(A);
+  host_res.deallocate(B);
+  host_res.deallocate(C);
+
+  work_res.deallocate(dA);
+  work_res.deallocate(dB);
+  work_res.deallocate(dC);
+}
+
+
+TYPED_TEST_SUITE_P(BatchedGemmTest);
+template <typename T>
+class BatchedGemmTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(BatchedGemmTest, BatchedGemm)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  // spectral element sized cube
+  BatchedGemmTestImpl<WORKING_RES, EXEC_POLICY, 8, 8, 8>(100);
+
+  // non-square extents
+  BatchedGemmTestImpl<WORKING_RES, EXEC_POLICY, 5, 4, 3>(57);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(BatchedGemmTest,
+                            BatchedGemm);
+
+#endif  // __TEST_BATCHED_GEMM_HPP__
@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_COPYIF_HPP__
+#define __TEST_COMPACT_COPYIF_HPP__
+
+#include <vector>
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void CompactCopyIfTestImpl(int N)
+{
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocCompactTestData(N,
+                       working_res,
+                       &work_in, &work_out,
+                       &host_in, &host_out);
+
+  for (int i = 0; i < N; ++i) {
+    host_in[i] = static_cast<T>((i * 7) % 100);
+  }
+
+  LessThan<T> pred{static_cast<T>(50)};
+
+  // reference result, preserving relative order
+  std::vector<T> expected;
+  for (int i = 0; i < N; ++i) {
+    if (pred(host_in[i])) {
+      expected.push_back(host_in[i]);
+    }
+  }
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  RAJA::Index_type num_selected =
+      RAJA::copy_if<EXEC_POLICY>(work_in, work_in + N, work_out, pred);
+
+  ASSERT_EQ(num_selected, static_cast<RAJA::Index_type>(expected.size()));
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * N);
+
+  for (RAJA::Index_type i = 0; i < num_selected; ++i) {
+    ASSERT_EQ(host_out[i], expected[i]);
+  }
+
+  deallocCompactTestData(working_res,
+                         work_in, work_out,
+                         host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(CompactCopyIfTest);
+template <typename T>
+class CompactCopyIfTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(CompactCopyIfTest, CopyIf)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  CompactCopyIfTestImpl<EXEC_POLICY, WORKING_RES, DATA_TYPE>(357);
+  CompactCopyIfTestImpl<EXEC_POLICY, WORKING_RES, DATA_TYPE>(32000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactCopyIfTest,
+                            CopyIf);
+
+#endif  // __TEST_COMPACT_COPYIF_HPP__
@@ -0,0 +1,54 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_DATA_HPP__
+#define __TEST_COMPACT_DATA_HPP__
+
+//
+// Methods to allocate/deallocate compaction test data, and the predicate
+// used by the compaction tests.
+//
+
+template <typename T>
+struct LessThan {
+  T cutoff;
+
+  RAJA_HOST_DEVICE bool operator()(const T& val) const
+  {
+    return val < cutoff;
+  }
+};
+
+template <typename T>
+void allocCompactTestData(int N,
+                          camp::resources::Resource& work_res,
+                          T** work_in, T** work_out,
+                          T** host_in, T** host_out)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_in  = work_res.allocate<T>(N);
+  *work_out = work_res.allocate<T>(N);
+
+  *host_in  = host_res.allocate<T>(N);
+  *host_out = host_res.allocate<T>(N);
+}
+
+template <typename T>
+void deallocCompactTestData(camp::resources::Resource& work_res,
+                            T* work_in, T* work_out,
+                            T* host_in, T* host_out)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_in);
+  work_res.deallocate(work_out);
+  host_res.deallocate(host_in);
+  host_res.deallocate(host_out);
+}
+
+#endif // __TEST_COMPACT_DATA_HPP__
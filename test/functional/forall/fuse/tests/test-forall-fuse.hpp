@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_FUSE_HPP__
+#define __TEST_FORALL_FUSE_HPP__
+
+#include "RAJA_test-forall-data.hpp"
+
+//
+// Three producer-consumer bodies fused into one traversal. The expected
+// value ((0 + idx) + idx) * 2 only comes out if the bodies run in order
+// on each iterate, so this checks both coverage and per-iterate ordering.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallFuseTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  const INDEX_TYPE N = last - first;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * N);
+
+  RAJA::fuse<EXEC_POLICY>(RAJA::TypedRangeSegment<INDEX_TYPE>(first, last),
+      [=] RAJA_HOST_DEVICE (INDEX_TYPE idx) {
+        working_array[idx - first] += idx;
+      },
+      [=] RAJA_HOST_DEVICE (INDEX_TYPE idx) {
+        working_array[idx - first] += idx;
+      },
+      [=] RAJA_HOST_DEVICE (INDEX_TYPE idx) {
+        working_array[idx - first] *= INDEX_TYPE(2);
+      });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    ASSERT_EQ(check_array[i], INDEX_TYPE(4) * (first + i));
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallFuseTest);
+template <typename T>
+class ForallFuseTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallFuseTest, FusedBodies)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallFuseTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(271));
+  ForallFuseTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(13), INDEX_TYPE(5233));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallFuseTest,
+                            FusedBodies);
+
+#endif  // __TEST_FORALL_FUSE_HPP__
@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_GRID_STRIDE_HPP__
+#define __TEST_FORALL_GRID_STRIDE_HPP__
+
+#include "RAJA_test-forall-data.hpp"
+
+//
+// Grid-stride foralls over a range segment; each index must be visited
+// exactly once whether the clamped grid covers the range in one pass or
+// threads stride over it several times.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallGridStrideTestImpl(INDEX_TYPE N)
+{
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * N);
+
+  RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<INDEX_TYPE>(0, N),
+      [=] RAJA_DEVICE (INDEX_TYPE idx) {
+        working_array[idx] += idx + INDEX_TYPE(1);
+      });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    ASSERT_EQ(check_array[i], i + INDEX_TYPE(1));
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallGridStrideTest);
+template <typename T>
+class ForallGridStrideTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallGridStrideTest, GridStrideForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // smaller than one block, one pass of a clamped grid, and ranges
+  // large enough that every thread strides multiple times
+  ForallGridStrideTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(57));
+  ForallGridStrideTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(4096));
+  ForallGridStrideTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(1000000));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallGridStrideTest,
+                            GridStrideForall);
+
+#endif  // __TEST_FORALL_GRID_STRIDE_HPP__
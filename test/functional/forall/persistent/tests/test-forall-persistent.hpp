@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_PERSISTENT_HPP__
+#define __TEST_FORALL_PERSISTENT_HPP__
+
+#include "RAJA_test-forall-data.hpp"
+
+//
+// A stream of short foralls through the persistent grid. Dispatch goes
+// through the resident-grid mailbox rather than kernel launches, so
+// correctness is every index visited exactly once per dispatch, across
+// repeated dispatches and for ranges smaller and larger than the grid.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallPersistentTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  const INDEX_TYPE N = last - first;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * N);
+
+  constexpr int num_dispatches = 4;
+  for (int rep = 0; rep < num_dispatches; ++rep) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<INDEX_TYPE>(first, last),
+        [=] RAJA_DEVICE (INDEX_TYPE idx) {
+          working_array[idx - first] += idx + INDEX_TYPE(1);
+        });
+  }
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    ASSERT_EQ(check_array[i],
+              INDEX_TYPE(num_dispatches) * (first + i + INDEX_TYPE(1)));
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallPersistentTest);
+template <typename T>
+class ForallPersistentTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallPersistentTest, PersistentForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // Smaller and larger than one pass of the resident grid
+  ForallPersistentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(57));
+  ForallPersistentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(100000));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallPersistentTest,
+                            PersistentForall);
+
+#endif  // __TEST_FORALL_PERSISTENT_HPP__
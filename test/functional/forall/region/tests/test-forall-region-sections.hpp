@@ -0,0 +1,144 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REGION_SECTIONS_HPP__
+#define __TEST_FORALL_REGION_SECTIONS_HPP__
+
+template <typename INDEX_TYPE, typename WORKING_RES,
+          typename REG_POLICY, typename EXEC_POLICY>
+void ForallRegionSectionsTestImpl(INDEX_TYPE N)
+{
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg(0, N);
+
+  INDEX_TYPE* working_array_a;
+  INDEX_TYPE* check_array_a;
+  INDEX_TYPE* test_array_a;
+
+  INDEX_TYPE* working_array_b;
+  INDEX_TYPE* check_array_b;
+  INDEX_TYPE* test_array_b;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array_a,
+                                     &check_array_a,
+                                     &test_array_a);
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array_b,
+                                     &check_array_b,
+                                     &test_array_b);
+
+  working_res.memset( working_array_a, 0, sizeof(INDEX_TYPE) * N );
+  working_res.memset( working_array_b, 0, sizeof(INDEX_TYPE) * N );
+
+  //
+  // Two independent loop sequences on disjoint data; loops within each
+  // section stay ordered, while the sections themselves may run
+  // concurrently.
+  //
+  RAJA::region_sections<REG_POLICY>(
+    [=]() {
+
+      RAJA::forall<EXEC_POLICY>(rseg, [=](INDEX_TYPE idx) {
+        working_array_a[idx] = static_cast<INDEX_TYPE>(1);
+      });
+
+      RAJA::forall<EXEC_POLICY>(rseg, [=](INDEX_TYPE idx) {
+        working_array_a[idx] += idx;
+      });
+
+    },
+    [=]() {
+
+      RAJA::forall<EXEC_POLICY>(rseg, [=](INDEX_TYPE idx) {
+        working_array_b[idx] = static_cast<INDEX_TYPE>(2);
+      });
+
+      RAJA::forall<EXEC_POLICY>(rseg, [=](INDEX_TYPE idx) {
+        working_array_b[idx] *= static_cast<INDEX_TYPE>(2);
+      });
+
+    });
+
+  working_res.memcpy(check_array_a, working_array_a, sizeof(INDEX_TYPE) * N);
+  working_res.memcpy(check_array_b, working_array_b, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = 0; i < N; i++) {
+    ASSERT_EQ(check_array_a[i], 1 + i);
+    ASSERT_EQ(check_array_b[i], 4);
+  }
+
+  //
+  // More sections than a node is likely to have threads still runs
+  // every section exactly once.
+  //
+  working_res.memset( working_array_a, 0, sizeof(INDEX_TYPE) * N );
+
+  RAJA::region_sections<REG_POLICY>(
+    [=]() {
+      RAJA::forall<EXEC_POLICY>(rseg, [=](INDEX_TYPE idx) {
+        working_array_a[idx] += static_cast<INDEX_TYPE>(1);
+      });
+    },
+    [=]() {
+      RAJA::forall<EXEC_POLICY>(rseg, [=](INDEX_TYPE idx) {
+        working_array_b[idx] = static_cast<INDEX_TYPE>(idx);
+      });
+    },
+    [=]() {
+      RAJA::forall<EXEC_POLICY>(rseg, [=](INDEX_TYPE idx) {
+        working_array_a[idx] += static_cast<INDEX_TYPE>(2);
+      });
+    });
+
+  working_res.memcpy(check_array_a, working_array_a, sizeof(INDEX_TYPE) * N);
+  working_res.memcpy(check_array_b, working_array_b, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = 0; i < N; i++) {
+    ASSERT_EQ(check_array_a[i], 3);
+    ASSERT_EQ(check_array_b[i], i);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array_a,
+                                       check_array_a,
+                                       test_array_a);
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array_b,
+                                       check_array_b,
+                                       test_array_b);
+}
+
+
+TYPED_TEST_SUITE_P(ForallRegionSectionsTest);
+template <typename T>
+class ForallRegionSectionsTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallRegionSectionsTest, RegionSectionsForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using REG_POLICY  = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallRegionSectionsTestImpl<INDEX_TYPE, WORKING_RES,
+                               REG_POLICY, EXEC_POLICY>(25);
+  ForallRegionSectionsTestImpl<INDEX_TYPE, WORKING_RES,
+                               REG_POLICY, EXEC_POLICY>(2556);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallRegionSectionsTest,
+                            RegionSectionsForall);
+
+#endif  // __TEST_FORALL_REGION_SECTIONS_HPP__
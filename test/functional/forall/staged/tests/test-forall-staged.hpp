@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_STAGED_HPP__
+#define __TEST_FORALL_STAGED_HPP__
+
+#include "RAJA_test-forall-data.hpp"
+
+#include <vector>
+
+//
+// Staged foralls over a list segment; the shared-memory index tile must
+// deliver every index exactly once, including the ragged final tile.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallStagedTestImpl(INDEX_TYPE N)
+{
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  // every other index, so the gather is not the identity mapping
+  std::vector<INDEX_TYPE> idx_list;
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i += INDEX_TYPE(2)) {
+    idx_list.push_back(i);
+  }
+
+  RAJA::TypedListSegment<INDEX_TYPE> lseg(&idx_list[0],
+                                          idx_list.size(),
+                                          working_res);
+
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * N);
+
+  RAJA::forall<EXEC_POLICY>(lseg,
+      [=] RAJA_DEVICE (INDEX_TYPE idx) {
+        working_array[idx] += idx + INDEX_TYPE(1);
+      });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    if (i % 2 == 0) {
+      ASSERT_EQ(check_array[i], i + INDEX_TYPE(1));
+    } else {
+      ASSERT_EQ(check_array[i], INDEX_TYPE(0));
+    }
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallStagedTest);
+template <typename T>
+class ForallStagedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallStagedTest, StagedForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // smaller than one tile, exact tiles, and a ragged final tile
+  ForallStagedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(62));
+  ForallStagedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(2048));
+  ForallStagedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(13711));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallStagedTest,
+                            StagedForall);
+
+#endif  // __TEST_FORALL_STAGED_HPP__
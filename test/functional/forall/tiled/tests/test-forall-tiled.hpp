@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_TILED_HPP__
+#define __TEST_FORALL_TILED_HPP__
+
+#include <numeric>
+#include <vector>
+
+//
+// Copy-and-increment through a tiled forall policy. The tiled policy only
+// changes the order iterations are dealt to threads, so correctness is
+// every index visited exactly once, including when the tile size does not
+// divide the range.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallTiledTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  const INDEX_TYPE N = last - first;
+
+  std::vector<INDEX_TYPE> x(N);
+  std::vector<INDEX_TYPE> y(N, INDEX_TYPE(0));
+  std::iota(x.begin(), x.end(), INDEX_TYPE(0));
+
+  const INDEX_TYPE* x_ptr = x.data();
+  INDEX_TYPE* y_ptr = y.data();
+
+  RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<INDEX_TYPE>(first, last),
+      [=](INDEX_TYPE i) {
+        y_ptr[i - first] += x_ptr[i - first] + INDEX_TYPE(1);
+      });
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    ASSERT_EQ(y[i], x[i] + INDEX_TYPE(1));
+  }
+}
+
+//
+// Same loop with a tile epilogue fused on via tiled_body. The epilogue
+// runs once per tile, so the tile lengths it observes must sum to the
+// range length.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallTiledEpilogueTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  const INDEX_TYPE N = last - first;
+
+  std::vector<INDEX_TYPE> x(N);
+  std::vector<INDEX_TYPE> y(N, INDEX_TYPE(0));
+  std::iota(x.begin(), x.end(), INDEX_TYPE(0));
+
+  const INDEX_TYPE* x_ptr = x.data();
+  INDEX_TYPE* y_ptr = y.data();
+
+  INDEX_TYPE len_sum(0);
+  INDEX_TYPE num_tiles(0);
+  INDEX_TYPE* len_sum_ptr = &len_sum;
+  INDEX_TYPE* num_tiles_ptr = &num_tiles;
+
+  RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<INDEX_TYPE>(first, last),
+      RAJA::tiled_body(
+          [=](INDEX_TYPE i) {
+            y_ptr[i - first] += x_ptr[i - first] + INDEX_TYPE(1);
+          },
+          [=](INDEX_TYPE RAJA_UNUSED_ARG(tile_begin), INDEX_TYPE tile_len) {
+            RAJA::atomicAdd<RAJA::omp_atomic>(len_sum_ptr, tile_len);
+            RAJA::atomicAdd<RAJA::omp_atomic>(num_tiles_ptr, INDEX_TYPE(1));
+          }));
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    ASSERT_EQ(y[i], x[i] + INDEX_TYPE(1));
+  }
+
+  ASSERT_EQ(len_sum, N);
+  ASSERT_GT(num_tiles, INDEX_TYPE(0));
+}
+
+
+TYPED_TEST_SUITE_P(ForallTiledTest);
+template <typename T>
+class ForallTiledTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallTiledTest, TiledForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // Range deliberately not a multiple of either tile size
+  ForallTiledTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(1000));
+  ForallTiledEpilogueTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(1000));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallTiledTest,
+                            TiledForall);
+
+#endif  // __TEST_FORALL_TILED_HPP__
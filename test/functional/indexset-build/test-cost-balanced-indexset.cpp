@@ -0,0 +1,126 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the cost-balanced index set builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include <vector>
+
+//
+// Check that segments tile [0, length) contiguously in order.
+//
+static void checkCoverage(
+    RAJA::TypedIndexSet<RAJA::RangeSegment> const& iset,
+    RAJA::Index_type length)
+{
+  RAJA::Index_type pos = 0;
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    iset.segmentCall(s, [&](RAJA::RangeSegment const& seg) {
+      ASSERT_EQ(*seg.begin(), pos);
+      ASSERT_GT(seg.size(), 0);
+      pos = *seg.begin() + seg.size();
+    });
+  }
+  ASSERT_EQ(pos, length);
+}
+
+TEST(IndexSetBuild, CostBalancedUniform)
+{
+  const RAJA::Index_type length = 100;
+  const RAJA::Index_type num_chunks = 4;
+
+  std::vector<double> costs(length, 1.0);
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  RAJA::buildCostBalancedIndexSet(iset, costs.data(), length, num_chunks);
+
+  checkCoverage(iset, length);
+
+  // uniform costs degenerate to an equal-count partition
+  ASSERT_EQ(iset.getNumSegments(), static_cast<size_t>(num_chunks));
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    iset.segmentCall(s, [&](RAJA::RangeSegment const& seg) {
+      ASSERT_EQ(seg.size(), length / num_chunks);
+    });
+  }
+}
+
+TEST(IndexSetBuild, CostBalancedMixedCost)
+{
+  // surface zones (100x cost) followed by volume zones
+  const RAJA::Index_type num_surface = 10;
+  const RAJA::Index_type num_volume = 100;
+  const RAJA::Index_type length = num_surface + num_volume;
+  const RAJA::Index_type num_chunks = 11;
+
+  std::vector<double> costs(length, 1.0);
+  for (RAJA::Index_type i = 0; i < num_surface; ++i) {
+    costs[i] = 100.0;
+  }
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  RAJA::buildCostBalancedIndexSet(iset, costs.data(), length, num_chunks);
+
+  checkCoverage(iset, length);
+
+  // no segment except those pinned to a single expensive zone should
+  // carry much more than the per-chunk cost target
+  double total = 0.0;
+  for (RAJA::Index_type i = 0; i < length; ++i) {
+    total += costs[i];
+  }
+  const double target = total / num_chunks;
+
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    iset.segmentCall(s, [&](RAJA::RangeSegment const& seg) {
+      double seg_cost = 0.0;
+      for (RAJA::Index_type i = *seg.begin(); i != *seg.end(); ++i) {
+        seg_cost += costs[i];
+      }
+      ASSERT_LE(seg_cost, target + 100.0);
+    });
+  }
+}
+
+TEST(IndexSetBuild, CostBalancedDegenerate)
+{
+  // an iterate that outweighs everything absorbs several chunk quotas;
+  // the builder emits fewer segments rather than empty ones
+  {
+    std::vector<double> costs(10, 1.0);
+    costs[0] = 1000.0;
+
+    RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+    RAJA::buildCostBalancedIndexSet(iset, costs.data(), 10, 5);
+
+    checkCoverage(iset, 10);
+    ASSERT_LE(iset.getNumSegments(), static_cast<size_t>(5));
+  }
+
+  // all-zero costs fall back to an equal-count partition
+  {
+    std::vector<double> costs(7, 0.0);
+
+    RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+    RAJA::buildCostBalancedIndexSet(iset, costs.data(), 7, 3);
+
+    checkCoverage(iset, 7);
+    ASSERT_EQ(iset.getNumSegments(), static_cast<size_t>(3));
+  }
+
+  // empty iteration space produces an empty index set
+  {
+    RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+    RAJA::buildCostBalancedIndexSet(iset, nullptr, 0, 4);
+    ASSERT_EQ(iset.getNumSegments(), static_cast<size_t>(0));
+  }
+}
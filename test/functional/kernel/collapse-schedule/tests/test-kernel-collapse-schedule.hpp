@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_COLLAPSE_SCHEDULE_HPP__
+#define __TEST_KERNEL_COLLAPSE_SCHEDULE_HPP__
+
+#include <vector>
+
+//
+// Two collapsed loops under a schedule-carrying collapse policy. The
+// schedule only changes how collapsed iterations are dealt to threads,
+// so correctness is every (i, j) visited exactly once, including when
+// the extents do not divide the chunk sizes.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelCollapseScheduleTestImpl(INDEX_TYPE N0, INDEX_TYPE N1)
+{
+  const INDEX_TYPE N = N0 * N1;
+
+  std::vector<INDEX_TYPE> count(N, INDEX_TYPE(0));
+  INDEX_TYPE* count_ptr = count.data();
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg0(0, N0);
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg1(0, N1);
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(rseg0, rseg1),
+
+    [=] (INDEX_TYPE i, INDEX_TYPE j) {
+      count_ptr[i * N1 + j] += i * N1 + j + INDEX_TYPE(1);
+    }
+
+  );
+
+  for (INDEX_TYPE idx = INDEX_TYPE(0); idx < N; ++idx) {
+    ASSERT_EQ(count[idx], idx + INDEX_TYPE(1));
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelCollapseScheduleTest);
+template <typename T>
+class KernelCollapseScheduleTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelCollapseScheduleTest, CollapseScheduleKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // Extents deliberately not multiples of the test chunk sizes
+  KernelCollapseScheduleTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(13), INDEX_TYPE(21));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelCollapseScheduleTest,
+                            CollapseScheduleKernel);
+
+
+//
+// Three collapsed loops with a dynamic schedule; exercises the 3-arg
+// executor once rather than across the full schedule list.
+//
+TEST(KernelCollapseScheduleThreeLoopTest, CollapseScheduleKernel3)
+{
+  using EXEC_POLICY =
+    RAJA::KernelPolicy<
+      RAJA::statement::Collapse<
+        RAJA::omp_parallel_collapse_schedule_exec<
+          RAJA::policy::omp::Dynamic<2>>,
+        RAJA::ArgList<0, 1, 2>,
+        RAJA::statement::Lambda<0>
+      >
+    >;
+
+  constexpr int N0 = 5;
+  constexpr int N1 = 7;
+  constexpr int N2 = 11;
+  constexpr int N = N0 * N1 * N2;
+
+  std::vector<int> count(N, 0);
+  int* count_ptr = count.data();
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(RAJA::RangeSegment(0, N0),
+                     RAJA::RangeSegment(0, N1),
+                     RAJA::RangeSegment(0, N2)),
+
+    [=] (RAJA::Index_type i, RAJA::Index_type j, RAJA::Index_type k) {
+      count_ptr[(i * N1 + j) * N2 + k] += 1;
+    }
+
+  );
+
+  for (int idx = 0; idx < N; ++idx) {
+    ASSERT_EQ(count[idx], 1);
+  }
+}
+
+#endif  // __TEST_KERNEL_COLLAPSE_SCHEDULE_HPP__
@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_FISSION_LAMBDA_HPP__
+#define __TEST_KERNEL_FISSION_LAMBDA_HPP__
+
+#include <numeric>
+#include <vector>
+
+//
+// Two-stage kernel fissioned at the statement boundary: lambda 0 stages
+// a value into a kernel parameter, lambda 1 consumes it. With
+// FissionLambda each stage is compiled as a separate, non-inlined
+// function, and the parameter is the declared interface crossing the
+// boundary, so correctness checking amounts to verifying that the
+// staged value survives the out-of-line calls for every iteration.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelFissionLambdaTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  const INDEX_TYPE N = last - first;
+
+  std::vector<INDEX_TYPE> x(N);
+  std::vector<INDEX_TYPE> z(N, INDEX_TYPE(0));
+  std::iota(x.begin(), x.end(), INDEX_TYPE(1));
+
+  const INDEX_TYPE* x_ptr = x.data();
+  INDEX_TYPE* z_ptr = z.data();
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg(first, last);
+
+  RAJA::kernel_param<EXEC_POLICY>(
+
+    RAJA::make_tuple(rseg),
+
+    // staged value handed from lambda 0 to lambda 1
+    RAJA::make_tuple(INDEX_TYPE(0)),
+
+    [=] (INDEX_TYPE i, INDEX_TYPE& t) {
+      t = x_ptr[i - first] * INDEX_TYPE(2);
+    },
+
+    [=] (INDEX_TYPE i, INDEX_TYPE& t) {
+      z_ptr[i - first] = t + x_ptr[i - first];
+    }
+
+  );
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    ASSERT_EQ(z[i], INDEX_TYPE(3) * x[i]);
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelFissionLambdaTest);
+template <typename T>
+class KernelFissionLambdaTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelFissionLambdaTest, FissionLambdaKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // Range deliberately not a multiple of the tile size used in the
+  // tiled policy variants
+  KernelFissionLambdaTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(1000));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelFissionLambdaTest,
+                            FissionLambdaKernel);
+
+#endif  // __TEST_KERNEL_FISSION_LAMBDA_HPP__
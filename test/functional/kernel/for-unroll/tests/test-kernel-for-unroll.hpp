@@ -0,0 +1,73 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_FOR_UNROLL_HPP__
+#define __TEST_KERNEL_FOR_UNROLL_HPP__
+
+#include <vector>
+
+//
+// Sum-into through a loop nest whose inner component loop is a
+// statement::ForUnroll. The unrolled expansion must visit every (i, j)
+// exactly once and in loop order, including when the inner length is
+// not a multiple of the unroll factor and the remainder loop runs.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelForUnrollTestImpl(INDEX_TYPE outer_len, INDEX_TYPE inner_len)
+{
+  const INDEX_TYPE N = outer_len * inner_len;
+
+  std::vector<INDEX_TYPE> y(N, INDEX_TYPE(0));
+  std::vector<INDEX_TYPE> order(N, INDEX_TYPE(0));
+
+  INDEX_TYPE* y_ptr = y.data();
+  INDEX_TYPE* order_ptr = order.data();
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(RAJA::TypedRangeSegment<INDEX_TYPE>(0, outer_len),
+                     RAJA::TypedRangeSegment<INDEX_TYPE>(0, inner_len)),
+
+    [=] (INDEX_TYPE i, INDEX_TYPE j) {
+      y_ptr[i * inner_len + j] += INDEX_TYPE(1);
+      // record the inner-loop position each row has reached so far
+      order_ptr[i * inner_len + j] = j;
+    }
+
+  );
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < outer_len; ++i) {
+    for (INDEX_TYPE j = INDEX_TYPE(0); j < inner_len; ++j) {
+      ASSERT_EQ(y[i * inner_len + j], INDEX_TYPE(1));
+      ASSERT_EQ(order[i * inner_len + j], j);
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelForUnrollTest);
+template <typename T>
+class KernelForUnrollTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelForUnrollTest, ForUnrollKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // inner length matching the component-loop case for the unroll-of-4
+  // policies, and exercising the remainder loop for the unroll-of-3 one
+  KernelForUnrollTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(100), INDEX_TYPE(4));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelForUnrollTest,
+                            ForUnrollKernel);
+
+#endif  // __TEST_KERNEL_FOR_UNROLL_HPP__
@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_FOR_WINDOW_HPP__
+#define __TEST_KERNEL_FOR_WINDOW_HPP__
+
+#include <vector>
+
+using KernelForWindowView = RAJA::View<double, RAJA::Layout<1>>;
+using KernelForWindowWindow = RAJA::RotatingWindow<double, 1>;
+
+//
+// Three-point stencil over the interior of a 1d array through a
+// statement::ForWindow loop. Every row applies the same stencil, so a
+// multi-row run checks that the window is re-primed at the start of
+// each inner loop; the lambda reads neighbors only through the window
+// parameter.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelForWindowTestImpl(INDEX_TYPE num_rows, INDEX_TYPE len)
+{
+  std::vector<double> x(len);
+  for (INDEX_TYPE j = INDEX_TYPE(0); j < len; ++j) {
+    x[j] = static_cast<double>(j * j + 1);
+  }
+
+  std::vector<double> y(num_rows * len, -1.0);
+
+  KernelForWindowView xview(x.data(), len);
+  double* y_ptr = y.data();
+
+  RAJA::kernel_param<EXEC_POLICY>(
+
+    RAJA::make_tuple(RAJA::TypedRangeSegment<INDEX_TYPE>(1, len - 1),
+                     RAJA::TypedRangeSegment<INDEX_TYPE>(0, num_rows)),
+
+    RAJA::make_tuple(xview, KernelForWindowWindow{}),
+
+    [=] (INDEX_TYPE col, INDEX_TYPE row,
+         KernelForWindowView const&, KernelForWindowWindow& w) {
+      y_ptr[row * len + col] = w(-1) + 2.0 * w(0) + w(1);
+    }
+
+  );
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < num_rows; ++i) {
+    // boundary entries are outside the segment and stay untouched
+    ASSERT_EQ(y[i * len], -1.0);
+    ASSERT_EQ(y[i * len + len - 1], -1.0);
+
+    for (INDEX_TYPE j = INDEX_TYPE(1); j < len - 1; ++j) {
+      ASSERT_EQ(y[i * len + j], x[j - 1] + 2.0 * x[j] + x[j + 1]);
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelForWindowTest);
+template <typename T>
+class KernelForWindowTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelForWindowTest, ForWindowKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  KernelForWindowTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(8), INDEX_TYPE(101));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelForWindowTest,
+                            ForWindowKernel);
+
+#endif  // __TEST_KERNEL_FOR_WINDOW_HPP__
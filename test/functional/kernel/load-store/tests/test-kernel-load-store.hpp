@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_LOAD_STORE_HPP__
+#define __TEST_KERNEL_LOAD_STORE_HPP__
+
+#include <vector>
+
+//
+// Tile size shared by the test policies and the local array type; the
+// matrix extents below are chosen to not be multiples of it so partial
+// tiles are exercised.
+//
+constexpr int loadstore_tile_dim = 8;
+
+using KernelLoadStoreTileMem =
+  RAJA::LocalArray<int,
+                   RAJA::Perm<0, 1>,
+                   RAJA::SizeList<loadstore_tile_dim, loadstore_tile_dim>>;
+
+//
+// Tiled matrix transpose written entirely with statement::Load and
+// statement::Store: each tile of Aview (indexed (row, col), arguments
+// 1 and 0) is staged into the local array and written back through
+// Atview (indexed (col, row)). Because both statements map local-array
+// dimensions by ascending argument number, no lambda is needed; the
+// transpose falls out of the two Views' argument sequences.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelLoadStoreTestImpl(INDEX_TYPE N_r, INDEX_TYPE N_c)
+{
+  std::vector<int> A(N_r * N_c);
+  std::vector<int> At(N_r * N_c, 0);
+
+  for (INDEX_TYPE row = INDEX_TYPE(0); row < N_r; ++row) {
+    for (INDEX_TYPE col = INDEX_TYPE(0); col < N_c; ++col) {
+      A[row * N_c + col] = static_cast<int>(row * N_c + col);
+    }
+  }
+
+  RAJA::View<int, RAJA::Layout<2>> Aview(A.data(), N_r, N_c);
+  RAJA::View<int, RAJA::Layout<2>> Atview(At.data(), N_c, N_r);
+
+  KernelLoadStoreTileMem Tile_Array;
+
+  RAJA::kernel_param<EXEC_POLICY>(
+
+    RAJA::make_tuple(RAJA::TypedRangeSegment<INDEX_TYPE>(0, N_c),
+                     RAJA::TypedRangeSegment<INDEX_TYPE>(0, N_r)),
+
+    RAJA::make_tuple(Aview, Atview, Tile_Array)
+
+  );
+
+  for (INDEX_TYPE row = INDEX_TYPE(0); row < N_r; ++row) {
+    for (INDEX_TYPE col = INDEX_TYPE(0); col < N_c; ++col) {
+      ASSERT_EQ(At[col * N_r + row], A[row * N_c + col]);
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelLoadStoreTest);
+template <typename T>
+class KernelLoadStoreTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelLoadStoreTest, LoadStoreKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // full tiles only
+  KernelLoadStoreTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(32), INDEX_TYPE(16));
+
+  // partial tiles on both matrix extents
+  KernelLoadStoreTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(13), INDEX_TYPE(10));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelLoadStoreTest,
+                            LoadStoreKernel);
+
+#endif  // __TEST_KERNEL_LOAD_STORE_HPP__
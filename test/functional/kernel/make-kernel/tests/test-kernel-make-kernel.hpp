@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_MAKE_KERNEL_HPP__
+#define __TEST_KERNEL_MAKE_KERNEL_HPP__
+
+#include <vector>
+
+//
+// Build a kernel object once with RAJA::make_kernel and launch it many
+// times, over both the same and different segment tuples. Every run must
+// behave exactly like the equivalent RAJA::kernel call: each (i, j) is
+// visited once per run, so repeated sum-into runs accumulate.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelMakeKernelTestImpl(INDEX_TYPE outer_len, INDEX_TYPE inner_len)
+{
+  const INDEX_TYPE N = outer_len * inner_len;
+  const int num_runs = 3;
+
+  std::vector<INDEX_TYPE> y(N, INDEX_TYPE(0));
+
+  INDEX_TYPE* y_ptr = y.data();
+
+  // bodies and policy are bound once, here
+  auto k = RAJA::make_kernel<EXEC_POLICY>(
+    [=] (INDEX_TYPE i, INDEX_TYPE j) {
+      y_ptr[i * inner_len + j] += INDEX_TYPE(1);
+    }
+  );
+
+  for (int run = 0; run < num_runs; ++run) {
+    k.run(RAJA::make_tuple(RAJA::TypedRangeSegment<INDEX_TYPE>(0, outer_len),
+                           RAJA::TypedRangeSegment<INDEX_TYPE>(0, inner_len)));
+  }
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < outer_len; ++i) {
+    for (INDEX_TYPE j = INDEX_TYPE(0); j < inner_len; ++j) {
+      ASSERT_EQ(y[i * inner_len + j], INDEX_TYPE(num_runs));
+    }
+  }
+
+  // the same kernel object launches over a different segment tuple
+  k.run(RAJA::make_tuple(RAJA::TypedRangeSegment<INDEX_TYPE>(0, outer_len / 2),
+                         RAJA::TypedRangeSegment<INDEX_TYPE>(0, inner_len)));
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < outer_len; ++i) {
+    for (INDEX_TYPE j = INDEX_TYPE(0); j < inner_len; ++j) {
+      const INDEX_TYPE expected =
+          (i < outer_len / 2) ? INDEX_TYPE(num_runs + 1)
+                              : INDEX_TYPE(num_runs);
+      ASSERT_EQ(y[i * inner_len + j], expected);
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelMakeKernelTest);
+template <typename T>
+class KernelMakeKernelTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelMakeKernelTest, MakeKernelKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  KernelMakeKernelTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(100), INDEX_TYPE(8));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelMakeKernelTest,
+                            MakeKernelKernel);
+
+#endif  // __TEST_KERNEL_MAKE_KERNEL_HPP__
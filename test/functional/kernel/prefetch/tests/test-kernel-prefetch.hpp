@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_PREFETCH_HPP__
+#define __TEST_KERNEL_PREFETCH_HPP__
+
+#include <numeric>
+#include <vector>
+
+//
+// Gather through a permutation with a Prefetch statement naming the
+// gathered array (parameter 0) at a fixed distance ahead in loop 0.
+// The prefetch is a pure performance hint, so correctness checking
+// amounts to verifying the gather result is unchanged with the
+// statement in place, including near the end of the range where the
+// distance-ahead index would run past the segment and the statement
+// must not issue.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelPrefetchTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  const INDEX_TYPE N = last - first;
+
+  std::vector<INDEX_TYPE> x(N);
+  std::vector<INDEX_TYPE> perm(N);
+  std::vector<INDEX_TYPE> y(N, INDEX_TYPE(0));
+  std::iota(x.begin(), x.end(), INDEX_TYPE(1));
+
+  // reversal permutation: simple, but every access is indirect
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    perm[i] = N - INDEX_TYPE(1) - i;
+  }
+
+  const INDEX_TYPE* x_ptr = x.data();
+  const INDEX_TYPE* perm_ptr = perm.data();
+  INDEX_TYPE* y_ptr = y.data();
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg(first, last);
+
+  RAJA::kernel_param<EXEC_POLICY>(
+
+    RAJA::make_tuple(rseg),
+
+    RAJA::make_tuple(x_ptr),
+
+    [=] (INDEX_TYPE i) {
+      y_ptr[i - first] = x_ptr[perm_ptr[i - first]];
+    }
+
+  );
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    ASSERT_EQ(y[i], x[N - INDEX_TYPE(1) - i]);
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelPrefetchTest);
+template <typename T>
+class KernelPrefetchTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelPrefetchTest, PrefetchKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // Short range: the tail where no prefetch may issue is a large
+  // fraction of the iterations
+  KernelPrefetchTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(13));
+
+  KernelPrefetchTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(1000));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelPrefetchTest,
+                            PrefetchKernel);
+
+#endif  // __TEST_KERNEL_PREFETCH_HPP__
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_REDUCE_PARAMS_HPP__
+#define __TEST_KERNEL_REDUCE_PARAMS_HPP__
+
+#include <numeric>
+#include <vector>
+
+//
+// Sum values into a kernel parameter while running the loop, then let
+// statement::Reduce combine the per-thread partial values and run the
+// final lambda, which stores the result, on the root thread only. The
+// hot loop touches only the (privatized) parameter, not a reduction
+// object.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelReduceParamsTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  const INDEX_TYPE N = last - first;
+
+  std::vector<INDEX_TYPE> data(N);
+  std::iota(data.begin(), data.end(), INDEX_TYPE(0));
+
+  INDEX_TYPE expected = (N * (N - INDEX_TYPE(1))) / INDEX_TYPE(2);
+
+  INDEX_TYPE sum = INDEX_TYPE(0);
+  INDEX_TYPE* sum_ptr = &sum;
+  const INDEX_TYPE* data_ptr = data.data();
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg(first, last);
+
+  RAJA::kernel_param<EXEC_POLICY>(
+
+    RAJA::make_tuple(rseg),
+
+    RAJA::make_tuple(INDEX_TYPE(0)),
+
+    [=] (INDEX_TYPE i, INDEX_TYPE& value) {
+      value += data_ptr[i - first];
+    },
+
+    [=] (INDEX_TYPE& value) {
+      *sum_ptr = value;
+    }
+
+  );
+
+  ASSERT_EQ(sum, expected);
+}
+
+
+TYPED_TEST_SUITE_P(KernelReduceParamsTest);
+template <typename T>
+class KernelReduceParamsTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelReduceParamsTest, ReduceParamsKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  KernelReduceParamsTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(1023));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelReduceParamsTest,
+                            ReduceParamsKernel);
+
+#endif  // __TEST_KERNEL_REDUCE_PARAMS_HPP__
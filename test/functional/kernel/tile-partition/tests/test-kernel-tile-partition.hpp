@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_TILE_PARTITION_HPP__
+#define __TEST_KERNEL_TILE_PARTITION_HPP__
+
+#include <vector>
+
+//
+// Run a tiled sweep where tiles are classified as full or partial and
+// check that the two code paths together cover the range exactly once,
+// with the iteration's own value, so neither path skips, repeats, nor
+// overruns iterations at the full/partial boundary.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelTilePartitionTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  const RAJA::Index_type N = static_cast<RAJA::Index_type>(last - first);
+
+  std::vector<RAJA::Index_type> value(N > 0 ? N : 1, -1);
+  RAJA::Index_type* vptr = value.data();
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> range(first, last);
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(range),
+
+    [=] (INDEX_TYPE i) {
+      const RAJA::Index_type ii = static_cast<RAJA::Index_type>(i - first);
+      vptr[ii] += 1 + ii;
+    }
+
+  );
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(value[i], i);
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelTilePartitionTest);
+template <typename T>
+class KernelTilePartitionTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelTilePartitionTest, TilePartitionKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // extents cover a whole-chunk multiple (no partial tile), a range
+  // with a remainder, a range shorter than one chunk (no full tiles),
+  // and an empty range
+  KernelTilePartitionTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(1024));
+  KernelTilePartitionTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(3), INDEX_TYPE(1003));
+  KernelTilePartitionTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(13));
+  KernelTilePartitionTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(0));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelTilePartitionTest,
+                            TilePartitionKernel);
+
+#endif  // __TEST_KERNEL_TILE_PARTITION_HPP__
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_TILE_PREFETCH_HPP__
+#define __TEST_KERNEL_TILE_PREFETCH_HPP__
+
+#include <numeric>
+#include <vector>
+
+//
+// Copy-and-increment through a tiled kernel policy whose prefetch hook
+// (Lambda<1>) issues a software prefetch for the first element of the
+// next tile. The prefetch is a pure performance hint, so correctness
+// checking amounts to verifying that every index is still visited
+// exactly once with the hook in place, including with tile sizes that
+// do not evenly divide the range.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelTilePrefetchTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  const INDEX_TYPE N = last - first;
+
+  std::vector<INDEX_TYPE> x(N);
+  std::vector<INDEX_TYPE> y(N, INDEX_TYPE(0));
+  std::iota(x.begin(), x.end(), INDEX_TYPE(0));
+
+  const INDEX_TYPE* x_ptr = x.data();
+  INDEX_TYPE* y_ptr = y.data();
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg(first, last);
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(rseg),
+
+    [=] (INDEX_TYPE i) {
+      y_ptr[i - first] += x_ptr[i - first] + INDEX_TYPE(1);
+    },
+
+    [=] (INDEX_TYPE i) {
+      RAJA_PREFETCH_READ(&x_ptr[i - first]);
+    }
+
+  );
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    ASSERT_EQ(y[i], x[i] + INDEX_TYPE(1));
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelTilePrefetchTest);
+template <typename T>
+class KernelTilePrefetchTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelTilePrefetchTest, TilePrefetchKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // Range deliberately not a multiple of either tile size
+  KernelTilePrefetchTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(1000));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelTilePrefetchTest,
+                            TilePrefetchKernel);
+
+#endif  // __TEST_KERNEL_TILE_PREFETCH_HPP__
@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_TILE_TEMPORAL_HPP__
+#define __TEST_KERNEL_TILE_TEMPORAL_HPP__
+
+#include <vector>
+
+//
+// Advance a 1D three-point stencil NUM_STEPS timesteps through a
+// temporally tiled kernel and compare against plain full-domain time
+// stepping. Step t reads buffer t and writes buffer t+1 (the rotation
+// the statement requires), boundary points use clamped indexing so any
+// tile computes them identically, and each point applies the same
+// floating expression in both versions, so results must match exactly.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelTileTemporalTestImpl(INDEX_TYPE first, INDEX_TYPE last,
+                                RAJA::Index_type num_steps)
+{
+  const RAJA::Index_type N = static_cast<RAJA::Index_type>(last - first);
+
+  std::vector<std::vector<double>> buffers(num_steps + 1,
+                                           std::vector<double>(N, 0.0));
+  std::vector<std::vector<double>> expected = buffers;
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    buffers[0][i] = 0.125 * static_cast<double>((i * 7919) % 1000);
+    expected[0][i] = buffers[0][i];
+  }
+
+  // reference: one full sweep per timestep
+  for (RAJA::Index_type t = 0; t < num_steps; ++t) {
+    const std::vector<double>& src = expected[t];
+    std::vector<double>& dst = expected[t + 1];
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      RAJA::Index_type l = i > 0 ? i - 1 : i;
+      RAJA::Index_type r = i < N - 1 ? i + 1 : i;
+      dst[i] = 0.25 * src[l] + 0.5 * src[i] + 0.25 * src[r];
+    }
+  }
+
+  std::vector<double*> buf_ptrs(num_steps + 1);
+  for (RAJA::Index_type t = 0; t <= num_steps; ++t) {
+    buf_ptrs[t] = buffers[t].data();
+  }
+  double* const* bufs = buf_ptrs.data();
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> space(first, last);
+  RAJA::RangeSegment time(0, num_steps);
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(space, time),
+
+    [=] (INDEX_TYPE i, RAJA::Index_type t) {
+      const RAJA::Index_type ii = static_cast<RAJA::Index_type>(i - first);
+      const double* src = bufs[t];
+      double* dst = bufs[t + 1];
+      RAJA::Index_type l = ii > 0 ? ii - 1 : ii;
+      RAJA::Index_type r = ii < N - 1 ? ii + 1 : ii;
+      dst[ii] = 0.25 * src[l] + 0.5 * src[ii] + 0.25 * src[r];
+    }
+
+  );
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(buffers[num_steps][i], expected[num_steps][i]);
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelTileTemporalTest);
+template <typename T>
+class KernelTileTemporalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelTileTemporalTest, TileTemporalKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // Range deliberately not a multiple of the tile size; step counts
+  // cover no blocking, partial reuse, and halos wider than a tile
+  KernelTileTemporalTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(1000), 1);
+  KernelTileTemporalTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(1000), 3);
+  KernelTileTemporalTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(0), INDEX_TYPE(57), 4);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelTileTemporalTest,
+                            TileTemporalKernel);
+
+#endif  // __TEST_KERNEL_TILE_TEMPORAL_HPP__
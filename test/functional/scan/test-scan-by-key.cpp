@@ -0,0 +1,178 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for segmented (by-key) scans
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+// keys grouped into runs of varying length: run r has length (r % 5) + 1
+static void make_segments(int n, std::vector<int>& keys, std::vector<long>& vals)
+{
+  keys.resize(n);
+  vals.resize(n);
+  int key = 0;
+  int left = 0;
+  for (int i = 0; i < n; ++i) {
+    if (left == 0) {
+      left = (key % 5) + 1;
+      ++key;
+    }
+    keys[i] = key;
+    --left;
+    vals[i] = i % 9 + 1;
+  }
+}
+
+template <typename ExecPolicy>
+void runInclusiveByKeyTest(int n)
+{
+  std::vector<int> keys;
+  std::vector<long> vals;
+  make_segments(n, keys, vals);
+
+  std::vector<long> out(n, -1);
+  RAJA::inclusive_scan_by_key<ExecPolicy>(keys.data(), keys.data() + n,
+                                          vals.data(), out.data());
+
+  long agg = 0;
+  for (int i = 0; i < n; ++i) {
+    agg = (i == 0 || keys[i] != keys[i - 1]) ? vals[i] : agg + vals[i];
+    ASSERT_EQ(out[i], agg);
+  }
+}
+
+template <typename ExecPolicy>
+void runExclusiveByKeyTest(int n)
+{
+  std::vector<int> keys;
+  std::vector<long> vals;
+  make_segments(n, keys, vals);
+
+  std::vector<long> out(n, -1);
+  RAJA::exclusive_scan_by_key<ExecPolicy>(keys.data(), keys.data() + n,
+                                          vals.data(), out.data());
+
+  long agg = 0;
+  for (int i = 0; i < n; ++i) {
+    if (i > 0 && keys[i] != keys[i - 1]) {
+      agg = 0;
+    }
+    ASSERT_EQ(out[i], agg);
+    agg += vals[i];
+  }
+
+  // with the default plus each output is its element's offset within
+  // its run of equal keys when all inputs are one
+  std::vector<long> ones(n, 1);
+  RAJA::exclusive_scan_by_key<ExecPolicy>(keys.data(), keys.data() + n,
+                                          ones.data(), out.data());
+  long offset = 0;
+  for (int i = 0; i < n; ++i) {
+    if (i > 0 && keys[i] != keys[i - 1]) {
+      offset = 0;
+    }
+    ASSERT_EQ(out[i], offset);
+    ++offset;
+  }
+}
+
+template <typename ExecPolicy>
+void runInplaceByKeyTest(int n)
+{
+  std::vector<int> keys;
+  std::vector<long> vals;
+  make_segments(n, keys, vals);
+  std::vector<long> ref(vals);
+
+  // values_out aliasing values_in is supported
+  RAJA::inclusive_scan_by_key<ExecPolicy>(keys.data(), keys.data() + n,
+                                          vals.data(), vals.data());
+
+  long agg = 0;
+  for (int i = 0; i < n; ++i) {
+    agg = (i == 0 || keys[i] != keys[i - 1]) ? ref[i] : agg + ref[i];
+    ASSERT_EQ(vals[i], agg);
+  }
+}
+
+TEST(ScanByKeyFunctionalTest, SequentialInclusive)
+{
+  runInclusiveByKeyTest<RAJA::seq_exec>(0);
+  runInclusiveByKeyTest<RAJA::seq_exec>(1);
+  runInclusiveByKeyTest<RAJA::seq_exec>(357);
+}
+
+TEST(ScanByKeyFunctionalTest, SequentialExclusive)
+{
+  runExclusiveByKeyTest<RAJA::seq_exec>(0);
+  runExclusiveByKeyTest<RAJA::seq_exec>(1);
+  runExclusiveByKeyTest<RAJA::seq_exec>(357);
+}
+
+TEST(ScanByKeyFunctionalTest, SequentialInplace)
+{
+  runInplaceByKeyTest<RAJA::seq_exec>(101);
+}
+
+TEST(ScanByKeyFunctionalTest, LoopInclusive)
+{
+  runInclusiveByKeyTest<RAJA::loop_exec>(357);
+}
+
+TEST(ScanByKeyFunctionalTest, LoopExclusive)
+{
+  runExclusiveByKeyTest<RAJA::loop_exec>(357);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(ScanByKeyFunctionalTest, OpenMPInclusive)
+{
+  runInclusiveByKeyTest<RAJA::omp_parallel_for_exec>(0);
+  runInclusiveByKeyTest<RAJA::omp_parallel_for_exec>(1);
+  runInclusiveByKeyTest<RAJA::omp_parallel_for_exec>(357);
+  runInclusiveByKeyTest<RAJA::omp_parallel_for_exec>(10000);
+}
+
+TEST(ScanByKeyFunctionalTest, OpenMPExclusive)
+{
+  runExclusiveByKeyTest<RAJA::omp_parallel_for_exec>(0);
+  runExclusiveByKeyTest<RAJA::omp_parallel_for_exec>(1);
+  runExclusiveByKeyTest<RAJA::omp_parallel_for_exec>(357);
+  runExclusiveByKeyTest<RAJA::omp_parallel_for_exec>(10000);
+}
+
+TEST(ScanByKeyFunctionalTest, OpenMPInplace)
+{
+  runInplaceByKeyTest<RAJA::omp_parallel_for_exec>(10000);
+}
+
+// segments far longer than one thread's block exercise the carry
+// compounding through uniform blocks
+TEST(ScanByKeyFunctionalTest, OpenMPLongSegments)
+{
+  const int n = 100000;
+  std::vector<int> keys(n);
+  std::vector<long> vals(n, 1);
+  for (int i = 0; i < n; ++i) {
+    keys[i] = i / 30000;
+  }
+
+  std::vector<long> out(n, -1);
+  RAJA::inclusive_scan_by_key<RAJA::omp_parallel_for_exec>(
+      keys.data(), keys.data() + n, vals.data(), out.data());
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(out[i], i % 30000 + 1);
+  }
+}
+
+#endif
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for scans reusing a scan context
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <type_traits>
+#include <vector>
+
+// host policies map to the no-op context
+static_assert(
+    std::is_same<RAJA::get_scan_context<RAJA::seq_exec>::type,
+                 RAJA::HostScanContext>::value,
+    "seq_exec scans retain no workspace");
+
+TEST(ScanContextFunctionalTest, ReusedAcrossUnequalSizes)
+{
+  // one context serving scans of many different lengths, as when
+  // scanning every level of an AMR hierarchy each step
+  typename RAJA::get_scan_context<RAJA::seq_exec>::type ctx;
+
+  const int sizes[] = {100, 7, 64, 1, 33};
+  for (int n : sizes) {
+    std::vector<int> in(n), out(n);
+    for (int i = 0; i < n; ++i) {
+      in[i] = i % 5;
+    }
+
+    RAJA::exclusive_scan<RAJA::seq_exec>(ctx, in.data(), in.data() + n,
+                                         out.data());
+
+    int sum = 0;
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(out[i], sum);
+      sum += in[i];
+    }
+  }
+
+  ctx.release();
+}
+
+TEST(ScanContextFunctionalTest, InclusiveMatchesContextFree)
+{
+  const int n = 50;
+  std::vector<double> in(n), out(n), ref(n);
+  for (int i = 0; i < n; ++i) {
+    in[i] = 0.25 * i;
+  }
+
+  RAJA::HostScanContext ctx;
+  RAJA::inclusive_scan<RAJA::loop_exec>(ctx, in.data(), in.data() + n,
+                                        out.data());
+  RAJA::inclusive_scan<RAJA::loop_exec>(in.data(), in.data() + n, ref.data());
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(out[i], ref[i]);
+  }
+}
+
+TEST(ScanContextFunctionalTest, InplaceWithResource)
+{
+  const int n = 40;
+  std::vector<int> data(n);
+  for (int i = 0; i < n; ++i) {
+    data[i] = 1;
+  }
+
+  RAJA::resources::Host host;
+  RAJA::HostScanContext ctx;
+  RAJA::inclusive_scan_inplace<RAJA::seq_exec>(host, ctx, data.data(),
+                                               data.data() + n);
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(data[i], i + 1);
+  }
+
+  RAJA::exclusive_scan_inplace<RAJA::seq_exec>(host, ctx, data.data(),
+                                               data.data() + n);
+  ASSERT_EQ(data[0], 0);
+  ASSERT_EQ(data[n - 1], (n - 1) * n / 2);
+}
@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for zipped scans over multiple sequences
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(ScanZipFunctionalTest, ExclusiveMatchesSeparateScans)
+{
+  const int n = 100;
+  std::vector<int> c0(n), c1(n);
+  std::vector<long> c2(n);
+  std::vector<double> c3(n);
+  for (int i = 0; i < n; ++i) {
+    c0[i] = i % 7;
+    c1[i] = (i % 3 == 0) ? 1 : 0;
+    c2[i] = 10 * i;
+    c3[i] = 0.5 * i;
+  }
+
+  std::vector<int> o0(n), o1(n);
+  std::vector<long> o2(n);
+  std::vector<double> o3(n);
+
+  // one traversal over all four counters
+  RAJA::exclusive_scan_zip<RAJA::seq_exec>(
+      n, RAJA::zip(c0.data(), c1.data(), c2.data(), c3.data()),
+      RAJA::zip(o0.data(), o1.data(), o2.data(), o3.data()));
+
+  // reference: separate scans
+  std::vector<int> r0(n), r1(n);
+  std::vector<long> r2(n);
+  std::vector<double> r3(n);
+  RAJA::exclusive_scan<RAJA::seq_exec>(c0.data(), c0.data() + n, r0.data());
+  RAJA::exclusive_scan<RAJA::seq_exec>(c1.data(), c1.data() + n, r1.data());
+  RAJA::exclusive_scan<RAJA::seq_exec>(c2.data(), c2.data() + n, r2.data());
+  RAJA::exclusive_scan<RAJA::seq_exec>(c3.data(), c3.data() + n, r3.data());
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(o0[i], r0[i]);
+    ASSERT_EQ(o1[i], r1[i]);
+    ASSERT_EQ(o2[i], r2[i]);
+    ASSERT_EQ(o3[i], r3[i]);
+  }
+
+  // inputs are untouched
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(c0[i], i % 7);
+    ASSERT_EQ(c2[i], 10L * i);
+  }
+}
+
+TEST(ScanZipFunctionalTest, InclusiveMatchesSeparateScans)
+{
+  const int n = 57;
+  std::vector<int> c0(n);
+  std::vector<double> c1(n);
+  for (int i = 0; i < n; ++i) {
+    c0[i] = i - 10;
+    c1[i] = 2.0 * i;
+  }
+
+  std::vector<int> o0(n);
+  std::vector<double> o1(n);
+  RAJA::inclusive_scan_zip<RAJA::seq_exec>(n,
+                                           RAJA::zip(c0.data(), c1.data()),
+                                           RAJA::zip(o0.data(), o1.data()));
+
+  std::vector<int> r0(n);
+  std::vector<double> r1(n);
+  RAJA::inclusive_scan<RAJA::seq_exec>(c0.data(), c0.data() + n, r0.data());
+  RAJA::inclusive_scan<RAJA::seq_exec>(c1.data(), c1.data() + n, r1.data());
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(o0[i], r0[i]);
+    ASSERT_EQ(o1[i], r1[i]);
+  }
+}
+
+TEST(ScanZipFunctionalTest, WorksWithLoopPolicyAndResource)
+{
+  const int n = 33;
+  std::vector<int> c0(n), c1(n);
+  for (int i = 0; i < n; ++i) {
+    c0[i] = 1;
+    c1[i] = i;
+  }
+
+  std::vector<int> o0(n), o1(n);
+  RAJA::resources::Host host;
+  RAJA::exclusive_scan_zip<RAJA::loop_exec>(host, n,
+                                            RAJA::zip(c0.data(), c1.data()),
+                                            RAJA::zip(o0.data(), o1.data()));
+
+  int s0 = 0, s1 = 0;
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(o0[i], s0);
+    ASSERT_EQ(o1[i], s1);
+    s0 += c0[i];
+    s1 += c1[i];
+  }
+}
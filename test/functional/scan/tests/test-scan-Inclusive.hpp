@@ -59,6 +59,21 @@ void ScanInclusiveTestImpl(int N)
 
   ASSERT_TRUE(check_inclusive<OP_TYPE>(host_out, host_in, N));
 
+  // scan again through the resource interface and wait on the returned event
+  working_res.memset(work_out, 0, sizeof(T) * N);
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  RAJA::resources::Event e = RAJA::inclusive_scan<EXEC_POLICY>(res,
+                                                               work_in,
+                                                               work_in + N,
+                                                               work_out,
+                                                               OP_TYPE{});
+  e.wait();
+
+  working_res.memcpy(host_out, work_out, sizeof(T) * N);
+
+  ASSERT_TRUE(check_inclusive<OP_TYPE>(host_out, host_in, N));
+
   deallocScanTestData(working_res,
                       work_in, work_out,             
                       host_in, host_out);
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_ASYNC_MEMCPY_HPP__
+#define __TEST_TEAMS_ASYNC_MEMCPY_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsAsyncMemcpyTestImpl()
+{
+
+  constexpr int TILE = 32;
+  int N = 16;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  int* in_array;
+  int* in_check_array;
+  int* in_test_array;
+  int* out_array;
+  int* out_check_array;
+  int* out_test_array;
+
+  allocateForallTestData<int>(N*TILE,
+                             working_res,
+                             &in_array,
+                             &in_check_array,
+                             &in_test_array);
+
+  allocateForallTestData<int>(N*TILE,
+                             working_res,
+                             &out_array,
+                             &out_check_array,
+                             &out_test_array);
+
+  for (int i = 0; i < N*TILE; ++i) {
+    in_test_array[i] = i;
+  }
+  working_res.memcpy(in_array, in_test_array, sizeof(int) * N*TILE);
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Resources(RAJA::expt::Teams(N), RAJA::expt::Threads(TILE)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                // Tile staged in team shared memory by an async bulk copy
+                RAJA_TEAM_SHARED int s_tile[TILE];
+
+                RAJA::expt::team_memcpy_async(ctx, s_tile, &in_array[r*TILE], TILE);
+                RAJA::expt::team_memcpy_commit();
+                RAJA::expt::team_memcpy_wait();
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, TILE), [&](int c) {
+                    out_array[c + TILE*r] = 2*s_tile[c];
+                });  // loop c
+
+                ctx.teamSync();
+
+              });  // loop r
+        });  // outer lambda
+
+  working_res.memcpy(out_check_array, out_array, sizeof(int) * N*TILE);
+
+  for(int r = 0; r < N; ++r) {
+    for (int c = 0; c < TILE; c++) {
+      ASSERT_EQ(2*(c + r*TILE), out_check_array[c + r*TILE]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               in_array,
+                               in_check_array,
+                               in_test_array);
+
+  deallocateForallTestData<int>(working_res,
+                               out_array,
+                               out_check_array,
+                               out_test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsAsyncMemcpyTest);
+template <typename T>
+class TeamsAsyncMemcpyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsAsyncMemcpyTest, AsyncMemcpyTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsAsyncMemcpyTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsAsyncMemcpyTest,
+                            AsyncMemcpyTeams);
+
+#endif  // __TEST_TEAMS_ASYNC_MEMCPY_HPP__
@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_LOOP_REBALANCE_HPP__
+#define __TEST_TEAMS_LOOP_REBALANCE_HPP__
+
+#include <vector>
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsLoopRebalanceTestImpl()
+{
+
+  // outer range with data-dependent inner trip counts 1..7
+  int N = 300;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  // per-outer-iterate offsets into the flattened output
+  std::vector<int> offsets(N+1, 0);
+  for (int i = 0; i < N; ++i) {
+    offsets[i+1] = offsets[i] + (i % 7 + 1);
+  }
+  const int total = offsets[N];
+
+  int* offset_array;
+  int* offset_check_array;
+  int* offset_test_array;
+
+  allocateForallTestData<int>(total,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  allocateForallTestData<int>(N+1,
+                             working_res,
+                             &offset_array,
+                             &offset_check_array,
+                             &offset_test_array);
+
+  for (int i = 0; i < total; ++i) {
+    test_array[i] = -1;
+  }
+  working_res.memcpy(working_array, test_array, sizeof(int) * total);
+  working_res.memcpy(offset_array, offsets.data(), sizeof(int) * (N+1));
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+  // single team; loop_rebalance is collective over the whole team
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Resources(RAJA::expt::Teams(1), RAJA::expt::Threads(64)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop_rebalance(ctx, RAJA::RangeSegment(0, N),
+              [&](int i) { return i % 7 + 1; },
+              [&](int i, int j) {
+                working_array[offset_array[i] + j] = 100*i + j;
+              });
+
+        });  // outer lambda
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * total);
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < i % 7 + 1; ++j) {
+      ASSERT_EQ(100*i + j, check_array[offsets[i] + j]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+
+  deallocateForallTestData<int>(working_res,
+                               offset_array,
+                               offset_check_array,
+                               offset_test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsLoopRebalanceTest);
+template <typename T>
+class TeamsLoopRebalanceTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsLoopRebalanceTest, LoopRebalanceTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsLoopRebalanceTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsLoopRebalanceTest,
+                            LoopRebalanceTeams);
+
+#endif  // __TEST_TEAMS_LOOP_REBALANCE_HPP__
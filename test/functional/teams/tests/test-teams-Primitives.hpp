@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_PRIMITIVES_HPP__
+#define __TEST_TEAMS_PRIMITIVES_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsPrimitivesTestImpl()
+{
+
+  int N = 64;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N*N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Resources(RAJA::expt::Teams(N), RAJA::expt::Threads(N)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                // every team member contributes its thread index; on the
+                // device all members receive the team-wide sum, on the
+                // host a team is one thread so the value is unchanged
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                    const int idx = c + N*r;
+                    working_array[idx] = RAJA::expt::team_sum(ctx, c);
+                });
+
+              });  // loop r
+        });  // outer lambda
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N*N);
+
+  const int team_total = (N - 1) * N / 2;
+  for(int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; c++) {
+      const int expected =
+          (select_cpu_or_gpu == RAJA::expt::HOST) ? c : team_total;
+      ASSERT_EQ(expected, check_array[c + r*N]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsPrimitivesTest);
+template <typename T>
+class TeamsPrimitivesTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsPrimitivesTest, PrimitivesTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsPrimitivesTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsPrimitivesTest,
+                            PrimitivesTeams);
+
+#endif  // __TEST_TEAMS_PRIMITIVES_HPP__
@@ -42,4 +42,9 @@ using OpenMPTargetResourceList = camp::list<camp::resources::Omp>;
 using HipResourceList = camp::list<camp::resources::Hip>;
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+// SYCL policies run against USM shared memory through the Host resource
+using SyclResourceList = HostResourceList;
+#endif
+
 #endif // __RAJA_test_camp_HPP__
@@ -18,6 +18,7 @@
 // Sequential execution policy types
 using SequentialForallExecPols = camp::list< RAJA::seq_exec,
                                              RAJA::loop_exec,
+                                             RAJA::seq_interleaved_exec<4>,
                                              RAJA::simd_exec >;
 
 //
@@ -35,12 +36,17 @@ using SequentialForallAtomicExecPols = camp::list< RAJA::seq_exec,
 using OpenMPForallExecPols = 
   camp::list< RAJA::omp_parallel_exec<RAJA::omp_for_nowait_exec>
               , RAJA::omp_parallel_exec<RAJA::omp_for_exec>
+              , RAJA::omp_parallel_taskloop_exec<4>
+              , RAJA::omp_parallel_for_tiled_exec<32>
+              , RAJA::omp_parallel_for_pinned_exec<16>
+              , RAJA::omp_numa_exec<2>
 #if defined(RAJA_TEST_EXHAUSTIVE)
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Static<4>>>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Static<8>>>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Dynamic<2>>>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Guided<3>>>
-#endif       
+              , RAJA::omp_parallel_taskloop_exec<1>
+#endif
              >;
 
 using OpenMPForallReduceExecPols = OpenMPForallExecPols;
@@ -68,7 +74,9 @@ using TBBForallExecPols = camp::list< RAJA::tbb_for_exec,
                                       RAJA::tbb_for_static< 2 >,
                                       RAJA::tbb_for_static< 4 >,
                                       RAJA::tbb_for_static< 8 >,
-                                      RAJA::tbb_for_dynamic >;
+                                      RAJA::tbb_for_dynamic,
+                                      RAJA::tbb_for_affinity< >,
+                                      RAJA::tbb_for_affinity< 4 > >;
 
 using TBBForallReduceExecPols = TBBForallExecPols;
 
@@ -107,4 +115,11 @@ using HipForallAtomicExecPols = HipForallExecPols;
 
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclForallExecPols = camp::list< RAJA::sycl_exec<128>,
+                                       RAJA::sycl_exec<256> >;
+
+using SyclForallReduceExecPols = SyclForallExecPols;
+#endif
+
 #endif  // __RAJA_test_forall_execpol_HPP__
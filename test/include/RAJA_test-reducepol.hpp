@@ -38,11 +38,16 @@ using OpenMPTargetReducePols =
 #endif
 
 #if defined(RAJA_ENABLE_CUDA)
-using CudaReducePols = camp::list< RAJA::cuda_reduce >;
+using CudaReducePols = camp::list< RAJA::cuda_reduce,
+                                   RAJA::cuda_reduce_tuned<128, 128> >;
 #endif
 
 #if defined(RAJA_ENABLE_HIP)
 using HipReducePols = camp::list< RAJA::hip_reduce >;
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclReducePols = camp::list< RAJA::sycl_reduce >;
+#endif
+
 #endif  // __RAJA_test_reducepol_HPP__
@@ -324,7 +324,8 @@ using SequentialStoragePolicyList =
     camp::list<
                 RAJA::array_of_pointers,
                 RAJA::ragged_array_of_objects,
-                RAJA::constant_stride_array_of_objects
+                RAJA::constant_stride_array_of_objects,
+                RAJA::chunked_array_of_objects
               >;
 
 #if defined(RAJA_ENABLE_TBB)
@@ -343,7 +344,12 @@ using OpenMPExecPolicyList =
                 RAJA::omp_work
               >;
 using OpenMPOrderedPolicyList = SequentialOrderedPolicyList;
-using OpenMPOrderPolicyList   = SequentialOrderPolicyList;
+using OpenMPOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_omp_loop_team_iter_for_nowait
+              >;
 using OpenMPStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
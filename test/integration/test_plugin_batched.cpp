@@ -0,0 +1,167 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <vector>
+
+//
+// Test plugin that opts into batched notification. It is registered
+// statically below, so it is active for every loop in this binary; the
+// tests read the counters it keeps.
+//
+struct BatchedTestPlugin : public RAJA::util::PluginStrategy
+{
+  bool usesBatchedNotification() override { return true; }
+
+  void preCapture(const RAJA::util::PluginContext&) override
+  {
+    s_num_pre_capture++;
+  }
+
+  void postCapture(const RAJA::util::PluginContext&) override
+  {
+    s_num_post_capture++;
+  }
+
+  void preLaunch(const RAJA::util::PluginContext&) override
+  {
+    s_num_pre_launch++;
+  }
+
+  void postLaunch(const RAJA::util::PluginContext&) override
+  {
+    s_num_post_launch++;
+  }
+
+  void preLaunchBatch(const RAJA::util::PluginContext&,
+                      size_t num_launches) override
+  {
+    s_num_pre_batch++;
+    s_last_num_launches = num_launches;
+  }
+
+  void postLaunchBatch(const RAJA::util::PluginContext&,
+                       size_t num_launches) override
+  {
+    s_num_post_batch++;
+    s_last_num_launches = num_launches;
+  }
+
+  static size_t s_num_pre_capture;
+  static size_t s_num_post_capture;
+  static size_t s_num_pre_launch;
+  static size_t s_num_post_launch;
+  static size_t s_num_pre_batch;
+  static size_t s_num_post_batch;
+  static size_t s_last_num_launches;
+};
+
+size_t BatchedTestPlugin::s_num_pre_capture = 0;
+size_t BatchedTestPlugin::s_num_post_capture = 0;
+size_t BatchedTestPlugin::s_num_pre_launch = 0;
+size_t BatchedTestPlugin::s_num_post_launch = 0;
+size_t BatchedTestPlugin::s_num_pre_batch = 0;
+size_t BatchedTestPlugin::s_num_post_batch = 0;
+size_t BatchedTestPlugin::s_last_num_launches = 0;
+
+static RAJA::util::PluginRegistry::add<BatchedTestPlugin> P(
+    "batched-test",
+    "Counts batched plugin notifications for testing.");
+
+TEST(PluginTestBatched, ForallSkipsLaunchHooks)
+{
+  size_t pre_capture = BatchedTestPlugin::s_num_pre_capture;
+  size_t post_capture = BatchedTestPlugin::s_num_post_capture;
+  size_t pre_launch = BatchedTestPlugin::s_num_pre_launch;
+  size_t post_launch = BatchedTestPlugin::s_num_post_launch;
+  size_t pre_batch = BatchedTestPlugin::s_num_pre_batch;
+
+  std::vector<int> data(10, 0);
+  int* a = data.data();
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                               [=](int i) { a[i] = i; });
+
+  // capture hooks still fire per launch, launch hooks are skipped for
+  // batched plugins, and a bare forall opens no batch
+  ASSERT_EQ(BatchedTestPlugin::s_num_pre_capture, pre_capture + 1);
+  ASSERT_EQ(BatchedTestPlugin::s_num_post_capture, post_capture + 1);
+  ASSERT_EQ(BatchedTestPlugin::s_num_pre_launch, pre_launch);
+  ASSERT_EQ(BatchedTestPlugin::s_num_post_launch, post_launch);
+  ASSERT_EQ(BatchedTestPlugin::s_num_pre_batch, pre_batch);
+}
+
+TEST(PluginTestBatched, LaunchBatchScopeBrackets)
+{
+  size_t pre_batch = BatchedTestPlugin::s_num_pre_batch;
+  size_t post_batch = BatchedTestPlugin::s_num_post_batch;
+
+  {
+    RAJA::util::LaunchBatchScope batch(
+        RAJA::util::make_context<RAJA::seq_exec>(), 5);
+    ASSERT_EQ(BatchedTestPlugin::s_num_pre_batch, pre_batch + 1);
+    ASSERT_EQ(BatchedTestPlugin::s_num_post_batch, post_batch);
+    ASSERT_EQ(BatchedTestPlugin::s_last_num_launches, size_t(5));
+  }
+  ASSERT_EQ(BatchedTestPlugin::s_num_post_batch, post_batch + 1);
+}
+
+TEST(PluginTestBatched, RegionIsOneOpenEndedBatch)
+{
+  size_t pre_batch = BatchedTestPlugin::s_num_pre_batch;
+  size_t post_batch = BatchedTestPlugin::s_num_post_batch;
+
+  std::vector<int> data(10, 0);
+  int* a = data.data();
+  RAJA::region<RAJA::seq_region>([=]() {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                                 [=](int i) { a[i] = 1; });
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                                 [=](int i) { a[i] += 1; });
+  });
+
+  // one batch regardless of the number of loops inside, with the
+  // open-ended launch count
+  ASSERT_EQ(BatchedTestPlugin::s_num_pre_batch, pre_batch + 1);
+  ASSERT_EQ(BatchedTestPlugin::s_num_post_batch, post_batch + 1);
+  ASSERT_EQ(BatchedTestPlugin::s_last_num_launches, size_t(0));
+}
+
+TEST(PluginTestBatched, WorkGroupRunReportsLoopCount)
+{
+  constexpr RAJA::Index_type num_loops = 3;
+  constexpr RAJA::Index_type len = 10;
+
+  std::vector<int> data(num_loops * len, 0);
+  int* a = data.data();
+
+  auto body = [=](RAJA::Index_type i) { a[i] += 1; };
+
+  auto pool = RAJA::expt::make_homogeneous_workpool<
+      RAJA::seq_exec, RAJA::Index_type, RAJA::xargs<>>(
+      RAJA::RangeSegment(0, 0), body);
+
+  for (RAJA::Index_type l = 0; l < num_loops; ++l) {
+    pool.enqueue(RAJA::RangeSegment(l * len, (l + 1) * len), body);
+  }
+
+  auto group = pool.instantiate();
+
+  size_t pre_batch = BatchedTestPlugin::s_num_pre_batch;
+  size_t post_batch = BatchedTestPlugin::s_num_post_batch;
+
+  group.run();
+
+  ASSERT_EQ(BatchedTestPlugin::s_num_pre_batch, pre_batch + 1);
+  ASSERT_EQ(BatchedTestPlugin::s_num_post_batch, post_batch + 1);
+  ASSERT_EQ(BatchedTestPlugin::s_last_num_launches, size_t(num_loops));
+
+  for (int v : data) {
+    ASSERT_EQ(v, 1);
+  }
+}
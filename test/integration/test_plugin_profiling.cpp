@@ -0,0 +1,39 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+TEST(PluginTestProfiling, CountsAndTimes)
+{
+  using RAJA::util::ProfilingPlugin;
+
+  ProfilingPlugin::resetStats();
+
+  int* a = new int[100];
+
+  const unsigned long num_launches = 5;
+  for (unsigned long l = 0; l < num_launches; ++l) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                                 [=](int i) { a[i] = i; });
+  }
+
+  ProfilingPlugin::LaunchStats stats =
+      ProfilingPlugin::getStats(RAJA::Platform::host);
+
+  ASSERT_EQ(stats.num_launches, num_launches);
+  ASSERT_GE(stats.total_time, 0.0);
+  ASSERT_LE(stats.min_time, stats.max_time);
+  ASSERT_LE(stats.num_launches * stats.min_time, stats.total_time);
+  ASSERT_GE(stats.num_launches * stats.max_time, stats.total_time);
+
+  ProfilingPlugin::resetStats();
+  stats = ProfilingPlugin::getStats(RAJA::Platform::host);
+  ASSERT_EQ(stats.num_launches, 0ul);
+
+  delete[] a;
+}
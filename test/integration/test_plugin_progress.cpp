@@ -0,0 +1,69 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+TEST(PluginTestProgress, LaunchCounts)
+{
+  using RAJA::util::ProgressPlugin;
+
+  ProgressPlugin::resetLaunchCounts();
+
+  int* a = new int[100];
+
+  const unsigned long num_launches = 5;
+  for (unsigned long l = 0; l < num_launches; ++l) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                                 [=](int i) { a[i] = i; });
+  }
+
+  ProgressPlugin::Snapshot snap = ProgressPlugin::poll();
+  ASSERT_EQ(snap.launches_started, num_launches);
+  ASSERT_EQ(snap.launches_completed, num_launches);
+  ASSERT_EQ(snap.oldest_running_seconds, 0.0);
+
+  // a launch observed from inside the loop body is still in flight
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 1), [=](int) {
+    ProgressPlugin::Snapshot inner = ProgressPlugin::poll();
+    ASSERT_EQ(inner.launches_started, num_launches + 1);
+    ASSERT_EQ(inner.launches_completed, num_launches);
+    ASSERT_GE(inner.oldest_running_seconds, 0.0);
+  });
+
+  delete[] a;
+}
+
+TEST(PluginTestProgress, ChunkCounter)
+{
+  using RAJA::util::ProgressCounter;
+
+  const unsigned long long num_chunks = 8;
+  const int chunk_len = 16;
+
+  ProgressCounter progress("chunk_test", num_chunks);
+  ASSERT_EQ(progress.completed(), 0ull);
+  ASSERT_EQ(progress.total(), num_chunks);
+
+  int* a = new int[num_chunks * chunk_len];
+
+  auto ticker = progress.ticker();
+  RAJA::forall<RAJA::seq_exec>(
+      RAJA::RangeSegment(0, static_cast<int>(num_chunks)), [=](int c) {
+        for (int i = 0; i < chunk_len; ++i) {
+          a[c * chunk_len + i] = c;
+        }
+        ticker.tick();
+      });
+
+  ASSERT_EQ(progress.completed(), num_chunks);
+
+  progress.reset();
+  ASSERT_EQ(progress.completed(), 0ull);
+
+  delete[] a;
+}
@@ -0,0 +1,77 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+TEST(PluginTestRaceCheck, CleanSequentialLoop)
+{
+  using RAJA::util::RaceCheckPlugin;
+
+  RaceCheckPlugin::resetShadows();
+
+  const RAJA::Index_type N = 1000;
+  std::vector<double> data(N, 0.0);
+
+  RAJA::View<double, RAJA::Layout<1>> view(data.data(), N);
+  auto checked = RAJA::util::make_race_check_view("clean", view);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                               [=](RAJA::Index_type i) {
+                                 checked(i) = 2.0 * i;
+                               });
+
+  // writes land through the wrapper unchanged
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(data[i], 2.0 * i);
+  }
+
+  // one worker signature cannot overlap with itself
+  ASSERT_TRUE(RaceCheckPlugin::getConflicts().empty());
+
+  RaceCheckPlugin::resetShadows();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(PluginTestRaceCheck, OverlappingWritesFlagged)
+{
+  using RAJA::util::RaceCheckPlugin;
+
+  RaceCheckPlugin::resetShadows();
+
+  const RAJA::Index_type N = 100000;
+  const RAJA::Index_type M = 16;
+  std::vector<double> data(M, 0.0);
+
+  RAJA::View<double, RAJA::Layout<1>> view(data.data(), M);
+  auto checked = RAJA::util::make_race_check_view("racy", view);
+
+  // every iteration writes one of M elements, so iterations spread
+  // over the thread team collide on the same cache lines
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                            [=](RAJA::Index_type i) {
+                                              checked(i % M) = 1.0 * i;
+                                            });
+
+  auto conflicts = RaceCheckPlugin::getConflicts();
+
+  if (omp_get_max_threads() > 1) {
+    ASSERT_EQ(conflicts.size(), 1u);
+    ASSERT_EQ(conflicts[0].name, "racy");
+    ASSERT_GT(conflicts[0].num_conflicts, 0ul);
+    ASSERT_LT(conflicts[0].first_conflict_offset, M * sizeof(double));
+  }
+
+  RaceCheckPlugin::resetShadows();
+}
+#endif
@@ -0,0 +1,61 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+TEST(PluginTestTransferAdvisor, PerSiteAggregation)
+{
+  using RAJA::util::TransferAdvisorPlugin;
+
+  TransferAdvisorPlugin::resetStats();
+
+  // default threshold is 1 MiB
+  const std::size_t big = 2 * 1024 * 1024;
+  const std::size_t small = 512;
+
+  char* big_buf = new char[big];
+  char* small_buf = new char[small];
+
+  const unsigned long num_big = 3;
+  for (unsigned long l = 0; l < num_big; ++l) {
+    RAJA::util::register_transfer_buffer(big_buf, big, "halo-pack");
+  }
+  RAJA::util::register_transfer_buffer(small_buf, small, "halo-pack");
+  RAJA::util::register_transfer_buffer(big_buf, big, "field-upload");
+
+  TransferAdvisorPlugin::SiteStats stats =
+      TransferAdvisorPlugin::getStats("halo-pack");
+
+  // the sub-threshold registration is not counted
+  ASSERT_EQ(stats.num_registrations, num_big);
+  ASSERT_EQ(stats.total_bytes, num_big * big);
+  ASSERT_LE(stats.num_pageable, stats.num_registrations);
+
+#if defined(RAJA_ENABLE_CUDA)
+  // plain new[] memory is pageable
+  ASSERT_EQ(stats.num_pageable, num_big);
+  ASSERT_EQ(stats.pageable_bytes, num_big * big);
+#endif
+
+  stats = TransferAdvisorPlugin::getStats("field-upload");
+  ASSERT_EQ(stats.num_registrations, 1ul);
+  ASSERT_EQ(stats.total_bytes, big);
+
+  stats = TransferAdvisorPlugin::getStats("never-registered");
+  ASSERT_EQ(stats.num_registrations, 0ul);
+
+  // with no pin budget set the plugin only reports
+  ASSERT_EQ(TransferAdvisorPlugin::getPinnedBytes(), 0ull);
+
+  TransferAdvisorPlugin::resetStats();
+  stats = TransferAdvisorPlugin::getStats("halo-pack");
+  ASSERT_EQ(stats.num_registrations, 0ul);
+
+  delete[] big_buf;
+  delete[] small_buf;
+}
@@ -547,6 +547,56 @@ GPU_TEST(Kernel, CudaZeroIter)
 
 
 
+GPU_TEST(Kernel, CudaRepeatedLaunch)
+{
+  using Pol =
+      KernelPolicy<
+        CudaKernel<
+          For<0, cuda_block_x_loop,
+            For<1, cuda_thread_x_loop,
+              Lambda<0>
+            >
+          >
+        >
+      >;
+
+  constexpr int N = 37;
+  constexpr int M = 91;
+
+  int *x = nullptr;
+  cudaErrchk(cudaMallocManaged(&x, N * M * sizeof(int)));
+
+  for (int i = 0; i < N * M; ++i) {
+    x[i] = 0;
+  }
+
+  // Launch the same call site repeatedly, alternating the iteration
+  // space extents, so later launches reuse the launch dimensions
+  // cached for each extent from the first time it was seen.
+  for (int rep = 0; rep < 3; ++rep) {
+    for (int n : {N, N / 2}) {
+      RAJA::kernel<Pol>(
+          RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                           RAJA::RangeSegment(0, M)),
+          [=] __device__(Index_type i, Index_type j) {
+            x[i * M + j] += 1;
+          });
+    }
+  }
+
+  cudaErrchk(cudaDeviceSynchronize());
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(x[i * M + j], (i < N / 2) ? 6 : 3);
+    }
+  }
+
+  cudaErrchk(cudaFree(x));
+}
+
+
+
 
 GPU_TEST(Kernel, CudaCollapse2)
 {
@@ -2765,6 +2815,56 @@ GPU_TEST(Kernel, Hyperplane_cuda_2d)
   cudaErrchk(cudaFree(x));
 }
 
+GPU_TEST(Kernel, Hyperplane_cuda_2d_multiblock)
+{
+  using namespace RAJA;
+
+  // j spans multiple blocks, so planes are separated by the
+  // block-to-block flag barrier instead of a kernel launch each
+  using Pol =
+      RAJA::KernelPolicy<CudaKernel<
+        statement::Tile<1, tile_fixed<8>, cuda_block_x_direct,
+          For<1, cuda_thread_x_direct,
+            Hyperplane<0, seq_exec, ArgList<1>,
+                                       Lambda<0>, CudaSyncGrid>>>>>;
+
+  constexpr long N = (long)24;
+  constexpr long M = (long)32;
+
+  int *x = nullptr;
+  cudaErrchk(cudaMallocManaged(&x, N * M * sizeof(int)));
+
+
+  using myview = View<int, Layout<2, RAJA::Index_type>>;
+  myview xv{x, N, M};
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                     RAJA::RangeSegment(0, M)),
+                    [=] __device__(Index_type i, Index_type j) {
+                      int left = 1;
+                      if (i > 0) {
+                        left = xv(i - 1, j);
+                      }
+
+                      int up = 1;
+                      if (j > 0) {
+                        up = xv(i, j - 1);
+                      }
+
+                      xv(i, j) = left + up;
+                    });
+
+  cudaErrchk(cudaDeviceSynchronize());
+
+  for (int i = 1; i < N; ++i) {
+    for (int j = 1; j < M; ++j) {
+      ASSERT_EQ(xv(i, j), xv(i - 1, j) + xv(i, j - 1));
+    }
+  }
+
+  cudaErrchk(cudaFree(x));
+}
+
 GPU_TEST(Kernel, Hyperplane_cuda_2d_negstride)
 {
   using namespace RAJA;
@@ -489,6 +489,81 @@ INSTANTIATE_TYPED_TEST_SUITE_P(Seq, MatTranspose, SeqTypes);
 INSTANTIATE_TYPED_TEST_SUITE_P(Seq, TypedLocalMem, SeqTypes);
 
 
+//
+// Double-buffered tile copy: lambda 0 stages the current tile into the
+// load buffer, SwapLocalMem makes it the compute buffer, and lambda 1
+// drains it. Checks that the swapped storage carries values between the
+// two phases of each tile.
+//
+TEST(LocalMem, SwapLocalMem)
+{
+  const int N = 100;
+  const int tile_dim = 16;
+  const int n_tiles = (N - 1) / tile_dim + 1;
+
+  double *A = new double[N];
+  double *B = new double[N];
+
+  for (int i = 0; i < N; ++i) {
+    A[i] = i;
+    B[i] = 0;
+  }
+
+  using Tile1D =
+      RAJA::LocalArray<double, RAJA::Perm<0>, RAJA::SizeList<tile_dim>>;
+  Tile1D loadTile, computeTile;
+
+  using Pol =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::loop_exec,
+
+        RAJA::statement::InitLocalMem<RAJA::cpu_tile_mem, RAJA::ParamList<0,1>,
+
+            //Stage tile into the load buffer
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >,
+
+            //Make the load buffer the compute buffer
+            RAJA::statement::SwapLocalMem<0, 1>,
+
+            //Drain the compute buffer
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<1>
+            >
+
+          > //close shared memory scope
+      >//for 1
+    >; //kernel policy
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, tile_dim),
+                       RAJA::RangeSegment(0, n_tiles)),
+      RAJA::make_tuple(loadTile, computeTile),
+
+      [=](int ti, int t, Tile1D &loadTile, Tile1D &) {
+        int i = t * tile_dim + ti;
+        if (i < N) {
+          loadTile(ti) = A[i];
+        }
+      },
+
+      [=](int ti, int t, Tile1D &, Tile1D &computeTile) {
+        int i = t * tile_dim + ti;
+        if (i < N) {
+          B[i] = computeTile(ti);
+        }
+      });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_FLOAT_EQ(B[i], A[i]);
+  }
+
+  delete [] A;
+  delete [] B;
+}
+
+
 #if defined(RAJA_ENABLE_OPENMP)
 using TestTypes =
   ::testing::Types<
@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::find_if
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+template <typename ExecPolicy>
+void testFindIf()
+{
+  constexpr std::ptrdiff_t N = 10000;
+
+  std::vector<int> data(N, 0);
+
+  // no match
+  ASSERT_EQ(N, RAJA::find_if(ExecPolicy{},
+                             data.data(),
+                             data.data() + N,
+                             [](int v) { return v != 0; }));
+
+  // early hit: only the first of several matches is reported
+  data[3] = 1;
+  data[N / 2] = 1;
+  data[N - 1] = 1;
+  ASSERT_EQ(3, RAJA::find_if(ExecPolicy{},
+                             data.data(),
+                             data.data() + N,
+                             [](int v) { return v != 0; }));
+
+  // match in the last element
+  std::fill(data.begin(), data.end(), 0);
+  data[N - 1] = 1;
+  ASSERT_EQ(N - 1, RAJA::find_if(ExecPolicy{},
+                                 data.data(),
+                                 data.data() + N,
+                                 [](int v) { return v != 0; }));
+
+  // empty range
+  ASSERT_EQ(0, RAJA::find_if(ExecPolicy{},
+                             data.data(),
+                             data.data(),
+                             [](int v) { return v != 0; }));
+
+  // container overload over a segment: position of the first index value
+  // satisfying the predicate
+  RAJA::RangeSegment seg(100, 200);
+  ASSERT_EQ(50, RAJA::find_if(ExecPolicy{}, seg, [](RAJA::Index_type i) {
+              return i >= 150;
+            }));
+  ASSERT_EQ(100, RAJA::find_if(ExecPolicy{}, seg, [](RAJA::Index_type i) {
+              return i >= 12345;
+            }));
+}
+
+TEST(FindIfUnitTest, Sequential)
+{
+  testFindIf<RAJA::seq_exec>();
+}
+
+TEST(FindIfUnitTest, Loop)
+{
+  testFindIf<RAJA::loop_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(FindIfUnitTest, OpenMP)
+{
+  testFindIf<RAJA::omp_parallel_for_exec>();
+}
+#endif
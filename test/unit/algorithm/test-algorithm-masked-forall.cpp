@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::masked_forall
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <atomic>
+#include <random>
+#include <vector>
+
+template <typename ExecPolicy>
+void testMaskedForall()
+{
+  // cover empty words, full words, and partially-active words, plus a
+  // length that ends mid-word
+  constexpr RAJA::Index_type N = 64 * 5 + 17;
+
+  std::mt19937 rng(365);
+  std::uniform_int_distribution<int> coin(0, 1);
+
+  std::vector<int> active(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    if (i < 64) {
+      active[i] = 0;  // empty word
+    } else if (i < 128) {
+      active[i] = 1;  // full word
+    } else {
+      active[i] = coin(rng);
+    }
+  }
+
+  std::vector<RAJA::BitSetWord> words(RAJA::BitSetView::num_words(N), 0ull);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    if (active[i]) {
+      words[i / RAJA::BitSetView::bits_per_word] |=
+          1ull << (i % RAJA::BitSetView::bits_per_word);
+    }
+  }
+  RAJA::BitSetView mask(words.data());
+
+  std::vector<std::atomic<int>> visits(N);
+  for (auto& v : visits) {
+    v = 0;
+  }
+
+  RAJA::masked_forall(ExecPolicy{},
+                      RAJA::RangeSegment(0, N),
+                      mask,
+                      [&](RAJA::Index_type i) { visits[i] += 1; });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(visits[i].load(), active[i]);
+  }
+}
+
+template <typename ExecPolicy>
+void testMaskedForallOffsetRange()
+{
+  // bit i of the mask governs the i-th iterate of the segment, not the
+  // segment value
+  constexpr RAJA::Index_type N = 100;
+  constexpr RAJA::Index_type offset = 1000;
+
+  std::vector<RAJA::BitSetWord> words(RAJA::BitSetView::num_words(N), 0ull);
+  for (RAJA::Index_type i = 0; i < N; i += 3) {
+    words[i / RAJA::BitSetView::bits_per_word] |=
+        1ull << (i % RAJA::BitSetView::bits_per_word);
+  }
+  RAJA::BitSetView mask(words.data());
+
+  std::vector<int> visits(N, 0);
+
+  RAJA::masked_forall<ExecPolicy>(
+      RAJA::RangeSegment(offset, offset + N),
+      mask,
+      [&](RAJA::Index_type i) { visits[i - offset] += 1; });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(visits[i], (i % 3 == 0) ? 1 : 0);
+  }
+}
+
+TEST(MaskedForall, seq)
+{
+  testMaskedForall<RAJA::seq_exec>();
+}
+
+TEST(MaskedForall, loop)
+{
+  testMaskedForall<RAJA::loop_exec>();
+}
+
+TEST(MaskedForall, offset_range_seq)
+{
+  testMaskedForallOffsetRange<RAJA::seq_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(MaskedForall, openmp)
+{
+  testMaskedForall<RAJA::omp_parallel_for_exec>();
+}
+#endif
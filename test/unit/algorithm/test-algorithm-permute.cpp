@@ -0,0 +1,141 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::permute and the permutation
+/// generation utilities
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template <typename ExecPolicy>
+void testPermuteApply()
+{
+  // longer than one cache block so the host tiling splits the range
+  constexpr RAJA::Index_type N = 3000;
+
+  std::vector<RAJA::Index_type> perm(N);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::mt19937 rng(917);
+  std::shuffle(perm.begin(), perm.end(), rng);
+
+  std::vector<double> in(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    in[i] = static_cast<double>(i) * 0.5;
+  }
+  std::vector<double> out(N, -1.0);
+
+  RAJA::permute(ExecPolicy{},
+                perm.data(),
+                perm.data() + N,
+                in.data(),
+                out.data());
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(in[perm[i]], out[i]);
+  }
+}
+
+template <typename ExecPolicy>
+void testInvertPermutation()
+{
+  constexpr RAJA::Index_type N = 257;
+
+  std::vector<RAJA::Index_type> perm(N);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::mt19937 rng(33);
+  std::shuffle(perm.begin(), perm.end(), rng);
+
+  std::vector<RAJA::Index_type> inv(N, -1);
+  RAJA::invert_permutation(ExecPolicy{}, perm.data(), perm.data() + N,
+                           inv.data());
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(i, inv[perm[i]]);
+    ASSERT_EQ(i, perm[inv[i]]);
+  }
+}
+
+template <typename ExecPolicy>
+void testSortedPermutation()
+{
+  constexpr RAJA::Index_type N = 500;
+
+  std::vector<int> keys(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    keys[i] = static_cast<int>((i * 6143) % 1009);
+  }
+  std::vector<int> orig_keys(keys);
+  std::vector<double> field(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    field[i] = static_cast<double>(keys[i]);
+  }
+
+  std::vector<RAJA::Index_type> perm(N, -1);
+  std::vector<RAJA::Index_type> inv(N, -1);
+
+  RAJA::sorted_permutation(ExecPolicy{}, keys.data(), keys.data() + N,
+                           perm.data(), inv.data());
+
+  ASSERT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+  // perm gathers companion fields into sorted order
+  std::vector<double> sorted_field(N);
+  RAJA::permute(ExecPolicy{}, perm.data(), perm.data() + N, field.data(),
+                sorted_field.data());
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(static_cast<double>(keys[i]), sorted_field[i]);
+    ASSERT_EQ(orig_keys[perm[i]], keys[i]);
+  }
+
+  // inv maps original positions to sorted positions
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(i, inv[perm[i]]);
+  }
+}
+
+TEST(Permute, ApplySeq) { testPermuteApply<RAJA::seq_exec>(); }
+
+TEST(Permute, ApplyLoop) { testPermuteApply<RAJA::loop_exec>(); }
+
+TEST(Permute, InvertSeq) { testInvertPermutation<RAJA::seq_exec>(); }
+
+TEST(Permute, SortedPermutationSeq)
+{
+  testSortedPermutation<RAJA::seq_exec>();
+}
+
+TEST(Permute, SortedPermutationLoop)
+{
+  testSortedPermutation<RAJA::loop_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(Permute, ApplyOpenMP)
+{
+  testPermuteApply<RAJA::omp_parallel_for_exec>();
+}
+
+TEST(Permute, InvertOpenMP)
+{
+  testInvertPermutation<RAJA::omp_parallel_for_exec>();
+}
+
+TEST(Permute, SortedPermutationOpenMP)
+{
+  testSortedPermutation<RAJA::omp_parallel_for_exec>();
+}
+
+#endif
@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::reduce_then_transform
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+template <typename ExecPolicy>
+void testNormalize()
+{
+  constexpr RAJA::Index_type N = 1000;
+
+  std::vector<double> data(N);
+  double expected_sum = 0.0;
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    data[i] = static_cast<double>(i % 13) + 1.0;
+    expected_sum += data[i];
+  }
+  double* dptr = data.data();
+
+  double sum = RAJA::reduce_then_transform<ExecPolicy>(
+      RAJA::RangeSegment(0, N),
+      0.0,
+      [=](RAJA::Index_type i) { return dptr[i]; },
+      [=](RAJA::Index_type i, double total) { dptr[i] /= total; });
+
+  ASSERT_DOUBLE_EQ(expected_sum, sum);
+
+  double normalized_sum = 0.0;
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_DOUBLE_EQ((static_cast<double>(i % 13) + 1.0) / expected_sum,
+                     data[i]);
+    normalized_sum += data[i];
+  }
+  ASSERT_NEAR(1.0, normalized_sum, 1e-12);
+}
+
+template <typename ExecPolicy>
+void testMaxScale()
+{
+  constexpr RAJA::Index_type N = 357;
+
+  std::vector<int> data(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    data[i] = static_cast<int>((i * 7919) % 100);
+  }
+  int* dptr = data.data();
+
+  // non-default binary operation: scale everything by the maximum
+  int max_val = RAJA::reduce_then_transform<ExecPolicy>(
+      RAJA::RangeSegment(0, N),
+      RAJA::operators::limits<int>::min(),
+      [=](RAJA::Index_type i) { return dptr[i]; },
+      [=](RAJA::Index_type i, int total) { dptr[i] = total - dptr[i]; },
+      RAJA::operators::maximum<int>{});
+
+  ASSERT_EQ(99, max_val);
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(99 - static_cast<int>((i * 7919) % 100), data[i]);
+  }
+}
+
+TEST(ReduceThenTransform, NormalizeSeq) { testNormalize<RAJA::seq_exec>(); }
+
+TEST(ReduceThenTransform, NormalizeLoop) { testNormalize<RAJA::loop_exec>(); }
+
+TEST(ReduceThenTransform, MaxScaleSeq) { testMaxScale<RAJA::seq_exec>(); }
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(ReduceThenTransform, NormalizeOpenMP)
+{
+  testNormalize<RAJA::omp_parallel_for_exec>();
+}
+
+TEST(ReduceThenTransform, MaxScaleOpenMP)
+{
+  testMaxScale<RAJA::omp_parallel_for_exec>();
+}
+
+TEST(ReduceThenTransform, EmptySegmentOpenMP)
+{
+  double sum = RAJA::reduce_then_transform<RAJA::omp_parallel_for_exec>(
+      RAJA::RangeSegment(0, 0),
+      0.0,
+      [=](RAJA::Index_type) { return 1.0; },
+      [=](RAJA::Index_type, double) { FAIL(); });
+  ASSERT_EQ(0.0, sum);
+}
+
+#endif
@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::segmented_reduce
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template <typename ExecPolicy>
+void testSegmentedReduceSum()
+{
+  constexpr int num_segments = 100;
+
+  std::mt19937 rng(458);
+  std::uniform_int_distribution<int> seg_len(0, 32);
+  std::uniform_int_distribution<int> values(-1000, 1000);
+
+  std::vector<RAJA::Index_type> offsets{0};
+  for (int s = 0; s < num_segments; ++s) {
+    offsets.push_back(offsets.back() + seg_len(rng));
+  }
+
+  std::vector<int> data(offsets.back());
+  for (auto& v : data) {
+    v = values(rng);
+  }
+
+  std::vector<int> result(num_segments, -1);
+
+  RAJA::segmented_reduce(ExecPolicy{},
+                         data.data(),
+                         data.data() + data.size(),
+                         offsets.data(),
+                         offsets.data() + offsets.size(),
+                         result.data());
+
+  for (int s = 0; s < num_segments; ++s) {
+    int expected = 0;
+    for (RAJA::Index_type i = offsets[s]; i < offsets[s + 1]; ++i) {
+      expected += data[i];
+    }
+    ASSERT_EQ(result[s], expected);
+  }
+}
+
+template <typename ExecPolicy>
+void testSegmentedReduceMax()
+{
+  constexpr int num_segments = 20;
+
+  std::mt19937 rng(992);
+  std::uniform_int_distribution<int> seg_len(0, 16);
+  std::uniform_int_distribution<int> values(-1000, 1000);
+
+  std::vector<RAJA::Index_type> offsets{0};
+  for (int s = 0; s < num_segments; ++s) {
+    offsets.push_back(offsets.back() + seg_len(rng));
+  }
+
+  std::vector<int> data(offsets.back());
+  for (auto& v : data) {
+    v = values(rng);
+  }
+
+  std::vector<int> result(num_segments, 0);
+
+  RAJA::segmented_reduce(ExecPolicy{},
+                         data.data(),
+                         data.data() + data.size(),
+                         offsets.data(),
+                         offsets.data() + offsets.size(),
+                         result.data(),
+                         RAJA::operators::maximum<int>{});
+
+  for (int s = 0; s < num_segments; ++s) {
+    int expected = RAJA::operators::maximum<int>::identity();
+    for (RAJA::Index_type i = offsets[s]; i < offsets[s + 1]; ++i) {
+      expected = std::max(expected, data[i]);
+    }
+    ASSERT_EQ(result[s], expected);
+  }
+}
+
+TEST(SegmentedReduce, sum_seq)
+{
+  testSegmentedReduceSum<RAJA::seq_exec>();
+}
+
+TEST(SegmentedReduce, sum_loop)
+{
+  testSegmentedReduceSum<RAJA::loop_exec>();
+}
+
+TEST(SegmentedReduce, max_seq)
+{
+  testSegmentedReduceMax<RAJA::seq_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(SegmentedReduce, sum_openmp)
+{
+  testSegmentedReduceSum<RAJA::omp_parallel_for_exec>();
+}
+
+TEST(SegmentedReduce, max_openmp)
+{
+  testSegmentedReduceMax<RAJA::omp_parallel_for_exec>();
+}
+#endif
@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::sort_segments
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template <typename ExecPolicy, typename SortFn>
+void testSegmentedSort(SortFn sorter)
+{
+  constexpr int num_segments = 100;
+
+  std::mt19937 rng(753);
+  std::uniform_int_distribution<int> seg_len(0, 32);
+  std::uniform_int_distribution<int> values(-1000, 1000);
+
+  std::vector<RAJA::Index_type> offsets{0};
+  for (int s = 0; s < num_segments; ++s) {
+    offsets.push_back(offsets.back() + seg_len(rng));
+  }
+
+  std::vector<int> data(offsets.back());
+  for (auto& v : data) {
+    v = values(rng);
+  }
+  std::vector<int> expected(data);
+
+  sorter(ExecPolicy{},
+         data.data(),
+         offsets.data(),
+         offsets.data() + offsets.size());
+
+  for (int s = 0; s < num_segments; ++s) {
+    std::sort(expected.begin() + offsets[s], expected.begin() + offsets[s + 1]);
+  }
+
+  ASSERT_EQ(data, expected);
+}
+
+struct UnstableSorter {
+  template <typename... Args>
+  void operator()(Args&&... args) const
+  {
+    RAJA::sort_segments(std::forward<Args>(args)...);
+  }
+};
+
+struct StableSorter {
+  template <typename... Args>
+  void operator()(Args&&... args) const
+  {
+    RAJA::stable_sort_segments(std::forward<Args>(args)...);
+  }
+};
+
+TEST(SegmentedSort, sort_segments_seq)
+{
+  testSegmentedSort<RAJA::seq_exec>(UnstableSorter{});
+}
+
+TEST(SegmentedSort, stable_sort_segments_seq)
+{
+  testSegmentedSort<RAJA::seq_exec>(StableSorter{});
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(SegmentedSort, sort_segments_openmp)
+{
+  testSegmentedSort<RAJA::omp_parallel_for_exec>(UnstableSorter{});
+}
+#endif
+
+TEST(SegmentedSort, stable_sort_pairs_bits_seq)
+{
+  constexpr int len = 500;
+  constexpr int num_key_bits = 4;
+
+  std::mt19937 rng(357);
+  std::uniform_int_distribution<int> values(0, 1 << 10);
+
+  std::vector<int> keys(len);
+  std::vector<int> vals(len);
+  for (int i = 0; i < len; ++i) {
+    keys[i] = values(rng);
+    vals[i] = i;
+  }
+
+  RAJA::stable_sort_pairs_bits(RAJA::seq_exec{},
+                               keys.data(),
+                               keys.data() + len,
+                               vals.data(),
+                               num_key_bits);
+
+  const int mask = (1 << num_key_bits) - 1;
+  for (int i = 1; i < len; ++i) {
+    // sorted on the low bits only
+    ASSERT_LE(keys[i - 1] & mask, keys[i] & mask);
+    if ((keys[i - 1] & mask) == (keys[i] & mask)) {
+      // stable: original order preserved within equal masked keys
+      ASSERT_LT(vals[i - 1], vals[i]);
+    }
+  }
+}
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::sorted_insert
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template <typename ExecPolicy>
+void testSortedInsert(int sorted_len, int batch_len)
+{
+  std::mt19937 rng(8675);
+  std::uniform_int_distribution<int> values(-1000, 1000);
+
+  std::vector<int> data(sorted_len + batch_len);
+  for (auto& v : data) {
+    v = values(rng);
+  }
+  std::sort(data.begin(), data.begin() + sorted_len);
+  std::vector<int> expected(data);
+
+  RAJA::sorted_insert(ExecPolicy{},
+                      data.data(),
+                      data.data() + sorted_len,
+                      data.data() + data.size());
+
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(data, expected);
+}
+
+template <typename ExecPolicy>
+void testSortedInsertPairs(int sorted_len, int batch_len)
+{
+  std::mt19937 rng(2468);
+  std::uniform_int_distribution<int> values(0, 40);
+
+  const int len = sorted_len + batch_len;
+  std::vector<int> keys(len);
+  std::vector<int> vals(len);
+  for (int i = 0; i < len; ++i) {
+    keys[i] = values(rng);
+    // values tag the run of origin so stability between runs is checkable
+    vals[i] = (i < sorted_len) ? i : 100000 + i;
+  }
+  std::sort(keys.begin(), keys.begin() + sorted_len);
+  std::vector<int> expected_keys(keys);
+
+  RAJA::sorted_insert_pairs(ExecPolicy{},
+                            keys.data(),
+                            keys.data() + sorted_len,
+                            keys.data() + len,
+                            vals.data());
+
+  std::sort(expected_keys.begin(), expected_keys.end());
+  ASSERT_EQ(keys, expected_keys);
+
+  // each value still sits next to its key, and among equal keys the
+  // existing run precedes the batch
+  for (int i = 1; i < len; ++i) {
+    if (keys[i - 1] == keys[i] && vals[i - 1] >= 100000) {
+      ASSERT_GE(vals[i], 100000);
+    }
+  }
+}
+
+TEST(SortedInsert, sorted_insert_seq)
+{
+  testSortedInsert<RAJA::seq_exec>(1000, 37);
+}
+
+TEST(SortedInsert, sorted_insert_edge_cases_seq)
+{
+  // empty batch, empty sorted run, and both
+  testSortedInsert<RAJA::seq_exec>(100, 0);
+  testSortedInsert<RAJA::seq_exec>(0, 100);
+  testSortedInsert<RAJA::seq_exec>(0, 0);
+}
+
+TEST(SortedInsert, sorted_insert_pairs_seq)
+{
+  testSortedInsertPairs<RAJA::seq_exec>(1000, 37);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(SortedInsert, sorted_insert_openmp)
+{
+  testSortedInsert<RAJA::omp_parallel_for_exec>(1000, 37);
+}
+
+TEST(SortedInsert, sorted_insert_pairs_openmp)
+{
+  testSortedInsertPairs<RAJA::omp_parallel_for_exec>(1000, 37);
+}
+#endif
@@ -22,6 +22,8 @@
 
 #include "test-algorithm-sort-utils.hpp"
 
+#include <vector>
+
 
 template < typename forone_policy >
 using ForoneSynchronize = PolicySynchronize<forone_equivalent_exec_policy<forone_policy>>;
@@ -57,6 +59,12 @@ struct MergeSort;
 template < typename forone_policy, typename platform = forone_platform<forone_policy> >
 struct MergeSortPairs;
 
+template < typename forone_policy, typename platform = forone_platform<forone_policy> >
+struct MergeSortInplace;
+
+template < typename forone_policy, typename platform = forone_platform<forone_policy> >
+struct MergeSortWorkspace;
+
 
 template < typename forone_policy >
 struct InsertionSort<forone_policy, RunOnHost>
@@ -313,6 +321,72 @@ struct MergeSortPairs<forone_policy, RunOnHost>
   }
 };
 
+template < typename forone_policy >
+struct MergeSortInplace<forone_policy, RunOnHost>
+  : ForoneSynchronize<forone_policy>
+{
+  using sort_category = stable_sort_tag;
+  using sort_interface = sort_interface_tag;
+
+  const char* name()
+  {
+    return "RAJA::merge_sort[inplace]";
+  }
+
+  template < typename Iter >
+  void operator()(Iter begin, Iter end)
+  {
+    operator()(begin, end,
+               RAJA::operators::less<RAJA::detail::IterVal<Iter>>{});
+  }
+
+  template < typename Iter, typename Compare >
+  void operator()(Iter begin, Iter end, Compare comp)
+  {
+    using value_type = RAJA::detail::IterVal<Iter>;
+    RAJA::merge_sort(begin, end,
+                     static_cast<value_type*>(nullptr),
+                     RAJA::detail::IterDiff<Iter>(0),
+                     comp);
+  }
+};
+
+template < typename forone_policy >
+struct MergeSortWorkspace<forone_policy, RunOnHost>
+  : ForoneSynchronize<forone_policy>
+{
+  using sort_category = stable_sort_tag;
+  using sort_interface = sort_interface_tag;
+
+  const char* name()
+  {
+    return "RAJA::merge_sort[workspace]";
+  }
+
+  template < typename Iter >
+  void operator()(Iter begin, Iter end)
+  {
+    operator()(begin, end,
+               RAJA::operators::less<RAJA::detail::IterVal<Iter>>{});
+  }
+
+  template < typename Iter, typename Compare >
+  void operator()(Iter begin, Iter end, Compare comp)
+  {
+    using value_type = RAJA::detail::IterVal<Iter>;
+    using diff_type = RAJA::detail::IterDiff<Iter>;
+
+    // O(sqrt(N)) workspace, deliberately smaller than the range so some
+    // merge levels exercise the rotation fallback
+    diff_type n = end - begin;
+    diff_type work_len = 1;
+    while ( (work_len+1) * (work_len+1) <= n ) { ++work_len; }
+
+    std::vector<value_type> work(static_cast<size_t>(work_len));
+    RAJA::merge_sort(begin, end, work.data(), work_len, comp);
+  }
+};
+
 #if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
 
 template < typename forone_policy >
@@ -730,7 +804,9 @@ using SequentialIntroSortSorters =
 using SequentialMergeSortSorters =
   camp::list<
               MergeSort<forone_seq>,
-              MergeSortPairs<forone_seq>
+              MergeSortPairs<forone_seq>,
+              MergeSortInplace<forone_seq>,
+              MergeSortWorkspace<forone_seq>
             >;
 
 #if defined(RAJA_ENABLE_CUDA)
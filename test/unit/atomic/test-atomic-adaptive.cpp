@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for contention-adaptive accumulators
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <vector>
+
+template <typename ExecPolicy, typename AtomicPolicy>
+void testAdaptiveScatterAdd( size_t num_bins, size_t num_replicas, int N )
+{
+  using acc_t = RAJA::AdaptiveAccumulator<int, AtomicPolicy>;
+
+  std::vector<int> target( num_bins, 0 );
+  std::vector<int> workspace(
+      acc_t::workspace_size( num_bins, num_replicas ) );
+  std::vector<unsigned> ctrl( acc_t::control_size );
+
+  acc_t acc( target.data(), workspace.data(), ctrl.data(),
+             num_bins, num_replicas );
+  acc.reset();
+
+  ASSERT_EQ( 0u, acc.mode() );  // sampling
+
+  RAJA::forall<ExecPolicy>( RAJA::RangeSegment( 0, N ), [=]( int i ) {
+    acc.add( i % num_bins, 1 );
+  } );
+
+  acc.merge();
+
+  for (size_t b = 0; b < num_bins; ++b) {
+    ASSERT_EQ( target[b], N / (int)num_bins );
+  }
+}
+
+TEST( AdaptiveAccumulatorUnitTest, SeqScatterAdd )
+{
+  // run length spanning the sample window, so the strategy switch
+  // happens mid-loop; totals must be exact either way
+  testAdaptiveScatterAdd<RAJA::seq_exec, RAJA::seq_atomic>( 40, 1, 10000 );
+
+  // short run that never leaves the sampling phase
+  testAdaptiveScatterAdd<RAJA::seq_exec, RAJA::seq_atomic>( 10, 1, 100 );
+}
+
+TEST( AdaptiveAccumulatorUnitTest, SeqSelectsDirect )
+{
+  // single-threaded CASes never collide, so sampling must settle on
+  // the direct strategy
+  using acc_t = RAJA::AdaptiveAccumulator<int, RAJA::seq_atomic>;
+
+  const size_t num_bins = 4;
+  std::vector<int> target( num_bins, 0 );
+  std::vector<int> workspace( acc_t::workspace_size( num_bins, 1 ) );
+  std::vector<unsigned> ctrl( acc_t::control_size );
+
+  acc_t acc( target.data(), workspace.data(), ctrl.data(), num_bins, 1 );
+  acc.reset();
+
+  const int N = 2 * (int)acc_t::sample_window;
+  RAJA::forall<RAJA::seq_exec>( RAJA::RangeSegment( 0, N ), [=]( int i ) {
+    acc.add( i % num_bins, 1 );
+  } );
+
+  ASSERT_EQ( 1u, acc.mode() );  // direct
+
+  acc.merge();
+  for (size_t b = 0; b < num_bins; ++b) {
+    ASSERT_EQ( target[b], N / (int)num_bins );
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST( AdaptiveAccumulatorUnitTest, OpenMPScatterAdd )
+{
+  // hot bins: contended sampling may engage the privatized path
+  testAdaptiveScatterAdd<RAJA::omp_parallel_for_exec, RAJA::omp_atomic>(
+      4, 16, 100000 );
+
+  // scattered bins: sampling should mostly stay direct
+  testAdaptiveScatterAdd<RAJA::omp_parallel_for_exec, RAJA::omp_atomic>(
+      4096, 16, 100000 );
+}
+#endif
@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for atomic list appends
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <algorithm>
+#include <vector>
+
+template <typename ExecPolicy, typename AtomicPolicy>
+void testAtomicAppend()
+{
+  const RAJA::Index_type N = 10000;
+
+  // collect the indices of elements passing a filter
+  std::vector<RAJA::Index_type> out(N, RAJA::Index_type(-1));
+  RAJA::Index_type count = 0;
+
+  auto list = RAJA::make_append_list(out.data(), &count, N);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N),
+                           [=](RAJA::Index_type i) {
+                             if (i % 3 == 0) {
+                               RAJA::atomic_append<AtomicPolicy>(list, i);
+                             }
+                           });
+
+  RAJA::Index_type expected = (N + 2) / 3;
+  ASSERT_EQ(count, expected);
+
+  std::sort(out.begin(), out.begin() + count);
+  for (RAJA::Index_type k = 0; k < count; ++k) {
+    ASSERT_EQ(out[k], 3 * k);
+  }
+}
+
+template <typename ExecPolicy, typename AtomicPolicy>
+void testAtomicAppendBounded()
+{
+  const RAJA::Index_type N = 1000;
+  const RAJA::Index_type capacity = 100;
+
+  std::vector<RAJA::Index_type> out(capacity, RAJA::Index_type(-1));
+  RAJA::Index_type count = 0;
+  RAJA::Index_type dropped = 0;
+
+  auto list = RAJA::make_append_list(out.data(), &count, capacity);
+  RAJA::Index_type* dropped_ptr = &dropped;
+
+  RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+        if (RAJA::atomic_append<AtomicPolicy>(list, i) ==
+            RAJA::Index_type(-1)) {
+          RAJA::atomicAdd<AtomicPolicy>(dropped_ptr, RAJA::Index_type(1));
+        }
+      });
+
+  // the counter overshoots; the stored list length is the capacity
+  ASSERT_GE(count, capacity);
+  ASSERT_EQ(std::min(count, capacity), capacity);
+  ASSERT_EQ(dropped, N - capacity);
+
+  // every slot was filled exactly once with a distinct element
+  std::sort(out.begin(), out.end());
+  for (RAJA::Index_type k = 0; k < capacity; ++k) {
+    ASSERT_GE(out[k], 0);
+    ASSERT_LT(out[k], N);
+    if (k > 0) {
+      ASSERT_NE(out[k], out[k - 1]);
+    }
+  }
+}
+
+TEST( AtomicAppendUnitTest, SeqAppend )
+{
+  testAtomicAppend<RAJA::seq_exec, RAJA::seq_atomic>();
+  testAtomicAppendBounded<RAJA::seq_exec, RAJA::seq_atomic>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST( AtomicAppendUnitTest, OpenMPAppend )
+{
+  testAtomicAppend<RAJA::omp_parallel_for_exec, RAJA::auto_atomic>();
+  testAtomicAppendBounded<RAJA::omp_parallel_for_exec, RAJA::auto_atomic>();
+}
+#endif
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for ordered atomic operations
+///
+
+#include "RAJA_test-base.hpp"
+
+template <typename Policy, typename T>
+static void testOrderedOps()
+{
+  T val = static_cast<T>(1);
+
+  // load/store round-trip through each valid order
+  RAJA::atomicStore<Policy, RAJA::atomic_order::relaxed>(&val,
+                                                         static_cast<T>(2));
+  ASSERT_EQ((RAJA::atomicLoad<Policy, RAJA::atomic_order::relaxed>(&val)),
+            static_cast<T>(2));
+
+  RAJA::atomicStore<Policy, RAJA::atomic_order::release>(&val,
+                                                         static_cast<T>(3));
+  ASSERT_EQ((RAJA::atomicLoad<Policy, RAJA::atomic_order::acquire>(&val)),
+            static_cast<T>(3));
+
+  RAJA::atomicStore<Policy>(&val, static_cast<T>(4));  // default seq_cst
+  ASSERT_EQ((RAJA::atomicLoad<Policy>(&val)), static_cast<T>(4));
+
+  // ordered exchange returns the previous value
+  T old = RAJA::atomicExchange<Policy, RAJA::atomic_order::acq_rel>(
+      &val, static_cast<T>(5));
+  ASSERT_EQ(old, static_cast<T>(4));
+  ASSERT_EQ(val, static_cast<T>(5));
+
+  // ordered add returns the previous value
+  old = RAJA::atomicAdd<Policy, RAJA::atomic_order::relaxed>(
+      &val, static_cast<T>(10));
+  ASSERT_EQ(old, static_cast<T>(5));
+  ASSERT_EQ(val, static_cast<T>(15));
+}
+
+TEST(AtomicOrderUnitTest, BuiltinPolicy)
+{
+  testOrderedOps<RAJA::builtin_atomic, int>();
+  testOrderedOps<RAJA::builtin_atomic, unsigned>();
+  testOrderedOps<RAJA::builtin_atomic, unsigned long long>();
+  testOrderedOps<RAJA::builtin_atomic, float>();
+  testOrderedOps<RAJA::builtin_atomic, double>();
+}
+
+TEST(AtomicOrderUnitTest, SeqPolicy)
+{
+  testOrderedOps<RAJA::seq_atomic, int>();
+  testOrderedOps<RAJA::seq_atomic, double>();
+}
+
+TEST(AtomicOrderUnitTest, AutoPolicy)
+{
+  testOrderedOps<RAJA::auto_atomic, int>();
+  testOrderedOps<RAJA::auto_atomic, double>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(AtomicOrderUnitTest, OmpPolicy)
+{
+  testOrderedOps<RAJA::omp_atomic, int>();
+  testOrderedOps<RAJA::omp_atomic, double>();
+}
+#endif
+
+TEST(AtomicOrderUnitTest, FlagSignaling)
+{
+  // release-store / acquire-load flag handoff, the intended use case
+  int payload = 0;
+  int flag = 0;
+
+  payload = 42;
+  RAJA::atomicStore<RAJA::builtin_atomic, RAJA::atomic_order::release>(&flag,
+                                                                       1);
+
+  while (RAJA::atomicLoad<RAJA::builtin_atomic, RAJA::atomic_order::acquire>(
+             &flag) == 0) {
+  }
+  ASSERT_EQ(payload, 42);
+
+  // explicitly spelled value types still resolve to the unordered API
+  unsigned long long count = 7;
+  unsigned long long prev =
+      RAJA::atomicAdd<RAJA::builtin_atomic, unsigned long long>(&count, 1ull);
+  ASSERT_EQ(prev, 7ull);
+  ASSERT_EQ(count, 8ull);
+}
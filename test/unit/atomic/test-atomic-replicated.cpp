@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for replicated accumulator arrays
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <vector>
+
+TEST( ReplicatedAccumulatorUnitTest, WorkspaceLayout )
+{
+  using acc_t = RAJA::ReplicatedAccumulator<int>;
+
+  // replicas are padded out to whole cache lines
+  size_t stride = acc_t::replica_stride( 3 );
+  ASSERT_GE( stride, 3u );
+  ASSERT_EQ( (stride * sizeof(int)) % static_cast<size_t>(RAJA::DATA_ALIGN),
+             0u );
+
+  ASSERT_EQ( acc_t::workspace_size( 3, 4 ), stride * 4 );
+}
+
+template <typename ExecPolicy, typename AtomicPolicy>
+void testReplicatedHistogram( size_t num_replicas )
+{
+  const size_t num_bins = 40;
+  const int N = 10000;
+
+  std::vector<int> bins( num_bins, 0 );
+  std::vector<int> workspace(
+      RAJA::ReplicatedAccumulator<int>::workspace_size( num_bins,
+                                                        num_replicas ) );
+
+  RAJA::ReplicatedAccumulator<int, AtomicPolicy> hist( workspace.data(),
+                                                       num_bins,
+                                                       num_replicas );
+  hist.reset();
+
+  RAJA::forall<ExecPolicy>( RAJA::RangeSegment( 0, N ), [=]( int i ) {
+    hist.add( i % num_bins, 1 );
+  } );
+
+  hist.merge( bins.data() );
+
+  for (size_t b = 0; b < num_bins; ++b) {
+    ASSERT_EQ( bins[b], N / (int)num_bins );
+  }
+}
+
+TEST( ReplicatedAccumulatorUnitTest, SeqHistogram )
+{
+  testReplicatedHistogram<RAJA::seq_exec, RAJA::seq_atomic>( 1 );
+  testReplicatedHistogram<RAJA::seq_exec, RAJA::auto_atomic>( 4 );
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST( ReplicatedAccumulatorUnitTest, OpenMPHistogram )
+{
+  // fewer replicas than threads shares replicas, which auto_atomic
+  // keeps correct
+  testReplicatedHistogram<RAJA::omp_parallel_for_exec, RAJA::auto_atomic>( 2 );
+
+  // enough replicas that each thread typically has its own
+  testReplicatedHistogram<RAJA::omp_parallel_for_exec, RAJA::auto_atomic>( 64 );
+}
+#endif
@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the activity-mask index set
+/// builder
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+using IndexType = RAJA::Index_type;
+
+//
+// Packed mask over [0, len) plus the reference bit vector it encodes.
+//
+struct TestMask {
+  std::vector<bool> bits;
+  std::vector<RAJA::BitSetWord> words;
+
+  explicit TestMask(IndexType len)
+      : bits(len, false), words(RAJA::BitSetView::num_words(len), 0)
+  {
+  }
+
+  void set(IndexType i, bool v)
+  {
+    bits[i] = v;
+    RAJA::BitSetWord bit = RAJA::BitSetWord(1)
+                           << (i % RAJA::BitSetView::bits_per_word);
+    if (v) {
+      words[i / RAJA::BitSetView::bits_per_word] |= bit;
+    } else {
+      words[i / RAJA::BitSetView::bits_per_word] &= ~bit;
+    }
+  }
+
+  RAJA::BitSetView view() const { return RAJA::BitSetView(words.data()); }
+};
+
+//
+// Gather the indices an index-set forall visits, in order.
+//
+static std::vector<IndexType> gatherIndices(
+    const RAJA::TypedIndexSet<RAJA::RangeSegment>& iset)
+{
+  std::vector<IndexType> visited;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](IndexType i) { visited.push_back(i); });
+  return visited;
+}
+
+static std::vector<IndexType> referenceIndices(const TestMask& mask,
+                                               IndexType begin)
+{
+  std::vector<IndexType> active;
+  for (size_t i = 0; i < mask.bits.size(); ++i) {
+    if (mask.bits[i]) {
+      active.push_back(begin + static_cast<IndexType>(i));
+    }
+  }
+  return active;
+}
+
+TEST(ActivityMaskIndexSetUnitTest, RunsBecomeRangeSegments)
+{
+  const IndexType len = 200;
+  TestMask mask(len);
+  // three runs, one crossing a word boundary
+  for (IndexType i = 3; i < 10; ++i) mask.set(i, true);
+  for (IndexType i = 60; i < 70; ++i) mask.set(i, true);
+  for (IndexType i = 150; i < 151; ++i) mask.set(i, true);
+
+  RAJA::ActivityMaskIndexSetBuilder builder(0, len);
+  const auto& iset = builder.update(mask.view());
+
+  ASSERT_EQ(iset.getNumSegments(), size_t(3));
+  ASSERT_EQ(builder.numActive(), 7 + 10 + 1);
+  ASSERT_EQ(gatherIndices(iset), referenceIndices(mask, 0));
+}
+
+TEST(ActivityMaskIndexSetUnitTest, CachedUntilMaskChanges)
+{
+  const IndexType len = 3000;  // spans multiple tiles
+  TestMask mask(len);
+  for (IndexType i = 0; i < len; i += 7) mask.set(i, true);
+  for (IndexType i = 1000; i < 1500; ++i) mask.set(i, true);
+
+  RAJA::ActivityMaskIndexSetBuilder builder(0, len);
+  builder.update(mask.view());
+  ASSERT_EQ(gatherIndices(builder.indexSet()), referenceIndices(mask, 0));
+
+  // same mask: cached index set comes back unchanged
+  size_t num_segments = builder.indexSet().getNumSegments();
+  builder.update(mask.view());
+  ASSERT_EQ(builder.indexSet().getNumSegments(), num_segments);
+
+  // flip bits in one tile; the emitted set reflects the change
+  for (IndexType i = 2000; i < 2100; ++i) mask.set(i, true);
+  mask.set(7, false);
+  const auto& iset = builder.update(mask.view());
+  ASSERT_EQ(gatherIndices(iset), referenceIndices(mask, 0));
+}
+
+TEST(ActivityMaskIndexSetUnitTest, OffsetRangeAndTailBits)
+{
+  const IndexType begin = 100, len = 70;
+  TestMask mask(len);
+  for (IndexType i = 62; i < 70; ++i) mask.set(i, true);
+  // garbage bits past the end of the range must be ignored
+  mask.words.back() |= ~RAJA::BitSetWord(0) << (len % 64);
+
+  RAJA::ActivityMaskIndexSetBuilder builder(begin, begin + len);
+  const auto& iset = builder.update(mask.view());
+
+  ASSERT_EQ(iset.getNumSegments(), size_t(1));
+  ASSERT_EQ(builder.numActive(), 8);
+  ASSERT_EQ(gatherIndices(iset), referenceIndices(mask, begin));
+}
+
+TEST(ActivityMaskIndexSetUnitTest, EmptyAndFullMasks)
+{
+  const IndexType len = 500;
+  TestMask mask(len);
+
+  RAJA::ActivityMaskIndexSetBuilder builder(0, len);
+  ASSERT_EQ(builder.update(mask.view()).getNumSegments(), size_t(0));
+  ASSERT_EQ(builder.numActive(), 0);
+
+  for (IndexType i = 0; i < len; ++i) mask.set(i, true);
+  const auto& iset = builder.update(mask.view());
+  ASSERT_EQ(iset.getNumSegments(), size_t(1));
+  ASSERT_EQ(builder.numActive(), len);
+}
@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for index set chunk-hint metadata
+/// and the re-chunking view (forEachSegmentChunk / calibrateChunkHint).
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <algorithm>
+#include <vector>
+
+//
+// Resource object used to construct list segment objects with indices
+// living in host (CPU) memory. Used in all tests.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+using RangeSegType = RAJA::RangeSegment;
+using ListSegType = RAJA::ListSegment;
+using IndexSetType = RAJA::TypedIndexSet<RangeSegType, ListSegType>;
+
+//
+// Build a set mixing a long range, a list, and a short range, so chunk
+// iteration crosses segment boundaries and hits a partial final chunk.
+//
+static IndexSetType buildMixedIndexSet()
+{
+  static const RAJA::Index_type idx0[] = {100, 102, 104, 107, 110, 113, 116};
+
+  IndexSetType iset;
+  iset.push_back(RangeSegType(0, 25));
+  iset.push_back(ListSegType(idx0, 7, host_res));
+  iset.push_back(RangeSegType(50, 53));
+  return iset;
+}
+
+//
+// Gather indices seen through the view, recording chunk sizes so tests
+// can check the granularity as well as coverage and order.
+//
+struct GatherChunks {
+  std::vector<RAJA::Index_type>& indices;
+  std::vector<RAJA::Index_type>& chunk_sizes;
+
+  template <typename SegType>
+  void operator()(const SegType& seg) const
+  {
+    chunk_sizes.push_back(static_cast<RAJA::Index_type>(seg.size()));
+    for (auto idx : seg) {
+      indices.push_back(static_cast<RAJA::Index_type>(idx));
+    }
+  }
+};
+
+TEST(IndexSetChunkUnitTest, ChunkHintMetadata)
+{
+  IndexSetType iset = buildMixedIndexSet();
+
+  // unset families fall back
+  ASSERT_EQ(iset.getChunkHint("stress"), 0);
+  ASSERT_EQ(iset.getChunkHint("stress", 512), 512);
+
+  iset.setChunkHint("stress", 1024);
+  iset.setChunkHint("hydro", 256);
+  ASSERT_EQ(iset.getChunkHint("stress"), 1024);
+  ASSERT_EQ(iset.getChunkHint("hydro"), 256);
+
+  // overwrite in place
+  iset.setChunkHint("stress", 2048);
+  ASSERT_EQ(iset.getChunkHint("stress"), 2048);
+
+  // hints are copied with the set
+  IndexSetType copy(iset);
+  ASSERT_EQ(copy.getChunkHint("hydro"), 256);
+}
+
+TEST(IndexSetChunkUnitTest, RechunkCoverageAndGranularity)
+{
+  IndexSetType iset = buildMixedIndexSet();
+
+  std::vector<RAJA::Index_type> expected;
+  RAJA::getIndices(expected, iset);
+
+  std::vector<RAJA::Index_type> indices;
+  std::vector<RAJA::Index_type> chunk_sizes;
+  RAJA::forEachSegmentChunk(iset, RAJA::Index_type(4),
+                            GatherChunks{indices, chunk_sizes});
+
+  // same indices in the same order as whole-segment iteration
+  ASSERT_EQ(indices, expected);
+
+  // no chunk exceeds the requested granularity
+  for (RAJA::Index_type sz : chunk_sizes) {
+    ASSERT_LE(sz, 4);
+    ASSERT_GT(sz, 0);
+  }
+  // 25 -> 4,4,4,4,4,4,1; 7 -> 4,3; 3 -> 3
+  ASSERT_EQ(chunk_sizes.size(), size_t(10));
+}
+
+TEST(IndexSetChunkUnitTest, RechunkWholeSegmentsWhenUnset)
+{
+  IndexSetType iset = buildMixedIndexSet();
+
+  std::vector<RAJA::Index_type> expected;
+  RAJA::getIndices(expected, iset);
+
+  // no hint recorded for this family: segments run whole
+  std::vector<RAJA::Index_type> indices;
+  std::vector<RAJA::Index_type> chunk_sizes;
+  RAJA::forEachSegmentChunk(iset, "unknown_family",
+                            GatherChunks{indices, chunk_sizes});
+
+  ASSERT_EQ(indices, expected);
+  ASSERT_EQ(chunk_sizes.size(), size_t(3));
+}
+
+TEST(IndexSetChunkUnitTest, CalibrateRecordsWinner)
+{
+  IndexSetType iset = buildMixedIndexSet();
+
+  std::vector<RAJA::Index_type> expected;
+  RAJA::getIndices(expected, iset);
+
+  std::vector<RAJA::Index_type> lens{2, 8, 16};
+
+  std::vector<RAJA::Index_type> indices;
+  RAJA::Index_type winner = RAJA::calibrateChunkHint(
+      iset, "stress", lens, [&](const auto& chunk) {
+        for (auto idx : chunk) {
+          indices.push_back(static_cast<RAJA::Index_type>(idx));
+        }
+      });
+
+  // winner is one of the candidates and is recorded in the metadata
+  ASSERT_NE(std::find(lens.begin(), lens.end(), winner), lens.end());
+  ASSERT_EQ(iset.getChunkHint("stress"), winner);
+
+  // the body ran once per candidate over the full set
+  ASSERT_EQ(indices.size(), expected.size() * lens.size());
+
+  // the calibrated view covers the set at the winning granularity
+  indices.clear();
+  std::vector<RAJA::Index_type> chunk_sizes;
+  RAJA::forEachSegmentChunk(iset, "stress",
+                            GatherChunks{indices, chunk_sizes});
+  ASSERT_EQ(indices, expected);
+  for (RAJA::Index_type sz : chunk_sizes) {
+    ASSERT_LE(sz, winner);
+  }
+}
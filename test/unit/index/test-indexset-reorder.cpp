@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for IndexSet segment reordering.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+using RangeSegType = RAJA::TypedRangeSegment<RAJA::Index_type>;
+using ListSegType = RAJA::TypedListSegment<RAJA::Index_type>;
+using IndexSetType = RAJA::TypedIndexSet<RangeSegType, ListSegType>;
+
+//
+// Resource object used to construct list segment objects with indices
+// living in host (CPU) memory. Used in all tests.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+//
+// Build an index set with segments of sizes 2, 6, 4, 3 (in that order).
+//
+static IndexSetType buildIndexSet()
+{
+  IndexSetType iset;
+  iset.push_back(RangeSegType(0, 2));
+  iset.push_back(RangeSegType(10, 16));
+  RAJA::Index_type idx[] = {20, 22, 24, 26};
+  iset.push_back(ListSegType(idx, 4, host_res));
+  iset.push_back(RangeSegType(30, 33));
+  return iset;
+}
+
+//
+// Return the size of each segment in the current iteration order.
+//
+static std::vector<size_t> segmentSizes(const IndexSetType& iset)
+{
+  std::vector<size_t> sizes;
+  for (size_t segid = 0; segid < iset.getNumSegments(); ++segid) {
+    iset.segmentCall(segid, [&](const auto& seg) { sizes.push_back(seg.size()); });
+  }
+  return sizes;
+}
+
+TEST(IndexSetReorderUnitTest, DescendingSize)
+{
+  IndexSetType iset = buildIndexSet();
+
+  iset.reorder();
+
+  std::vector<size_t> expected{6, 4, 3, 2};
+  ASSERT_EQ(segmentSizes(iset), expected);
+  ASSERT_EQ(size_t(15), iset.getLength());
+
+  // icounts are cumulative in the new order
+  ASSERT_EQ(0, iset.getStartingIcount(0));
+  ASSERT_EQ(6, iset.getStartingIcount(1));
+  ASSERT_EQ(10, iset.getStartingIcount(2));
+  ASSERT_EQ(13, iset.getStartingIcount(3));
+
+  // every index is still visited exactly once
+  RAJA::Index_type sum = 0;
+  RAJA::Index_type* sum_ptr = &sum;
+  using ExecPol = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>;
+  RAJA::forall<ExecPol>(iset,
+                        [=](RAJA::Index_type i) { *sum_ptr += i; });
+  ASSERT_EQ(1 + 75 + 92 + 93, sum);
+}
+
+TEST(IndexSetReorderUnitTest, AscendingSize)
+{
+  IndexSetType iset = buildIndexSet();
+
+  iset.reorder(RAJA::ORDER_ASCENDING_SIZE);
+
+  std::vector<size_t> expected{2, 3, 4, 6};
+  ASSERT_EQ(segmentSizes(iset), expected);
+}
+
+TEST(IndexSetReorderUnitTest, CostModel)
+{
+  IndexSetType iset = buildIndexSet();
+
+  // reverse the current order: later segments get higher cost
+  iset.reorder([](size_t segid, size_t) { return double(segid); });
+
+  std::vector<size_t> expected{3, 4, 6, 2};
+  ASSERT_EQ(segmentSizes(iset), expected);
+}
+
+TEST(IndexSetReorderUnitTest, CacheInvalidation)
+{
+  IndexSetType iset = buildIndexSet();
+
+  iset.reorder();
+  std::vector<size_t> expected{6, 4, 3, 2};
+  ASSERT_EQ(segmentSizes(iset), expected);
+
+  // a cached repeat is a no-op, and modification invalidates the cache
+  iset.reorder();
+  ASSERT_EQ(segmentSizes(iset), expected);
+
+  iset.push_back(RangeSegType(40, 45));
+  iset.reorder();
+  std::vector<size_t> modified{6, 5, 4, 3, 2};
+  ASSERT_EQ(segmentSizes(iset), modified);
+}
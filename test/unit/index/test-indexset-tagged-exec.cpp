@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for per-segment execution tags.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+using RangeSegType = RAJA::TypedRangeSegment<RAJA::Index_type>;
+using IndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+
+//
+// Build an index set mixing small "boundary" segments with a large
+// "interior" segment, tagging the small ones into bucket 1.
+//
+static IndexSetType buildTaggedIndexSet()
+{
+  IndexSetType iset;
+  iset.push_back(RangeSegType(0, 2));      // small
+  iset.push_back(RangeSegType(100, 200));  // large
+  iset.push_back(RangeSegType(10, 13));    // small
+  iset.setSegmentExecTag(0, 1);
+  iset.setSegmentExecTag(2, 1);
+  return iset;
+}
+
+TEST(IndexSetTaggedExecUnitTest, TagDefaultsAndAccess)
+{
+  IndexSetType iset = buildTaggedIndexSet();
+
+  ASSERT_EQ(iset.getSegmentExecTag(0), 1);
+  ASSERT_EQ(iset.getSegmentExecTag(1), 0);  // untagged defaults to 0
+  ASSERT_EQ(iset.getSegmentExecTag(2), 1);
+}
+
+TEST(IndexSetTaggedExecUnitTest, ForallSelectsPolicyByTag)
+{
+  IndexSetType iset = buildTaggedIndexSet();
+
+  // tag 0 -> seq_exec, tag 1 -> loop_exec; both visit every index once
+  std::vector<int> visited(200, 0);
+  int* visited_ptr = visited.data();
+  using TaggedPol =
+      RAJA::TaggedExecPolicy<RAJA::seq_segit, RAJA::seq_exec, RAJA::loop_exec>;
+  RAJA::forall<TaggedPol>(iset,
+                          [=](RAJA::Index_type i) { visited_ptr[i] += 1; });
+
+  for (RAJA::Index_type i = 0; i < 200; ++i) {
+    bool in_set = (i < 2) || (i >= 100) || (i >= 10 && i < 13);
+    ASSERT_EQ(visited[i], in_set ? 1 : 0);
+  }
+}
+
+TEST(IndexSetTaggedExecUnitTest, ForallIcountSelectsPolicyByTag)
+{
+  IndexSetType iset = buildTaggedIndexSet();
+
+  // icounts stay those of the whole set, independent of bucketing
+  std::vector<RAJA::Index_type> icount_of(200, -1);
+  RAJA::Index_type* icount_ptr = icount_of.data();
+  using TaggedPol =
+      RAJA::TaggedExecPolicy<RAJA::seq_segit, RAJA::seq_exec, RAJA::loop_exec>;
+  RAJA::forall_Icount<TaggedPol>(
+      iset, [=](RAJA::Index_type icount, RAJA::Index_type i) {
+        icount_ptr[i] = icount;
+      });
+
+  ASSERT_EQ(icount_of[0], 0);
+  ASSERT_EQ(icount_of[100], 2);
+  ASSERT_EQ(icount_of[199], 101);
+  ASSERT_EQ(icount_of[10], 102);
+  ASSERT_EQ(icount_of[12], 104);
+}
+
+TEST(IndexSetTaggedExecUnitTest, ReorderPreservesTags)
+{
+  IndexSetType iset = buildTaggedIndexSet();
+
+  iset.reorder();  // large segment first
+
+  ASSERT_EQ(iset.getSegmentExecTag(0), 0);  // the 100-element segment
+  ASSERT_EQ(iset.getSegmentExecTag(1), 1);
+  ASSERT_EQ(iset.getSegmentExecTag(2), 1);
+}
+
+TEST(IndexSetTaggedExecUnitTest, OutOfRangeTagRunsLastPolicy)
+{
+  IndexSetType iset;
+  iset.push_back(RangeSegType(0, 5));
+  iset.setSegmentExecTag(0, 7);  // past the end of a two-policy list
+
+  RAJA::Index_type sum = 0;
+  RAJA::Index_type* sum_ptr = &sum;
+  using TaggedPol =
+      RAJA::TaggedExecPolicy<RAJA::seq_segit, RAJA::seq_exec, RAJA::loop_exec>;
+  RAJA::forall<TaggedPol>(iset, [=](RAJA::Index_type i) { *sum_ptr += i; });
+  ASSERT_EQ(sum, 10);
+}
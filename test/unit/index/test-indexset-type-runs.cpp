@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for type-grouped segment storage
+/// and type-batched segment iteration.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+//
+// Resource object used to construct list segment objects with indices
+// living in host (CPU) memory. Used in all tests.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+using RangeSegType = RAJA::TypedRangeSegment<int>;
+using ListSegType = RAJA::TypedListSegment<int>;
+using IndexSetType = RAJA::TypedIndexSet<RangeSegType, ListSegType>;
+
+//
+// Body for segmentCallTypeRuns: appends every index it sees, so tests
+// can check both coverage and visitation order.
+//
+struct GatherIndices {
+  template <typename SegType>
+  void operator()(const SegType& seg, std::vector<int>* out) const
+  {
+    for (auto idx : seg) {
+      out->push_back(static_cast<int>(idx));
+    }
+  }
+};
+
+//
+// Build a set interleaving range and list segments, as produced by mesh
+// traversal orders that alternate structured and unstructured zones.
+//
+static IndexSetType buildInterleavedIndexSet()
+{
+  static const int idx0[] = {100, 102, 104};
+  static const int idx1[] = {200, 201};
+
+  IndexSetType iset;
+  iset.push_back(RangeSegType(0, 2));
+  iset.push_back(ListSegType(idx0, 3, host_res));
+  iset.push_back(RangeSegType(10, 13));
+  iset.push_back(ListSegType(idx1, 2, host_res));
+  return iset;
+}
+
+TEST(IndexSetTypeRunsUnitTest, ReorderGroupsSegmentsByType)
+{
+  IndexSetType iset = buildInterleavedIndexSet();
+
+  iset.reorder(RAJA::ORDER_BY_TYPE);
+
+  // all range segments first (declaration order), then all list
+  // segments, preserving relative order within each type
+  ASSERT_TRUE(iset.checkSegmentType<RangeSegType>(0));
+  ASSERT_TRUE(iset.checkSegmentType<RangeSegType>(1));
+  ASSERT_TRUE(iset.checkSegmentType<ListSegType>(2));
+  ASSERT_TRUE(iset.checkSegmentType<ListSegType>(3));
+
+  const RangeSegType& rs0 = iset.getSegment<const RangeSegType>(0);
+  const RangeSegType& rs1 = iset.getSegment<const RangeSegType>(1);
+  ASSERT_EQ(*rs0.begin(), 0);
+  ASSERT_EQ(*rs1.begin(), 10);
+
+  // icounts renumbered to match the new storage order
+  ASSERT_EQ(iset.getStartingIcount(0), 0);
+  ASSERT_EQ(iset.getStartingIcount(1), 2);
+  ASSERT_EQ(iset.getStartingIcount(2), 5);
+  ASSERT_EQ(iset.getStartingIcount(3), 8);
+}
+
+TEST(IndexSetTypeRunsUnitTest, TypeRunIterationVisitsAllSegments)
+{
+  IndexSetType iset = buildInterleavedIndexSet();
+
+  // works on any storage order; each run of same-type segments gets a
+  // single type dispatch
+  std::vector<int> visited;
+  iset.segmentCallTypeRuns(GatherIndices{}, &visited);
+
+  std::vector<int> expected = {0, 1, 100, 102, 104, 10, 11, 12, 200, 201};
+  ASSERT_EQ(visited, expected);
+}
+
+TEST(IndexSetTypeRunsUnitTest, TypeRunIterationAfterReorder)
+{
+  IndexSetType iset = buildInterleavedIndexSet();
+
+  iset.reorder(RAJA::ORDER_BY_TYPE);
+
+  std::vector<int> visited;
+  iset.segmentCallTypeRuns(GatherIndices{}, &visited);
+
+  // two runs: both range segments, then both list segments
+  std::vector<int> expected = {0, 1, 10, 11, 12, 100, 102, 104, 200, 201};
+  ASSERT_EQ(visited, expected);
+}
+
+TEST(IndexSetTypeRunsUnitTest, ReorderByTypeIsCached)
+{
+  IndexSetType iset = buildInterleavedIndexSet();
+
+  iset.reorder(RAJA::ORDER_BY_TYPE);
+  iset.reorder(RAJA::ORDER_BY_TYPE);  // no-op: order is cached
+
+  ASSERT_TRUE(iset.checkSegmentType<RangeSegType>(0));
+  ASSERT_TRUE(iset.checkSegmentType<ListSegType>(3));
+
+  // modifying the set invalidates the cache; the new segment is
+  // grouped on the next reorder
+  iset.push_back(RangeSegType(20, 21));
+  iset.reorder(RAJA::ORDER_BY_TYPE);
+  ASSERT_TRUE(iset.checkSegmentType<RangeSegType>(2));
+  ASSERT_TRUE(iset.checkSegmentType<ListSegType>(4));
+}
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for 3D range segments with
+/// compile-time iteration-order policies
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <set>
+#include <tuple>
+
+using IndexType = RAJA::Index_type;
+using Triple = std::tuple<IndexType, IndexType, IndexType>;
+
+//
+// Iterate the segment through plain forall, checking every triple lands
+// in the box exactly once (each order is a bijection onto the box).
+//
+template <typename SegType>
+static std::set<Triple> gatherAndCheckCoverage(const SegType& seg,
+                                               IndexType ni,
+                                               IndexType nj,
+                                               IndexType nk)
+{
+  std::set<Triple> seen;
+  RAJA::forall<RAJA::seq_exec>(seg, [&](RAJA::Index3D<IndexType> idx) {
+    EXPECT_TRUE(idx.i >= 0 && idx.i < ni);
+    EXPECT_TRUE(idx.j >= 0 && idx.j < nj);
+    EXPECT_TRUE(idx.k >= 0 && idx.k < nk);
+    EXPECT_TRUE(seen.insert(std::make_tuple(idx.i, idx.j, idx.k)).second);
+  });
+  EXPECT_EQ(static_cast<IndexType>(seen.size()), ni * nj * nk);
+  return seen;
+}
+
+TEST(RangeSegment3DUnitTest, RowMajorMatchesNestedLoops)
+{
+  RAJA::RangeSegment3D<RAJA::RowMajor3D> box(3, 4, 5);
+  ASSERT_EQ(box.size(), 3 * 4 * 5);
+
+  auto iter = box.begin();
+  for (IndexType i = 0; i < 3; ++i) {
+    for (IndexType j = 0; j < 4; ++j) {
+      for (IndexType k = 0; k < 5; ++k) {
+        RAJA::Index3D<IndexType> idx = *iter;
+        ASSERT_EQ(idx.i, i);
+        ASSERT_EQ(idx.j, j);
+        ASSERT_EQ(idx.k, k);
+        ++iter;
+      }
+    }
+  }
+  ASSERT_EQ(iter, box.end());
+}
+
+TEST(RangeSegment3DUnitTest, BlockedCoverageAndBlockLocality)
+{
+  constexpr IndexType B = 4;
+  const IndexType ni = 10, nj = 7, nk = 5;  // clamped edge blocks
+  RAJA::RangeSegment3D<RAJA::Blocked3D<B>> box(ni, nj, nk);
+
+  gatherAndCheckCoverage(box, ni, nj, nk);
+
+  // each block finishes before the next begins
+  Triple current{-1, -1, -1};
+  IndexType blocks_seen = 0;
+  std::set<Triple> blocks;
+  RAJA::forall<RAJA::seq_exec>(box, [&](RAJA::Index3D<IndexType> idx) {
+    Triple blk = std::make_tuple(idx.i / B, idx.j / B, idx.k / B);
+    if (blk != current) {
+      current = blk;
+      blocks_seen += 1;
+      EXPECT_TRUE(blocks.insert(blk).second);  // never revisited
+    }
+  });
+  ASSERT_EQ(blocks_seen, 3 * 2 * 2);
+}
+
+TEST(RangeSegment3DUnitTest, MortonCoverageAndLocality)
+{
+  // equal and unequal power-of-two extents
+  gatherAndCheckCoverage(RAJA::RangeSegment3D<RAJA::Morton3D>(8, 8, 8),
+                         8, 8, 8);
+  gatherAndCheckCoverage(RAJA::RangeSegment3D<RAJA::Morton3D>(16, 4, 2),
+                         16, 4, 2);
+
+  // the first 8 positions of an 8^3 box fill a 2x2x2 corner octant
+  RAJA::RangeSegment3D<RAJA::Morton3D> box(8, 8, 8);
+  auto iter = box.begin();
+  std::set<Triple> corner;
+  for (int p = 0; p < 8; ++p) {
+    RAJA::Index3D<IndexType> idx = iter[p];
+    ASSERT_LT(idx.i, 2);
+    ASSERT_LT(idx.j, 2);
+    ASSERT_LT(idx.k, 2);
+    corner.insert(std::make_tuple(idx.i, idx.j, idx.k));
+  }
+  ASSERT_EQ(corner.size(), size_t(8));
+}
+
+TEST(RangeSegment3DUnitTest, IteratorRandomAccess)
+{
+  RAJA::RangeSegment3D<RAJA::RowMajor3D> box(2, 3, 4);
+
+  auto begin = box.begin();
+  auto end = box.end();
+  ASSERT_EQ(end - begin, box.size());
+  ASSERT_TRUE(begin < end);
+
+  auto mid = begin + 13;
+  RAJA::Index3D<IndexType> idx = *mid;
+  ASSERT_EQ(idx, (RAJA::Index3D<IndexType>{1, 0, 1}));
+  ASSERT_EQ(begin[13], *mid);
+  ASSERT_EQ((mid - 13), begin);
+
+  // degenerate and negative extents are empty
+  RAJA::RangeSegment3D<RAJA::RowMajor3D> empty(2, 0, 4);
+  ASSERT_EQ(empty.size(), 0);
+  ASSERT_EQ(empty.begin(), empty.end());
+  RAJA::RangeSegment3D<RAJA::RowMajor3D> negative(2, -1, 4);
+  ASSERT_EQ(negative.size(), 0);
+}
@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for TypedRunSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+//
+// Resource object used to construct run segment objects with run data
+// living in host (CPU) memory. Used in all tests in this file.
+//
+static camp::resources::Resource host_res{camp::resources::Host()};
+
+TEST(RunSegmentUnitTest, Encoding)
+{
+  // 0..4 contiguous, 10 isolated, 20..22 contiguous
+  std::vector<RAJA::Index_type> idx{0, 1, 2, 3, 4, 10, 20, 21, 22};
+
+  RAJA::TypedRunSegment<RAJA::Index_type> seg(&idx[0], idx.size(), host_res);
+
+  ASSERT_EQ(seg.getLength(), static_cast<RAJA::Index_type>(idx.size()));
+  ASSERT_EQ(seg.getNumRuns(), 3);
+
+  auto runs = seg.getRuns().begin();
+  ASSERT_EQ(runs[0].begin, 0);
+  ASSERT_EQ(runs[0].length, 5);
+  ASSERT_EQ(runs[1].begin, 10);
+  ASSERT_EQ(runs[1].length, 1);
+  ASSERT_EQ(runs[2].begin, 20);
+  ASSERT_EQ(runs[2].length, 3);
+}
+
+TEST(RunSegmentUnitTest, Equality)
+{
+  std::vector<RAJA::Index_type> idx{3, 4, 5, 9};
+  std::vector<RAJA::Index_type> other{3, 4, 5, 10};
+
+  RAJA::TypedRunSegment<RAJA::Index_type> seg1(&idx[0], idx.size(), host_res);
+  RAJA::TypedRunSegment<RAJA::Index_type> seg2(&idx[0], idx.size(), host_res);
+  RAJA::TypedRunSegment<RAJA::Index_type> seg3(&other[0], other.size(),
+                                               host_res);
+
+  ASSERT_EQ(seg1, seg2);
+  ASSERT_NE(seg1, seg3);
+}
+
+TEST(RunSegmentUnitTest, ForallOrdering)
+{
+  std::vector<RAJA::Index_type> idx{7, 8, 9, 2, 3, 15};
+
+  RAJA::TypedRunSegment<RAJA::Index_type> seg(&idx[0], idx.size(), host_res);
+
+  std::vector<RAJA::Index_type> visited;
+  RAJA::forall<RAJA::seq_exec>(seg, [&](RAJA::Index_type i) {
+    visited.push_back(i);
+  });
+
+  ASSERT_EQ(visited, idx);
+}
+
+TEST(RunSegmentUnitTest, ForallSum)
+{
+  constexpr RAJA::Index_type len = 1000;
+  std::vector<RAJA::Index_type> idx;
+  // mostly contiguous with periodic gaps
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    if (i % 97 != 0) {
+      idx.push_back(i);
+    }
+  }
+
+  std::vector<double> data(len);
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    data[i] = static_cast<double>(i);
+  }
+
+  RAJA::TypedRunSegment<RAJA::Index_type> seg(&idx[0], idx.size(), host_res);
+
+  RAJA::ReduceSum<RAJA::seq_reduce, double> sum(0.0);
+  double* dptr = &data[0];
+  RAJA::forall<RAJA::seq_exec>(seg, [=](RAJA::Index_type i) {
+    sum += dptr[i];
+  });
+
+  double expected = 0.0;
+  for (auto i : idx) {
+    expected += data[i];
+  }
+  ASSERT_EQ(sum.get(), expected);
+}
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for segment set algebra
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+//
+// Collect the indices a forall traversal of the given segment visits,
+// in visit order.
+//
+template <typename SEGMENT>
+std::vector<RAJA::Index_type> traverse(SEGMENT const& seg)
+{
+  std::vector<RAJA::Index_type> visited;
+  RAJA::Index_type* visited_end = nullptr;
+
+  visited.resize(seg.size());
+  visited_end = visited.data();
+  RAJA::forall<RAJA::seq_exec>(seg, [&](RAJA::Index_type i) {
+    *visited_end++ = i;
+  });
+
+  return visited;
+}
+
+TEST(SegmentAlgebraUnitTest, RangeIntersection)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> whole(0, 20);
+  RAJA::TypedRangeSegment<RAJA::Index_type> upper(12, 30);
+
+  auto overlap = RAJA::segment_intersection(whole, upper);
+  ASSERT_EQ(overlap.size(), 8);
+  ASSERT_EQ(*overlap.begin(), 12);
+
+  RAJA::TypedRangeSegment<RAJA::Index_type> beyond(25, 30);
+  auto empty = RAJA::segment_intersection(whole, beyond);
+  ASSERT_EQ(empty.size(), 0);
+}
+
+TEST(SegmentAlgebraUnitTest, RangeDifferenceInterior)
+{
+  // interior = whole minus a middle band: two disjoint ranges, no
+  // materialization
+  RAJA::TypedRangeSegment<RAJA::Index_type> whole(0, 10);
+  RAJA::TypedRangeSegment<RAJA::Index_type> band(4, 7);
+
+  auto interior = RAJA::segment_difference(whole, band);
+  ASSERT_EQ(interior.size(), 7);
+
+  std::vector<RAJA::Index_type> expected{0, 1, 2, 3, 7, 8, 9};
+  ASSERT_EQ(traverse(interior), expected);
+}
+
+TEST(SegmentAlgebraUnitTest, RangeDifferenceEnds)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> whole(0, 10);
+
+  // subtrahend off the low end
+  auto upper = RAJA::segment_difference(
+      whole, RAJA::TypedRangeSegment<RAJA::Index_type>(-5, 3));
+  std::vector<RAJA::Index_type> expected_upper{3, 4, 5, 6, 7, 8, 9};
+  ASSERT_EQ(traverse(upper), expected_upper);
+
+  // subtrahend covering everything
+  auto none = RAJA::segment_difference(
+      whole, RAJA::TypedRangeSegment<RAJA::Index_type>(-5, 15));
+  ASSERT_EQ(none.size(), 0);
+}
+
+TEST(SegmentAlgebraUnitTest, RangeUnion)
+{
+  // overlapping operands collapse to one range
+  auto merged = RAJA::segment_union(
+      RAJA::TypedRangeSegment<RAJA::Index_type>(0, 6),
+      RAJA::TypedRangeSegment<RAJA::Index_type>(4, 10));
+  ASSERT_EQ(merged.size(), 10);
+  ASSERT_EQ(*merged.begin(), 0);
+
+  // disjoint operands traverse in ascending order
+  auto split = RAJA::segment_union(
+      RAJA::TypedRangeSegment<RAJA::Index_type>(7, 10),
+      RAJA::TypedRangeSegment<RAJA::Index_type>(0, 2));
+  std::vector<RAJA::Index_type> expected{0, 1, 7, 8, 9};
+  ASSERT_EQ(traverse(split), expected);
+}
+
+TEST(SegmentAlgebraUnitTest, ListDifferenceMaterializesOnce)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> whole(0, 8);
+  std::vector<RAJA::Index_type> boundary_indices{0, 7, 3};
+  RAJA::TypedListSegment<RAJA::Index_type> boundary(boundary_indices);
+
+  auto interior = RAJA::segment_difference(whole, boundary);
+
+  std::vector<RAJA::Index_type> expected{1, 2, 4, 5, 6};
+  ASSERT_EQ(traverse(interior), expected);
+
+  // the cached list is built once: repeat traversals and copies see the
+  // same storage
+  auto* data = &(*interior.begin());
+  auto interior_copy = interior;
+  ASSERT_EQ(data, &(*interior.begin()));
+  ASSERT_EQ(data, &(*interior_copy.begin()));
+}
+
+TEST(SegmentAlgebraUnitTest, ListUnionAndIntersection)
+{
+  std::vector<RAJA::Index_type> list_a_indices{9, 1, 5, 5};
+  std::vector<RAJA::Index_type> list_b_indices{5, 2, 9};
+  RAJA::TypedListSegment<RAJA::Index_type> list_a(list_a_indices);
+  RAJA::TypedListSegment<RAJA::Index_type> list_b(list_b_indices);
+
+  auto united = RAJA::segment_union(list_a, list_b);
+  std::vector<RAJA::Index_type> expected_union{1, 2, 5, 9};
+  ASSERT_EQ(traverse(united), expected_union);
+
+  auto common = RAJA::segment_intersection(list_a, list_b);
+  std::vector<RAJA::Index_type> expected_common{5, 9};
+  ASSERT_EQ(traverse(common), expected_common);
+}
@@ -0,0 +1,137 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for TypedSpatialIndexSet class.
+///
+
+#include <cstdlib>
+#include <vector>
+
+#include "RAJA_test-base.hpp"
+
+using RangeSegType = RAJA::TypedRangeSegment<int>;
+using SpatialSetType = RAJA::TypedSpatialIndexSet<RangeSegType>;
+using KeyType = SpatialSetType::SpatialKey;
+
+//
+// Gather the begin index of each range segment in traversal order.
+//
+static std::vector<int> traversalBegins(SpatialSetType const& sset)
+{
+  std::vector<int> begins;
+  auto const& iset = sset.getTraversal();
+  for (size_t i = 0; i < iset.getNumSegments(); ++i) {
+    begins.push_back(*iset.getSegment<const RangeSegType>(i).begin());
+  }
+  return begins;
+}
+
+TEST(SpatialIndexSetUnitTest, InsertionOrder)
+{
+  SpatialSetType sset;
+  sset.setTraversalOrder(RAJA::SpatialOrder::insertion);
+
+  sset.push_back(RangeSegType(0, 10), KeyType{7, 7, 7});
+  sset.push_back(RangeSegType(10, 20), KeyType{0, 0, 0});
+  sset.push_back(RangeSegType(20, 30), KeyType{3, 1, 0});
+
+  ASSERT_EQ(size_t(3), sset.getNumSegments());
+  std::vector<int> expected{0, 10, 20};
+  ASSERT_EQ(expected, traversalBegins(sset));
+}
+
+TEST(SpatialIndexSetUnitTest, MortonOrder)
+{
+  SpatialSetType sset;
+  ASSERT_EQ(RAJA::SpatialOrder::morton, sset.getTraversalOrder());
+
+  // one segment per cell of a 2x2x2 block, pushed in scrambled order;
+  // Morton order visits the octants in (x fastest) code order
+  sset.push_back(RangeSegType(70, 80), KeyType{1, 1, 1});  // code 7
+  sset.push_back(RangeSegType(0, 10), KeyType{0, 0, 0});   // code 0
+  sset.push_back(RangeSegType(30, 40), KeyType{1, 1, 0});  // code 3
+  sset.push_back(RangeSegType(40, 50), KeyType{0, 0, 1});  // code 4
+  sset.push_back(RangeSegType(10, 20), KeyType{1, 0, 0});  // code 1
+  sset.push_back(RangeSegType(60, 70), KeyType{0, 1, 1});  // code 6
+  sset.push_back(RangeSegType(20, 30), KeyType{0, 1, 0});  // code 2
+  sset.push_back(RangeSegType(50, 60), KeyType{1, 0, 1});  // code 5
+
+  std::vector<int> expected{0, 10, 20, 30, 40, 50, 60, 70};
+  ASSERT_EQ(expected, traversalBegins(sset));
+}
+
+TEST(SpatialIndexSetUnitTest, HilbertOrderIsContinuous)
+{
+  // along a Hilbert curve successive cells are face neighbors; walk a
+  // 4x4x4 grid and check every traversal step moves by one cell
+  SpatialSetType sset;
+  sset.setTraversalOrder(RAJA::SpatialOrder::hilbert);
+
+  std::vector<KeyType> keys;
+  int seg = 0;
+  for (unsigned z = 0; z < 4; ++z) {
+    for (unsigned y = 0; y < 4; ++y) {
+      for (unsigned x = 0; x < 4; ++x) {
+        sset.push_back(RangeSegType(seg, seg + 1), KeyType{x, y, z});
+        keys.push_back(KeyType{x, y, z});
+        ++seg;
+      }
+    }
+  }
+
+  std::vector<int> order = traversalBegins(sset);
+  ASSERT_EQ(size_t(64), order.size());
+  for (size_t i = 1; i < order.size(); ++i) {
+    KeyType prev = keys[order[i - 1]];
+    KeyType cur = keys[order[i]];
+    int dist = std::abs(int(cur.x) - int(prev.x)) +
+               std::abs(int(cur.y) - int(prev.y)) +
+               std::abs(int(cur.z) - int(prev.z));
+    ASSERT_EQ(1, dist);
+  }
+}
+
+TEST(SpatialIndexSetUnitTest, TraversalCachedAndRebuilt)
+{
+  SpatialSetType sset;
+  sset.push_back(RangeSegType(10, 20), KeyType{1, 0, 0});
+  sset.push_back(RangeSegType(0, 10), KeyType{0, 0, 0});
+
+  auto const* cached = &sset.getTraversal();
+  // repeated calls return the cached set
+  ASSERT_EQ(cached, &sset.getTraversal());
+
+  std::vector<int> expected{0, 10};
+  ASSERT_EQ(expected, traversalBegins(sset));
+
+  // adding a segment invalidates the cache and reorders
+  sset.push_back(RangeSegType(20, 30), KeyType{0, 1, 0});
+  std::vector<int> expected2{0, 10, 20};
+  ASSERT_EQ(expected2, traversalBegins(sset));
+
+  // so does changing the traversal order
+  sset.setTraversalOrder(RAJA::SpatialOrder::insertion);
+  std::vector<int> expected3{10, 0, 20};
+  ASSERT_EQ(expected3, traversalBegins(sset));
+}
+
+TEST(SpatialIndexSetUnitTest, ForallOverTraversal)
+{
+  SpatialSetType sset;
+  sset.push_back(RangeSegType(10, 20), KeyType{1, 0, 0});
+  sset.push_back(RangeSegType(0, 10), KeyType{0, 0, 0});
+
+  std::vector<int> order;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      sset.getTraversal(), [&](int i) { order.push_back(i); });
+
+  ASSERT_EQ(size_t(20), order.size());
+  // Morton order puts the {0,0,0} segment first
+  ASSERT_EQ(0, order.front());
+  ASSERT_EQ(19, order.back());
+}
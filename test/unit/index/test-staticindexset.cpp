@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for StaticIndexSet
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+using RangeSeg = RAJA::TypedRangeSegment<RAJA::Index_type>;
+using ListSeg = RAJA::TypedListSegment<RAJA::Index_type>;
+
+TEST(StaticIndexSet, BuildAndQuery)
+{
+  RAJA::StaticIndexSet<4, RangeSeg> iset;
+  ASSERT_EQ(0u, iset.getNumSegments());
+  ASSERT_EQ(0, iset.getLength());
+
+  iset.push_back(RangeSeg(0, 10));
+  iset.push_back(RangeSeg(20, 25));
+  ASSERT_EQ(2u, iset.getNumSegments());
+  ASSERT_EQ(15, iset.getLength());
+
+  iset.clear();
+  ASSERT_EQ(0u, iset.getNumSegments());
+}
+
+TEST(StaticIndexSet, ForallCoversAllSegments)
+{
+  constexpr RAJA::Index_type N = 100;
+
+  // partially filled set: occupancy tests must skip the empty slots
+  RAJA::StaticIndexSet<8, RangeSeg> iset;
+  iset.push_back(RangeSeg(0, 30));
+  iset.push_back(RangeSeg(30, 31));  // single-element segment
+  iset.push_back(RangeSeg(31, N));
+
+  std::vector<int> counts(N, 0);
+  int* cptr = counts.data();
+
+  RAJA::forall<RAJA::seq_exec>(iset, [=](RAJA::Index_type i) {
+    cptr[i] += 1;
+  });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(1, counts[i]);
+  }
+}
+
+TEST(StaticIndexSet, MixedSegmentTypes)
+{
+  constexpr RAJA::Index_type N = 40;
+
+  std::vector<RAJA::Index_type> odds;
+  for (RAJA::Index_type i = 21; i < N; i += 2) {
+    odds.push_back(i);
+  }
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  RAJA::StaticIndexSet<3, RangeSeg, ListSeg> iset;
+  iset.push_back(RangeSeg(0, 20));
+  iset.push_back(ListSeg(odds.data(),
+                         odds.size(),
+                         host_res));
+
+  ASSERT_EQ(2u, iset.getNumSegments());
+  ASSERT_EQ(20 + static_cast<RAJA::Index_type>(odds.size()),
+            iset.getLength());
+
+  std::vector<int> counts(N, 0);
+  int* cptr = counts.data();
+
+  RAJA::forall<RAJA::seq_exec>(iset, [=](RAJA::Index_type i) {
+    cptr[i] += 1;
+  });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    int expected = (i < 20 || (i >= 21 && (i % 2) == 1)) ? 1 : 0;
+    ASSERT_EQ(expected, counts[i]) << "i = " << i;
+  }
+}
+
+TEST(StaticIndexSet, CopySharesNothing)
+{
+  RAJA::StaticIndexSet<2, RangeSeg> iset;
+  iset.push_back(RangeSeg(0, 5));
+
+  RAJA::StaticIndexSet<2, RangeSeg> copy(iset);
+  iset.clear();
+
+  ASSERT_EQ(1u, copy.getNumSegments());
+  ASSERT_EQ(5, copy.getLength());
+}
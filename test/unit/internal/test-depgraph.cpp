@@ -0,0 +1,171 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for DepGraph and DepGraphNode
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/internal/DepGraphNode.hpp"
+
+#include <atomic>
+#include <vector>
+
+TEST(DepGraphUnitTest, build_and_reset)
+{
+  // diamond: 0 -> {1, 2} -> 3
+  RAJA::DepGraph graph(4);
+  graph.addDependency(0, 1);
+  graph.addDependency(0, 2);
+  graph.addDependency(1, 3);
+  graph.addDependency(2, 3);
+
+  ASSERT_EQ(4, graph.numTasks());
+
+  ASSERT_EQ(2, graph.node(0).numDepTasks());
+  ASSERT_EQ(1, graph.node(0).depTaskNum(0));
+  ASSERT_EQ(2, graph.node(0).depTaskNum(1));
+
+  ASSERT_EQ(0, graph.node(0).semaphoreReloadValue());
+  ASSERT_EQ(1, graph.node(1).semaphoreReloadValue());
+  ASSERT_EQ(1, graph.node(2).semaphoreReloadValue());
+  ASSERT_EQ(2, graph.node(3).semaphoreReloadValue());
+
+  graph.reset();
+
+  ASSERT_EQ(0, graph.node(0).semaphoreValue());
+  ASSERT_EQ(2, graph.node(3).semaphoreValue());
+
+  // exactly the last satisfied dependence reports the task ready
+  ASSERT_FALSE(graph.node(3).satisfyOne());
+  ASSERT_TRUE(graph.node(3).satisfyOne());
+
+  // a second traversal starts from the reload values again
+  graph.reset();
+  ASSERT_EQ(2, graph.node(3).semaphoreValue());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(DepGraphUnitTest, forall_taskgraph_chain)
+{
+  // four segments covering [0, 40) with dependences that serialize them
+  // in segment order; each iteration records its position in a shared
+  // counter so ordering violations are observable
+  constexpr int num_seg = 4;
+  constexpr int seg_len = 10;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * seg_len, (s + 1) * seg_len));
+  }
+
+  RAJA::DepGraph graph(num_seg);
+  for (int s = 1; s < num_seg; ++s) {
+    graph.addDependency(s - 1, s);
+  }
+
+  std::vector<int> order(num_seg * seg_len, -1);
+  std::atomic<int> count(0);
+
+  for (int rep = 0; rep < 2; ++rep) {
+
+    count = 0;
+
+    RAJA::forall_taskgraph(
+        RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>(),
+        iset,
+        graph,
+        [&](RAJA::Index_type i) { order[i] = count++; });
+
+    ASSERT_EQ(num_seg * seg_len, count);
+
+    // every iteration of a segment must run after every iteration of the
+    // segment it depends on
+    for (int s = 1; s < num_seg; ++s) {
+      for (int i = 0; i < seg_len; ++i) {
+        for (int j = 0; j < seg_len; ++j) {
+          ASSERT_GT(order[s * seg_len + i], order[(s - 1) * seg_len + j]);
+        }
+      }
+    }
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP
+
+TEST(DepGraphUnitTest, forall_multi_resource_independent)
+{
+  // four segments distributed round-robin over two host resources
+  constexpr int num_seg = 4;
+  constexpr int seg_len = 10;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * seg_len, (s + 1) * seg_len));
+  }
+
+  std::vector<int> hits(num_seg * seg_len, 0);
+  int* hits_ptr = hits.data();
+
+  RAJA::forall_multi_resource<RAJA::seq_exec>(
+      iset,
+      {RAJA::resources::Host{}, RAJA::resources::Host{}},
+      [=](RAJA::Index_type i) { hits_ptr[i] += 1; });
+
+  for (int i = 0; i < num_seg * seg_len; ++i) {
+    ASSERT_EQ(1, hits[i]);
+  }
+}
+
+TEST(DepGraphUnitTest, forall_multi_resource_diamond)
+{
+  // diamond: 0 -> {1, 2} -> 3, over two resources, twice to exercise
+  // the semaphore reload
+  constexpr int num_seg = 4;
+  constexpr int seg_len = 10;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * seg_len, (s + 1) * seg_len));
+  }
+
+  RAJA::DepGraph graph(num_seg);
+  graph.addDependency(0, 1);
+  graph.addDependency(0, 2);
+  graph.addDependency(1, 3);
+  graph.addDependency(2, 3);
+
+  std::vector<int> order(num_seg * seg_len, -1);
+  std::atomic<int> count(0);
+  int* order_ptr = order.data();
+  std::atomic<int>* count_ptr = &count;
+
+  for (int rep = 0; rep < 2; ++rep) {
+
+    count = 0;
+
+    RAJA::forall_multi_resource<RAJA::seq_exec>(
+        iset,
+        graph,
+        {RAJA::resources::Host{}, RAJA::resources::Host{}},
+        [=](RAJA::Index_type i) { order_ptr[i] = (*count_ptr)++; });
+
+    ASSERT_EQ(num_seg * seg_len, count);
+
+    // the ends of the diamond are ordered against the middle segments
+    for (int s : {1, 2}) {
+      for (int i = 0; i < seg_len; ++i) {
+        for (int j = 0; j < seg_len; ++j) {
+          ASSERT_GT(order[s * seg_len + i], order[j]);
+          ASSERT_LT(order[s * seg_len + i], order[3 * seg_len + j]);
+        }
+      }
+    }
+  }
+}
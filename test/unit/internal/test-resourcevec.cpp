@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for ResourceVec
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(ResourceVecUnitTest, basic_test)
+{
+  RAJA::ResourceVec<int> a;
+
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(0lu, a.size());
+
+  a.push_back(5);
+  ASSERT_FALSE(a.empty());
+  ASSERT_EQ(5, *a.begin());
+  ASSERT_EQ(5, *(a.end() - 1));
+
+  // grow past the initial capacity; contents survive reallocation
+  for (int i = 0; i < 100; ++i) {
+    a.push_back(i);
+  }
+  ASSERT_EQ(101lu, a.size());
+  ASSERT_EQ(5, a[0]);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(i, a[i + 1]);
+  }
+
+  a.wait();
+
+  a.clear();
+  ASSERT_EQ(0lu, a.size());
+
+  a.resize(10);
+  ASSERT_EQ(10lu, a.size());
+  ASSERT_GE(a.capacity(), 10lu);
+}
+
+TEST(ResourceVecUnitTest, append_test)
+{
+  RAJA::ResourceVec<RAJA::Index_type> a;
+
+  std::vector<RAJA::Index_type> chunk(1000);
+  for (size_t i = 0; i < chunk.size(); ++i) {
+    chunk[i] = static_cast<RAJA::Index_type>(i);
+  }
+
+  // bulk copy-in through the resource, growing several times
+  for (int rep = 0; rep < 5; ++rep) {
+    a.append(chunk.data(), chunk.size());
+  }
+
+  RAJA::resources::Event e = a.event();
+  e.wait();
+
+  ASSERT_EQ(5 * chunk.size(), a.size());
+  for (size_t i = 0; i < a.size(); ++i) {
+    ASSERT_EQ(chunk[i % chunk.size()], a[i]);
+  }
+
+  a.wait();
+}
+
+TEST(ResourceVecUnitTest, move_test)
+{
+  RAJA::ResourceVec<int> a;
+  for (int i = 0; i < 50; ++i) {
+    a.push_back(i);
+  }
+
+  RAJA::ResourceVec<int> b(std::move(a));
+  ASSERT_EQ(50lu, b.size());
+  for (int i = 0; i < 50; ++i) {
+    ASSERT_EQ(i, b[i]);
+  }
+}
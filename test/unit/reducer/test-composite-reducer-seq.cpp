@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for sequential ReduceComposite
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename T>
+void testCompositeReduceBasic()
+{
+  constexpr int len = 1000;
+
+  RAJA::ReduceComposite<RAJA::seq_reduce, T,
+                        RAJA::reduce::min,
+                        RAJA::reduce::max,
+                        RAJA::reduce::sum> stats;
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+    stats.combine(T(i + 1));
+  });
+
+  ASSERT_EQ(stats.get(0), T(1));
+  ASSERT_EQ(stats.get(1), T(len));
+  ASSERT_EQ(stats.get(2), T(len * (len + 1) / 2));
+}
+
+template <typename T>
+void testCompositeReduceInitAndReset()
+{
+  constexpr int len = 100;
+
+  RAJA::ReduceComposite<RAJA::seq_reduce, T,
+                        RAJA::reduce::min,
+                        RAJA::reduce::max,
+                        RAJA::reduce::sum> stats(T(5));
+
+  // the initial operand participates in every component
+  ASSERT_EQ(stats.get(0), T(5));
+  ASSERT_EQ(stats.get(1), T(5));
+  ASSERT_EQ(stats.get(2), T(5));
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+    stats.combine(T(i + 10));
+  });
+
+  ASSERT_EQ(stats.get(0), T(5));
+  ASSERT_EQ(stats.get(1), T(len + 9));
+  ASSERT_EQ(stats.get(2), T(5 + len * 10 + len * (len - 1) / 2));
+
+  stats.reset(T(2));
+  ASSERT_EQ(stats.get(0), T(2));
+  ASSERT_EQ(stats.get(1), T(2));
+  ASSERT_EQ(stats.get(2), T(2));
+}
+
+TEST(CompositeReducer, basic_seq)
+{
+  testCompositeReduceBasic<int>();
+  testCompositeReduceBasic<double>();
+}
+
+TEST(CompositeReducer, init_reset_seq)
+{
+  testCompositeReduceInitAndReset<int>();
+  testCompositeReduceInitAndReset<double>();
+}
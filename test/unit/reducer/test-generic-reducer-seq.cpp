@@ -0,0 +1,90 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the sequential generic operator
+/// reducer (RAJA::Reduce) and compensated summation
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename T>
+void testGenericReduceBuiltinOp()
+{
+  constexpr int len = 1000;
+
+  RAJA::Reduce<RAJA::seq_reduce, RAJA::reduce::sum<T>> red;
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+    red.combine(T(i + 1));
+  });
+
+  ASSERT_EQ(red.get(), T(len * (len + 1) / 2));
+}
+
+TEST(GenericReducer, builtin_op_seq)
+{
+  testGenericReduceBuiltinOp<int>();
+  testGenericReduceBuiltinOp<double>();
+}
+
+TEST(GenericReducer, kahan_basic_seq)
+{
+  constexpr int len = 1000;
+
+  RAJA::Reduce<RAJA::seq_reduce, RAJA::reduce::kahan_sum<double>> red;
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+    red.combine(double(i + 1));
+  });
+
+  double sum = red.get();
+  ASSERT_EQ(sum, double(len * (len + 1) / 2));
+}
+
+TEST(GenericReducer, kahan_compensation_seq)
+{
+  // classic compensation check: a naive double sum of these operands
+  // loses the small contributions to round-off and returns 0
+  const double vals[4] = {1.0, 1e100, 1.0, -1e100};
+
+  RAJA::Reduce<RAJA::seq_reduce, RAJA::reduce::kahan_sum<double>> red;
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 4),
+                               [=](RAJA::Index_type i) {
+    red.combine(vals[i]);
+  });
+
+  double sum = red.get();
+  ASSERT_EQ(sum, 2.0);
+}
+
+TEST(GenericReducer, kahan_init_reset_seq)
+{
+  constexpr int len = 100;
+
+  using tally = RAJA::operators::kahan_tally<double>;
+
+  RAJA::Reduce<RAJA::seq_reduce, RAJA::reduce::kahan_sum<double>> red(
+      tally(5.0));
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+    red.combine(double(i + 1));
+  });
+
+  double sum = red.get();
+  ASSERT_EQ(sum, double(5 + len * (len + 1) / 2));
+
+  red.reset(tally(2.0));
+  sum = red.get();
+  ASSERT_EQ(sum, 2.0);
+}
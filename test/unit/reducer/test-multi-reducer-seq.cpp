@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for sequential MultiReduceSum
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename T>
+void testMultiReduceSumBasic()
+{
+  constexpr size_t num_bins = 40;
+  constexpr int len = 1000;
+
+  RAJA::MultiReduceSum<RAJA::seq_reduce, T> tally(num_bins);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len), [=](RAJA::Index_type i) {
+    tally.add(static_cast<size_t>(i) % num_bins, T(1));
+  });
+
+  ASSERT_EQ(tally.size(), num_bins);
+  for (size_t bin = 0; bin < num_bins; ++bin) {
+    ASSERT_EQ(tally.get(bin), T(len / num_bins));
+  }
+}
+
+template <typename T>
+void testMultiReduceSumInitAndReset()
+{
+  constexpr size_t num_bins = 7;
+
+  RAJA::MultiReduceSum<RAJA::seq_reduce, T> tally(num_bins, T(5));
+
+  for (size_t bin = 0; bin < num_bins; ++bin) {
+    ASSERT_EQ(tally.get(bin), T(5));
+  }
+
+  tally.add(3, T(2));
+  ASSERT_EQ(tally.get(3), T(7));
+
+  tally.reset();
+  for (size_t bin = 0; bin < num_bins; ++bin) {
+    ASSERT_EQ(tally.get(bin), T(0));
+  }
+}
+
+TEST(MultiReducer, basic_sum_seq)
+{
+  testMultiReduceSumBasic<int>();
+  testMultiReduceSumBasic<double>();
+}
+
+TEST(MultiReducer, init_reset_sum_seq)
+{
+  testMultiReduceSumInitAndReset<int>();
+  testMultiReduceSumInitAndReset<double>();
+}
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for reducer accumulation windows
+/// (begin_batch/end_batch) with sequential reducers
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename T>
+void testReducerBatchSum()
+{
+  constexpr int num_segments = 4;
+  constexpr int seg_len = 250;
+  constexpr int len = num_segments * seg_len;
+
+  RAJA::ReduceSum<RAJA::seq_reduce, T> sum(T(0));
+
+  // accumulate one value across several foralls inside one window
+  sum.begin_batch();
+  for (int s = 0; s < num_segments; ++s) {
+    RAJA::forall<RAJA::seq_exec>(
+        RAJA::RangeSegment(s * seg_len, (s + 1) * seg_len),
+        [=](RAJA::Index_type i) { sum += T(i + 1); });
+  }
+  sum.end_batch();
+
+  ASSERT_EQ(sum.get(), T(len) * T(len + 1) / T(2));
+}
+
+template <typename T>
+void testReducerBatchMinMax()
+{
+  constexpr int len = 100;
+
+  RAJA::ReduceMin<RAJA::seq_reduce, T> mn(T(len));
+  RAJA::ReduceMax<RAJA::seq_reduce, T> mx(T(0));
+
+  mn.begin_batch();
+  mx.begin_batch();
+  for (int s = 0; s < 2; ++s) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(s * len / 2, (s + 1) * len / 2),
+                                 [=](RAJA::Index_type i) {
+      mn.min(T(i + 1));
+      mx.max(T(i + 1));
+    });
+  }
+  mn.end_batch();
+  mx.end_batch();
+
+  ASSERT_EQ(mn.get(), T(1));
+  ASSERT_EQ(mx.get(), T(len));
+
+  // a reducer reset after a window starts a fresh accumulation
+  mn.reset(T(5));
+  ASSERT_EQ(mn.get(), T(5));
+}
+
+TEST(ReducerBatch, sum_seq)
+{
+  testReducerBatchSum<int>();
+  testReducerBatchSum<double>();
+}
+
+TEST(ReducerBatch, minmax_seq)
+{
+  testReducerBatchMinMax<int>();
+  testReducerBatchMinMax<double>();
+}
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the deterministic OpenMP reduction
+/// policy: results must be bitwise identical across team sizes
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+using DetExec = RAJA::omp_parallel_for_deterministic_exec<256>;
+using DetReduce = RAJA::omp_reduce_deterministic;
+
+//
+// Values spanning many magnitudes, so any change in combine order is
+// visible in the low mantissa bits of a double sum.
+//
+static std::vector<double> makeData(int len)
+{
+  std::vector<double> data(len);
+  std::mt19937_64 rng(5871);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (auto& d : data) {
+    d = dist(rng) * (dist(rng) > 0.0 ? 1.0e10 : 1.0e-10);
+  }
+  return data;
+}
+
+static double sumWithThreads(const double* data, int len, int num_threads)
+{
+  omp_set_num_threads(num_threads);
+  RAJA::ReduceSum<DetReduce, double> sum(0.0);
+  RAJA::forall<DetExec>(RAJA::RangeSegment(0, len),
+                        [=](RAJA::Index_type i) { sum += data[i]; });
+  return sum.get();
+}
+
+TEST(ReducerDeterministicUnitTest, BitwiseAcrossTeamSizes)
+{
+  const int len = 100003;
+  std::vector<double> data = makeData(len);
+
+  const int max_threads = omp_get_max_threads();
+  double ref = sumWithThreads(data.data(), len, 1);
+  for (int nt = 2; nt <= max_threads; ++nt) {
+    double val = sumWithThreads(data.data(), len, nt);
+    ASSERT_EQ(std::memcmp(&val, &ref, sizeof(double)), 0);
+  }
+  omp_set_num_threads(max_threads);
+
+  // sanity: close to a long-double serial accumulation
+  long double serial = 0.0L;
+  for (int i = 0; i < len; ++i) {
+    serial += data[i];
+  }
+  ASSERT_NEAR(ref, static_cast<double>(serial), 1.0e-6 * std::abs(ref));
+}
+
+TEST(ReducerDeterministicUnitTest, MinMaxLocAndReuse)
+{
+  const int len = 5000;
+  std::vector<double> data = makeData(len);
+  data[1234] = -1.0e30;
+  data[4321] = 1.0e30;
+  const double* dp = data.data();
+
+  RAJA::ReduceMinLoc<DetReduce, double, RAJA::Index_type> mnloc(0.0, -1);
+  RAJA::ReduceMax<DetReduce, double> mx(0.0);
+  RAJA::forall<DetExec>(RAJA::RangeSegment(0, len),
+                        [=](RAJA::Index_type i) {
+                          mnloc.minloc(dp[i], i);
+                          mx.max(dp[i]);
+                        });
+  ASSERT_EQ(mnloc.get(), -1.0e30);
+  ASSERT_EQ(mnloc.getLoc(), 1234);
+  ASSERT_EQ(mx.get(), 1.0e30);
+
+  // a reducer reused across foralls keeps a fixed combine order too
+  RAJA::ReduceSum<DetReduce, double> sum(0.0);
+  RAJA::forall<DetExec>(RAJA::RangeSegment(0, len / 2),
+                        [=](RAJA::Index_type i) { sum += dp[i]; });
+  RAJA::forall<DetExec>(RAJA::RangeSegment(len / 2, len),
+                        [=](RAJA::Index_type i) { sum += dp[i]; });
+
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  RAJA::ReduceSum<DetReduce, double> sum_serial(0.0);
+  RAJA::forall<DetExec>(RAJA::RangeSegment(0, len / 2),
+                        [=](RAJA::Index_type i) { sum_serial += dp[i]; });
+  RAJA::forall<DetExec>(RAJA::RangeSegment(len / 2, len),
+                        [=](RAJA::Index_type i) { sum_serial += dp[i]; });
+  omp_set_num_threads(max_threads);
+
+  double a = sum.get();
+  double b = sum_serial.get();
+  ASSERT_EQ(std::memcmp(&a, &b, sizeof(double)), 0);
+}
+
+#endif
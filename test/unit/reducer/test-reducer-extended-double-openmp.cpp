@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for extended_double sum reductions
+/// with OpenMP execution, exercising the per-worker tally merges
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(ExtendedDoubleReducer, ill_conditioned_sum_openmp)
+{
+  // worker tallies each absorb part of the large value's neighborhood;
+  // the double-double merge must still recover the units exactly
+  constexpr int len = 1000000;
+
+  RAJA::ReduceSum<RAJA::omp_reduce, RAJA::extended_double> sum(1e16);
+
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, len),
+                                            [=](RAJA::Index_type) {
+    sum += 1.0;
+  });
+
+  RAJA::extended_double total = sum.get();
+  total += -1e16;
+  ASSERT_EQ(double(total), double(len));
+}
+
+TEST(ExtendedDoubleReducer, alternating_sum_openmp)
+{
+  // pairs (x, -x) split arbitrarily across workers plus one unit per
+  // pair; the surviving sum is known exactly
+  constexpr int len = 100000;
+
+  RAJA::ReduceSum<RAJA::omp_reduce, RAJA::extended_double> sum(0.0);
+
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, len),
+                                            [=](RAJA::Index_type i) {
+    const double x = 1e12 + double(i);
+    sum += x;
+    sum += -x;
+    sum += 1.0;
+  });
+
+  ASSERT_EQ(double(sum.get()), double(len));
+}
+
+#endif  // RAJA_ENABLE_OPENMP
@@ -0,0 +1,65 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for extended_double sum reductions
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+TEST(ExtendedDoubleReducer, basic_sum_seq)
+{
+  constexpr int len = 1000;
+
+  RAJA::ReduceSum<RAJA::seq_reduce, RAJA::extended_double> sum(0.0);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+    sum += double(i + 1);
+  });
+
+  ASSERT_EQ(double(sum.get()), double(len * (len + 1) / 2));
+}
+
+TEST(ExtendedDoubleReducer, ill_conditioned_sum_seq)
+{
+  // one large value and a million units: a naive double sum absorbs the
+  // units into the large value's round-off; the double-double
+  // accumulator carries them exactly
+  constexpr int len = 1000000;
+
+  RAJA::ReduceSum<RAJA::seq_reduce, RAJA::extended_double> sum(1e16);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type) {
+    sum += 1.0;
+  });
+
+  RAJA::extended_double total = sum.get();
+  total += -1e16;
+  ASSERT_EQ(double(total), double(len));
+}
+
+TEST(ExtendedDoubleReducer, cancellation_seq)
+{
+  // classic cancellation: 1 + 1e100 + 1 - 1e100 == 2 exactly in
+  // double-double, 0 in naive double
+  const double vals[4] = {1.0, 1e100, 1.0, -1e100};
+
+  RAJA::ReduceSum<RAJA::seq_reduce, RAJA::extended_double> sum(0.0);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 4),
+                               [=](RAJA::Index_type i) {
+    sum += vals[i];
+  });
+
+  ASSERT_EQ(double(sum.get()), 2.0);
+}
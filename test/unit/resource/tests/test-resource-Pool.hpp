@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_RESOURCE_POOL_HPP__
+#define __TEST_RESOURCE_POOL_HPP__
+
+#include "RAJA_test-base.hpp"
+
+template <typename WORKING_RES, typename EXEC_POLICY>
+void ResourcePoolTestImpl()
+{
+  constexpr std::size_t ARRAY_SIZE{10000};
+  using namespace RAJA;
+
+  resources::ResourcePool<WORKING_RES> pool(3);
+  resources::Host host;
+
+  ASSERT_EQ(pool.size(), 3u);
+
+  WORKING_RES& alloc_res = pool.get();
+  int* d_array = resources::Resource{alloc_res}.allocate<int>(ARRAY_SIZE);
+  int* h_array = host.allocate<int>(ARRAY_SIZE);
+  alloc_res.wait();
+
+  // Independent foralls land on successive pool resources and may
+  // overlap.
+  forall<EXEC_POLICY>(pool.get(), RangeSegment(0,ARRAY_SIZE),
+    [=] RAJA_HOST_DEVICE (int i) {
+      if (i % 2 == 0) {
+        d_array[i] = i;
+      }
+  });
+
+  resources::Event e2 = forall<EXEC_POLICY>(pool.get(), RangeSegment(0,ARRAY_SIZE),
+    [=] RAJA_HOST_DEVICE (int i) {
+      if (i % 2 == 1) {
+        d_array[i] = i;
+      }
+  });
+
+  // The dependent forall reads values written by the second one, so
+  // chain it behind that event; the pool orders it on its own stream.
+  forall<EXEC_POLICY>(pool.depends_on(e2), RangeSegment(0,ARRAY_SIZE),
+    [=] RAJA_HOST_DEVICE (int i) {
+      if (i % 2 == 1) {
+        d_array[i] += 1;
+      }
+  });
+
+  pool.wait();
+
+  WORKING_RES copy_res;
+  copy_res.memcpy(h_array, d_array, sizeof(int) * ARRAY_SIZE);
+  copy_res.wait();
+
+  forall<policy::sequential::seq_exec>(host, RangeSegment(0,ARRAY_SIZE),
+    [=] (int i) {
+      if (i % 2 == 0) {
+        ASSERT_EQ(h_array[i], i);
+      } else {
+        ASSERT_EQ(h_array[i], i + 1);
+      }
+    }
+  );
+
+  alloc_res.deallocate(d_array);
+  host.deallocate(h_array);
+}
+
+TYPED_TEST_SUITE_P(ResourcePoolTest);
+template <typename T>
+class ResourcePoolTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ResourcePoolTest, ResourcePool)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ResourcePoolTestImpl<WORKING_RES, EXEC_POLICY>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ResourcePoolTest,
+                            ResourcePool);
+
+#endif  // __TEST_RESOURCE_POOL_HPP__
@@ -0,0 +1,72 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+/*
+ * Tests for forall with the multi-versioned simd_multi_exec policy
+ */
+
+TEST(SimdMultiForallUnitTest, DetectedArchStable)
+{
+  // detection runs once per process and must be repeatable
+  RAJA::simd::Arch arch = RAJA::simd::detected_arch();
+  ASSERT_EQ(arch, RAJA::simd::detected_arch());
+  ASSERT_EQ(arch, RAJA::simd::detect_arch());
+}
+
+TEST(SimdMultiForallUnitTest, DaxpyMatchesSeq)
+{
+  constexpr int N = 1000;
+
+  std::vector<double> a(N), b(N), c(N, 0.0), c_ref(N, 0.0);
+  for (int i = 0; i < N; ++i) {
+    a[i] = 0.5 * i;
+    b[i] = 2.0 - 0.25 * i;
+  }
+
+  double* a_ptr = a.data();
+  double* b_ptr = b.data();
+  double* c_ptr = c.data();
+  double* ref_ptr = c_ref.data();
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    ref_ptr[i] = a_ptr[i] + 3.0 * b_ptr[i];
+  });
+
+  RAJA::forall<RAJA::simd_multi_exec>(RAJA::RangeSegment(0, N),
+                                      [=](RAJA::Index_type i) {
+    c_ptr[i] = a_ptr[i] + 3.0 * b_ptr[i];
+  });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(c[i], c_ref[i]);
+  }
+}
+
+TEST(SimdMultiForallUnitTest, OddLengthAndEmpty)
+{
+  // lengths that are not multiples of any vector width, including zero
+  for (int n : {0, 1, 7, 33, 1023}) {
+    std::vector<int> out(n > 0 ? n : 1, -1);
+    int* out_ptr = out.data();
+
+    RAJA::forall<RAJA::simd_multi_exec>(RAJA::RangeSegment(0, n),
+                                        [=](RAJA::Index_type i) {
+      out_ptr[i] = static_cast<int>(2 * i);
+    });
+
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(out[i], 2 * i);
+    }
+    if (n == 0) {
+      ASSERT_EQ(out[0], -1);
+    }
+  }
+}
@@ -0,0 +1,179 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the simd Register abstraction
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+
+template <typename T, camp::idx_t W>
+void testRegisterLoadStore()
+{
+  T in[2 * W];
+  T out[2 * W];
+  for (camp::idx_t i = 0; i < 2 * W; ++i) {
+    in[i] = T(i + 1);
+    out[i] = T(0);
+  }
+
+  RAJA::simd::Register<T, W> r;
+  r.load_packed(in);
+  r.store_packed(out);
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(out[i], in[i]);
+  }
+
+  // partial load/store leaves inactive lanes of the destination untouched
+  camp::idx_t n = W > 1 ? W - 1 : 1;
+  RAJA::simd::Register<T, W> p;
+  p.load_packed_n(in + W, n);
+  p.store_packed_n(out + W, n);
+  for (camp::idx_t i = 0; i < n; ++i) {
+    ASSERT_EQ(out[W + i], in[W + i]);
+  }
+  for (camp::idx_t i = n; i < W; ++i) {
+    ASSERT_EQ(out[W + i], T(0));
+  }
+}
+
+template <typename T, camp::idx_t W>
+void testRegisterGatherScatter()
+{
+  T data[2 * W];
+  T out[2 * W];
+  int idx[W];
+  for (camp::idx_t i = 0; i < 2 * W; ++i) {
+    data[i] = T(i);
+    out[i] = T(0);
+  }
+  for (camp::idx_t i = 0; i < W; ++i) {
+    idx[i] = static_cast<int>(2 * W - 1 - i) % (2 * W);
+  }
+
+  RAJA::simd::Register<T, W> r;
+  r.gather(data, idx);
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(r.get(i), data[idx[i]]);
+  }
+
+  r.scatter(out, idx);
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(out[idx[i]], data[idx[i]]);
+  }
+}
+
+template <typename T, camp::idx_t W>
+void testRegisterArithmetic()
+{
+  RAJA::simd::Register<T, W> a(T(2));
+  RAJA::simd::Register<T, W> b(T(3));
+  RAJA::simd::Register<T, W> c(T(1));
+
+  auto sum = a + b;
+  auto prod = a * b;
+  auto fma = a.multiply_add(b, c);
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(sum.get(i), T(5));
+    ASSERT_EQ(prod.get(i), T(6));
+    ASSERT_EQ(fma.get(i), T(7));
+  }
+
+  ASSERT_EQ(sum.sum(), T(5 * W));
+  ASSERT_EQ(sum.min(), T(5));
+  ASSERT_EQ(sum.max(), T(5));
+}
+
+template <typename T, camp::idx_t W>
+void testForallSimdRegister()
+{
+  constexpr camp::idx_t len = 5 * W + (W > 1 ? W - 1 : 0);
+  T x[len];
+  T y[len];
+  for (camp::idx_t i = 0; i < len; ++i) {
+    x[i] = T(i);
+    y[i] = T(0);
+  }
+
+  RAJA::forall<RAJA::simd_register_exec<W>>(
+      RAJA::TypedRangeSegment<camp::idx_t>(0, len),
+      [=, &y](RAJA::simd::VectorIndex<camp::idx_t, W> vi) {
+        RAJA::simd::Register<T, W> r;
+        r.load_packed_n(x + vi.begin(), vi.size());
+        (r + r).store_packed_n(y + vi.begin(), vi.size());
+      });
+
+  for (camp::idx_t i = 0; i < len; ++i) {
+    ASSERT_EQ(y[i], T(2 * i));
+  }
+}
+
+TEST(SimdRegister, LoadStore)
+{
+  testRegisterLoadStore<double, 4>();
+  testRegisterLoadStore<float, 8>();
+  testRegisterLoadStore<int, 4>();
+  testRegisterLoadStore<double, 1>();
+}
+
+TEST(SimdRegister, GatherScatter)
+{
+  testRegisterGatherScatter<double, 4>();
+  testRegisterGatherScatter<int, 8>();
+}
+
+TEST(SimdRegister, Arithmetic)
+{
+  testRegisterArithmetic<double, 4>();
+  testRegisterArithmetic<float, 16>();
+  testRegisterArithmetic<int, 4>();
+}
+
+template <typename T, camp::idx_t W>
+void testRegisterMath()
+{
+  RAJA::simd::Register<T, W> x;
+  for (camp::idx_t i = 0; i < W; ++i) {
+    x.get(i) = T(i + 1);
+  }
+
+  auto e = RAJA::simd::exp(x);
+  auto l = RAJA::simd::log(x);
+  auto s = RAJA::simd::sqrt(x);
+  auto p = RAJA::simd::pow(x, T(2));
+  auto pr = RAJA::simd::pow(x, x);
+
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_FLOAT_EQ(static_cast<float>(e.get(i)),
+                    static_cast<float>(std::exp(x.get(i))));
+    ASSERT_FLOAT_EQ(static_cast<float>(l.get(i)),
+                    static_cast<float>(std::log(x.get(i))));
+    ASSERT_FLOAT_EQ(static_cast<float>(s.get(i)),
+                    static_cast<float>(std::sqrt(x.get(i))));
+    ASSERT_EQ(p.get(i), x.get(i) * x.get(i));
+    ASSERT_FLOAT_EQ(static_cast<float>(pr.get(i)),
+                    static_cast<float>(std::pow(x.get(i), x.get(i))));
+  }
+}
+
+TEST(SimdRegister, ForallChunks)
+{
+  testForallSimdRegister<double, 4>();
+  testForallSimdRegister<float, 8>();
+  testForallSimdRegister<int, 1>();
+}
+
+TEST(SimdRegister, Math)
+{
+  testRegisterMath<double, 4>();
+  testRegisterMath<float, 8>();
+  testRegisterMath<double, 1>();
+}
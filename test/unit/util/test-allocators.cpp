@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for global allocator registration
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+//
+// Counting allocator callbacks that forward to malloc/free; user_data
+// points at the counters so registration carries no global state of
+// its own.
+//
+struct AllocCounts {
+  int allocations = 0;
+  int deallocations = 0;
+};
+
+static void* counting_allocate(std::size_t nbytes, void* user_data)
+{
+  static_cast<AllocCounts*>(user_data)->allocations += 1;
+  return std::malloc(nbytes);
+}
+
+static void counting_deallocate(void* ptr, void* user_data)
+{
+  static_cast<AllocCounts*>(user_data)->deallocations += 1;
+  std::free(ptr);
+}
+
+TEST(AllocatorsUnitTest, RegistrationLifecycle)
+{
+  using RAJA::util::AllocatorSpace;
+
+  ASSERT_FALSE(RAJA::util::has_allocator(AllocatorSpace::host));
+
+  AllocCounts counts;
+  RAJA::util::set_allocator(
+      AllocatorSpace::host,
+      RAJA::util::AllocatorCallbacks{counting_allocate,
+                                     counting_deallocate,
+                                     &counts});
+
+  ASSERT_TRUE(RAJA::util::has_allocator(AllocatorSpace::host));
+  ASSERT_FALSE(RAJA::util::has_allocator(AllocatorSpace::device));
+
+  void* ptr = RAJA::util::callback_allocate(AllocatorSpace::host, 64);
+  ASSERT_NE(ptr, nullptr);
+  RAJA::util::callback_deallocate(AllocatorSpace::host, ptr);
+
+  ASSERT_EQ(counts.allocations, 1);
+  ASSERT_EQ(counts.deallocations, 1);
+
+  RAJA::util::reset_allocator(AllocatorSpace::host);
+  ASSERT_FALSE(RAJA::util::has_allocator(AllocatorSpace::host));
+}
+
+TEST(AllocatorsUnitTest, ListSegmentUsesRegisteredHostAllocator)
+{
+  using RAJA::util::AllocatorSpace;
+
+  AllocCounts counts;
+  RAJA::util::set_allocator(
+      AllocatorSpace::host,
+      RAJA::util::AllocatorCallbacks{counting_allocate,
+                                     counting_deallocate,
+                                     &counts});
+
+  {
+    std::vector<RAJA::Index_type> indices{3, 1, 4, 1, 5};
+    RAJA::TypedListSegment<RAJA::Index_type> segment(indices);
+    ASSERT_GE(counts.allocations, 1);
+
+    // the segment still holds a faithful copy of the indices
+    ASSERT_EQ(segment.size(), RAJA::Index_type(indices.size()));
+    for (size_t i = 0; i < indices.size(); ++i) {
+      ASSERT_EQ(segment.begin()[i], indices[i]);
+    }
+  }
+
+  ASSERT_EQ(counts.allocations, counts.deallocations);
+
+  RAJA::util::reset_allocator(AllocatorSpace::host);
+}
+
+TEST(AllocatorsUnitTest, MempoolUsesRegisteredHostAllocator)
+{
+  using RAJA::util::AllocatorSpace;
+
+  AllocCounts counts;
+  RAJA::util::set_allocator(
+      AllocatorSpace::host,
+      RAJA::util::AllocatorCallbacks{counting_allocate,
+                                     counting_deallocate,
+                                     &counts});
+
+  using mempool = RAJA::basic_mempool::MemPool<
+      RAJA::basic_mempool::generic_allocator>;
+
+  mempool pool;
+  double* data = pool.malloc<double>(128);
+  ASSERT_NE(data, nullptr);
+  ASSERT_GE(counts.allocations, 1);
+  pool.free(data);
+
+  RAJA::util::reset_allocator(AllocatorSpace::host);
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the self-tuning kernel variant harness
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const char* cache_file = "test-autotuner.cache";
+
+//! route the tuning cache to a test-local file; must happen before the
+//  first autotune call in the process
+void setupCacheFile()
+{
+  setenv("RAJA_TUNING_CACHE", cache_file, 1);
+}
+
+}  // namespace
+
+TEST(AutotunerUnitTest, FirstRunBenchmarksThenLocksIn)
+{
+  setupCacheFile();
+  std::remove(cache_file);
+
+  constexpr int len = 100;
+  std::vector<int> runs(3, 0);
+  std::vector<int> data(len, 0);
+  int* rptr = runs.data();
+  int* dptr = data.data();
+
+  auto body = [=](auto tag) {
+    int v = decltype(tag)::value;
+    rptr[v] += 1;
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, len),
+                                 [=](int i) {
+      // make every candidate but 1 measurably slow
+      if (i == 0 && v != 1) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(25));
+      }
+      dptr[i] += 1;
+    });
+  };
+
+  using Candidates = camp::list<camp::num<0>, camp::num<1>, camp::num<2>>;
+
+  // first run: every candidate executes once
+  RAJA::util::autotune("autotuner-test-lockin", Candidates{}, body);
+  ASSERT_EQ(1, runs[0]);
+  ASSERT_EQ(1, runs[1]);
+  ASSERT_EQ(1, runs[2]);
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(3, data[i]);
+  }
+
+  // subsequent runs: only the fast candidate executes
+  RAJA::util::autotune("autotuner-test-lockin", Candidates{}, body);
+  RAJA::util::autotune("autotuner-test-lockin", Candidates{}, body);
+  ASSERT_EQ(1, runs[0]);
+  ASSERT_EQ(3, runs[1]);
+  ASSERT_EQ(1, runs[2]);
+}
+
+TEST(AutotunerUnitTest, WinnerPersistedToCacheFile)
+{
+  setupCacheFile();
+
+  std::vector<int> runs(2, 0);
+  int* rptr = runs.data();
+
+  auto body = [=](auto tag) {
+    rptr[decltype(tag)::value] += 1;
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 10),
+                                 [=](int RAJA_UNUSED_ARG(i)) {});
+  };
+
+  RAJA::util::autotune("autotuner-test-persist",
+                       camp::list<camp::num<0>, camp::num<1>>{},
+                       body);
+
+  // the cache file holds a well-formed entry for this kernel
+  std::ifstream file(RAJA::util::TuningCache::filePath());
+  ASSERT_TRUE(file.good());
+  std::string name;
+  size_t num_variants, winner;
+  double time;
+  bool found = false;
+  while (file >> name >> num_variants >> winner >> time) {
+    if (name == "autotuner-test-persist") {
+      found = true;
+      ASSERT_EQ(2u, num_variants);
+      ASSERT_LT(winner, 2u);
+    }
+  }
+  ASSERT_TRUE(found);
+}
+
+TEST(AutotunerUnitTest, ChangedCandidateCountRetunes)
+{
+  setupCacheFile();
+
+  std::vector<int> runs(3, 0);
+  int* rptr = runs.data();
+
+  auto body = [=](auto tag) {
+    rptr[decltype(tag)::value] += 1;
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 10),
+                                 [=](int RAJA_UNUSED_ARG(i)) {});
+  };
+
+  RAJA::util::autotune("autotuner-test-grow",
+                       camp::list<camp::num<0>, camp::num<1>>{},
+                       body);
+  ASSERT_EQ(2, runs[0] + runs[1]);
+
+  // growing the candidate set invalidates the cached winner, so the
+  // three-candidate list is benchmarked in full
+  RAJA::util::autotune("autotuner-test-grow",
+                       camp::list<camp::num<0>, camp::num<1>, camp::num<2>>{},
+                       body);
+  ASSERT_LE(1, runs[2]);
+  ASSERT_EQ(5, runs[0] + runs[1] + runs[2]);
+}
@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for CancellationToken and
+/// forall_cancellable
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+TEST(CancellationToken, SharedState)
+{
+  RAJA::CancellationToken token;
+  RAJA::CancellationToken copy = token;
+
+  ASSERT_FALSE(token.canceled());
+  ASSERT_FALSE(copy.canceled());
+
+  copy.cancel();
+  ASSERT_TRUE(token.canceled());
+
+  token.reset();
+  ASSERT_FALSE(copy.canceled());
+}
+
+TEST(CancellationToken, RunsToCompletionWhenNotCanceled)
+{
+  constexpr RAJA::Index_type N = 1000;
+
+  RAJA::CancellationToken token;
+  std::vector<int> data(N, 0);
+  int* dptr = data.data();
+
+  RAJA::Index_type completed = RAJA::forall_cancellable<RAJA::seq_exec>(
+      token, RAJA::TypedRangeSegment<RAJA::Index_type>(0, N),
+      [=](RAJA::Index_type i) { dptr[i] = 1; }, 128);
+
+  ASSERT_EQ(N, completed);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(1, data[i]);
+  }
+}
+
+TEST(CancellationToken, CanceledBeforeStart)
+{
+  RAJA::CancellationToken token;
+  token.cancel();
+
+  RAJA::Index_type completed = RAJA::forall_cancellable<RAJA::seq_exec>(
+      token, RAJA::TypedRangeSegment<RAJA::Index_type>(0, 100),
+      [=](RAJA::Index_type) { FAIL(); });
+
+  ASSERT_EQ(0, completed);
+}
+
+TEST(CancellationToken, StopsAtNextChunkBoundary)
+{
+  constexpr RAJA::Index_type N = 1000;
+  constexpr RAJA::Index_type chunk = 100;
+
+  RAJA::CancellationToken token;
+  std::vector<int> data(N, 0);
+  int* dptr = data.data();
+
+  // cancel mid-chunk; the running chunk completes, then the loop yields
+  RAJA::Index_type completed = RAJA::forall_cancellable<RAJA::seq_exec>(
+      token, RAJA::TypedRangeSegment<RAJA::Index_type>(0, N),
+      [=](RAJA::Index_type i) {
+        if (i == 250) {
+          token.cancel();
+        }
+        dptr[i] = 1;
+      },
+      chunk);
+
+  ASSERT_EQ(300, completed);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(i < 300 ? 1 : 0, data[i]);
+  }
+
+  // resume past the completed prefix after rearming the token
+  token.reset();
+  RAJA::Index_type resumed = RAJA::forall_cancellable<RAJA::seq_exec>(
+      token, RAJA::TypedRangeSegment<RAJA::Index_type>(completed, N),
+      [=](RAJA::Index_type i) { dptr[i] = 1; }, chunk);
+
+  ASSERT_EQ(N - completed, resumed);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(1, data[i]);
+  }
+}
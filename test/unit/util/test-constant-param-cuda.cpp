@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for constant-memory parameter binding
+///
+
+#include "RAJA_test-base.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+struct EosTable {
+  double gamma[4];
+  double pcut;
+};
+
+TEST(ConstantParamUnitTest, ReserveOffsets)
+{
+  // reservations hand out aligned, non-overlapping offsets
+  auto c = RAJA::cuda::reserve_constant_param<char>();
+  auto d = RAJA::cuda::reserve_constant_param<double>();
+  auto t = RAJA::cuda::reserve_constant_param<EosTable>();
+
+  ASSERT_EQ(d.offset % alignof(double), size_t(0));
+  ASSERT_EQ(t.offset % alignof(EosTable), size_t(0));
+  ASSERT_GE(d.offset, c.offset + sizeof(char));
+  ASSERT_GE(t.offset, d.offset + sizeof(double));
+}
+
+TEST(ConstantParamUnitTest, BindAndRead)
+{
+  static auto slot = RAJA::cuda::reserve_constant_param<EosTable>();
+
+  EosTable table;
+  for (int m = 0; m < 4; ++m) {
+    table.gamma[m] = 1.0 + 0.1 * m;
+  }
+  table.pcut = 1.0e-8;
+  RAJA::cuda::bind_constant_param(slot, table);
+
+  const int N = 256;
+  double* out = nullptr;
+  cudaErrchk(cudaMallocManaged(&out, N * sizeof(double)));
+
+  RAJA::forall<RAJA::cuda_exec<128>>(
+      RAJA::RangeSegment(0, N),
+      [=] RAJA_DEVICE (RAJA::Index_type i) {
+        const EosTable& eos = slot.get();
+        out[i] = eos.gamma[i % 4] + eos.pcut;
+      });
+  cudaErrchk(cudaDeviceSynchronize());
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(out[i], 1.0 + 0.1 * (i % 4) + 1.0e-8);
+  }
+
+  // re-binding between launches takes effect on the next launch
+  table.pcut = 0.5;
+  RAJA::cuda::bind_constant_param(slot, table);
+
+  RAJA::forall<RAJA::cuda_exec<128>>(
+      RAJA::RangeSegment(0, N),
+      [=] RAJA_DEVICE (RAJA::Index_type i) {
+        out[i] = slot.get().pcut;
+      });
+  cudaErrchk(cudaDeviceSynchronize());
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(out[i], 0.5);
+  }
+
+  cudaErrchk(cudaFree(out));
+}
+
+#endif
@@ -0,0 +1,70 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the per-kernel fast-math
+/// annotation markers and the approximate math functions
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <vector>
+
+//
+// A kernel bracketed by the fast-math markers must compile and produce
+// a result close to the precise one; the markers attach relaxed options
+// to the lambda, so the bracketed function is defined at file scope.
+//
+RAJA_FASTMATH_BEGIN
+static double sumScaledFast(const double* data, int len)
+{
+  RAJA::ReduceSum<RAJA::seq_reduce, double> sum(0.0);
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+                                 sum += data[i] / 3.0 + 2.0 * data[i];
+                               });
+  return sum.get();
+}
+RAJA_FASTMATH_END
+
+TEST(FastmathUnitTest, MarkedKernelMatchesPrecise)
+{
+  const int len = 1000;
+  std::vector<double> data(len);
+  for (int i = 0; i < len; ++i) {
+    data[i] = 0.001 * i - 0.3;
+  }
+
+  double expected = 0.0;
+  for (int i = 0; i < len; ++i) {
+    expected += data[i] / 3.0 + 2.0 * data[i];
+  }
+
+  ASSERT_NEAR(sumScaledFast(data.data(), len), expected,
+              1.0e-9 * std::abs(expected) + 1.0e-12);
+}
+
+TEST(FastmathUnitTest, ApproximateOperations)
+{
+  // host fallbacks are the precise operations
+  ASSERT_DOUBLE_EQ(RAJA::fastmath::div(1.0, 8.0), 0.125);
+  ASSERT_DOUBLE_EQ(RAJA::fastmath::rcp(4.0), 0.25);
+  ASSERT_DOUBLE_EQ(RAJA::fastmath::rsqrt(16.0), 0.25);
+  ASSERT_DOUBLE_EQ(RAJA::fastmath::exp(0.0), 1.0);
+  ASSERT_DOUBLE_EQ(RAJA::fastmath::log(1.0), 0.0);
+  ASSERT_DOUBLE_EQ(RAJA::fastmath::pow(2.0, 10.0), 1024.0);
+  ASSERT_DOUBLE_EQ(RAJA::fastmath::sin(0.0), 0.0);
+  ASSERT_DOUBLE_EQ(RAJA::fastmath::cos(0.0), 1.0);
+  ASSERT_DOUBLE_EQ(RAJA::fastmath::fma(2.0, 3.0, 1.0), 7.0);
+
+  ASSERT_FLOAT_EQ(RAJA::fastmath::div(1.0f, 8.0f), 0.125f);
+  ASSERT_FLOAT_EQ(RAJA::fastmath::rcp(4.0f), 0.25f);
+  ASSERT_FLOAT_EQ(RAJA::fastmath::fma(2.0f, 3.0f, 1.0f), 7.0f);
+}
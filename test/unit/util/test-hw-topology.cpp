@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the host cache-topology probe
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+TEST(HwTopologyUnitTest, ProbeIsSaneAndStable)
+{
+  RAJA::HwTopology const& topo = RAJA::hw_topology();
+
+  ASSERT_GE(topo.num_logical_cpus, 1);
+
+  for (int level = 1; level <= RAJA::HwTopology::max_cache_levels; ++level) {
+    RAJA::CacheLevel const& cache = topo.data_cache(level);
+    ASSERT_EQ(cache.level, level);
+    ASSERT_GT(cache.size, 0u);
+    ASSERT_GE(cache.line_size, 16u);
+    ASSERT_GE(cache.sharing, 1);
+  }
+
+  // out-of-range levels clamp rather than index past the hierarchy
+  ASSERT_EQ(&topo.data_cache(0), &topo.data_cache(1));
+  ASSERT_EQ(&topo.data_cache(99),
+            &topo.data_cache(RAJA::HwTopology::max_cache_levels));
+
+  // the probe runs once; later calls see the same description
+  ASSERT_EQ(&topo, &RAJA::hw_topology());
+}
+
+TEST(HwTopologyUnitTest, CacheTileSizeFitsBudget)
+{
+  for (int level = 1; level <= RAJA::HwTopology::max_cache_levels; ++level) {
+    RAJA::CacheLevel const& cache = RAJA::hw_topology().data_cache(level);
+
+    RAJA::TileSize tile = RAJA::cache_tile_size(3 * sizeof(double), level);
+    ASSERT_GE(tile.size, 1);
+
+    // the tile's working set stays within its share of one instance
+    ASSERT_LE(static_cast<size_t>(tile.size) * 3 * sizeof(double),
+              cache.size / static_cast<size_t>(cache.sharing));
+  }
+
+  // a degenerate per-iterate size still yields a usable tile
+  ASSERT_GE(RAJA::cache_tile_size(0).size, 1);
+}
+
+TEST(HwTopologyUnitTest, CacheTileSizeDrivesDynamicTile)
+{
+  const RAJA::Index_type N = 10000;
+
+  std::vector<int> count(N, 0);
+  int* cptr = count.data();
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Tile<0, RAJA::tile_dynamic<0>, RAJA::seq_exec,
+          RAJA::statement::For<0, RAJA::seq_exec,
+              RAJA::statement::Lambda<0, RAJA::Segs<0>>>>>;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+      RAJA::make_tuple(RAJA::cache_tile_size(sizeof(int))),
+      [=](RAJA::Index_type i) { cptr[i] += 1; });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(count[i], 1);
+  }
+}
@@ -0,0 +1,67 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for kernel resource-usage recording
+///
+
+#include "RAJA_test-base.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+TEST(KernelResourceUsageUnitTest, RecordedAtFirstLaunch)
+{
+  const int N = 256;
+  double* a = nullptr;
+  cudaErrchk(cudaMallocManaged(&a, N * sizeof(double)));
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::CudaKernelAsync<
+          RAJA::statement::For<0, RAJA::cuda_thread_x_loop,
+                               RAJA::statement::Lambda<0>>>>;
+
+  // one call site so repeat launches hit the same generated kernel
+  auto do_launch = [=]() {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+                      [=] RAJA_DEVICE (RAJA::Index_type i) {
+                        a[i] = 2.0 * i;
+                      });
+  };
+
+  do_launch();
+  cudaErrchk(cudaDeviceSynchronize());
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], 2.0 * i);
+  }
+
+  auto usage = RAJA::cuda::kernel_resource_usage();
+  ASSERT_FALSE(usage.empty());
+
+  // every recorded kernel carries a real footprint within the
+  // parameter-space limit
+  bool found = false;
+  for (auto const& u : usage) {
+    ASSERT_NE(nullptr, u.func);
+    ASSERT_GT(u.param_bytes, 0u);
+    ASSERT_LE(u.param_bytes, RAJA::cuda::kernel_param_space_limit);
+    if (u.num_regs > 0 && u.max_threads_per_block > 0) {
+      found = true;
+    }
+  }
+  ASSERT_TRUE(found);
+
+  // relaunching the same generated kernel does not add an entry
+  size_t num_kernels = usage.size();
+  do_launch();
+  cudaErrchk(cudaDeviceSynchronize());
+  ASSERT_EQ(num_kernels, RAJA::cuda::kernel_resource_usage().size());
+
+  cudaErrchk(cudaFree(a));
+}
+
+#endif
@@ -0,0 +1,55 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA managed span
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+TEST(ManagedSpan, basic_accessors)
+{
+  std::vector<int> data(10);
+  for (int i = 0; i < 10; ++i) {
+    data[i] = 2 * i;
+  }
+
+  auto span = RAJA::make_managed_span(data.data(), 10);
+
+  ASSERT_EQ(span.size(), 10);
+  ASSERT_FALSE(span.empty());
+  ASSERT_EQ(span.data(), data.data());
+  ASSERT_EQ(span.front(), 0);
+  ASSERT_EQ(span.back(), 18);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(span[i], 2 * i);
+  }
+
+  // heap memory is not a managed allocation; prefetching must be a no-op
+  ASSERT_FALSE(span.managed());
+  span.prefetch(RAJA::Platform::host);
+  span.read_mostly();
+}
+
+TEST(ManagedSpan, capture_into_forall)
+{
+  std::vector<int> data(100, 0);
+  auto span = RAJA::make_managed_span(data.data(), 100);
+
+  // capturing the span copies it between the preCapture/postCapture
+  // plugin hooks; for non-managed memory this must leave the view intact
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                               [=](RAJA::Index_type i) { span[i] = 1; });
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(data[i], 1);
+  }
+}
@@ -0,0 +1,62 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for huge-page-backed mempool arenas
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdint>
+
+using hugepage_pool =
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::hugepage_allocator>;
+
+TEST(MemPoolHugepageUnitTest, AllocateWriteFree)
+{
+  // whether the pages end up huge depends on the host configuration;
+  // the pool contract -- usable, writable, reclaimable memory -- must
+  // hold regardless
+  hugepage_pool pool;
+
+  const size_t n = 1024 * 1024;
+  double* a = pool.malloc<double>(n);
+  ASSERT_NE(nullptr, a);
+
+  for (size_t i = 0; i < n; i += 4096 / sizeof(double)) {
+    a[i] = static_cast<double>(i);
+  }
+  for (size_t i = 0; i < n; i += 4096 / sizeof(double)) {
+    ASSERT_EQ(static_cast<double>(i), a[i]);
+  }
+
+  pool.free(a);
+  pool.free_chunks();
+}
+
+TEST(MemPoolHugepageUnitTest, ArenaRoundedToHugepages)
+{
+  using alloc_t = RAJA::basic_mempool::hugepage_allocator;
+
+  const size_t arena_bytes = alloc_t::hugepage_size;
+
+  hugepage_pool pool;
+  pool.arena_size(arena_bytes);
+
+  // several blocks must fit the first arena without growing the pool
+  char* p1 = pool.malloc<char>(512 * 1024);
+  char* p2 = pool.malloc<char>(512 * 1024);
+  ASSERT_NE(nullptr, p1);
+  ASSERT_NE(nullptr, p2);
+  ASSERT_EQ(1u, pool.statistics().arena_count);
+
+  pool.free(p1);
+  pool.free(p2);
+  pool.free_chunks();
+}
@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Unit tests for basic_mempool statistics and trimming.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdlib>
+
+// counting allocator so the tests get their own pool singleton and can
+// observe arena allocations coming and going
+struct CountingAllocator {
+
+  static int arena_allocs;
+
+  void* malloc(size_t nbytes)
+  {
+    ++arena_allocs;
+    return std::malloc(nbytes);
+  }
+
+  bool free(void* ptr)
+  {
+    --arena_allocs;
+    std::free(ptr);
+    return true;
+  }
+};
+
+int CountingAllocator::arena_allocs = 0;
+
+using pool_type = RAJA::basic_mempool::MemPool<CountingAllocator>;
+
+TEST(MemPoolStatsUnitTest, StatisticsAndTrim)
+{
+  pool_type& pool = pool_type::getInstance();
+
+  double* a = pool.malloc<double>(100);
+  int* b = pool.malloc<int>(10);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+
+  RAJA::basic_mempool::PoolStatistics stats = pool.statistics();
+
+  const size_t live_bytes = 100 * sizeof(double) + 10 * sizeof(int);
+  ASSERT_EQ(stats.arena_count, 1u);
+  ASSERT_EQ(stats.used_bytes, live_bytes);
+  ASSERT_GE(stats.high_watermark_bytes, live_bytes);
+  ASSERT_GE(stats.capacity_bytes, stats.used_bytes);
+  ASSERT_EQ(stats.size_histogram[100 * sizeof(double)], 1u);
+  ASSERT_EQ(stats.size_histogram[10 * sizeof(int)], 1u);
+  ASSERT_GE(stats.fragmentation_ratio, 0.0);
+  ASSERT_LE(stats.fragmentation_ratio, 1.0);
+
+  pool.free(a);
+  pool.free(b);
+
+  // freed blocks sit in the thread cache, so their arena stays pinned
+  stats = pool.statistics();
+  ASSERT_EQ(stats.used_bytes, live_bytes);
+
+  // release_unused flushes the cache and frees the now-empty arena
+  pool.release_unused();
+
+  stats = pool.statistics();
+  ASSERT_EQ(stats.used_bytes, 0u);
+  ASSERT_EQ(stats.arena_count, 0u);
+  ASSERT_TRUE(stats.size_histogram.empty());
+  ASSERT_EQ(CountingAllocator::arena_allocs, 0);
+
+  // the high watermark survives the trim
+  ASSERT_GE(stats.high_watermark_bytes, live_bytes);
+}
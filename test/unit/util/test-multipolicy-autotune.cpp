@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the MultiPolicy auto-tuning selector
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+TEST(MultiPolicyAutoTune, SamplingCyclesThenLocksIn)
+{
+  constexpr size_t num_policies = 3;
+  constexpr size_t num_samples = 2;
+
+  RAJA::AutoTuningSelector<num_policies> selector(num_samples);
+
+  RAJA::TypedRangeSegment<int> seg(0, 10);
+
+  // Sampling phase: the selector cycles through the candidates, and each
+  // invocation is followed by a timing update.
+  for (size_t n = 0; n < num_policies * num_samples; ++n) {
+    size_t index = selector(seg);
+    ASSERT_EQ(n % num_policies, index);
+    // report policy 1 as fastest
+    selector.update(index, (index == 1) ? 1.0 : 2.0 + index);
+  }
+
+  // Locked in: the fastest policy is selected from now on.
+  for (size_t n = 0; n < 10; ++n) {
+    ASSERT_EQ(1u, selector(seg));
+  }
+}
+
+TEST(MultiPolicyAutoTune, ForallConverges)
+{
+  constexpr int len = 100;
+
+  auto mp = RAJA::make_auto_tuning_multi_policy<RAJA::seq_exec,
+                                                RAJA::loop_exec>();
+
+  std::vector<int> data(len, 0);
+  int* dptr = data.data();
+
+  // After sampling, every iteration must still be executed exactly once
+  // per forall regardless of which policy was locked in.
+  constexpr int num_launches = 10;
+  for (int launch = 0; launch < num_launches; ++launch) {
+    RAJA::forall(mp, RAJA::TypedRangeSegment<int>(0, len), [=](int i) {
+      dptr[i] += 1;
+    });
+  }
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(num_launches, data[i]);
+  }
+}
@@ -12,13 +12,18 @@
 #include "RAJA_test-base.hpp"
 #include "RAJA_unit-test-types.hpp"
 
+#include <cmath>
+
 template<typename T>
 class OperatorsUnitTest : public ::testing::Test {};
 template<typename T>
 class OperatorsIntegralUnitTest : public ::testing::Test {};
+template<typename T>
+class OperatorsMathUnitTest : public ::testing::Test {};
 
 TYPED_TEST_SUITE(OperatorsUnitTest, UnitIntFloatTypes);
 TYPED_TEST_SUITE(OperatorsIntegralUnitTest, UnitExpandedIntegralTypes);
+TYPED_TEST_SUITE(OperatorsMathUnitTest, UnitFloatTypes);
 
 template<typename T>
 void plus_test()
@@ -463,6 +468,53 @@ TYPED_TEST(OperatorsUnitTest, less) { less_test<TypeParam>(); }
 TYPED_TEST(OperatorsUnitTest, greater_eq) { greater_eq_test<TypeParam>(); }
 TYPED_TEST(OperatorsUnitTest, less_eq) { less_eq_test<TypeParam>(); }
 
+template<typename T>
+void exp_test()
+{
+  using Exp = RAJA::operators::exp<T>;
+
+  Exp e;
+  ASSERT_EQ(e(T(0)), T(1));
+  ASSERT_FLOAT_EQ(static_cast<float>(e(T(1))),
+                  static_cast<float>(std::exp(T(1))));
+}
+
+template<typename T>
+void log_test()
+{
+  using Log = RAJA::operators::log<T>;
+
+  Log l;
+  ASSERT_EQ(l(T(1)), T(0));
+  ASSERT_FLOAT_EQ(static_cast<float>(l(std::exp(T(1)))),
+                  static_cast<float>(T(1)));
+}
+
+template<typename T>
+void sqrt_test()
+{
+  using Sqrt = RAJA::operators::sqrt<T>;
+
+  Sqrt s;
+  ASSERT_EQ(s(T(4)), T(2));
+  ASSERT_EQ(s(T(0)), T(0));
+}
+
+template<typename T>
+void pow_test()
+{
+  using Pow = RAJA::operators::pow<T>;
+
+  Pow p;
+  ASSERT_EQ(p(T(2), T(3)), T(8));
+  ASSERT_EQ(p(T(5), T(0)), T(1));
+}
+
 TYPED_TEST(OperatorsUnitTest, identity) { identity_test<TypeParam>(); }
 TYPED_TEST(OperatorsUnitTest, project1st) { project1st_test<TypeParam>(); }
 TYPED_TEST(OperatorsUnitTest, project2nd) { project2nd_test<TypeParam>(); }
+
+TYPED_TEST(OperatorsMathUnitTest, exp) { exp_test<TypeParam>(); }
+TYPED_TEST(OperatorsMathUnitTest, log) { log_test<TypeParam>(); }
+TYPED_TEST(OperatorsMathUnitTest, sqrt) { sqrt_test<TypeParam>(); }
+TYPED_TEST(OperatorsMathUnitTest, pow) { pow_test<TypeParam>(); }
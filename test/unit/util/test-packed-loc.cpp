@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for packed value+location keys
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+TEST(PackedLocUnitTest, KeyOrderingMatchesValueOrdering)
+{
+  using P = RAJA::PackedMinLoc<float>;
+
+  const float ordered[] = {-std::numeric_limits<float>::infinity(),
+                           -1.0e30f, -3.5f, -1.0f, 0.0f, 1.0e-30f,
+                           1.0f, 3.5f, 1.0e30f,
+                           std::numeric_limits<float>::infinity()};
+
+  for (size_t i = 0; i + 1 < sizeof(ordered) / sizeof(ordered[0]); ++i) {
+    ASSERT_LT(P::pack(ordered[i], 0), P::pack(ordered[i + 1], 0));
+    ASSERT_EQ(P::value(P::pack(ordered[i], 7)), ordered[i]);
+    ASSERT_EQ(P::loc(P::pack(ordered[i], 7)), 7u);
+  }
+
+  // among equal values the smaller location makes the smaller min key
+  ASSERT_LT(P::pack(2.0f, 3), P::pack(2.0f, 4));
+
+  using I = RAJA::PackedMinLoc<int32_t>;
+  ASSERT_LT(I::pack(-5, 0), I::pack(3, 0));
+  ASSERT_EQ(I::value(I::pack(-5, 9)), -5);
+  ASSERT_EQ(I::loc(I::pack(-5, 9)), 9u);
+}
+
+TEST(PackedLocUnitTest, MinLocMatchesStructReducer)
+{
+  using P = RAJA::PackedMinLoc<float>;
+
+  const int len = 5000;
+  std::mt19937 rng(4242);
+  std::uniform_int_distribution<int> values(-1000, 1000);
+
+  std::vector<float> data(len);
+  for (auto& v : data) {
+    v = 0.25f * values(rng);
+  }
+  const float* ptr = data.data();
+
+  RAJA::ReduceMin<RAJA::seq_reduce, P::key_type> packed(P::identity());
+  RAJA::ReduceMinLoc<RAJA::seq_reduce, float> ref(
+      std::numeric_limits<float>::max());
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+                                 packed.min(
+                                     P::pack(ptr[i],
+                                             static_cast<uint32_t>(i)));
+                                 ref.minloc(ptr[i], i);
+                               });
+
+  ASSERT_EQ(P::value(packed.get()), ref.get());
+  ASSERT_EQ(P::value(packed.get()),
+            *std::min_element(data.begin(), data.end()));
+  // the packed key resolves ties toward the smallest location
+  ASSERT_EQ(P::loc(packed.get()),
+            static_cast<uint32_t>(
+                std::min_element(data.begin(), data.end()) - data.begin()));
+}
+
+TEST(PackedLocUnitTest, MaxLocTieBreaksTowardSmallestLocation)
+{
+  using P = RAJA::PackedMaxLoc<float>;
+
+  const int len = 1000;
+  std::vector<float> data(len, 1.0f);
+  data[200] = 5.0f;
+  data[600] = 5.0f;
+  const float* ptr = data.data();
+
+  RAJA::ReduceMax<RAJA::seq_reduce, P::key_type> packed(P::identity());
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+                                 packed.max(
+                                     P::pack(ptr[i],
+                                             static_cast<uint32_t>(i)));
+                               });
+
+  ASSERT_EQ(P::value(packed.get()), 5.0f);
+  ASSERT_EQ(P::loc(packed.get()), 200u);
+}
@@ -0,0 +1,75 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for device-side parameter blocks
+///
+
+#include "RAJA_test-base.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+struct ColdState {
+  double* corners[8];
+  double scale;
+  int offset;
+};
+
+TEST(ParamBlockUnitTest, UploadAndRead)
+{
+  const int N = 256;
+  double* corner = nullptr;
+  double* out = nullptr;
+  cudaErrchk(cudaMallocManaged(&corner, N * sizeof(double)));
+  cudaErrchk(cudaMallocManaged(&out, N * sizeof(double)));
+  for (int i = 0; i < N; ++i) {
+    corner[i] = 0.25 * i;
+  }
+
+  ColdState cold;
+  for (int c = 0; c < 8; ++c) {
+    cold.corners[c] = corner;
+  }
+  cold.scale = 2.0;
+  cold.offset = 3;
+  auto block = RAJA::cuda::make_param_block(cold);
+
+  // the lambda captures the one-pointer handle, not the cold struct
+  RAJA::forall<RAJA::cuda_exec<128>>(
+      RAJA::RangeSegment(0, N),
+      [=] RAJA_DEVICE (RAJA::Index_type i) {
+        const ColdState& c = block.get();
+        out[i] = c.scale * c.corners[i % 8][i] + c.offset;
+      });
+  cudaErrchk(cudaDeviceSynchronize());
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(out[i], 2.0 * (0.25 * i) + 3.0);
+  }
+
+  // refreshing the block between launches takes effect on the next one
+  cold.scale = -1.0;
+  cold.offset = 0;
+  RAJA::cuda::update_param_block(block, cold);
+
+  RAJA::forall<RAJA::cuda_exec<128>>(
+      RAJA::RangeSegment(0, N),
+      [=] RAJA_DEVICE (RAJA::Index_type i) {
+        out[i] = block->scale * block->corners[0][i] + block->offset;
+      });
+  cudaErrchk(cudaDeviceSynchronize());
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(out[i], -0.25 * i);
+  }
+
+  RAJA::cuda::destroy_param_block(block);
+  cudaErrchk(cudaFree(out));
+  cudaErrchk(cudaFree(corner));
+}
+
+#endif
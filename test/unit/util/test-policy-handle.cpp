@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the runtime PolicyHandle
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+TEST(PolicyHandle, ForallDispatch)
+{
+  constexpr int len = 100;
+
+  std::vector<int> data(len, 0);
+  int* dptr = data.data();
+
+  // The same call site must run correctly under any handle.
+  for (auto backend : {RAJA::PolicyHandle::Backend::Sequential,
+                       RAJA::PolicyHandle::Backend::Loop,
+                       RAJA::PolicyHandle::Backend::Simd}) {
+    RAJA::PolicyHandle handle(backend);
+    RAJA::forall(handle, RAJA::TypedRangeSegment<int>(0, len), [=](int i) {
+      dptr[i] += 1;
+    });
+  }
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(3, data[i]);
+  }
+}
+
+TEST(PolicyHandle, NameRegistry)
+{
+  ASSERT_FALSE(RAJA::PolicyHandle::is_registered("mylib.assembly"));
+  ASSERT_THROW(RAJA::PolicyHandle::lookup("mylib.assembly"),
+               std::runtime_error);
+
+  RAJA::PolicyHandle::register_name(
+      "mylib.assembly", RAJA::PolicyHandle(RAJA::PolicyHandle::Backend::Loop));
+
+  ASSERT_TRUE(RAJA::PolicyHandle::is_registered("mylib.assembly"));
+  RAJA::PolicyHandle handle = RAJA::PolicyHandle::lookup("mylib.assembly");
+  ASSERT_EQ(RAJA::PolicyHandle::Backend::Loop, handle.backend);
+
+  // Re-registration replaces the previous binding.
+  RAJA::PolicyHandle::register_name(
+      "mylib.assembly",
+      RAJA::PolicyHandle(RAJA::PolicyHandle::Backend::Sequential));
+  ASSERT_EQ(RAJA::PolicyHandle::Backend::Sequential,
+            RAJA::PolicyHandle::lookup("mylib.assembly").backend);
+
+  constexpr int len = 50;
+  std::vector<int> data(len, 0);
+  int* dptr = data.data();
+
+  RAJA::forall(RAJA::PolicyHandle::lookup("mylib.assembly"),
+               RAJA::TypedRangeSegment<int>(0, len),
+               [=](int i) { dptr[i] = i; });
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(i, data[i]);
+  }
+}
+
+#if !defined(RAJA_ENABLE_TBB)
+TEST(PolicyHandle, UnavailableBackendThrows)
+{
+  RAJA::PolicyHandle handle(RAJA::PolicyHandle::Backend::TBB);
+  ASSERT_THROW(RAJA::forall(handle,
+                            RAJA::TypedRangeSegment<int>(0, 10),
+                            [=](int) {}),
+               std::runtime_error);
+}
+#endif
@@ -0,0 +1,84 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Unit tests for view snapshots and the resilient forall wrappers.
+///
+/// The fault injection path needs the external signal handler machinery, so
+/// these tests cover the always-available behavior: snapshots capture and
+/// restore view data, and both resilient_forall overloads execute the loop
+/// exactly once when no fault is reported.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <numeric>
+#include <vector>
+
+#if defined(RAJA_ENABLE_FT)
+// fault state consumed by the resilient_forall retry loops; a real
+// application sets this from a signal handler
+volatile int fault_type = 0;
+#endif
+
+TEST(ResilienceUnitTest, SnapshotRestore)
+{
+  constexpr int N = 24;
+
+  std::vector<double> data(N);
+  std::iota(data.begin(), data.end(), 0.0);
+
+  RAJA::View<double, RAJA::Layout<2>> view(data.data(), 4, 6);
+
+  auto snapshot = RAJA::ft::make_snapshot(view);
+  ASSERT_EQ(snapshot.size(), size_t(N));
+
+  for (int i = 0; i < N; ++i) {
+    data[i] = -1.0;
+  }
+
+  snapshot.restore();
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(data[i], double(i));
+  }
+}
+
+TEST(ResilienceUnitTest, IdempotentForall)
+{
+  constexpr int N = 100;
+
+  std::vector<int> x(N, 0);
+  int* x_ptr = x.data();
+
+  RAJA::ft::resilient_forall<RAJA::seq_exec>(
+      RAJA::RangeSegment(0, N),
+      RAJA::ft::idempotent{},
+      [=](RAJA::Index_type i) { x_ptr[i] = static_cast<int>(i); });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(x[i], i);
+  }
+}
+
+TEST(ResilienceUnitTest, SnapshottedForall)
+{
+  constexpr int N = 100;
+
+  std::vector<int> x(N, 1);
+  RAJA::View<int, RAJA::Layout<1>> x_view(x.data(), N);
+
+  // read-modify-write body, so the view is named for snapshotting
+  RAJA::ft::resilient_forall<RAJA::seq_exec>(
+      RAJA::RangeSegment(0, N),
+      [=](RAJA::Index_type i) { x_view(i) += static_cast<int>(i); },
+      x_view);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(x[i], 1 + i);
+  }
+}
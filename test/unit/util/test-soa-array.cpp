@@ -0,0 +1,72 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Unit tests for the SoAArray struct-of-arrays container.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdint>
+
+using Particle = camp::tuple<double, double, int>;
+
+TEST(SoAArrayUnitTest, RecordAccess)
+{
+  constexpr size_t N = 37;
+
+  RAJA::SoAArray<Particle> particles(N);
+  ASSERT_TRUE(particles.allocated());
+  ASSERT_EQ(particles.size(), N);
+
+  for (size_t i = 0; i < N; ++i) {
+    particles(i) = Particle(double(i), 2.0 * double(i), int(i % 3));
+  }
+
+  for (size_t i = 0; i < N; ++i) {
+    Particle p = particles(i);
+    ASSERT_EQ(camp::get<0>(p), double(i));
+    ASSERT_EQ(camp::get<1>(p), 2.0 * double(i));
+    ASSERT_EQ(camp::get<2>(p), int(i % 3));
+  }
+
+  particles.deallocate();
+  ASSERT_FALSE(particles.allocated());
+}
+
+TEST(SoAArrayUnitTest, MemberAccess)
+{
+  constexpr size_t N = 16;
+
+  RAJA::SoAArray<Particle> particles;
+  particles.allocate(N);
+
+  for (size_t i = 0; i < N; ++i) {
+    particles.set(i, Particle(0.0, double(i), 0));
+  }
+
+  // single-member updates through the proxy and by index
+  for (size_t i = 0; i < N; ++i) {
+    particles(i).member<0>() = 10.0 + double(i);
+    particles.member<2>(i) = int(i);
+  }
+
+  // member streams are contiguous and see the updates
+  double* x = particles.member_data<0>();
+  double* v = particles.member_data<1>();
+  for (size_t i = 0; i < N; ++i) {
+    ASSERT_EQ(x[i], 10.0 + double(i));
+    ASSERT_EQ(v[i], double(i));
+    ASSERT_EQ(particles.member<2>(i), int(i));
+  }
+
+  // member streams start DATA_ALIGN aligned
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(x) % RAJA::DATA_ALIGN, 0u);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v) % RAJA::DATA_ALIGN, 0u);
+
+  particles.deallocate();
+}
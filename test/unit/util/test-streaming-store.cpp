@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for streaming (cache-bypass) stores
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(StreamingStoreUnitTest, stream_store)
+{
+  double d = 0.0;
+  RAJA::stream_store(&d, 3.5);
+  ASSERT_EQ(3.5, d);
+
+  int i = 0;
+  RAJA::stream_store(&i, 42);
+  ASSERT_EQ(42, i);
+
+  // type without a streaming form falls back to a plain store
+  bool b = false;
+  RAJA::stream_store(&b, true);
+  ASSERT_TRUE(b);
+}
+
+TEST(StreamingStoreUnitTest, streaming_view_saxpy)
+{
+  constexpr RAJA::Index_type N = 1000;
+
+  std::vector<double> x(N), y(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    x[i] = static_cast<double>(i);
+    y[i] = 2.0;
+  }
+
+  RAJA::View<double, RAJA::Layout<1>> xview(x.data(), N);
+  RAJA::View<double, RAJA::Layout<1>> yview(y.data(), N);
+
+  const double a = 3.0;
+
+  RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, N),
+                                [=](RAJA::Index_type i) {
+                                  RAJA::streaming(yview(i)) =
+                                      a * xview(i) + yview(i);
+                                });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(a * static_cast<double>(i) + 2.0, y[i]);
+  }
+}
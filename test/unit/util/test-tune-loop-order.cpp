@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the loop-interchange tuning harness
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+const char* cache_file = "test-tune-loop-order.cache";
+
+//! route the tuning cache to a test-local file; must happen before the
+//  first autotune call in the process
+void setupCacheFile()
+{
+  setenv("RAJA_TUNING_CACHE", cache_file, 1);
+}
+
+}  // namespace
+
+TEST(TuneLoopOrderUnitTest, AllPermutationsEnumerated)
+{
+  static_assert(camp::size<RAJA::all_permutations<1>>::value == 1,
+                "1! permutations of one index");
+  static_assert(camp::size<RAJA::all_permutations<2>>::value == 2,
+                "2! permutations of two indices");
+  static_assert(camp::size<RAJA::all_permutations<3>>::value == 6,
+                "3! permutations of three indices");
+  static_assert(camp::size<RAJA::all_permutations<4>>::value == 24,
+                "4! permutations of four indices");
+
+  // identity first, matching the written nesting order
+  static_assert(
+      std::is_same<camp::at_v<RAJA::all_permutations<3>, 0>,
+                   RAJA::PERM_IJK>::value,
+      "identity permutation comes first");
+}
+
+TEST(TuneLoopOrderUnitTest, LoopOrderPolicyNesting)
+{
+  using Pol = RAJA::util::loop_order_policy<RAJA::PERM_JI, RAJA::seq_exec>;
+  using Expected = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>>>>;
+  static_assert(std::is_same<Pol, Expected>::value,
+                "permutation is outermost-first");
+}
+
+TEST(TuneLoopOrderUnitTest, TuningRunCoversEveryOrder)
+{
+  setupCacheFile();
+  std::remove(cache_file);
+
+  constexpr int NI = 10;
+  constexpr int NJ = 15;
+  constexpr int NK = 4;
+
+  std::vector<int> counts(NI * NJ * NK, 0);
+  int* cptr = counts.data();
+
+  auto segs = RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, NI),
+                               RAJA::TypedRangeSegment<int>(0, NJ),
+                               RAJA::TypedRangeSegment<int>(0, NK));
+
+  // first call benchmarks all 3! orders, so every element is visited
+  // once per order
+  RAJA::util::kernel_tune_order("tune-order-test", segs,
+                                [=](int i, int j, int k) {
+    cptr[(i * NJ + j) * NK + k] += 1;
+  });
+
+  for (int e = 0; e < NI * NJ * NK; ++e) {
+    ASSERT_EQ(6, counts[e]);
+  }
+
+  // subsequent calls dispatch straight to the cached winner
+  RAJA::util::kernel_tune_order("tune-order-test", segs,
+                                [=](int i, int j, int k) {
+    cptr[(i * NJ + j) * NK + k] += 1;
+  });
+
+  for (int e = 0; e < NI * NJ * NK; ++e) {
+    ASSERT_EQ(7, counts[e]);
+  }
+}
@@ -0,0 +1,71 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for zip_span
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(ZipSpanUnitTest, ContainerForall)
+{
+  constexpr int N = 100;
+  std::vector<double> x(N);
+  std::vector<double> y(N);
+  std::vector<double> z(N, 0.0);
+  for (int i = 0; i < N; ++i) {
+    x[i] = double(i);
+    y[i] = double(2 * i);
+  }
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::zip_span(x, y, z), [=](auto r) {
+    RAJA::get<2>(r) = RAJA::get<0>(r) + RAJA::get<1>(r);
+  });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(z[i], double(3 * i));
+  }
+}
+
+TEST(ZipSpanUnitTest, PointerForallSimd)
+{
+  constexpr int N = 100;
+  std::vector<double> x(N);
+  std::vector<double> y(N);
+  std::vector<double> z(N, 0.0);
+  for (int i = 0; i < N; ++i) {
+    x[i] = double(i);
+    y[i] = double(i + 1);
+  }
+
+  RAJA::forall<RAJA::simd_exec>(
+      RAJA::zip_span(N, x.data(), y.data(), z.data()), [=](auto r) {
+        RAJA::get<2>(r) = RAJA::get<0>(r) * RAJA::get<1>(r);
+      });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(z[i], double(i) * double(i + 1));
+  }
+}
+
+TEST(ZipSpanUnitTest, SpanProperties)
+{
+  constexpr int N = 10;
+  std::vector<int> a(N, 1);
+  std::vector<int> b(N, 2);
+
+  auto span = RAJA::zip_span(a, b);
+  ASSERT_EQ(span.size(), N);
+  ASSERT_FALSE(span.empty());
+
+  auto it = span.begin();
+  ASSERT_EQ(RAJA::get<0>(*it), 1);
+  ASSERT_EQ(RAJA::get<1>(*it), 2);
+  ASSERT_EQ(span.end() - span.begin(), N);
+}
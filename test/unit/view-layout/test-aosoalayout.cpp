@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+/*
+ * Basic AoSoA layout tests
+ */
+
+TEST(AoSoALayoutUnitTest, TiledIndexing)
+{
+  using my_layout = RAJA::AoSoALayout<4>;
+
+  constexpr int num_elements = 10;
+  constexpr int num_components = 3;
+
+  const my_layout layout(num_elements, num_components);
+
+  /*
+   * Within a tile, elements of one component are unit stride.
+   */
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(1, 0));
+  ASSERT_EQ(2, layout(2, 0));
+  ASSERT_EQ(3, layout(3, 0));
+
+  /*
+   * Components within a tile are separated by the tile size.
+   */
+  ASSERT_EQ(4, layout(0, 1));
+  ASSERT_EQ(8, layout(0, 2));
+
+  /*
+   * The second tile begins after all components of the first.
+   */
+  ASSERT_EQ(12, layout(4, 0));
+  ASSERT_EQ(17, layout(5, 1));
+
+  /*
+   * Size is rounded up to whole tiles: 10 elements -> 3 tiles of 4.
+   */
+  ASSERT_EQ(3 * 4 * num_components, layout.size());
+}
+
+TEST(AoSoALayoutUnitTest, ToIndices)
+{
+  using my_layout = RAJA::AoSoALayout<8>;
+
+  const my_layout layout(24, 2);
+
+  for (int i = 0; i < 24; ++i) {
+    for (int comp = 0; comp < 2; ++comp) {
+      int ti, tcomp;
+      layout.toIndices(layout(i, comp), ti, tcomp);
+      ASSERT_EQ(i, ti);
+      ASSERT_EQ(comp, tcomp);
+    }
+  }
+}
+
+TEST(AoSoALayoutUnitTest, ViewAccess)
+{
+  using my_layout = RAJA::AoSoALayout<4>;
+
+  constexpr int num_elements = 13;
+  constexpr int num_components = 3;
+
+  const my_layout layout(num_elements, num_components);
+
+  std::vector<double> data(layout.size(), 0.0);
+  RAJA::View<double, my_layout> view(data.data(), layout);
+
+  for (int i = 0; i < num_elements; ++i) {
+    for (int comp = 0; comp < num_components; ++comp) {
+      view(i, comp) = 100.0 * i + comp;
+    }
+  }
+
+  /*
+   * Every (element, component) value is recovered and each linear slot
+   * was written at most once.
+   */
+  for (int i = 0; i < num_elements; ++i) {
+    for (int comp = 0; comp < num_components; ++comp) {
+      ASSERT_EQ(100.0 * i + comp, view(i, comp));
+    }
+  }
+}
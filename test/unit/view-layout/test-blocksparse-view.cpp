@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for block-sparse views
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(BlockSparseViewUnitTest, MatchesDenseWithImplicitZeros)
+{
+  using IdxT = RAJA::Index_type;
+
+  const IdxT ni = 12, nj = 16;
+  const IdxT bi = 4, bj = 4;
+  const IdxT nbi = 3, nbj = 4;
+
+  // two material blobs in an otherwise-zero volume fraction field
+  std::vector<double> dense(ni * nj, 0.0);
+  for (IdxT i = 0; i < 4; ++i) {
+    for (IdxT j = 4; j < 8; ++j) {
+      dense[i * nj + j] = 1.0 + i + j;
+    }
+  }
+  dense[9 * nj + 13] = 7.0;
+
+  IdxT nblocks = RAJA::blockSparseCountBlocks(dense.data(), ni, nj, bi, bj);
+  ASSERT_EQ(nblocks, 2);
+
+  std::vector<double> pool(nblocks * bi * bj);
+  std::vector<IdxT> block_map(nbi * nbj);
+  std::vector<IdxT> block_ids(nblocks);
+
+  auto view = RAJA::blockSparseFill(dense.data(), ni, nj, bi, bj,
+                                    pool.data(), block_map.data(),
+                                    block_ids.data());
+  ASSERT_EQ(view.num_present, nblocks);
+
+  // reads match the dense field everywhere, including absent blocks
+  for (IdxT i = 0; i < ni; ++i) {
+    for (IdxT j = 0; j < nj; ++j) {
+      ASSERT_EQ(view(i, j), dense[i * nj + j]);
+    }
+  }
+
+  // writable access into a present block
+  view.at(9, 13) = 8.0;
+  ASSERT_EQ(view(9, 13), 8.0);
+}
+
+TEST(BlockSparseViewUnitTest, ForallOverPresentBlocks)
+{
+  using IdxT = RAJA::Index_type;
+
+  const IdxT ni = 8, nj = 8;
+  const IdxT bi = 4, bj = 4;
+
+  std::vector<double> dense(ni * nj, 0.0);
+  dense[0 * nj + 0] = 2.0;  // block (0, 0)
+  dense[5 * nj + 6] = 3.0;  // block (1, 1)
+
+  IdxT nblocks = RAJA::blockSparseCountBlocks(dense.data(), ni, nj, bi, bj);
+  ASSERT_EQ(nblocks, 2);
+
+  std::vector<double> pool(nblocks * bi * bj);
+  std::vector<IdxT> block_map(4);
+  std::vector<IdxT> block_ids(nblocks);
+
+  auto view = RAJA::blockSparseFill(dense.data(), ni, nj, bi, bj,
+                                    pool.data(), block_map.data(),
+                                    block_ids.data());
+
+  // a material loop touches only the stored blocks
+  RAJA::forall<RAJA::seq_exec>(view.present_blocks(), [=](IdxT s) {
+    auto blk = view.block_view(s);
+    for (IdxT li = 0; li < bi; ++li) {
+      for (IdxT lj = 0; lj < bj; ++lj) {
+        blk(li, lj) *= 10.0;
+      }
+    }
+  });
+
+  ASSERT_EQ(view(0, 0), 20.0);
+  ASSERT_EQ(view(5, 6), 30.0);
+  ASSERT_EQ(view(0, 7), 0.0);  // absent block untouched
+
+  // block-origin helpers recover field coordinates from a slot
+  ASSERT_EQ(view.block_begin_i(0), 0);
+  ASSERT_EQ(view.block_begin_j(0), 0);
+  ASSERT_EQ(view.block_begin_i(1), 4);
+  ASSERT_EQ(view.block_begin_j(1), 4);
+}
+
+TEST(BlockSparseViewUnitTest, RaggedEdgeBlocks)
+{
+  using IdxT = RAJA::Index_type;
+
+  // extents not a multiple of the block size; edge blocks are padded
+  const IdxT ni = 5, nj = 6;
+  const IdxT bi = 4, bj = 4;
+
+  std::vector<double> dense(ni * nj, 0.0);
+  dense[4 * nj + 5] = 9.0;  // lives in the 1x2 corner block
+
+  IdxT nblocks = RAJA::blockSparseCountBlocks(dense.data(), ni, nj, bi, bj);
+  ASSERT_EQ(nblocks, 1);
+
+  std::vector<double> pool(nblocks * bi * bj);
+  std::vector<IdxT> block_map(4);
+  std::vector<IdxT> block_ids(nblocks);
+
+  auto view = RAJA::blockSparseFill(dense.data(), ni, nj, bi, bj,
+                                    pool.data(), block_map.data(),
+                                    block_ids.data());
+
+  for (IdxT i = 0; i < ni; ++i) {
+    for (IdxT j = 0; j < nj; ++j) {
+      ASSERT_EQ(view(i, j), dense[i * nj + j]);
+    }
+  }
+
+  // an all-zero field stores no blocks
+  std::vector<double> zeros(ni * nj, 0.0);
+  ASSERT_EQ(RAJA::blockSparseCountBlocks(zeros.data(), ni, nj, bi, bj), 0);
+}
@@ -175,6 +175,43 @@ TEST(LayoutUnitTest, 2D_StrideOne)
   }
 }
 
+TEST(LayoutUnitTest, 2D_StrideOneAnnotated)
+{
+  /*
+   * The compile-time permutation overload annotates the stride-1
+   * dimension in the layout type; indexing must match the std::array
+   * overload exactly.
+   */
+  const auto layout =
+      RAJA::make_permuted_layout({{3, 5}},
+                                 RAJA::as_array<RAJA::PERM_JI>::get());
+
+  const auto layout_s1 = RAJA::make_permuted_layout({{3, 5}}, RAJA::PERM_JI{});
+
+  static_assert(decltype(layout_s1)::stride1_dim == 0,
+                "last permutation entry must be annotated stride-1");
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 5; ++j) {
+
+      ASSERT_EQ(layout(i, j), layout_s1(i, j));
+    }
+  }
+
+  /*
+   * StrideOneLayout annotates the default right-most stride-1 dimension.
+   */
+  RAJA::Layout<2> dynamic_layout(7, 5);
+  RAJA::StrideOneLayout<2> s1_layout(7, 5);
+
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 5; ++j) {
+
+      ASSERT_EQ(dynamic_layout(i, j), s1_layout(i, j));
+    }
+  }
+}
+
 TEST(StaticLayoutUnitTest, 2D_StaticLayout)
 {
   RAJA::Layout<2> dynamic_layout(7, 5);
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for memory-mapped read-only views
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+//! write count doubles with values f(i) = 0.5 * i to a binary file
+void writeTableFile(const char* path, int count)
+{
+  std::vector<double> table(count);
+  for (int i = 0; i < count; ++i) {
+    table[i] = 0.5 * i;
+  }
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(table.data()),
+             count * static_cast<long>(sizeof(double)));
+}
+
+}  // namespace
+
+TEST(MappedViewUnitTest, TwoDimensionalLayout)
+{
+  const char* path = "test-mapped-view-2d.bin";
+  constexpr int ni = 8;
+  constexpr int nj = 5;
+  writeTableFile(path, ni * nj);
+
+  {
+    auto table = RAJA::make_mapped_view<double>(path, RAJA::Layout<2>(ni, nj));
+
+    // values come back through the layout without any load step
+    for (int i = 0; i < ni; ++i) {
+      for (int j = 0; j < nj; ++j) {
+        ASSERT_EQ(0.5 * (i * nj + j), table(i, j));
+      }
+    }
+
+    // the accessor hands out read-only references
+    static_assert(
+        std::is_const<typename std::remove_reference<decltype(table(0, 0))>::
+                          type>::value,
+        "mapped view accessor must be read-only");
+
+    // kernels capture the non-owning view by value
+    auto view = table.view();
+    double sum = 0.0;
+    double* sptr = &sum;
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, ni),
+                                 [=](int i) {
+      for (int j = 0; j < nj; ++j) {
+        *sptr += view(i, j);
+      }
+    });
+    ASSERT_EQ(0.5 * (ni * nj) * (ni * nj - 1) / 2, sum);
+  }
+
+  std::remove(path);
+}
+
+TEST(MappedViewUnitTest, OneDimensionalExtentFromFileSize)
+{
+  const char* path = "test-mapped-view-1d.bin";
+  constexpr int len = 100;
+  writeTableFile(path, len);
+
+  {
+    auto table = RAJA::make_mapped_view<double>(path);
+    for (int i = 0; i < len; ++i) {
+      ASSERT_EQ(0.5 * i, table(i));
+    }
+  }
+
+  std::remove(path);
+}
+
+TEST(MappedViewUnitTest, AdviceAndMoveSemantics)
+{
+  const char* path = "test-mapped-view-advice.bin";
+  constexpr int len = 64;
+  writeTableFile(path, len);
+
+  {
+    auto table = RAJA::make_mapped_view<double>(
+        path, RAJA::Layout<1>(len), RAJA::MappedViewAdvice::sequential);
+    ASSERT_EQ(0.0, table(0));
+
+    // hints may be changed as the traversal pattern changes
+    table.advise(RAJA::MappedViewAdvice::random);
+    table.advise(RAJA::MappedViewAdvice::willneed);
+    ASSERT_EQ(0.5 * (len - 1), table(len - 1));
+
+    // the mapping moves; the moved-to object owns and serves accesses
+    auto moved = std::move(table);
+    ASSERT_EQ(0.5 * 3, moved(3));
+  }
+
+  std::remove(path);
+}
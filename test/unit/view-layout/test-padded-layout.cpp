@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+/*
+ * Tests for PaddedStaticLayout and PaddedLocalArray, which pad the
+ * fastest-varying extent to stagger power-of-two tiles across memory
+ * banks and cache sets.
+ */
+
+TEST(PaddedLayoutUnitTest, 2D_RowMajor)
+{
+  // 4x8 tile, row-major, pad rows by 1 element
+  using layout = RAJA::PaddedStaticLayout<RAJA::PERM_IJ, 1, 4, 8>;
+
+  // rows are 9 elements apart, padding is never addressed
+  ASSERT_EQ(0, layout::s_oper(0, 0));
+  ASSERT_EQ(1, layout::s_oper(0, 1));
+  ASSERT_EQ(9, layout::s_oper(1, 0));
+  ASSERT_EQ(9 * 3 + 7, layout::s_oper(3, 7));
+
+  // allocation covers the padded rows
+  ASSERT_EQ(4 * 9, layout::size());
+}
+
+TEST(PaddedLayoutUnitTest, 2D_ColMajor)
+{
+  // with a JI permutation the I extent is fastest-varying and is padded
+  using layout = RAJA::PaddedStaticLayout<RAJA::PERM_JI, 1, 4, 8>;
+
+  ASSERT_EQ(0, layout::s_oper(0, 0));
+  ASSERT_EQ(1, layout::s_oper(1, 0));
+  ASSERT_EQ(5, layout::s_oper(0, 1));
+  ASSERT_EQ(5 * 7 + 3, layout::s_oper(3, 7));
+
+  ASSERT_EQ(5 * 8, layout::size());
+}
+
+TEST(PaddedLayoutUnitTest, 3D_WidePad)
+{
+  // pad by 2 elements; only the fastest extent grows
+  using layout = RAJA::PaddedStaticLayout<RAJA::PERM_IJK, 2, 2, 3, 4>;
+
+  ASSERT_EQ(1, layout::s_oper(0, 0, 1));
+  ASSERT_EQ(6, layout::s_oper(0, 1, 0));
+  ASSERT_EQ(18, layout::s_oper(1, 0, 0));
+
+  ASSERT_EQ(2 * 3 * 6, layout::size());
+}
+
+TEST(PaddedLocalArrayUnitTest, AccessAndAlignment)
+{
+  using array_t = RAJA::PaddedLocalArray<double,
+                                         RAJA::PERM_IJ,
+                                         RAJA::SizeList<4, 8>,
+                                         1,
+                                         64>;
+
+  ASSERT_EQ(4 * 9, (int)array_t::NumElem);
+  ASSERT_EQ(64, (int)array_t::Alignment);
+
+  alignas(array_t::Alignment) double storage[array_t::NumElem];
+
+  array_t tile;
+  tile.m_arrayPtr = storage;
+
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      tile(i, j) = 10.0 * i + j;
+    }
+  }
+
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      ASSERT_EQ(10.0 * i + j, tile(i, j));
+      ASSERT_EQ(&storage[9 * i + j], &tile(i, j));
+    }
+  }
+}
+
+TEST(PaddedLocalArrayUnitTest, DefaultAlignment)
+{
+  // unpadded arrays still advertise their natural alignment
+  using plain_t =
+      RAJA::LocalArray<int, RAJA::PERM_IJ, RAJA::SizeList<4, 4>>;
+
+  ASSERT_EQ(alignof(int), (size_t)plain_t::Alignment);
+  ASSERT_EQ(16, (int)plain_t::NumElem);
+}
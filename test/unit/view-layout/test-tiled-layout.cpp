@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <set>
+#include <vector>
+
+TEST(TiledLayoutUnitTest, 2D_TilesContiguous)
+{
+  const auto layout = RAJA::make_tiled_layout(
+      std::array<RAJA::Index_type, 2>{{13, 10}}, RAJA::Tiles<8, 8>{});
+
+  /*
+   * Sizes pad up to whole tiles: a 2x2 grid of 8x8 tiles.
+   */
+  ASSERT_EQ(2 * 2 * 64, layout.size());
+
+  /*
+   * Elements of one tile are contiguous in row-major order.
+   */
+  ASSERT_EQ(layout(0, 0) + 1, layout(0, 1));
+  ASSERT_EQ(layout(0, 0) + 8, layout(1, 0));
+
+  /*
+   * Matches the hand-derived formula for an interior point.
+   */
+  RAJA::Index_type i = 9, j = 9;
+  ASSERT_EQ(((i / 8) * 2 + (j / 8)) * 64 + (i % 8) * 8 + (j % 8),
+            layout(i, j));
+
+  /*
+   * Every in-bounds index maps to a unique linear index within size().
+   */
+  std::set<RAJA::Index_type> seen;
+  for (RAJA::Index_type ii = 0; ii < 13; ++ii) {
+    for (RAJA::Index_type jj = 0; jj < 10; ++jj) {
+      RAJA::Index_type lin = layout(ii, jj);
+      ASSERT_GE(lin, 0);
+      ASSERT_LT(lin, layout.size());
+      ASSERT_TRUE(seen.insert(lin).second);
+    }
+  }
+}
+
+TEST(TiledLayoutUnitTest, 2D_OffsetPermutedTiled)
+{
+  /*
+   * Ghost-cell-offset indices in [-2, 9] x [-2, 13], 4x4 tiles, with
+   * i's tiles stride-1 in the tile grid.
+   */
+  const auto layout = RAJA::make_tiled_offset_layout(
+      std::array<RAJA::Index_type, 2>{{-2, -2}},
+      std::array<RAJA::Index_type, 2>{{9, 13}},
+      RAJA::Tiles<4, 4>{},
+      RAJA::as_array<RAJA::PERM_JI>::get());
+
+  /*
+   * 12 x 16 index space tiles into a 3 x 4 grid of 4x4 tiles.
+   */
+  ASSERT_EQ(3 * 4 * 16, layout.size());
+
+  /*
+   * First element maps to index 0, and i's tile neighbor is the next
+   * whole tile.
+   */
+  ASSERT_EQ(0, layout(-2, -2));
+  ASSERT_EQ(layout(-2, -2) + 16, layout(2, -2));
+
+  /*
+   * Matches the hand-derived formula: shift to zero-based, tile by 4,
+   * grid strides from PERM_JI.
+   */
+  RAJA::Index_type i = 5, j = 11;
+  RAJA::Index_type zi = i + 2, zj = j + 2;
+  ASSERT_EQ(((zj / 4) * 3 + (zi / 4)) * 16 + (zi % 4) * 4 + (zj % 4),
+            layout(i, j));
+}
+
+TEST(TiledLayoutUnitTest, ViewRoundTrip)
+{
+  const auto layout = RAJA::make_tiled_layout(
+      std::array<RAJA::Index_type, 2>{{10, 6}}, RAJA::Tiles<4, 4>{});
+
+  std::vector<double> data(layout.size(), 0.0);
+  RAJA::View<double, RAJA::TiledLayout<RAJA::Index_type, 4, 4>> view(
+      data.data(), RAJA::TiledLayout<RAJA::Index_type, 4, 4>{layout});
+
+  for (RAJA::Index_type i = 0; i < 10; ++i) {
+    for (RAJA::Index_type j = 0; j < 6; ++j) {
+      view(i, j) = static_cast<double>(i * 6 + j);
+    }
+  }
+
+  for (RAJA::Index_type i = 0; i < 10; ++i) {
+    for (RAJA::Index_type j = 0; j < 6; ++j) {
+      ASSERT_EQ(static_cast<double>(i * 6 + j), view(i, j));
+    }
+  }
+}
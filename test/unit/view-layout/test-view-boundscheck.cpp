@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for runtime-selected bounds-checked views
+///
+
+#include <cstdlib>
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename V>
+bool is_checked(V const &)
+{
+  return false;
+}
+
+template <typename V>
+bool is_checked(RAJA::BoundsCheckedViewWrapper<V> const &)
+{
+  return true;
+}
+
+// Runs first: the environment is read once and cached on the first
+// bounds_check_requested call, so it must be set before any other test
+// exercises the selection path.
+TEST(ViewBoundsCheck, EnvSelection)
+{
+  setenv("RAJA_BOUNDS_CHECK", "pressure,velocity", 1);
+
+  double data[6];
+  RAJA::View<double, RAJA::Layout<2>> view(data, 2, 3);
+
+  bool checked = false;
+  RAJA::with_bounds_check("pressure", view, [&](auto const &v) {
+    checked = is_checked(v);
+  });
+  ASSERT_TRUE(checked);
+
+  RAJA::with_bounds_check("velocity", view, [&](auto const &v) {
+    checked = is_checked(v);
+  });
+  ASSERT_TRUE(checked);
+
+  RAJA::with_bounds_check("density", view, [&](auto const &v) {
+    checked = is_checked(v);
+  });
+  ASSERT_FALSE(checked);
+
+  // substrings of a listed name do not match
+  RAJA::with_bounds_check("press", view, [&](auto const &v) {
+    checked = is_checked(v);
+  });
+  ASSERT_FALSE(checked);
+}
+
+TEST(ViewBoundsCheck, WrapperPassThrough)
+{
+  double data[12];
+  RAJA::View<double, RAJA::Layout<2>> view(data, 3, 4);
+  auto checked = RAJA::make_bounds_checked_view(view);
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      view(i, j) = i * 4 + j;
+    }
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_EQ(checked(i, j), view(i, j));
+    }
+  }
+}
+
+TEST(ViewBoundsCheck, WrapperCatchesOutOfBounds)
+{
+  double data[12];
+  RAJA::View<double, RAJA::Layout<2>> view(data, 3, 4);
+  auto checked = RAJA::make_bounds_checked_view(view);
+
+  EXPECT_THROW(checked(3, 0), std::runtime_error);
+  EXPECT_THROW(checked(0, 4), std::runtime_error);
+  EXPECT_THROW(checked(-1, 0), std::runtime_error);
+}
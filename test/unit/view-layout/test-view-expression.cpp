@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Unit tests for View expression templates.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(ViewExpressionUnitTest, FusedChain)
+{
+  constexpr int NR = 7;
+  constexpr int NC = 11;
+  constexpr int N = NR * NC;
+
+  std::vector<double> a_data(N), b_data(N), c_data(N, 0.0), d_data(N);
+
+  RAJA::View<double, RAJA::Layout<2>> a(a_data.data(), NR, NC);
+  RAJA::View<double, RAJA::Layout<2>> b(b_data.data(), NR, NC);
+  RAJA::View<double, RAJA::Layout<2>> c(c_data.data(), NR, NC);
+  RAJA::View<double, RAJA::Layout<2>> d(d_data.data(), NR, NC);
+
+  for (int i = 0; i < N; ++i) {
+    a_data[i] = 1.0 + i;
+    b_data[i] = 2.0 * i;
+    d_data[i] = 0.5 * i;
+  }
+
+  auto A = RAJA::make_expression(a);
+  auto B = RAJA::make_expression(b);
+  auto C = RAJA::make_expression(c);
+  auto D = RAJA::make_expression(d);
+
+  // no evaluation happens while building the tree
+  auto expr = A * B + D;
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(c_data[i], 0.0);
+  }
+
+  C = expr;
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(c_data[i], a_data[i] * b_data[i] + d_data[i]);
+  }
+}
+
+TEST(ViewExpressionUnitTest, ScalarsAndExplicitPolicy)
+{
+  constexpr int N = 45;
+
+  std::vector<double> a_data(N), c_data(N, 0.0);
+
+  RAJA::View<double, RAJA::Layout<1>> a(a_data.data(), N);
+  RAJA::View<double, RAJA::Layout<1>> c(c_data.data(), N);
+
+  for (int i = 0; i < N; ++i) {
+    a_data[i] = 10.0 + i;
+  }
+
+  auto A = RAJA::make_expression(a);
+  auto C = RAJA::make_expression(c);
+
+  C.evaluate<RAJA::seq_exec>(2.0 * A - (A + 1.0) / 4.0);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(c_data[i], 2.0 * a_data[i] - (a_data[i] + 1.0) / 4.0);
+  }
+}
@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::fill and RAJA::copy on Views
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+TEST(ViewFillCopy, FillZeroContiguous)
+{
+  constexpr int NX = 7;
+  constexpr int NY = 11;
+
+  std::vector<double> data(NX * NY, 3.0);
+  RAJA::View<double, RAJA::Layout<2>> view(data.data(), NX, NY);
+
+  auto res = RAJA::resources::Host::get_default();
+  RAJA::fill(res, view, 0.0);
+
+  for (double v : data) {
+    ASSERT_EQ(0.0, v);
+  }
+}
+
+TEST(ViewFillCopy, FillNonSplatValue)
+{
+  constexpr int NX = 5;
+  constexpr int NY = 9;
+
+  std::vector<double> data(NX * NY, 0.0);
+  RAJA::View<double, RAJA::Layout<2>> view(data.data(), NX, NY);
+
+  auto res = RAJA::resources::Host::get_default();
+  RAJA::fill(res, view, 1.5);
+
+  for (double v : data) {
+    ASSERT_EQ(1.5, v);
+  }
+}
+
+TEST(ViewFillCopy, FillPermutedLayout)
+{
+  constexpr int NX = 6;
+  constexpr int NY = 4;
+
+  std::vector<int> data(NX * NY, -1);
+  // column-major: contiguous under a dimension permutation
+  auto layout = RAJA::make_permuted_layout({{NX, NY}},
+                                           RAJA::as_array<RAJA::Perm<1, 0>>::get());
+  RAJA::View<int, RAJA::Layout<2>> view(data.data(), layout);
+
+  auto res = RAJA::resources::Host::get_default();
+  RAJA::fill(res, view, 0);
+
+  for (int v : data) {
+    ASSERT_EQ(0, v);
+  }
+}
+
+TEST(ViewFillCopy, CopySameLayout)
+{
+  constexpr int NX = 8;
+  constexpr int NY = 3;
+
+  std::vector<double> src_data(NX * NY);
+  for (int i = 0; i < NX * NY; ++i) {
+    src_data[i] = static_cast<double>(i);
+  }
+  std::vector<double> dst_data(NX * NY, -1.0);
+
+  RAJA::View<double, RAJA::Layout<2>> src(src_data.data(), NX, NY);
+  RAJA::View<double, RAJA::Layout<2>> dst(dst_data.data(), NX, NY);
+
+  auto res = RAJA::resources::Host::get_default();
+  RAJA::copy(res, dst, src);
+
+  ASSERT_EQ(src_data, dst_data);
+}
+
+TEST(ViewFillCopy, CopyPermutingLayouts)
+{
+  constexpr int NX = 5;
+  constexpr int NY = 7;
+
+  std::vector<double> src_data(NX * NY);
+  std::vector<double> dst_data(NX * NY, -1.0);
+
+  // row-major source, column-major destination
+  RAJA::View<double, RAJA::Layout<2>> src(src_data.data(), NX, NY);
+  auto dst_layout = RAJA::make_permuted_layout(
+      {{NX, NY}}, RAJA::as_array<RAJA::Perm<1, 0>>::get());
+  RAJA::View<double, RAJA::Layout<2>> dst(dst_data.data(), dst_layout);
+
+  for (int x = 0; x < NX; ++x) {
+    for (int y = 0; y < NY; ++y) {
+      src(x, y) = static_cast<double>(x * 100 + y);
+    }
+  }
+
+  auto res = RAJA::resources::Host::get_default();
+  RAJA::copy(res, dst, src);
+
+  for (int x = 0; x < NX; ++x) {
+    for (int y = 0; y < NY; ++y) {
+      ASSERT_EQ(src(x, y), dst(x, y));
+    }
+  }
+  // the underlying storage really is transposed
+  ASSERT_EQ(src(1, 2), dst_data[2 * NX + 1]);
+}
@@ -0,0 +1,84 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for restrict-qualified view wrappers
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <type_traits>
+
+TEST(ViewRestrict, WrapperPassThrough)
+{
+  double data[12];
+  RAJA::View<double, RAJA::Layout<2>> view(data, 3, 4);
+  auto rview = RAJA::make_restrict_view(view);
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      rview(i, j) = i * 4 + j;
+    }
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_EQ(view(i, j), i * 4 + j);
+      ASSERT_EQ(rview(i, j), view(i, j));
+    }
+  }
+}
+
+TEST(ViewRestrict, WrapperSetData)
+{
+  double a[6] = {0, 1, 2, 3, 4, 5};
+  double b[6] = {5, 4, 3, 2, 1, 0};
+  RAJA::View<double, RAJA::Layout<1>> view(a, 6);
+  auto rview = RAJA::make_restrict_view(view);
+
+  rview.set_data(b);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(rview(i), b[i]);
+  }
+}
+
+TEST(ViewRestrict, ReadOnlyWrapper)
+{
+  double data[12];
+  RAJA::View<double, RAJA::Layout<2>> view(data, 3, 4);
+  auto roview = RAJA::make_readonly_restrict_view(view);
+
+  // read-only accessor returns by value
+  static_assert(
+      std::is_same<decltype(roview(0, 0)), double>::value,
+      "read-only restrict accessor must return by value");
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      view(i, j) = 2 * (i * 4 + j);
+    }
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_EQ(roview(i, j), view(i, j));
+    }
+  }
+}
+
+TEST(ViewRestrict, ReadOnlyFromConstView)
+{
+  double data[6] = {0, 1, 2, 3, 4, 5};
+  RAJA::View<const double, RAJA::Layout<1>> cview(data, 6);
+  auto roview = RAJA::make_readonly_restrict_view(cview);
+
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(roview(i), data[i]);
+  }
+}
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+/*
+ * Tests for View::slice, which builds lower-rank subviews that reuse
+ * the parent layout's strides
+ */
+
+TEST(ViewSliceUnitTest, Slice3DEachDim)
+{
+  constexpr int NI = 3;
+  constexpr int NJ = 4;
+  constexpr int NK = 5;
+
+  double data[NI * NJ * NK];
+  for (int e = 0; e < NI * NJ * NK; ++e) {
+    data[e] = static_cast<double>(e);
+  }
+
+  RAJA::View<double, RAJA::Layout<3>> v(data, NI, NJ, NK);
+
+  auto vjk = v.slice<0>(1);
+  for (int j = 0; j < NJ; ++j) {
+    for (int k = 0; k < NK; ++k) {
+      ASSERT_EQ(&vjk(j, k), &v(1, j, k));
+    }
+  }
+
+  auto vik = v.slice<1>(2);
+  for (int i = 0; i < NI; ++i) {
+    for (int k = 0; k < NK; ++k) {
+      ASSERT_EQ(&vik(i, k), &v(i, 2, k));
+    }
+  }
+
+  auto vij = v.slice<2>(3);
+  for (int i = 0; i < NI; ++i) {
+    for (int j = 0; j < NJ; ++j) {
+      ASSERT_EQ(&vij(i, j), &v(i, j, 3));
+    }
+  }
+}
+
+TEST(ViewSliceUnitTest, SliceOfSliceWrites)
+{
+  constexpr int NI = 2;
+  constexpr int NJ = 3;
+  constexpr int NK = 4;
+
+  int data[NI * NJ * NK];
+  for (int e = 0; e < NI * NJ * NK; ++e) {
+    data[e] = 0;
+  }
+
+  RAJA::View<int, RAJA::Layout<3>> v(data, NI, NJ, NK);
+
+  // writes through a slice of a slice land in the parent's storage
+  auto plane = v.slice<0>(1);
+  auto line = plane.slice<0>(2);
+  for (int k = 0; k < NK; ++k) {
+    line(k) = 100 + k;
+  }
+
+  for (int k = 0; k < NK; ++k) {
+    ASSERT_EQ(v(1, 2, k), 100 + k);
+    ASSERT_EQ(data[(1 * NJ + 2) * NK + k], 100 + k);
+  }
+}
+
+TEST(ViewSliceUnitTest, SlicePermutedLayout)
+{
+  constexpr int NI = 3;
+  constexpr int NJ = 4;
+
+  double data[NI * NJ];
+  for (int e = 0; e < NI * NJ; ++e) {
+    data[e] = static_cast<double>(e);
+  }
+
+  // column-major layout: i is the stride-1 dimension
+  RAJA::Layout<2> layout =
+      RAJA::make_permuted_layout({{NI, NJ}},
+                                 RAJA::as_array<RAJA::PERM_JI>::get());
+  RAJA::View<double, RAJA::Layout<2>> v(data, std::move(layout));
+
+  // slicing away j keeps i's unit stride
+  auto vi = v.slice<1>(2);
+  for (int i = 0; i < NI; ++i) {
+    ASSERT_EQ(&vi(i), &v(i, 2));
+  }
+  ASSERT_EQ(&vi(1), &vi(0) + 1);
+}
+
+TEST(ViewSliceUnitTest, SliceStrideOneAnnotation)
+{
+  // removing a leading dimension renumbers the stride-1 annotation;
+  // removing the stride-1 dimension itself drops it
+  using L3 = RAJA::StrideOneLayout<3>;
+  static_assert(L3::RemoveDimLayout<0>::stride1_dim == 1,
+                "stride-1 dim must renumber when an earlier dim is removed");
+  static_assert(L3::RemoveDimLayout<2>::stride1_dim == -1,
+                "stride-1 annotation must drop when its dim is removed");
+
+  constexpr int NI = 2;
+  constexpr int NJ = 3;
+  constexpr int NK = 4;
+
+  double data[NI * NJ * NK];
+  for (int e = 0; e < NI * NJ * NK; ++e) {
+    data[e] = static_cast<double>(e);
+  }
+
+  RAJA::View<double, L3> v(data, NI, NJ, NK);
+
+  auto vjk = v.slice<0>(1);
+  static_assert(decltype(vjk)::layout_type::stride1_dim == 1,
+                "slice of a StrideOneLayout view keeps the annotation");
+  for (int j = 0; j < NJ; ++j) {
+    for (int k = 0; k < NK; ++k) {
+      ASSERT_EQ(&vjk(j, k), &v(1, j, k));
+    }
+  }
+}
@@ -0,0 +1,127 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/*
+ * Tests for the experimental HaloExchangePlan persistent communication
+ * plan, using a memcpy "transport" in place of MPI
+ */
+
+using plan_policy = RAJA::WorkGroupPolicy<RAJA::seq_work,
+                                          RAJA::ordered,
+                                          RAJA::ragged_array_of_objects>;
+using plan_type = RAJA::expt::
+    HaloExchangePlan<plan_policy, int, std::allocator<char>>;
+
+TEST(HaloExchangePlanUnitTest, PackSendRecvUnpack)
+{
+  constexpr size_t num_neighbors = 3;
+  constexpr int buffer_len = 4;
+
+  // "variable" data: halo cells for neighbor n live at [n*buffer_len)
+  std::vector<double> var(num_neighbors * buffer_len);
+  std::vector<double> recv_var(num_neighbors * buffer_len, 0.0);
+  for (size_t e = 0; e < var.size(); ++e) {
+    var[e] = static_cast<double>(e) + 1.0;
+  }
+
+  std::vector<std::vector<double>> send_buffers(
+      num_neighbors, std::vector<double>(buffer_len, 0.0));
+  std::vector<std::vector<double>> recv_buffers(
+      num_neighbors, std::vector<double>(buffer_len, 0.0));
+
+  plan_type plan(num_neighbors, std::allocator<char>{});
+  ASSERT_EQ(plan.num_neighbors(), num_neighbors);
+
+  for (size_t n = 0; n < num_neighbors; ++n) {
+    double* var_ptr = var.data() + n * buffer_len;
+    double* recv_ptr = recv_var.data() + n * buffer_len;
+    double* send_buf = send_buffers[n].data();
+    double* recv_buf = recv_buffers[n].data();
+    plan.enqueue_pack(n, RAJA::TypedRangeSegment<int>(0, buffer_len),
+                      [=](int i) { send_buf[i] = var_ptr[i]; });
+    plan.enqueue_unpack(n, RAJA::TypedRangeSegment<int>(0, buffer_len),
+                        [=](int i) { recv_ptr[i] = recv_buf[i]; });
+  }
+  plan.finalize();
+
+  // exchange twice to cover reuse of the instantiated workgroups
+  for (int step = 0; step < 2; ++step) {
+
+    std::vector<size_t> sent_order;
+    plan.pack_and_send([&](size_t n) {
+      // send must only see a fully packed buffer
+      for (int i = 0; i < buffer_len; ++i) {
+        ASSERT_EQ(send_buffers[n][i], var[n * buffer_len + i]);
+      }
+      recv_buffers[n] = send_buffers[n];
+      sent_order.push_back(n);
+    });
+
+    ASSERT_EQ(sent_order.size(), num_neighbors);
+    for (size_t n = 0; n < num_neighbors; ++n) {
+      ASSERT_EQ(sent_order[n], n);
+    }
+
+    // deliver receives out of order to exercise waitany-style unpacking
+    std::vector<size_t> arrival{2, 0, 1};
+    size_t next_arrival = 0;
+    plan.recv_and_unpack([&]() { return arrival[next_arrival++]; });
+
+    for (size_t e = 0; e < var.size(); ++e) {
+      ASSERT_EQ(recv_var[e], var[e]);
+    }
+
+    // next step packs updated values through the same plan
+    for (size_t e = 0; e < var.size(); ++e) {
+      var[e] += 100.0;
+      recv_var[e] = 0.0;
+    }
+  }
+}
+
+TEST(HaloExchangePlanUnitTest, MultipleLoopsPerNeighbor)
+{
+  constexpr size_t num_neighbors = 2;
+  constexpr int half_len = 3;
+  constexpr int buffer_len = 2 * half_len;
+
+  std::vector<int> var(num_neighbors * buffer_len);
+  for (size_t e = 0; e < var.size(); ++e) {
+    var[e] = static_cast<int>(e) + 10;
+  }
+
+  std::vector<std::vector<int>> buffers(num_neighbors,
+                                        std::vector<int>(buffer_len, 0));
+
+  plan_type plan(num_neighbors, std::allocator<char>{});
+
+  // two pack loops per neighbor, each filling half of the buffer
+  for (size_t n = 0; n < num_neighbors; ++n) {
+    int* var_ptr = var.data() + n * buffer_len;
+    int* buf = buffers[n].data();
+    plan.enqueue_pack(n, RAJA::TypedRangeSegment<int>(0, half_len),
+                      [=](int i) { buf[i] = var_ptr[i]; });
+    plan.enqueue_pack(n, RAJA::TypedRangeSegment<int>(half_len, buffer_len),
+                      [=](int i) { buf[i] = var_ptr[i]; });
+  }
+  plan.finalize();
+
+  size_t num_sends = 0;
+  plan.pack_and_send([&](size_t n) {
+    for (int i = 0; i < buffer_len; ++i) {
+      ASSERT_EQ(buffers[n][i], var[n * buffer_len + i]);
+    }
+    ++num_sends;
+  });
+  ASSERT_EQ(num_sends, num_neighbors);
+}
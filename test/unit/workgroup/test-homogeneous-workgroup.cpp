@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+/*
+ * Tests for the experimental homogeneous workgroup, which stores loops of
+ * one declared segment and body type and dispatches them statically.
+ */
+
+TEST(HomogeneousWorkGroupUnitTest, EnqueueAndRun)
+{
+  constexpr RAJA::Index_type num_segments = 5;
+  constexpr RAJA::Index_type segment_len = 10;
+
+  std::vector<int> data(num_segments * segment_len, 0);
+  int* data_ptr = data.data();
+
+  auto body = [=](RAJA::Index_type i) { data_ptr[i] += 1; };
+
+  auto pool = RAJA::expt::make_homogeneous_workpool<
+      RAJA::seq_exec, RAJA::Index_type, RAJA::xargs<>>(
+      RAJA::RangeSegment(0, 0), body);
+
+  for (RAJA::Index_type s = 0; s < num_segments; ++s) {
+    pool.enqueue(RAJA::RangeSegment(s * segment_len, (s + 1) * segment_len),
+                 body);
+  }
+  ASSERT_EQ(pool.num_loops(), size_t(num_segments));
+
+  auto group = pool.instantiate();
+  ASSERT_EQ(pool.num_loops(), size_t(0));
+  ASSERT_EQ(group.num_loops(), size_t(num_segments));
+
+  group.run();
+  for (int v : data) {
+    ASSERT_EQ(v, 1);
+  }
+
+  // the group can be run again
+  group.run();
+  for (int v : data) {
+    ASSERT_EQ(v, 2);
+  }
+}
+
+TEST(HomogeneousWorkGroupUnitTest, ExtraArgs)
+{
+  constexpr RAJA::Index_type len = 20;
+
+  std::vector<int> data(len, 0);
+  int* data_ptr = data.data();
+
+  auto body = [=](RAJA::Index_type i, int value) { data_ptr[i] = value; };
+
+  auto pool = RAJA::expt::make_homogeneous_workpool<
+      RAJA::seq_exec, RAJA::Index_type, RAJA::xargs<int>>(
+      RAJA::RangeSegment(0, 0), body);
+
+  pool.enqueue(RAJA::RangeSegment(0, len / 2), body);
+  pool.enqueue(RAJA::RangeSegment(len / 2, len), body);
+
+  auto group = pool.instantiate();
+
+  group.run(7);
+  for (int v : data) {
+    ASSERT_EQ(v, 7);
+  }
+}
+
+TEST(HomogeneousWorkGroupUnitTest, PoolReuse)
+{
+  constexpr RAJA::Index_type len = 8;
+
+  std::vector<int> data(len, 0);
+  int* data_ptr = data.data();
+
+  auto body = [=](RAJA::Index_type i) { data_ptr[i] += 1; };
+
+  auto pool = RAJA::expt::make_homogeneous_workpool<
+      RAJA::seq_exec, RAJA::Index_type, RAJA::xargs<>>(
+      RAJA::RangeSegment(0, 0), body);
+
+  pool.enqueue(RAJA::RangeSegment(0, len), body);
+  auto group1 = pool.instantiate();
+
+  // the pool is reusable after instantiate
+  pool.enqueue(RAJA::RangeSegment(0, len), body);
+  pool.enqueue(RAJA::RangeSegment(0, len), body);
+  auto group2 = pool.instantiate();
+
+  group1.run();
+  group2.run();
+  for (int v : data) {
+    ASSERT_EQ(v, 3);
+  }
+}